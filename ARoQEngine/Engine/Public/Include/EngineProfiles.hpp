@@ -36,10 +36,38 @@ namespace engine
 		gu::uint8 VSync = 0;
 	};
 
+	struct FramePipelineSettings
+	{
+		/*! @brief XVXbhƕ`Xbh̊ԂŎ󂯓nXibvVbgobt@̐ (1݂͌Ɏs, 2ȏōXVK-1t[sł܂) @n
+		*          `ɎgTransform, Cg, JFrameSnapshot::Render֕邽, 2ȏł`摤͍XṼV[ǂݍ݂܂.*/
+		gu::uint32 SnapshotBufferCount = 2;
+	};
+
+	struct ProfilerSettings
+	{
+		/*! @brief NCPUvt@C̋L^s (GU_PROFILER_ENABLED0̏ꍇ͏ɋL^܂)*/
+		bool EnableOnStartUp = true;
+
+		/*! @brief ShutDownChrome trace`ŏo͂t@CpX (nullptȑꍇ͏o͂܂)*/
+		const char* ChromeTraceFilePath = nullptr;
+	};
+
+	struct MemorySettings
+	{
+		/*! @brief 1̊mۂŃR[X^bNL^邩 (0͋L^Ȃ, GU_MEMORY_TRACKING_ENABLED0̏ꍇ͏ɋL^܂)*/
+		gu::uint32 CallstackSampleRate = 0;
+
+		/*! @brief ShutDownɃ^OƂ̃gpʂƖ̊mۂo͂t@CpX (nullptȑꍇ͏o͂܂)*/
+		const char* StatisticsFilePath = nullptr;
+	};
+
 	struct StartUpParameters
 	{
 		platform::core::CoreWindowDesc WindowSettings = {};
 		GraphicsSettings GraphicsSettings = {};
+		FramePipelineSettings FramePipelineSettings = {};
+		ProfilerSettings ProfilerSettings = {};
+		MemorySettings   MemorySettings   = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -82,7 +82,7 @@ namespace engine::core
 
 		gu::DynamicArray<bool> _hasCompletedExecution = {};
 		SemaphorePtr      _hasCompletedSemaphore = nullptr;
-		gu::uint64        _fenceValue = 0;
+		std::atomic<gu::uint64> _fenceValue = 0; // XV, `Xbh瓯Ɋ񍐂邽atomicɂĂ܂
 	};
 }
 #endif
\ No newline at end of file
@@ -16,6 +16,8 @@
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Thread/Public/Include/GUFramePipeline.hpp"
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -30,6 +32,28 @@ namespace engine
 {
 	class IRenderPipeline;
 	class Camera;
+
+	/****************************************************************************
+	*				  			    FrameSnapshot
+	****************************************************************************/
+	/* @brief     XVXbh1t[̏Iɏ, `Xbhǂݍރt[̏ł. @n
+	*             `Xbh͍XVXbh񂾌̃t[`悷邽, `摤͂̒lQƂĂ. @n
+	*             V[Transform, Cg, JRenderɕ邽, XVXbh̃t[łԂ`摤͕ύX܂.
+	*****************************************************************************/
+	struct FrameSnapshot
+	{
+		/*! @brief XVXbh̃t[ԍ*/
+		gu::uint64 FrameIndex = 0;
+
+		/*! @brief XV̌oߎ [s]*/
+		float DeltaTime = 0.0f;
+
+		/*! @brief NĂ̎ [s]*/
+		float TotalTime = 0.0f;
+
+		/*! @brief `ɎgTransform, Cg, J̕ (XVRenderSnapshot::GetWriting, `撆RenderSnapshot::GetReadingQƂ܂)*/
+		gu::SharedPointer<engine::RenderSnapshot> Render = nullptr;
+	};
 }
 //////////////////////////////////////////////////////////////////////////////////
 //                               Class
@@ -81,6 +105,9 @@ public:
 
 	RenderPipelinePtr GetRenderPipeline() const noexcept { return _renderPipeline; }
 
+	/* @brief : `Xbhݕ`悵Ăt[̏. `XbhĂяoĂ.*/
+	const engine::FrameSnapshot& GetRenderFrameSnapshot() const noexcept { return _frameSnapshots[_renderSnapshotIndex]; }
+
 	void SetRenderingPipeline(const RenderPipelinePtr& pipeline) { _renderPipeline = pipeline; }
 
 	/****************************************************************************
@@ -129,6 +156,14 @@ protected:
 	bool _isApplicationPaused = false;
 #pragma endregion Main Thread
 
+#pragma region Update Thread
+	/* @brief : XVXbh`Xbhփt[󂯓npCvC*/
+	gu::SharedPointer<gu::FramePipeline> _framePipeline = nullptr;
+
+	/* @brief : t[pCvC̃obt@̎*/
+	gu::DynamicArray<engine::FrameSnapshot> _frameSnapshots = {};
+#pragma endregion Update Thread
+
 #pragma region Render Thread
 	// @brief : `Xbh̃Q[^C}[
 	GameTimerPtr _renderThreadTimer = nullptr;
@@ -139,6 +174,9 @@ protected:
 	/* @brief : `pCvC. ftHgłURPgp܂.*/
 	RenderPipelinePtr _renderPipeline = nullptr;
 
+	/* @brief : `撆̃t[̃XibvVbg̃CfbNX*/
+	gu::uint32 _renderSnapshotIndex = 0;
+
 #pragma endregion Render Thread
 #pragma endregion Variables
 };
@@ -46,8 +46,7 @@ bool EngineThreadManager::CallExecuteComplete(const ThreadPoolType type)
 	}
 
 	_hasCompletedExecution[(int)type] = true;
-	_fenceValue++;
-	_hasCompletedSemaphore->Signal(_fenceValue);
+	_hasCompletedSemaphore->Signal(_fenceValue.fetch_add(1) + 1);
 	return true;
 }
 
@@ -26,6 +26,11 @@
 // timer
 #include "GameUtility/Base/Include/GameTimer.hpp"
 #include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+// math
+#include "GameUtility/Math/Include/GMCPUFeature.hpp"
 
 #include "MainGame/Core/Include/GameManager.hpp"
 #include "MainGame/Core/Include/SceneManager.hpp"
@@ -57,6 +62,23 @@ void PPPEngine::StartUp(const StartUpParameters& setting)
 
 	StartUpParameter = setting;
 
+	/*---------------------------------------------------------------
+					  CPUvt@C̎̊_L^
+	-----------------------------------------------------------------*/
+	gu::Profiler::Initialize();
+	gu::Profiler::SetEnabled(setting.ProfilerSettings.EnableOnStartUp);
+
+	/*---------------------------------------------------------------
+					  [Np̃R[X^bN̋L^Ԋu
+	-----------------------------------------------------------------*/
+	gu::Memory::SetCallstackSampleRate(setting.MemorySettings.CallstackSampleRate);
+
+	/*---------------------------------------------------------------
+					  ob`ŎgpSIMD߃Zbg̔
+	-----------------------------------------------------------------*/
+	gm::CPUFeature::Initialize();
+	printf("simd instruction set : %s\n", gm::CPUFeature::ToString(gm::CPUFeature::GetActive()));
+
 	/*---------------------------------------------------------------
 					  Timer
 	-----------------------------------------------------------------*/
@@ -101,6 +123,17 @@ void PPPEngine::Run()
 	_engineThreadManager = gu::MakeShared<EngineThreadManager>();
 	_isStoppedAllThreads.store(false); // false
 
+	/*---------------------------------------------------------------
+					  XVXbhƕ`Xbh̃t[̎󂯓n
+	-----------------------------------------------------------------*/
+	_framePipeline = gu::MakeShared<gu::FramePipeline>(StartUpParameter.FramePipelineSettings.SnapshotBufferCount);
+	_frameSnapshots.Resize(_framePipeline->GetBufferCount());
+	for (auto& snapshot : _frameSnapshots)
+	{
+		snapshot.Render = gu::MakeShared<engine::RenderSnapshot>();
+	}
+	_renderSnapshotIndex = 0;
+
 	_engineThreadManager->GetUpdateMainThread()->Submit([&]() { this->ExecuteUpdateThread(); });
 	_engineThreadManager->GetRenderMainThread()->Submit([&]() { this->ExecuteRenderThread(); });
 }
@@ -110,7 +143,8 @@ void PPPEngine::Run()
 ****************************************************************************/
 /* @fn        void PPPEngine::ExecuteMainThread()
 *
-*  @brief     Message loopĂ܂.
+*  @brief     Message loopĂ܂. Q[̍XV͍XVXbhōs, @n
+*             bZ[WԂ͎̃t[܂܂ (őMESSAGE_WAIT_MILLISECONDS) Xbhx~܂.
 *
 *  @param[in] void
 *
@@ -118,7 +152,11 @@ void PPPEngine::Run()
 *****************************************************************************/
 void PPPEngine::ExecuteMainThread()
 {
-	_mainThreadTimer->Reset();
+	PROFILE_THREAD_NAME("Main Thread");
+
+	// bZ[W܂ł̍ő̑҂.
+	// XVXbhSetWindowText͖{XbhbZ[W܂Ŗ߂Ȃ, 1t[\ZĂ܂.
+	constexpr gu::int32 MESSAGE_WAIT_MILLISECONDS = 1;
 
 	/*---------------------------------------------------------------
 						Main Loop
@@ -127,29 +165,80 @@ void PPPEngine::ExecuteMainThread()
 	{
 		if (!_platformApplication->PumpMessage())
 		{
-			_mainThreadTimer->Tick();
-			if (!_isApplicationPaused)
-			{
-				_mainThreadTimer->AverageFrame(_mainWindow->GetWindowHandle());
-				GameInput::Instance().Update();
-				// VOXbh.
-				GameManager::Instance().GameUpdateMain();
-			}
+			PROFILE_SCOPE("Main Thread Idle");
+			_framePipeline->WaitForWrittenFrame(_framePipeline->GetWrittenFrameCount() + 1, MESSAGE_WAIT_MILLISECONDS);
 		}
-
 	}
 	_isStoppedAllThreads.store(true);
 
+	// ҋ@̍XV, `XbhN
+	_framePipeline->Stop();
+
 	// SẴXbhɑ΂s҂
 	_engineThreadManager->ShutDown();
 
 }
 
+/****************************************************************************
+*                     ExecuteUpdateThread
+****************************************************************************/
+/* @fn        void PPPEngine::ExecuteUpdateThread()
+*
+*  @brief     XV[vł. t[N󂢂ĂXibvVbgobt@ɏ, `Xbh֓n܂. @n
+*             obt@Sĕ`҂̏ꍇ, `Xbh1t[ǂݏI܂ŃubN܂.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
 void PPPEngine::ExecuteUpdateThread()
 {
+	PROFILE_THREAD_NAME("Update Thread");
+	_mainThreadTimer->Reset();
+
+	gu::uint64 frameIndex = 0;
+	gu::uint32 bufferIndex = 0;
+
 	while (!_isStoppedAllThreads)
 	{
-		
+		{
+			PROFILE_SCOPE("Wait Snapshot Buffer");
+			if (!_framePipeline->BeginWrite(bufferIndex)) { break; }
+		}
+
+		PROFILE_FRAME("Update");
+		PROFILE_SCOPE("Update Frame");
+
+		// `Ɏgl͂̃t[̃XibvVbg֕
+		auto& snapshot = _frameSnapshots[bufferIndex];
+		snapshot.Render->Clear();
+		engine::RenderSnapshot::SetWriting(snapshot.Render.Get());
+
+		_mainThreadTimer->Tick();
+		if (!_isApplicationPaused)
+		{
+			_mainThreadTimer->AverageFrame(_mainWindow->GetWindowHandle());
+			PROFILE_COUNTER("Update Delta Time (ms)", _mainThreadTimer->DeltaTime() * 1000.0f);
+
+			{
+				PROFILE_SCOPE("GameInput::Update");
+				GameInput::Instance().Update();
+			}
+
+			{
+				PROFILE_SCOPE("GameManager::GameUpdateMain");
+				GameManager::Instance().GameUpdateMain();
+			}
+		}
+
+		engine::RenderSnapshot::SetWriting(nullptr);
+
+		// `Xbh֓nt[̏
+		snapshot.FrameIndex = frameIndex++;
+		snapshot.DeltaTime  = _mainThreadTimer->DeltaTime();
+		snapshot.TotalTime  = _mainThreadTimer->TotalTime();
+
+		_framePipeline->EndWrite();
 	}
 
 	_engineThreadManager->CallExecuteComplete(ThreadPoolType::UpdateMain);
@@ -161,7 +250,7 @@ void PPPEngine::ExecuteUpdateThread()
 ****************************************************************************/
 /* @fn        void PPPEngine::ExecuteRenderThread()
 *
-*  @brief     `惋[vł
+*  @brief     `惋[vł. XVXbh񂾃t[ԂɎ󂯎, `悵܂.
 *
 *  @param[in] void
 *
@@ -169,25 +258,56 @@ void PPPEngine::ExecuteUpdateThread()
 *****************************************************************************/
 void PPPEngine::ExecuteRenderThread()
 {
+	PROFILE_THREAD_NAME("Render Thread");
+
 	/*---------------------------------------------------------------
 					  `惋[v
 	-----------------------------------------------------------------*/
 	while (!_isStoppedAllThreads)
 	{
+		{
+			PROFILE_SCOPE("Wait Update Frame");
+			if (!_framePipeline->BeginRead(_renderSnapshotIndex)) { break; }
+		}
+
+		PROFILE_FRAME("Render");
+		PROFILE_SCOPE("Render Frame");
+
+		// XVXbhL^obt@݂̏𔽉f, ̃t[̕`̓XibvVbg̒lQƂ
+		const auto& renderSnapshot = _frameSnapshots[_renderSnapshotIndex].Render;
+		engine::RenderSnapshot::SetReading(renderSnapshot.Get());
+		{
+			PROFILE_SCOPE("RenderSnapshot::Apply");
+			renderSnapshot->Apply(*_graphicsEngine->GetUploadRing());
+		}
+
 		// Jn : R}hobt@Openɂ
 		_graphicsEngine->BeginDrawFrame();
 
 		// `惋[vOɃEBhETCYύXĂ炷Ƀobt@ςĂ.
-		_graphicsEngine->OnResize(Screen::GetScreenWidth(), Screen::GetScreenHeight());
+		{
+			PROFILE_SCOPE("LowLevelGraphicsEngine::OnResize");
+			_graphicsEngine->OnResize(Screen::GetScreenWidth(), Screen::GetScreenHeight());
+		}
 
 		// _[pX̐ݒ
-		_graphicsEngine->BeginSwapchainRenderPass();
+		{
+			PROFILE_SCOPE("LowLevelGraphicsEngine::BeginSwapchainRenderPass");
+			_graphicsEngine->BeginSwapchainRenderPass();
+		}
 		
 		// V[̕`
-		GameManager::Instance().GameDrawMain();
+		{
+			PROFILE_SCOPE("GameManager::GameDrawMain");
+			GameManager::Instance().GameDrawMain();
+		}
 
 		// I, `R}hs
 		_graphicsEngine->EndDrawFrame();
+
+		// XibvVbgobt@XVXbh֕Ԃ
+		engine::RenderSnapshot::SetReading(nullptr);
+		_framePipeline->EndRead();
 	}
 
 
@@ -199,6 +319,15 @@ void PPPEngine::ShutDown()
 {
 	if (_hasShutdown) { return; }
 
+	// CPUvt@Čʂo
+	if (StartUpParameter.ProfilerSettings.ChromeTraceFilePath != nullptr)
+	{
+		if (!gu::Profiler::ExportChromeTrace(StartUpParameter.ProfilerSettings.ChromeTraceFilePath))
+		{
+			printf("failed to export cpu profile : %s\n", StartUpParameter.ProfilerSettings.ChromeTraceFilePath);
+		}
+	}
+
 	// Xbh̔j
 	_engineThreadManager.Reset();
 
@@ -212,5 +341,13 @@ void PPPEngine::ShutDown()
 	_platformCommand.Reset();
 	_platformApplication.Reset();
 
+	// SĂ̔jIɎcĂmۂo
+	if (StartUpParameter.MemorySettings.StatisticsFilePath != nullptr)
+	{
+		if (!gu::Memory::DumpStatistics(StartUpParameter.MemorySettings.StatisticsFilePath))
+		{
+			printf("failed to dump memory statistics : %s\n", StartUpParameter.MemorySettings.StatisticsFilePath);
+		}
+	}
 }
 #pragma endregion Main Function
\ No newline at end of file
@@ -9,6 +9,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Audio/Private/Include/WavDecoder.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -157,8 +158,11 @@ bool WavDecoder::CreateWaveFormatEx(size_t formatChunk)
 *****************************************************************************/
 bool WavDecoder::CreateWaveData(size_t dataSize)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Audio);
+
+	// Allocate through gu::Memory so that the wave data is counted in the audio tag.
 	_waveDataSize = dataSize;
-	std::unique_ptr<BYTE[]> data = std::make_unique<BYTE[]>(dataSize);
+	ByteArrayPtr data(static_cast<BYTE*>(gu::Memory::Allocate(dataSize)), [](BYTE* pointer) { gu::Memory::Free(pointer); });
 
 	if (mmioRead(_handle, reinterpret_cast<HPSTR>(data.get()), (LONG)_waveDataSize) != static_cast<LONG>(_waveDataSize))
 	{
@@ -24,6 +24,10 @@ namespace rhi::core
 	class GPUBuffer;
 	class GPUResourceView;
 }
+namespace gm
+{
+	struct FrustumPlanes;
+}
 //////////////////////////////////////////////////////////////////////////////////
 //								Camera 
 //////////////////////////////////////////////////////////////////////////////////
@@ -178,6 +182,9 @@ namespace engine
 		gm::Float4x4  GetViewMatrix4x4f()       const;
 		gm::Float4x4  GetProjectionMatrix4x4f() const;
 
+		/* @brief : View * Projections񂩂王6ʂ擾܂ (JOp)*/
+		gm::FrustumPlanes GetFrustumPlanes() const;
+
 		/*-------------------------------------------------------------------
 		-               Set Frustum lens
 		---------------------------------------------------------------------*/
@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameObject.hpp"
+#include "GameCore/ECS/Include/ECSWorld.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -44,9 +45,22 @@ namespace engine
 		*****************************************************************************/
 		virtual void Update(const float deltaTime, const bool enableUpdateChild = false);
 
+		/* @brief : ECS̃GeBeBL܂. ɏLĂꍇ͔jĂu܂. 
+		            world͂̃AN^[蒷ĂKv܂*/
+		void AttachEntity(ecs::World* world, const ecs::Entity entity);
+
+		/* @brief : LĂGeBeBj܂*/
+		void DetachEntity();
+
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
+		/* @brief : LĂGeBeB (LĂȂꍇ͖ȃnh)*/
+		ecs::Entity GetEntity() const { return _entity; }
+
+		/* @brief : LĂGeBeB̃R|[lg. GeBeB, ܂̓R|[lgȂꍇnullptr*/
+		template<class T>
+		T* GetEntityComponent() const { return _world ? _world->GetComponent<T>(_entity) : nullptr; }
 
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -66,6 +80,11 @@ namespace engine
 		/****************************************************************************
 		**                Protected Property
 		*****************************************************************************/
+		/* @brief : LĂGeBeBWorld*/
+		ecs::World* _world = nullptr;
+
+		/* @brief : LĂGeBeB*/
+		ecs::Entity _entity = {};
 	};
 }
 #endif
\ No newline at end of file
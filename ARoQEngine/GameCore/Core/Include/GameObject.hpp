@@ -16,6 +16,7 @@
 #include "GameUtility/Base/Include/GUString.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameObjectRegistry.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -56,7 +57,7 @@ namespace engine
 		static gu::SharedPointer<T> Create(const LowLevelGraphicsEnginePtr& engine)
 		{
 			const auto gameObject = gu::MakeShared<T>(engine);
-			GameObjects.Push(gameObject);
+			Registry.Register(gameObject);
 			return gameObject;
 		}
 
@@ -69,20 +70,32 @@ namespace engine
 		/* @brief : This function returns the gameobject list with the same tag as the assign tag.*/
 		static gu::DynamicArray<GameObjectPtr> GameObjectsWithTag(const gu::tstring& tag);
 
+		/* @brief : Obtain the gameObject the handle refers to. (nullptr if it has been destroyed)*/
+		static GameObjectPtr Resolve(const GameObjectHandle handle);
+
 		/*-------------------------------------------------------------------
 		-               Destroy and Clear
 		---------------------------------------------------------------------*/
-		/* @brief : This function destroy the game object with the same assigned object*/
+		/* @brief : This function destroy the game object with the same assigned object (released at the end of the frame)*/
 		static bool Destroy(GameObjectPtr& gameObject);
 
+		/* @brief : This function destroy the game object the handle refers to (released at the end of the frame)*/
+		static bool Destroy(const GameObjectHandle handle);
+
 		/* @brief : Destroy objects including parent and children object*/
 		static void DestroyWithChildren(GameObjectPtr& parent);
 
 		/* @brief : destroy all objects have the tag*/
 		static void DestroyAllTagObjects(const gu::tstring& tag);
 
+		/* @brief : Release the game objects destroyed in this frame. Call at the end of the frame*/
+		static void FlushDestroyedGameObjects();
+
 		/* @brief : Clear all game objects*/
 		static void ClearAllGameObjects();
+
+		/* @brief : Return the number of registered game objects*/
+		static gu::uint64 GetGameObjectCount() { return Registry.GetGameObjectCount(); }
 		
 		/****************************************************************************
 		**                Public Function
@@ -103,27 +116,21 @@ namespace engine
 
 		inline const gm::Transform&  GetTransform() const { return _transform; }
 
-		inline       gm::Vector3f&    GetPosition()       { return _transform.LocalPosition; }
-
-		inline const gm::Vector3f&    GetPosition() const { return _transform.LocalPosition; }
+		inline const gm::Vector3f&    GetPosition() const { return _transform.GetLocalPosition(); }
 
-		inline       gm::QuaternionF& GetRotation()       { return _transform.LocalRotation; }
+		inline const gm::QuaternionF& GetRotation() const { return _transform.GetLocalRotation(); }
 
-		inline const gm::QuaternionF& GetRotation() const { return _transform.LocalRotation; }
+		inline const gm::Vector3f&    GetScale() const    { return _transform.GetLocalScale(); }
 
-		inline       gm::Vector3f&    GetScale()          { return _transform.LocalScale; }
+		inline void SetPosition(float x, float y, float z)   { _transform.SetLocalPosition(gm::Vector3f(x, y, z)); }
 
-		inline const gm::Vector3f&    GetScale() const    { return _transform.LocalScale; }
+		inline void SetPosition(const gm::Vector3f& position) { _transform.SetLocalPosition(position); }
 
-		inline void SetPosition(float x, float y, float z)   { _transform.LocalPosition = gm::Vector3f(x, y, z); }
+		inline void SetScale(float x, float y, float z) { _transform.SetLocalScale(gm::Vector3f(x, y, z)); }
 
-		inline void SetPosition(const gm::Vector3f& position) { _transform.LocalPosition = position; }
+		inline void SetScale(const gm::Vector3f& scale) { _transform.SetLocalScale(scale); }
 
-		inline void SetScale(float x, float y, float z) { _transform.LocalScale = gm::Vector3f(x, y, z); }
-
-		inline void SetScale(const gm::Vector3f& scale) { _transform.LocalScale = scale; }
-
-		inline void SetRotation(const gm::QuaternionF& rotation) { _transform.LocalRotation = rotation; }
+		inline void SetRotation(const gm::QuaternionF& rotation) { _transform.SetLocalRotation(rotation); }
 		
 		/*-------------------------------------------------------------------
 		-               GameObject Default Infomation
@@ -136,9 +143,11 @@ namespace engine
 
 		inline ObjectType GetType() const { return _type; }
 
-		inline void SetName(const gu::tstring& name) { _name = name; }
+		inline GameObjectHandle GetHandle() const { return _handle; }
+
+		void SetName(const gu::tstring& name);
 
-		inline void SetTag(const gu::tstring& name) { _tag = name; }
+		void SetTag(const gu::tstring& name);
 
 		inline void SetLayer(const gu::tstring& name) { int bit = GetLayerBit(name); if (bit >= 0) { _layer = (1 << bit); } }
 
@@ -181,6 +190,8 @@ namespace engine
 
 		ObjectType _type = ObjectType::Static;
 
+		GameObjectHandle _handle = {}; // registry handle (invalid until created by Create)
+
 		/*-------------------------------------------------------------------
 		-           gameObject state
 		---------------------------------------------------------------------*/
@@ -201,6 +212,8 @@ namespace engine
 		gu::DynamicArray<GameObjectPtr> _children = {};
 		
 	private:
+		friend class GameObjectRegistry;
+
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
@@ -209,7 +222,7 @@ namespace engine
 		/****************************************************************************
 		**                Private Property
 		*****************************************************************************/
-		static gu::DynamicArray<GameObjectPtr> GameObjects;
+		static GameObjectRegistry Registry;
 		static gu::DynamicArray<gu::tstring>  LayerList;
 	};
 }
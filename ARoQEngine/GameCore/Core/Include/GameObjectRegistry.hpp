@@ -0,0 +1,234 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GameObjectRegistry.hpp
+///  @brief  ꂽGameObjectێ, Oƃ^ÕnbVCfbNXŌ܂. @n
+///          GameObject(CfbNX, )64bit̃nhŎQƂ, jɓCfbNXėpĂÂnh͖ƂĈ܂. @n
+///          j̓t[̏Iɂ܂Ƃ߂čs, XVɎg⑼̃IuWFNgjĂ̂Ȃ悤ɂ܂.
+///  @author toide
+///  @date   2026/10/20 5:02:17
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GAME_OBJECT_REGISTRY_HPP
+#define GAME_OBJECT_REGISTRY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	class GameObject;
+}
+
+namespace engine::details::registry
+{
+	/*! @brief gpĂȂXbgCfbNX\l*/
+	constexpr gu::uint32 INVALID_INDEX = 0xFFFFFFFF;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	/****************************************************************************
+	*				  			   GameObjectHandle
+	****************************************************************************/
+	/* @brief  GameObject̃nhł. WXg̃Xbgԍ, ̃Xbggpێ܂. @n
+	*          0gpȂ, l̃nh͏ɖɂȂ܂.
+	*****************************************************************************/
+	struct GameObjectHandle
+	{
+		/*! @brief WXg̃Xbgԍ*/
+		gu::uint32 Index = 0;
+
+		/*! @brief Xbgėpꂽ (0͖)*/
+		gu::uint32 Generation = 0;
+
+		/*! @brief LȒlݒ肳Ă邩 (IuWFNgĂ邩GameObject::ResolveŊmFĂ)*/
+		__forceinline bool IsValid() const { return Generation != 0; }
+
+		/*! @brief 64bit̒lƂĎ擾܂*/
+		__forceinline gu::uint64 ToUInt64() const { return (static_cast<gu::uint64>(Generation) << 32) | Index; }
+
+		__forceinline bool operator==(const GameObjectHandle& right) const { return Index == right.Index && Generation == right.Generation; }
+		__forceinline bool operator!=(const GameObjectHandle& right) const { return !(*this == right); }
+	};
+
+	static_assert(sizeof(GameObjectHandle) == 8, "GameObjectHandle must be 64 bits");
+
+	/****************************************************************************
+	*				  			   GameObjectRegistry
+	****************************************************************************/
+	/* @brief  GameObject̏Lo^\ł. @n
+	*          IuWFNg͖ȔzɊi[, 폜͖̗vfŖ߂܂ (swap-and-pop). @n
+	*          Oƃ^O͂ꂼnbVlXbgԍ̔zւ̃CfbNX, eXbg͔z̈ʒuoĂ邽ߒǉ, 폜O(1)ł. @n
+	*          nbVlՓ˂ꍇɔ, ͕r܂. @n
+	*          XbhZ[tł͂܂. Q[̍XVXbĥݎgpĂ.
+	*****************************************************************************/
+	class GameObjectRegistry : public gu::NonCopyable
+	{
+	public:
+		using GameObjectPtr = gu::SharedPointer<GameObject>;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     GameObjecto^, nh蓖Ă܂. ݂̖Oƃ^OŃCfbNXɒǉ܂.
+		*  @param[in] const GameObjectPtr& o^IuWFNg (o^ł邱)
+		*  @return    GameObjectHandle 蓖Ănh
+		*************************************************************************/
+		GameObjectHandle Register(const GameObjectPtr& gameObject);
+
+		/*!**********************************************************************
+		*  @brief     nhwIuWFNgԂ܂. jς, ܂͔j\ς݂̏ꍇnullptrԂ܂.
+		*  @param[in] const GameObjectHandle nh
+		*  @return    GameObjectPtr IuWFNg
+		*************************************************************************/
+		GameObjectPtr Resolve(const GameObjectHandle handle) const;
+
+		/*!**********************************************************************
+		*  @brief     OvIuWFNg1Ԃ܂.
+		*  @param[in] const gu::tstring& O
+		*  @return    GameObjectPtr Ȃꍇnullptr
+		*************************************************************************/
+		GameObjectPtr FindByName(const gu::tstring& name) const;
+
+		/*!**********************************************************************
+		*  @brief     ^OvIuWFNgSĒǉ܂. ^O̗vfɔႵԂŏI܂.
+		*  @param[in]  const gu::tstring& ^O
+		*  @param[out] gu::DynamicArray<GameObjectPtr>& IuWFNg̒ǉ
+		*  @return    void
+		*************************************************************************/
+		void FindByTag(const gu::tstring& tag, gu::DynamicArray<GameObjectPtr>& result) const;
+
+		/*!**********************************************************************
+		*  @brief     IuWFNg̔j\񂵂܂. \񂵂_Ō̑ΏۂO, FlushDestroyedŎۂɉ܂.
+		*  @param[in] const GameObjectHandle nh
+		*  @return    bool ĂIuWFNg\񂵂ꍇtrue
+		*************************************************************************/
+		bool Destroy(const GameObjectHandle handle);
+
+		/*!**********************************************************************
+		*  @brief     ^OvIuWFNgSĔj\񂵂܂.
+		*  @param[in] const gu::tstring& ^O
+		*  @return    gu::uint64 \񂵂IuWFNg̐
+		*************************************************************************/
+		gu::uint64 DestroyByTag(const gu::tstring& tag);
+
+		/*!**********************************************************************
+		*  @brief     j\񂳂ꂽIuWFNg܂Ƃ߂ĉ, Xbgėp\ɂ܂. t[̏IɌĂяoĂ.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void FlushDestroyed();
+
+		/*!**********************************************************************
+		*  @brief     O̕ύXCfbNX֔f܂. GameObject::SetNameĂяo܂.
+		*  @param[in] const GameObjectHandle nh
+		*  @param[in] const gu::tstring& ύX̖O
+		*  @return    void
+		*************************************************************************/
+		void Rename(const GameObjectHandle handle, const gu::tstring& name);
+
+		/*!**********************************************************************
+		*  @brief     ^O̕ύXCfbNX֔f܂. GameObject::SetTagĂяo܂.
+		*  @param[in] const GameObjectHandle nh
+		*  @param[in] const gu::tstring& ύX̃^O
+		*  @return    void
+		*************************************************************************/
+		void Retag(const GameObjectHandle handle, const gu::tstring& tag);
+
+		/*!**********************************************************************
+		*  @brief     SẴIuWFNg𑦍ɉ܂. sς݂̃nh͑SĖɂȂ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief o^ĂIuWFNg̐ (j\ς݂܂)*/
+		__forceinline gu::uint64 GetGameObjectCount() const { return _gameObjects.Size(); }
+
+		/*! @brief j\񂳂ĂIuWFNg̐*/
+		__forceinline gu::uint64 GetPendingDestroyCount() const { return _pendingDestroys.Size(); }
+
+		/*! @brief nhĂ (j\ĂȂ) IuWFNgwĂ邩*/
+		__forceinline bool IsAlive(const GameObjectHandle handle) const
+		{
+			if (handle.Index >= _slots.Size()) { return false; }
+			const Slot& slot = _slots[handle.Index];
+			return slot.Generation == handle.Generation && slot.DenseIndex != details::registry::INVALID_INDEX && !slot.IsPendingDestroy;
+		}
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		GameObjectRegistry() = default;
+
+		~GameObjectRegistry();
+		#pragma endregion
+
+	protected:
+		/*! @brief ̃nbVl, ̕Xbgԍ̔zւ̃CfbNX*/
+		using Index = std::unordered_map<gu::uint64, gu::DynamicArray<gu::uint32>>;
+
+		/****************************************************************************
+		*				  			   Slot
+		****************************************************************************/
+		/* @brief  nh̃CfbNXƂ̏Ԃł.
+		*****************************************************************************/
+		struct Slot
+		{
+			/*! @brief Ȕz̈ʒu (gp̏ꍇINVALID_INDEX)*/
+			gu::uint32 DenseIndex = details::registry::INVALID_INDEX;
+
+			/*! @brief ݂̐*/
+			gu::uint32 Generation = 1;
+
+			/*! @brief O, ^ÕCfbNẌʒu*/
+			gu::uint32 NamePosition = details::registry::INVALID_INDEX;
+			gu::uint32 TagPosition  = details::registry::INVALID_INDEX;
+
+			/*! @brief o^̖O, ^ÕnbVl*/
+			gu::uint64 NameHash = 0;
+			gu::uint64 TagHash  = 0;
+
+			/*! @brief j\ς݂*/
+			bool IsPendingDestroy = false;
+		};
+
+		#pragma region Protected Function
+		/*! @brief CfbNXɃXbgǉ, z̈ʒuԂ܂*/
+		gu::uint32 AddToIndex(Index& index, const gu::uint64 hash, const gu::uint32 slotIndex);
+
+		/*! @brief CfbNXXbg菜, ̗vfŖ߂܂*/
+		void RemoveFromIndex(Index& index, const gu::uint64 hash, const gu::uint32 position, gu::uint32 Slot::* positionMember);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief o^ĂIuWFNg̖Ȕz, evf̃Xbgԍ*/
+		gu::DynamicArray<GameObjectPtr> _gameObjects = {};
+		gu::DynamicArray<gu::uint32>    _denseToSlot = {};
+
+		/*! @brief nh̃CfbNXƂ̏Ԃ, ėpłXbgԍ*/
+		gu::DynamicArray<Slot>       _slots       = {};
+		gu::DynamicArray<gu::uint32> _freeSlots   = {};
+
+		/*! @brief j\񂳂ꂽXbgԍ*/
+		gu::DynamicArray<gu::uint32> _pendingDestroys = {};
+
+		/*! @brief O, ^ÕnbVCfbNX*/
+		Index _nameIndex = {};
+		Index _tagIndex  = {};
+		#pragma endregion
+	};
+}
+
+#endif
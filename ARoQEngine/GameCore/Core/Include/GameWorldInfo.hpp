@@ -44,7 +44,7 @@ namespace engine
 	****************************************************************************/
 	/* @class     GameWorldInfo
 	*  @brief     GameWorld constant buffer (This class can be used for both individual drawings and instancing drawings. )
-	*             When you would like to change the contents in the buffer, you should use GetBuffer function.
+	*             The buffer lives in the default heap. When you would like to change the contents in the buffer, you should use Upload function.
 	*****************************************************************************/
 	class GameWorldInfo : public gu::NonCopyable
 	{
@@ -60,6 +60,10 @@ namespace engine
 		/* @brief : Bind constant buffer view. index : root descriptor table id.*/
 		void Bind(const GraphicsCommandListPtr& commandList, const std::uint32_t index);
 
+		/* @brief : Write the game world constant through the engine upload ring.
+		            The copy to the constant buffer is recorded at the beginning of the next draw frame.*/
+		void Upload(const GameWorldConstant& constant, const std::uint64_t instanceIndex = 0);
+
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderSnapshot.hpp
+///  @brief  XVXbh1t[̕` (Transform, Cg, J) 𕡐, `Xbh̒lQƂ邽߂̃obt@ł.
+///  @author toide
+///  @date   2026/10/22 10:14:36
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RENDER_SNAPSHOT_HPP
+#define RENDER_SNAPSHOT_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Container/Include/GUHashMap.hpp"
+#include "GameUtility/Math/Include/GMMatrix.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	class GPUBuffer;
+	class GPUUploadRing;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	/****************************************************************************
+	*				  			TransformSnapshot
+	****************************************************************************/
+	/* @brief  `摤ŎQƂIuWFNg̃[hsƈʒuł.
+	*****************************************************************************/
+	struct TransformSnapshot
+	{
+		/*! @brief [hs (Scale * Rotation * Translation)*/
+		gm::Float4x4 World = {};
+
+		/*! @brief ʒu*/
+		gm::Vector3f Position = {};
+	};
+
+	/****************************************************************************
+	*				  			CameraSnapshot
+	****************************************************************************/
+	/* @brief  `摤ŎQƂJ̏Ԃł.
+	*****************************************************************************/
+	struct CameraSnapshot
+	{
+		/*! @brief r[s*/
+		gm::Float4x4 View = {};
+
+		/*! @brief vWFNVs*/
+		gm::Float4x4 Projection = {};
+
+		/*! @brief J̈ʒu*/
+		gm::Vector3f Position = {};
+
+		/*! @brief ܂ꂽ*/
+		bool IsValid = false;
+	};
+
+	/****************************************************************************
+	*				  			RenderSnapshot
+	****************************************************************************/
+	/* @brief  XVXbh1t[̕`Ԃ, `Xbhǂݍރobt@ł. @n
+	*          XVXbhŌĂ΂ꂽUploadBufferGPU֏܂ɒl𕡐ĕێ, `XbhApplyŃAbv[hO֏݂܂. @n
+	*          ̂ߍXVXbht[N+1łԂ, `Xbh̓t[N̒lQƂ܂. @n
+	*          ݒƓǂݍݒ̃XibvVbg̓XbhƂɐݒ肵܂ (PPPEnginet[Ƃɐݒ肵܂).
+	*****************************************************************************/
+	class RenderSnapshot : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     L^eSĔj܂. mۂ͎̃t[ōėp܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     `摤ŎQƂIuWFNg̃[hsƈʒuL^܂.
+		*  @param[in] const void* IuWFNg (L[ƂĂ̂ݎgp܂)
+		*  @param[in] const TransformSnapshot& [hsƈʒu
+		*  @return    void
+		*************************************************************************/
+		void SetTransform(const void* object, const TransformSnapshot& transform);
+
+		/*!**********************************************************************
+		*  @brief     L^[hsƈʒuԂ܂.
+		*  @param[in] const void* IuWFNg
+		*  @return    const TransformSnapshot* L^ĂȂꍇnullptr
+		*************************************************************************/
+		const TransformSnapshot* FindTransform(const void* object) const;
+
+		/*!**********************************************************************
+		*  @brief     GPUobt@ւ݂̏L^܂. f[^͂̎_ŕ܂.
+		*  @param[in] const gu::SharedPointer<rhi::core::GPUBuffer>& ݐ̃obt@
+		*  @param[in] const void* ރf[^
+		*  @param[in] const gu::uint64 oCgTCY
+		*  @param[in] const gu::uint64 ݐ̃ItZbg [byte]
+		*  @return    void
+		*************************************************************************/
+		void Upload(const gu::SharedPointer<rhi::core::GPUBuffer>& destination, const void* data, const gu::uint64 byteSize, const gu::uint64 destinationOffset = 0);
+
+		/*!**********************************************************************
+		*  @brief     L^݂L^ɃAbv[hO֓n܂. `Xbh, t[̕`n߂OɌĂяoĂ.
+		*  @param[in] rhi::core::GPUUploadRing& Abv[hO
+		*  @return    void
+		*************************************************************************/
+		void Apply(rhi::core::GPUUploadRing& uploadRing) const;
+
+		/*!**********************************************************************
+		*  @brief     ĂяoXbhXibvVbgݒłΏ݂L^, łȂ΂̏ŃAbv[hO֓n܂. @n
+		*             Ȃǃt[̊OŌĂ΂ꂽꍇ, ܂Œʂ莟̕`t[ŃRs[܂.
+		*  @param[in] rhi::core::GPUUploadRing& Abv[hO
+		*  @param[in] const gu::SharedPointer<rhi::core::GPUBuffer>& ݐ̃obt@
+		*  @param[in] const void* ރf[^
+		*  @param[in] const gu::uint64 oCgTCY
+		*  @param[in] const gu::uint64 ݐ̃ItZbg [byte]
+		*  @return    void
+		*************************************************************************/
+		static void UploadBuffer(rhi::core::GPUUploadRing& uploadRing, const gu::SharedPointer<rhi::core::GPUBuffer>& destination, const void* data, const gu::uint64 byteSize, const gu::uint64 destinationOffset = 0);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief `摤ŎQƂJ̏Ԃݒ肵܂*/
+		__forceinline void SetCamera(const CameraSnapshot& camera) noexcept { _camera = camera; _camera.IsValid = true; }
+
+		/*! @brief `摤ŎQƂJ̏. IsValidfalsȅꍇ͏܂Ă܂*/
+		__forceinline const CameraSnapshot& GetCamera() const noexcept { return _camera; }
+
+		/*! @brief L^݂̐*/
+		__forceinline gu::uint64 GetUploadCount() const noexcept { return _uploads.Size(); }
+
+		/*! @brief L^[hs̐*/
+		__forceinline gu::uint64 GetTransformCount() const noexcept { return _transforms.Size(); }
+
+		/*! @brief ĂяoXbhݒ̃XibvVbg. ꍇnullptr*/
+		static RenderSnapshot* GetWriting() noexcept;
+
+		/*! @brief ĂяoXbhރXibvVbgݒ肵܂. ݂Inullptrݒ肵Ă*/
+		static void SetWriting(RenderSnapshot* snapshot) noexcept;
+
+		/*! @brief ĂяoXbh`撆̃XibvVbg. ꍇnullptr*/
+		static const RenderSnapshot* GetReading() noexcept;
+
+		/*! @brief ĂяoXbh`悷XibvVbgݒ肵܂. `Inullptrݒ肵Ă*/
+		static void SetReading(const RenderSnapshot* snapshot) noexcept;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RenderSnapshot() = default;
+
+		/*! @brief fXgN^*/
+		~RenderSnapshot() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief L^GPUobt@ւ̏*/
+		struct UploadRecord
+		{
+			gu::SharedPointer<rhi::core::GPUBuffer> Destination = nullptr;
+			gu::uint64 DestinationOffset = 0;
+			gu::uint64 DataOffset        = 0;
+			gu::uint64 ByteSize          = 0;
+		};
+
+		/*! @brief IuWFNgƂ̃[hsƈʒu*/
+		gu::HashMap<const void*, TransformSnapshot> _transforms = {};
+
+		/*! @brief J̏*/
+		CameraSnapshot _camera = {};
+
+		/*! @brief L^GPUobt@ւ̏ (L^)*/
+		gu::DynamicArray<UploadRecord> _uploads = {};
+
+		/*! @brief ރf[^̕*/
+		gu::DynamicArray<gu::uint8> _uploadData = {};
+		#pragma endregion
+	};
+}
+#endif
@@ -15,6 +15,8 @@
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GameUtility/Math/Include/GMMathConstants.hpp"
+#include "GameUtility/Math/Include/GMCulling.hpp"
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -603,6 +605,11 @@ Float4x4 Camera::GetProjectionMatrix4x4f() const
 {
 	return _proj;
 }
+
+FrustumPlanes Camera::GetFrustumPlanes() const
+{
+	return FrustumPlanes::FromViewProjection((GetViewMatrix() * GetProjectionMatrix()).ToFloat4x4());
+}
 #pragma endregion Property
 
 #pragma region Protected Function
@@ -638,6 +645,11 @@ void Camera::UpdateSceneConstants(const GameTimerPtr& gameTimer)
 	scene.TotalTime               = gameTimer->TotalTime();
 	scene.DeltaTime               = gameTimer->DeltaTime();
 
-	_sceneConstantBuffer->UploadByte(&scene, _sceneConstantBuffer->GetTotalByteSize(), 0, nullptr); 
+	// XVXbhĂ΂ꂽꍇ, `Xbh̃t[`悷钼Oɏ
+	RenderSnapshot::UploadBuffer(*_engine->GetUploadRing(), _sceneConstantBuffer, &scene, sizeof(SceneConstants), 0);
+	if (const auto snapshot = RenderSnapshot::GetWriting())
+	{
+		snapshot->SetCamera({ .View = scene.View, .Projection = scene.Projection, .Position = GetPosition() });
+	}
 }
 #pragma endregion Protected Function
\ No newline at end of file
@@ -26,7 +26,7 @@ GameActor::GameActor(const LowLevelGraphicsEnginePtr& engine) : GameObject(engin
 }
 GameActor::~GameActor()
 {
-	
+	DetachEntity();
 }
 #pragma endregion Constructor and Destructor
 #pragma region Main Function
@@ -48,6 +48,46 @@ void GameActor::Update(const float deltaTime, const bool enableUpdateChild)
 	if (enableUpdateChild) { UpdateChild(deltaTime); }
 }
 
+
+/****************************************************************************
+*                       AttachEntity
+****************************************************************************/
+/* @fn        void GameActor::AttachEntity(ecs::World* world, const ecs::Entity entity)
+*
+*  @brief     ECS̃GeBeBL܂. AN^[̔jɃGeBeBj܂.
+*
+*  @param[in] ecs::World* GeBeBWorld
+*  @param[in] const ecs::Entity entity
+*
+*  @return    void
+*****************************************************************************/
+void GameActor::AttachEntity(ecs::World* world, const ecs::Entity entity)
+{
+	if (_world == world && _entity == entity) { return; }
+
+	DetachEntity();
+	_world  = world;
+	_entity = entity;
+}
+
+/****************************************************************************
+*                       DetachEntity
+****************************************************************************/
+/* @fn        void GameActor::DetachEntity()
+*
+*  @brief     LĂGeBeBj܂.
+*
+*  @param[in] void
+*
+*  @return    void
+*****************************************************************************/
+void GameActor::DetachEntity()
+{
+	if (_world != nullptr) { _world->DestroyEntity(_entity); }
+
+	_world  = nullptr;
+	_entity = {};
+}
 #pragma endregion Main Function
 
 /****************************************************************************
@@ -23,7 +23,7 @@ static constexpr int INVALID_VALUE = -1;
 //////////////////////////////////////////////////////////////////////////////////
 namespace engine
 {
-	gu::DynamicArray<GameObject::GameObjectPtr> GameObject::GameObjects = {};
+	GameObjectRegistry GameObject::Registry = {};
 	gu::DynamicArray<gu::tstring> GameObject::LayerList = {};
 }
 
@@ -45,6 +45,42 @@ GameObject::~GameObject()
 
 #pragma endregion Constructor and Destructor
 
+#pragma region Property
+/****************************************************************************
+*                          SetName
+****************************************************************************/
+/* @fn        void GameObject::SetName(const gu::tstring& name)
+*
+*  @brief     Set the object name and update the name index of the registry.
+*
+*  @param[in] const gu::tstring& name
+*
+*  @return @@void
+*****************************************************************************/
+void GameObject::SetName(const gu::tstring& name)
+{
+	Registry.Rename(_handle, name);
+	_name = name;
+}
+
+/****************************************************************************
+*                          SetTag
+****************************************************************************/
+/* @fn        void GameObject::SetTag(const gu::tstring& tag)
+*
+*  @brief     Set the object tag and update the tag index of the registry.
+*
+*  @param[in] const gu::tstring& tag
+*
+*  @return @@void
+*****************************************************************************/
+void GameObject::SetTag(const gu::tstring& tag)
+{
+	Registry.Retag(_handle, tag);
+	_tag = tag;
+}
+#pragma endregion Property
+
 #pragma region Find Function 
 /****************************************************************************
 *                          Find
@@ -59,14 +95,7 @@ GameObject::~GameObject()
 *****************************************************************************/
 GameObject::GameObjectPtr GameObject::Find(const gu::tstring& name)
 {
-	for (auto it = GameObjects.begin(); it != GameObjects.end(); ++it)
-	{
-		if ((*it)->_name == name)
-		{
-			return (*it);
-		}
-	}
-	return nullptr; // Failed to find
+	return Registry.FindByName(name); // nullptr : Failed to find
 }
 
 /****************************************************************************
@@ -84,17 +113,27 @@ gu::DynamicArray<GameObject::GameObjectPtr> GameObject::GameObjectsWithTag(const
 {
 	gu::DynamicArray<GameObjectPtr> gameObjects = {};
 
-	for (auto it = GameObjects.begin(); it != GameObjects.end(); ++it)
-	{
-		if ((*it)->GetTag() == tag)
-		{
-			gameObjects.Push((*it));
-		}
-	}
+	Registry.FindByTag(tag, gameObjects);
 
 	return gameObjects; // Return Value Optimization (C++17)
 }
 
+/****************************************************************************
+*                          Resolve
+****************************************************************************/
+/* @fn        GameObject::GameObjectPtr GameObject::Resolve(const GameObjectHandle handle)
+*
+*  @brief     This function returns the gameObject the handle refers to.
+*
+*  @param[in] const GameObjectHandle handle
+*
+*  @return @@GameObjectPtr (nullptr if the gameObject has been destroyed)
+*****************************************************************************/
+GameObject::GameObjectPtr GameObject::Resolve(const GameObjectHandle handle)
+{
+	return Registry.Resolve(handle);
+}
+
 #pragma endregion Find Function
 
 #pragma region Destroy
@@ -103,7 +142,8 @@ gu::DynamicArray<GameObject::GameObjectPtr> GameObject::GameObjectsWithTag(const
 ****************************************************************************/
 /* @fn        GameObject* GameObject::Destroy(GameObject* gameObject)
 * 
-*  @brief     (Safe delete ) This function destroy the game object with the same assigned object
+*  @brief     (Safe delete ) This function destroy the game object with the same assigned object. 
+*             The object is no longer found by Find / Resolve, and is released in FlushDestroyedGameObjects.
 * 
 *  @param[in,out] GameObjectPtr& gameObject -> set nullptr
 * 
@@ -113,13 +153,28 @@ bool GameObject::Destroy(GameObjectPtr& gameObject)
 {
 	if (!gameObject) { return false; }
 
-	const auto foundCount = GameObjects.RemoveAll(gameObject);
-	if (foundCount == 0) { return false; }
+	if (!Registry.Destroy(gameObject->_handle)) { return false; }
 	gameObject.Reset();
 
 	return true;
 }
 
+/****************************************************************************
+*                          Destroy
+****************************************************************************/
+/* @fn        bool GameObject::Destroy(const GameObjectHandle handle)
+*
+*  @brief     This function destroy the game object the handle refers to. (released in FlushDestroyedGameObjects)
+*
+*  @param[in] const GameObjectHandle handle
+*
+*  @return @@bool (true: success destroy, false: the handle is already destroyed)
+*****************************************************************************/
+bool GameObject::Destroy(const GameObjectHandle handle)
+{
+	return Registry.Destroy(handle);
+}
+
 /****************************************************************************
 *                          DestroyAllTagObject
 ****************************************************************************/
@@ -133,21 +188,7 @@ bool GameObject::Destroy(GameObjectPtr& gameObject)
 *****************************************************************************/
 void GameObject::DestroyAllTagObjects(const gu::tstring& tag)
 {
-	gu::uint64 findCount = 0;
-
-	for (gu::uint64 i = 0; i < GameObjects.Size(); ++i)
-	{
-		if (GameObjects[i]->GetTag() == tag)
-		{
-			GameObjects.RemoveAt(i, 1, false);
-			findCount++;
-		}
-	}
-
-	/*GameObjects.RemoveIf([&](const GameObjectPtr& gameObject) 
-	{
-		return gameObject->GetTag() == tag; 
-	});*/
+	Registry.DestroyByTag(tag);
 }
 
 /****************************************************************************
@@ -231,8 +272,23 @@ void GameObject::ClearChildren()
 *****************************************************************************/
 void GameObject::ClearAllGameObjects()
 {
-	GameObjects.Clear();
-	GameObjects.ShrinkToFit();
+	Registry.Clear();
+}
+
+/****************************************************************************
+*                          FlushDestroyedGameObjects
+****************************************************************************/
+/* @fn        void GameObject::FlushDestroyedGameObjects()
+*
+*  @brief     Release the game objects destroyed in this frame and recycle their handles.
+*
+*  @param[in] void
+*
+*  @return @@void
+*****************************************************************************/
+void GameObject::FlushDestroyedGameObjects()
+{
+	Registry.FlushDestroyed();
 }
 
 #pragma endregion Destroy Function
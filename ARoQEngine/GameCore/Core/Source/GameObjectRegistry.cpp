@@ -0,0 +1,335 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GameObjectRegistry.cpp
+///  @brief  ꂽGameObjectێ, Oƃ^ÕnbVCfbNXŌ܂.
+///  @author toide
+///  @date   2026/10/20 5:02:17
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GameObjectRegistry.hpp"
+#include "../Include/GameObject.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine;
+using namespace engine::details::registry;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			i߂܂. 0͖ȃnhɎgp邽ߔ΂܂
+	-----------------------------------------------------------------*/
+	uint32 NextGeneration(const uint32 generation)
+	{
+		return generation == UINT32_MAX ? 1 : generation + 1;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Constructor and Destructor
+GameObjectRegistry::~GameObjectRegistry()
+{
+	Clear();
+}
+#pragma endregion Public Constructor and Destructor
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     GameObjecto^, nh蓖Ă܂. ݂̖Oƃ^OŃCfbNXɒǉ܂.
+*  @param[in] const GameObjectPtr& o^IuWFNg (o^ł邱)
+*  @return    GameObjectHandle 蓖Ănh
+*************************************************************************/
+GameObjectHandle GameObjectRegistry::Register(const GameObjectPtr& gameObject)
+{
+	Check(gameObject);
+	Check(!IsAlive(gameObject->_handle));
+
+	/*-------------------------------------------------------------------
+	-      󂢂ĂXbgėp, Ζɒǉ܂
+	---------------------------------------------------------------------*/
+	uint32 slotIndex = 0;
+	if (_freeSlots.IsEmpty())
+	{
+		slotIndex = static_cast<uint32>(_slots.Size());
+		_slots.Push(Slot());
+	}
+	else
+	{
+		slotIndex = _freeSlots.Back();
+		_freeSlots.Pop();
+	}
+
+	Slot& slot = _slots[slotIndex];
+	slot.DenseIndex = static_cast<uint32>(_gameObjects.Size());
+	_gameObjects.Push(gameObject);
+	_denseToSlot.Push(slotIndex);
+
+	/*-------------------------------------------------------------------
+	-      Oƃ^ÕCfbNX֒ǉ܂
+	---------------------------------------------------------------------*/
+	slot.NameHash     = gameObject->_name.GetTypedHash();
+	slot.TagHash      = gameObject->_tag.GetTypedHash();
+	slot.NamePosition = AddToIndex(_nameIndex, slot.NameHash, slotIndex);
+	slot.TagPosition  = AddToIndex(_tagIndex , slot.TagHash , slotIndex);
+
+	const GameObjectHandle handle = { slotIndex, slot.Generation };
+	gameObject->_handle = handle;
+	return handle;
+}
+
+/*!**********************************************************************
+*  @brief     nhwIuWFNgԂ܂. jς, ܂͔j\ς݂̏ꍇnullptrԂ܂.
+*  @param[in] const GameObjectHandle nh
+*  @return    GameObjectPtr IuWFNg
+*************************************************************************/
+GameObjectRegistry::GameObjectPtr GameObjectRegistry::Resolve(const GameObjectHandle handle) const
+{
+	if (!IsAlive(handle)) { return nullptr; }
+	return _gameObjects[_slots[handle.Index].DenseIndex];
+}
+
+/*!**********************************************************************
+*  @brief     OvIuWFNg1Ԃ܂.
+*  @param[in] const gu::tstring& O
+*  @return    GameObjectPtr Ȃꍇnullptr
+*************************************************************************/
+GameObjectRegistry::GameObjectPtr GameObjectRegistry::FindByName(const tstring& name) const
+{
+	const uint64 hash  = name.GetTypedHash();
+	const auto   found = _nameIndex.find(hash);
+	if (found == _nameIndex.end()) { return nullptr; }
+
+	const auto& slotIndices = found->second;
+	for (uint64 i = 0; i < slotIndices.Size(); ++i)
+	{
+		const auto& gameObject = _gameObjects[_slots[slotIndices[i]].DenseIndex];
+		if (gameObject->_name == name) { return gameObject; }
+	}
+	return nullptr;
+}
+
+/*!**********************************************************************
+*  @brief     ^OvIuWFNgSĒǉ܂. ^O̗vfɔႵԂŏI܂.
+*  @param[in]  const gu::tstring& ^O
+*  @param[out] gu::DynamicArray<GameObjectPtr>& IuWFNg̒ǉ
+*  @return    void
+*************************************************************************/
+void GameObjectRegistry::FindByTag(const tstring& tag, DynamicArray<GameObjectPtr>& result) const
+{
+	const uint64 hash  = tag.GetTypedHash();
+	const auto   found = _tagIndex.find(hash);
+	if (found == _tagIndex.end()) { return; }
+
+	const auto& slotIndices = found->second;
+	result.Reserve(result.Size() + slotIndices.Size());
+	for (uint64 i = 0; i < slotIndices.Size(); ++i)
+	{
+		const auto& gameObject = _gameObjects[_slots[slotIndices[i]].DenseIndex];
+		if (gameObject->_tag == tag) { result.Push(gameObject); }
+	}
+}
+
+/*!**********************************************************************
+*  @brief     IuWFNg̔j\񂵂܂. \񂵂_Ō̑ΏۂO, FlushDestroyedŎۂɉ܂.
+*  @param[in] const GameObjectHandle nh
+*  @return    bool ĂIuWFNg\񂵂ꍇtrue
+*************************************************************************/
+bool GameObjectRegistry::Destroy(const GameObjectHandle handle)
+{
+	if (!IsAlive(handle)) { return false; }
+
+	Slot& slot = _slots[handle.Index];
+	RemoveFromIndex(_nameIndex, slot.NameHash, slot.NamePosition, &Slot::NamePosition);
+	RemoveFromIndex(_tagIndex , slot.TagHash , slot.TagPosition , &Slot::TagPosition);
+	slot.IsPendingDestroy = true;
+	_pendingDestroys.Push(handle.Index);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     ^OvIuWFNgSĔj\񂵂܂.
+*  @param[in] const gu::tstring& ^O
+*  @return    gu::uint64 \񂵂IuWFNg̐
+*************************************************************************/
+uint64 GameObjectRegistry::DestroyByTag(const tstring& tag)
+{
+	const uint64 hash  = tag.GetTypedHash();
+	const auto   found = _tagIndex.find(hash);
+	if (found == _tagIndex.end()) { return 0; }
+
+	/*-------------------------------------------------------------------
+	-      瑖, vvf𖖔̗vfŖ߂Ȃ菜܂.
+	-      nbVlՓ˂ʂ̃^Oc܂.
+	---------------------------------------------------------------------*/
+	auto&  slotIndices  = found->second;
+	uint64 destroyCount = 0;
+	for (uint64 i = slotIndices.Size(); i > 0; --i)
+	{
+		const uint32 slotIndex = slotIndices[i - 1];
+		Slot& slot = _slots[slotIndex];
+		if (_gameObjects[slot.DenseIndex]->_tag != tag) { continue; }
+
+		RemoveFromIndex(_nameIndex, slot.NameHash, slot.NamePosition, &Slot::NamePosition);
+
+		const uint32 lastSlotIndex = slotIndices.Back();
+		slotIndices[i - 1] = lastSlotIndex;
+		_slots[lastSlotIndex].TagPosition = static_cast<uint32>(i - 1);
+		slotIndices.Pop();
+
+		slot.TagPosition      = INVALID_INDEX;
+		slot.IsPendingDestroy = true;
+		_pendingDestroys.Push(slotIndex);
+		++destroyCount;
+	}
+
+	if (slotIndices.IsEmpty()) { _tagIndex.erase(found); }
+	return destroyCount;
+}
+
+/*!**********************************************************************
+*  @brief     j\񂳂ꂽIuWFNg܂Ƃ߂ĉ, Xbgėp\ɂ܂. t[̏IɌĂяoĂ.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void GameObjectRegistry::FlushDestroyed()
+{
+	/*-------------------------------------------------------------------
+	-      IuWFNg̃fXgN^j\񂳂邱Ƃ邽,
+	-      ɂȂ܂ŌJԂ܂
+	---------------------------------------------------------------------*/
+	while (!_pendingDestroys.IsEmpty())
+	{
+		const uint32 slotIndex = _pendingDestroys.Back();
+		_pendingDestroys.Pop();
+
+		Slot& slot = _slots[slotIndex];
+		const uint32 denseIndex = slot.DenseIndex;
+		const uint32 lastIndex  = static_cast<uint32>(_gameObjects.Size() - 1);
+
+		/*-------------------------------------------------------------------
+		-      zƃXbgXVĂQƂ, fXgN^ēĂۂ܂
+		---------------------------------------------------------------------*/
+		GameObjectPtr released = _gameObjects[denseIndex];
+		if (denseIndex != lastIndex)
+		{
+			_gameObjects[denseIndex] = _gameObjects[lastIndex];
+			_denseToSlot[denseIndex] = _denseToSlot[lastIndex];
+			_slots[_denseToSlot[denseIndex]].DenseIndex = denseIndex;
+		}
+		_gameObjects.Pop();
+		_denseToSlot.Pop();
+
+		slot.DenseIndex       = INVALID_INDEX;
+		slot.NamePosition     = INVALID_INDEX;
+		slot.TagPosition      = INVALID_INDEX;
+		slot.IsPendingDestroy = false;
+		slot.Generation       = NextGeneration(slot.Generation);
+		_freeSlots.Push(slotIndex);
+
+		released.Reset();
+	}
+}
+
+/*!**********************************************************************
+*  @brief     O̕ύXCfbNX֔f܂. GameObject::SetNameĂяo܂.
+*  @param[in] const GameObjectHandle nh
+*  @param[in] const gu::tstring& ύX̖O
+*  @return    void
+*************************************************************************/
+void GameObjectRegistry::Rename(const GameObjectHandle handle, const tstring& name)
+{
+	if (!IsAlive(handle)) { return; }
+
+	Slot& slot = _slots[handle.Index];
+	const uint64 hash = name.GetTypedHash();
+	if (hash == slot.NameHash) { return; }
+
+	RemoveFromIndex(_nameIndex, slot.NameHash, slot.NamePosition, &Slot::NamePosition);
+	slot.NameHash     = hash;
+	slot.NamePosition = AddToIndex(_nameIndex, hash, handle.Index);
+}
+
+/*!**********************************************************************
+*  @brief     ^O̕ύXCfbNX֔f܂. GameObject::SetTagĂяo܂.
+*  @param[in] const GameObjectHandle nh
+*  @param[in] const gu::tstring& ύX̃^O
+*  @return    void
+*************************************************************************/
+void GameObjectRegistry::Retag(const GameObjectHandle handle, const tstring& tag)
+{
+	if (!IsAlive(handle)) { return; }
+
+	Slot& slot = _slots[handle.Index];
+	const uint64 hash = tag.GetTypedHash();
+	if (hash == slot.TagHash) { return; }
+
+	RemoveFromIndex(_tagIndex, slot.TagHash, slot.TagPosition, &Slot::TagPosition);
+	slot.TagHash     = hash;
+	slot.TagPosition = AddToIndex(_tagIndex, hash, handle.Index);
+}
+
+/*!**********************************************************************
+*  @brief     SẴIuWFNg𑦍ɉ܂. sς݂̃nh͑SĖɂȂ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void GameObjectRegistry::Clear()
+{
+	_nameIndex.clear();
+	_tagIndex.clear();
+	_pendingDestroys.Clear();
+	_freeSlots.Clear();
+
+	for (uint64 i = 0; i < _slots.Size(); ++i)
+	{
+		Slot& slot = _slots[i];
+		if (slot.DenseIndex != INVALID_INDEX) { slot.Generation = NextGeneration(slot.Generation); }
+
+		slot.DenseIndex       = INVALID_INDEX;
+		slot.NamePosition     = INVALID_INDEX;
+		slot.TagPosition      = INVALID_INDEX;
+		slot.IsPendingDestroy = false;
+		_freeSlots.Push(static_cast<uint32>(i));
+	}
+
+	_denseToSlot.Clear();
+	_gameObjects.Clear();
+	_gameObjects.ShrinkToFit();
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     CfbNXɃXbgǉ, z̈ʒuԂ܂.
+*************************************************************************/
+uint32 GameObjectRegistry::AddToIndex(Index& index, const uint64 hash, const uint32 slotIndex)
+{
+	auto& slotIndices = index[hash];
+	slotIndices.Push(slotIndex);
+	return static_cast<uint32>(slotIndices.Size() - 1);
+}
+
+/*!**********************************************************************
+*  @brief     CfbNXXbg菜, ̗vfŖ߂܂. ɂȂnbVl͍폜܂.
+*************************************************************************/
+void GameObjectRegistry::RemoveFromIndex(Index& index, const uint64 hash, const uint32 position, uint32 Slot::* positionMember)
+{
+	const auto found = index.find(hash);
+	Check(found != index.end());
+
+	auto& slotIndices = found->second;
+	const uint32 lastSlotIndex = slotIndices.Back();
+	slotIndices[position] = lastSlotIndex;
+	_slots[lastSlotIndex].*positionMember = position;
+	slotIndices.Pop();
+
+	if (slotIndices.IsEmpty()) { index.erase(found); }
+}
+#pragma endregion Protected Function
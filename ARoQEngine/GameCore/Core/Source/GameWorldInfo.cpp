@@ -12,6 +12,7 @@
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -33,14 +34,19 @@ GameWorldInfo::GameWorldInfo(const LowLevelGraphicsEnginePtr& engine, const std:
 	const auto device = _engine->GetDevice();
 
 	/*-------------------------------------------------------------------
-	-            Prepare constant and upload buffer
+	-            Prepare constant buffer (written through the upload ring)
 	---------------------------------------------------------------------*/
-	const GameWorldConstant world = { .World = gm::Float4x4()};
-	const auto bufferInfo = GPUBufferMetaData::ConstantBuffer(sizeof(GameWorldConstant), static_cast<gu::uint32>(maxInstanceCount), MemoryHeap::Upload, ResourceState::Common, (void*)&world);
+	const auto bufferInfo = GPUBufferMetaData::DefaultBuffer(sizeof(GameWorldConstant), static_cast<gu::uint32>(maxInstanceCount));
 	
 	_gameWorldConstants = device->CreateBuffer(bufferInfo);
 	_resourceView       = device->CreateResourceView(ResourceViewType::ConstantBuffer, _gameWorldConstants);
 
+	const GameWorldConstant world = { .World = gm::Float4x4()};
+	for (std::uint64_t i = 0; i < maxInstanceCount; ++i)
+	{
+		Upload(world, i);
+	}
+
 }
 
 GameWorldInfo::~GameWorldInfo()
@@ -57,4 +63,15 @@ void GameWorldInfo::Bind(const GraphicsCommandListPtr& commandList, const std::u
 {
 	_resourceView->Bind(commandList, index);
 }
+
+void GameWorldInfo::Upload(const GameWorldConstant& constant, const std::uint64_t instanceIndex)
+{
+#ifdef _DEBUG
+	Check(instanceIndex < _maxInstanceCount);
+#endif
+
+	// Each instance is placed at the 256 byte aligned stride of the constant buffer.
+	const auto offset = instanceIndex * _gameWorldConstants->GetElementByteSize();
+	RenderSnapshot::UploadBuffer(*_engine->GetUploadRing(), _gameWorldConstants, &constant, sizeof(GameWorldConstant), offset);
+}
 #pragma endregion Main Function
\ No newline at end of file
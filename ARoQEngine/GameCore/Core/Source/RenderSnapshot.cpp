@@ -0,0 +1,154 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderSnapshot.cpp
+///  @brief  XVXbh1t[̕` (Transform, Cg, J) 𕡐, `Xbh̒lQƂ邽߂̃obt@ł.
+///  @author toide
+///  @date   2026/10/22 10:14:36
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUUploadRing.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine;
+
+namespace
+{
+	/*! @brief XbhƂ̏ݒ̃XibvVbg (XVXbh)*/
+	thread_local RenderSnapshot* t_writingSnapshot = nullptr;
+
+	/*! @brief XbhƂ̕`撆̃XibvVbg (`Xbh)*/
+	thread_local const RenderSnapshot* t_readingSnapshot = nullptr;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     L^eSĔj܂. mۂ͎̃t[ōėp܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RenderSnapshot::Clear()
+{
+	_transforms.Clear();
+	_uploads   .Clear();
+	_uploadData.Clear();
+	_camera = {};
+}
+
+/*!**********************************************************************
+*  @brief     `摤ŎQƂIuWFNg̃[hsƈʒuL^܂.
+*  @param[in] const void* IuWFNg (L[ƂĂ̂ݎgp܂)
+*  @param[in] const TransformSnapshot& [hsƈʒu
+*  @return    void
+*************************************************************************/
+void RenderSnapshot::SetTransform(const void* object, const TransformSnapshot& transform)
+{
+	_transforms[object] = transform;
+}
+
+/*!**********************************************************************
+*  @brief     L^[hsƈʒuԂ܂.
+*  @param[in] const void* IuWFNg
+*  @return    const TransformSnapshot* L^ĂȂꍇnullptr
+*************************************************************************/
+const TransformSnapshot* RenderSnapshot::FindTransform(const void* object) const
+{
+	const auto found = _transforms.Find(object);
+	return found != _transforms.end() ? &found->Value : nullptr;
+}
+
+/*!**********************************************************************
+*  @brief     GPUobt@ւ݂̏L^܂. f[^͂̎_ŕ܂.
+*  @param[in] const gu::SharedPointer<rhi::core::GPUBuffer>& ݐ̃obt@
+*  @param[in] const void* ރf[^
+*  @param[in] const gu::uint64 oCgTCY
+*  @param[in] const gu::uint64 ݐ̃ItZbg [byte]
+*  @return    void
+*************************************************************************/
+void RenderSnapshot::Upload(const gu::SharedPointer<rhi::core::GPUBuffer>& destination, const void* data, const gu::uint64 byteSize, const gu::uint64 destinationOffset)
+{
+	if (destination == nullptr || data == nullptr || byteSize == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-      f[^𖖔ɕ܂. t[ʂނ, eʂ͔{XɊmۂ܂
+	---------------------------------------------------------------------*/
+	const auto dataOffset = _uploadData.Size();
+	const auto required   = dataOffset + byteSize;
+	if (required > _uploadData.Capacity())
+	{
+		_uploadData.Reserve(required > _uploadData.Capacity() * 2 ? required : _uploadData.Capacity() * 2);
+	}
+	_uploadData.Resize(required, false);
+	gu::Memory::Copy(_uploadData.Data() + dataOffset, data, byteSize);
+
+	_uploads.Push({ destination, destinationOffset, dataOffset, byteSize });
+}
+
+/*!**********************************************************************
+*  @brief     L^݂L^ɃAbv[hO֓n܂. `Xbh, t[̕`n߂OɌĂяoĂ.
+*  @param[in] rhi::core::GPUUploadRing& Abv[hO
+*  @return    void
+*************************************************************************/
+void RenderSnapshot::Apply(rhi::core::GPUUploadRing& uploadRing) const
+{
+	for (const auto& upload : _uploads)
+	{
+		uploadRing.UploadBuffer(upload.Destination, _uploadData.Data() + upload.DataOffset, upload.ByteSize, upload.DestinationOffset);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ĂяoXbhXibvVbgݒłΏ݂L^, łȂ΂̏ŃAbv[hO֓n܂.
+*  @param[in] rhi::core::GPUUploadRing& Abv[hO
+*  @param[in] const gu::SharedPointer<rhi::core::GPUBuffer>& ݐ̃obt@
+*  @param[in] const void* ރf[^
+*  @param[in] const gu::uint64 oCgTCY
+*  @param[in] const gu::uint64 ݐ̃ItZbg [byte]
+*  @return    void
+*************************************************************************/
+void RenderSnapshot::UploadBuffer(rhi::core::GPUUploadRing& uploadRing, const gu::SharedPointer<rhi::core::GPUBuffer>& destination, const void* data, const gu::uint64 byteSize, const gu::uint64 destinationOffset)
+{
+	if (t_writingSnapshot)
+	{
+		t_writingSnapshot->Upload(destination, data, byteSize, destinationOffset);
+	}
+	else
+	{
+		uploadRing.UploadBuffer(destination, data, byteSize, destinationOffset);
+	}
+}
+#pragma endregion Main Function
+
+#pragma region Property
+/*! @brief ĂяoXbhݒ̃XibvVbg. ꍇnullptr*/
+RenderSnapshot* RenderSnapshot::GetWriting() noexcept
+{
+	return t_writingSnapshot;
+}
+
+/*! @brief ĂяoXbhރXibvVbgݒ肵܂*/
+void RenderSnapshot::SetWriting(RenderSnapshot* snapshot) noexcept
+{
+	t_writingSnapshot = snapshot;
+}
+
+/*! @brief ĂяoXbh`撆̃XibvVbg. ꍇnullptr*/
+const RenderSnapshot* RenderSnapshot::GetReading() noexcept
+{
+	return t_readingSnapshot;
+}
+
+/*! @brief ĂяoXbh`悷XibvVbgݒ肵܂*/
+void RenderSnapshot::SetReading(const RenderSnapshot* snapshot) noexcept
+{
+	t_readingSnapshot = snapshot;
+}
+#pragma endregion Property
@@ -0,0 +1,149 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ECSArchetype.hpp
+///  @brief  R|[lg̑gݍ킹GeBeB, 16KB̃`NSoAŊi[܂. @n
+///          `N̐擪ɃGeBeB̔z, ̌ɃR|[lgƂ̔z, 1̃`Nɓ邾̗vfl߂܂. @n
+///          vf͑S`NʂČԂȂl, 폜͖̗vfړĖ߂܂.
+///  @author toide
+///  @date   2026/10/20 4:05:51
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef ECS_ARCHETYPE_HPP
+#define ECS_ARCHETYPE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "ECSEntity.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::ecs::details::archetype
+{
+	/*! @brief A[L^CvR|[lgȂƂ\Xbg*/
+	constexpr gu::uint8 INVALID_SLOT = 0xFF;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::ecs
+{
+	/****************************************************************************
+	*				  			   Archetype
+	****************************************************************************/
+	/* @brief  R|[lg̑gݍ킹Ƃ̃GeBeB̊i[ł. @n
+	*          sԍr̗vf̓`N r / capacity  r % capacity Ԗڂɔzu܂.
+	*****************************************************************************/
+	class Archetype : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     1sǉ, GeBeB݂܂. R|[lg̒l͖ł.
+		*  @param[in] const Entity ǉGeBeB
+		*  @return    gu::uint32 ǉsԍ
+		*************************************************************************/
+		gu::uint32 AddRow(const Entity entity);
+
+		/*!**********************************************************************
+		*  @brief     w肵s폜, ̍sŖ߂܂.
+		*  @param[in] const gu::uint32 폜sԍ
+		*  @return    Entity 폜sֈړGeBeB (̍s폜ꍇ͖ȃnh)
+		*************************************************************************/
+		Entity RemoveRow(const gu::uint32 row);
+
+		/*!**********************************************************************
+		*  @brief     ̃A[L^CvR|[lg̒l, ʂ̃A[L^Cv̍sփRs[܂.
+		*  @param[in] const gu::uint32 Rs[̍sԍ
+		*  @param[in] Archetype& Rs[̃A[L^Cv
+		*  @param[in] const gu::uint32 Rs[̍sԍ
+		*  @return    void
+		*************************************************************************/
+		void CopyRowTo(const gu::uint32 sourceRow, Archetype& destination, const gu::uint32 destinationRow) const;
+
+		/*!**********************************************************************
+		*  @brief     SĂ̍s폜܂. `N͍ėp̂߉܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear() { _rowCount = 0; }
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ĂR|[lg̃rbg}XN*/
+		__forceinline ComponentMask GetMask() const { return _mask; }
+
+		/*! @brief 1̃`NɊi[łs*/
+		__forceinline gu::uint32 GetChunkCapacity() const { return _chunkCapacity; }
+
+		/*! @brief i[Ăs*/
+		__forceinline gu::uint32 GetRowCount() const { return _rowCount; }
+
+		/*! @brief si[Ă`N̐*/
+		__forceinline gu::uint32 GetChunkCount() const { return (_rowCount + _chunkCapacity - 1) / _chunkCapacity; }
+
+		/*! @brief w肵`NɊi[Ăs*/
+		__forceinline gu::uint32 GetChunkRowCount(const gu::uint32 chunkIndex) const
+		{
+			const gu::uint32 begin = chunkIndex * _chunkCapacity;
+			return _rowCount - begin < _chunkCapacity ? _rowCount - begin : _chunkCapacity;
+		}
+
+		/*! @brief w肵R|[lgĂ邩*/
+		__forceinline bool HasComponent(const ComponentTypeID id) const { return _slots[id] != details::archetype::INVALID_SLOT; }
+
+		/*! @brief w肵`ÑGeBeB̔z*/
+		__forceinline Entity* GetEntities(const gu::uint32 chunkIndex) const { return reinterpret_cast<Entity*>(_chunks[chunkIndex]); }
+
+		/*! @brief w肵`ÑR|[lg̔z (R|[lgȂꍇnullptr)*/
+		__forceinline void* GetComponents(const gu::uint32 chunkIndex, const ComponentTypeID id) const
+		{
+			const gu::uint8 slot = _slots[id];
+			return slot == details::archetype::INVALID_SLOT ? nullptr : _chunks[chunkIndex] + _offsets[slot];
+		}
+
+		/*! @brief w肵s̃R|[lg (R|[lgȂꍇnullptr)*/
+		__forceinline void* GetComponent(const gu::uint32 row, const ComponentTypeID id) const
+		{
+			const gu::uint8 slot = _slots[id];
+			if (slot == details::archetype::INVALID_SLOT) { return nullptr; }
+			return _chunks[row / _chunkCapacity] + _offsets[slot] + static_cast<gu::uint64>(row % _chunkCapacity) * _sizes[slot];
+		}
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief R|[lg̃rbg}XN`N̔zuvZ܂*/
+		explicit Archetype(const ComponentMask mask);
+
+		~Archetype();
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ĂR|[lg̃rbg}XN*/
+		ComponentMask _mask = 0;
+
+		/*! @brief ^IDR|[lg̔zԍւ̕ϊ\ (ȂꍇINVALID_SLOT)*/
+		gu::uint8 _slots[MAX_COMPONENT_TYPE_COUNT] = {};
+
+		/*! @brief R|[lg̔zԍƂ̌^ID, `N擪̃ItZbg, 1vf̃oCg*/
+		gu::DynamicArray<ComponentTypeID> _componentTypes = {};
+		gu::DynamicArray<gu::uint32>      _offsets        = {};
+		gu::DynamicArray<gu::uint32>      _sizes          = {};
+
+		/*! @brief mۍς݂̃`N (sȂĂėp̂ߕێ܂)*/
+		gu::DynamicArray<gu::uint8*> _chunks = {};
+
+		/*! @brief 1̃`NɊi[łs*/
+		gu::uint32 _chunkCapacity = 0;
+
+		/*! @brief i[Ăs*/
+		gu::uint32 _rowCount = 0;
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,130 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ECSEntity.hpp
+///  @brief  ECSŎgpGeBeB̃nh, R|[lǧ^`܂. @n
+///          GeBeB(CfbNX, )64bit̃nhŕ\, jɓCfbNXėpĂÂnh͖ƂĈ܂. @n
+///          R|[lg͌^Ƃ0AԂIDU, A[L^CvID̃rbg}XNŕ\܂.
+///  @author toide
+///  @date   2026/10/20 4:05:51
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef ECS_ENTITY_HPP
+#define ECS_ENTITY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+#include <type_traits>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::ecs
+{
+	/*! @brief R|[lǧ^ID (0 ` MAX_COMPONENT_TYPE_COUNT - 1)*/
+	using ComponentTypeID = gu::uint32;
+
+	/*! @brief R|[lg̑gݍ킹\rbg}XN*/
+	using ComponentMask = gu::uint64;
+
+	/*! @brief o^łR|[lǧ^̍ő吔 (ComponentMask̃rbg)*/
+	constexpr gu::uint32 MAX_COMPONENT_TYPE_COUNT = 64;
+
+	/*! @brief A[L^Cṽ`N1̃oCg*/
+	constexpr gu::uint32 CHUNK_BYTE_SIZE = 16 * 1024;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::ecs
+{
+	/****************************************************************************
+	*				  			   Entity
+	****************************************************************************/
+	/* @brief  GeBeB̃nhł. World̃CfbNX, ̃CfbNXgpێ܂. @n
+	*          0gpȂ, l̃nh͏ɖɂȂ܂.
+	*****************************************************************************/
+	struct Entity
+	{
+		/*! @brief World̃GeBeB̃CfbNX*/
+		gu::uint32 Index = 0;
+
+		/*! @brief CfbNXėpꂽ (0͖)*/
+		gu::uint32 Generation = 0;
+
+		/*! @brief LȒlݒ肳Ă邩 (GeBeBĂ邩World::IsAliveŊmFĂ)*/
+		__forceinline bool IsValid() const { return Generation != 0; }
+
+		/*! @brief 64bit̒lƂĎ擾܂*/
+		__forceinline gu::uint64 ToUInt64() const { return (static_cast<gu::uint64>(Generation) << 32) | Index; }
+
+		__forceinline bool operator==(const Entity& right) const { return Index == right.Index && Generation == right.Generation; }
+		__forceinline bool operator!=(const Entity& right) const { return !(*this == right); }
+	};
+
+	static_assert(sizeof(Entity) == 8, "Entity must be 64 bits");
+
+	/****************************************************************************
+	*				  			   ComponentTypeInfo
+	****************************************************************************/
+	/* @brief  `N̔zu߂邽߂̃R|[lǧ^ł.
+	*****************************************************************************/
+	struct ComponentTypeInfo
+	{
+		/*! @brief 1vf̃oCg*/
+		gu::uint32 Size = 0;
+
+		/*! @brief ACg*/
+		gu::uint32 Alignment = 0;
+	};
+
+	/****************************************************************************
+	*				  			   ComponentRegistry
+	****************************************************************************/
+	/* @brief  R|[lǧ^IDU܂. ʏGetComponentTypeIDgpĂ.
+	*****************************************************************************/
+	class ComponentRegistry
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     VR|[lǧ^o^, IDԂ܂. ̃XbhĂяo܂.
+		*  @param[in] const gu::uint32 1vf̃oCg
+		*  @param[in] const gu::uint32 ACg
+		*  @return    ComponentTypeID UID
+		*************************************************************************/
+		static ComponentTypeID Register(const gu::uint32 size, const gu::uint32 alignment);
+
+		/*!**********************************************************************
+		*  @brief     o^ς݂̃R|[lǧ^Ԃ܂.
+		*  @param[in] const ComponentTypeID ID
+		*  @return    const ComponentTypeInfo& ^
+		*************************************************************************/
+		static const ComponentTypeInfo& GetInfo(const ComponentTypeID id);
+		#pragma endregion
+	};
+
+	/*!**********************************************************************
+	*  @brief     R|[lǧ^IDԂ܂. ^Ƃɏ̌Ăяoœo^܂. @n
+	*             `NԂ̈ړmemcpyōs, R|[lg̓grAɃRs[, jł^ɂĂ.
+	*************************************************************************/
+	template<class T>
+	ComponentTypeID GetComponentTypeID()
+	{
+		static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>, "ECS components must be trivially copyable and destructible");
+		static const ComponentTypeID id = ComponentRegistry::Register(static_cast<gu::uint32>(sizeof(T)), static_cast<gu::uint32>(alignof(T)));
+		return id;
+	}
+
+	/*!**********************************************************************
+	*  @brief     R|[lǧ^̑gݍ킹rbg}XN쐬܂.
+	*************************************************************************/
+	template<class... Ts>
+	ComponentMask GetComponentMask()
+	{
+		return (ComponentMask(0) | ... | (ComponentMask(1) << GetComponentTypeID<std::remove_const_t<Ts>>()));
+	}
+}
+
+#endif
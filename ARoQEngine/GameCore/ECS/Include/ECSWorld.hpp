@@ -0,0 +1,375 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ECSWorld.hpp
+///  @brief  GeBeBƃA[L^CvǗ, R|[lg̑gݍ킹ōi荞񂾃NGs܂. @n
+///          NG̓A[L^Cṽ`NPʂɎs, ParallelForEach*ł̓`NXbhv[ɕz܂. @n
+///          GameObject / ComponentƈقȂ, XV͘ASoA̔zɑ΂郋[vɂȂ, z֐̌Ăяo܂.
+///  @author toide
+///  @date   2026/10/20 4:05:51
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef ECS_WORLD_HPP
+#define ECS_WORLD_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "ECSArchetype.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::ecs::details::world
+{
+	/*! @brief ParallelForEach*1̃^XNŏ̃`N*/
+	constexpr gu::uint32 MIN_CHUNKS_PER_TASK = 4;
+
+	/*! @brief 1Xbh̃^XN (ʂ̕΂ς, Xbh葽܂)*/
+	constexpr gu::uint32 TASKS_PER_THREAD = 4;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine::ecs
+{
+	/****************************************************************************
+	*				  			   World
+	****************************************************************************/
+	/* @brief  GeBeB̐, j, R|[lg̒ǉ, 폜, NG̎ss܂. @n
+	*          R|[lg̒ǉ, 폜ł̓GeBeBʂ̃A[L^Cvֈړ邽, 擾|C^͖ɂȂ܂. @n
+	*          NG̎sɃGeBeB̐, j, R|[lg̒ǉ, 폜sȂł.
+	*****************************************************************************/
+	class World : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     w肵R|[lgGeBeB쐬܂.
+		*  @param[in] const Ts&... R|[lg̏l
+		*  @return    Entity 쐬GeBeB
+		*************************************************************************/
+		template<class... Ts>
+		Entity CreateEntity(const Ts&... components);
+
+		/*!**********************************************************************
+		*  @brief     GeBeBj܂. j̃nhIsAlivefalseԂ܂.
+		*  @param[in] const Entity jGeBeB
+		*  @return    bool ĂGeBeBjꍇtrue
+		*************************************************************************/
+		bool DestroyEntity(const Entity entity);
+
+		/*!**********************************************************************
+		*  @brief     GeBeBɃR|[lgǉ܂. ɎĂꍇ͒l㏑܂.
+		*  @param[in] const Entity GeBeB
+		*  @param[in] const T& R|[lg̒l
+		*  @return    bool ĂGeBeB̏ꍇtrue
+		*************************************************************************/
+		template<class T>
+		bool AddComponent(const Entity entity, const T& component);
+
+		/*!**********************************************************************
+		*  @brief     GeBeBR|[lg폜܂.
+		*  @param[in] const Entity GeBeB
+		*  @return    bool R|[lg폜ꍇtrue
+		*************************************************************************/
+		template<class T>
+		bool RemoveComponent(const Entity entity) { return ChangeArchetype(entity, 0, ComponentMask(1) << GetComponentTypeID<T>()) != nullptr; }
+
+		/*!**********************************************************************
+		*  @brief     TsSĎGeBeBƂ function(Ts&...) Ăяo܂.
+		*  @param[in] Function&& Ăяo֐
+		*  @return    void
+		*************************************************************************/
+		template<class... Ts, class Function>
+		void ForEach(Function&& function);
+
+		/*!**********************************************************************
+		*  @brief     TsSĎ`NƂ function(gu::uint32 count, Ts*...) Ăяo܂. @n
+		*             ezcount̘Avfw, SIMDł܂Ƃ߂ďł܂.
+		*  @param[in] Function&& Ăяo֐
+		*  @return    void
+		*************************************************************************/
+		template<class... Ts, class Function>
+		void ForEachChunk(Function&& function);
+
+		/*!**********************************************************************
+		*  @brief     ForEachChunkXbhv[ŕɎs, SĂ̊҂܂. @n
+		*             `N1̃Xbh邽, ֐ŏރR|[lg̔r͕svł. @n
+		*             ĂяõXbh̃^XNoď邽, threadPool̃^XNĂяoĂfbhbN܂.
+		*  @param[in] gu::ThreadPool& sXbhv[
+		*  @param[in] Function&& Ăяo֐ (̃Xbh瓯ɌĂяo܂)
+		*  @return    void
+		*************************************************************************/
+		template<class... Ts, class Function>
+		void ParallelForEachChunk(gu::ThreadPool& threadPool, Function&& function);
+
+		/*!**********************************************************************
+		*  @brief     ForEachXbhv[ŕɎs, SĂ̊҂܂.
+		*  @param[in] gu::ThreadPool& sXbhv[
+		*  @param[in] Function&& Ăяo֐ (̃Xbh瓯ɌĂяo܂)
+		*  @return    void
+		*************************************************************************/
+		template<class... Ts, class Function>
+		void ParallelForEach(gu::ThreadPool& threadPool, Function&& function);
+
+		/*!**********************************************************************
+		*  @brief     SẴGeBeBj܂. ̃nh͑SĖɂȂ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     GeBeBĂ邩Ԃ܂.
+		*************************************************************************/
+		__forceinline bool IsAlive(const Entity entity) const
+		{
+			return entity.Index < _records.Size() && _records[entity.Index].Generation == entity.Generation && _records[entity.Index].Archetype != nullptr;
+		}
+
+		/*!**********************************************************************
+		*  @brief     GeBeB̃R|[lgԂ܂. ĂȂ, ܂̓R|[lgȂꍇnullptrł.
+		*************************************************************************/
+		template<class T>
+		T* GetComponent(const Entity entity) const
+		{
+			if (!IsAlive(entity)) { return nullptr; }
+			const auto& record = _records[entity.Index];
+			return static_cast<T*>(record.Archetype->GetComponent(record.Row, GetComponentTypeID<T>()));
+		}
+
+		/*!**********************************************************************
+		*  @brief     GeBeBR|[lgĂ邩Ԃ܂.
+		*************************************************************************/
+		template<class T>
+		bool HasComponent(const Entity entity) const { return GetComponent<T>(entity) != nullptr; }
+
+		/*!**********************************************************************
+		*  @brief     ĂGeBeB̐Ԃ܂.
+		*************************************************************************/
+		__forceinline gu::uint64 GetEntityCount() const { return _records.Size() - _freeIndices.Size(); }
+
+		/*!**********************************************************************
+		*  @brief     쐬ς݂̃A[L^Cv̐Ԃ܂.
+		*************************************************************************/
+		__forceinline gu::uint64 GetArchetypeCount() const { return _archetypes.Size(); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		World() = default;
+
+		~World();
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*!**********************************************************************
+		*  @brief     rbg}XNɈvA[L^CvԂ܂. ꍇ͍쐬܂.
+		*************************************************************************/
+		Archetype* GetOrCreateArchetype(const ComponentMask mask);
+
+		/*!**********************************************************************
+		*  @brief     CfbNX蓖, A[L^CvɍsǉGeBeBԂ܂.
+		*************************************************************************/
+		Entity AllocateEntity(Archetype* archetype);
+
+		/*!**********************************************************************
+		*  @brief     R|[lgǉ, 폜A[L^CvփGeBeBړ܂. ʂR|[lg̒l͈p܂.
+		*  @return    Archetype* ړ̃A[L^Cv (GeBeBĂȂ, ܂͕ωꍇnullptr)
+		*************************************************************************/
+		Archetype* ChangeArchetype(const Entity entity, const ComponentMask addMask, const ComponentMask removeMask);
+
+		/*!**********************************************************************
+		*  @brief     NG̎sɍ\ύXĂȂmF܂.
+		*************************************************************************/
+		__forceinline void CheckNotIterating() const { Check(_iteratingCount.load(std::memory_order_relaxed) == 0); }
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*---------------------------------------------------------------
+				GeBeB̃CfbNXƂ̊i[
+		-----------------------------------------------------------------*/
+		struct EntityRecord
+		{
+			ecs::Archetype* Archetype  = nullptr; // jς݂̏ꍇnullptr
+			gu::uint32      Row        = 0;
+			gu::uint32      Generation = 1;
+		};
+
+		/*! @brief CfbNXƂ̊i[*/
+		gu::DynamicArray<EntityRecord> _records = {};
+
+		/*! @brief jčėpłCfbNX*/
+		gu::DynamicArray<gu::uint32> _freeIndices = {};
+
+		/*! @brief 쐬ς݂̃A[L^Cv (WorldL܂)*/
+		gu::DynamicArray<Archetype*> _archetypes = {};
+
+		/*! @brief s̃NG̐*/
+		std::atomic<gu::uint32> _iteratingCount = 0;
+		#pragma endregion
+	};
+
+#pragma region Implement
+	template<class... Ts>
+	Entity World::CreateEntity(const Ts&... components)
+	{
+		CheckNotIterating();
+
+		Archetype* archetype = GetOrCreateArchetype(GetComponentMask<Ts...>());
+		const Entity entity  = AllocateEntity(archetype);
+		const gu::uint32 row = _records[entity.Index].Row;
+		((*static_cast<Ts*>(archetype->GetComponent(row, GetComponentTypeID<Ts>())) = components), ...);
+		return entity;
+	}
+
+	template<class T>
+	bool World::AddComponent(const Entity entity, const T& component)
+	{
+		if (!IsAlive(entity)) { return false; }
+
+		ChangeArchetype(entity, ComponentMask(1) << GetComponentTypeID<T>(), 0);
+		*GetComponent<T>(entity) = component;
+		return true;
+	}
+
+	template<class... Ts, class Function>
+	void World::ForEachChunk(Function&& function)
+	{
+		const ComponentMask mask = GetComponentMask<Ts...>();
+		_iteratingCount.fetch_add(1, std::memory_order_relaxed);
+
+		for (gu::uint64 i = 0; i < _archetypes.Size(); ++i)
+		{
+			const Archetype* archetype = _archetypes[i];
+			if ((archetype->GetMask() & mask) != mask) { continue; }
+
+			for (gu::uint32 chunk = 0; chunk < archetype->GetChunkCount(); ++chunk)
+			{
+				function(archetype->GetChunkRowCount(chunk), static_cast<Ts*>(archetype->GetComponents(chunk, GetComponentTypeID<std::remove_const_t<Ts>>()))...);
+			}
+		}
+
+		_iteratingCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	template<class... Ts, class Function>
+	void World::ForEach(Function&& function)
+	{
+		ForEachChunk<Ts...>([&function](const gu::uint32 count, Ts*... components)
+		{
+			for (gu::uint32 i = 0; i < count; ++i) { function(components[i]...); }
+		});
+	}
+
+	template<class... Ts, class Function>
+	void World::ParallelForEachChunk(gu::ThreadPool& threadPool, Function&& function)
+	{
+		/*-------------------------------------------------------------------
+		-      Ώۂ̃`N񋓂, Xbh̐{̃^XNɕ܂
+		---------------------------------------------------------------------*/
+		struct ChunkReference
+		{
+			const ecs::Archetype* Archetype = nullptr;
+			gu::uint32            Chunk     = 0;
+		};
+
+		const ComponentMask mask = GetComponentMask<Ts...>();
+		std::vector<ChunkReference> chunks;
+		for (gu::uint64 i = 0; i < _archetypes.Size(); ++i)
+		{
+			if ((_archetypes[i]->GetMask() & mask) != mask) { continue; }
+
+			for (gu::uint32 chunk = 0; chunk < _archetypes[i]->GetChunkCount(); ++chunk)
+			{
+				chunks.push_back({ _archetypes[i], chunk });
+			}
+		}
+
+		const gu::uint32 chunkCount = static_cast<gu::uint32>(chunks.size());
+		const gu::uint32 taskCount  = threadPool.GetThreadCount() * details::world::TASKS_PER_THREAD;
+		gu::uint32 chunksPerTask    = (chunkCount + taskCount - 1) / (taskCount == 0 ? 1 : taskCount);
+		if (chunksPerTask < details::world::MIN_CHUNKS_PER_TASK) { chunksPerTask = details::world::MIN_CHUNKS_PER_TASK; }
+
+		const auto execute = [&chunks, &function](const gu::uint32 begin, const gu::uint32 end)
+		{
+			for (gu::uint32 i = begin; i < end; ++i)
+			{
+				const Archetype* archetype = chunks[i].Archetype;
+				const gu::uint32 chunk     = chunks[i].Chunk;
+				function(archetype->GetChunkRowCount(chunk), static_cast<Ts*>(archetype->GetComponents(chunk, GetComponentTypeID<std::remove_const_t<Ts>>()))...);
+			}
+		};
+
+		_iteratingCount.fetch_add(1, std::memory_order_relaxed);
+
+		if (threadPool.GetThreadCount() <= 1 || chunkCount <= chunksPerTask)
+		{
+			execute(0, chunkCount);
+		}
+		else
+		{
+			/*-------------------------------------------------------------------
+			-      ^XN͎oʒuL, ĂяõXbh悤Ɏo܂. @n
+			-      Xbhv[̃[J[SĖ܂ĂĂĂяoőSďł邽, 
+			-      futureł͂Ȃς݂̃^XNŊ҂܂.
+			---------------------------------------------------------------------*/
+			struct SharedState
+			{
+				std::atomic<gu::uint32> NextTask      = 0;
+				std::atomic<gu::uint32> FinishedCount = 0;
+			};
+
+			const gu::uint32 taskTotal = (chunkCount + chunksPerTask - 1) / chunksPerTask;
+			const auto       state     = std::make_shared<SharedState>();
+
+			// Ɏsꂽ[J[̓^XNoɖ߂邽, execute̎QƂɂ͐G܂
+			const auto runTasks = [state, &execute, chunkCount, chunksPerTask, taskTotal]()
+			{
+				for (gu::uint32 task = state->NextTask.fetch_add(1, std::memory_order_relaxed); task < taskTotal; task = state->NextTask.fetch_add(1, std::memory_order_relaxed))
+				{
+					const gu::uint32 begin = task * chunksPerTask;
+					execute(begin, begin + chunksPerTask < chunkCount ? begin + chunksPerTask : chunkCount);
+
+					if (state->FinishedCount.fetch_add(1, std::memory_order_release) + 1 == taskTotal)
+					{
+						state->FinishedCount.notify_one();
+					}
+				}
+			};
+
+			const gu::uint32 helperCount = threadPool.GetThreadCount() < taskTotal - 1 ? threadPool.GetThreadCount() : taskTotal - 1;
+			for (gu::uint32 i = 0; i < helperCount; ++i)
+			{
+				threadPool.Submit(runTasks);
+			}
+			runTasks();
+
+			for (gu::uint32 finished = state->FinishedCount.load(std::memory_order_acquire); finished != taskTotal; finished = state->FinishedCount.load(std::memory_order_acquire))
+			{
+				state->FinishedCount.wait(finished, std::memory_order_acquire);
+			}
+		}
+
+		_iteratingCount.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	template<class... Ts, class Function>
+	void World::ParallelForEach(gu::ThreadPool& threadPool, Function&& function)
+	{
+		ParallelForEachChunk<Ts...>(threadPool, [&function](const gu::uint32 count, Ts*... components)
+		{
+			for (gu::uint32 i = 0; i < count; ++i) { function(components[i]...); }
+		});
+	}
+#pragma endregion Implement
+}
+
+#endif
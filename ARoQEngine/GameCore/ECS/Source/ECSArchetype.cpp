@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ECSArchetype.cpp
+///  @brief  R|[lg̑gݍ킹GeBeB, 16KB̃`NSoAŊi[܂.
+///  @author toide
+///  @date   2026/10/20 4:05:51
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/ECSArchetype.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine::ecs;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			`N̐擪AhX̃ACg (LbVC)
+	-----------------------------------------------------------------*/
+	constexpr uint64 CHUNK_ALIGNMENT = 64;
+
+	/*---------------------------------------------------------------
+			o^ς݂̃R|[lǧ^
+	-----------------------------------------------------------------*/
+	ComponentTypeInfo    g_componentTypeInfos[MAX_COMPONENT_TYPE_COUNT] = {};
+	std::atomic<uint32>  g_componentTypeCount = 0;
+
+	/*---------------------------------------------------------------
+			alignment̔{ɐ؂グ܂
+	-----------------------------------------------------------------*/
+	uint32 AlignUp(const uint32 value, const uint32 alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region ComponentRegistry
+/*!**********************************************************************
+*  @brief     VR|[lǧ^o^, IDԂ܂.
+*  @param[in] const gu::uint32 1vf̃oCg
+*  @param[in] const gu::uint32 ACg
+*  @return    ComponentTypeID UID
+*************************************************************************/
+ComponentTypeID ComponentRegistry::Register(const uint32 size, const uint32 alignment)
+{
+	// ̃Xbh̓o^Ət邽, ID̍̔Ԃacquire/releaseōs܂
+	const ComponentTypeID id = g_componentTypeCount.fetch_add(1, std::memory_order_acq_rel);
+	Check(id < MAX_COMPONENT_TYPE_COUNT);
+
+	g_componentTypeInfos[id].Size      = size;
+	g_componentTypeInfos[id].Alignment = alignment;
+	return id;
+}
+
+/*!**********************************************************************
+*  @brief     o^ς݂̃R|[lǧ^Ԃ܂.
+*  @param[in] const ComponentTypeID ID
+*  @return    const ComponentTypeInfo& ^
+*************************************************************************/
+const ComponentTypeInfo& ComponentRegistry::GetInfo(const ComponentTypeID id)
+{
+	Check(id < g_componentTypeCount.load(std::memory_order_acquire));
+	return g_componentTypeInfos[id];
+}
+#pragma endregion ComponentRegistry
+
+#pragma region Archetype
+/*!**********************************************************************
+*  @brief     R|[lg̃rbg}XN`N̔zuvZ܂. @n
+*             GeBeB̔z擪ɒu, ^ID̏ɃR|[lg̔zׂ܂.
+*  @param[in] const ComponentMask R|[lg̃rbg}XN
+*************************************************************************/
+Archetype::Archetype(const ComponentMask mask) : _mask(mask)
+{
+	Memory::Set(_slots, details::archetype::INVALID_SLOT, sizeof(_slots));
+
+	uint32 rowByteSize = static_cast<uint32>(sizeof(Entity));
+	for (ComponentTypeID id = 0; id < MAX_COMPONENT_TYPE_COUNT; ++id)
+	{
+		if ((mask & (ComponentMask(1) << id)) == 0) { continue; }
+
+		_slots[id] = static_cast<uint8>(_componentTypes.Size());
+		_componentTypes.Push(id);
+		_sizes.Push(ComponentRegistry::GetInfo(id).Size);
+		rowByteSize += ComponentRegistry::GetInfo(id).Size;
+	}
+	_offsets.Resize(_componentTypes.Size());
+
+	/*-------------------------------------------------------------------
+	-      ACg̗]܂߂ă`NɎ܂܂ōs炵܂
+	---------------------------------------------------------------------*/
+	_chunkCapacity = CHUNK_BYTE_SIZE / rowByteSize;
+	for (; _chunkCapacity > 0; --_chunkCapacity)
+	{
+		uint32 offset = static_cast<uint32>(sizeof(Entity)) * _chunkCapacity;
+		for (uint64 slot = 0; slot < _componentTypes.Size(); ++slot)
+		{
+			offset = AlignUp(offset, ComponentRegistry::GetInfo(_componentTypes[slot]).Alignment);
+			_offsets[slot] = offset;
+			offset += _sizes[slot] * _chunkCapacity;
+		}
+		if (offset <= CHUNK_BYTE_SIZE) { break; }
+	}
+	Check(_chunkCapacity > 0); // 1s16KB𒴂R|[lg̑gݍ킹͊i[ł܂
+}
+
+Archetype::~Archetype()
+{
+	for (uint64 i = 0; i < _chunks.Size(); ++i)
+	{
+		Memory::FreeAligned(_chunks[i]);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     1sǉ, GeBeB݂܂.
+*  @param[in] const Entity ǉGeBeB
+*  @return    gu::uint32 ǉsԍ
+*************************************************************************/
+uint32 Archetype::AddRow(const Entity entity)
+{
+	const uint32 row = _rowCount;
+	const uint32 chunkIndex = row / _chunkCapacity;
+	if (chunkIndex >= _chunks.Size())
+	{
+		MEMORY_TAG_SCOPE(MemoryTag::GameObject);
+		_chunks.Push(static_cast<uint8*>(Memory::AllocateAligned(CHUNK_BYTE_SIZE, CHUNK_ALIGNMENT)));
+	}
+
+	GetEntities(chunkIndex)[row % _chunkCapacity] = entity;
+	++_rowCount;
+	return row;
+}
+
+/*!**********************************************************************
+*  @brief     w肵s폜, ̍sŖ߂܂.
+*  @param[in] const gu::uint32 폜sԍ
+*  @return    Entity 폜sֈړGeBeB
+*************************************************************************/
+Entity Archetype::RemoveRow(const uint32 row)
+{
+	Check(row < _rowCount);
+
+	const uint32 lastRow = --_rowCount;
+	if (row == lastRow) { return Entity(); }
+
+	uint8* destination = _chunks[row     / _chunkCapacity];
+	uint8* source      = _chunks[lastRow / _chunkCapacity];
+	const uint32 destinationIndex = row     % _chunkCapacity;
+	const uint32 sourceIndex      = lastRow % _chunkCapacity;
+
+	Entity* destinationEntities = reinterpret_cast<Entity*>(destination);
+	Entity* sourceEntities      = reinterpret_cast<Entity*>(source);
+	destinationEntities[destinationIndex] = sourceEntities[sourceIndex];
+
+	for (uint64 slot = 0; slot < _componentTypes.Size(); ++slot)
+	{
+		const uint32 size = _sizes[slot];
+		Memory::Copy(destination + _offsets[slot] + static_cast<uint64>(destinationIndex) * size,
+			         source      + _offsets[slot] + static_cast<uint64>(sourceIndex)      * size, size);
+	}
+	return destinationEntities[destinationIndex];
+}
+
+/*!**********************************************************************
+*  @brief     ̃A[L^CvR|[lg̒l, ʂ̃A[L^Cv̍sփRs[܂.
+*  @param[in] const gu::uint32 Rs[̍sԍ
+*  @param[in] Archetype& Rs[̃A[L^Cv
+*  @param[in] const gu::uint32 Rs[̍sԍ
+*  @return    void
+*************************************************************************/
+void Archetype::CopyRowTo(const uint32 sourceRow, Archetype& destination, const uint32 destinationRow) const
+{
+	for (uint64 slot = 0; slot < _componentTypes.Size(); ++slot)
+	{
+		void* target = destination.GetComponent(destinationRow, _componentTypes[slot]);
+		if (target == nullptr) { continue; }
+
+		Memory::Copy(target, GetComponent(sourceRow, _componentTypes[slot]), _sizes[slot]);
+	}
+}
+#pragma endregion Archetype
@@ -0,0 +1,151 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ECSWorld.cpp
+///  @brief  GeBeBƃA[L^CvǗ, R|[lg̑gݍ킹ōi荞񂾃NGs܂.
+///  @author toide
+///  @date   2026/10/20 4:05:51
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/ECSWorld.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine::ecs;
+using namespace gu;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Constructor and Destructor
+World::~World()
+{
+	for (uint64 i = 0; i < _archetypes.Size(); ++i)
+	{
+		delete _archetypes[i];
+	}
+}
+#pragma endregion Public Constructor and Destructor
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     GeBeBj܂. 󂢂s͖̍sŖ, CfbNX͐i߂čėp܂.
+*  @param[in] const Entity jGeBeB
+*  @return    bool ĂGeBeBjꍇtrue
+*************************************************************************/
+bool World::DestroyEntity(const Entity entity)
+{
+	CheckNotIterating();
+	if (!IsAlive(entity)) { return false; }
+
+	auto& record = _records[entity.Index];
+	const Entity moved = record.Archetype->RemoveRow(record.Row);
+	if (moved.IsValid()) { _records[moved.Index].Row = record.Row; }
+
+	record.Archetype = nullptr;
+	record.Row       = 0;
+	record.Generation = record.Generation == UINT32_MAX ? 1 : record.Generation + 1; // 0͖ȃnhɎgp邽ߔ΂܂
+	_freeIndices.Push(entity.Index);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     SẴGeBeBj܂. A[L^Cvƃ`N͍ėp̂ߎc܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void World::Clear()
+{
+	CheckNotIterating();
+
+	for (uint64 i = 0; i < _archetypes.Size(); ++i)
+	{
+		_archetypes[i]->Clear();
+	}
+
+	_freeIndices.Clear();
+	for (uint64 i = 0; i < _records.Size(); ++i)
+	{
+		auto& record = _records[i];
+		if (record.Archetype != nullptr)
+		{
+			record.Archetype  = nullptr;
+			record.Generation = record.Generation == UINT32_MAX ? 1 : record.Generation + 1;
+		}
+		_freeIndices.Push(static_cast<uint32>(i));
+	}
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     rbg}XNɈvA[L^CvԂ܂. ꍇ͍쐬܂. @n
+*             A[L^Cv̐͏Ȃ, 쐬͕ωȂߐ`TŌ܂.
+*************************************************************************/
+Archetype* World::GetOrCreateArchetype(const ComponentMask mask)
+{
+	for (uint64 i = 0; i < _archetypes.Size(); ++i)
+	{
+		if (_archetypes[i]->GetMask() == mask) { return _archetypes[i]; }
+	}
+
+	MEMORY_TAG_SCOPE(MemoryTag::GameObject);
+	Archetype* archetype = new Archetype(mask);
+	_archetypes.Push(archetype);
+	return archetype;
+}
+
+/*!**********************************************************************
+*  @brief     CfbNX蓖, A[L^CvɍsǉGeBeBԂ܂.
+*************************************************************************/
+Entity World::AllocateEntity(Archetype* archetype)
+{
+	Entity entity = {};
+	if (_freeIndices.IsEmpty())
+	{
+		entity.Index = static_cast<uint32>(_records.Size());
+		_records.Push(EntityRecord());
+	}
+	else
+	{
+		entity.Index = _freeIndices.Back();
+		_freeIndices.Pop();
+	}
+
+	auto& record = _records[entity.Index];
+	entity.Generation = record.Generation;
+	record.Archetype  = archetype;
+	record.Row        = archetype->AddRow(entity);
+	return entity;
+}
+
+/*!**********************************************************************
+*  @brief     R|[lgǉ, 폜A[L^CvփGeBeBړ܂.
+*  @return    Archetype* ړ̃A[L^Cv
+*************************************************************************/
+Archetype* World::ChangeArchetype(const Entity entity, const ComponentMask addMask, const ComponentMask removeMask)
+{
+	CheckNotIterating();
+	if (!IsAlive(entity)) { return nullptr; }
+
+	auto& record = _records[entity.Index];
+	Archetype* source = record.Archetype;
+
+	const ComponentMask mask = (source->GetMask() | addMask) & ~removeMask;
+	if (mask == source->GetMask()) { return addMask != 0 ? source : nullptr; }
+
+	Archetype* destination = GetOrCreateArchetype(mask);
+	const uint32 row = destination->AddRow(entity);
+	source->CopyRowTo(record.Row, *destination, row);
+
+	const Entity moved = source->RemoveRow(record.Row);
+	if (moved.IsValid()) { _records[moved.Index].Row = record.Row; }
+
+	record.Archetype = destination;
+	record.Row       = row;
+	return destination;
+}
+#pragma endregion Protected Function
@@ -137,8 +137,7 @@ void GBuffer::PreparePipelineState(const gu::tstring& name)
 	_pipeline->SetDepthStencilState (factory->CreateDepthStencilState());
 	_pipeline->SetVertexShader(vs);
 	_pipeline->SetPixelShader(ps);
-	_pipeline->CompleteSetting();
-	_pipeline->SetName(name + SP("PSO"));
+	_pipeline->CompleteSettingAsync(name + SP("PSO"), nullptr);
 }
 
 /****************************************************************************
@@ -0,0 +1,194 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   FrustumCuller.hpp
+///  @brief  o^oEfBO{[ɑ΂, ̃r[(CJ, VhEJXP[hȂ)̎JO܂Ƃ߂čs܂. @n
+///          oEfBO{[SoA`ŕێ, Sr[̔1̑ōs܂.
+///  @author toide
+///  @date   2026/10/19 22:48:12
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef FRUSTUM_CULLER_HPP
+#define FRUSTUM_CULLER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMCulling.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	class Camera;
+	class CascadeShadow;
+
+	/****************************************************************************
+	*				  			   FrustumCuller
+	****************************************************************************/
+	/* @brief  o^oEfBO{[ɑ΂, ̃r[̎JO܂Ƃ߂čs܂. @n
+	*          ExecuteĂԂ, r[Ƃɉ̃IuWFNg̃CfbNX(o^)Ol߂Ŋi[܂.
+	*****************************************************************************/
+	class FrustumCuller : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     o^ꂽSẴr[ɑ΂ĎJOs܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Execute();
+
+		/*!**********************************************************************
+		*  @brief     ̃oEfBO{[o^܂.
+		*  @param[in] const gm::BoundingSphere& [hԂ̋
+		*  @return    gu::uint32 ̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddSphere(const gm::BoundingSphere& sphere) { return _spheres.Push(sphere); }
+
+		/*!**********************************************************************
+		*  @brief     AABB̃oEfBO{[o^܂.
+		*  @param[in] const gm::BoundingBox& [hԂAABB
+		*  @return    gu::uint32 AABB̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddBox(const gm::BoundingBox& box) { return _boxes.Push(box); }
+
+		/*!**********************************************************************
+		*  @brief     [JԂAABB[hsŕϊ, ރ[hԂAABBƂēo^܂.
+		*  @param[in] const gm::BoundingBox& [JԂAABB
+		*  @param[in] const gm::Float4x4& [hs (sxNg`)
+		*  @return    gu::uint32 AABB̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddBox(const gm::BoundingBox& localBox, const gm::Float4x4& world);
+
+		/*!**********************************************************************
+		*  @brief     o^ς݂̋XV܂. (IuWFNgړȂǂɎgp܂)
+		*  @param[in] const gu::uint32 AddSphereŎ擾CfbNX
+		*  @param[in] const gm::BoundingSphere& [hԂ̋
+		*  @return    void
+		*************************************************************************/
+		void UpdateSphere(const gu::uint32 index, const gm::BoundingSphere& sphere) { _spheres.Set(index, sphere); }
+
+		/*!**********************************************************************
+		*  @brief     o^ς݂AABBXV܂.
+		*  @param[in] const gu::uint32 AddBoxŎ擾CfbNX
+		*  @param[in] const gm::BoundingBox& [hԂAABB
+		*  @return    void
+		*************************************************************************/
+		void UpdateBox(const gu::uint32 index, const gm::BoundingBox& box) { _boxes.Set(index, box); }
+
+		/*!**********************************************************************
+		*  @brief     o^ꂽoEfBO{[SĔj܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void ClearObjects();
+
+		/*!**********************************************************************
+		*  @brief     JView * Projectionr[ǉ܂.
+		*  @param[in] const Camera& J
+		*  @return    gu::uint32 r[̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddView(const Camera& camera);
+
+		/*!**********************************************************************
+		*  @brief     View * Projections񂩂r[ǉ܂.
+		*  @param[in] const gm::Float4x4& r[vWFNVs
+		*  @return    gu::uint32 r[̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddView(const gm::Float4x4& viewProjection);
+
+		/*!**********************************************************************
+		*  @brief     ViewsProjections񂩂r[ǉ܂. (RenderSnapshot̃JȂǂɎgp܂)
+		*  @param[in] const gm::Float4x4& r[s
+		*  @param[in] const gm::Float4x4& vWFNVs
+		*  @return    gu::uint32 r[̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddView(const gm::Float4x4& view, const gm::Float4x4& projection);
+
+		/*!**********************************************************************
+		*  @brief     VhE}bv̊eJXP[hr[ƂĒǉ܂. @n
+		*             ߂l͍ŏ̃JXP[h̃r[CfbNX, ȍ~͘AԂɂȂ܂.
+		*  @param[in] const CascadeShadow& JXP[hVhE
+		*  @return    gu::uint32 ŏ̃JXP[h̃r[CfbNX
+		*************************************************************************/
+		gu::uint32 AddShadowCascadeViews(const CascadeShadow& shadow);
+
+		/*!**********************************************************************
+		*  @brief     o^ꂽr[SĔj܂. t[̃r[o^OɌĂяoĂ.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void ClearViews();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief o^Ăr[̐*/
+		__forceinline gu::uint32 GetViewCount() const { return static_cast<gu::uint32>(_views.Size()); }
+
+		/*! @brief o^Ă鋅̐*/
+		__forceinline gu::uint64 GetSphereCount() const { return _spheres.Size(); }
+
+		/*! @brief o^ĂAABB̐*/
+		__forceinline gu::uint64 GetBoxCount() const { return _boxes.Size(); }
+
+		/*! @brief w肵r[ŉƂȂ̃CfbNXz (擪GetVisibleSphereCountLł)*/
+		__forceinline const gu::uint32* GetVisibleSphereIndices(const gu::uint32 view) const { Check(view < GetViewCount()); return _visibleSpheres[view].Data(); }
+
+		/*! @brief w肵r[ŉƂȂ̐*/
+		__forceinline gu::uint64 GetVisibleSphereCount(const gu::uint32 view) const { Check(view < GetViewCount()); return _visibleSphereCounts[view]; }
+
+		/*! @brief w肵r[ŉƂȂAABB̃CfbNXz (擪GetVisibleBoxCountLł)*/
+		__forceinline const gu::uint32* GetVisibleBoxIndices(const gu::uint32 view) const { Check(view < GetViewCount()); return _visibleBoxes[view].Data(); }
+
+		/*! @brief w肵r[ŉƂȂAABB̐*/
+		__forceinline gu::uint64 GetVisibleBoxCount(const gu::uint32 view) const { Check(view < GetViewCount()); return _visibleBoxCounts[view]; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		FrustumCuller() = default;
+
+		/*! @brief fXgN^*/
+		~FrustumCuller() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*!**********************************************************************
+		*  @brief     o͐̃obt@IuWFNgȏ̑傫Ɋmۂ, ݐ̃|C^z쐬܂.
+		*  @param[in] gu::DynamicArray<gu::DynamicArray<gu::uint32>>& r[Ƃ̏o̓obt@
+		*  @param[in] const gu::uint64 IuWFNg
+		*  @return    void
+		*************************************************************************/
+		void PrepareOutput(gu::DynamicArray<gu::DynamicArray<gu::uint32>>& outputs, const gu::uint64 objectCount);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief SoA`̃oEfBO{[*/
+		gm::BoundingSphereArray _spheres = {};
+		gm::BoundingBoxArray    _boxes   = {};
+
+		/*! @brief s*/
+		gu::DynamicArray<gm::FrustumPlanes> _views = {};
+
+		/*! @brief r[Ƃ̉CfbNX*/
+		gu::DynamicArray<gu::DynamicArray<gu::uint32>> _visibleSpheres = {};
+		gu::DynamicArray<gu::DynamicArray<gu::uint32>> _visibleBoxes   = {};
+
+		/*! @brief r[Ƃ̉*/
+		gu::DynamicArray<gu::uint64> _visibleSphereCounts = {};
+		gu::DynamicArray<gu::uint64> _visibleBoxCounts    = {};
+
+		/*! @brief JO֐ɓnݐ̃|C^z (t[̊mۂ邽߂ɕێĂ܂)*/
+		gu::DynamicArray<gu::uint32*> _outputPointers = {};
+		#pragma endregion
+	};
+}
+#endif
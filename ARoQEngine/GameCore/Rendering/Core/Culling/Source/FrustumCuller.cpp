@@ -0,0 +1,176 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   FrustumCuller.cpp
+///  @brief  o^oEfBO{[ɑ΂, ̃r[(CJ, VhEJXP[hȂ)̎JO܂Ƃ߂čs܂.
+///  @author toide
+///  @date   2026/10/19 22:48:12
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/FrustumCuller.hpp"
+#include "GameCore/Core/Include/Camera.hpp"
+#include "GameCore/Rendering/Light/Include/CascadeShadow.hpp"
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine;
+using namespace gu;
+using namespace gm;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     o^ꂽSẴr[ɑ΂ĎJOs܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void FrustumCuller::Execute()
+{
+	const auto viewCount = GetViewCount();
+	if (viewCount == 0) { return; }
+
+	_visibleSphereCounts.Clear();
+	_visibleSphereCounts.Resize(viewCount, true, 0);
+	_visibleBoxCounts.Clear();
+	_visibleBoxCounts.Resize(viewCount, true, 0);
+
+	/*-------------------------------------------------------------------
+	-        ̔ (Sr[1̑Ŕ肵܂)
+	---------------------------------------------------------------------*/
+	PrepareOutput(_visibleSpheres, _spheres.Size());
+	FrustumCulling::CullSpheres(_views.Data(), viewCount, _spheres, _outputPointers.Data(), _visibleSphereCounts.Data());
+
+	/*-------------------------------------------------------------------
+	-        AABB̔
+	---------------------------------------------------------------------*/
+	PrepareOutput(_visibleBoxes, _boxes.Size());
+	FrustumCulling::CullBoxes(_views.Data(), viewCount, _boxes, _outputPointers.Data(), _visibleBoxCounts.Data());
+}
+
+/*!**********************************************************************
+*  @brief     o^ꂽoEfBO{[SĔj܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void FrustumCuller::ClearObjects()
+{
+	_spheres.Clear();
+	_boxes  .Clear();
+}
+
+/*!**********************************************************************
+*  @brief     [JԂAABB[hsŕϊ, ރ[hԂAABBƂēo^܂. @n
+*             S͍sŕϊ, a͉]g听̐Βlŕϊ܂.
+*  @param[in] const gm::BoundingBox& [JԂAABB
+*  @param[in] const gm::Float4x4& [hs (sxNg`)
+*  @return    gu::uint32 AABB̃CfbNX
+*************************************************************************/
+gu::uint32 FrustumCuller::AddBox(const gm::BoundingBox& localBox, const gm::Float4x4& world)
+{
+	const auto& m = world.u.m;
+	const auto& c = localBox.Center;
+	const auto& e = localBox.Extents;
+
+	const Float3 center
+	(
+		c.x * m[0][0] + c.y * m[1][0] + c.z * m[2][0] + m[3][0],
+		c.x * m[0][1] + c.y * m[1][1] + c.z * m[2][1] + m[3][1],
+		c.x * m[0][2] + c.y * m[1][2] + c.z * m[2][2] + m[3][2]
+	);
+
+	const Float3 extents
+	(
+		e.x * std::fabs(m[0][0]) + e.y * std::fabs(m[1][0]) + e.z * std::fabs(m[2][0]),
+		e.x * std::fabs(m[0][1]) + e.y * std::fabs(m[1][1]) + e.z * std::fabs(m[2][1]),
+		e.x * std::fabs(m[0][2]) + e.y * std::fabs(m[1][2]) + e.z * std::fabs(m[2][2])
+	);
+
+	return _boxes.Push(BoundingBox(center, extents));
+}
+
+/*!**********************************************************************
+*  @brief     JView * Projectionr[ǉ܂.
+*  @param[in] const Camera& J
+*  @return    gu::uint32 r[̃CfbNX
+*************************************************************************/
+gu::uint32 FrustumCuller::AddView(const Camera& camera)
+{
+	_views.Push(camera.GetFrustumPlanes());
+	return static_cast<uint32>(_views.Size() - 1);
+}
+
+/*!**********************************************************************
+*  @brief     View * Projections񂩂r[ǉ܂.
+*  @param[in] const gm::Float4x4& r[vWFNVs
+*  @return    gu::uint32 r[̃CfbNX
+*************************************************************************/
+gu::uint32 FrustumCuller::AddView(const gm::Float4x4& viewProjection)
+{
+	_views.Push(FrustumPlanes::FromViewProjection(viewProjection));
+	return static_cast<uint32>(_views.Size() - 1);
+}
+
+/*!**********************************************************************
+*  @brief     ViewsProjections񂩂r[ǉ܂.
+*  @param[in] const gm::Float4x4& r[s
+*  @param[in] const gm::Float4x4& vWFNVs
+*  @return    gu::uint32 r[̃CfbNX
+*************************************************************************/
+gu::uint32 FrustumCuller::AddView(const gm::Float4x4& view, const gm::Float4x4& projection)
+{
+	return AddView((Matrix4f(view) * Matrix4f(projection)).ToFloat4x4());
+}
+
+/*!**********************************************************************
+*  @brief     VhE}bv̊eJXP[hr[ƂĒǉ܂.
+*  @param[in] const CascadeShadow& JXP[hVhE
+*  @return    gu::uint32 ŏ̃JXP[h̃r[CfbNX
+*************************************************************************/
+gu::uint32 FrustumCuller::AddShadowCascadeViews(const CascadeShadow& shadow)
+{
+	const auto firstView = static_cast<uint32>(_views.Size());
+	for (size_t i = 0; i < CascadeShadow::GetCascadeCount(); ++i)
+	{
+		AddView(shadow.GetCascadeViewProjection(i));
+	}
+	return firstView;
+}
+
+/*!**********************************************************************
+*  @brief     o^ꂽr[SĔj܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void FrustumCuller::ClearViews()
+{
+	_views.Clear();
+}
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     o͐̃obt@IuWFNgȏ̑傫Ɋmۂ, ݐ̃|C^z쐬܂.
+*  @param[in] gu::DynamicArray<gu::DynamicArray<gu::uint32>>& r[Ƃ̏o̓obt@
+*  @param[in] const gu::uint64 IuWFNg
+*  @return    void
+*************************************************************************/
+void FrustumCuller::PrepareOutput(gu::DynamicArray<gu::DynamicArray<gu::uint32>>& outputs, const gu::uint64 objectCount)
+{
+	const auto viewCount = GetViewCount();
+
+	// Resize͊ĝ݂s, xmۂobt@͎t[ȍ~ėp܂.
+	outputs.Resize(viewCount);
+
+	_outputPointers.Clear();
+	for (uint32 i = 0; i < viewCount; ++i)
+	{
+		outputs[i].Resize(objectCount, false);
+		_outputPointers.Push(outputs[i].Data());
+	}
+}
+#pragma endregion Protected Function
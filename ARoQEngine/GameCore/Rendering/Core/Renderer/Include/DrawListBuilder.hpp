@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DrawListBuilder.hpp
+///  @brief  `vf64bit̃\[gL[ŕёւ, bVƃ}eAvfCX^X`ɂ܂Ƃ߂܂.
+///  @author toide
+///  @date   2026/10/20 19:24:10
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DRAW_LIST_BUILDER_HPP
+#define DRAW_LIST_BUILDER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHITypeCore.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMMatrix.hpp"
+#include "DrawListSorter.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class LowLevelGraphicsEngine;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	class Mesh;
+	class Material;
+
+	/****************************************************************************
+	*				  			DrawInstanceData
+	****************************************************************************/
+	/* @brief  CX^XƂɒ_obt@̃Xbg1nf[^ł. @n
+	*          VF[_[łINSTANCE_WORLD0`3ƂĎ󂯎܂.
+	*****************************************************************************/
+	struct DrawInstanceData
+	{
+		/*! @brief [hs (GameWorldConstant::WorldƓ)*/
+		gm::Float4x4 World;
+	};
+
+	/****************************************************************************
+	*				  			DrawListBuilder
+	****************************************************************************/
+	/* @brief  `vfDrawListSorter̃\[gL[ŕёւ, pX烁bV܂łvvf̘A1̃CX^X`ɂ܂Ƃ߂܂. @n
+	*          CX^X̃f[^̓t[Ƃ̒_obt@ɕёւŏ, StartInstanceLocationŎQƈʒuw肵܂. @n
+	*          `悷pCvC̓CX^Xf[^Xbg1󂯎Kv܂.
+	*****************************************************************************/
+	class DrawListBuilder : public gu::NonCopyable
+	{
+		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
+
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     `vfSĎ菜, Vt[̕`惊Xg̍쐬n߂܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Begin();
+
+		/*!**********************************************************************
+		*  @brief     `vfǉ܂. }eAȂbV͕`悳܂.
+		*  @param[in] const gu::uint8 `pX (0`15)
+		*  @param[in] const gu::uint16 pCvC̔ԍ (0`4095)
+		*  @param[in] Mesh* bV
+		*  @param[in] Material* }eA
+		*  @param[in] const gm::Float4x4& [hs
+		*  @param[in] const float J̋. bV̒ŎO`悳܂
+		*  @return    void
+		*************************************************************************/
+		void Add(const gu::uint8 pass, const gu::uint16 pipeline, Mesh* mesh, Material* material, const gm::Float4x4& world, const float viewDepth);
+
+		/*!**********************************************************************
+		*  @brief     \[gL[ŕёւ, CX^X`ɂ܂Ƃ߂܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Build();
+
+		/*!**********************************************************************
+		*  @brief     CX^Xf[^, ܂Ƃ߂`R}hXgɐς݂܂. @n
+		*             \[XCAEgƃpCvC͌ĂяoŐݒ肵Ă.
+		*  @param[in] const gu::SharedPointer<rhi::core::RHICommandList>& GraphicsR}hXg
+		*  @param[in] const gu::uint32 t[ԍ
+		*  @param[in] const gu::uint32 }eA̒萔obt@ݒ肷郋[gp[^̔ԍ (eNX`͑ԍɐݒ肳܂)
+		*  @return    void
+		*************************************************************************/
+		void Record(const gu::SharedPointer<rhi::core::RHICommandList>& commandList, const gu::uint32 frameIndex, const gu::uint32 materialOffsetID);
+
+		/*!**********************************************************************
+		*  @brief     ёւ̃CX^Xf[^t[ԍ̒_obt@ɏ݂܂. @n
+		*             ͈͂w肷RecordɌĂяoO, ĂяõXbh1xĂяoĂ.
+		*  @param[in] const gu::uint32 t[ԍ
+		*  @return    void
+		*************************************************************************/
+		void UploadInstances(const gu::uint32 frameIndex);
+
+		/*!**********************************************************************
+		*  @brief     ܂Ƃ߂` [begin, end) R}hXgɐς݂܂. قȂR}hXg֓ɌĂяo܂. @n
+		*             CX^Xf[^UploadInstancesŏłĂ.
+		*  @param[in] const gu::SharedPointer<rhi::core::RHICommandList>& GraphicsR}hXg
+		*  @param[in] const gu::uint32 t[ԍ
+		*  @param[in] const gu::uint32 }eA̒萔obt@ݒ肷郋[gp[^̔ԍ
+		*  @param[in] const gu::uint32 擪̕`̔ԍ
+		*  @param[in] const gu::uint32 I[̕`̔ԍ (܂܂Ȃ)
+		*  @return    void
+		*************************************************************************/
+		void Record(const gu::SharedPointer<rhi::core::RHICommandList>& commandList, const gu::uint32 frameIndex, const gu::uint32 materialOffsetID, const gu::uint32 begin, const gu::uint32 end) const;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief OBuild`惊Xg̓v*/
+		__forceinline const DrawListStatistics& GetStatistics() const noexcept { return _sorter.GetStatistics(); }
+
+		/*! @brief ʎq[x̍ől. 艓vf͓[xƂĈ܂*/
+		__forceinline void SetMaxViewDepth(const float maxViewDepth) noexcept { _sorter.SetMaxViewDepth(maxViewDepth); }
+
+		/*! @brief ǉꂽ`vf̐*/
+		__forceinline gu::uint64 GetItemCount() const noexcept { return _items.Size(); }
+
+		/*! @brief OBuild܂Ƃ߂`̐*/
+		__forceinline gu::uint32 GetBatchCount() const noexcept { return static_cast<gu::uint32>(_batches.Size()); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief GWw肵ď܂*/
+		explicit DrawListBuilder(const LowLevelGraphicsEnginePtr& engine);
+
+		/*! @brief fXgN^*/
+		~DrawListBuilder();
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief t[ԍ̃CX^Xobt@ɕKvȗeʂmۂ܂*/
+		void PrepareInstanceBuffer(const gu::uint32 frameIndex, const gu::uint64 instanceCount);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ǉꂽ`vf*/
+		struct DrawItem
+		{
+			Mesh*        DrawMesh     = nullptr;
+			Material*    DrawMaterial = nullptr;
+			gm::Float4x4 World        = {};
+		};
+
+		/*! @brief ܂Ƃ߂`*/
+		struct DrawBatch
+		{
+			Mesh*      DrawMesh      = nullptr;
+			Material*  DrawMaterial  = nullptr;
+			gu::uint32 FirstInstance = 0;
+			gu::uint32 InstanceCount = 0;
+		};
+
+		/*! @brief GW*/
+		LowLevelGraphicsEnginePtr _engine = nullptr;
+
+		/*! @brief ǉꂽ`vf*/
+		gu::DynamicArray<DrawItem> _items = {};
+
+		/*! @brief ёւƂ܂Ƃ߂͈͂̌vZ*/
+		DrawListSorter _sorter = {};
+
+		/*! @brief ܂Ƃ߂`*/
+		gu::DynamicArray<DrawBatch> _batches = {};
+
+		/*! @brief ёւ̃CX^Xf[^*/
+		gu::DynamicArray<DrawInstanceData> _instances = {};
+
+		/*! @brief t[Ƃ̃CX^Xf[^̒_obt@ (iIMap܂)*/
+		gu::DynamicArray<gu::SharedPointer<rhi::core::GPUBuffer>> _instanceBuffers = {};
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,192 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DrawListSorter.hpp
+///  @brief  `vf64bit̃\[gL[ŕёւ, bVƃ}eAvf܂Ƃ߂͈͂߂܂. @n
+///          bVGPU\[Xɂ͐GȂ, CPÛ݂Ōʂ؂ł܂.
+///  @author toide
+///  @date   2026/10/23 14:08:52
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DRAW_LIST_SORTER_HPP
+#define DRAW_LIST_SORTER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	/****************************************************************************
+	*				  			DrawListStatistics
+	****************************************************************************/
+	/* @brief  `惊Xg̍\zʂł. Naive͒ǉ1vf`悵ꍇ̒lł.
+	*****************************************************************************/
+	struct DrawListStatistics
+	{
+		/*! @brief ǉꂽ`vf̐*/
+		gu::uint32 ItemCount = 0;
+
+		/*! @brief sh[R[̐*/
+		gu::uint32 DrawCallCount = 0;
+
+		/*! @brief ǉɕ`悵ꍇ̃h[R[̐*/
+		gu::uint32 NaiveDrawCallCount = 0;
+
+		/*! @brief WIg(_, CfbNXobt@)ƃ}eA̐؂ւ*/
+		gu::uint32 StateChangeCount = 0;
+
+		/*! @brief ǉɕ`悵ꍇ̃WIgƃ}eA̐؂ւ*/
+		gu::uint32 NaiveStateChangeCount = 0;
+
+		/*! @brief ёւƂ܂Ƃ߂Ɋ|CPU [ms]*/
+		double BuildMilliseconds = 0.0;
+	};
+
+	/****************************************************************************
+	*				  			DrawListSorter
+	****************************************************************************/
+	/* @brief  `vf\[gL[ (ʂpX4bit, pCvC12bit, }eA16bit, bV16bit, ʎq[x16bit)ŕёւ܂. @n
+	*          ёւɂRadixSortg, pX烁bV܂łƃbV, }eÃ|C^vvf̘A1̂܂Ƃ܂ɂ܂. @n
+	*          bVƃ}eA̓|C^̓ꐫ݂̂g, `ɕKvȃ\[XDrawListBuilder܂.
+	*****************************************************************************/
+	class DrawListSorter : public gu::NonCopyable
+	{
+	public:
+		/*! @brief ёւvf̘Â, 1̃CX^X`ɂ܂Ƃ߂͈*/
+		struct Batch
+		{
+			/*! @brief ёւł̐擪̈ʒu (CX^X̊Jnʒu)*/
+			gu::uint32 FirstInstance = 0;
+
+			/*! @brief ܂Ƃ߂vf̐*/
+			gu::uint32 InstanceCount = 0;
+
+			/*! @brief 擪̗vf̒ǉ̔ԍ*/
+			gu::uint32 Item = 0;
+		};
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     `vfSĎ菜܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     `vfǉ܂. ǉ0ԍU܂.
+		*  @param[in] const gu::uint8 `pX (0`15)
+		*  @param[in] const gu::uint16 pCvC̔ԍ (0`4095)
+		*  @param[in] const void* bV
+		*  @param[in] const void* WIg (CfbNXobt@). ؂ւ񐔂̌vZɎg܂
+		*  @param[in] const void* }eA
+		*  @param[in] const float J̋. bV̒ŎOт܂
+		*  @return    void
+		*************************************************************************/
+		void Add(const gu::uint8 pass, const gu::uint16 pipeline, const void* mesh, const void* geometry, const void* material, const float viewDepth);
+
+		/*!**********************************************************************
+		*  @brief     \[gL[ŕёւ, ܂Ƃ߂͈͂Ɠv߂܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Build();
+
+		/*!**********************************************************************
+		*  @brief     64bit̃\[gL[쐬܂.
+		*  @param[in] const gu::uint8 `pX (0`15)
+		*  @param[in] const gu::uint16 pCvC̔ԍ (0`4095)
+		*  @param[in] const gu::uint16 }eA̔ԍ
+		*  @param[in] const gu::uint16 bV̔ԍ
+		*  @param[in] const gu::uint16 ʎq[x
+		*  @return    gu::uint64 \[gL[
+		*************************************************************************/
+		static constexpr gu::uint64 MakeSortKey(const gu::uint8 pass, const gu::uint16 pipeline, const gu::uint16 material, const gu::uint16 mesh, const gu::uint16 depth) noexcept
+		{
+			return (static_cast<gu::uint64>(pass     & 0xF)   << 60) |
+			       (static_cast<gu::uint64>(pipeline & 0xFFF) << 48) |
+			       (static_cast<gu::uint64>(material)         << 32) |
+			       (static_cast<gu::uint64>(mesh)             << 16) |
+			        static_cast<gu::uint64>(depth);
+		}
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief OBuildʂ̓v*/
+		__forceinline const DrawListStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/*! @brief ʎq[x̍ől. 艓vf͓[xƂĈ܂*/
+		__forceinline void SetMaxViewDepth(const float maxViewDepth) noexcept { _maxViewDepth = maxViewDepth; }
+
+		/*! @brief ǉꂽ`vf̐*/
+		__forceinline gu::uint64 GetItemCount() const noexcept { return _items.Size(); }
+
+		/*! @brief OBuild, ёւ̃\[gL[*/
+		__forceinline const gu::DynamicArray<gu::uint64>& GetSortedKeys() const noexcept { return _keys; }
+
+		/*! @brief OBuild, ёւ̗vf̔ԍ (ǉ̔ԍ)*/
+		__forceinline const gu::DynamicArray<gu::uint32>& GetOrder() const noexcept { return _order; }
+
+		/*! @brief OBuild܂Ƃ܂*/
+		__forceinline const gu::DynamicArray<Batch>& GetBatches() const noexcept { return _batches; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		DrawListSorter() = default;
+
+		/*! @brief fXgN^*/
+		~DrawListSorter() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief |C^ɑ΂ăt[ňӂȔԍԂ܂*/
+		static gu::uint16 GetObjectID(std::unordered_map<const void*, gu::uint16>& ids, const void* object);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ǉꂽ`vf (|C^̓ꐫ݂̂g܂)*/
+		struct Item
+		{
+			const void* DrawMesh     = nullptr;
+			const void* DrawGeometry = nullptr;
+			const void* DrawMaterial = nullptr;
+		};
+
+		/*! @brief ǉꂽ`vf*/
+		gu::DynamicArray<Item> _items = {};
+
+		/*! @brief \[gL[ƕёւp̍Ɨ̈*/
+		gu::DynamicArray<gu::uint64> _keys      = {};
+		gu::DynamicArray<gu::uint64> _keyBuffer = {};
+
+		/*! @brief ёւvf̔ԍƕёւp̍Ɨ̈*/
+		gu::DynamicArray<gu::uint32> _order       = {};
+		gu::DynamicArray<gu::uint32> _orderBuffer = {};
+
+		/*! @brief ܂Ƃ߂͈*/
+		gu::DynamicArray<Batch> _batches = {};
+
+		/*! @brief }eA, bṼt[̔ԍ*/
+		std::unordered_map<const void*, gu::uint16> _materialIDs = {};
+		std::unordered_map<const void*, gu::uint16> _meshIDs     = {};
+
+		/*! @brief ʎq[x̍ől*/
+		float _maxViewDepth = 1000.0f;
+
+		/*! @brief OBuildʂ̓v*/
+		DrawListStatistics _statistics = {};
+		#pragma endregion
+	};
+}
+#endif
@@ -13,11 +13,23 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "RenderPipeline.hpp"
 #include "GameCore/Rendering/Light/Include/SceneLightBuffer.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
 #include <vector>
+#include <chrono>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 class GameTimer;
+namespace rhi::core
+{
+	class GPUTexture;
+	class RHICommandList;
+}
+namespace rhi::graph
+{
+	class RenderGraph;
+	struct RenderGraphStatistics;
+}
 namespace engine
 {
 	class SSAO;
@@ -27,6 +39,9 @@ namespace engine
 	class LightCulling;
 	class GBuffer;
 	class CascadeShadow;
+	class DrawListBuilder;
+	struct DrawListStatistics;
+	class FrustumCuller;
 }
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -56,6 +71,11 @@ namespace engine
 		using SSAOPtr         = gu::SharedPointer<SSAO>;
 		using ShadowMapPtr    = gu::SharedPointer<CascadeShadow>;
 		using DirectionalLightPtr = gu::SharedPointer<SceneLightBuffer<DirectionalLightData>>;
+		using RenderGraphPtr  = gu::SharedPointer<rhi::graph::RenderGraph>;
+		using TexturePtr      = gu::SharedPointer<rhi::core::GPUTexture>;
+		using DrawListBuilderPtr = gu::SharedPointer<DrawListBuilder>;
+		using FrustumCullerPtr   = gu::SharedPointer<FrustumCuller>;
+		using CommandListPtr  = gu::SharedPointer<rhi::core::RHICommandList>;
 	public:
 		/****************************************************************************
 		**                Public Function
@@ -72,6 +92,15 @@ namespace engine
 		ResourceViewPtr GetSceneView() const noexcept override { return _scene; }
 		void SetSceneView(const ResourceViewPtr& scene) override { _scene = scene; }
 
+		/* @brief : Barrier and transient memory statistics of the last compiled render graph*/
+		const rhi::graph::RenderGraphStatistics& GetRenderGraphStatistics() const noexcept;
+
+		/* @brief : Draw call and state change counts of the last sorted forward draw list*/
+		const DrawListStatistics& GetDrawListStatistics() const noexcept;
+
+		/* @brief : Camera position used to quantize the view depth of the forward draw list*/
+		void SetViewPosition(const gm::Vector3f& position) noexcept { _viewPosition = position; }
+
 		template<class TLight> requires std::is_base_of_v<LightData, TLight> 
 		void SetLight(const LightType type, const std::uint32_t index, const TLight& light);
 
@@ -88,6 +117,17 @@ namespace engine
 		*****************************************************************************/
 		void PrepareModelPipeline();
 
+		void BuildRenderGraph();
+
+		void DrawForwardModels(const CommandListPtr& commandList);
+
+		/* @brief : Frustum culling of the forward models with the camera of the frame being drawn. The result is written to _isForwardModelVisible.*/
+		void CullForwardModels();
+
+		/* @brief : Set the viewport, descriptor heap, resource layout and the shared forward resources.
+		            Called for every command list the forward pass is recorded on.*/
+		void BindForwardResources(const CommandListPtr& commandList);
+
 		/****************************************************************************
 		**                Private Property
 		*****************************************************************************/
@@ -109,12 +149,47 @@ namespace engine
 
 		PipelineStatePtr _pipeline = nullptr;
 
+		/* @brief : Same as _pipeline, but reads the world matrix from the per-instance vertex stream (slot 1)*/
+		PipelineStatePtr _instancedPipeline = nullptr;
+
+		/* @brief : Sorts the forward draws by pipeline, material and mesh and merges them into instanced draws*/
+		DrawListBuilderPtr _drawList = nullptr;
+
+		/* @brief : Culls the forward models against the camera frustum before the draw list is built*/
+		FrustumCullerPtr _frustumCuller = nullptr;
+
+		/* @brief : Visibility of each _forwardModels entry (1 : draw). Models without local bounds are always visible.*/
+		gu::DynamicArray<gu::uint8> _isForwardModelVisible = {};
+
+		/* @brief : _forwardModels index of each box registered in _frustumCuller*/
+		gu::DynamicArray<gu::uint32> _culledModelIndices = {};
+
+		gm::Vector3f _viewPosition = {};
+
+		bool _useDrawList = true;
+
 		gu::SharedPointer<GameTimer> _gameTimer = nullptr;
 
 		std::vector<GameModelPtr> _forwardModels  = {};
 
 		ResourceViewPtr _scene = nullptr;
 
+		/* @brief : Declares the URP passes each frame so that barriers are batched by the graph compiler*/
+		RenderGraphPtr _renderGraph = nullptr;
+
+		/* @brief : SSAO samples the textures it was created with, so they are tracked separately from the current frame targets*/
+		TexturePtr _ssaoNormalTexture = nullptr;
+		TexturePtr _ssaoDepthTexture  = nullptr;
+
+		bool _printRenderGraphStatistics = false;
+
+		/* @brief : Prints the constructor time and the time until the forward pipelines are ready once ("pso_cache_stats")*/
+		bool _printPipelineStartup = false;
+
+		std::chrono::steady_clock::time_point _startupTime = {};
+
+		double _constructorMilliseconds = 0.0;
+
 		static constexpr std::uint32_t MAX_UI_COUNT = 1024;
 	};
 
@@ -0,0 +1,220 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DrawListBuilder.cpp
+///  @brief  `vf64bit̃\[gL[ŕёւ, bVƃ}eAvfCX^X`ɂ܂Ƃ߂܂.
+///  @author toide
+///  @date   2026/10/20 19:24:10
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Rendering/Core/Renderer/Include/DrawListBuilder.hpp"
+#include "GameCore/Rendering/Model/Include/MeshOld.hpp"
+#include "GameCore/Rendering/Model/Include/Material.hpp"
+#include "GameCore/Rendering/Model/Include/MaterialType.hpp"
+#include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine;
+using namespace rhi::core;
+
+namespace
+{
+	/*! @brief CX^Xobt@̍ŏ̗vf*/
+	constexpr gu::uint64 MIN_INSTANCE_CAPACITY = 1024;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+DrawListBuilder::DrawListBuilder(const LowLevelGraphicsEnginePtr& engine) : _engine(engine)
+{
+	Checkf(_engine != nullptr, "engine is nullptr");
+
+	_instanceBuffers.Resize(LowLevelGraphicsEngine::FRAME_BUFFER_COUNT);
+}
+
+DrawListBuilder::~DrawListBuilder()
+{
+	for (auto& buffer : _instanceBuffers)
+	{
+		if (buffer != nullptr) { buffer->Unmap(); }
+	}
+	_instanceBuffers.Clear();
+	_engine.Reset();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     `vfSĎ菜, Vt[̕`惊Xg̍쐬n߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::Begin()
+{
+	_items  .Clear();
+	_batches.Clear();
+	_sorter .Clear();
+}
+
+/*!**********************************************************************
+*  @brief     `vfǉ܂. }eAȂbV͕`悳܂.
+*  @param[in] const gu::uint8 `pX (0`15)
+*  @param[in] const gu::uint16 pCvC̔ԍ (0`4095)
+*  @param[in] Mesh* bV
+*  @param[in] Material* }eA
+*  @param[in] const gm::Float4x4& [hs
+*  @param[in] const float J̋. bV̒ŎO`悳܂
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::Add(const gu::uint8 pass, const gu::uint16 pipeline, Mesh* mesh, Material* material, const gm::Float4x4& world, const float viewDepth)
+{
+	if (mesh == nullptr || material == nullptr) { return; }
+
+	_sorter.Add(pass, pipeline, mesh, mesh->GetIndexBuffer().Get(), material, viewDepth);
+	_items .Push({ mesh, material, world });
+}
+
+/*!**********************************************************************
+*  @brief     \[gL[ŕёւ, CX^X`ɂ܂Ƃ߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::Build()
+{
+	_sorter.Build();
+
+	/*-------------------------------------------------------------------
+	-      ёւɃCX^Xf[^, ܂Ƃ߂͈͂`ɂ܂
+	---------------------------------------------------------------------*/
+	const auto& order = _sorter.GetOrder();
+	_instances.Resize(order.Size());
+	for (gu::uint64 i = 0; i < order.Size(); ++i)
+	{
+		_instances[i].World = _items[order[i]].World;
+	}
+
+	_batches.Clear();
+	for (const auto& batch : _sorter.GetBatches())
+	{
+		const auto& item = _items[batch.Item];
+		_batches.Push({ item.DrawMesh, item.DrawMaterial, batch.FirstInstance, batch.InstanceCount });
+	}
+}
+
+/*!**********************************************************************
+*  @brief     CX^Xf[^, ܂Ƃ߂`R}hXgɐς݂܂. @n
+*             \[XCAEgƃpCvC͌ĂяoŐݒ肵Ă.
+*  @param[in] const gu::SharedPointer<rhi::core::RHICommandList>& GraphicsR}hXg
+*  @param[in] const gu::uint32 t[ԍ
+*  @param[in] const gu::uint32 }eA̒萔obt@ݒ肷郋[gp[^̔ԍ (eNX`͑ԍɐݒ肳܂)
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::Record(const gu::SharedPointer<RHICommandList>& commandList, const gu::uint32 frameIndex, const gu::uint32 materialOffsetID)
+{
+	if (_batches.IsEmpty()) { return; }
+
+	UploadInstances(frameIndex);
+	Record(commandList, frameIndex, materialOffsetID, 0, GetBatchCount());
+}
+
+/*!**********************************************************************
+*  @brief     ёւ̃CX^Xf[^t[ԍ̒_obt@ɏ݂܂.
+*  @param[in] const gu::uint32 t[ԍ
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::UploadInstances(const gu::uint32 frameIndex)
+{
+	Check(frameIndex < LowLevelGraphicsEngine::FRAME_BUFFER_COUNT);
+
+	if (_instances.IsEmpty()) { return; }
+
+	PrepareInstanceBuffer(frameIndex, _instances.Size());
+	_instanceBuffers[frameIndex]->UploadByte(_instances.Data(), _instances.Size() * sizeof(DrawInstanceData), 0, nullptr, true);
+}
+
+/*!**********************************************************************
+*  @brief     ܂Ƃ߂` [begin, end) R}hXgɐς݂܂. قȂR}hXg֓ɌĂяo܂.
+*  @param[in] const gu::SharedPointer<rhi::core::RHICommandList>& GraphicsR}hXg
+*  @param[in] const gu::uint32 t[ԍ
+*  @param[in] const gu::uint32 }eA̒萔obt@ݒ肷郋[gp[^̔ԍ
+*  @param[in] const gu::uint32 擪̕`̔ԍ
+*  @param[in] const gu::uint32 I[̕`̔ԍ (܂܂Ȃ)
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::Record(const gu::SharedPointer<RHICommandList>& commandList, const gu::uint32 frameIndex, const gu::uint32 materialOffsetID, const gu::uint32 begin, const gu::uint32 end) const
+{
+	Check(frameIndex < LowLevelGraphicsEngine::FRAME_BUFFER_COUNT);
+	Check(commandList->GetType() == CommandListType::Graphics);
+	Check(begin <= end && end <= _batches.Size());
+
+	if (begin == end) { return; }
+
+	const auto& instanceBuffer = _instanceBuffers[frameIndex];
+
+	// eNX`̓}eA̒萔obt@̎̔ԍݒ肵܂
+	gu::DynamicArray<std::uint32_t> textureIDs((std::uint32_t)UsageTexture::CountOf);
+	for (std::uint32_t i = 0; i < (std::uint32_t)UsageTexture::CountOf; ++i)
+	{
+		textureIDs[i] = materialOffsetID + i + 1;
+	}
+
+	/*-------------------------------------------------------------------
+	-      WIgƃ}eA͕ς̂ݐݒ肵܂. Ԃ̐擪ł͕Kݒ肵܂
+	---------------------------------------------------------------------*/
+	commandList->SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+
+	const GPUBuffer* previousGeometry = nullptr;
+	const Material*  previousMaterial = nullptr;
+	for (gu::uint32 i = begin; i < end; ++i)
+	{
+		const auto& batch       = _batches[i];
+		const auto& indexBuffer = batch.DrawMesh->GetIndexBuffer();
+		if (indexBuffer.Get() != previousGeometry)
+		{
+			commandList->SetVertexBuffers({ batch.DrawMesh->GetVertexBuffers()[frameIndex], instanceBuffer });
+			commandList->SetIndexBuffer(indexBuffer);
+			previousGeometry = indexBuffer.Get();
+		}
+
+		if (batch.DrawMaterial != previousMaterial)
+		{
+			batch.DrawMaterial->Bind(commandList, frameIndex, materialOffsetID, textureIDs);
+			previousMaterial = batch.DrawMaterial;
+		}
+
+		commandList->DrawIndexedInstanced(static_cast<gu::uint32>(batch.DrawMesh->GetIndexCount()), batch.InstanceCount,
+			batch.DrawMesh->GetIndexOffset(), 0, batch.FirstInstance);
+	}
+}
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     t[ԍ̃CX^Xobt@ɕKvȗeʂmۂ܂. @n
+*             t[ԍ̃obt@GPUgIĂ邽, Ȃꍇ͍蒼܂.
+*  @param[in] const gu::uint32 t[ԍ
+*  @param[in] const gu::uint64 CX^X̐
+*  @return    void
+*************************************************************************/
+void DrawListBuilder::PrepareInstanceBuffer(const gu::uint32 frameIndex, const gu::uint64 instanceCount)
+{
+	auto& buffer = _instanceBuffers[frameIndex];
+	if (buffer != nullptr && buffer->GetElementCount() >= instanceCount) { return; }
+
+	gu::uint64 capacity = buffer != nullptr ? buffer->GetElementCount() : MIN_INSTANCE_CAPACITY;
+	while (capacity < instanceCount) { capacity *= 2; }
+
+	if (buffer != nullptr) { buffer->Unmap(); }
+
+	const auto metaData = GPUBufferMetaData::VertexBuffer(sizeof(DrawInstanceData), static_cast<gu::uint32>(capacity), MemoryHeap::Upload);
+	buffer = _engine->GetDevice()->CreateBuffer(metaData, SP("DrawListInstanceBuffer"));
+	buffer->Map();
+}
+#pragma endregion Protected Function
@@ -0,0 +1,162 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DrawListSorter.cpp
+///  @brief  `vf64bit̃\[gL[ŕёւ, bVƃ}eAvf܂Ƃ߂͈͂߂܂.
+///  @author toide
+///  @date   2026/10/23 14:08:52
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Rendering/Core/Renderer/Include/DrawListSorter.hpp"
+#include "GameUtility/Math/Include/GMSort.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <chrono>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace engine;
+
+namespace
+{
+	/*! @brief \[gL[̂, CX^X`ɂ܂Ƃ߂镔 ([x48bit)*/
+	constexpr gu::uint64 BATCH_KEY_MASK = ~static_cast<gu::uint64>(0xFFFF);
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     `vfSĎ菜܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DrawListSorter::Clear()
+{
+	_items  .Clear();
+	_keys   .Clear();
+	_order  .Clear();
+	_batches.Clear();
+	_materialIDs.clear();
+	_meshIDs    .clear();
+}
+
+/*!**********************************************************************
+*  @brief     `vfǉ܂. ǉ0ԍU܂.
+*  @param[in] const gu::uint8 `pX (0`15)
+*  @param[in] const gu::uint16 pCvC̔ԍ (0`4095)
+*  @param[in] const void* bV
+*  @param[in] const void* WIg (CfbNXobt@). ؂ւ񐔂̌vZɎg܂
+*  @param[in] const void* }eA
+*  @param[in] const float J̋. bV̒ŎOт܂
+*  @return    void
+*************************************************************************/
+void DrawListSorter::Add(const gu::uint8 pass, const gu::uint16 pipeline, const void* mesh, const void* geometry, const void* material, const float viewDepth)
+{
+	Check(pass < 16);
+	Check(pipeline < 4096);
+
+	/*-------------------------------------------------------------------
+	-      [x[0, 1]ɐK16bitɗʎq܂
+	---------------------------------------------------------------------*/
+	const float normalizedDepth = _maxViewDepth > 0.0f ? viewDepth / _maxViewDepth : 0.0f;
+	const float clampedDepth    = normalizedDepth < 0.0f ? 0.0f : (normalizedDepth > 1.0f ? 1.0f : normalizedDepth);
+	const auto  depth           = static_cast<gu::uint16>(clampedDepth * 65535.0f);
+
+	const auto key = MakeSortKey(pass, pipeline, GetObjectID(_materialIDs, material), GetObjectID(_meshIDs, mesh), depth);
+	_keys .Push(key);
+	_items.Push({ mesh, geometry, material });
+}
+
+/*!**********************************************************************
+*  @brief     \[gL[ŕёւ, ܂Ƃ߂͈͂Ɠv߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DrawListSorter::Build()
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	const auto itemCount = _items.Size();
+	_statistics = {};
+	_statistics.ItemCount          = static_cast<gu::uint32>(itemCount);
+	_statistics.NaiveDrawCallCount = static_cast<gu::uint32>(itemCount);
+	_batches.Clear();
+	_order  .Clear();
+	if (itemCount == 0) { return; }
+
+	/*-------------------------------------------------------------------
+	-      ǉɕ`悵ꍇ̐؂ւ
+	---------------------------------------------------------------------*/
+	const void* previousGeometry = nullptr;
+	const void* previousMaterial = nullptr;
+	for (const auto& item : _items)
+	{
+		if (item.DrawGeometry != previousGeometry) { _statistics.NaiveStateChangeCount++; previousGeometry = item.DrawGeometry; }
+		if (item.DrawMaterial != previousMaterial) { _statistics.NaiveStateChangeCount++; previousMaterial = item.DrawMaterial; }
+	}
+
+	/*-------------------------------------------------------------------
+	-      \[gL[Ɨvf̔ԍꏏɕёւ܂
+	---------------------------------------------------------------------*/
+	_keyBuffer  .Resize(itemCount);
+	_order      .Resize(itemCount);
+	_orderBuffer.Resize(itemCount);
+	for (gu::uint32 i = 0; i < static_cast<gu::uint32>(itemCount); ++i) { _order[i] = i; }
+
+	gm::Sort<gu::uint64>::RadixSort(_keys.Data(), _order.Data(), itemCount, _keyBuffer.Data(), _orderBuffer.Data());
+
+	/*-------------------------------------------------------------------
+	-      [xȊÕL[ƃbV, }eAvA܂Ƃ߂܂
+	---------------------------------------------------------------------*/
+	previousGeometry = nullptr;
+	previousMaterial = nullptr;
+	for (gu::uint64 i = 0; i < itemCount; ++i)
+	{
+		const auto& item = _items[_order[i]];
+
+		if (!_batches.IsEmpty())
+		{
+			auto& last = _batches.Back();
+			const auto& lastItem = _items[last.Item];
+			const bool isSameBatch = (_keys[i] & BATCH_KEY_MASK) == (_keys[i - 1] & BATCH_KEY_MASK)
+				&& lastItem.DrawMesh == item.DrawMesh && lastItem.DrawMaterial == item.DrawMaterial;
+
+			if (isSameBatch)
+			{
+				last.InstanceCount++;
+				continue;
+			}
+		}
+
+		_batches.Push({ static_cast<gu::uint32>(i), 1, _order[i] });
+
+		if (item.DrawGeometry != previousGeometry) { _statistics.StateChangeCount++; previousGeometry = item.DrawGeometry; }
+		if (item.DrawMaterial != previousMaterial) { _statistics.StateChangeCount++; previousMaterial = item.DrawMaterial; }
+	}
+
+	_statistics.DrawCallCount     = static_cast<gu::uint32>(_batches.Size());
+	_statistics.BuildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     |C^ɑ΂ăt[ňӂȔԍԂ܂. @n
+*             16bit𒴂ꍇ͔ԍd܂, ܂Ƃ߂ۂɃ|C^r邽ߕ`挋ʂ͕ς܂.
+*  @param[in] std::unordered_map<const void*, gu::uint16>& ԍ̑Ή\
+*  @param[in] const void* IuWFNg
+*  @return    gu::uint16 ԍ
+*************************************************************************/
+gu::uint16 DrawListSorter::GetObjectID(std::unordered_map<const void*, gu::uint16>& ids, const void* object)
+{
+	const auto found = ids.find(object);
+	if (found != ids.end()) { return found->second; }
+
+	const auto id = static_cast<gu::uint16>(ids.size() & 0xFFFF);
+	ids.emplace(object, id);
+	return id;
+}
+#pragma endregion Protected Function
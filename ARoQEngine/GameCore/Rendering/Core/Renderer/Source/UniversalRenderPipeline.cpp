@@ -9,26 +9,43 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Rendering/Core/Renderer/Include/UniversalRenderPipeline.hpp"
+#include "GameCore/Rendering/Core/Renderer/Include/DrawListBuilder.hpp"
+#include "GameCore/Rendering/Core/Culling/Include/FrustumCuller.hpp"
 #include "GameCore/Rendering/Core/BasePass/Include/BasePassZPrepass.hpp"
 #include "GameCore/Rendering/Core/BasePass/Include/BasePassGBuffer.hpp"
 #include "GameCore/Rendering/Core/BasePass/Include/BasePassLightCulling.hpp"
 #include "GameCore/Rendering/PostProcess/Include/SSAO.hpp"
 #include "GameCore/Rendering/Light/Include/CascadeShadow.hpp"
 #include "GameCore/Rendering/Model/Include/GameModel.hpp"
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UIRenderer.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
+#include "GraphicsCore/RenderGraph/Include/RenderGraph.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GameUtility/Base/Include/GUParse.hpp"
+#include "GameUtility/Base/Include/GUCommandLine.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include <stdio.h>
+#include <chrono>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 using namespace engine;
 using namespace rhi::core;
+using namespace rhi::graph;
 
 namespace
 {
 	const size_t MAX_DIRECTIONAL_LIGHT = 4;
+
+	// sort key fields of the forward draw list
+	constexpr gu::uint8     FORWARD_PASS_ID     = 0;
+	constexpr gu::uint16    FORWARD_PIPELINE_ID = 0;
+	constexpr std::uint32_t MATERIAL_OFFSET_ID  = 4;
 }
 //////////////////////////////////////////////////////////////////////////////////
 //                          Implement
@@ -37,11 +54,17 @@ namespace
 URP::URP(const LowLevelGraphicsEnginePtr& engine, const gu::SharedPointer<GameTimer>& gameTimer) : IRenderPipeline(engine),
 _gameTimer(gameTimer)
 {
+	// The pipelines below are compiled in the background, so the constructor time only covers the work left on this thread.
+	_startupTime          = std::chrono::steady_clock::now();
+	_printPipelineStartup = gu::Parse::Contains(gu::CommandLine::Get(), SP("pso_cache_stats"));
+
 	_zPrepass = gu::MakeShared<ZPrepass>(_engine, Screen::GetScreenWidth(), Screen::GetScreenHeight(), L"URP");
 
 	_gBuffer = gu::MakeShared<GBuffer>(engine, GBufferDesc((std::uint64_t)GBuffer::BufferType::CountOf), L"URP");
 
 	_ssao = gu::MakeShared<SSAO>(engine, _gBuffer->GetRenderedTextureView(1), _zPrepass->GetRenderedTextureView());
+	_ssaoNormalTexture = _gBuffer ->GetRenderedTexture(1);
+	_ssaoDepthTexture  = _zPrepass->GetRenderedTexture();
 	
 	const auto shadowDesc = CascadeShadowDesc();
 	_cascadeShadowMap = gu::MakeShared<CascadeShadow>(_engine, shadowDesc, L"URP");
@@ -50,7 +73,17 @@ _gameTimer(gameTimer)
 
 	_directionalLights = gu::MakeShared<SceneLightBuffer<DirectionalLightData>>(_engine, MAX_DIRECTIONAL_LIGHT, false);
 
+	_renderGraph = gu::MakeShared<RenderGraph>(_engine->GetDevice());
+	_printRenderGraphStatistics = gu::Parse::Contains(gu::CommandLine::Get(), SP("render_graph_stats"));
+
+	_drawList    = gu::MakeShared<DrawListBuilder>(_engine);
+	_useDrawList = !gu::Parse::Contains(gu::CommandLine::Get(), SP("disable_draw_list"));
+
+	_frustumCuller = gu::MakeShared<FrustumCuller>();
+
 	PrepareModelPipeline();
+
+	_constructorMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _startupTime).count();
 }
 
 URP::~URP()
@@ -71,33 +104,279 @@ bool URP::Draw()
 
 	const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
 	if (!commandList->IsOpen()) { return false; }
+	/*-------------------------------------------------------------------
+	-         Declare passes and record them through the render graph
+	---------------------------------------------------------------------*/
+	BuildRenderGraph();
+
+	const auto& statistics = _renderGraph->Compile().Statistics;
+
+	RenderGraphExecuteDesc executeDesc = {};
+	executeDesc.CommandList = commandList;
+	_renderGraph->Execute(executeDesc);
+
+	if (_printRenderGraphStatistics)
+	{
+		printf("RenderGraph: pass %u (culled %u), barrier %u / flush %u (per pass: barrier %u / flush %u), transient %llu byte -> %llu byte\n",
+			statistics.PassCount, statistics.CulledPassCount,
+			statistics.BarrierCount, statistics.BarrierBatchCount,
+			statistics.NaiveBarrierCount, statistics.NaiveBarrierBatchCount,
+			static_cast<unsigned long long>(statistics.TransientByteSize),
+			static_cast<unsigned long long>(statistics.AllocatedTransientByteSize));
+		_printRenderGraphStatistics = false;
+	}
+	
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     Declares the URP passes for the current frame. @n
+*             The targets read by later frames or by fixed views (ZPrepass, GBuffer, the ambient map and the back buffer) are imported. @n
+*             The raw SSAO target is only used between the SSAO and SSAOBlur passes, so it is a transient texture lent by the resource pool. @n
+*             The passes form a single chain (ZPrepass -> GBuffer -> SSAO -> SSAOBlur -> Forward) and record on the main command list. @n
+*             Each pass declares the targets it really writes, so a pass whose output is not read or imported is culled.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void URP::BuildRenderGraph()
+{
+	_renderGraph->Reset();
+
+	/*-------------------------------------------------------------------
+	-         Import the pass targets
+	---------------------------------------------------------------------*/
+	const auto zPrepass = _renderGraph->ImportTexture(SP("ZPrepass"), _zPrepass->GetRenderedTexture());
+
+	gu::DynamicArray<TextureHandle> gBuffers = {};
+	for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(GBuffer::BufferType::CountOf); ++i)
+	{
+		gBuffers.Push(_renderGraph->ImportTexture(SP("GBuffer"), _gBuffer->GetRenderedTexture(i)));
+	}
+
+	const auto ssaoNormal = _renderGraph->ImportTexture(SP("SSAONormal"), _ssaoNormalTexture);
+	const auto ssaoDepth  = _renderGraph->ImportTexture(SP("SSAODepth") , _ssaoDepthTexture);
+	const auto ssaoRaw     = _renderGraph->CreateTexture(SP("SSAORaw"), _ssao->GetTargetMetaData());
+	const auto ssaoAmbient = _renderGraph->ImportTexture(SP("SSAOAmbient"), _ssao->GetRenderedTexture());
+	const auto backBuffer  = _renderGraph->ImportTexture(SP("BackBuffer"), _engine->GetFrameBuffer(_engine->GetCurrentFrameIndex())->GetRenderTarget());
+
 	/*-------------------------------------------------------------------
 	-         Preprocess
 	---------------------------------------------------------------------*/
-	_zPrepass->Draw(_scene);
-	_gBuffer ->Draw(_scene);
-	_ssao->Draw(_scene);
+	_renderGraph->AddPass(SP("ZPrepass"), PassFlags::None, [this](const RenderGraphContext&) { _zPrepass->Draw(_scene); })
+		.Write(zPrepass, ResourceState::RenderTarget);
+
+	auto gBufferPass = _renderGraph->AddPass(SP("GBuffer"), PassFlags::None, [this](const RenderGraphContext&) { _gBuffer->Draw(_scene); });
+	for (const auto& gBuffer : gBuffers)
+	{
+		gBufferPass.Write(gBuffer, ResourceState::RenderTarget);
+	}
+
+	_renderGraph->AddPass(SP("SSAO"), PassFlags::None, [this, ssaoRaw](const RenderGraphContext& context) { _ssao->Draw(_scene, context.GetTexture(ssaoRaw)); })
+		.Read (ssaoNormal, ResourceState::PixelShader)
+		.Read (ssaoDepth , ResourceState::PixelShader)
+		.Write(ssaoRaw   , ResourceState::RenderTarget);
+
+	_renderGraph->AddPass(SP("SSAOBlur"), PassFlags::None, [this, ssaoRaw](const RenderGraphContext& context) { _ssao->Blur(context.GetTextureView(ssaoRaw, ResourceViewType::Texture)); })
+		.Read (ssaoRaw    , ResourceState::PixelShader)
+		.Write(ssaoAmbient, ResourceState::RenderTarget);
+
 	//_cascadeShadowMap->Draw(_gameTimer, _directionalLights->GetLight(0).Direction);
 
 	/*-------------------------------------------------------------------
 	-         Rendering
 	---------------------------------------------------------------------*/
-	_engine->BeginSwapchainRenderPass();
-	commandList->SetResourceLayout(_resourceLayout);
+	_renderGraph->AddPass(SP("Forward"), PassFlags::NeverCull, [this](const RenderGraphContext& context)
+	{
+		const auto& commandList = context.GetCommandList();
+
+		_engine->BeginSwapchainRenderPass();
+		DrawForwardModels(commandList);
+	}).Write(backBuffer, ResourceState::RenderTarget);
+}
+
+/*!**********************************************************************
+*  @brief     Draws the forward models. @n
+*             By default the models are sorted by material and mesh and the same mesh + material pairs are drawn as one instanced draw. @n
+*             The instanced draws are recorded on the worker command lists through LowLevelGraphicsEngine::ParallelRecord. @n
+*             Models with a custom game world buffer and "disable_draw_list" fall back to one draw per material in insertion order. @n
+*             The instanced pipeline is created in the background. Until it is ready, every model takes the one draw per material path. @n
+*             Models outside of the camera frustum are skipped in both paths.
+*  @param[in] const CommandListPtr& graphics command list
+*  @return    void
+*************************************************************************/
+void URP::DrawForwardModels(const CommandListPtr& commandList)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	BindForwardResources(commandList);
+
+	CullForwardModels();
+
+	// The instanced pipeline reads a different input layout, so it can not swap in _pipeline as its fallback; the draw path falls back instead.
+	const bool useDrawList = _useDrawList && _instancedPipeline->IsReady();
+	if (_printPipelineStartup && _pipeline->IsReady() && _instancedPipeline->IsReady())
+	{
+		// Run once without and once with PipelineStateCache.dx12 to compare the cold and warm start-up.
+		printf("URP pipelines: constructor %.2f ms, forward pipelines ready %.2f ms after start-up\n", _constructorMilliseconds,
+			std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _startupTime).count());
+		_printPipelineStartup = false;
+	}
+
+	/*-------------------------------------------------------------------
+	-         Sorted and instanced draws
+	---------------------------------------------------------------------*/
+	if (useDrawList)
+	{
+		// The update thread may already be writing the next frame, so the transforms and the view position come from the snapshot of the frame being drawn.
+		// The live values are only used for models that were not updated in that frame (e.g. outside of the frame loop).
+		const auto snapshot     = RenderSnapshot::GetReading();
+		const auto viewPosition = snapshot && snapshot->GetCamera().IsValid ? snapshot->GetCamera().Position : _viewPosition;
+
+		_drawList->Begin();
+		for (size_t modelIndex = 0; modelIndex < _forwardModels.size(); ++modelIndex)
+		{
+			const auto& model = _forwardModels[modelIndex];
+			if (!model->IsActive() || model->HasCustomGameWorld() || !_isForwardModelVisible[modelIndex]) { continue; }
+
+			const auto& meshes    = model->GetMeshes();
+			const auto& materials = model->GetMaterials();
+			const auto  transform = snapshot ? snapshot->FindTransform(model.Get()) : nullptr;
+			const auto  world     = transform ? transform->World : model->GetTransform().GetFloat4x4();
+			const float viewDepth = ((transform ? transform->Position : model->GetPosition()) - viewPosition).Length();
+
+			for (size_t i = 0; i < model->GetMaterialCount(); ++i)
+			{
+				_drawList->Add(FORWARD_PASS_ID, FORWARD_PIPELINE_ID, meshes[i].Get(), materials[i].Get(), world, viewDepth);
+			}
+		}
+		_drawList->Build();
+
+		const auto frameIndex = _engine->GetCurrentFrameIndex();
+		if (_drawList->GetBatchCount() > 0)
+		{
+			// the instance data is written once here, and each worker only records its range of batches
+			_drawList->UploadInstances(frameIndex);
+
+			ParallelRecordPass pass = {};
+			pass.Name        = SP("URPForward");
+			pass.DrawCount   = _drawList->GetBatchCount();
+			pass.RenderPass  = _engine->GetDrawContinueRenderPass();
+			pass.FrameBuffer = _engine->GetFrameBuffer(frameIndex);
+			pass.Setup       = [this](const CommandListPtr& workerList)
+			{
+				BindForwardResources(workerList);
+				workerList->SetGraphicsPipeline(_instancedPipeline);
+			};
+			pass.Record      = [this, frameIndex](const CommandListPtr& workerList, const gu::uint32 begin, const gu::uint32 end)
+			{
+				_drawList->Record(workerList, frameIndex, MATERIAL_OFFSET_ID, begin, end);
+			};
+			_engine->ParallelRecord({ pass });
+
+			// the graphics command list was restarted, so the forward state is set again
+			BindForwardResources(commandList);
+		}
+
+		const auto& statistics = _drawList->GetStatistics();
+		PROFILE_COUNTER("Draw Calls"                , statistics.DrawCallCount);
+		PROFILE_COUNTER("Draw Calls (Naive)"        , statistics.NaiveDrawCallCount);
+		PROFILE_COUNTER("Draw State Changes"        , statistics.StateChangeCount);
+		PROFILE_COUNTER("Draw State Changes (Naive)", statistics.NaiveStateChangeCount);
+		PROFILE_COUNTER("Draw List Build Time (ms)" , statistics.BuildMilliseconds);
+	}
+
+	/*-------------------------------------------------------------------
+	-         One draw per material in insertion order
+	---------------------------------------------------------------------*/
 	commandList->SetGraphicsPipeline(_pipeline);
-	_scene->Bind(commandList, 0);
-	_directionalLights->BindLightData(commandList, 2);
-	_cascadeShadowMap->GetShadowInfoView()->Bind(commandList, 3);
-	for (const auto& model : _forwardModels)
+	for (size_t modelIndex = 0; modelIndex < _forwardModels.size(); ++modelIndex)
 	{
 		// model active check
-		if (!model->IsActive()) { continue; }
+		const auto& model = _forwardModels[modelIndex];
+		if (!model->IsActive() || !_isForwardModelVisible[modelIndex]) { continue; }
+		if (useDrawList && !model->HasCustomGameWorld()) { continue; }
 
 		// forward rendering with each materials
-		model->Draw(true, 4);
+		model->Draw(true, MATERIAL_OFFSET_ID);
 	}
-	
-	return true;
+
+	// culling, the draw list build, the instance upload and the recording of both paths ("single_list_record" to compare with one command list)
+	PROFILE_COUNTER("Forward Time (ms)", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
+
+/*!**********************************************************************
+*  @brief     Culls the forward models with the camera of the frame being drawn. @n
+*             Only the models whose local bounds are known and whose world matrix is held by the transform are tested. @n
+*             The others (custom game world, meshes without CPU side vertices) and all models when no camera was snapshotted are drawn.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void URP::CullForwardModels()
+{
+	_isForwardModelVisible.Clear();
+	_isForwardModelVisible.Resize(_forwardModels.size(), true, 1);
+
+	const auto snapshot = RenderSnapshot::GetReading();
+	if (!snapshot || !snapshot->GetCamera().IsValid) { return; }
+
+	_frustumCuller->ClearObjects();
+	_frustumCuller->ClearViews();
+	_culledModelIndices.Clear();
+
+	const auto& camera = snapshot->GetCamera();
+	const auto  view   = _frustumCuller->AddView(camera.View, camera.Projection);
+
+	/*-------------------------------------------------------------------
+	-         Register the world AABB of the each model
+	---------------------------------------------------------------------*/
+	for (size_t modelIndex = 0; modelIndex < _forwardModels.size(); ++modelIndex)
+	{
+		const auto& model = _forwardModels[modelIndex];
+		if (!model->IsActive() || model->HasCustomGameWorld()) { continue; }
+
+		gm::BoundingBox localBounds = {};
+		if (!model->GetLocalBounds(localBounds)) { continue; }
+
+		const auto transform = snapshot->FindTransform(model.Get());
+		const auto world     = transform ? transform->World : model->GetTransform().GetFloat4x4();
+		_frustumCuller->AddBox(localBounds, world);
+
+		_culledModelIndices.Push(static_cast<gu::uint32>(modelIndex));
+		_isForwardModelVisible[modelIndex] = 0;
+	}
+
+	if (_culledModelIndices.IsEmpty()) { return; }
+
+	/*-------------------------------------------------------------------
+	-         Only the visible boxes are drawn
+	---------------------------------------------------------------------*/
+	_frustumCuller->Execute();
+
+	const auto* visibleBoxes = _frustumCuller->GetVisibleBoxIndices(view);
+	const auto  visibleCount = _frustumCuller->GetVisibleBoxCount(view);
+	for (gu::uint64 i = 0; i < visibleCount; ++i)
+	{
+		_isForwardModelVisible[_culledModelIndices[visibleBoxes[i]]] = 1;
+	}
+
+	PROFILE_COUNTER("Forward Culled Models", _culledModelIndices.Size() - visibleCount);
+}
+
+/*!**********************************************************************
+*  @brief     Sets the viewport, descriptor heap, resource layout and the scene, light and shadow views used by the forward pass.
+*  @param[in] const CommandListPtr& graphics command list
+*  @return    void
+*************************************************************************/
+void URP::BindForwardResources(const CommandListPtr& commandList)
+{
+	commandList->SetViewportAndScissor(
+		rhi::core::Viewport(0, 0, (float)Screen::GetScreenWidth(), (float)Screen::GetScreenHeight()),
+		rhi::core::ScissorRect(0, 0, (long)Screen::GetScreenWidth(), (long)Screen::GetScreenHeight()));
+	commandList->SetDescriptorHeap(_scene->GetHeap());
+	commandList->SetResourceLayout(_resourceLayout);
+	_scene->Bind(commandList, 0);
+	_directionalLights->BindLightData(commandList, 2);
+	_cascadeShadowMap->GetShadowInfoView()->Bind(commandList, 3);
 }
 
 void URP::Add(const URPDrawType type, const GameModelPtr& gameModel)
@@ -119,6 +398,16 @@ void URP::Add(const URPDrawType type, const GameModelPtr& gameModel)
 		_forwardModels.push_back(gameModel);
 	}
 }
+
+const RenderGraphStatistics& URP::GetRenderGraphStatistics() const noexcept
+{
+	return _renderGraph->GetStatistics();
+}
+
+const DrawListStatistics& URP::GetDrawListStatistics() const noexcept
+{
+	return _drawList->GetStatistics();
+}
 #pragma endregion Main Function
 
 #pragma region SetUp
@@ -167,7 +456,28 @@ void URP::PrepareModelPipeline()
 	_pipeline->SetDepthStencilState(factory->CreateDepthStencilState(depthProp));
 	_pipeline->SetVertexShader(vs);
 	_pipeline->SetPixelShader(ps);
-	_pipeline->CompleteSetting();
-	_pipeline->SetName(SP("URP::PSO"));
+	_pipeline->CompleteSettingAsync(SP("URP::PSO"), nullptr);
+
+	/*-------------------------------------------------------------------
+	-             Instanced pipeline for the sorted draw list
+	-             (the world matrix rows come from vertex buffer slot 1)
+	---------------------------------------------------------------------*/
+	const auto instancedVS = factory->CreateShaderState();
+	instancedVS->Compile({ ShaderType::Vertex, SP("Shader\\Model\\ShaderURPForwardRendering.hlsl"), SP("VSMain"), { SP("Shader\\Core") }, { SP("USE_INSTANCING") } });
+
+	auto instancedElements = GPUInputAssemblyState::GetDefaultSkinVertexElement();
+	for (gu::uint8 i = 0; i < 4; ++i)
+	{
+		instancedElements.Push(InputLayoutElement("INSTANCE_WORLD", PixelFormat::R32G32B32A32_FLOAT, InputClassification::PerInstance, i, 1));
+	}
+
+	_instancedPipeline = device->CreateGraphicPipelineState(_engine->GetDrawClearRenderPass(), _resourceLayout);
+	_instancedPipeline->SetBlendState(factory->CreateSingleBlendState(blend));
+	_instancedPipeline->SetRasterizerState(factory->CreateRasterizerState(RasterizerProperty::Solid(false, FrontFace::Clockwise, CullingMode::Back)));
+	_instancedPipeline->SetInputAssemblyState(factory->CreateInputAssemblyState(instancedElements));
+	_instancedPipeline->SetDepthStencilState(factory->CreateDepthStencilState(depthProp));
+	_instancedPipeline->SetVertexShader(instancedVS);
+	_instancedPipeline->SetPixelShader(ps);
+	_instancedPipeline->CompleteSettingAsync(SP("URP::InstancedPSO"), nullptr);
 }
 #pragma endregion SetUp
\ No newline at end of file
@@ -35,6 +35,7 @@ namespace engine
 namespace engine
 {
 	class ShadowMap;
+	class FrustumCuller;
 
 	struct CascadeShadowDesc
 	{
@@ -65,6 +66,7 @@ namespace engine
 		using CameraPtr                 = gu::SharedPointer<Camera>;
 		using ShadowMapPtr              = gu::SharedPointer<ShadowMap>;
 		using GameWorldInfoPtr          = gu::SharedPointer<GameWorldInfo>;
+		using FrustumCullerPtr          = gu::SharedPointer<FrustumCuller>;
 
 	public:
 
@@ -82,6 +84,12 @@ namespace engine
 		*****************************************************************************/
 		GPUResourceViewPtr GetShadowInfoView() const noexcept { return _shadowInfoView; }
 
+		/* @brief : JXP[h̐*/
+		static constexpr size_t GetCascadeCount() noexcept { return SHADOW_MAP_COUNT; }
+
+		/* @brief : ߂Updateŋ߂eJXP[h̃Cgr[vWFNVs (JOŎgp܂)*/
+		const gm::Float4x4& GetCascadeViewProjection(const size_t index) const { Check(index < SHADOW_MAP_COUNT); return _cascadeViewProjections[index]; }
+
 
 
 		/****************************************************************************
@@ -99,6 +107,9 @@ namespace engine
 
 		void Update(const gu::SharedPointer<GameTimer>& gameTimer, const gm::Float3& direction);
 
+		/* @brief : Collect the shadow casters inside the light camera frustum into _visibleModels*/
+		void CullShadowCasters();
+
 		/****************************************************************************
 		**                Protected Property
 		*****************************************************************************/
@@ -106,6 +117,14 @@ namespace engine
 
 		gu::DynamicArray<GameModelPtr> _gameModels = {};
 
+		/* @brief : Shadow casters drawn in this frame. Models without local bounds are always included.*/
+		gu::DynamicArray<GameModelPtr> _visibleModels = {};
+
+		/* @brief : Models registered in _frustumCuller (the box index is the array index)*/
+		gu::DynamicArray<GameModelPtr> _culledModels = {};
+
+		FrustumCullerPtr _frustumCuller = nullptr;
+
 		// GPU binding resource
 		RHIResourceLayoutPtr   _resourceLayout = nullptr;
 		GPUGraphicsPipelinePtr _pipeline       = nullptr;
@@ -120,6 +139,8 @@ namespace engine
 		CascadeShadowDesc _shadowDesc = {};
 
 		static constexpr size_t SHADOW_MAP_COUNT = 3;
+
+		gm::Float4x4 _cascadeViewProjections[SHADOW_MAP_COUNT] = {};
 	};
 }
 #endif
\ No newline at end of file
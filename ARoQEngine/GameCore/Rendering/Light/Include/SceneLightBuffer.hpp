@@ -15,6 +15,7 @@
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GameUtility/Base/Include/Screen.hpp"
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
 #include "LightType.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
@@ -90,14 +91,8 @@ namespace engine
 		~SceneLightBuffer()
 		{
 			_lights   .clear(); _lights   .shrink_to_fit();
-			_updateIDs.clear(); _updateIDs.shrink_to_fit();
 		}
 	protected:
-		/****************************************************************************
-		**                Protected Function
-		*****************************************************************************/
-		void UpdateLightData();
-
 		/****************************************************************************
 		**                Protected Property
 		*****************************************************************************/
@@ -105,7 +100,6 @@ namespace engine
 
 		/* A list summarizing the Index of Light that HIt in each tile,*/
 		ResourceViewPtr _hitLightIDListsInTile = nullptr;
-		std::vector<std::int32_t> _updateIDs = {};
 
 		/* Light GPU data*/
 		ResourceViewPtr _lightDataView    = nullptr;
@@ -116,8 +110,6 @@ namespace engine
 		/* Config*/
 		std::uint32_t _usingMaxCount = 0;
 
-		bool _needUpdate = false;
-
 
 		// for tile based rendering. (This variable is basically limited by the Point light and spot light);
 		static constexpr std::uint32_t TILE_LENGTH = 16;
@@ -130,11 +122,6 @@ namespace engine
 		const gu::SharedPointer<rhi::core::RHICommandList>& commandList,
 		const std::uint32_t bindID)
 	{
-		/*-------------------------------------------------------------------
-		-             Copy the cpu light data to the gpu
-		---------------------------------------------------------------------*/
-		if (_needUpdate) { UpdateLightData();}
-
 		_lightDataView->Bind(commandList, bindID);
 	}
 
@@ -166,7 +153,8 @@ namespace engine
 	/* @fn        template<typename TLight> requires std::is_base_of_v<LightData, TLight>
 				  void SceneLightBuffer<TLight>::SetLight(const std::uint32_t index, const TLight& light)
 
-	*  @brief     Set light and prepare copy to the GPU.
+	*  @brief     Set light and write it through the engine upload ring.
+	*             The copy to the GPU is recorded at the beginning of the next draw frame.
 	*
 	*  @param[in] const std::uint32_t lightIndex
 	*  @param[in] const TLight& light
@@ -180,44 +168,12 @@ namespace engine
 		Check(index < GetMaxCount());
 #endif
 
-		_lights   [index] = light;
-		_updateIDs.push_back(index);
+		_lights[index] = light;
 		_usingMaxCount = (std::max)(index, _usingMaxCount);
-		_needUpdate       = true;
-		
-	}
-
-	/****************************************************************************
-	*                       UpdateLightData
-	****************************************************************************/
-	/* @fn        template<typename TLight> requires std::is_base_of_v<LightData, TLight>
-				  void SceneLightBuffer<TLight>::UpdateLightData()
 
-	*  @brief     Copy the CPU light data to the GPU buffer
-	*
-	*  @param[in] void
-	*
-	*  @return @@void
-	*****************************************************************************/
-	template<typename TLight> requires std::is_base_of_v<LightData, TLight>
-	void SceneLightBuffer<TLight>::UpdateLightData()
-	{
-		if (!_needUpdate) { return; }
-
-		// get light buffer from the resource view
+		// Each light is placed at the 256 byte aligned stride of the constant buffer.
 		const auto lightBuffer = _lightDataView->GetBuffer();
-
-		// clear
-		lightBuffer->Map();
-		for (std::uint32_t i = 0; i < (std::uint32_t)_updateIDs.size(); ++i)
-		{
-			lightBuffer->UploadIndex(&_lights[i], _updateIDs[i], 0, nullptr, true);
-		}
-		lightBuffer->Unmap();
-
-		// clear update IDs
-		_updateIDs.clear();
-		_needUpdate = false;
+		RenderSnapshot::UploadBuffer(*_engine->GetUploadRing(), lightBuffer, &_lights[index], sizeof(TLight), index * lightBuffer->GetElementByteSize());
 	}
 
 	/*-------------------------------------------------------------------
@@ -240,7 +196,8 @@ namespace engine
 		-              Create Light Data View
 		---------------------------------------------------------------------*/
 		{
-			const auto bufferInfo = GPUBufferMetaData::ConstantBuffer(sizeof(TLight), (gu::uint32)count);
+			// written through the upload ring, so the buffer stays in the default heap
+			const auto bufferInfo = GPUBufferMetaData::DefaultBuffer(sizeof(TLight), (gu::uint32)count);
 			const auto buffer     = device->CreateBuffer(bufferInfo, L"LightData");
 
 			_lightDataView = device->CreateResourceView(ResourceViewType::ConstantBuffer, buffer,0,0, nullptr);
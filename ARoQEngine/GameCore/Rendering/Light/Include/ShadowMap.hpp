@@ -47,6 +47,9 @@ namespace engine
 		*****************************************************************************/
 		void Draw(const GPUResourceViewPtr& scene);
 
+		/* @brief : Draw only the given models (e.g. the shadow casters left after the frustum culling)*/
+		void Draw(const GPUResourceViewPtr& scene, const gu::DynamicArray<GameModelPtr>& gameModels);
+
 		void Add(const GameModelPtr& gameModel);
 
 		/****************************************************************************
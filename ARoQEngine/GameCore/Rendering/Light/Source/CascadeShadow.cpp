@@ -13,6 +13,8 @@
 #include "../GameCore/Core/Include/Camera.hpp"
 #include "../GameCore/Core/Include/GameWorldInfo.hpp"
 #include "../../Model/Include/GameModel.hpp"
+#include "../../Core/Culling/Include/FrustumCuller.hpp"
+#include "GameCore/Core/Include/RenderSnapshot.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
@@ -59,6 +61,8 @@ CascadeShadow::CascadeShadow(const LowLevelGraphicsEnginePtr& engine, const Casc
 		_shadowMaps[i] = gu::MakeShared<ShadowMap>(_engine, (std::uint32_t)(desc.MaxResolution / pow(2, i)), (std::uint32_t)(desc.MaxResolution / pow(2,i)));
 	}
 
+	_frustumCuller = gu::MakeShared<FrustumCuller>();
+
 	PrepareResourceView (name);
 
 }
@@ -91,13 +95,19 @@ void CascadeShadow::Draw(const gu::SharedPointer<GameTimer>& gameTimer,const gm:
 	---------------------------------------------------------------------*/
 	Update(gameTimer, direction);
 
+	/*-------------------------------------------------------------------
+	-               Cull the shadow casters
+	-   Every shadow map is rendered with the light camera, so its frustum is used for all cascades.
+	---------------------------------------------------------------------*/
+	CullShadowCasters();
+
 	/*-------------------------------------------------------------------
 	-               Draw shadow maps of the each resolution
 	---------------------------------------------------------------------*/
 	for (const auto& shadowMap : _shadowMaps)
 	{
 		// shadow map + gaussian blur
-		shadowMap->Draw(_lightCamera->GetResourceView());
+		shadowMap->Draw(_lightCamera->GetResourceView(), _visibleModels);
 	}
 
 }
@@ -124,6 +134,55 @@ void CascadeShadow::Add(const GameModelPtr& gameModel)
 
 	_gameModels.Push(gameModel);
 }
+
+/****************************************************************************
+*							CullShadowCasters
+****************************************************************************/
+/* @fn        void CascadeShadow::CullShadowCasters()
+*
+*  @brief     Collect the shadow casters inside the light camera frustum.
+*             Models with a custom game world or without local bounds are always drawn.
+*
+*  @param[in] void
+*
+*  @return @@void
+*****************************************************************************/
+void CascadeShadow::CullShadowCasters()
+{
+	_visibleModels.Clear();
+	_culledModels .Clear();
+	_frustumCuller->ClearObjects();
+	_frustumCuller->ClearViews();
+
+	const auto view     = _frustumCuller->AddView(*_lightCamera);
+	const auto snapshot = RenderSnapshot::GetReading();
+
+	for (const auto& model : _gameModels)
+	{
+		BoundingBox localBounds = {};
+		if (model->HasCustomGameWorld() || !model->GetLocalBounds(localBounds))
+		{
+			_visibleModels.Push(model);
+			continue;
+		}
+
+		// the transform of the frame being drawn is used as the forward pass does
+		const auto transform = snapshot ? snapshot->FindTransform(model.Get()) : nullptr;
+		_frustumCuller->AddBox(localBounds, transform ? transform->World : model->GetTransform().GetFloat4x4());
+		_culledModels.Push(model);
+	}
+
+	if (_culledModels.IsEmpty()) { return; }
+
+	_frustumCuller->Execute();
+
+	const auto* visibleBoxes = _frustumCuller->GetVisibleBoxIndices(view);
+	const auto  visibleCount = _frustumCuller->GetVisibleBoxCount(view);
+	for (gu::uint64 i = 0; i < visibleCount; ++i)
+	{
+		_visibleModels.Push(_culledModels[visibleBoxes[i]]);
+	}
+}
 #pragma endregion Main Function
 
 #pragma region SetUp Function
@@ -248,7 +307,8 @@ void CascadeShadow::Update(const gu::SharedPointer<GameTimer>& gameTimer, const
 	shadowInfo.IsSoftShadow = _shadowDesc.UseSoftShadow;
 	for (int i = 0; i < _countof(shadowInfo.LVPC); ++i)
 	{
-		shadowInfo.LVPC[i] = lvpcMatrices[i].ToFloat4x4();
+		shadowInfo.LVPC[i]         = lvpcMatrices[i].ToFloat4x4();
+		_cascadeViewProjections[i] = shadowInfo.LVPC[i];
 	}
 
 	_shadowInfoView->GetBuffer()->UploadByte(&shadowInfo, sizeof(shadowInfo));
@@ -76,6 +76,20 @@ ShadowMap::~ShadowMap()
 *  @return @@void
 *****************************************************************************/
 void ShadowMap::Draw(const GPUResourceViewPtr& scene)
+{
+	Draw(scene, _gameModels);
+}
+
+/* @fn        void ShadowMap::Draw(const ResourceViewPtr& scene, const gu::DynamicArray<GameModelPtr>& gameModels)
+*
+*  @brief     Draw the given models to the shadow map and apply the gaussian blur.
+*
+*  @param[in] const ResourceViewPtr& scene resource view of the light camera.
+*  @param[in] const gu::DynamicArray<GameModelPtr>& shadow casters to draw
+*
+*  @return @@void
+*****************************************************************************/
+void ShadowMap::Draw(const GPUResourceViewPtr& scene, const gu::DynamicArray<GameModelPtr>& gameModels)
 {
 	/*-------------------------------------------------------------------
 	-               Set variables
@@ -98,9 +112,9 @@ void ShadowMap::Draw(const GPUResourceViewPtr& scene)
 	commandList->SetGraphicsPipeline(_pipeline);
 	commandList->SetResourceLayout  (_resourceLayout);
 	scene->Bind(commandList, 0);
-	for (size_t i = 0; i < _gameModels.Size(); ++i)
+	for (size_t i = 0; i < gameModels.Size(); ++i)
 	{
-		_gameModels[i]->Draw(false);
+		gameModels[i]->Draw(false);
 	}
 
 	/*-------------------------------------------------------------------
@@ -272,7 +286,6 @@ void ShadowMap::PreparePipelineState(const gu::tstring& name)
 	_pipeline->SetDepthStencilState (factory->CreateDepthStencilState());
 	_pipeline->SetVertexShader(vs);
 	_pipeline->SetPixelShader (ps);
-	_pipeline->CompleteSetting();
-	_pipeline->SetName(name + SP("PSO"));
+	_pipeline->CompleteSettingAsync(name + SP("PSO"), nullptr);
 }
 #pragma endregion Set Up Function
\ No newline at end of file
@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameCore/Core/Include/GameActor.hpp"
 #include "PrimitiveMesh.hpp"
+#include "GameUtility/Math/Include/GMCollision.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -62,14 +63,22 @@ namespace engine
 
 		MeshArrayPtr GetMeshes() const noexcept { return _meshes; }
 
+		const gu::DynamicArray<MaterialPtr>& GetMaterials() const noexcept { return _materials; }
+
 		size_t GetMaterialCount() const { return _materialCount; }
 
 		gm::Float4 GetDebugColor() const { return _debugColor; }
 
 		bool HasSkin() const { return _hasSkin; }
 
+		/* @brief : The world matrix is held by the custom game world information instead of the transform.*/
+		bool HasCustomGameWorld() const noexcept { return _hasCustomGameWorld; }
+
 		void SetDebugColor(const gm::Float4& color) { _debugColor = color; }
 
+		/* @brief : Local space AABB of the drawn vertices. Returns false when a mesh has no CPU side vertices (the model is never culled).*/
+		bool GetLocalBounds(gm::BoundingBox& bounds) const;
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
@@ -14,6 +14,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHITypeCore.hpp"
 #include "GameUtility/Math/Include/GMVertex.hpp"
+#include "GameUtility/Math/Include/GMCollision.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Base/Include/GUString.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
@@ -51,9 +52,21 @@ namespace engine
 
 		GPUBufferPtr GetIndexBuffer() const noexcept { return _indexBuffer; }
 
+		/* @brief : Index count drawn by this mesh (the material range when sharing the index buffer)*/
+		gu::uint64 GetIndexCount() const noexcept { return _indexCount; }
+
+		/* @brief : Start index location in the index buffer*/
+		gu::uint32 GetIndexOffset() const noexcept { return _indexOffset; }
+
 		MaterialPtr GetMaterial() const noexcept { return _material; }
 
 		void SetMaterial(const MaterialPtr& material) { _material = material; }
+
+		/* @brief : Local space AABB of the vertices (Valid only when HasLocalBounds() is true)*/
+		const gm::BoundingBox& GetLocalBounds() const noexcept { return _localBounds; }
+
+		/* @brief : False when the vertices were not given on the CPU side (e.g. the shared vertex buffer constructor)*/
+		bool HasLocalBounds() const noexcept { return _hasLocalBounds; }
 		#pragma endregion
 
 		#pragma region Public Constructor and Destructor
@@ -88,6 +101,9 @@ namespace engine
 		
 		void Prepare(const rhi::core::GPUBufferMetaData& vertexInfo, const rhi::core::GPUBufferMetaData& indexInfo, const gu::tstring& name);
 
+		/* @brief : Calculate the local AABB from the vertex positions. The position must be the first Float3 of each vertex.*/
+		void ComputeLocalBounds(const void* vertices, const gu::uint64 count, const gu::uint64 stride);
+
 		#pragma endregion
 		#pragma region Protected Property
 		LowLevelGraphicsEnginePtr _engine = nullptr;
@@ -106,6 +122,11 @@ namespace engine
 
 		bool _hasCreatedNewBuffer = false;
 
+		/* @brief : Used for the frustum culling*/
+		gm::BoundingBox _localBounds = {};
+
+		bool _hasLocalBounds = false;
+
 		#pragma endregion
 
 	};
@@ -13,11 +13,14 @@
 #include "../Include/MeshOld.hpp"
 #include "../Include/Material.hpp"
 #include "../../../Core/Include/GameWorldInfo.hpp"
+#include "../../../Core/Include/RenderSnapshot.hpp"
 #include "../External/MMD/Include/MMDModelConverter.hpp"
 #include "../External/GLTF/Public/Include/GLTFModelConverter.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GameUtility/File/Include/FileSystem.hpp"
 #include <iostream>
+#include <algorithm>
+#include <cfloat>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +44,14 @@ GameModel::GameModel(const LowLevelGraphicsEnginePtr& engine, const MeshPtr& mes
 {
     if (customGameWorldInfo) { _hasCustomGameWorld = true; }
     _meshes.Push(mesh);
+    _totalMesh = mesh;
+
+    // share the mesh material so that models created from one mesh can be drawn together
+    if (mesh && mesh->GetMaterial())
+    {
+        _materialCount = 1;
+        _materials.Push(mesh->GetMaterial());
+    }
     PrepareGameWorldBuffer();
 }
 
@@ -136,17 +147,25 @@ void GameModel::Update(const float deltaTime, const bool enableUpdateChild)
 {
     if (!_isActive) { return; }
 
+    const auto worldMatrix = _transform.GetFloat4x4();
+
+    // the render thread reads the world matrix and the position from this frame's snapshot
+    if (const auto snapshot = RenderSnapshot::GetWriting())
+    {
+        snapshot->SetTransform(this, { .World = worldMatrix, .Position = _transform.GetLocalPosition() });
+    }
+
     if (!_hasCustomGameWorld)
     {
         GameWorldConstant world = 
         { 
-            .World = _transform.GetFloat4x4(),
+            .World = worldMatrix,
 #ifdef _DEBUG
             .DebugColor = _debugColor
 #endif
         };
 
-        _gameWorld->GetBuffer()->UploadByte(&world, sizeof(GameWorldConstant));
+        _gameWorld->Upload(world);
     }
 
     GameActor::Update(deltaTime, enableUpdateChild);
@@ -163,6 +182,52 @@ void GameModel::Draw(bool isDrawingEachMaterial, const std::uint32_t materialOff
         DrawWithoutMaterial();
     }
 }
+
+/****************************************************************************
+*					GetLocalBounds
+****************************************************************************/
+/* @fn        bool GameModel::GetLocalBounds(gm::BoundingBox& bounds) const
+*
+*  @brief     Acquire the local AABB used for the frustum culling.
+*             The total mesh holds the vertices that are actually drawn, so it is used first.
+*             Otherwise, the AABBs of the each material mesh are merged.
+*
+*  @param[out] gm::BoundingBox& bounds
+*
+*  @return @@bool (false : the bounds are unknown)
+*****************************************************************************/
+bool GameModel::GetLocalBounds(gm::BoundingBox& bounds) const
+{
+    if (_totalMesh && _totalMesh->HasLocalBounds())
+    {
+        bounds = _totalMesh->GetLocalBounds();
+        return true;
+    }
+
+    if (_meshes.IsEmpty()) { return false; }
+
+    gm::Float3 minimum( FLT_MAX,  FLT_MAX,  FLT_MAX);
+    gm::Float3 maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (const auto& mesh : _meshes)
+    {
+        if (!mesh || !mesh->HasLocalBounds()) { return false; }
+
+        const auto& box = mesh->GetLocalBounds();
+        minimum.x = std::min(minimum.x, box.Center.x - box.Extents.x);
+        minimum.y = std::min(minimum.y, box.Center.y - box.Extents.y);
+        minimum.z = std::min(minimum.z, box.Center.z - box.Extents.z);
+        maximum.x = std::max(maximum.x, box.Center.x + box.Extents.x);
+        maximum.y = std::max(maximum.y, box.Center.y + box.Extents.y);
+        maximum.z = std::max(maximum.z, box.Center.z + box.Extents.z);
+    }
+
+    bounds = gm::BoundingBox
+    (
+        gm::Float3((maximum.x + minimum.x) * 0.5f, (maximum.y + minimum.y) * 0.5f, (maximum.z + minimum.z) * 0.5f),
+        gm::Float3((maximum.x - minimum.x) * 0.5f, (maximum.y - minimum.y) * 0.5f, (maximum.z - minimum.z) * 0.5f)
+    );
+    return true;
+}
 #pragma endregion Main Function
 
 
@@ -13,6 +13,7 @@
 #include "../Include/PrimitiveMesh.hpp"
 #include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include <cfloat>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -150,6 +151,8 @@ void Mesh::Prepare(const PrimitiveMesh& mesh, const gu::tstring& name)
 		_indexBuffer->UploadByte(mesh.Indices.data(), metaData.GetTotalByte(), 0, copyCommandList);
 	}
 
+	ComputeLocalBounds(mesh.Vertices.data(), mesh.Vertices.size(), sizeof(gm::Vertex));
+
 	_hasCreatedNewBuffer = true;
 }
 
@@ -201,5 +204,51 @@ void Mesh::Prepare(const GPUBufferMetaData& vertexInfo, const GPUBufferMetaData&
 		if (indexInfo.InitData) { _indexBuffer->UploadByte(indexInfo.InitData, indexInfo.GetTotalByte(), 0, copyCommandList); }
 	}
 
+	if (vertexInfo.InitData && vertexInfo.Stride >= sizeof(gm::Float3))
+	{
+		ComputeLocalBounds(vertexInfo.InitData, vertexInfo.Count, vertexInfo.Stride);
+	}
+
 	_hasCreatedNewBuffer = true;
+}
+
+/****************************************************************************
+*					ComputeLocalBounds
+****************************************************************************/
+/* @fn        void Mesh::ComputeLocalBounds(const void* vertices, const gu::uint64 count, const gu::uint64 stride)
+*
+*  @brief     Calculate the local AABB from the vertex positions
+*
+*  @param[in] const void* vertices (the position must be the first Float3 of each vertex)
+*  @param[in] const gu::uint64 count
+*  @param[in] const gu::uint64 stride
+*
+*  @return @@void
+*****************************************************************************/
+void Mesh::ComputeLocalBounds(const void* vertices, const gu::uint64 count, const gu::uint64 stride)
+{
+	_hasLocalBounds = false;
+	if (vertices == nullptr || count == 0) { return; }
+
+	gm::Float3 minimum( FLT_MAX,  FLT_MAX,  FLT_MAX);
+	gm::Float3 maximum(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+	const auto* bytes = static_cast<const gu::uint8*>(vertices);
+	for (gu::uint64 i = 0; i < count; ++i)
+	{
+		const auto& position = *reinterpret_cast<const gm::Float3*>(bytes + i * stride);
+		minimum.x = position.x < minimum.x ? position.x : minimum.x;
+		minimum.y = position.y < minimum.y ? position.y : minimum.y;
+		minimum.z = position.z < minimum.z ? position.z : minimum.z;
+		maximum.x = position.x > maximum.x ? position.x : maximum.x;
+		maximum.y = position.y > maximum.y ? position.y : maximum.y;
+		maximum.z = position.z > maximum.z ? position.z : maximum.z;
+	}
+
+	_localBounds = gm::BoundingBox
+	(
+		gm::Float3((maximum.x + minimum.x) * 0.5f, (maximum.y + minimum.y) * 0.5f, (maximum.z + minimum.z) * 0.5f),
+		gm::Float3((maximum.x - minimum.x) * 0.5f, (maximum.y - minimum.y) * 0.5f, (maximum.z - minimum.z) * 0.5f)
+	);
+	_hasLocalBounds = true;
 }
\ No newline at end of file
@@ -74,6 +74,9 @@ namespace engine
 		void DrawCS(const GPUResourceViewPtr& sourceSRV, const GPUResourceViewPtr& destUAV);
 		
 		void DrawPS(const RHIFrameBufferPtr& frameBuffer, const std::uint32_t renderTargetIndex = 0);
+
+		/* @brief : Blur the input image into the frame buffer. Call this outside of a render pass.*/
+		void DrawPS(const GPUResourceViewPtr& inputImage, const RHIFrameBufferPtr& frameBuffer, const std::uint32_t renderTargetIndex = 0);
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
@@ -28,7 +28,10 @@ namespace engine
 namespace rhi::core
 {
 	class GPUBuffer;
+	class GPUTexture;
 	class GPUResourceView;
+	class RHIFrameBuffer;
+	struct GPUTextureMetaData;
 	class RHIResourceLayout;
 	class GPUGraphicsPipelineState;
 
@@ -76,13 +79,27 @@ namespace engine
 		using VertexBufferPtr           = gu::SharedPointer<rhi::core::GPUBuffer>;
 		using IndexBufferPtr            = gu::SharedPointer<rhi::core::GPUBuffer>;
 		using GaussianBlurPtr           = gu::SharedPointer<engine::GaussianBlur>;
+		using TexturePtr                = gu::SharedPointer<rhi::core::GPUTexture>;
+		using FrameBufferPtr            = gu::SharedPointer<rhi::core::RHIFrameBuffer>;
+
+		/* @brief : Frame buffer created for a target texture given to Draw. The render graph lends the same pooled textures every frame.*/
+		struct TargetFrameBuffer
+		{
+			TexturePtr     Texture      = nullptr;
+			FrameBufferPtr FrameBuffer  = nullptr;
+			std::uint64_t  LastUsedFrame = 0;
+		};
 	public:
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
 		void OnResize(const std::uint32_t newWidth, const std::uint32_t newHeight);
 
-		void Draw(const ResourceViewPtr& scene);
+		/* @brief : Render the raw (not blurred) ambient occlusion into the target texture. The target must be created from GetTargetMetaData.*/
+		void Draw(const ResourceViewPtr& scene, const TexturePtr& target);
+
+		/* @brief : Blur the raw ambient occlusion and write it to the ambient map (GetRenderedTexture).*/
+		void Blur(const ResourceViewPtr& source);
 
 		/****************************************************************************
 		**                Public Property
@@ -90,6 +107,12 @@ namespace engine
 		/* @brief : Return rendered texture view pointer*/
 		ResourceViewPtr GetRenderedTextureView() const noexcept { return _ambientMap; }
 
+		/* @brief : Return rendered texture (blurred ambient occlusion map)*/
+		TexturePtr GetRenderedTexture() const noexcept { return _ambientTexture; }
+
+		/* @brief : Return the texture description for the raw ambient occlusion target given to Draw*/
+		rhi::core::GPUTextureMetaData GetTargetMetaData() const;
+
 		void SetOcclusionRadius(const float radius);
 
 		void SetSharpness(const float sharpness);
@@ -119,6 +142,10 @@ namespace engine
 		void PreparePipelineState(const gu::tstring& name);
 
 		void PrepareVertexAndIndexBuffer(const gu::tstring& name);
+
+		void PrepareAmbientMap(const gu::tstring& name);
+
+		const FrameBufferPtr& FindTargetFrameBuffer(const TexturePtr& target);
 		/****************************************************************************
 		**                Protected Property
 		*****************************************************************************/
@@ -146,6 +173,16 @@ namespace engine
 
 		/* @brief : Final rendered texture. This class is drawed ambient occlusion map*/
 		ResourceViewPtr _ambientMap = nullptr;
+		TexturePtr      _ambientTexture     = nullptr;
+		FrameBufferPtr  _ambientFrameBuffer = nullptr;
+
+		/* @brief : Depth buffer shared by the ambient map and the target frame buffers (the draw render pass has a depth attachment).*/
+		TexturePtr _depthBuffer = nullptr;
+
+		/* @brief : Frame buffers for the target textures. Entries unused for MAX_UNUSED_FRAME_COUNT frames are released.*/
+		gu::DynamicArray<TargetFrameBuffer> _targetFrameBuffers = {};
+		std::uint64_t _frameCounter = 0;
+		static constexpr std::uint64_t MAX_UNUSED_FRAME_COUNT = 8;
 
 		/* @brief : CPU calculate random value map. */
 		ResourceViewPtr _randomMap = nullptr;
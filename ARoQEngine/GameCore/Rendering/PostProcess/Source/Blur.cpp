@@ -139,18 +139,21 @@ void GaussianBlur::DrawCS(const GPUResourceViewPtr& sourceSRV, const GPUResource
 }
 
 void GaussianBlur::DrawPS(const RHIFrameBufferPtr& frameBuffer, const std::uint32_t renderTargetIndex)
+{
+	/*-------------------------------------------------------------------
+	-               Change render resource
+	---------------------------------------------------------------------*/
+	_engine->GetCommandList(CommandListType::Graphics)->EndRenderPass();
+
+	DrawPS(frameBuffer->GetRenderTargetSRV(renderTargetIndex), frameBuffer, renderTargetIndex);
+}
+
+void GaussianBlur::DrawPS(const GPUResourceViewPtr& inputImage, const RHIFrameBufferPtr& frameBuffer, const std::uint32_t renderTargetIndex)
 {
 	Check(!_useCS);
 
-	const auto device       = _engine->GetDevice();
 	const auto commandList  = _engine->GetCommandList(CommandListType::Graphics);
 	const auto currentFrame = _engine->GetCurrentFrameIndex();
-	const auto inputImage   = frameBuffer->GetRenderTargetSRV(renderTargetIndex);
-
-	/*-------------------------------------------------------------------
-	-               Change render resource
-	---------------------------------------------------------------------*/
-	commandList->EndRenderPass();
 
 	/*-------------------------------------------------------------------
 	-               Set graphics pipeline
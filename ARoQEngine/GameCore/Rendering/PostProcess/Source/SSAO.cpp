@@ -62,6 +62,7 @@ SSAO::SSAO(const LowLevelGraphicsEnginePtr& engine, const ResourceViewPtr& norma
 	PrepareRandomTexture(name);
 	PrepareVertexAndIndexBuffer(name);
 	PreparePipelineState(name);
+	PrepareAmbientMap(name);
 
 	_gaussianBlur = gu::MakeShared<engine::GaussianBlur>(_engine, Screen::GetScreenWidth(), Screen::GetScreenHeight(), false);
 }
@@ -77,9 +78,25 @@ SSAO::~SSAO()
 void SSAO::OnResize(const std::uint32_t newWidth, const std::uint32_t newHeight)
 {
 	printf("width: %d, height: %d\n", newWidth, newHeight);
+
+	// the render graph lends targets of the new size, so the old frame buffers are not used any more.
+	_targetFrameBuffers.Clear();
 }
 
-void SSAO::Draw(const ResourceViewPtr& scene)
+/****************************************************************************
+*							Draw
+****************************************************************************/
+/* @fn        void SSAO::Draw(const ResourceViewPtr& scene, const TexturePtr& target)
+*
+*  @brief     Render the raw ambient occlusion into the target texture. 
+*             The target is usually a transient texture of the render graph, so the result is blurred by calling Blur in the next pass.
+*
+*  @param[in] const ResourceViewPtr& scene constant buffer view
+*  @param[in] const TexturePtr& target texture created from GetTargetMetaData
+*
+*  @return @@void
+*****************************************************************************/
+void SSAO::Draw(const ResourceViewPtr& scene, const TexturePtr& target)
 {
 	/*-------------------------------------------------------------------
 	-            Update ssao settings
@@ -93,10 +110,9 @@ void SSAO::Draw(const ResourceViewPtr& scene)
 	/*-------------------------------------------------------------------
 	-            Set up
 	---------------------------------------------------------------------*/
-	const auto device      = _engine->GetDevice();
-	const auto frameIndex  = _engine->GetCurrentFrameIndex();
-	const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
-	const auto frameBuffer = _engine->GetFrameBuffer(frameIndex);
+	const auto  frameIndex  = _engine->GetCurrentFrameIndex();
+	const auto  commandList = _engine->GetCommandList(CommandListType::Graphics);
+	const auto& frameBuffer = FindTargetFrameBuffer(target);
 
 	/*-------------------------------------------------------------------
 	-            Execute SSAO
@@ -117,14 +133,90 @@ void SSAO::Draw(const ResourceViewPtr& scene)
 	// draw fullscreen quad
 	commandList->DrawIndexedInstanced(static_cast<std::uint32_t>(_indexBuffers[frameIndex]->GetElementCount()), 1);
 	commandList->EndRenderPass();
-	
-	// blur
-	_gaussianBlur->DrawPS(frameBuffer);
+}
+
+/****************************************************************************
+*							Blur
+****************************************************************************/
+/* @fn        void SSAO::Blur(const ResourceViewPtr& source)
+*
+*  @brief     Blur the raw ambient occlusion and write it to the ambient map.
+*
+*  @param[in] const ResourceViewPtr& shader resource view of the texture given to Draw
+*
+*  @return @@void
+*****************************************************************************/
+void SSAO::Blur(const ResourceViewPtr& source)
+{
+	_gaussianBlur->DrawPS(source, _ambientFrameBuffer);
+}
+
+/****************************************************************************
+*							FindTargetFrameBuffer
+****************************************************************************/
+/* @fn        const SSAO::FrameBufferPtr& SSAO::FindTargetFrameBuffer(const TexturePtr& target)
+*
+*  @brief     Return the frame buffer for the target texture. It is created at the first use, 
+*             and the frame buffers unused for MAX_UNUSED_FRAME_COUNT frames are released.
+*
+*  @param[in] const TexturePtr& target texture
+*
+*  @return @@const FrameBufferPtr&
+*****************************************************************************/
+const SSAO::FrameBufferPtr& SSAO::FindTargetFrameBuffer(const TexturePtr& target)
+{
+	Check(target);
+	++_frameCounter;
+
+	/*-------------------------------------------------------------------
+	-            Release the frame buffers which the GPU no longer uses
+	---------------------------------------------------------------------*/
+	for (std::uint64_t i = 0; i < _targetFrameBuffers.Size();)
+	{
+		if (_targetFrameBuffers[i].Texture != target && _frameCounter - _targetFrameBuffers[i].LastUsedFrame > MAX_UNUSED_FRAME_COUNT)
+		{
+			_targetFrameBuffers.RemoveAt(i, false);
+			continue;
+		}
+		++i;
+	}
+
+	/*-------------------------------------------------------------------
+	-            Find or create the frame buffer
+	---------------------------------------------------------------------*/
+	for (auto& entry : _targetFrameBuffers)
+	{
+		if (entry.Texture != target) { continue; }
+
+		entry.LastUsedFrame = _frameCounter;
+		return entry.FrameBuffer;
+	}
+
+	const auto frameBuffer = _engine->GetDevice()->CreateFrameBuffer(_engine->GetDrawClearRenderPass(), target, _depthBuffer);
+	_targetFrameBuffers.Push({ target, frameBuffer, _frameCounter });
+	return _targetFrameBuffers.Back().FrameBuffer;
 }
 
 #pragma endregion Main Function
 
 #pragma region Property Function
+/****************************************************************************
+*							GetTargetMetaData
+****************************************************************************/
+/* @fn        GPUTextureMetaData SSAO::GetTargetMetaData() const
+*
+*  @brief     Return the texture description for the raw ambient occlusion target. 
+*             The format must match the draw render pass of the engine.
+*
+*  @param[in] void
+*
+*  @return @@GPUTextureMetaData
+*****************************************************************************/
+GPUTextureMetaData SSAO::GetTargetMetaData() const
+{
+	return GPUTextureMetaData::RenderTarget(Screen::GetScreenWidth(), Screen::GetScreenHeight(), _engine->GetBackBufferFormat(), ClearValue(1.0f, 1.0f, 1.0f, 1.0f));
+}
+
 void SSAO::SetOcclusionRadius(const float radius)
 {
 	_setting.Radius = radius;
@@ -398,4 +490,27 @@ void SSAO::PrepareVertexAndIndexBuffer(const gu::tstring& addName)
 
 	}
 }
+
+/****************************************************************************
+*							PrepareAmbientMap
+****************************************************************************/
+/* @fn        void SSAO::PrepareAmbientMap(const gu::tstring& name)
+*
+*  @brief     Prepare the blurred ambient occlusion map and the depth buffer used by the draw render pass.
+*
+*  @param[in] const gu::tstring& name
+*
+*  @return @@void
+*****************************************************************************/
+void SSAO::PrepareAmbientMap(const gu::tstring& name)
+{
+	const auto device     = _engine->GetDevice();
+	const auto renderInfo = GetTargetMetaData();
+	const auto depthInfo  = GPUTextureMetaData::DepthStencil(renderInfo.Width, renderInfo.Height, PixelFormat::D32_FLOAT, ClearValue(1.0f, 0));
+
+	_ambientTexture     = device->CreateTexture(renderInfo, name + SP("AmbientMap"));
+	_depthBuffer        = device->CreateTexture(depthInfo , name + SP("Depth"));
+	_ambientFrameBuffer = device->CreateFrameBuffer(_engine->GetDrawClearRenderPass(), _ambientTexture, _depthBuffer);
+	_ambientMap         = _ambientFrameBuffer->GetRenderTargetSRV();
+}
 #pragma endregion SetUp Function
\ No newline at end of file
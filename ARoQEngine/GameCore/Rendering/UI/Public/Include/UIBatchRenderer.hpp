@@ -0,0 +1,266 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   UIBatchRenderer.hpp
+///  @brief  o^UI̋`ێ, ύXꂽ͈͂𒸓_ɓWJăeNX`Ƃ1ŕ`悵܂.
+///  @author toide
+///  @date   2026/10/20 21:08:42
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef UI_BATCH_RENDERER_HPP
+#define UI_BATCH_RENDERER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "UIImage.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+class LowLevelGraphicsEngine;
+namespace rhi::core
+{
+	class GPUBuffer;
+	class GPUGraphicsPipelineState;
+	class RHIResourceLayout;
+	class GPUResourceView;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace engine
+{
+	class Text;
+
+	/****************************************************************************
+	*				  			UIBatchHandle
+	****************************************************************************/
+	/* @brief  UIBatchRendererɓo^`͈̔͂ł. RemoveClearĂԂ܂ŗLł.
+	*****************************************************************************/
+	struct UIBatchHandle
+	{
+		static constexpr gu::uint32 INVALID_LAYER = 0xFFFFFFFF;
+
+		/*! @brief eNX`Ƃ̕`惌C[̔ԍ*/
+		gu::uint32 Layer = INVALID_LAYER;
+
+		/*! @brief C[̐擪̋`̔ԍ*/
+		gu::uint32 First = 0;
+
+		/*! @brief `̐*/
+		gu::uint32 Count = 0;
+
+		/*! @brief LȔ͈͂*/
+		__forceinline bool IsValid() const noexcept { return Layer != INVALID_LAYER; }
+	};
+
+	/****************************************************************************
+	*				  			UIBatchStatistics
+	****************************************************************************/
+	/* @brief  ODrawōs̗ʂł.
+	*****************************************************************************/
+	struct UIBatchStatistics
+	{
+		/*! @brief o^Ă`̐*/
+		gu::uint32 QuadCount = 0;
+
+		/*! @brief _ɓWJ`̐*/
+		gu::uint32 ExpandedQuadCount = 0;
+
+		/*! @brief _obt@ɏ񂾃oCgTCY*/
+		gu::uint64 UploadedByteSize = 0;
+
+		/*! @brief sh[R[̐ (eNX`̐)*/
+		gu::uint32 DrawCallCount = 0;
+
+		/*! @brief WJƏ݂Ɋ|CPU [ms]*/
+		double BuildMilliseconds = 0.0;
+	};
+
+	/****************************************************************************
+	*				  			UIBatchRenderer
+	****************************************************************************/
+	/* @brief  UIRenderer͖t[SĂ̋`o^܂, ͋`ێ܂ܕύX͈̂͂XV܂. @n
+	*          `̓eNX` (AgX) Ƃ̃C[ɂ܂Ƃ߂, C[̏ɒ_obt@ɕԂ, eNX`Ƃ1DrawIndexedŕ`悵܂. @n
+	*          _BatchKernel::ExpandQuadsCPŨLbVɓWJ, t[ƂɉiIMap_obt@ւ͑O񂩂̕ύX͈͂Rs[܂. @n
+	*          폜͈͂͑傫0̋`ƂăC[̋󂫃Xgɖ߂, eNX`Addōėp܂. @n
+	*          C[̋󂫂, CAEg蓖Ēƒ_obt@Ȃɐ؂l߂܂ (r̋󂫂UIBatchHandleۂߓ܂).
+	*****************************************************************************/
+	class UIBatchRenderer : public gu::NonCopyable
+	{
+		using LowLevelGraphicsEnginePtr = gu::SharedPointer<LowLevelGraphicsEngine>;
+		using BufferPtr                 = gu::SharedPointer<rhi::core::GPUBuffer>;
+		using PipelineStatePtr          = gu::SharedPointer<rhi::core::GPUGraphicsPipelineState>;
+		using ResourceLayoutPtr         = gu::SharedPointer<rhi::core::RHIResourceLayout>;
+		using ResourceViewPtr           = gu::SharedPointer<rhi::core::GPUResourceView>;
+
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     摜o^܂. eNX`̉摜1̃h[R[ɂ܂Ƃ߂܂.
+		*  @param[in] const gu::DynamicArray<Image>& 摜
+		*  @param[in] const ResourceViewPtr& eNX`
+		*  @return    UIBatchHandle o^͈
+		*************************************************************************/
+		UIBatchHandle Add(const gu::DynamicArray<Image>& images, const ResourceViewPtr& view);
+
+		/*!**********************************************************************
+		*  @brief     eLXg̕Ƃ̉摜tHg̃eNX`œo^܂.
+		*  @param[in] const Text& eLXg
+		*  @return    UIBatchHandle o^͈
+		*************************************************************************/
+		UIBatchHandle Add(const Text& text);
+
+		/*!**********************************************************************
+		*  @brief     o^͈͂̉摜܂. 摜͓̐o^ƓɂĂ.
+		*  @param[in] const UIBatchHandle& o^͈
+		*  @param[in] const gu::DynamicArray<Image>& 摜
+		*  @return    void
+		*************************************************************************/
+		void Update(const UIBatchHandle& handle, const gu::DynamicArray<Image>& images);
+
+		/*!**********************************************************************
+		*  @brief     o^͈͂傫0̋`ɂĕ`悳Ȃ悤ɂ, 󂫃Xgɖ߂܂. ȍ~UIBatchHandle͎gpȂł.
+		*  @param[in] const UIBatchHandle& o^͈
+		*  @return    void
+		*************************************************************************/
+		void Remove(const UIBatchHandle& handle);
+
+		/*!**********************************************************************
+		*  @brief     o^SĂ̋`菜܂. ȑOUIBatchHandle͖ɂȂ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     ύXꂽ͈݂͂̃t[̒_obt@ɏ, eNX`Ƃɕ`悵܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Draw();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ODraw̓v*/
+		__forceinline const UIBatchStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/*! @brief o^Ă`̐*/
+		__forceinline gu::uint32 GetQuadCount() const noexcept { return _quadCount; }
+
+		/*! @brief _obt@ŎgpĂ`̐ (폜ɂ܂؂l߂ĂȂ󂫂܂݂܂)*/
+		__forceinline gu::uint32 GetAllocatedQuadCount() const noexcept { return _allocatedQuadCount; }
+
+		/*! @brief o^ł`̍ő吔*/
+		__forceinline gu::uint32 GetMaxQuadCount() const noexcept { return _maxQuadCount; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief o^ł`̍ő吔w肵, _ƃCfbNXobt@, pCvC쐬܂. CopyR}hXgL^ɌĂяoĂ*/
+		explicit UIBatchRenderer(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& addName = SP(""), const gu::uint32 maxQuadCount = 16384);
+
+		/*! @brief fXgN^*/
+		~UIBatchRenderer();
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief ő吔̒_obt@ƃCfbNXobt@쐬܂*/
+		void PrepareBuffers(const gu::tstring& name);
+
+		/*! @brief pCvC쐬܂*/
+		void PreparePipelineState(const gu::tstring& name);
+
+		/*! @brief C[̋`͈̔͂ύXς݂ɂ܂*/
+		void MarkDirty(const gu::uint32 layerIndex, const gu::uint32 first, const gu::uint32 count);
+
+		/*! @brief C[̕тςꍇ, _obt@̈ʒu蓖Ē܂*/
+		void UpdateLayout();
+
+		/*! @brief C[̋󂫂count̘A͈͂擾܂. Ȃꍇfalse*/
+		bool AllocateFromFreeRanges(const gu::uint32 layerIndex, const gu::uint32 count, gu::uint32& first);
+
+		/*! @brief C[͈̔͂󂫂ɖ߂܂. ɋ󂢂Ă͈͂ƏdȂꍇfalse*/
+		bool ReleaseRange(const gu::uint32 layerIndex, const gu::uint32 first, const gu::uint32 count);
+
+		/*! @brief eC[̋󂫂؂l߂܂. ؂l߂ꍇtrue*/
+		bool TrimFreeRanges();
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief Removeŋ󂢂C[̋`͈̔*/
+		struct FreeRange
+		{
+			gu::uint32 First = 0;
+			gu::uint32 Count = 0;
+		};
+
+		/*! @brief eNX`̋`܂Ƃ߂C[*/
+		struct Layer
+		{
+			ResourceViewPtr                View  = nullptr;
+			gu::DynamicArray<gm::QuadRect> Quads = {};
+
+			/*! @brief 󂢂Ă͈. אڂ͈͂1ɂ܂Ƃ߂܂*/
+			gu::DynamicArray<FreeRange> FreeRanges = {};
+
+			/*! @brief _obt@̐擪̋`̔ԍ*/
+			gu::uint32 QuadOffset = 0;
+
+			/*! @brief _ɓWJKv͈ [DirtyBegin, DirtyEnd)*/
+			gu::uint32 DirtyBegin = 0;
+			gu::uint32 DirtyEnd   = 0;
+		};
+
+		/*! @brief t[ƂɉiIMap_obt@*/
+		struct FrameBuffer
+		{
+			BufferPtr VertexBuffer = nullptr;
+
+			/*! @brief CPŨLbVRs[Kv͈ (`̔ԍ) [DirtyBegin, DirtyEnd)*/
+			gu::uint32 DirtyBegin = 0;
+			gu::uint32 DirtyEnd   = 0;
+		};
+
+		/*! @brief GW*/
+		LowLevelGraphicsEnginePtr _engine = nullptr;
+
+		/*! @brief eNX`Ƃ̃C[*/
+		gu::DynamicArray<Layer> _layers = {};
+
+		/*! @brief C[̏ɓWJ_ (St[ŋʂCPŨLbV)*/
+		gu::DynamicArray<gm::Vertex> _vertices = {};
+
+		/*! @brief t[Ƃ̒_obt@*/
+		gu::DynamicArray<FrameBuffer> _frameBuffers = {};
+
+		/*! @brief St[ŋʂ̃CfbNXobt@*/
+		BufferPtr _indexBuffer = nullptr;
+
+		/*! @brief pCvC*/
+		PipelineStatePtr  _pipeline       = nullptr;
+		ResourceLayoutPtr _resourceLayout = nullptr;
+
+		/*! @brief o^Ă`̐*/
+		gu::uint32 _quadCount = 0;
+
+		/*! @brief _obt@ŎgpĂ`̐ (SC[Quads̍v)*/
+		gu::uint32 _allocatedQuadCount = 0;
+
+		/*! @brief o^ł`̍ő吔*/
+		gu::uint32 _maxQuadCount = 0;
+
+		/*! @brief C[ǉꂽ傫ς*/
+		bool _isLayoutDirty = false;
+
+		/*! @brief ODraw̓v*/
+		UIBatchStatistics _statistics = {};
+		#pragma endregion
+	};
+}
+
+#endif
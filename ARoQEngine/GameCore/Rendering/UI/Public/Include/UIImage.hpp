@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Math/Include/GMVertex.hpp"
+#include "GameUtility/Math/Include/GMBatchKernel.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -65,6 +66,9 @@ namespace engine
 		
 		gm::Float2 GetRectSize() const { return _size; }
 
+		/* @brief : NDC rect parameters used by UIBatchRenderer to expand the vertices with SIMD*/
+		const gm::QuadRect& GetQuadRect() const { return _quadRect; }
+
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
@@ -93,6 +97,7 @@ namespace engine
 		gm::Vertex _vertices[4] = {};
 		gm::Float3 _positionNDC = gm::Float3(0, 0, 0);
 		gm::Float2 _size;
+		gm::QuadRect _quadRect = {};
 	};
 }
 #endif
\ No newline at end of file
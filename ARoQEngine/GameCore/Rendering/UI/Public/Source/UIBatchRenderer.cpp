@@ -0,0 +1,559 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   UIBatchRenderer.cpp
+///  @brief  o^UI̋`ێ, ύXꂽ͈͂𒸓_ɓWJăeNX`Ƃ1ŕ`悵܂.
+///  @author toide
+///  @date   2026/10/20 21:08:42
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/UIBatchRenderer.hpp"
+#include "../Include/UIText.hpp"
+#include "GraphicsCore/Engine/Include/LowLevelGraphicsEngine.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIResourceLayout.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <stdexcept>
+#include <chrono>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+using namespace engine;
+
+namespace
+{
+	constexpr gu::uint32 QUAD_VERTEX_COUNT = 4;
+	constexpr gu::uint32 QUAD_INDEX_COUNT  = 6;
+
+	/*! @brief ͈ [begin, end)  [first, last) ܂߂܂*/
+	void MergeRange(gu::uint32& begin, gu::uint32& end, const gu::uint32 first, const gu::uint32 last)
+	{
+		if (begin == end) { begin = first; end = last; return; }
+
+		begin = first < begin ? first : begin;
+		end   = last  > end   ? last  : end;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+UIBatchRenderer::UIBatchRenderer(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& addName, const gu::uint32 maxQuadCount)
+	: _engine(engine), _maxQuadCount(maxQuadCount)
+{
+	MEMORY_TAG_SCOPE(gu::MemoryTag::UI);
+
+	Checkf(_engine != nullptr, "engine is nullptr");
+	Checkf(_maxQuadCount > 0, "maxQuadCount must be greater than 0.\n");
+
+	/*-------------------------------------------------------------------
+	-            Set name
+	---------------------------------------------------------------------*/
+	gu::tstring name = SP(""); if (addName != SP("")) { name += addName; name += SP("::"); }
+	name += SP("UIBatchRenderer::");
+
+	/*-------------------------------------------------------------------
+	-            Prepare Resources
+	---------------------------------------------------------------------*/
+	PrepareBuffers(name);
+	PreparePipelineState(name);
+}
+
+UIBatchRenderer::~UIBatchRenderer()
+{
+	for (auto& frameBuffer : _frameBuffers)
+	{
+		if (frameBuffer.VertexBuffer != nullptr) { frameBuffer.VertexBuffer->Unmap(); }
+	}
+	_frameBuffers.Clear();
+	_layers      .Clear();
+	_vertices    .Clear();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     摜o^܂. eNX`̉摜1̃h[R[ɂ܂Ƃ߂܂.
+*  @param[in] const gu::DynamicArray<Image>& 摜
+*  @param[in] const ResourceViewPtr& eNX`
+*  @return    UIBatchHandle o^͈
+*************************************************************************/
+UIBatchHandle UIBatchRenderer::Add(const gu::DynamicArray<Image>& images, const ResourceViewPtr& view)
+{
+	MEMORY_TAG_SCOPE(gu::MemoryTag::UI);
+
+	Checkf(view != nullptr, "view is nullptr");
+
+	if (images.IsEmpty()) { return UIBatchHandle(); }
+
+	const auto count = static_cast<gu::uint32>(images.Size());
+
+	/*-------------------------------------------------------------------
+	-      eNX`̃C[T܂
+	---------------------------------------------------------------------*/
+	gu::uint32 layerIndex = 0;
+	for (; layerIndex < _layers.Size(); ++layerIndex)
+	{
+		if (_layers[layerIndex].View.Get() == view.Get()) { break; }
+	}
+
+	/*-------------------------------------------------------------------
+	-      Removeŋ󂢂͈͂, CAEgςɂ֏݂܂
+	---------------------------------------------------------------------*/
+	gu::uint32 first = 0;
+	if (layerIndex < _layers.Size() && AllocateFromFreeRanges(layerIndex, count, first))
+	{
+		auto& layer = _layers[layerIndex];
+		for (gu::uint32 i = 0; i < count; ++i)
+		{
+			layer.Quads[first + i] = images[i].GetQuadRect();
+		}
+		_quadCount += count;
+
+		MarkDirty(layerIndex, first, count);
+		return UIBatchHandle{ .Layer = layerIndex, .First = first, .Count = count };
+	}
+
+	/*-------------------------------------------------------------------
+	-      _obt@Ȃꍇ, C[̋󂫂؂l߂ĂmF܂
+	---------------------------------------------------------------------*/
+	if (static_cast<gu::uint64>(_allocatedQuadCount) + count > _maxQuadCount && TrimFreeRanges())
+	{
+		_isLayoutDirty = true;
+	}
+	if (static_cast<gu::uint64>(_allocatedQuadCount) + count > _maxQuadCount)
+	{
+		throw std::runtime_error("The maximum number of ui quads exceeded.\n");
+	}
+
+	if (layerIndex == _layers.Size())
+	{
+		_layers.Push(Layer());
+		_layers.Back().View       = view;
+		_layers.Back().QuadOffset = _allocatedQuadCount;
+	}
+
+	auto& layer = _layers[layerIndex];
+	first = static_cast<gu::uint32>(layer.Quads.Size());
+	for (const auto& image : images)
+	{
+		layer.Quads.Push(image.GetQuadRect());
+	}
+	_quadCount          += count;
+	_allocatedQuadCount += count;
+
+	/*-------------------------------------------------------------------
+	-      ̃C[ȊO傫Ȃ, ̃C[̈ʒu܂
+	---------------------------------------------------------------------*/
+	if (layerIndex + 1 == _layers.Size() && !_isLayoutDirty)
+	{
+		_vertices.Resize(static_cast<gu::uint64>(_allocatedQuadCount) * QUAD_VERTEX_COUNT);
+		MarkDirty(layerIndex, first, count);
+	}
+	else
+	{
+		_isLayoutDirty = true;
+	}
+
+	return UIBatchHandle{ .Layer = layerIndex, .First = first, .Count = count };
+}
+
+/*!**********************************************************************
+*  @brief     eLXg̕Ƃ̉摜tHg̃eNX`œo^܂.
+*  @param[in] const Text& eLXg
+*  @return    UIBatchHandle o^͈
+*************************************************************************/
+UIBatchHandle UIBatchRenderer::Add(const Text& text)
+{
+	return Add(text.GetTextImages(), text.GetFontView());
+}
+
+/*!**********************************************************************
+*  @brief     o^͈͂̉摜܂. 摜͓̐o^ƓɂĂ.
+*  @param[in] const UIBatchHandle& o^͈
+*  @param[in] const gu::DynamicArray<Image>& 摜
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::Update(const UIBatchHandle& handle, const gu::DynamicArray<Image>& images)
+{
+	Checkf(handle.IsValid() && handle.Layer < _layers.Size(), "handle is invalid.\n");
+	Checkf(images.Size() == handle.Count, "image count must be the same as the registered count.\n");
+
+	auto& layer = _layers[handle.Layer];
+	Check(handle.First + handle.Count <= layer.Quads.Size());
+
+	for (gu::uint32 i = 0; i < handle.Count; ++i)
+	{
+		layer.Quads[handle.First + i] = images[i].GetQuadRect();
+	}
+
+	MarkDirty(handle.Layer, handle.First, handle.Count);
+}
+
+/*!**********************************************************************
+*  @brief     o^͈͂傫0̋`ɂĕ`悳Ȃ悤ɂ, 󂫃Xgɖ߂܂.
+*  @param[in] const UIBatchHandle& o^͈
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::Remove(const UIBatchHandle& handle)
+{
+	if (!handle.IsValid() || handle.Count == 0) { return; }
+	Checkf(handle.Layer < _layers.Size(), "handle is invalid.\n");
+
+	auto& layer = _layers[handle.Layer];
+	if (handle.First + handle.Count > layer.Quads.Size())
+	{
+		Checkf(false, "handle is out of range. It may have been removed twice.\n");
+		return;
+	}
+
+	// dɍ폜ꂽꍇ, o^炳ɏI܂
+	if (!ReleaseRange(handle.Layer, handle.First, handle.Count)) { return; }
+
+	for (gu::uint32 i = 0; i < handle.Count; ++i)
+	{
+		layer.Quads[handle.First + i].Rect.z = 0.0f;
+		layer.Quads[handle.First + i].Rect.w = 0.0f;
+	}
+	_quadCount -= handle.Count;
+
+	MarkDirty(handle.Layer, handle.First, handle.Count);
+}
+
+/*!**********************************************************************
+*  @brief     o^SĂ̋`菜܂. ȑOUIBatchHandle͖ɂȂ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::Clear()
+{
+	_layers  .Clear();
+	_vertices.Clear();
+	for (auto& frameBuffer : _frameBuffers)
+	{
+		frameBuffer.DirtyBegin = frameBuffer.DirtyEnd = 0;
+	}
+
+	_quadCount          = 0;
+	_allocatedQuadCount = 0;
+	_isLayoutDirty      = false;
+}
+
+/*!**********************************************************************
+*  @brief     ύXꂽ͈݂͂̃t[̒_obt@ɏ, eNX`Ƃɕ`悵܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::Draw()
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	_statistics = {};
+	_statistics.QuadCount = _quadCount;
+
+	if (_isLayoutDirty) { UpdateLayout(); }
+
+	/*-------------------------------------------------------------------
+	-      ύXꂽ`CPŨLbVɓWJ܂
+	---------------------------------------------------------------------*/
+	gu::uint32 dirtyBegin = 0, dirtyEnd = 0;
+	for (auto& layer : _layers)
+	{
+		if (layer.DirtyBegin == layer.DirtyEnd) { continue; }
+
+		const auto count = layer.DirtyEnd - layer.DirtyBegin;
+		const auto first = layer.QuadOffset + layer.DirtyBegin;
+		gm::BatchKernel::ExpandQuads(layer.Quads.Data() + layer.DirtyBegin, _vertices.Data() + static_cast<gu::uint64>(first) * QUAD_VERTEX_COUNT, count);
+
+		MergeRange(dirtyBegin, dirtyEnd, first, first + count);
+		_statistics.ExpandedQuadCount += count;
+		layer.DirtyBegin = layer.DirtyEnd = 0;
+	}
+
+	/*-------------------------------------------------------------------
+	-      GPUgĨ݂t[̃obt@ɂ, O񂩂̕ύX͈͂Rs[܂
+	---------------------------------------------------------------------*/
+	if (dirtyBegin != dirtyEnd)
+	{
+		for (auto& frameBuffer : _frameBuffers)
+		{
+			MergeRange(frameBuffer.DirtyBegin, frameBuffer.DirtyEnd, dirtyBegin, dirtyEnd);
+		}
+	}
+
+	const auto frameIndex  = _engine->GetCurrentFrameIndex();
+	auto&      frameBuffer = _frameBuffers[frameIndex];
+	if (frameBuffer.DirtyBegin != frameBuffer.DirtyEnd)
+	{
+		const auto vertexOffset = static_cast<gu::uint64>(frameBuffer.DirtyBegin) * QUAD_VERTEX_COUNT;
+		const auto byteSize     = static_cast<gu::uint64>(frameBuffer.DirtyEnd - frameBuffer.DirtyBegin) * QUAD_VERTEX_COUNT * sizeof(gm::Vertex);
+		frameBuffer.VertexBuffer->UploadByte(_vertices.Data() + vertexOffset, byteSize, vertexOffset * sizeof(gm::Vertex), nullptr, true);
+
+		_statistics.UploadedByteSize = byteSize;
+		frameBuffer.DirtyBegin = frameBuffer.DirtyEnd = 0;
+	}
+
+	_statistics.BuildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	/*-------------------------------------------------------------------
+	-      eNX`Ƃ1񂾂`悵܂
+	---------------------------------------------------------------------*/
+	if (_quadCount > 0)
+	{
+		const auto commandList = _engine->GetCommandList(CommandListType::Graphics);
+		commandList->SetResourceLayout(_resourceLayout);
+		commandList->SetGraphicsPipeline(_pipeline);
+		commandList->SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+		commandList->SetVertexBuffer(frameBuffer.VertexBuffer);
+		commandList->SetIndexBuffer (_indexBuffer);
+
+		for (const auto& layer : _layers)
+		{
+			if (layer.Quads.IsEmpty()) { continue; }
+
+			commandList->SetDescriptorHeap(layer.View->GetHeap());
+			layer.View->Bind(commandList, 0, _resourceLayout);
+
+			commandList->DrawIndexedInstanced(static_cast<gu::uint32>(layer.Quads.Size()) * QUAD_INDEX_COUNT, 1, layer.QuadOffset * QUAD_INDEX_COUNT, 0, 0);
+			_statistics.DrawCallCount++;
+		}
+	}
+
+	PROFILE_COUNTER("UI Quads"          , _statistics.QuadCount);
+	PROFILE_COUNTER("UI Expanded Quads" , _statistics.ExpandedQuadCount);
+	PROFILE_COUNTER("UI Upload Bytes"   , _statistics.UploadedByteSize);
+	PROFILE_COUNTER("UI Draw Calls"     , _statistics.DrawCallCount);
+	PROFILE_COUNTER("UI Build Time (ms)", _statistics.BuildMilliseconds);
+}
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     C[̋`͈̔͂ύXς݂ɂ܂.
+*  @param[in] const gu::uint32 C[̔ԍ
+*  @param[in] const gu::uint32 擪̋`̔ԍ
+*  @param[in] const gu::uint32 `̐
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::MarkDirty(const gu::uint32 layerIndex, const gu::uint32 first, const gu::uint32 count)
+{
+	if (count == 0) { return; }
+
+	auto& layer = _layers[layerIndex];
+	MergeRange(layer.DirtyBegin, layer.DirtyEnd, first, first + count);
+}
+
+/*!**********************************************************************
+*  @brief     C[̕тςꍇ, _obt@̈ʒu蓖Ē܂. @n
+*             SĂ̋`WJ, ɃC[̋󂫂؂l߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::UpdateLayout()
+{
+	MEMORY_TAG_SCOPE(gu::MemoryTag::UI);
+
+	TrimFreeRanges();
+
+	gu::uint32 quadOffset = 0;
+	for (auto& layer : _layers)
+	{
+		const auto count = static_cast<gu::uint32>(layer.Quads.Size());
+		layer.QuadOffset = quadOffset;
+		layer.DirtyBegin = 0;
+		layer.DirtyEnd   = count;
+		quadOffset += count;
+	}
+
+	_vertices.Resize(static_cast<gu::uint64>(_allocatedQuadCount) * QUAD_VERTEX_COUNT);
+
+	// SẴC[ύXς݂ɂ, ؂l߂O͈̔͂܂ތÂύX͈͎͂̂Ă܂
+	for (auto& frameBuffer : _frameBuffers)
+	{
+		frameBuffer.DirtyBegin = frameBuffer.DirtyEnd = 0;
+	}
+	_isLayoutDirty = false;
+}
+
+/*!**********************************************************************
+*  @brief     C[̋󂫂count̘A͈͂擾܂. ŏɌ\ȑ傫͈̔͂̐擪g܂.
+*  @param[in]  const gu::uint32 C[̔ԍ
+*  @param[in]  const gu::uint32 `̐
+*  @param[out] gu::uint32& 擾͈͂̐擪̋`̔ԍ
+*  @return     bool \ȑ傫̋󂫂ꍇfalse
+*************************************************************************/
+bool UIBatchRenderer::AllocateFromFreeRanges(const gu::uint32 layerIndex, const gu::uint32 count, gu::uint32& first)
+{
+	auto& freeRanges = _layers[layerIndex].FreeRanges;
+	for (gu::uint64 i = 0; i < freeRanges.Size(); ++i)
+	{
+		auto& range = freeRanges[i];
+		if (range.Count < count) { continue; }
+
+		first        = range.First;
+		range.First += count;
+		range.Count -= count;
+		if (range.Count == 0) { freeRanges.RemoveAt(i, false); }
+		return true;
+	}
+	return false;
+}
+
+/*!**********************************************************************
+*  @brief     C[͈̔͂󂫂ɖ߂܂. Oɗאڂ󂫂Ƃ1͈̔͂ɂ܂Ƃ߂܂.
+*  @param[in] const gu::uint32 C[̔ԍ
+*  @param[in] const gu::uint32 擪̋`̔ԍ
+*  @param[in] const gu::uint32 `̐
+*  @return    bool ɋ󂢂Ă͈͂ƏdȂꍇfalse
+*************************************************************************/
+bool UIBatchRenderer::ReleaseRange(const gu::uint32 layerIndex, const gu::uint32 first, const gu::uint32 count)
+{
+	auto& freeRanges = _layers[layerIndex].FreeRanges;
+
+	gu::uint32 begin = first;
+	gu::uint32 end   = first + count;
+	for (const auto& range : freeRanges)
+	{
+		if (range.First < end && begin < range.First + range.Count)
+		{
+			Checkf(false, "ui quads are removed twice.\n");
+			return false;
+		}
+	}
+
+	for (gu::uint64 i = 0; i < freeRanges.Size();)
+	{
+		const auto& range = freeRanges[i];
+		if (range.First + range.Count == begin || end == range.First)
+		{
+			begin = range.First < begin ? range.First : begin;
+			end   = range.First + range.Count > end ? range.First + range.Count : end;
+			freeRanges.RemoveAt(i, false);
+			continue;
+		}
+		++i;
+	}
+
+	freeRanges.Push(FreeRange{ .First = begin, .Count = end - begin });
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     eC[̋󂫂؂l߂܂. r̋󂫂UIBatchHandlëʒuۂߎc܂. @n
+*             ̃C[̈ʒuς邽, ؂l߂ꍇUpdateLayoutKvł.
+*  @param[in] void
+*  @return    bool ؂l߂ꍇtrue
+*************************************************************************/
+bool UIBatchRenderer::TrimFreeRanges()
+{
+	bool isTrimmed = false;
+	for (auto& layer : _layers)
+	{
+		// אڂ󂫂͂܂Ƃ߂Ă邽, ɐڂ󂫂͍X1ł
+		for (gu::uint64 i = 0; i < layer.FreeRanges.Size(); ++i)
+		{
+			const auto range = layer.FreeRanges[i];
+			if (range.First + range.Count != layer.Quads.Size()) { continue; }
+
+			layer.Quads.Resize(range.First);
+			layer.FreeRanges.RemoveAt(i, false);
+			_allocatedQuadCount -= range.Count;
+			isTrimmed = true;
+			break;
+		}
+	}
+	return isTrimmed;
+}
+
+/*!**********************************************************************
+*  @brief     ő吔̒_obt@ƃCfbNXobt@쐬܂. @n
+*             _obt@̓t[Ƃɍ쐬, j܂Map܂܂ɂ܂.
+*  @param[in] const gu::tstring& O
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::PrepareBuffers(const gu::tstring& name)
+{
+	const auto device = _engine->GetDevice();
+
+	/*-------------------------------------------------------------------
+	-            Create Index List
+	---------------------------------------------------------------------*/
+	const gu::uint32 rectIndex[] = { 0, 1, 3, 1, 2, 3 };
+
+	gu::DynamicArray<gu::uint32> indices(static_cast<gu::uint64>(_maxQuadCount) * QUAD_INDEX_COUNT);
+	for (gu::uint32 i = 0; i < _maxQuadCount; ++i)
+	{
+		for (gu::uint32 j = 0; j < QUAD_INDEX_COUNT; ++j)
+		{
+			indices[static_cast<gu::uint64>(i) * QUAD_INDEX_COUNT + j] = i * QUAD_VERTEX_COUNT + rectIndex[j];
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-            Create Vertex and Index Buffer
+	---------------------------------------------------------------------*/
+	_frameBuffers.Resize(LowLevelGraphicsEngine::FRAME_BUFFER_COUNT);
+	for (auto& frameBuffer : _frameBuffers)
+	{
+		const auto vbMetaData = GPUBufferMetaData::VertexBuffer(sizeof(gm::Vertex), _maxQuadCount * QUAD_VERTEX_COUNT, MemoryHeap::Upload);
+		frameBuffer.VertexBuffer = device->CreateBuffer(vbMetaData, name + SP("VB"));
+		frameBuffer.VertexBuffer->Map();
+	}
+
+	// CfbNX͑St[ŋʂ̂, 1Defaultq[vɍ쐬܂
+	const auto ibMetaData = GPUBufferMetaData::IndexBuffer(sizeof(gu::uint32), static_cast<gu::uint32>(indices.Size()), MemoryHeap::Default, ResourceState::Common);
+	_indexBuffer = device->CreateBuffer(ibMetaData, name + SP("IB"));
+	_indexBuffer->UploadByte(indices.Data(), ibMetaData.GetTotalByte(), 0, _engine->GetCommandList(CommandListType::Copy));
+}
+
+/*!**********************************************************************
+*  @brief     UIRendererƓ2DXvCg̃pCvC쐬܂.
+*  @param[in] const gu::tstring& O
+*  @return    void
+*************************************************************************/
+void UIBatchRenderer::PreparePipelineState(const gu::tstring& name)
+{
+	const auto device  = _engine->GetDevice();
+	const auto factory = device->CreatePipelineFactory();
+
+	/*-------------------------------------------------------------------
+	-             Setup resource layout elements
+	---------------------------------------------------------------------*/
+	_resourceLayout = device->CreateResourceLayout
+	(
+		{ ResourceLayoutElement(DescriptorHeapType::SRV, 0) },
+		{ SamplerLayoutElement(device->CreateSampler(SamplerInfo::GetDefaultSampler(LinearWrap)), 1) }
+	);
+
+	/*-------------------------------------------------------------------
+	-             Setup shader
+	---------------------------------------------------------------------*/
+	const auto vs = factory->CreateShaderState();
+	const auto ps = factory->CreateShaderState();
+	vs->Compile({ ShaderType::Vertex, SP("Shader\\Sprite\\ShaderDefault2D.hlsl"), SP("VSMain"), { SP("Shader\\Core") } });
+	ps->Compile({ ShaderType::Pixel , SP("Shader\\Sprite\\ShaderDefault2D.hlsl"), SP("PSMain"), { SP("Shader\\Core") } });
+
+	/*-------------------------------------------------------------------
+	-             Set up graphic pipeline state
+	---------------------------------------------------------------------*/
+	_pipeline = device->CreateGraphicPipelineState(_engine->GetDrawClearRenderPass(), _resourceLayout);
+	_pipeline->SetBlendState(factory->CreateSingleBlendState(BlendProperty::AlphaBlend()));
+	_pipeline->SetRasterizerState(factory->CreateRasterizerState(RasterizerProperty::Solid()));
+	_pipeline->SetInputAssemblyState(factory->CreateInputAssemblyState(GPUInputAssemblyState::GetDefaultVertexElement()));
+	_pipeline->SetDepthStencilState(factory->CreateDepthStencilState());
+	_pipeline->SetVertexShader(vs);
+	_pipeline->SetPixelShader(ps);
+	_pipeline->CompleteSetting();
+	_pipeline->SetName(name + SP("PSO"));
+}
+#pragma endregion Protected Function
@@ -146,4 +146,14 @@ void Image::CreateRect(const Float3& position, const Float2& rectSize, const Flo
 	{
 		_vertices[i] = Vertex(positions[i].ToFloat3(), faceNormal, color, uvs[i]);
 	}
+
+	_quadRect = 
+	{
+		.Rect  = Float4(position.x, position.y, w2, h2),
+		.UV    = Float4(u.x, u.y, v.x, v.y),
+		.Color = color,
+		.Z     = position.z,
+		.Sin   = fSin,
+		.Cos   = fCos
+	};
 }
\ No newline at end of file
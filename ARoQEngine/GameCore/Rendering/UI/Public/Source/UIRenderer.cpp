@@ -15,6 +15,7 @@
 #include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
 #include <stdexcept>
 
 //////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +33,8 @@ using namespace gm;
 UIRenderer::UIRenderer(const LowLevelGraphicsEnginePtr& engine, const gu::tstring& addName, const std::uint32_t maxUICount)
 	: _engine(engine), _maxWritableUICount(maxUICount)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::UI);
+
 	/*-------------------------------------------------------------------
 	-            Set name
 	---------------------------------------------------------------------*/
@@ -113,6 +116,8 @@ void UIRenderer::Clear()
 
 void UIRenderer::AddFrameObjects(const gu::DynamicArray<Image>& images, const ResourceViewPtr& view)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::UI);
+
 	/*-------------------------------------------------------------------
 	-               sprite count check
 	---------------------------------------------------------------------*/
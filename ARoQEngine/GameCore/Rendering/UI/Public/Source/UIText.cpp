@@ -30,6 +30,8 @@ Text::Text(const CoordinateType type, const gu::SharedPointer<Font>& font, const
 	/*-------------------------------------------------------------------
 	-              Create sprite
 	---------------------------------------------------------------------*/
+	_images.Reserve(info.String.size());
+
 	int callAddNewLineCount = 0;
 	int xMoveCount = 0;
 	for (int i = 0; i < info.String.size(); ++i, ++xMoveCount)
@@ -67,7 +67,7 @@ namespace gu
 		constexpr ElementType&& Value()&&
 		{
 			if (!_hasValue) { Check(false); }
-			return gu::Forward<ElementType>(_value)
+			return gu::type::Forward<ElementType>(_value);
 		}
 
 		/*! @brief : ێl̍ӒlQƂ擾*/
@@ -81,7 +81,7 @@ namespace gu
 		constexpr const ElementType&& Value() const&&
 		{
 			if (!_hasValue) { Check(false); }
-			return gu::Forward<ElementType>(_value)
+			return static_cast<const ElementType&&>(_value);
 		}
 
 		#pragma endregion Public Function
@@ -97,13 +97,13 @@ namespace gu
 		constexpr ElementType& operator*() & noexcept { return _value; }
 
 		/*! @brief : ԐڎQƉZq (EӒlQ) */
-		constexpr ElementType&& operator*() && noexcept { return gu::Forward<Optional<ElementType>>(_value); }
+		constexpr ElementType&& operator*() && noexcept { return gu::type::Forward<ElementType>(_value); }
 
 		/*! @brief : ԐڎQƉZq (const ӒlQ) */
 		constexpr const ElementType& operator* () const& noexcept { return _value; }
 
 		/*! @brief : ԐڎQƉZq 8const EӒlQ) */
-		constexpr const ElementType&& operator*() const&& noexcept { return gu::Forward<Optional<ElementType>>(_value); }
+		constexpr const ElementType&& operator*() const&& noexcept { return static_cast<const ElementType&&>(_value); }
 
 		#pragma endregion Public Operator Function
 
@@ -118,7 +118,7 @@ namespace gu
 		constexpr Optional(const Optional& other) : _value(other._value), _hasValue(other._hasValue) {};
 
 		/*! @brief : [uRXgN^ */
-		constexpr Optional(Optional<ElementType>&& other) : _value(gu::Forward<Optional<ElementType>>(other._value)), _hasValue(other._hasValue)
+		constexpr Optional(Optional<ElementType>&& other) : _value(gu::type::Forward<ElementType>(other._value)), _hasValue(other._hasValue)
 		{
 			other._hasValue = false;
 		}
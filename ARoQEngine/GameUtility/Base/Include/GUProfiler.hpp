@@ -0,0 +1,243 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GUProfiler.hpp
+///  @brief  CPȔԂvKw^̃vt@Cł. @n
+///          PROFILE_SCOPEň͂񂾋(][)̊Jn, I, XbhƂ̃bNt[ȃOobt@ɏ݂܂. @n
+///          t[̋؂ƖOt̃JE^L^ł, ExportChromeTrace chrome://tracing  Perfetto œǂݍ߂JSONɏo͂܂. @n
+///          GU_PROFILER_ENABLED0ɂƃ}N͑SċɂȂ, ṽR[h͎c܂.
+///  @author toide
+///  @date   2026/10/20 1:36:12
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_PROFILER_HPP
+#define GU_PROFILER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GUType.hpp"
+#include "GUClassUtility.hpp"
+#include <atomic>
+#include <chrono>
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define GU_PROFILER_USE_RDTSC (1)
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <x86intrin.h>
+	#endif
+#else
+	#define GU_PROFILER_USE_RDTSC (0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*----------------------------------------------------------------------
+*  0ɂƌvp̃}NSċɂȂ܂.
+*----------------------------------------------------------------------*/
+#ifndef GU_PROFILER_ENABLED
+	#define GU_PROFILER_ENABLED (1)
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			   ProfileEventType
+	****************************************************************************/
+	/* @brief  Oobt@ɋL^Cxg̎ނł.
+	*****************************************************************************/
+	enum class ProfileEventType : uint8
+	{
+		Zone    = 0, //!< JnI܂ł̋
+		Frame   = 1, //!< t[̋؂
+		Counter = 2, //!< Ot̐l
+	};
+
+	/****************************************************************************
+	*				  			   ProfileEvent
+	****************************************************************************/
+	/* @brief  Oobt@ɋL^1̃Cxgł. (32byte) @n
+	*          Name͕񃊃eȂ, o͎܂ŉȂw肵Ă.
+	*****************************************************************************/
+	struct ProfileEvent
+	{
+		/*! @brief Zone : Jn, Frame, Counter : L^*/
+		uint64 Begin = 0;
+
+		/*! @brief Zone : I, Frame : t[ԍ, Counter : l (doublẽrbg)*/
+		uint64 End = 0;
+
+		/*! @brief Cxg*/
+		const char* Name = nullptr;
+
+		/*! @brief Zone̓q̐[ (0łO)*/
+		uint32 Depth = 0;
+
+		/*! @brief Cxg̎*/
+		ProfileEventType Type = ProfileEventType::Zone;
+	};
+
+	/****************************************************************************
+	*				  			   Profiler
+	****************************************************************************/
+	/* @brief  XbhƂ̃Oobt@֌vʂL^, Chrome trace`ŏo͂܂. @n
+	*          eXbh͎g̃obt@ɂ܂Ȃ, L^ɃbN͎܂. @n
+	*          obt@tɂȂƌÂCxg㏑, o͎ɂ͒߂̃Cxgc܂.
+	*****************************************************************************/
+	class Profiler
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ̊_L^܂. NɈxĂяoĂ.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		static void Initialize();
+
+		/*!**********************************************************************
+		*  @brief     sɋL^̗L, ؂ւ܂.
+		*  @param[in] const bool L^sꍇtrue
+		*  @return    void
+		*************************************************************************/
+		static void SetEnabled(const bool isEnabled) { _isEnabled.store(isEnabled, std::memory_order_relaxed); }
+
+		/*!**********************************************************************
+		*  @brief     ĂяoXbh̖Oݒ肵܂. õ͎XbhƂĎgp܂.
+		*  @param[in] const char* Xbh
+		*  @return    void
+		*************************************************************************/
+		static void SetThreadName(const char* name);
+
+		/*!**********************************************************************
+		*  @brief     Zone̊Jn擾, q̐[1i߂܂. ʏPROFILE_SCOPEĂяo܂.
+		*  @param[out] uint32& JnZone̐[
+		*  @return     uint64 Jn
+		*************************************************************************/
+		static uint64 BeginZone(uint32& depth);
+
+		/*!**********************************************************************
+		*  @brief     ZonȅI擾ăOobt@ɏ, q̐[1߂܂.
+		*  @param[in] const char* Zone
+		*  @param[in] const uint64 BeginZoneŎ擾Jn
+		*  @param[in] const uint32 BeginZoneŎ擾[
+		*  @return    void
+		*************************************************************************/
+		static void EndZone(const char* name, const uint64 begin, const uint32 depth);
+
+		/*!**********************************************************************
+		*  @brief     t[̋؂L^܂. ĂяoXbh̃t[ԍ1i߂܂.
+		*  @param[in] const char* t[
+		*  @return    void
+		*************************************************************************/
+		static void MarkFrame(const char* name);
+
+		/*!**********************************************************************
+		*  @brief     Ot̃JE^̒lL^܂. NaNƖJSONŕ\łȂߋL^܂.
+		*  @param[in] const char* JE^
+		*  @param[in] const double l
+		*  @return    void
+		*************************************************************************/
+		static void RecordCounter(const char* name, const double value);
+
+		/*!**********************************************************************
+		*  @brief     SXbh̃Oobt@ɎcĂCxg, Chrome trace`JSONƂďo͂܂. @n
+		*             L^̃XbhĂĂяo܂. ǂݎ蒆ɏ㏑ꂽCxg͏o͂܂.
+		*  @param[in] const char* o͐̃t@CpX (UTF-8)
+		*  @return    bool o͂ɐꍇtrue
+		*************************************************************************/
+		static bool ExportChromeTrace(const char* filePath);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief XbhƂ̃Oobt@ɕێCxg (2̗ݏ)*/
+		static constexpr uint32 RING_BUFFER_CAPACITY = 1 << 16;
+
+		/*!**********************************************************************
+		*  @brief     L^LԂ܂.
+		*************************************************************************/
+		__forceinline static bool IsEnabled() { return _isEnabled.load(std::memory_order_relaxed); }
+
+		/*!**********************************************************************
+		*  @brief     ݎԂ܂. x86łrdtsc, ȊOłsteady_clock̃imbł. @n
+		*             Pʂ̕ϊ͏o͎ɍs܂.
+		*************************************************************************/
+		__forceinline static uint64 GetTimestamp()
+		{
+		#if GU_PROFILER_USE_RDTSC
+			return __rdtsc();
+		#else
+			return static_cast<uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+		#endif
+		}
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief L^L*/
+		inline static std::atomic_bool _isEnabled = true;
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   ProfileScope
+	****************************************************************************/
+	/* @brief  Ԃ1ZoneƂċL^܂. PROFILE_SCOPE}NgpĂ.
+	*****************************************************************************/
+	class ProfileScope : public NonCopyable
+	{
+	public:
+		#pragma region Public Constructor and Destructor
+		__forceinline explicit ProfileScope(const char* name) : _name(name)
+		{
+			if (Profiler::IsEnabled()) { _begin = Profiler::BeginZone(_depth); }
+		}
+
+		__forceinline ~ProfileScope()
+		{
+			if (_begin != 0) { Profiler::EndZone(_name, _begin, _depth); }
+		}
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		const char* _name  = nullptr;
+		uint64      _begin = 0;     // 0̏ꍇ͋L^s܂ (ɊJnZone)
+		uint32      _depth = 0;
+		#pragma endregion
+	};
+}
+
+/*----------------------------------------------------------------------
+*  vp̃}N. Oɂ͕񃊃ew肵Ă.
+*----------------------------------------------------------------------*/
+#if GU_PROFILER_ENABLED
+	#define PROFILE_CONCAT_IMPLEMENT(left, right) left##right
+	#define PROFILE_CONCAT(left, right) PROFILE_CONCAT_IMPLEMENT(left, right)
+
+	/*! @brief XR[v̏I܂ł1ZoneƂċL^܂*/
+	#define PROFILE_SCOPE(name) gu::ProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(name)
+
+	/*! @brief ֐ZoneƂ, XR[v̏I܂łL^܂*/
+	#define PROFILE_FUNCTION() PROFILE_SCOPE(__FUNCTION__)
+
+	/*! @brief t[̋؂L^܂*/
+	#define PROFILE_FRAME(name) gu::Profiler::MarkFrame(name)
+
+	/*! @brief Ot̃JE^̒lL^܂*/
+	#define PROFILE_COUNTER(name, value) gu::Profiler::RecordCounter(name, static_cast<double>(value))
+
+	/*! @brief ĂяoXbh̖Oݒ肵܂*/
+	#define PROFILE_THREAD_NAME(name) gu::Profiler::SetThreadName(name)
+#else
+	#define PROFILE_SCOPE(name)
+	#define PROFILE_FUNCTION()
+	#define PROFILE_FRAME(name)
+	#define PROFILE_COUNTER(name, value)
+	#define PROFILE_THREAD_NAME(name)
+#endif
+
+#endif
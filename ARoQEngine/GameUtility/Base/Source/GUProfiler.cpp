@@ -0,0 +1,313 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GUProfiler.cpp
+///  @brief  CPȔԂvKw^̃vt@Cł.
+///  @author toide
+///  @date   2026/10/20 1:36:12
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GUProfiler.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gu;
+
+namespace
+{
+	constexpr uint64 RING_BUFFER_MASK = Profiler::RING_BUFFER_CAPACITY - 1;
+	static_assert((Profiler::RING_BUFFER_CAPACITY & RING_BUFFER_MASK) == 0, "ring buffer capacity must be a power of two.");
+	static_assert(sizeof(ProfileEvent) == 32, "ProfileEvent is expected to be 32 bytes.");
+
+	/*---------------------------------------------------------------
+			XbhƂ̃Oobt@
+			݂͏LXbĥ݂s, WriteCountreleaseŏo͑ɌJ܂.
+	-----------------------------------------------------------------*/
+	struct ThreadBuffer
+	{
+		ProfileEvent        Events[Profiler::RING_BUFFER_CAPACITY] = {};
+		std::atomic<uint64> WriteCount = 0;
+		uint32              Depth      = 0;
+		uint32              ThreadID   = 0;
+		uint64              FrameIndex = 0;
+		std::atomic<const char*> Name  = nullptr;
+	};
+
+	/*---------------------------------------------------------------
+			o^ς݂̃obt@Ǝ̊_
+			XbhIĂCxgo͂ł悤, obt@͉܂.
+	-----------------------------------------------------------------*/
+	struct ProfilerState
+	{
+		std::mutex                 Mutex;
+		std::vector<ThreadBuffer*> Buffers;
+		uint64                     BaseTimestamp = 0;
+		std::chrono::steady_clock::time_point BaseTime = {};
+
+		ProfilerState()
+		{
+			BaseTimestamp = Profiler::GetTimestamp();
+			BaseTime      = std::chrono::steady_clock::now();
+		}
+	};
+
+	ProfilerState& GetState()
+	{
+		static ProfilerState state;
+		return state;
+	}
+
+	thread_local ThreadBuffer* t_threadBuffer = nullptr;
+
+	/*---------------------------------------------------------------
+			ĂяoXbh̃obt@擾܂ (̂ݍ쐬ēo^܂)
+	-----------------------------------------------------------------*/
+	ThreadBuffer& GetThreadBuffer()
+	{
+		if (t_threadBuffer != nullptr) { return *t_threadBuffer; }
+
+		MEMORY_TAG_SCOPE(MemoryTag::Profiler);
+
+		auto& state  = GetState();
+		auto* buffer = new (Memory::Allocate(sizeof(ThreadBuffer))) ThreadBuffer();
+
+		std::scoped_lock lock(state.Mutex);
+		buffer->ThreadID = static_cast<uint32>(state.Buffers.size());
+		state.Buffers.push_back(buffer);
+		t_threadBuffer = buffer;
+		return *buffer;
+	}
+
+	/*---------------------------------------------------------------
+			Cxg݂܂ (LXbĥ݂Ăяo܂)
+	-----------------------------------------------------------------*/
+	__forceinline void WriteEvent(ThreadBuffer& buffer, const ProfileEvent& event)
+	{
+		const uint64 index = buffer.WriteCount.load(std::memory_order_relaxed);
+		buffer.Events[index & RING_BUFFER_MASK] = event;
+		buffer.WriteCount.store(index + 1, std::memory_order_release);
+	}
+
+	/*---------------------------------------------------------------
+			JSON̕Ƃďo͂܂
+	-----------------------------------------------------------------*/
+	void WriteJsonString(std::FILE* file, const char* text)
+	{
+		std::fputc('"', file);
+		for (const char* c = text != nullptr ? text : ""; *c != '\0'; ++c)
+		{
+			const unsigned char character = static_cast<unsigned char>(*c);
+			if      (character == '"' || character == '\\') { std::fputc('\\', file); std::fputc(character, file); }
+			else if (character < 0x20)                      { std::fprintf(file, "\\u%04x", character); }
+			else                                            { std::fputc(character, file); }
+		}
+		std::fputc('"', file);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     ̊_L^܂. NɈxĂяoĂ.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void Profiler::Initialize()
+{
+	GetState();
+}
+
+/*!**********************************************************************
+*  @brief     ĂяoXbh̖Oݒ肵܂. õ͎XbhƂĎgp܂.
+*  @param[in] const char* Xbh
+*  @return    void
+*************************************************************************/
+void Profiler::SetThreadName(const char* name)
+{
+	GetThreadBuffer().Name.store(name, std::memory_order_release);
+}
+
+/*!**********************************************************************
+*  @brief     Zone̊Jn擾, q̐[1i߂܂. ʏPROFILE_SCOPEĂяo܂.
+*  @param[out] uint32& JnZone̐[
+*  @return     uint64 Jn
+*************************************************************************/
+uint64 Profiler::BeginZone(uint32& depth)
+{
+	auto& buffer = GetThreadBuffer();
+	depth = buffer.Depth++;
+	return GetTimestamp();
+}
+
+/*!**********************************************************************
+*  @brief     ZonȅI擾ăOobt@ɏ, q̐[1߂܂.
+*  @param[in] const char* Zone
+*  @param[in] const uint64 BeginZoneŎ擾Jn
+*  @param[in] const uint32 BeginZoneŎ擾[
+*  @return    void
+*************************************************************************/
+void Profiler::EndZone(const char* name, const uint64 begin, const uint32 depth)
+{
+	const uint64 end = GetTimestamp();
+
+	auto& buffer = GetThreadBuffer();
+	buffer.Depth = depth;
+	WriteEvent(buffer, { begin, end, name, depth, ProfileEventType::Zone });
+}
+
+/*!**********************************************************************
+*  @brief     t[̋؂L^܂. ĂяoXbh̃t[ԍ1i߂܂.
+*  @param[in] const char* t[
+*  @return    void
+*************************************************************************/
+void Profiler::MarkFrame(const char* name)
+{
+	if (!IsEnabled()) { return; }
+
+	auto& buffer = GetThreadBuffer();
+	WriteEvent(buffer, { GetTimestamp(), buffer.FrameIndex++, name, 0, ProfileEventType::Frame });
+}
+
+/*!**********************************************************************
+*  @brief     Ot̃JE^̒lL^܂. NaNƖJSONŕ\łȂߋL^܂.
+*  @param[in] const char* JE^
+*  @param[in] const double l
+*  @return    void
+*************************************************************************/
+void Profiler::RecordCounter(const char* name, const double value)
+{
+	if (!IsEnabled() || !std::isfinite(value)) { return; }
+
+	uint64 bits = 0;
+	std::memcpy(&bits, &value, sizeof(bits));
+	WriteEvent(GetThreadBuffer(), { GetTimestamp(), bits, name, 0, ProfileEventType::Counter });
+}
+
+/*!**********************************************************************
+*  @brief     SXbh̃Oobt@ɎcĂCxg, Chrome trace`JSONƂďo͂܂. @n
+*             L^̃XbhĂĂяo܂. ǂݎ蒆ɏ㏑ꂽCxg͏o͂܂.
+*  @param[in] const char* o͐̃t@CpX (UTF-8)
+*  @return    bool o͂ɐꍇtrue
+*************************************************************************/
+bool Profiler::ExportChromeTrace(const char* filePath)
+{
+	auto& state = GetState();
+
+	/*-------------------------------------------------------------------
+	-      _̌oߎԂ, ^CX^v1̃}CNb߂܂
+	---------------------------------------------------------------------*/
+#if GU_PROFILER_USE_RDTSC
+	// NɌĂ΂ꂽꍇ͌덷傫, Œ10mso߂܂ŃXbhx~đ҂܂.
+	std::this_thread::sleep_until(state.BaseTime + std::chrono::milliseconds(10));
+	const double elapsedMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - state.BaseTime).count();
+	const double microsecondsPerTick = elapsedMicroseconds / static_cast<double>(GetTimestamp() - state.BaseTimestamp);
+#else
+	const double microsecondsPerTick = 1e-3;
+#endif
+	const auto toMicroseconds = [&](const uint64 timestamp)
+	{
+		return static_cast<double>(static_cast<int64>(timestamp - state.BaseTimestamp)) * microsecondsPerTick;
+	};
+
+	std::FILE* file = nullptr;
+#if defined(_MSC_VER)
+	if (fopen_s(&file, filePath, "wb") != 0) { file = nullptr; }
+#else
+	file = std::fopen(filePath, "wb");
+#endif
+	if (file == nullptr) { return false; }
+
+	std::vector<ThreadBuffer*> buffers;
+	{
+		std::scoped_lock lock(state.Mutex);
+		buffers = state.Buffers;
+	}
+
+	std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+	bool isFirst = true;
+	const auto beginEvent = [&]()
+	{
+		std::fputs(isFirst ? "" : ",\n", file);
+		isFirst = false;
+	};
+
+	std::vector<ProfileEvent> events;
+	events.reserve(RING_BUFFER_CAPACITY);
+	for (const auto* buffer : buffers)
+	{
+		/*-------------------------------------------------------------------
+		-      Xbh
+		---------------------------------------------------------------------*/
+		if (const char* name = buffer->Name.load(std::memory_order_acquire))
+		{
+			beginEvent();
+			std::fprintf(file, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":", buffer->ThreadID);
+			WriteJsonString(file, name);
+			std::fputs("}}", file);
+		}
+
+		/*-------------------------------------------------------------------
+		-      ݒ̃obt@𕡐, ɏ㏑ꂽ菜܂
+		---------------------------------------------------------------------*/
+		const uint64 end   = buffer->WriteCount.load(std::memory_order_acquire);
+		uint64       begin = end > RING_BUFFER_CAPACITY ? end - RING_BUFFER_CAPACITY : 0;
+
+		events.clear();
+		for (uint64 i = begin; i < end; ++i) { events.push_back(buffer->Events[i & RING_BUFFER_MASK]); }
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64 latest = buffer->WriteCount.load(std::memory_order_relaxed);
+		const uint64 skip   = latest > begin + RING_BUFFER_CAPACITY ? latest - (begin + RING_BUFFER_CAPACITY) : 0;
+
+		for (uint64 i = skip; i < events.size(); ++i)
+		{
+			const auto& event = events[i];
+			beginEvent();
+			std::fputs("{\"name\":", file);
+			WriteJsonString(file, event.Name);
+
+			switch (event.Type)
+			{
+				case ProfileEventType::Zone:
+				{
+					std::fprintf(file, ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"depth\":%u}}",
+						buffer->ThreadID, toMicroseconds(event.Begin), static_cast<double>(event.End - event.Begin) * microsecondsPerTick, event.Depth);
+					break;
+				}
+				case ProfileEventType::Frame:
+				{
+					std::fprintf(file, ",\"ph\":\"i\",\"s\":\"t\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"frame\":%llu}}",
+						buffer->ThreadID, toMicroseconds(event.Begin), static_cast<unsigned long long>(event.End));
+					break;
+				}
+				case ProfileEventType::Counter:
+				{
+					double value = 0.0;
+					std::memcpy(&value, &event.End, sizeof(value));
+					if (!std::isfinite(value)) { value = 0.0; } // ɏ㏑ꂽꍇJSON󂳂Ȃ悤ɂ܂
+					std::fprintf(file, ",\"ph\":\"C\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"args\":{\"value\":%.17g}}",
+						buffer->ThreadID, toMicroseconds(event.Begin), value);
+					break;
+				}
+			}
+		}
+	}
+
+	std::fputs("\n]}\n", file);
+	const bool isSucceeded = std::ferror(file) == 0;
+	std::fclose(file);
+	return isSucceeded;
+}
+#pragma endregion Public Function
@@ -212,6 +212,9 @@ namespace gu
 		// ̃m[h
 		_tail = popNode; 
 
+		// ɂȂꍇ͍폜m[hw܂܂ɂȂ
+		if (_tail == nullptr) { _head = nullptr; }
+
 		/*-------------------------------------------------------------------
 		-           vf̍폜
 		---------------------------------------------------------------------*/
@@ -0,0 +1,102 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMBatchKernel.hpp
+///  @brief  ʂ̗vf܂Ƃ߂ďob`֐Qł. @n
+///          e֐Scalar, SSE2, AVX2̎, CPUFeature::GetActiveőIꂽ߃ZbgŎs܂.
+///  @author toide
+///  @date   2026/10/19 23:58:20
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_BATCH_KERNEL_HPP
+#define GM_BATCH_KERNEL_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMMatrix.hpp"
+#include "GMVertex.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			   QuadRect
+	****************************************************************************/
+	/* @brief  BatchKernel::ExpandQuads4_ɓWJ`ł. Op֐͐ݒ莞ɌvZĂ܂.
+	*****************************************************************************/
+	struct QuadRect
+	{
+		/*! @brief Sx, Sy, ̔, ̔*/
+		Float4 Rect = Float4(0, 0, 0, 0);
+
+		/*! @brief [u, E[u, [v, [v*/
+		Float4 UV = Float4(0, 1, 0, 1);
+
+		/*! @brief RGBA*/
+		Float4 Color = Float4(1, 1, 1, 1);
+
+		/*! @brief s*/
+		float Z = 0.0f;
+
+		/*! @brief ]psin, cos*/
+		float Sin = 0.0f;
+		float Cos = 1.0f;
+
+		float Padding = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			   BatchKernel
+	****************************************************************************/
+	/* @brief  ʂ̗vf܂Ƃ߂ďob`֐Qł. ͂Əo͓͂zw肵Ă\܂.
+	*****************************************************************************/
+	class BatchKernel
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     W (x, y, z, 1) * matrix ŕϊ܂. (sxNg`, wZ͍s܂)
+		*  @param[in]  const Float4x4& ϊs
+		*  @param[in]  const Float3* ͍W
+		*  @param[out] Float3* o͍W
+		*  @param[in]  const gu::uint64 vf
+		*  @return     void
+		*************************************************************************/
+		static void TransformPoints(const Float4x4& matrix, const Float3* input, Float3* output, const gu::uint64 count);
+
+		/*!**********************************************************************
+		*  @brief     xNg (x, y, z, 0) * matrix ŕϊ܂. (sړ͖܂)
+		*  @param[in]  const Float4x4& ϊs
+		*  @param[in]  const Float3* ̓xNg
+		*  @param[out] Float3* o̓xNg
+		*  @param[in]  const gu::uint64 vf
+		*  @return     void
+		*************************************************************************/
+		static void TransformVectors(const Float4x4& matrix, const Float3* input, Float3* output, const gu::uint64 count);
+
+		/*!**********************************************************************
+		*  @brief     0`1RGBA R8G8B8A8_UNORM (RʃoCg) ɕϊ܂. ͈͊O̒l0`255ɖOa܂.
+		*  @param[in]  const Float4* ͐F
+		*  @param[out] gu::uint32* o͐F
+		*  @param[in]  const gu::uint64 vf
+		*  @return     void
+		*************************************************************************/
+		static void ConvertColorToRGBA8(const Float4* input, gu::uint32* output, const gu::uint64 count);
+
+		/*!**********************************************************************
+		*  @brief     `]4_ (, , E, Ȅ) ɓWJ܂. @(0, 0, 1)ł.
+		*  @param[in]  const QuadRect* ͋`
+		*  @param[out] Vertex* o͒_ (` * 4)
+		*  @param[in]  const gu::uint64 `
+		*  @return     void
+		*************************************************************************/
+		static void ExpandQuads(const QuadRect* input, Vertex* output, const gu::uint64 count);
+		#pragma endregion
+	};
+}
+#endif
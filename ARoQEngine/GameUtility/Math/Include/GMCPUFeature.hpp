@@ -0,0 +1,137 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMCPUFeature.hpp
+///  @brief  sCPUIDpĎgp\SIMD߃Zbg𔻒肵, ob`̊֐؂ւ邽߂̃NXł. @n
+///          GMSimdMacros.hpp̓RpC̃}NŖ߃Zbg肵܂, ͎sCPUōłȖ߂I܂. @n
+///          ϐ GM_SIMD_INSTRUCTION (scalar, sse2, sse4.1, avx2) ݒ肷, eXgpɎgp閽߃ZbgŒł܂.
+///  @author toide
+///  @date   2026/10/19 23:32:05
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_CPU_FEATURE_HPP
+#define GM_CPU_FEATURE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+/*----------------------------------------------------------------------
+*  ߃ZbgƂɊ֐RpC邽߂̑
+*  MSVC/arch̎wɊւ炸gݍ݊֐gpł邽, t܂.
+*----------------------------------------------------------------------*/
+#if defined(__GNUC__) || defined(__clang__)
+	#define SIMD_TARGET_SSE4_1 __attribute__((target("sse4.1")))
+	#define SIMD_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#else
+	#define SIMD_TARGET_SSE4_1
+	#define SIMD_TARGET_AVX2
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			   SimdInstructionSet
+	****************************************************************************/
+	/* @brief  ob`̊֐؂ւPʂƂȂ閽߃Zbgł. l傫قǍȖ߃Zbg\܂.
+	*****************************************************************************/
+	enum class SimdInstructionSet : gu::uint8
+	{
+		Scalar = 0, //!< SIMDgpȂ
+		SSE2   = 1, //!< x64̊{߃Zbg
+		SSE4_1 = 2, //!< SSE4.1
+		AVX2   = 3, //!< AVX2 + FMA3
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			   CPUFeatureFlags
+	****************************************************************************/
+	/* @brief  CPUIDXGETBV画肵, sCPU(OS)ΉĂ閽߂ł.
+	*****************************************************************************/
+	struct CPUFeatureFlags
+	{
+		bool SSE2    = false;
+		bool SSE3    = false;
+		bool SSSE3   = false;
+		bool SSE4_1  = false;
+		bool SSE4_2  = false;
+		bool AVX     = false; //!< OSYMMWX^̑ޔɑΉĂꍇ̂true
+		bool AVX2    = false;
+		bool FMA3    = false;
+		bool F16C    = false;
+		bool AVX512F = false; //!< OSZMMWX^̑ޔɑΉĂꍇ̂true
+	};
+
+	/****************************************************************************
+	*				  			   CPUFeature
+	****************************************************************************/
+	/* @brief  sCPU@\̖₢킹, ob`Ŏgp閽߃Zbg̊Ǘs܂. @n
+	*          ̌ĂяoCPUIDɂ锻Ɗϐ̓ǂݍ݂s܂.
+	*****************************************************************************/
+	class CPUFeature
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     CPU̔s܂. Ă΂ȂĂ̖₢킹Ɏs܂, NɌĂԂƂŔ̃^C~OŒł܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		static void Initialize();
+
+		/*!**********************************************************************
+		*  @brief     sCPUΉĂ閽߂̈ꗗԂ܂.
+		*  @param[in] void
+		*  @return    const CPUFeatureFlags&
+		*************************************************************************/
+		static const CPUFeatureFlags& GetFlags();
+
+		/*!**********************************************************************
+		*  @brief     sCPUŎgp\ȍłȖ߃ZbgԂ܂.
+		*  @param[in] void
+		*  @return    SimdInstructionSet
+		*************************************************************************/
+		static SimdInstructionSet GetHighestSupported();
+
+		/*!**********************************************************************
+		*  @brief     ob`ŌݎgpĂ閽߃ZbgԂ܂.
+		*  @param[in] void
+		*  @return    SimdInstructionSet
+		*************************************************************************/
+		static SimdInstructionSet GetActive();
+
+		/*!**********************************************************************
+		*  @brief     ob`Ŏgp閽߃ZbgύX܂. CPUΉĂȂꍇ͑ΉĂő̖߃ZbgɂȂ܂.
+		*  @param[in] const SimdInstructionSet gp߃Zbg
+		*  @return    bool w肵߃Zbĝ܂܎gpłꍇtrue
+		*************************************************************************/
+		static bool SetActive(const SimdInstructionSet instructionSet);
+
+		/*!**********************************************************************
+		*  @brief     w肵߃ZbgsCPUŎgpł邩Ԃ܂.
+		*  @param[in] const SimdInstructionSet ߃Zbg
+		*  @return    bool
+		*************************************************************************/
+		static bool IsSupported(const SimdInstructionSet instructionSet);
+
+		/*!**********************************************************************
+		*  @brief     ߃Zbg̖OԂ܂. (ϐŎw肷镶Ɠł)
+		*  @param[in] const SimdInstructionSet ߃Zbg
+		*  @return    const char*
+		*************************************************************************/
+		static const char* ToString(const SimdInstructionSet instructionSet);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief gp閽߃ZbgŒ肷邽߂̊ϐ*/
+		static constexpr const char* ENVIRONMENT_VARIABLE_NAME = "GM_SIMD_INSTRUCTION";
+		#pragma endregion
+	};
+}
+#endif
@@ -86,6 +86,33 @@ namespace gm
 		*****************************************************************************/
 	};
 
+	/****************************************************************************
+	*				  			BoundingBox
+	****************************************************************************/
+	/* @class     Bounding Box
+	*  @brief     Axis aligned bounding box (SƊe̔̒ŕ\܂)
+	*****************************************************************************/
+	struct BoundingBox
+	{
+	public:
+		/****************************************************************************
+		**                Public Property
+		*****************************************************************************/
+		Float3 Center;
+		Float3 Extents; // Seʂ܂ł̋
+
+		/****************************************************************************
+		**                Constructor and Destructor
+		*****************************************************************************/
+		BoundingBox() { Center = Float3(0.0f, 0.0f, 0.0f); Extents = Float3(1.0f, 1.0f, 1.0f); }
+		BoundingBox(const BoundingBox&)            = default;
+		BoundingBox& operator=(const BoundingBox&) = default;
+		BoundingBox(BoundingBox&&)                 = default;
+		BoundingBox& operator=(BoundingBox&&)      = default;
+
+		BoundingBox(const Float3& center, const Float3& extents) : Center(center), Extents(extents) {}
+	};
+
 	/****************************************************************************
 	*				  			Ray
 	****************************************************************************/
@@ -0,0 +1,218 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMCulling.hpp
+///  @brief  JOsNXł. @n
+///          oEfBO{[SoA(Structure of Arrays)`ŕێ, sɑI߃Zbg(AVX2ł8, SSEł4)ł܂Ƃ߂Ĕ肵܂.@n
+///          茋ʂ͉̃CfbNXOl߂zƂďo܂.
+///  @author toide
+///  @date   2026/10/19 22:10:41
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_CULLING_HPP
+#define GM_CULLING_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMCollision.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			   FrustumPlanes
+	****************************************************************************/
+	/* @brief  \6ʂł. (a, b, c, d)ɑ΂ a*x + b*y + c*z + d >= 0 ƂȂ܂. @n
+	*          @͐Kς݂̂, d̒l͂̂܂ܕtƂĎgpł܂.
+	*****************************************************************************/
+	struct FrustumPlanes
+	{
+	public:
+		#pragma region Public Property
+		static constexpr gu::uint32 PLANE_COUNT = 6;
+
+		/*! @brief Left, Right, Bottom, Top, Near, FaȑɊi[܂*/
+		Float4 Planes[PLANE_COUNT];
+		#pragma endregion
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     View * Projections񂩂王6ʂo܂. (DirectX̃Nbv z : 0`1z肵Ă܂)
+		*  @param[in] const Float4x4& r[vWFNVs (sxNg`)
+		*  @return    FrustumPlanes
+		*************************************************************************/
+		static FrustumPlanes FromViewProjection(const Float4x4& viewProjection);
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   BoundingSphereArray
+	****************************************************************************/
+	/* @brief  BoundingSphereSoA`ŕێzł. SIMDł܂Ƃ߂ēǂݍ߂悤ɊevfʁX̔zƂĎ܂.
+	*****************************************************************************/
+	struct BoundingSphereArray
+	{
+	public:
+		#pragma region Public Property
+		gu::DynamicArray<float> CenterX = {};
+		gu::DynamicArray<float> CenterY = {};
+		gu::DynamicArray<float> CenterZ = {};
+		gu::DynamicArray<float> Radius  = {};
+		#pragma endregion
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     BoundingSphereǉ܂.
+		*  @param[in] const BoundingSphere& sphere
+		*  @return    gu::uint32 ǉvf̃CfbNX
+		*************************************************************************/
+		gu::uint32 Push(const BoundingSphere& sphere);
+
+		/*!**********************************************************************
+		*  @brief     w肵CfbNXBoundingSphereXV܂.
+		*  @param[in] const gu::uint32 index
+		*  @param[in] const BoundingSphere& sphere
+		*  @return    void
+		*************************************************************************/
+		void Set(const gu::uint32 index, const BoundingSphere& sphere);
+
+		/*!**********************************************************************
+		*  @brief     ̈OɊmۂ܂.
+		*************************************************************************/
+		void Reserve(const gu::uint64 capacity);
+
+		/*!**********************************************************************
+		*  @brief     vfSč폜܂. (Capacity͂̂܂܂ł)
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     i[ĂvfԂ܂
+		*************************************************************************/
+		__forceinline gu::uint64 Size() const { return Radius.Size(); }
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   BoundingBoxArray
+	****************************************************************************/
+	/* @brief  sE{bNX(S + ̒)SoA`ŕێzł.
+	*****************************************************************************/
+	struct BoundingBoxArray
+	{
+	public:
+		#pragma region Public Property
+		gu::DynamicArray<float> CenterX  = {};
+		gu::DynamicArray<float> CenterY  = {};
+		gu::DynamicArray<float> CenterZ  = {};
+		gu::DynamicArray<float> ExtentsX = {};
+		gu::DynamicArray<float> ExtentsY = {};
+		gu::DynamicArray<float> ExtentsZ = {};
+		#pragma endregion
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     BoundingBoxǉ܂.
+		*  @param[in] const BoundingBox& box
+		*  @return    gu::uint32 ǉvf̃CfbNX
+		*************************************************************************/
+		gu::uint32 Push(const BoundingBox& box);
+
+		/*!**********************************************************************
+		*  @brief     w肵CfbNXBoundingBoxXV܂.
+		*  @param[in] const gu::uint32 index
+		*  @param[in] const BoundingBox& box
+		*  @return    void
+		*************************************************************************/
+		void Set(const gu::uint32 index, const BoundingBox& box);
+
+		/*!**********************************************************************
+		*  @brief     ̈OɊmۂ܂.
+		*************************************************************************/
+		void Reserve(const gu::uint64 capacity);
+
+		/*!**********************************************************************
+		*  @brief     vfSč폜܂. (Capacity͂̂܂܂ł)
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     i[ĂvfԂ܂
+		*************************************************************************/
+		__forceinline gu::uint64 Size() const { return ExtentsX.Size(); }
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   FrustumCulling
+	****************************************************************************/
+	/* @brief  SoA`̃oEfBO{[ɑ΂ĎJOs܂. @n
+	*          ̎(CJ + VhEJXP[hȂ)nꍇ, oEfBO{[̓ǂݍ݂1xőSĂ̎𔻒肵܂.
+	*****************************************************************************/
+	class FrustumCulling
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ƕ̎̔s, 䂲Ƃɉ̃CfbNXOl߂ŏo܂.
+		*  @param[in]  const FrustumPlanes* ̔z
+		*  @param[in]  const gu::uint32 ̐
+		*  @param[in]  const BoundingSphereArray& s
+		*  @param[out] gu::uint32* const* 䂲Ƃ̏o͐ (ꂼspheres.Size()ȏ̗̈悪Kvł)
+		*  @param[out] gu::uint64* 䂲Ƃ̉
+		*  @return     void
+		*************************************************************************/
+		static void CullSpheres(const FrustumPlanes* frustums, const gu::uint32 frustumCount, const BoundingSphereArray& spheres, gu::uint32* const* visibleIndices, gu::uint64* visibleCounts);
+
+		/*!**********************************************************************
+		*  @brief     {bNXƕ̎̔s, 䂲Ƃɉ̃CfbNXOl߂ŏo܂.
+		*  @param[in]  const FrustumPlanes* ̔z
+		*  @param[in]  const gu::uint32 ̐
+		*  @param[in]  const BoundingBoxArray& s{bNX
+		*  @param[out] gu::uint32* const* 䂲Ƃ̏o͐ (ꂼboxes.Size()ȏ̗̈悪Kvł)
+		*  @param[out] gu::uint64* 䂲Ƃ̉
+		*  @return     void
+		*************************************************************************/
+		static void CullBoxes(const FrustumPlanes* frustums, const gu::uint32 frustumCount, const BoundingBoxArray& boxes, gu::uint32* const* visibleIndices, gu::uint64* visibleCounts);
+
+		/*!**********************************************************************
+		*  @brief     1̎̔s܂.
+		*  @return    gu::uint64 
+		*************************************************************************/
+		static gu::uint64 CullSpheres(const FrustumPlanes& frustum, const BoundingSphereArray& spheres, gu::uint32* visibleIndices)
+		{
+			gu::uint64 count = 0;
+			CullSpheres(&frustum, 1, spheres, &visibleIndices, &count);
+			return count;
+		}
+
+		/*!**********************************************************************
+		*  @brief     {bNX1̎̔s܂.
+		*  @return    gu::uint64 
+		*************************************************************************/
+		static gu::uint64 CullBoxes(const FrustumPlanes& frustum, const BoundingBoxArray& boxes, gu::uint32* visibleIndices)
+		{
+			gu::uint64 count = 0;
+			CullBoxes(&frustum, 1, boxes, &visibleIndices, &count);
+			return count;
+		}
+
+		/*!**********************************************************************
+		*  @brief     ̋̓(ꕔłĂ)肵܂.
+		*************************************************************************/
+		static bool IsVisible(const FrustumPlanes& frustum, const BoundingSphere& sphere);
+
+		/*!**********************************************************************
+		*  @brief     ̃{bNX̓(ꕔłĂ)肵܂.
+		*************************************************************************/
+		static bool IsVisible(const FrustumPlanes& frustum, const BoundingBox& box);
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,318 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMRandom.hpp
+///  @brief  ʂ̗ɐ邽߂̋[ł. @n
+///          Xoshiro256PlusPlus, PCG641lԂ, std::uniform_int_distributionȂǂɂ̂܂ܓn܂. @n
+///          BatchRandom8{̓ƗXoshiro256++SIMDœɐi, zֈl, K, w݂܂.
+///  @author toide
+///  @date   2026/10/20 0:42:18
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_RANDOM_HPP
+#define GM_RANDOM_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	/****************************************************************************
+	*				  			   Xoshiro256PlusPlus
+	****************************************************************************/
+	/* @brief  2^256 - 164bit[ł. (Blackman & Vigna) @n
+	*          Jump2^128, LongJump2^192̏Ԃ֐i߂邽, XbhƂɏdȂȂn쐬ł܂.
+	*****************************************************************************/
+	class Xoshiro256PlusPlus
+	{
+	public:
+		using result_type = gu::uint64;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     64bit̗Ԃ܂.
+		*  @param[in] void
+		*  @return    gu::uint64
+		*************************************************************************/
+		__forceinline gu::uint64 operator()()
+		{
+			const gu::uint64 result = RotateLeft(_state[0] + _state[3], 23) + _state[0];
+			const gu::uint64 t      = _state[1] << 17;
+
+			_state[2] ^= _state[0];
+			_state[3] ^= _state[1];
+			_state[1] ^= _state[2];
+			_state[0] ^= _state[3];
+			_state[2] ^= t;
+			_state[3]  = RotateLeft(_state[3], 45);
+			return result;
+		}
+
+		/*!**********************************************************************
+		*  @brief     [0, 1)̈lԂ܂. (24bitgp܂)
+		*  @param[in] void
+		*  @return    float
+		*************************************************************************/
+		__forceinline float NextFloat() { return static_cast<float>((*this)() >> 40) * (1.0f / 16777216.0f); }
+
+		/*!**********************************************************************
+		*  @brief     [0, 1)̈lԂ܂. (53bitgp܂)
+		*  @param[in] void
+		*  @return    double
+		*************************************************************************/
+		__forceinline double NextDouble() { return static_cast<double>((*this)() >> 11) * (1.0 / 9007199254740992.0); }
+
+		/*!**********************************************************************
+		*  @brief     2^128operator()Ă񂾏ꍇƓԂ܂Ői߂܂.
+		*             1̌n񂩂2^128̏dȂȂn쐬ꍇɎgp܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Jump();
+
+		/*!**********************************************************************
+		*  @brief     2^192operator()Ă񂾏ꍇƓԂ܂Ői߂܂.
+		*             Jumpŕn, ɃXbhƂɕꍇɎgp܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void LongJump();
+
+		/*!**********************************************************************
+		*  @brief     V[hlԂ܂. (SplitMix644̏Ԃ쐬܂)
+		*  @param[in] const gu::uint64 seed
+		*  @return    void
+		*************************************************************************/
+		void SetSeed(const gu::uint64 seed);
+
+		static constexpr gu::uint64 min() { return 0; }
+		static constexpr gu::uint64 max() { return ~static_cast<gu::uint64>(0); }
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     ԂԂ܂. (BatchRandom̊e[̏Ɏgp܂)
+		*  @param[in] void
+		*  @return    const gu::uint64*
+		*************************************************************************/
+		const gu::uint64* GetState() const { return _state; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		Xoshiro256PlusPlus() { SetSeed(0); }
+
+		explicit Xoshiro256PlusPlus(const gu::uint64 seed) { SetSeed(seed); }
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		static constexpr gu::uint64 RotateLeft(const gu::uint64 value, const int shift)
+		{
+			return (value << shift) | (value >> (64 - shift));
+		}
+
+		void Jump(const gu::uint64 (&polynomial)[4]);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief  (S0ɂ͂Ȃ܂)*/
+		gu::uint64 _state[4] = {};
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   PCG64
+	****************************************************************************/
+	/* @brief  128bit̐`@̏Ԃ, XSL-RR64bitɕϊďo͂[ł. (O'Neill) @n
+	*          stream̒lƂɈقȂnƂȂ, AdvanceŔCӂ̐O(log n)ŏԂi߂܂.
+	*****************************************************************************/
+	class PCG64
+	{
+	public:
+		using result_type = gu::uint64;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     64bit̗Ԃ܂.
+		*  @param[in] void
+		*  @return    gu::uint64
+		*************************************************************************/
+		gu::uint64 operator()();
+
+		/*!**********************************************************************
+		*  @brief     [0, 1)̈lԂ܂. (24bitgp܂)
+		*  @param[in] void
+		*  @return    float
+		*************************************************************************/
+		__forceinline float NextFloat() { return static_cast<float>((*this)() >> 40) * (1.0f / 16777216.0f); }
+
+		/*!**********************************************************************
+		*  @brief     operator()deltaĂ񂾏ꍇƓԂ܂Ői߂܂.
+		*  @param[in] const gu::uint64 64bit
+		*  @param[in] const gu::uint64 64bit
+		*  @return    void
+		*************************************************************************/
+		void Advance(const gu::uint64 deltaHigh, const gu::uint64 deltaLow);
+
+		/*!**********************************************************************
+		*  @brief     operator()deltaĂ񂾏ꍇƓԂ܂Ői߂܂.
+		*  @param[in] const gu::uint64 delta
+		*  @return    void
+		*************************************************************************/
+		void Advance(const gu::uint64 delta) { Advance(0, delta); }
+
+		/*!**********************************************************************
+		*  @brief     V[hlƌnԍԂ܂.
+		*  @param[in] const gu::uint64 seed
+		*  @param[in] const gu::uint64 stream (nԍ. lƂɈقȂnɂȂ܂)
+		*  @return    void
+		*************************************************************************/
+		void SetSeed(const gu::uint64 seed, const gu::uint64 stream = 0);
+
+		static constexpr gu::uint64 min() { return 0; }
+		static constexpr gu::uint64 max() { return ~static_cast<gu::uint64>(0); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		PCG64() { SetSeed(0, 0); }
+
+		explicit PCG64(const gu::uint64 seed, const gu::uint64 stream = 0) { SetSeed(seed, stream); }
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		gu::uint64 _stateHigh     = 0;
+		gu::uint64 _stateLow      = 0;
+		gu::uint64 _incrementHigh = 0;
+		gu::uint64 _incrementLow  = 1; //!< Kł
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   BatchRandom
+	****************************************************************************/
+	/* @brief  LANE_COUNT{Xoshiro256++𓯎ɐi, zւ܂Ƃ߂ė݂܂. @n
+	*          e[Jump2^128ꂽngp܂.
+	*          o͂lSIMD̖߃Zbg(CPUFeature::GetActive)Ɋւ炸ł. (RpCϘaFMAɒuꍇ̂, FillFloat̍ŉbitقȂ邱Ƃ܂) @n
+	*          XbhƂ streamIndex ςč쐬, ݂ɏdȂȂnɂȂ܂. (1CX^X𕡐XbhŋLȂł)
+	*****************************************************************************/
+	class BatchRandom
+	{
+	public:
+		/*! @brief ɐi߂鐶̐*/
+		static constexpr gu::uint32 LANE_COUNT = 8;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     64biẗl݂܂.
+		*  @param[out] gu::uint64* o͐
+		*  @param[in]  const gu::uint64 vf
+		*  @return     void
+		*************************************************************************/
+		void FillUInt64(gu::uint64* output, const gu::uint64 count);
+
+		/*!**********************************************************************
+		*  @brief     32biẗl݂܂.
+		*  @param[out] gu::uint32* o͐
+		*  @param[in]  const gu::uint64 vf
+		*  @return     void
+		*************************************************************************/
+		void FillUInt32(gu::uint32* output, const gu::uint64 count);
+
+		/*!**********************************************************************
+		*  @brief     [min, max)̈l݂܂. (24bit̐xł)
+		*  @param[out] float* o͐
+		*  @param[in]  const gu::uint64 vf
+		*  @param[in]  const float ŏl
+		*  @param[in]  const float ől
+		*  @return     void
+		*************************************************************************/
+		void FillFloat(float* output, const gu::uint64 count, const float min = 0.0f, const float max = 1.0f);
+
+		/*!**********************************************************************
+		*  @brief     [min, max]̐̈l݂܂.
+		*             32bit̗Ɣ͈͂̐ς̏32bitgp邽, ΂͍ő (͈ / 2^32) xł.
+		*  @param[out] gu::int32* o͐
+		*  @param[in]  const gu::uint64 vf
+		*  @param[in]  const gu::int32 ŏl
+		*  @param[in]  const gu::int32 ől (̒l܂݂܂)
+		*  @return     void
+		*************************************************************************/
+		void FillInt32(gu::int32* output, const gu::uint64 count, const gu::int32 min, const gu::int32 max);
+
+		/*!**********************************************************************
+		*  @brief     Kzɏ]Ziggurat@ŏ݂܂.
+		*  @param[out] float* o͐
+		*  @param[in]  const gu::uint64 vf
+		*  @param[in]  const float 
+		*  @param[in]  const float W΍
+		*  @return     void
+		*************************************************************************/
+		void FillNormal(float* output, const gu::uint64 count, const float mean = 0.0f, const float standardDeviation = 1.0f);
+
+		/*!**********************************************************************
+		*  @brief     wzɏ]Ziggurat@ŏ݂܂.
+		*  @param[out] float* o͐
+		*  @param[in]  const gu::uint64 vf
+		*  @param[in]  const float PʎԂ̔ ()
+		*  @return     void
+		*************************************************************************/
+		void FillExponential(float* output, const gu::uint64 count, const float lambda = 1.0f);
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*!**********************************************************************
+		*  @brief     V[hlƌnԍ쐬܂.
+		*             nԍƂLongJump邽, V[hlłnԍقȂΏdȂ܂.
+		*  @param[in] const gu::uint64 seed
+		*  @param[in] const gu::uint64 streamIndex (XbhԍȂ)
+		*************************************************************************/
+		explicit BatchRandom(const gu::uint64 seed = 0, const gu::uint64 streamIndex = 0);
+
+		/*!**********************************************************************
+		*  @brief     ̏Ԃ쐬܂. e[͐JumpԂɂȂ܂.
+		*  @param[in] const Xoshiro256PlusPlus& generator
+		*************************************************************************/
+		explicit BatchRandom(const Xoshiro256PlusPlus& generator);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*!**********************************************************************
+		*  @brief     ̃obt@𗐐Ŗߒ܂.
+		*************************************************************************/
+		void RefillBuffer();
+
+		/*!**********************************************************************
+		*  @brief     ̃obt@64bit̗1o܂. (Ziggurat@Ŏgp܂)
+		*************************************************************************/
+		__forceinline gu::uint64 NextBufferedUInt64()
+		{
+			if (_bufferPosition == BUFFER_SIZE) { RefillBuffer(); }
+			return _buffer[_bufferPosition++];
+		}
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief Ziggurat@Ŏgp闐̃obt@̗vf (LANE_COUNT̔{)*/
+		static constexpr gu::uint32 BUFFER_SIZE = 256;
+
+		/*! @brief e[̏ (SoA`. _state[i][lane])*/
+		alignas(32) gu::uint64 _state[4][LANE_COUNT] = {};
+
+		/*! @brief Ziggurat@Ŏgp闐̃obt@*/
+		alignas(32) gu::uint64 _buffer[BUFFER_SIZE] = {};
+
+		/*! @brief obt@̎ɓǂݍވʒu*/
+		gu::uint32 _bufferPosition = BUFFER_SIZE;
+		#pragma endregion
+	};
+}
+#endif
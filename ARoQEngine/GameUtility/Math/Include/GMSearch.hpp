@@ -1,6 +1,6 @@
 //////////////////////////////////////////////////////////////////////////////////
-///             @file   GMSort.hpp
-///             @brief  GMSortAlgorithm
+///             @file   GMSearch.hpp
+///             @brief  GMSearchAlgorithm
 ///             @author Toide Yutaro
 ///             @date   2020_12_13
 //////////////////////////////////////////////////////////////////////////////////
@@ -11,8 +11,16 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
 #include <iostream>
 #include <vector>
+#include <bit>
+#include <functional>
+#include <type_traits>
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#endif
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -24,6 +32,89 @@
 //////////////////////////////////////////////////////////////////////////////////
 namespace gm
 {
+	namespace details::search
+	{
+		/*! @brief Eytzingerz̒Tŉi̎qǂ݂邩 (1LbVCɎ܂q̐)*/
+		template<typename T>
+		constexpr gu::uint64 EYTZINGER_PREFETCH_STRIDE = (64 / sizeof(T)) > 0 ? (64 / sizeof(T)) : 1;
+
+		/*! @brief SIMDɂ`TɑΉĂ^*/
+		template<typename T>
+		constexpr bool IS_SIMD_SEARCHABLE = (std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4)) || std::is_same_v<T, float>;
+
+		/*---------------------------------------------------------------
+				w肵AhX܂ރLbVCǂ݂܂
+		-----------------------------------------------------------------*/
+		inline void Prefetch(const void* address)
+		{
+		#if PLATFORM_CPU_X86_FAMILY
+			_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+		#elif defined(__GNUC__) || defined(__clang__)
+			__builtin_prefetch(address);
+		#else
+			(void)address;
+		#endif
+		}
+
+		/*---------------------------------------------------------------
+				\[gςݔz𒆊ԏ񂵂ȂEytzingerz (1n܂) ɏ݂܂
+		-----------------------------------------------------------------*/
+		template<typename T>
+		gu::uint64 BuildEytzinger(const T* sorted, T* output, gu::uint64* sortedIndices, gu::uint64 sortedIndex, const gu::uint64 node, const gu::uint64 count)
+		{
+			if (node > count) { return sortedIndex; }
+
+			sortedIndex  = BuildEytzinger(sorted, output, sortedIndices, sortedIndex, node * 2, count);
+			output[node] = sorted[sortedIndex];
+			if (sortedIndices) { sortedIndices[node] = sortedIndex; }
+			++sortedIndex;
+			return BuildEytzinger(sorted, output, sortedIndices, sortedIndex, node * 2 + 1, count);
+		}
+
+	#if PLATFORM_CPU_X86_FAMILY
+		/*---------------------------------------------------------------
+				L[S[ɕ܂
+		-----------------------------------------------------------------*/
+		template<typename T>
+		inline __m128i Broadcast(const T key)
+		{
+			if constexpr (std::is_same_v<T, float>) { return _mm_castps_si128(_mm_set1_ps(key)); }
+			else if constexpr (sizeof(T) == 1)      { return _mm_set1_epi8 (static_cast<char>(key)); }
+			else if constexpr (sizeof(T) == 2)      { return _mm_set1_epi16(static_cast<short>(key)); }
+			else                                    { return _mm_set1_epi32(static_cast<int>(key)); }
+		}
+
+		/*---------------------------------------------------------------
+				16byte̗vfƃL[r, vvf̃oCg1ƂȂ}XNԂ܂
+		-----------------------------------------------------------------*/
+		template<typename T>
+		inline int CompareEqualMask(const T* address, const __m128i key)
+		{
+			if constexpr (std::is_same_v<T, float>)
+			{
+				// ̔rgp邽, NaN͈v, +0-0͈v܂ (operator==Ɠʂł)
+				return _mm_movemask_epi8(_mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(address), _mm_castsi128_ps(key))));
+			}
+			else
+			{
+				const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(address));
+				if constexpr (sizeof(T) == 1)      { return _mm_movemask_epi8(_mm_cmpeq_epi8 (value, key)); }
+				else if constexpr (sizeof(T) == 2) { return _mm_movemask_epi8(_mm_cmpeq_epi16(value, key)); }
+				else                               { return _mm_movemask_epi8(_mm_cmpeq_epi32(value, key)); }
+			}
+		}
+
+		/*---------------------------------------------------------------
+				oCgPʂ̃}XNŏɈvvf̈ʒu߂܂
+		-----------------------------------------------------------------*/
+		template<typename T>
+		inline gu::uint64 FirstMatchIndex(const int byteMask)
+		{
+			return static_cast<gu::uint64>(std::countr_zero(static_cast<unsigned int>(byteMask))) / sizeof(T);
+		}
+	#endif
+	}
+
 	/****************************************************************************
 	*				  			Search
 	****************************************************************************/
@@ -44,6 +135,27 @@ namespace gm
 		// for std::vector
 		static int LinearSearch(const std::vector<T>& vector, T key);
 		static int BinarySearch(const std::vector<T>& vector, T key);
+
+		// for large array (64bit size)
+		static gu::int64 LinearSearchSimd(const T* array, const gu::uint64 count, const T& key);
+
+		template<typename Compare = std::less<T>>
+		static gu::uint64 LowerBound(const T* array, const gu::uint64 count, const T& key, Compare compare = Compare());
+
+		template<typename Compare = std::less<T>>
+		static gu::uint64 UpperBound(const T* array, const gu::uint64 count, const T& key, Compare compare = Compare());
+
+		template<typename Compare = std::less<T>>
+		static gu::int64 BranchlessBinarySearch(const T* array, const gu::uint64 count, const T& key, Compare compare = Compare());
+
+		// for eytzinger layout (breadth first order of the implicit binary search tree)
+		static void BuildEytzinger(const T* sorted, const gu::uint64 count, T* eytzinger, gu::uint64* sortedIndices = nullptr);
+
+		template<typename Compare = std::less<T>>
+		static gu::uint64 EytzingerLowerBound(const T* eytzinger, const gu::uint64 count, const T& key, Compare compare = Compare());
+
+		template<typename Compare = std::less<T>>
+		static gu::uint64 EytzingerSearch(const T* eytzinger, const gu::uint64 count, const T& key, Compare compare = Compare());
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
@@ -68,7 +180,7 @@ namespace gm
 	/****************************************************************************
 	*							LinearSearch
 	****************************************************************************/
-	*  @fn        int Search<T>::LinearSearch(T* array, int arraySize, T key)
+	/* @fn        int Search<T>::LinearSearch(T* array, int arraySize, T key)
 	*  @brief     Linear Search for array (O(N))
 	*  @param[in] T*  array
 	*  @param[in] int arraySize
@@ -90,7 +202,7 @@ namespace gm
 	/****************************************************************************
 	*							LinearSearch
 	****************************************************************************/
-	*  @fn        int Search<T>::LinearSearch(const std::vector<T>& vector, T key)
+	/* @fn        int Search<T>::LinearSearch(const std::vector<T>& vector, T key)
 	*  @brief     Linear Search for vector (O(N))
 	*  @param[in] std::vector<T>& vector
 	*  @param[in] T   key
@@ -111,7 +223,7 @@ namespace gm
 	/****************************************************************************
 	*							BinarySearch
 	****************************************************************************/
-	*  @fn        int Search<T>::BinarySearch(T* array, int arraySize, T key)
+	/* @fn        int Search<T>::BinarySearch(T* array, int arraySize, T key)
 	*  @brief     Linear Search for array (O(log_2(N))) This algorithm is needed well-ordered ascend data
 	*  @param[in] T*  array
 	*  @param[in] int arraySize
@@ -150,7 +262,7 @@ namespace gm
 	/****************************************************************************
 	*							BinarySearch
 	****************************************************************************/
-	*  @fn        int Search<T>::BinarySearch(const std::vector<T>& vector, T key)
+	/* @fn        int Search<T>::BinarySearch(const std::vector<T>& vector, T key)
 	*  @brief     Binary Search for vector (O(log_2(N))) This algorithm is needed well-ordered ascend data
 	*  @param[in] std::vector<T>& vector
 	*  @param[in] T   key
@@ -184,6 +296,212 @@ namespace gm
 		}
 		return NOT_FOUND;
 	}
+
+	/****************************************************************************
+	*							LinearSearchSimd
+	****************************************************************************/
+	/* @fn        gu::int64 Search<T>::LinearSearchSimd(const T* array, const gu::uint64 count, const T& key)
+	*  @brief     Linear Search using SSE2 (O(N)). 
+	*             8, 16, 32bit̐float16byter, ȊǑ^͒ʏ̐`Ts܂.
+	*             \vfx̏zł͓񕪒Tł.
+	*  @param[in] const T* array
+	*  @param[in] const gu::uint64 count
+	*  @param[in] const T& key
+	*  @return @@gu::int64 index (NOT FOUND: -1)
+	*****************************************************************************/
+	template<typename T> gu::int64 Search<T>::LinearSearchSimd(const T* array, const gu::uint64 count, const T& key)
+	{
+		gu::uint64 index = 0;
+
+	#if PLATFORM_CPU_X86_FAMILY
+		if constexpr (details::search::IS_SIMD_SEARCHABLE<T>)
+		{
+			constexpr gu::uint64 laneCount = 16 / sizeof(T);
+			const __m128i keyVector = details::search::Broadcast(key);
+
+			// 4WX^܂Ƃ߂Ĕr, vԂ͕1ɗ}܂
+			for (; index + laneCount * 4 <= count; index += laneCount * 4)
+			{
+				const int mask0 = details::search::CompareEqualMask(array + index                , keyVector);
+				const int mask1 = details::search::CompareEqualMask(array + index + laneCount    , keyVector);
+				const int mask2 = details::search::CompareEqualMask(array + index + laneCount * 2, keyVector);
+				const int mask3 = details::search::CompareEqualMask(array + index + laneCount * 3, keyVector);
+
+				if ((mask0 | mask1 | mask2 | mask3) == 0) { continue; }
+
+				if (mask0) { return static_cast<gu::int64>(index                 + details::search::FirstMatchIndex<T>(mask0)); }
+				if (mask1) { return static_cast<gu::int64>(index + laneCount     + details::search::FirstMatchIndex<T>(mask1)); }
+				if (mask2) { return static_cast<gu::int64>(index + laneCount * 2 + details::search::FirstMatchIndex<T>(mask2)); }
+				return static_cast<gu::int64>(index + laneCount * 3 + details::search::FirstMatchIndex<T>(mask3));
+			}
+
+			for (; index + laneCount <= count; index += laneCount)
+			{
+				const int mask = details::search::CompareEqualMask(array + index, keyVector);
+				if (mask) { return static_cast<gu::int64>(index + details::search::FirstMatchIndex<T>(mask)); }
+			}
+		}
+	#endif
+
+		// c̗vf
+		for (; index < count; ++index)
+		{
+			if (array[index] == key) { return static_cast<gu::int64>(index); }
+		}
+		return NOT_FOUND;
+	}
+
+	/****************************************************************************
+	*							LowerBound
+	****************************************************************************/
+	/* @fn        gu::uint64 Search<T>::LowerBound(const T* array, const gu::uint64 count, const T& key, Compare compare)
+	*  @brief     Branchless Binary Search (O(log_2(N))). 
+	*             compare(array[i], key)falseƂȂŏ̈ʒu(keyȏ̍ŏ̈ʒu)Ԃ܂. 
+	*             T͈͂̍XVtړōs, \~X܂.
+	*  @param[in] const T* array (compareŏɕ񂾔z)
+	*  @param[in] const gu::uint64 count
+	*  @param[in] const T& key
+	*  @param[in] Compare compare
+	*  @return @@gu::uint64 index (SĂ̗vfkey̏ꍇcount)
+	*****************************************************************************/
+	template<typename T> template<typename Compare> gu::uint64 Search<T>::LowerBound(const T* array, const gu::uint64 count, const T& key, Compare compare)
+	{
+		if (count == 0) { return 0; }
+
+		const T*   base   = array;
+		gu::uint64 length = count;
+
+		while (length > 1)
+		{
+			const gu::uint64 half = length / 2;
+
+			// ɔr\̂2ӏǂ݂܂
+			details::search::Prefetch(base + (half / 2));
+			details::search::Prefetch(base + (half + half / 2));
+
+			// 𐶐Ȃ悤, ZŔ͈͂XV܂
+			base   += static_cast<gu::uint64>(compare(base[half - 1], key)) * half;
+			length -= half;
+		}
+		return static_cast<gu::uint64>(base - array) + (compare(*base, key) ? 1 : 0);
+	}
+
+	/****************************************************************************
+	*							UpperBound
+	****************************************************************************/
+	/* @fn        gu::uint64 Search<T>::UpperBound(const T* array, const gu::uint64 count, const T& key, Compare compare)
+	*  @brief     Branchless Binary Search (O(log_2(N))). 
+	*             compare(key, array[i])trueƂȂŏ̈ʒu(key傫ŏ̈ʒu)Ԃ܂.
+	*  @param[in] const T* array (compareŏɕ񂾔z)
+	*  @param[in] const gu::uint64 count
+	*  @param[in] const T& key
+	*  @param[in] Compare compare
+	*  @return @@gu::uint64 index (SĂ̗vfkeyȉ̏ꍇcount)
+	*****************************************************************************/
+	template<typename T> template<typename Compare> gu::uint64 Search<T>::UpperBound(const T* array, const gu::uint64 count, const T& key, Compare compare)
+	{
+		if (count == 0) { return 0; }
+
+		const T*   base   = array;
+		gu::uint64 length = count;
+
+		while (length > 1)
+		{
+			const gu::uint64 half = length / 2;
+
+			// ɔr\̂2ӏǂ݂܂
+			details::search::Prefetch(base + (half / 2));
+			details::search::Prefetch(base + (half + half / 2));
+
+			// 𐶐Ȃ悤, ZŔ͈͂XV܂
+			base   += static_cast<gu::uint64>(!compare(key, base[half - 1])) * half;
+			length -= half;
+		}
+		return static_cast<gu::uint64>(base - array) + (compare(key, *base) ? 0 : 1);
+	}
+
+	/****************************************************************************
+	*							BranchlessBinarySearch
+	****************************************************************************/
+	/* @fn        gu::int64 Search<T>::BranchlessBinarySearch(const T* array, const gu::uint64 count, const T& key, Compare compare)
+	*  @brief     Branchless Binary Search (O(log_2(N))). This algorithm is needed well-ordered ascend data
+	*  @param[in] const T* array
+	*  @param[in] const gu::uint64 count
+	*  @param[in] const T& key
+	*  @param[in] Compare compare
+	*  @return @@gu::int64 index of the first element equal to key (NOT FOUND: -1)
+	*****************************************************************************/
+	template<typename T> template<typename Compare> gu::int64 Search<T>::BranchlessBinarySearch(const T* array, const gu::uint64 count, const T& key, Compare compare)
+	{
+		const gu::uint64 index = LowerBound(array, count, key, compare);
+		return index < count && !compare(key, array[index]) ? static_cast<gu::int64>(index) : NOT_FOUND;
+	}
+
+	/****************************************************************************
+	*							BuildEytzinger
+	****************************************************************************/
+	/* @fn        void Search<T>::BuildEytzinger(const T* sorted, const gu::uint64 count, T* eytzinger, gu::uint64* sortedIndices)
+	*  @brief     \[gςݔz񕪒T؂̕D揇 (Eytzinger layout) ɕבւ܂. 
+	*             TŒHvfz̐擪ɏW܂, qǂ݂ł邽, 傫ȕύXȂ\̒TɌĂ܂.
+	*             eytzinger[0]͎gp, eytzinger[1]ɂȂ܂. 
+	*             vf̐ǂ݂1LbVCɎ܂悤, eytzinger64byteEɔzu邱Ƃ𐄏܂.
+	*  @param[in] const T* sorted (ɕ񂾔z)
+	*  @param[in] const gu::uint64 count
+	*  @param[out]T* eytzinger (count + 1̗vfKvł)
+	*  @param[out]gu::uint64* sortedIndices (C. count + 1̗vf, eʒuɑΉsorted̃CfbNX݂܂)
+	*  @return @@void
+	*****************************************************************************/
+	template<typename T> void Search<T>::BuildEytzinger(const T* sorted, const gu::uint64 count, T* eytzinger, gu::uint64* sortedIndices)
+	{
+		if (count == 0) { return; }
+
+		details::search::BuildEytzinger(sorted, eytzinger, sortedIndices, 0, 1, count);
+	}
+
+	/****************************************************************************
+	*							EytzingerLowerBound
+	****************************************************************************/
+	/* @fn        gu::uint64 Search<T>::EytzingerLowerBound(const T* eytzinger, const gu::uint64 count, const T& key, Compare compare)
+	*  @brief     Eytzingerzɑ΂Lower bound (O(log_2(N))). 
+	*             i̎qǂ݂Ȃ, 򖳂Ŗ؂~܂.
+	*  @param[in] const T* eytzinger (BuildEytzingerō쐬z)
+	*  @param[in] const gu::uint64 count (eytzinger[0]vf)
+	*  @param[in] const T& key
+	*  @param[in] Compare compare
+	*  @return @@gu::uint64 keyȏ̍ŏ̗vfeytzinger̈ʒu (SĂ̗vfkey̏ꍇ0)
+	*****************************************************************************/
+	template<typename T> template<typename Compare> gu::uint64 Search<T>::EytzingerLowerBound(const T* eytzinger, const gu::uint64 count, const T& key, Compare compare)
+	{
+		constexpr gu::uint64 prefetchStride = details::search::EYTZINGER_PREFETCH_STRIDE<T>;
+
+		gu::uint64 node = 1;
+		while (node <= count)
+		{
+			// ͈͊O̐ǂ݂̓ANZXᔽNȂ, ̊mF͍s܂
+			details::search::Prefetch(reinterpret_cast<const char*>(eytzinger) + node * prefetchStride * sizeof(T));
+			node = node * 2 + (compare(eytzinger[node], key) ? 1 : 0);
+		}
+
+		// Ōɍ̎q֐i񂾈ʒu܂Ŗ߂܂ (E֐i񂾉 + 1Vtg܂)
+		return node >> (std::countr_one(node) + 1);
+	}
+
+	/****************************************************************************
+	*							EytzingerSearch
+	****************************************************************************/
+	/* @fn        gu::uint64 Search<T>::EytzingerSearch(const T* eytzinger, const gu::uint64 count, const T& key, Compare compare)
+	*  @brief     Eytzingerz񂩂keyƓvfT܂ (O(log_2(N))).
+	*  @param[in] const T* eytzinger (BuildEytzingerō쐬z)
+	*  @param[in] const gu::uint64 count (eytzinger[0]vf)
+	*  @param[in] const T& key
+	*  @param[in] Compare compare
+	*  @return @@gu::uint64 eytzinger̈ʒu (NOT FOUND: 0)
+	*****************************************************************************/
+	template<typename T> template<typename Compare> gu::uint64 Search<T>::EytzingerSearch(const T* eytzinger, const gu::uint64 count, const T& key, Compare compare)
+	{
+		const gu::uint64 node = EytzingerLowerBound(eytzinger, count, key, compare);
+		return node != 0 && !compare(key, eytzinger[node]) ? node : 0;
+	}
 #pragma endregion Public Function
 #pragma region Private Function
 
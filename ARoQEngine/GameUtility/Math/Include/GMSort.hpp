@@ -11,9 +11,17 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
 #include <iostream>
 #include <vector>
 #include <utility>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <atomic>
+#include <exception>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -25,6 +33,453 @@
 //////////////////////////////////////////////////////////////////////////////////
 namespace gm
 {
+	namespace details::sort
+	{
+		/*! @brief ̗vf͑}\[gs܂*/
+		constexpr gu::int64 INSERTION_SORT_THRESHOLD = 24;
+
+		/*! @brief ̗vf傫ꍇ̓s{bg9_̒l(ninther)Iт܂*/
+		constexpr gu::int64 NINTHER_THRESHOLD = 128;
+
+		/*! @brief ς݂Ɣ肵͈͂ő}\[gۂ, vf̈ړ񐔂̏*/
+		constexpr gu::int64 PARTIAL_INSERTION_SORT_LIMIT = 8;
+
+		/*! @brief 򖳂̃ubNňxɔrvf*/
+		constexpr gu::int64 BLOCK_SIZE = 64;
+
+		/*! @brief r֐std::lessZp^̏ꍇ, \~XubNgp܂*/
+		template<typename T, typename Compare>
+		constexpr bool IS_BRANCHLESS_PARTITION = std::is_arithmetic_v<T> && (std::is_same_v<Compare, std::less<T>> || std::is_same_v<Compare, std::greater<T>> || std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::greater<>>);
+
+		/*! @brief lȂRadixSortŎgp_~[̌^*/
+		struct NoRadixValue {};
+
+		/*---------------------------------------------------------------
+				}\[g
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		void InsertionSort(T* begin, T* end, Compare& compare)
+		{
+			if (begin == end) { return; }
+
+			for (T* current = begin + 1; current != end; ++current)
+			{
+				T* sift     = current;
+				T* siftPrev = current - 1;
+
+				if (compare(*sift, *siftPrev))
+				{
+					T temp = std::move(*sift);
+					do { *sift-- = std::move(*siftPrev); } while (sift != begin && compare(temp, *--siftPrev));
+					*sift = std::move(temp);
+				}
+			}
+		}
+
+		/*---------------------------------------------------------------
+				͈͂̒OɑSvfȉ̒lꍇ̑}\[g (E`FbNȗ܂)
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		void UnguardedInsertionSort(T* begin, T* end, Compare& compare)
+		{
+			if (begin == end) { return; }
+
+			for (T* current = begin + 1; current != end; ++current)
+			{
+				T* sift     = current;
+				T* siftPrev = current - 1;
+
+				if (compare(*sift, *siftPrev))
+				{
+					T temp = std::move(*sift);
+					do { *sift-- = std::move(*siftPrev); } while (compare(temp, *--siftPrev));
+					*sift = std::move(temp);
+				}
+			}
+		}
+
+		/*---------------------------------------------------------------
+				ړ񐔂𒴂܂ő}\[g݂܂. 񂵏Iꍇtrue
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		bool PartialInsertionSort(T* begin, T* end, Compare& compare)
+		{
+			if (begin == end) { return true; }
+
+			gu::int64 moveCount = 0;
+			for (T* current = begin + 1; current != end; ++current)
+			{
+				T* sift     = current;
+				T* siftPrev = current - 1;
+
+				if (compare(*sift, *siftPrev))
+				{
+					T temp = std::move(*sift);
+					do { *sift-- = std::move(*siftPrev); } while (sift != begin && compare(temp, *--siftPrev));
+					*sift = std::move(temp);
+					moveCount += current - sift;
+				}
+
+				if (moveCount > PARTIAL_INSERTION_SORT_LIMIT) { return false; }
+			}
+			return true;
+		}
+
+		template<typename T, typename Compare>
+		inline void Sort3(T* a, T* b, T* c, Compare& compare)
+		{
+			if (compare(*b, *a)) { std::iter_swap(a, b); }
+			if (compare(*c, *b)) { std::iter_swap(b, c); }
+			if (compare(*b, *a)) { std::iter_swap(a, b); }
+		}
+
+		/*---------------------------------------------------------------
+				擪̗vfs{bgƂ, s{bg, ȏEɕ܂.
+				߂l̓s{bg̈ʒu, x(ɕς)ǂł.
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		std::pair<T*, bool> PartitionRight(T* begin, T* end, Compare& compare)
+		{
+			T pivot = std::move(*begin);
+			T* first = begin;
+			T* last  = end;
+
+			// s{bg3_̒lȂ̂, Eǂɂԕ݂܂.
+			while (compare(*++first, pivot));
+
+			if (first - 1 == begin) { while (first < last && !compare(*--last, pivot)); }
+			else                    { while (!compare(*--last, pivot)); }
+
+			const bool isAlreadyPartitioned = first >= last;
+
+			while (first < last)
+			{
+				std::iter_swap(first, last);
+				while (compare(*++first, pivot));
+				while (!compare(*--last, pivot));
+			}
+
+			T* pivotPosition = first - 1;
+			*begin           = std::move(*pivotPosition);
+			*pivotPosition   = std::move(pivot);
+			return { pivotPosition, isAlreadyPartitioned };
+		}
+
+		/*---------------------------------------------------------------
+				ubNŌvfm܂
+		-----------------------------------------------------------------*/
+		template<typename T>
+		inline void SwapOffsets(T* first, T* last, const gu::uint8* offsetsLeft, const gu::uint8* offsetsRight, const gu::uint64 count, const bool useSwap)
+		{
+			if (useSwap)
+			{
+				// E̐vꍇ͏uɂ1vf邽, PȌs܂
+				for (gu::uint64 i = 0; i < count; ++i)
+				{
+					std::iter_swap(first + offsetsLeft[i], last - offsetsRight[i]);
+				}
+			}
+			else if (count > 0)
+			{
+				T* left  = first + offsetsLeft[0];
+				T* right = last - offsetsRight[0];
+				T temp = std::move(*left);
+				*left = std::move(*right);
+				for (gu::uint64 i = 1; i < count; ++i)
+				{
+					left   = first + offsetsLeft[i];
+					*right = std::move(*left);
+					right  = last - offsetsRight[i];
+					*left  = std::move(*right);
+				}
+				*right = std::move(temp);
+			}
+		}
+
+		/*---------------------------------------------------------------
+				PartitionRight̕򖳂 (BlockQuicksort)
+				rʂItZbg̔zɏ, ォ܂Ƃ߂Č邱Ƃŕ\~X܂.
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		std::pair<T*, bool> PartitionRightBranchless(T* begin, T* end, Compare& compare)
+		{
+			T pivot = std::move(*begin);
+			T* first = begin;
+			T* last  = end;
+
+			while (compare(*++first, pivot));
+
+			if (first - 1 == begin) { while (first < last && !compare(*--last, pivot)); }
+			else                    { while (!compare(*--last, pivot)); }
+
+			const bool isAlreadyPartitioned = first >= last;
+
+			if (!isAlreadyPartitioned)
+			{
+				std::iter_swap(first, last);
+				++first;
+
+				alignas(64) gu::uint8 offsetsLeftStorage [BLOCK_SIZE];
+				alignas(64) gu::uint8 offsetsRightStorage[BLOCK_SIZE];
+				gu::uint8* offsetsLeft  = offsetsLeftStorage;
+				gu::uint8* offsetsRight = offsetsRightStorage;
+
+				T* offsetsLeftBase  = first;
+				T* offsetsRightBase = last;
+				gu::uint64 leftCount = 0, rightCount = 0, leftStart = 0, rightStart = 0;
+
+				while (first < last)
+				{
+					// Б̃ItZbg̏ꍇ̂, ̗̑vfr܂
+					const gu::uint64 unknownCount = static_cast<gu::uint64>(last - first);
+					const gu::uint64 leftSplit    = leftCount  == 0 ? (rightCount == 0 ? unknownCount / 2 : unknownCount) : 0;
+					const gu::uint64 rightSplit   = rightCount == 0 ? (unknownCount - leftSplit) : 0;
+
+					const gu::uint64 leftBlock = leftSplit < BLOCK_SIZE ? leftSplit : BLOCK_SIZE;
+					for (gu::uint64 i = 0; i < leftBlock; ++i)
+					{
+						offsetsLeft[leftCount] = static_cast<gu::uint8>(i);
+						leftCount += !compare(*first, pivot);
+						++first;
+					}
+
+					const gu::uint64 rightBlock = rightSplit < BLOCK_SIZE ? rightSplit : BLOCK_SIZE;
+					for (gu::uint64 i = 0; i < rightBlock;)
+					{
+						offsetsRight[rightCount] = static_cast<gu::uint8>(++i);
+						rightCount += compare(*--last, pivot);
+					}
+
+					const gu::uint64 swapCount = leftCount < rightCount ? leftCount : rightCount;
+					SwapOffsets(offsetsLeftBase, offsetsRightBase, offsetsLeft + leftStart, offsetsRight + rightStart, swapCount, leftCount == rightCount);
+					leftCount  -= swapCount; rightCount -= swapCount;
+					leftStart  += swapCount; rightStart += swapCount;
+
+					if (leftCount  == 0) { leftStart  = 0; offsetsLeftBase  = first; }
+					if (rightCount == 0) { rightStart = 0; offsetsRightBase = last;  }
+				}
+
+				// БɎcvf𒆉֊񂹂܂
+				if (leftCount)
+				{
+					offsetsLeft += leftStart;
+					while (leftCount--) { std::iter_swap(offsetsLeftBase + offsetsLeft[leftCount], --last); }
+					first = last;
+				}
+				if (rightCount)
+				{
+					offsetsRight += rightStart;
+					while (rightCount--) { std::iter_swap(offsetsRightBase - offsetsRight[rightCount], first); ++first; }
+					last = first;
+				}
+			}
+
+			T* pivotPosition = first - 1;
+			*begin           = std::move(*pivotPosition);
+			*pivotPosition   = std::move(pivot);
+			return { pivotPosition, isAlreadyPartitioned };
+		}
+
+		/*---------------------------------------------------------------
+				s{bgƓvfɏW߂܂. (ŐԂ̃s{bgƓꍇɎgp, d̑zO(N)ŏ܂)
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		T* PartitionLeft(T* begin, T* end, Compare& compare)
+		{
+			T pivot = std::move(*begin);
+			T* first = begin;
+			T* last  = end;
+
+			while (compare(pivot, *--last));
+
+			if (last + 1 == end) { while (first < last && !compare(pivot, *++first)); }
+			else                 { while (!compare(pivot, *++first)); }
+
+			while (first < last)
+			{
+				std::iter_swap(first, last);
+				while (compare(pivot, *--last));
+				while (!compare(pivot, *++first));
+			}
+
+			T* pivotPosition = last;
+			*begin           = std::move(*pivotPosition);
+			*pivotPosition   = std::move(pivot);
+			return pivotPosition;
+		}
+
+		/*---------------------------------------------------------------
+				Pattern-defeating quicksort {
+				傫΂񐔂ɒBꍇ̓q[v\[g֐؂ւ, ňvZʂO(N log N)ɗ}܂.
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare, bool IsBranchless>
+		void PatternDefeatingQuickSort(T* begin, T* end, Compare& compare, gu::int32 badAllowed, bool isLeftMost)
+		{
+			while (true)
+			{
+				const gu::int64 size = end - begin;
+
+				if (size < INSERTION_SORT_THRESHOLD)
+				{
+					if (isLeftMost) { InsertionSort(begin, end, compare); }
+					else            { UnguardedInsertionSort(begin, end, compare); }
+					return;
+				}
+
+				// s{bg̑I (擪ֈړ܂)
+				const gu::int64 half = size / 2;
+				if (size > NINTHER_THRESHOLD)
+				{
+					Sort3(begin           , begin + half      , end - 1           , compare);
+					Sort3(begin + 1       , begin + (half - 1), end - 2           , compare);
+					Sort3(begin + 2       , begin + (half + 1), end - 3           , compare);
+					Sort3(begin + (half - 1), begin + half    , begin + (half + 1), compare);
+					std::iter_swap(begin, begin + half);
+				}
+				else
+				{
+					Sort3(begin + half, begin, end - 1, compare);
+				}
+
+				// ŐԂ̃s{bgƓꍇ, vf܂Ƃ߂ďO܂
+				if (!isLeftMost && !compare(*(begin - 1), *begin))
+				{
+					begin = PartitionLeft(begin, end, compare) + 1;
+					continue;
+				}
+
+				const auto [pivotPosition, isAlreadyPartitioned] = IsBranchless ? PartitionRightBranchless(begin, end, compare) : PartitionRight(begin, end, compare);
+
+				const gu::int64 leftSize  = pivotPosition - begin;
+				const gu::int64 rightSize = end - (pivotPosition + 1);
+				const bool isHighlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+				if (isHighlyUnbalanced)
+				{
+					if (--badAllowed == 0)
+					{
+						std::make_heap(begin, end, compare);
+						std::sort_heap(begin, end, compare);
+						return;
+					}
+
+					// vfւ, ̃s{bgIœp^[ɓȂ悤ɂ܂
+					if (leftSize >= INSERTION_SORT_THRESHOLD)
+					{
+						std::iter_swap(begin            , begin + leftSize / 4);
+						std::iter_swap(pivotPosition - 1, pivotPosition - leftSize / 4);
+						if (leftSize > NINTHER_THRESHOLD)
+						{
+							std::iter_swap(begin + 1        , begin + (leftSize / 4 + 1));
+							std::iter_swap(begin + 2        , begin + (leftSize / 4 + 2));
+							std::iter_swap(pivotPosition - 2, pivotPosition - (leftSize / 4 + 1));
+							std::iter_swap(pivotPosition - 3, pivotPosition - (leftSize / 4 + 2));
+						}
+					}
+					if (rightSize >= INSERTION_SORT_THRESHOLD)
+					{
+						std::iter_swap(pivotPosition + 1, pivotPosition + (1 + rightSize / 4));
+						std::iter_swap(end - 1          , end - rightSize / 4);
+						if (rightSize > NINTHER_THRESHOLD)
+						{
+							std::iter_swap(pivotPosition + 2, pivotPosition + (2 + rightSize / 4));
+							std::iter_swap(pivotPosition + 3, pivotPosition + (3 + rightSize / 4));
+							std::iter_swap(end - 2          , end - (1 + rightSize / 4));
+							std::iter_swap(end - 3          , end - (2 + rightSize / 4));
+						}
+					}
+				}
+				else if (isAlreadyPartitioned && PartialInsertionSort(begin, pivotPosition, compare) && PartialInsertionSort(pivotPosition + 1, end, compare))
+				{
+					// ɐς݂ɋ߂z͂ŏI܂
+					return;
+				}
+
+				// ͍ċA, E̓[vŏ܂
+				PatternDefeatingQuickSort<T, Compare, IsBranchless>(begin, pivotPosition, compare, badAllowed, isLeftMost);
+				begin      = pivotPosition + 1;
+				isLeftMost = false;
+			}
+		}
+
+		/*---------------------------------------------------------------
+				}[WkԖڂ܂ł̏o͂Ɋ܂܂first̗vf񕪒Tŋ߂܂ (Merge path)
+		-----------------------------------------------------------------*/
+		template<typename T, typename Compare>
+		gu::uint64 MergeCoRank(const gu::uint64 k, const T* first, const gu::uint64 firstCount, const T* second, const gu::uint64 secondCount, Compare& compare)
+		{
+			gu::uint64 low  = k > secondCount ? k - secondCount : 0;
+			gu::uint64 high = k < firstCount  ? k : firstCount;
+
+			while (low < high)
+			{
+				const gu::uint64 i = low + (high - low) / 2;
+				const gu::uint64 j = k - i;
+
+				// first[i]second[j - 1]ȉȂ, first[i]k̒Ɋ܂܂܂
+				if (j > 0 && !compare(second[j - 1], first[i])) { low = i + 1; }
+				else                                            { high = i; }
+			}
+			return low;
+		}
+
+		/*---------------------------------------------------------------
+				taskCount̃^XNĂяoƃXbhv[̃[J[ŕĎs, SĂ̊҂܂
+				Ăяooʒu^XNo, [J[SĖ܂Ăꍇv[̃^XNĂяoꍇ
+				ĂяoōŌ܂ŏł܂. futureł͂Ȃς݂̃^XNő҂܂.
+		-----------------------------------------------------------------*/
+		template<typename Function>
+		void RunTasks(gu::ThreadPool& threadPool, const gu::uint64 taskCount, const Function& function)
+		{
+			if (taskCount == 0) { return; }
+
+			struct SharedState
+			{
+				std::atomic<gu::uint64> NextTask      = 0;
+				std::atomic<gu::uint64> FinishedCount = 0;
+				std::atomic<bool>       HasException  = false;
+				std::exception_ptr      Exception     = nullptr;
+			};
+			const auto state = std::make_shared<SharedState>();
+
+			// Ɏsꂽ[J[̓^XNoɖ߂邽, function̎QƂɂ͐G܂
+			const auto run = [state, &function, taskCount]()
+			{
+				for (gu::uint64 task = state->NextTask.fetch_add(1, std::memory_order_relaxed); task < taskCount; task = state->NextTask.fetch_add(1, std::memory_order_relaxed))
+				{
+					try
+					{
+						function(task);
+					}
+					catch (...)
+					{
+						// ŏ̗Ô݂ێ, ͐i߂ČĂяȏҋ@I点܂
+						if (!state->HasException.exchange(true, std::memory_order_relaxed)) { state->Exception = std::current_exception(); }
+					}
+
+					if (state->FinishedCount.fetch_add(1, std::memory_order_release) + 1 == taskCount)
+					{
+						state->FinishedCount.notify_one();
+					}
+				}
+			};
+
+			const gu::uint64 helperCount = threadPool.GetThreadCount() < taskCount - 1 ? threadPool.GetThreadCount() : taskCount - 1;
+			for (gu::uint64 i = 0; i < helperCount; ++i)
+			{
+				threadPool.Submit(run);
+			}
+			run();
+
+			for (gu::uint64 finished = state->FinishedCount.load(std::memory_order_acquire); finished != taskCount; finished = state->FinishedCount.load(std::memory_order_acquire))
+			{
+				state->FinishedCount.wait(finished, std::memory_order_acquire);
+			}
+
+			if (state->Exception) { std::rethrow_exception(state->Exception); }
+		}
+	}
+
 	/****************************************************************************
 	*				  			Sort
 	****************************************************************************/
@@ -65,9 +520,25 @@ namespace gm
 		static void MergeSortDescend    (std::vector<T>& vector, int left, int right);
 		static void QuickSortAscend     (std::vector<T>& vector, int left, int right);
 		static void QuickSortDescend    (std::vector<T>& vector, int left, int right);
+
+		// for large array (64bit size)
+		template<typename Compare = std::less<T>>
+		static void IntroSort(T* array, const gu::uint64 count, Compare compare = Compare());
+
+		static void RadixSort(T* keys, const gu::uint64 count);
+		static void RadixSort(T* keys, const gu::uint64 count, T* keyBuffer);
+
+		template<typename Value>
+		static void RadixSort(T* keys, Value* values, const gu::uint64 count, T* keyBuffer, Value* valueBuffer);
+
+		template<typename Compare = std::less<T>>
+		static void ParallelSort(T* array, const gu::uint64 count, gu::ThreadPool& threadPool, Compare compare = Compare());
+
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
+		// ̗vf̏ꍇ, ParallelSort͌ĂяõXbĥ݂IntroSorts܂
+		static constexpr gu::uint64 PARALLEL_SORT_THRESHOLD = 65536;
 
 		/****************************************************************************
 		**                Constructor and Destructor
@@ -714,6 +1185,234 @@ namespace gm
 			gm::Sort<T>::MergeDescend  (vector, left, mid, right);
 		}
 	}
+	/****************************************************************************
+	*							IntroSort
+	****************************************************************************/
+	/* @fn        void Sort<T>::IntroSort(T* array, const gu::uint64 count, Compare compare)
+	*  @brief     Pattern-defeating quicksort (O(nlogn))(unstable).
+	*             s{bg9_̒lgp, ΂葱ꍇ̓q[v\[g֐؂ւ܂.
+	*             ς, t, d̑zO(n)ɋ߂Ԃŏ܂.
+	*             Zp^std::less / std::greaterŕׂꍇ, 򖳂̃ubNgp܂.
+	*  @param[out]T* array
+	*  @param[in] const gu::uint64 count
+	*  @param[in] Compare compare (a < b̎trueԂr֐)
+	*  @return @@void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::IntroSort(T* array, const gu::uint64 count, Compare compare)
+	{
+		if (array == nullptr || count < 2) { return; }
+
+		// ̕΂log2(n)܂ŋe܂
+		gu::int32 badAllowed = 0;
+		for (gu::uint64 n = count; n > 1; n >>= 1) { ++badAllowed; }
+
+		details::sort::PatternDefeatingQuickSort<T, Compare, details::sort::IS_BRANCHLESS_PARTITION<T, Compare>>(array, array + count, compare, badAllowed, true);
+	}
+
+	/****************************************************************************
+	*							RadixSort
+	****************************************************************************/
+	/* @fn        void Sort<T>::RadixSort(T* keys, const gu::uint64 count)
+	*  @brief     LSD Radix Sort (O(n))(stable). Ɨp̃obt@Ŋmۂ܂.
+	*  @param[out]T* keys (32bit܂64bit̕Ȃ)
+	*  @param[in] const gu::uint64 count
+	*  @return @@void
+	*****************************************************************************/
+	template<typename T> void Sort<T>::RadixSort(T* keys, const gu::uint64 count)
+	{
+		if (keys == nullptr || count < 2) { return; }
+
+		std::unique_ptr<T[]> keyBuffer(new T[count]);
+		RadixSort(keys, count, keyBuffer.get());
+	}
+
+	/****************************************************************************
+	*							RadixSort
+	****************************************************************************/
+	/* @fn        void Sort<T>::RadixSort(T* keys, const gu::uint64 count, T* keyBuffer)
+	*  @brief     LSD Radix Sort (O(n))(stable).
+	*  @param[out]T* keys (32bit܂64bit̕Ȃ)
+	*  @param[in] const gu::uint64 count
+	*  @param[in] T* keyBuffer (countȏ̗vfƗpobt@)
+	*  @return @@void
+	*****************************************************************************/
+	template<typename T> void Sort<T>::RadixSort(T* keys, const gu::uint64 count, T* keyBuffer)
+	{
+		RadixSort<details::sort::NoRadixValue>(keys, nullptr, count, keyBuffer, nullptr);
+	}
+
+	/****************************************************************************
+	*							RadixSort
+	****************************************************************************/
+	/* @fn        void Sort<T>::RadixSort(T* keys, Value* values, const gu::uint64 count, T* keyBuffer, Value* valueBuffer)
+	*  @brief     LSD Radix Sort (O(n))(stable). L[̕ёւɍ킹Ēl(yC[h)ёւ܂.
+	*             8bit, SẴL[œlƂȂ錅͕ёւȗ܂.
+	*  @param[out]T*     keys (32bit܂64bit̕Ȃ)
+	*  @param[out]Value* values
+	*  @param[in] const gu::uint64 count
+	*  @param[in] T*     keyBuffer   (countȏ̗vfƗpobt@)
+	*  @param[in] Value* valueBuffer (countȏ̗vfƗpobt@)
+	*  @return @@void
+	*****************************************************************************/
+	template<typename T> template<typename Value> void Sort<T>::RadixSort(T* keys, Value* values, const gu::uint64 count, T* keyBuffer, Value* valueBuffer)
+	{
+		static_assert(std::is_unsigned_v<T> && (sizeof(T) == 4 || sizeof(T) == 8), "RadixSort supports only 32bit or 64bit unsigned integer keys.");
+
+		constexpr bool hasValue   = !std::is_same_v<Value, details::sort::NoRadixValue>;
+		constexpr int  digitCount = static_cast<int>(sizeof(T));
+
+		if (keys == nullptr || count < 2) { return; }
+
+		/*-------------------------------------------------------------------
+		-        SĂ̌̃qXgOx̑ō쐬܂
+		---------------------------------------------------------------------*/
+		std::unique_ptr<gu::uint64[]> histograms(new gu::uint64[digitCount * 256]());
+		for (gu::uint64 i = 0; i < count; ++i)
+		{
+			const T key = keys[i];
+			for (int digit = 0; digit < digitCount; ++digit)
+			{
+				++histograms[digit * 256 + ((key >> (digit * 8)) & 0xFF)];
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-        ʂ̌珇ɕz܂. (qXgÔ܂܏݈ʒuɕϊ܂)
+		---------------------------------------------------------------------*/
+		T*     sourceKeys        = keys;
+		T*     destinationKeys   = keyBuffer;
+		Value* sourceValues      = values;
+		Value* destinationValues = valueBuffer;
+
+		for (int digit = 0; digit < digitCount; ++digit)
+		{
+			gu::uint64* histogram = &histograms[digit * 256];
+
+			// SẴL[œľ͕тςȂߏȗ܂
+			if (histogram[(sourceKeys[0] >> (digit * 8)) & 0xFF] == count) { continue; }
+
+			gu::uint64 offset = 0;
+			for (int bucket = 0; bucket < 256; ++bucket)
+			{
+				const gu::uint64 bucketCount = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucketCount;
+			}
+
+			const int shift = digit * 8;
+			for (gu::uint64 i = 0; i < count; ++i)
+			{
+				const T key = sourceKeys[i];
+				const gu::uint64 position = histogram[(key >> shift) & 0xFF]++;
+				destinationKeys[position] = key;
+				if constexpr (hasValue) { destinationValues[position] = std::move(sourceValues[i]); }
+			}
+
+			std::swap(sourceKeys, destinationKeys);
+			if constexpr (hasValue) { std::swap(sourceValues, destinationValues); }
+		}
+
+		// z̉񐔂̏ꍇ͌ʂƗpobt@ɂ邽, ̔z֏߂܂
+		if (sourceKeys != keys)
+		{
+			std::copy(sourceKeys, sourceKeys + count, keys);
+			if constexpr (hasValue) { std::move(sourceValues, sourceValues + count, values); }
+		}
+	}
+
+	/****************************************************************************
+	*							ParallelSort
+	****************************************************************************/
+	/* @fn        void Sort<T>::ParallelSort(T* array, const gu::uint64 count, gu::ThreadPool& threadPool, Compare compare)
+	*  @brief     Parallel Merge Sort (O(nlogn))(unstable).
+	*             zXbhȏ̋ԂɕIntroSortŐ񂵂, ԓmɃ}[W܂.
+	*             e}[WMerge pathŏo͂ϓɕ邽, }[W̒iiłSẴXbhgp܂.
+	*             ĂяõXbh[J[Ɠ悤Ƀ^XNoď, I܂őҋ@܂.
+	*             ̂threadPool̃^XN瓯threadPoolw肵ꍇ, [J[1̏ꍇfbhbN܂.
+	*  @param[out]T* array
+	*  @param[in] const gu::uint64 count
+	*  @param[in] gu::ThreadPool& threadPool
+	*  @param[in] Compare compare (a < b̎trueԂr֐)
+	*  @return @@void
+	*****************************************************************************/
+	template<typename T> template<typename Compare> void Sort<T>::ParallelSort(T* array, const gu::uint64 count, gu::ThreadPool& threadPool, Compare compare)
+	{
+		const gu::uint64 threadCount = static_cast<gu::uint64>(threadPool.GetThreadCount()) + 1;
+
+		if (array == nullptr || count < 2) { return; }
+		if (count < PARALLEL_SORT_THRESHOLD || threadCount < 2)
+		{
+			IntroSort(array, count, compare);
+			return;
+		}
+
+		/*-------------------------------------------------------------------
+		-        ԂƂ̐ (Ԃ̐̓Xbhȏ2ׂ̂ɂ܂)
+		---------------------------------------------------------------------*/
+		gu::uint64 chunkCount = 1;
+		while (chunkCount < threadCount && count / (chunkCount * 2) >= PARALLEL_SORT_THRESHOLD / 4) { chunkCount *= 2; }
+
+		const auto chunkBegin = [count, chunkCount](const gu::uint64 chunk) { return count * chunk / chunkCount; };
+
+		details::sort::RunTasks(threadPool, chunkCount, [array, &chunkBegin, &compare](const gu::uint64 chunk)
+		{
+			IntroSort(array + chunkBegin(chunk), chunkBegin(chunk + 1) - chunkBegin(chunk), compare);
+		});
+
+		if (chunkCount == 1) { return; }
+
+		/*-------------------------------------------------------------------
+		-        ׂ荇Ԃ̃}[W (zƍƗpobt@݂Ɏgp܂)
+		---------------------------------------------------------------------*/
+		std::unique_ptr<T[]> buffer(new T[count]);
+		T* source      = array;
+		T* destination = buffer.get();
+
+		for (gu::uint64 width = 1; width < chunkCount; width *= 2)
+		{
+			const gu::uint64 mergeCount = chunkCount / (width * 2);
+
+			// 1̃}[W̃^XNɕ邩 (iɊւ炸vXbhxɂȂ悤ɂ܂)
+			const gu::uint64 taskPerMerge = (threadCount + mergeCount - 1) / mergeCount;
+
+			details::sort::RunTasks(threadPool, mergeCount * taskPerMerge, [=, &chunkBegin, &compare](const gu::uint64 index)
+			{
+				const gu::uint64 merge = index / taskPerMerge;
+				const gu::uint64 task  = index % taskPerMerge;
+
+				const gu::uint64 begin  = chunkBegin(merge * width * 2);
+				const gu::uint64 middle = chunkBegin(merge * width * 2 + width);
+				const gu::uint64 end    = chunkBegin(merge * width * 2 + width * 2);
+
+				const T* first       = source + begin;
+				const T* second      = source + middle;
+				const gu::uint64 firstCount  = middle - begin;
+				const gu::uint64 secondCount = end - middle;
+				T* output            = destination + begin;
+
+				const gu::uint64 outputBegin = (end - begin) * task / taskPerMerge;
+				const gu::uint64 outputEnd   = (end - begin) * (task + 1) / taskPerMerge;
+
+				const gu::uint64 i0 = details::sort::MergeCoRank(outputBegin, first, firstCount, second, secondCount, compare);
+				const gu::uint64 i1 = details::sort::MergeCoRank(outputEnd  , first, firstCount, second, secondCount, compare);
+				std::merge(first + i0, first + i1, second + (outputBegin - i0), second + (outputEnd - i1), output + outputBegin, compare);
+			});
+
+			std::swap(source, destination);
+		}
+
+		// }[W̒i̏ꍇ͌ʂƗpobt@ɂ邽, ̔z֏߂܂
+		if (source != array)
+		{
+			const gu::uint64 copyChunk = (count + threadCount - 1) / threadCount;
+			details::sort::RunTasks(threadPool, (count + copyChunk - 1) / copyChunk, [source, array, count, copyChunk](const gu::uint64 task)
+			{
+				const gu::uint64 begin = task * copyChunk;
+				const gu::uint64 end   = begin + copyChunk < count ? begin + copyChunk : count;
+				std::move(source + begin, source + end, array + begin);
+			});
+		}
+	}
 #pragma endregion Public Function
 #pragma region Private Function
 	/****************************************************************************
@@ -48,41 +48,104 @@ namespace gm
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
-		// @brief : [J3ʒu
-		Vector3f    LocalPosition;
+		/*----------------------------------------------------------------------
+		*  @brief : [J3ʒu
+		*----------------------------------------------------------------------*/
+		__forceinline const Vector3f& GetLocalPosition() const { return _localPosition; }
+
+		/*----------------------------------------------------------------------
+		*  @brief : [J̎p
+		*----------------------------------------------------------------------*/
+		__forceinline const QuaternionF& GetLocalRotation() const { return _localRotation; }
+
+		/*----------------------------------------------------------------------
+		*  @brief : [J̊g嗦
+		*----------------------------------------------------------------------*/
+		__forceinline const Vector3f& GetLocalScale() const { return _localScale; }
 
-		// @brief : [J̎p
-		QuaternionF LocalRotation;
+		/*----------------------------------------------------------------------
+		*  @brief : [J3ʒuݒ肵, gƎq̃[hsČvZΏۂɂ܂
+		*----------------------------------------------------------------------*/
+		__forceinline void SetLocalPosition(const Vector3f& position)
+		{
+			_localPosition = position;
+			MarkDirty();
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : [J̎pݒ肵, gƎq̃[hsČvZΏۂɂ܂
+		*----------------------------------------------------------------------*/
+		__forceinline void SetLocalRotation(const QuaternionF& rotation)
+		{
+			_localRotation = rotation;
+			MarkDirty();
+		}
 
-		// @brief : [J̊g嗦
-		Vector3f    LocalScale;
+		/*----------------------------------------------------------------------
+		*  @brief : [J̊g嗦ݒ肵, gƎq̃[hsČvZΏۂɂ܂
+		*----------------------------------------------------------------------*/
+		__forceinline void SetLocalScale(const Vector3f& scale)
+		{
+			_localScale = scale;
+			MarkDirty();
+		}
 
 		/*----------------------------------------------------------------------
 		*  @brief : eݒ肵܂
 		*----------------------------------------------------------------------*/
 		__forceinline void SetParent(Transform* parent)
 		{
-			if (_parent != nullptr) { RemoveChild(this); }
+			if (_parent != nullptr) { _parent->RemoveChild(this); }
 			if (parent  != nullptr) { parent->SetChild(this); }
 			_parent = parent;
+			MarkWorldDirty();
 		}
 
 		/*----------------------------------------------------------------------
-		*  @brief :@Scale * Rotation * Transtionϊs擾
+		*  @brief :@Scale * Rotation * Transtion * ẽ[hs 烏[hs擾 @n
+		*            ύX̂ȂԂ̓LbV̂܂ܕԂO(1)ł. ύX̍ŏ̌Ăяô, ČvZKvȑcH܂. @n
+		*            LbVXV邽߃XbhZ[tł͂܂. Kw1̃XbĥݎQƂĂ. @n
+		*            ԂQƂ͎Set֐ĂяočČvZ܂ŗLł.
 		*----------------------------------------------------------------------*/
-		__forceinline Matrix4f GetMatrix() const
+		__forceinline const Matrix4f& GetMatrix() const
 		{
-			Matrix4f parent = _parent != nullptr ? _parent->GetMatrix() : Matrix4f();
-			return (Scaling(LocalScale) * RotationQuaternion(LocalRotation) * Translation(LocalPosition) * parent);
+			if (_isWorldDirty) { UpdateWorldMatrix(); }
+			return _worldMatrix;
 		}
 
 		/*----------------------------------------------------------------------
-		*  @brief :@Scale * Rotation * Transtionϊs擾
+		*  @brief :@Scale * Rotation * Transtion * ẽ[hs 烏[hs擾
 		*----------------------------------------------------------------------*/
-		__forceinline Float4x4 GetFloat4x4()
+		__forceinline Float4x4 GetFloat4x4() const
 		{
-			Matrix4f parent = _parent != nullptr ? _parent->GetMatrix() : Matrix4f();
-			return (Scaling(LocalScale) * RotationQuaternion(LocalRotation) * Translation(LocalPosition) * parent).ToFloat4x4();
+			return GetMatrix().ToFloat4x4();
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief :@Scale * Rotation * Transtion烍[Js擾
+		*----------------------------------------------------------------------*/
+		__forceinline const Matrix4f& GetLocalMatrix() const
+		{
+			if (_isLocalDirty) { UpdateLocalMatrix(); }
+			return _localMatrix;
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief :@[hsČvZ񐔂ł. O擾lƔׂ邱Ƃ, sĎ擾ɕύXoł܂.
+		*----------------------------------------------------------------------*/
+		__forceinline gu::uint64 GetWorldVersion() const
+		{
+			if (_isWorldDirty) { UpdateWorldMatrix(); }
+			return _worldVersion;
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief :@̎擾Ƀ[Js, gƎq̃[hsKČvZ܂
+		*----------------------------------------------------------------------*/
+		__forceinline void MarkDirty()
+		{
+			_isLocalDirty = true;
+			MarkWorldDirty();
 		}
 
 		/*----------------------------------------------------------------------
@@ -112,30 +175,88 @@ namespace gm
 		**                Constructor and Destructor
 		*****************************************************************************/
 		// @brief : Default Constructor
-		Transform() : LocalPosition(Vector3f()), LocalRotation(QuaternionF()), LocalScale(Vector3f(1,1,1)) {}
+		Transform() : _localPosition(Vector3f()), _localRotation(QuaternionF()), _localScale(Vector3f(1,1,1)) {}
 		
 		// @brief : 3ʒugď
-		Transform(const Vector3f& position) : LocalPosition(position), LocalRotation(QuaternionF()), LocalScale(Vector3f(1, 1, 1)) {};
+		Transform(const Vector3f& position) : _localPosition(position), _localRotation(QuaternionF()), _localScale(Vector3f(1, 1, 1)) {};
 		
 		// @brief : 3ʒuƃNH[^jIgď
-		Transform(const Vector3f& position, const QuaternionF& rotation) : LocalPosition(position), LocalRotation(rotation), LocalScale(Vector3f(1, 1, 1)) {};
+		Transform(const Vector3f& position, const QuaternionF& rotation) : _localPosition(position), _localRotation(rotation), _localScale(Vector3f(1, 1, 1)) {};
 
 		// @brief : 3ʒuƃNH[^jIƃXP[gď
-		Transform(const Vector3f& position, const QuaternionF& rotation, const Vector3f& scale) : LocalPosition(position), LocalRotation(rotation), LocalScale(scale) {};
+		Transform(const Vector3f& position, const QuaternionF& rotation, const Vector3f& scale) : _localPosition(position), _localRotation(rotation), _localScale(scale) {};
 		
-		~Transform() { SetParent(nullptr); }
+		~Transform()
+		{
+			for (gu::uint64 i = 0; i < _children.Size(); ++i)
+			{
+				_children[i]->_parent = nullptr;
+				_children[i]->MarkWorldDirty();
+			}
+			SetParent(nullptr);
+		}
 
 	private:
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
-		
+		/*----------------------------------------------------------------------
+		*  @brief : gƎq̃[hsČvZΏۂɂ܂. @n
+		*           ČvZΏۂ̎q͏ɍČvZΏۂ̂, ɍČvZΏۂ̏ꍇ͂̐H܂.
+		*----------------------------------------------------------------------*/
+		void MarkWorldDirty()
+		{
+			if (_isWorldDirty) { return; }
+
+			_isWorldDirty = true;
+			for (gu::uint64 i = 0; i < _children.Size(); ++i)
+			{
+				_children[i]->MarkWorldDirty();
+			}
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : [JsČvZ܂
+		*----------------------------------------------------------------------*/
+		__forceinline void UpdateLocalMatrix() const
+		{
+			_localMatrix  = Scaling(_localScale) * RotationQuaternion(_localRotation) * Translation(_localPosition);
+			_isLocalDirty = false;
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief : [hsČvZ܂. eČvZΏۂ̏ꍇ͐ɐeČvZ܂.
+		*----------------------------------------------------------------------*/
+		void UpdateWorldMatrix() const
+		{
+			if (_isLocalDirty) { UpdateLocalMatrix(); }
+
+			_worldMatrix  = _parent != nullptr ? _localMatrix * _parent->GetMatrix() : _localMatrix;
+			_isWorldDirty = false;
+			++_worldVersion;
+		}
 
 		/****************************************************************************
 		**                Private Property
 		*****************************************************************************/
 		Transform* _parent = nullptr;
 		gu::DynamicArray<Transform*> _children = {};
+
+		// @brief : [J3ʒu, p, g嗦
+		Vector3f    _localPosition;
+		QuaternionF _localRotation;
+		Vector3f    _localScale;
+
+		// @brief : vZʂ̍s
+		mutable Matrix4f _localMatrix = {};
+		mutable Matrix4f _worldMatrix = {};
+
+		// @brief : [hsČvZ
+		mutable gu::uint64 _worldVersion = 0;
+
+		// @brief : ̎擾Ƀ[Js, [hsČvZ邩
+		mutable bool _isLocalDirty = true;
+		mutable bool _isWorldDirty = true;
 	};
 
 }
@@ -0,0 +1,273 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMTransformHierarchy.hpp
+///  @brief  ʂTransform̐eqKw𕽒RȔzŕێ, [hs1̐`ł܂Ƃ߂čXVNXł. @n
+///          em[h͐eKqOɗ鏇([D̍s)ŕבւĕێ邽, ẽ[hs͏ɌvZς݂̏ԂŎqł܂. @n
+///          ܂, [gɑm[h͘A͈͂ɕԂ, [gƂɕăXbhōXVł܂.
+///  @author toide
+///  @date   2026/10/20 0:41:37
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GM_TRANSFORM_HIERARCHY_HPP
+#define GM_TRANSFORM_HIERARCHY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GMMatrix.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gm
+{
+	namespace details::transform
+	{
+		/*! @brief eȂƂ\z̃CfbNX*/
+		constexpr gu::uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+		/*! @brief m[h̏Ԃ\tO*/
+		constexpr gu::uint8 FLAG_LOCAL_DIRTY   = 1 << 0; // [Js̍ČvZKv
+		constexpr gu::uint8 FLAG_WORLD_DIRTY   = 1 << 1; // e̕ύXȂǂŃ[hs̍ČvZKv
+		constexpr gu::uint8 FLAG_WORLD_CHANGED = 1 << 2; // OUpdateŃ[hs񂪍XVꂽ
+		constexpr gu::uint8 FLAG_REMOVED       = 1 << 3; // 폜҂
+	}
+
+	/****************************************************************************
+	*				  			   TransformHierarchy
+	****************************************************************************/
+	/* @brief  Transform̐eqKw𕽒Rĕێ, ύX̂m[hƂ̎q̃[hs񂾂ČvZ܂. @n
+	*          [J̈ʒu, ], g嗦SoA`ŕێ, Update Scale * Rotation * Translation * ParentWorld (sxNg`) vZ܂. @n
+	*          m[hHandleŎQƂ܂. בւNĂHandle͕ς܂. @n
+	*          m[h̒ǉ, e̕ύX, 폜͎Updateł܂Ƃ߂ĕבւɔf܂.
+	*****************************************************************************/
+	class TransformHierarchy : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Property
+		using Handle = gu::uint32;
+
+		/*! @brief ȃnh (eȂƂ\ꍇɂgp܂)*/
+		static constexpr Handle INVALID_HANDLE = 0xFFFFFFFF;
+
+		/*! @brief XbhōXV, 1^XN̍ŏm[h*/
+		static constexpr gu::uint32 MIN_NODES_PER_TASK = 1024;
+		#pragma endregion
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     Pʍs̃m[h쐬܂.
+		*  @param[in] const Handle ẽnh ([gƂꍇINVALID_HANDLE)
+		*  @return    Handle
+		*************************************************************************/
+		Handle Create(const Handle parent = INVALID_HANDLE);
+
+		/*!**********************************************************************
+		*  @brief     [J̈ʒu, ], g嗦w肵ăm[h쐬܂.
+		*  @param[in] const Float3& [J̈ʒu
+		*  @param[in] const Float4& [J̉] (NH[^jI x, y, z, w)
+		*  @param[in] const Float3& [J̊g嗦
+		*  @param[in] const Handle ẽnh ([gƂꍇINVALID_HANDLE)
+		*  @return    Handle
+		*************************************************************************/
+		Handle Create(const Float3& position, const Float4& rotation, const Float3& scale, const Handle parent = INVALID_HANDLE);
+
+		/*!**********************************************************************
+		*  @brief     m[hƂ̎qSč폜܂. q̃nh̎_ŖɂȂ܂.
+		*  @param[in] const Handle 폜m[h
+		*  @return    void
+		*************************************************************************/
+		void Destroy(const Handle handle);
+
+		/*!**********************************************************************
+		*  @brief     eύX܂. g̎qeɎw肵ꍇ͏z邽ߎs܂.
+		*  @param[in] const Handle Ώۂ̃m[h
+		*  @param[in] const Handle Ve ([gƂꍇINVALID_HANDLE)
+		*  @return    bool ύXłꍇtrue
+		*************************************************************************/
+		bool SetParent(const Handle handle, const Handle parent);
+
+		/*!**********************************************************************
+		*  @brief     [J̈ʒuݒ肵܂.
+		*  @param[in] const Handle Ώۂ̃m[h
+		*  @param[in] const Float3& [J̈ʒu
+		*  @return    void
+		*************************************************************************/
+		void SetLocalPosition(const Handle handle, const Float3& position);
+
+		/*!**********************************************************************
+		*  @brief     [J̉]ݒ肵܂.
+		*  @param[in] const Handle Ώۂ̃m[h
+		*  @param[in] const Float4& [J̉] (Kς݂̃NH[^jI x, y, z, w)
+		*  @return    void
+		*************************************************************************/
+		void SetLocalRotation(const Handle handle, const Float4& rotation);
+
+		/*!**********************************************************************
+		*  @brief     [J̊g嗦ݒ肵܂.
+		*  @param[in] const Handle Ώۂ̃m[h
+		*  @param[in] const Float3& [J̊g嗦
+		*  @return    void
+		*************************************************************************/
+		void SetLocalScale(const Handle handle, const Float3& scale);
+
+		/*!**********************************************************************
+		*  @brief     [J̈ʒu, ], g嗦܂Ƃ߂Đݒ肵܂.
+		*  @param[in] const Handle Ώۂ̃m[h
+		*  @param[in] const Float3& [J̈ʒu
+		*  @param[in] const Float4& [J̉] (Kς݂̃NH[^jI x, y, z, w)
+		*  @param[in] const Float3& [J̊g嗦
+		*  @return    void
+		*************************************************************************/
+		void SetLocal(const Handle handle, const Float3& position, const Float4& rotation, const Float3& scale);
+
+		/*!**********************************************************************
+		*  @brief     ύX̂m[hƂ̎q̃[Js, [hsČvZ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Update();
+
+		/*!**********************************************************************
+		*  @brief     UpdateXbhōs܂. @n
+		*             傫ȕ؂͍̃m[hɍXV, q̕؂ʃ^XNɕ܂.
+		*  @param[in] gu::ThreadPool& sXbhv[
+		*  @return    void
+		*************************************************************************/
+		void Update(gu::ThreadPool& threadPool);
+
+		/*!**********************************************************************
+		*  @brief     ̈OɊmۂ܂.
+		*  @param[in] const gu::uint64 m[h
+		*  @return    void
+		*************************************************************************/
+		void Reserve(const gu::uint64 capacity);
+
+		/*!**********************************************************************
+		*  @brief     SẴm[h폜܂. sς݂̃nh͑SĖɂȂ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     LȃnhԂ܂.
+		*************************************************************************/
+		__forceinline bool IsValid(const Handle handle) const
+		{
+			return handle < _denseIndices.Size() && _denseIndices[handle] != details::transform::INVALID_INDEX;
+		}
+
+		/*!**********************************************************************
+		*  @brief     ẽnhԂ܂. [g̏ꍇINVALID_HANDLEł.
+		*************************************************************************/
+		Handle GetParent(const Handle handle) const;
+
+		/*!**********************************************************************
+		*  @brief     [J̈ʒu, ], g嗦Ԃ܂.
+		*************************************************************************/
+		__forceinline const Float3& GetLocalPosition(const Handle handle) const { return _positions[GetDenseIndex(handle)]; }
+		__forceinline const Float4& GetLocalRotation(const Handle handle) const { return _rotations[GetDenseIndex(handle)]; }
+		__forceinline const Float3& GetLocalScale   (const Handle handle) const { return _scales   [GetDenseIndex(handle)]; }
+
+		/*!**********************************************************************
+		*  @brief     OUpdateŌvZ[Js, [hsԂ܂.
+		*************************************************************************/
+		__forceinline const Float4x4& GetLocalMatrix(const Handle handle) const { return _localMatrices[GetDenseIndex(handle)]; }
+		__forceinline const Float4x4& GetWorldMatrix(const Handle handle) const { return _worldMatrices[GetDenseIndex(handle)]; }
+
+		/*!**********************************************************************
+		*  @brief     OUpdateŃ[hs񂪍XVꂽԂ܂. (GPUւ̓]ύXɍiꍇȂǂɎgp܂)
+		*************************************************************************/
+		__forceinline bool IsWorldChanged(const Handle handle) const { return (_flags[GetDenseIndex(handle)] & details::transform::FLAG_WORLD_CHANGED) != 0; }
+
+		/*!**********************************************************************
+		*  @brief     nhz̃CfbNXԂ܂. בւNƕς邽, UpdateɎ擾Ă.
+		*************************************************************************/
+		__forceinline gu::uint32 GetDenseIndex(const Handle handle) const
+		{
+			Check(IsValid(handle));
+			return _denseIndices[handle];
+		}
+
+		/*!**********************************************************************
+		*  @brief     z̕яł̃[hs̐擪Ԃ܂. (Size()ł܂)
+		*************************************************************************/
+		__forceinline const Float4x4* GetWorldMatrices() const { return _worldMatrices.Data(); }
+
+		/*!**********************************************************************
+		*  @brief     z̕яł̃nh̐擪Ԃ܂. (Size()ł܂)
+		*************************************************************************/
+		__forceinline const Handle* GetHandles() const { return _handles.Data(); }
+
+		/*!**********************************************************************
+		*  @brief     z̃m[hԂ܂. (UpdateO͍폜҂̃m[h܂݂܂)
+		*************************************************************************/
+		__forceinline gu::uint64 Size() const { return _handles.Size(); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		TransformHierarchy() = default;
+
+		~TransformHierarchy() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*!**********************************************************************
+		*  @brief     eqOɗ悤ɕבւ, 폜҂̃m[h菜܂.
+		*************************************************************************/
+		void RebuildOrder();
+
+		/*!**********************************************************************
+		*  @brief     XbhōXV邽߂̕쐬܂.
+		*************************************************************************/
+		void BuildParallelPartition(const gu::uint32 taskCount);
+
+		/*!**********************************************************************
+		*  @brief     m[hz̖ɒǉ܂.
+		*************************************************************************/
+		Handle Append(const Float3& position, const Float4& rotation, const Float3& scale, const gu::uint32 parentIndex);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief z̕яŕێm[h̏*/
+		gu::DynamicArray<Handle>     _handles       = {};
+		gu::DynamicArray<gu::uint32> _parentIndices = {}; // e̔z̃CfbNX ([gdetails::transform::INVALID_INDEX)
+		gu::DynamicArray<gu::uint32> _subtreeEnds   = {}; // ؂̏I[ (g܂ގq [index, _subtreeEnds[index]) ɕт܂)
+		gu::DynamicArray<gu::uint8>  _flags         = {};
+		gu::DynamicArray<Float3>     _positions     = {};
+		gu::DynamicArray<Float4>     _rotations     = {};
+		gu::DynamicArray<Float3>     _scales        = {};
+		gu::DynamicArray<Float4x4>   _localMatrices = {};
+		gu::DynamicArray<Float4x4>   _worldMatrices = {};
+
+		/*! @brief nhz̃CfbNXւ̑Ή\, ėp҂̃nh*/
+		gu::DynamicArray<gu::uint32> _denseIndices = {};
+		gu::DynamicArray<Handle>     _freeHandles  = {};
+
+		/*! @brief XbhōXVۂ, ɒPƂōXVm[h, ɍXV͈ (begin, end̑g)*/
+		gu::DynamicArray<gu::uint32> _parallelSerialNodes = {};
+		gu::DynamicArray<gu::uint32> _parallelRanges      = {};
+		gu::uint32 _parallelTaskCount = 0;
+
+		/*! @brief בւKv (ǉe̕ύXŐeq̏Ԃꂽꍇ)*/
+		bool _isOrderDirty = false;
+
+		/*! @brief 폜҂̃m[h݂邩*/
+		bool _hasRemoved = false;
+		#pragma endregion
+	};
+}
+#endif
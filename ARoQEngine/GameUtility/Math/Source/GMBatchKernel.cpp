@@ -0,0 +1,340 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMBatchKernel.cpp
+///  @brief  ʂ̗vf܂Ƃ߂ďob`֐Qł.
+///  @author toide
+///  @date   2026/10/19 23:58:20
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GMBatchKernel.hpp"
+#include "../Include/GMCPUFeature.hpp"
+#include "../Private/Simd/Include/GMSimdMacros.hpp"
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace gu;
+
+namespace
+{
+	using TransformFunction    = void(*)(const Float4x4&, const Float3*, Float3*, const uint64);
+	using ConvertColorFunction = void(*)(const Float4*, uint32*, const uint64);
+	using ExpandQuadFunction   = void(*)(const QuadRect*, Vertex*, const uint64);
+
+	static_assert(sizeof(Vertex) == sizeof(float) * 12, "ExpandQuads writes Vertex as 12 contiguous floats.");
+
+	/*---------------------------------------------------------------
+			Scalar
+	-----------------------------------------------------------------*/
+	template<bool IsPoint>
+	void TransformScalar(const Float4x4& matrix, const Float3* input, Float3* output, const uint64 count)
+	{
+		const auto& m = matrix.u.m;
+		for (uint64 i = 0; i < count; ++i)
+		{
+			const float x = input[i].x, y = input[i].y, z = input[i].z;
+			output[i].x = x * m[0][0] + y * m[1][0] + z * m[2][0] + (IsPoint ? m[3][0] : 0.0f);
+			output[i].y = x * m[0][1] + y * m[1][1] + z * m[2][1] + (IsPoint ? m[3][1] : 0.0f);
+			output[i].z = x * m[0][2] + y * m[1][2] + z * m[2][2] + (IsPoint ? m[3][2] : 0.0f);
+		}
+	}
+
+	__forceinline uint32 ConvertColorChannel(const float value)
+	{
+		// NaN0ƂĈ܂ (SIMDł̖OaƓʂɂȂ悤ɂĂ܂)
+		const float clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+
+		// 2^23𑫂ĈƂ, cvtps_epi32Ɠۂ߂֐Ăяoōs܂
+		constexpr float ROUNDING_BIAS = 8388608.0f;
+		return static_cast<uint32>((clamped * 255.0f + ROUNDING_BIAS) - ROUNDING_BIAS);
+	}
+
+	void ConvertColorScalar(const Float4* input, uint32* output, const uint64 count)
+	{
+		for (uint64 i = 0; i < count; ++i)
+		{
+			output[i] = ConvertColorChannel(input[i].x)
+				| (ConvertColorChannel(input[i].y) << 8)
+				| (ConvertColorChannel(input[i].z) << 16)
+				| (ConvertColorChannel(input[i].w) << 24);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			_i (, , E, E) ̈ʒu
+			x + SIGN_A[i] * w * cos + SIGN_B[i] * h * sin, 
+			y - SIGN_A[i] * w * sin + SIGN_B[i] * h * cos ł. (Image::CreateRectƓ)
+	-----------------------------------------------------------------*/
+	constexpr float QUAD_SIGN_A[] = { -1.0f, -1.0f, 1.0f,  1.0f };
+	constexpr float QUAD_SIGN_B[] = { -1.0f,  1.0f, 1.0f, -1.0f };
+
+	void ExpandQuadsScalar(const QuadRect* input, Vertex* output, const uint64 count)
+	{
+		for (uint64 i = 0; i < count; ++i)
+		{
+			const auto& quad = input[i];
+			const float a = quad.Rect.z * quad.Cos, b = quad.Rect.w * quad.Sin;
+			const float c = quad.Rect.z * quad.Sin, d = quad.Rect.w * quad.Cos;
+
+			const Float2 uvs[] = { Float2(quad.UV.x, quad.UV.w), Float2(quad.UV.x, quad.UV.z), Float2(quad.UV.y, quad.UV.z), Float2(quad.UV.y, quad.UV.w) };
+
+			for (uint64 j = 0; j < 4; ++j)
+			{
+				auto& vertex = output[i * 4 + j];
+				vertex.Position = Float3(quad.Rect.x + QUAD_SIGN_A[j] * a + QUAD_SIGN_B[j] * b, quad.Rect.y - QUAD_SIGN_A[j] * c + QUAD_SIGN_B[j] * d, quad.Z);
+				vertex.Normal   = Float3(0.0f, 0.0f, 1.0f);
+				vertex.Color    = quad.Color;
+				vertex.UV       = uvs[j];
+			}
+		}
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	/*---------------------------------------------------------------
+			SSE2 : 1vfs̍s4vf܂Ƃ߂ČvZ܂
+	-----------------------------------------------------------------*/
+	template<bool IsPoint>
+	void TransformSSE2(const Float4x4& matrix, const Float3* input, Float3* output, const uint64 count)
+	{
+		const __m128 row0 = _mm_loadu_ps(matrix.u.m[0]);
+		const __m128 row1 = _mm_loadu_ps(matrix.u.m[1]);
+		const __m128 row2 = _mm_loadu_ps(matrix.u.m[2]);
+		const __m128 row3 = IsPoint ? _mm_loadu_ps(matrix.u.m[3]) : _mm_setzero_ps();
+
+		for (uint64 i = 0; i < count; ++i)
+		{
+			__m128 result = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(input[i].x), row0), _mm_mul_ps(_mm_set1_ps(input[i].y), row1));
+			result = _mm_add_ps(result, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(input[i].z), row2), row3));
+
+			_mm_storel_pi(reinterpret_cast<__m64*>(&output[i].x), result);
+			_mm_store_ss(&output[i].z, _mm_movehl_ps(result, result));
+		}
+	}
+
+	/*---------------------------------------------------------------
+			SSE2 : 4Fϊ܂.
+			packs_epi32ŕt16bit, packus_epi160`255ɖOa邽߃Nv͕svł.
+	-----------------------------------------------------------------*/
+	void ConvertColorSSE2(const Float4* input, uint32* output, const uint64 count)
+	{
+		const __m128 scale = _mm_set1_ps(255.0f);
+
+		uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i c0 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&input[i + 0].x), scale));
+			const __m128i c1 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&input[i + 1].x), scale));
+			const __m128i c2 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&input[i + 2].x), scale));
+			const __m128i c3 = _mm_cvtps_epi32(_mm_mul_ps(_mm_loadu_ps(&input[i + 3].x), scale));
+
+			const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(c0, c1), _mm_packs_epi32(c2, c3));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), packed);
+		}
+
+		ConvertColorScalar(input + i, output + i, count - i);
+	}
+
+	/*---------------------------------------------------------------
+			SSE2 : 1`4_x, y1WX^ŌvZ, 
+			]uĒ_Ƃ (x, y, z, nx), (ny, nz, r, g), (b, a, u, v) 3WX^݂܂.
+	-----------------------------------------------------------------*/
+	void ExpandQuadsSSE2(const QuadRect* input, Vertex* output, const uint64 count)
+	{
+		const __m128 signA  = _mm_loadu_ps(QUAD_SIGN_A);
+		const __m128 signB  = _mm_loadu_ps(QUAD_SIGN_B);
+		const __m128 normal = _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f); // (ny, nz) ͉2vf
+
+		for (uint64 i = 0; i < count; ++i)
+		{
+			const auto& quad = input[i];
+			const __m128 rect  = _mm_loadu_ps(&quad.Rect.x);
+			const __m128 uv    = _mm_loadu_ps(&quad.UV.x);
+			const __m128 color = _mm_loadu_ps(&quad.Color.x);
+
+			const __m128 halfWidth  = _mm_shuffle_ps(rect, rect, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m128 halfHeight = _mm_shuffle_ps(rect, rect, _MM_SHUFFLE(3, 3, 3, 3));
+			const __m128 sin        = _mm_set1_ps(quad.Sin);
+			const __m128 cos        = _mm_set1_ps(quad.Cos);
+
+			__m128 x = _mm_add_ps(_mm_shuffle_ps(rect, rect, _MM_SHUFFLE(0, 0, 0, 0)),
+				_mm_add_ps(_mm_mul_ps(signA, _mm_mul_ps(halfWidth, cos)), _mm_mul_ps(signB, _mm_mul_ps(halfHeight, sin))));
+			__m128 y = _mm_add_ps(_mm_shuffle_ps(rect, rect, _MM_SHUFFLE(1, 1, 1, 1)),
+				_mm_sub_ps(_mm_mul_ps(signB, _mm_mul_ps(halfHeight, cos)), _mm_mul_ps(signA, _mm_mul_ps(halfWidth, sin))));
+			__m128 z  = _mm_set1_ps(quad.Z);
+			__m128 nx = _mm_setzero_ps();
+			_MM_TRANSPOSE4_PS(x, y, z, nx); // x, y, z, nx : _0`3(x, y, z, nx)
+
+			// (u0, u1, v0, v1) -> u : (u0, u0, u1, u1), v : (v1, v0, v0, v1)
+			__m128 b = _mm_shuffle_ps(color, color, _MM_SHUFFLE(2, 2, 2, 2));
+			__m128 a = _mm_shuffle_ps(color, color, _MM_SHUFFLE(3, 3, 3, 3));
+			__m128 u = _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(1, 1, 0, 0));
+			__m128 v = _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(3, 2, 2, 3));
+			_MM_TRANSPOSE4_PS(b, a, u, v); // b, a, u, v : _0`3(b, a, u, v)
+
+			const __m128 normalAndColor = _mm_movelh_ps(normal, color); // (ny, nz, r, g)
+
+			float* destination = &output[i * 4].Position.x;
+			_mm_storeu_ps(destination +  0, x); _mm_storeu_ps(destination +  4, normalAndColor); _mm_storeu_ps(destination +  8, b);
+			_mm_storeu_ps(destination + 12, y); _mm_storeu_ps(destination + 16, normalAndColor); _mm_storeu_ps(destination + 20, a);
+			_mm_storeu_ps(destination + 24, z); _mm_storeu_ps(destination + 28, normalAndColor); _mm_storeu_ps(destination + 32, u);
+			_mm_storeu_ps(destination + 36, nx); _mm_storeu_ps(destination + 40, normalAndColor); _mm_storeu_ps(destination + 44, v);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			AVX2 : 2vf1̃WX^ɂ܂Ƃ߂FMAŌvZ܂.
+	-----------------------------------------------------------------*/
+	template<bool IsPoint>
+	SIMD_TARGET_AVX2 void TransformAVX2(const Float4x4& matrix, const Float3* input, Float3* output, const uint64 count)
+	{
+		const __m256 row0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.u.m[0]));
+		const __m256 row1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.u.m[1]));
+		const __m256 row2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.u.m[2]));
+		const __m256 row3 = IsPoint ? _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix.u.m[3])) : _mm256_setzero_ps();
+
+		const __m256i xIndex     = _mm256_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3);
+		const __m256i yIndex     = _mm256_setr_epi32(1, 1, 1, 1, 4, 4, 4, 4);
+		const __m256i zIndex     = _mm256_setr_epi32(2, 2, 2, 2, 5, 5, 5, 5);
+		const __m256i storeIndex = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+		const __m256i storeMask  = _mm256_setr_epi32(-1, -1, -1, -1, -1, -1, 0, 0);
+
+		// 8 float (2vf + ̗vf2 float) ǂݍނ, 3vfȏcĂԂ܂.
+		uint64 i = 0;
+		for (; i + 3 <= count; i += 2)
+		{
+			const __m256 source = _mm256_loadu_ps(&input[i].x);
+			const __m256 x      = _mm256_permutevar8x32_ps(source, xIndex);
+			const __m256 y      = _mm256_permutevar8x32_ps(source, yIndex);
+			const __m256 z      = _mm256_permutevar8x32_ps(source, zIndex);
+
+			const __m256 result = _mm256_fmadd_ps(x, row0, _mm256_fmadd_ps(y, row1, _mm256_fmadd_ps(z, row2, row3)));
+			_mm256_maskstore_ps(&output[i].x, storeMask, _mm256_permutevar8x32_ps(result, storeIndex));
+		}
+		_mm256_zeroupper();
+
+		TransformSSE2<IsPoint>(matrix, input + i, output + i, count - i);
+	}
+
+	/*---------------------------------------------------------------
+			AVX2 : 8Fϊ܂.
+			256bitpack̓[Ƃɍs邽, Ōɕя߂܂.
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void ConvertColorAVX2(const Float4* input, uint32* output, const uint64 count)
+	{
+		const __m256  scale = _mm256_set1_ps(255.0f);
+		const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+		uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256i c01 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&input[i + 0].x), scale));
+			const __m256i c23 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&input[i + 2].x), scale));
+			const __m256i c45 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&input[i + 4].x), scale));
+			const __m256i c67 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(&input[i + 6].x), scale));
+
+			// lane0 : c0, c2, c4, c6 / lane1 : c1, c3, c5, c7
+			const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(c01, c23), _mm256_packs_epi32(c45, c67));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), _mm256_permutevar8x32_epi32(packed, order));
+		}
+		_mm256_zeroupper();
+
+		ConvertColorSSE2(input + i, output + i, count - i);
+	}
+
+	/*---------------------------------------------------------------
+			SimdInstructionSet̏ɕׂ֐e[u
+			SSE4.1ŗL̖߂őȂӏ͖, SSE4.1SSE2Ƌʂł.
+			ExpandQuads128bit݂̏̂, AVX2SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr TransformFunction    TRANSFORM_POINT_FUNCTIONS [] = { TransformScalar<true> , TransformSSE2<true> , TransformSSE2<true> , TransformAVX2<true>  };
+	constexpr TransformFunction    TRANSFORM_VECTOR_FUNCTIONS[] = { TransformScalar<false>, TransformSSE2<false>, TransformSSE2<false>, TransformAVX2<false> };
+	constexpr ConvertColorFunction CONVERT_COLOR_FUNCTIONS   [] = { ConvertColorScalar    , ConvertColorSSE2    , ConvertColorSSE2    , ConvertColorAVX2     };
+	constexpr ExpandQuadFunction   EXPAND_QUAD_FUNCTIONS     [] = { ExpandQuadsScalar     , ExpandQuadsSSE2     , ExpandQuadsSSE2     , ExpandQuadsSSE2      };
+#else
+	constexpr TransformFunction    TRANSFORM_POINT_FUNCTIONS [] = { TransformScalar<true> , TransformScalar<true> , TransformScalar<true> , TransformScalar<true>  };
+	constexpr TransformFunction    TRANSFORM_VECTOR_FUNCTIONS[] = { TransformScalar<false>, TransformScalar<false>, TransformScalar<false>, TransformScalar<false> };
+	constexpr ConvertColorFunction CONVERT_COLOR_FUNCTIONS   [] = { ConvertColorScalar    , ConvertColorScalar    , ConvertColorScalar    , ConvertColorScalar     };
+	constexpr ExpandQuadFunction   EXPAND_QUAD_FUNCTIONS     [] = { ExpandQuadsScalar     , ExpandQuadsScalar     , ExpandQuadsScalar     , ExpandQuadsScalar      };
+#endif
+
+	static_assert(sizeof(TRANSFORM_POINT_FUNCTIONS) / sizeof(TRANSFORM_POINT_FUNCTIONS[0]) == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(CONVERT_COLOR_FUNCTIONS)   / sizeof(CONVERT_COLOR_FUNCTIONS[0])   == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(EXPAND_QUAD_FUNCTIONS)     / sizeof(EXPAND_QUAD_FUNCTIONS[0])     == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     W (x, y, z, 1) * matrix ŕϊ܂.
+*  @param[in]  const Float4x4& ϊs
+*  @param[in]  const Float3* ͍W
+*  @param[out] Float3* o͍W
+*  @param[in]  const gu::uint64 vf
+*  @return     void
+*************************************************************************/
+void BatchKernel::TransformPoints(const Float4x4& matrix, const Float3* input, Float3* output, const gu::uint64 count)
+{
+	if (count == 0) { return; }
+	Check(input);
+	Check(output);
+
+	TRANSFORM_POINT_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](matrix, input, output, count);
+}
+
+/*!**********************************************************************
+*  @brief     xNg (x, y, z, 0) * matrix ŕϊ܂.
+*  @param[in]  const Float4x4& ϊs
+*  @param[in]  const Float3* ̓xNg
+*  @param[out] Float3* o̓xNg
+*  @param[in]  const gu::uint64 vf
+*  @return     void
+*************************************************************************/
+void BatchKernel::TransformVectors(const Float4x4& matrix, const Float3* input, Float3* output, const gu::uint64 count)
+{
+	if (count == 0) { return; }
+	Check(input);
+	Check(output);
+
+	TRANSFORM_VECTOR_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](matrix, input, output, count);
+}
+
+/*!**********************************************************************
+*  @brief     0`1RGBA R8G8B8A8_UNORM (RʃoCg) ɕϊ܂.
+*  @param[in]  const Float4* ͐F
+*  @param[out] gu::uint32* o͐F
+*  @param[in]  const gu::uint64 vf
+*  @return     void
+*************************************************************************/
+void BatchKernel::ConvertColorToRGBA8(const Float4* input, gu::uint32* output, const gu::uint64 count)
+{
+	if (count == 0) { return; }
+	Check(input);
+	Check(output);
+
+	CONVERT_COLOR_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](input, output, count);
+}
+
+/*!**********************************************************************
+*  @brief     `]4_ (, , E, Ȅ) ɓWJ܂. @(0, 0, 1)ł.
+*  @param[in]  const QuadRect* ͋`
+*  @param[out] Vertex* o͒_ (` * 4)
+*  @param[in]  const gu::uint64 `
+*  @return     void
+*************************************************************************/
+void BatchKernel::ExpandQuads(const QuadRect* input, Vertex* output, const gu::uint64 count)
+{
+	if (count == 0) { return; }
+	Check(input);
+	Check(output);
+
+	EXPAND_QUAD_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](input, output, count);
+}
+#pragma endregion Public Function
@@ -0,0 +1,276 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMCPUFeature.cpp
+///  @brief  sCPUIDpĎgp\SIMD߃Zbg𔻒肵, ob`̊֐؂ւ邽߂̃NXł.
+///  @author toide
+///  @date   2026/10/19 23:32:05
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GMCPUFeature.hpp"
+#include "../Private/Simd/Include/GMSimdMacros.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <cctype>
+#if PLATFORM_CPU_X86_FAMILY
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace gu;
+
+namespace
+{
+#if PLATFORM_CPU_X86_FAMILY
+	/*---------------------------------------------------------------
+			CPUID (EAX, EBX, ECX, EDX̏Ɋi[܂)
+	-----------------------------------------------------------------*/
+	void ExecuteCPUID(int32 (&registers)[4], const int32 leaf, const int32 subLeaf)
+	{
+	#if defined(_MSC_VER)
+		__cpuidex(registers, leaf, subLeaf);
+	#else
+		uint32 a = 0, b = 0, c = 0, d = 0;
+		__cpuid_count(static_cast<uint32>(leaf), static_cast<uint32>(subLeaf), a, b, c, d);
+		registers[0] = static_cast<int32>(a); registers[1] = static_cast<int32>(b);
+		registers[2] = static_cast<int32>(c); registers[3] = static_cast<int32>(d);
+	#endif
+	}
+
+	/*---------------------------------------------------------------
+			OSޔ郌WX^̏ (XCR0) 擾܂
+	-----------------------------------------------------------------*/
+	uint64 ReadExtendedControlRegister()
+	{
+	#if defined(_MSC_VER)
+		return _xgetbv(0);
+	#else
+		uint32 low = 0, high = 0;
+		__asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+		return (static_cast<uint64>(high) << 32) | low;
+	#endif
+	}
+#endif
+
+	/*---------------------------------------------------------------
+			CPUIDΉĂ閽߂𔻒肵܂
+	-----------------------------------------------------------------*/
+	CPUFeatureFlags DetectFlags()
+	{
+		CPUFeatureFlags flags = {};
+
+	#if PLATFORM_CPU_X86_FAMILY
+		int32 registers[4] = {};
+		ExecuteCPUID(registers, 0, 0);
+		const int32 maxLeaf = registers[0];
+		if (maxLeaf < 1) { return flags; }
+
+		ExecuteCPUID(registers, 1, 0);
+		const uint32 ecx = static_cast<uint32>(registers[2]);
+		const uint32 edx = static_cast<uint32>(registers[3]);
+
+		flags.SSE2   = (edx & (1u << 26)) != 0;
+		flags.SSE3   = (ecx & (1u << 0))  != 0;
+		flags.SSSE3  = (ecx & (1u << 9))  != 0;
+		flags.SSE4_1 = (ecx & (1u << 19)) != 0;
+		flags.SSE4_2 = (ecx & (1u << 20)) != 0;
+
+		// AVXnCPUΉĂĂ, OSYMMWX^ޔȂꍇ͎gpł܂.
+		const bool osXSave   = (ecx & (1u << 27)) != 0;
+		const uint64 xcr0    = osXSave ? ReadExtendedControlRegister() : 0;
+		const bool osYmmSave = (xcr0 & 0x06) == 0x06;
+		const bool osZmmSave = (xcr0 & 0xE6) == 0xE6;
+
+		flags.AVX  = osYmmSave && (ecx & (1u << 28)) != 0;
+		flags.FMA3 = flags.AVX && (ecx & (1u << 12)) != 0;
+		flags.F16C = flags.AVX && (ecx & (1u << 29)) != 0;
+
+		if (maxLeaf >= 7)
+		{
+			ExecuteCPUID(registers, 7, 0);
+			const uint32 ebx = static_cast<uint32>(registers[1]);
+			flags.AVX2    = flags.AVX && (ebx & (1u << 5))  != 0;
+			flags.AVX512F = osZmmSave && (ebx & (1u << 16)) != 0;
+		}
+	#endif
+
+		return flags;
+	}
+
+	/*---------------------------------------------------------------
+			Ή߂gp\ȍő̖߃Zbg߂܂
+	-----------------------------------------------------------------*/
+	SimdInstructionSet SelectHighest(const CPUFeatureFlags& flags)
+	{
+		if (flags.AVX2 && flags.FMA3) { return SimdInstructionSet::AVX2; }
+		if (flags.SSE4_1)             { return SimdInstructionSet::SSE4_1; }
+		if (flags.SSE2)               { return SimdInstructionSet::SSE2; }
+		return SimdInstructionSet::Scalar;
+	}
+
+	/*---------------------------------------------------------------
+			ϐ疽߃Zbgǂݍ݂܂. ݒsȒl̏ꍇfalse
+	-----------------------------------------------------------------*/
+	bool ReadEnvironmentOverride(SimdInstructionSet& instructionSet)
+	{
+		char value[16] = {};
+
+	#if defined(_MSC_VER)
+		size_t length = 0;
+		if (getenv_s(&length, value, sizeof(value), CPUFeature::ENVIRONMENT_VARIABLE_NAME) != 0 || length == 0) { return false; }
+	#else
+		const char* source = std::getenv(CPUFeature::ENVIRONMENT_VARIABLE_NAME);
+		if (source == nullptr) { return false; }
+		for (size_t i = 0; i < sizeof(value) - 1 && source[i] != '\0'; ++i) { value[i] = source[i]; }
+	#endif
+
+		// 啶 '.' , '_' ̗L͋ʂ܂ (sse4.1, SSE4_1, sse41 ͓)
+		char normalized[16] = {};
+		size_t count = 0;
+		for (size_t i = 0; value[i] != '\0' && count < sizeof(normalized) - 1; ++i)
+		{
+			if (value[i] == '.' || value[i] == '_') { continue; }
+			normalized[count++] = static_cast<char>(std::tolower(static_cast<unsigned char>(value[i])));
+		}
+
+		const auto equals = [&](const char* name)
+		{
+			size_t i = 0;
+			for (; name[i] != '\0' && normalized[i] != '\0'; ++i)
+			{
+				if (name[i] != normalized[i]) { return false; }
+			}
+			return name[i] == normalized[i];
+		};
+
+		if      (equals("scalar")) { instructionSet = SimdInstructionSet::Scalar; }
+		else if (equals("sse2"))   { instructionSet = SimdInstructionSet::SSE2;   }
+		else if (equals("sse41"))  { instructionSet = SimdInstructionSet::SSE4_1; }
+		else if (equals("avx2"))   { instructionSet = SimdInstructionSet::AVX2;   }
+		else { return false; }
+
+		return true;
+	}
+
+	/*---------------------------------------------------------------
+			茋 (ANZXɈx쐬܂)
+	-----------------------------------------------------------------*/
+	struct CPUFeatureState
+	{
+		CPUFeatureFlags                 Flags   = {};
+		SimdInstructionSet              Highest = SimdInstructionSet::Scalar;
+		std::atomic<SimdInstructionSet> Active  = SimdInstructionSet::Scalar;
+
+		CPUFeatureState()
+		{
+			Flags   = DetectFlags();
+			Highest = SelectHighest(Flags);
+
+			auto active = Highest;
+			if (ReadEnvironmentOverride(active) && active > Highest)
+			{
+				active = Highest;
+			}
+			Active.store(active);
+		}
+	};
+
+	CPUFeatureState& GetState()
+	{
+		static CPUFeatureState state;
+		return state;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     CPU̔s܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void CPUFeature::Initialize()
+{
+	GetState();
+}
+
+/*!**********************************************************************
+*  @brief     sCPUΉĂ閽߂̈ꗗԂ܂.
+*  @param[in] void
+*  @return    const CPUFeatureFlags&
+*************************************************************************/
+const CPUFeatureFlags& CPUFeature::GetFlags()
+{
+	return GetState().Flags;
+}
+
+/*!**********************************************************************
+*  @brief     sCPUŎgp\ȍłȖ߃ZbgԂ܂.
+*  @param[in] void
+*  @return    SimdInstructionSet
+*************************************************************************/
+SimdInstructionSet CPUFeature::GetHighestSupported()
+{
+	return GetState().Highest;
+}
+
+/*!**********************************************************************
+*  @brief     ob`ŌݎgpĂ閽߃ZbgԂ܂.
+*  @param[in] void
+*  @return    SimdInstructionSet
+*************************************************************************/
+SimdInstructionSet CPUFeature::GetActive()
+{
+	return GetState().Active.load(std::memory_order_relaxed);
+}
+
+/*!**********************************************************************
+*  @brief     ob`Ŏgp閽߃ZbgύX܂.
+*  @param[in] const SimdInstructionSet gp߃Zbg
+*  @return    bool w肵߃Zbĝ܂܎gpłꍇtrue
+*************************************************************************/
+bool CPUFeature::SetActive(const SimdInstructionSet instructionSet)
+{
+	auto& state = GetState();
+	const bool isSupported = instructionSet <= state.Highest;
+	state.Active.store(isSupported ? instructionSet : state.Highest);
+	return isSupported;
+}
+
+/*!**********************************************************************
+*  @brief     w肵߃ZbgsCPUŎgpł邩Ԃ܂.
+*  @param[in] const SimdInstructionSet ߃Zbg
+*  @return    bool
+*************************************************************************/
+bool CPUFeature::IsSupported(const SimdInstructionSet instructionSet)
+{
+	return instructionSet <= GetState().Highest;
+}
+
+/*!**********************************************************************
+*  @brief     ߃Zbg̖OԂ܂.
+*  @param[in] const SimdInstructionSet ߃Zbg
+*  @return    const char*
+*************************************************************************/
+const char* CPUFeature::ToString(const SimdInstructionSet instructionSet)
+{
+	switch (instructionSet)
+	{
+		case SimdInstructionSet::Scalar: return "scalar";
+		case SimdInstructionSet::SSE2  : return "sse2";
+		case SimdInstructionSet::SSE4_1: return "sse4.1";
+		case SimdInstructionSet::AVX2  : return "avx2";
+		default: return "unknown";
+	}
+}
+#pragma endregion Public Function
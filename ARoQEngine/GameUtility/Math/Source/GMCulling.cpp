@@ -0,0 +1,481 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMCulling.cpp
+///  @brief  JOsNXł.
+///  @author toide
+///  @date   2026/10/19 22:10:41
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GMCulling.hpp"
+#include "../Include/GMCPUFeature.hpp"
+#include "../Private/Simd/Include/GMSimdMacros.hpp"
+#include <cmath>
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			ʂ̖@𐳋K܂
+	-----------------------------------------------------------------*/
+	Float4 NormalizePlane(const float a, const float b, const float c, const float d)
+	{
+		const float length = std::sqrt(a * a + b * b + c * c);
+		const float inverse = length > 0.0f ? 1.0f / length : 0.0f;
+		return Float4(a * inverse, b * inverse, c * inverse, d * inverse);
+	}
+
+	/*---------------------------------------------------------------
+			̃rbg}XN, ̃CfbNX݂̂Ol߂ŏo܂.
+			邽, s̏ꍇ݂͍s, JEgi߂܂.
+	-----------------------------------------------------------------*/
+	__forceinline uint64 CompactVisibleIndices(const uint32 visibleMask, const uint32 laneCount, const uint32 baseIndex, uint32* out, uint64 count)
+	{
+		for (uint32 lane = 0; lane < laneCount; ++lane)
+		{
+			out[count] = baseIndex + lane;
+			count     += (visibleMask >> lane) & 1u;
+		}
+		return count;
+	}
+
+	/*---------------------------------------------------------------
+			1vfƂ̔
+			E̗vfSIMDłƌʂv悤, SĂ̎
+			distance = ((x * px + y * py) + z * pz) + pw, radius = (ex * |px| + ey * |py|) + ez * |pz|
+			̏1ZvZ܂.
+	-----------------------------------------------------------------*/
+	__forceinline float PlaneDistance(const Float4& p, const float x, const float y, const float z)
+	{
+		float distance = p.x * x;
+		distance = distance + p.y * y;
+		distance = distance + p.z * z;
+		distance = distance + p.w;
+		return distance;
+	}
+
+	__forceinline bool IsSphereVisible(const FrustumPlanes& frustum, const float x, const float y, const float z, const float radius)
+	{
+		bool isVisible = true;
+		for (uint32 i = 0; i < FrustumPlanes::PLANE_COUNT; ++i)
+		{
+			isVisible &= PlaneDistance(frustum.Planes[i], x, y, z) >= -radius;
+		}
+		return isVisible;
+	}
+
+	__forceinline bool IsBoxVisible(const FrustumPlanes& frustum, const float x, const float y, const float z, const float ex, const float ey, const float ez)
+	{
+		bool isVisible = true;
+		for (uint32 i = 0; i < FrustumPlanes::PLANE_COUNT; ++i)
+		{
+			const Float4& p = frustum.Planes[i];
+			const float distance = PlaneDistance(p, x, y, z);
+
+			float radius = std::fabs(p.x) * ex;
+			radius = radius + std::fabs(p.y) * ey;
+			radius = radius + std::fabs(p.z) * ez;
+			isVisible &= (distance + radius) >= 0.0f;
+		}
+		return isVisible;
+	}
+}
+
+#pragma region FrustumPlanes
+/*!**********************************************************************
+*  @brief     View * Projections񂩂王6ʂo܂. (DirectX̃Nbv z : 0`1z肵Ă܂)
+*  @param[in] const Float4x4& r[vWFNVs (sxNg`)
+*  @return    FrustumPlanes
+*************************************************************************/
+FrustumPlanes FrustumPlanes::FromViewProjection(const Float4x4& viewProjection)
+{
+	// sxNg`ł̓NbvW = v * M Ȃ̂, eʂ͍s̗񂩂狁܂܂.
+	const auto& m = viewProjection.u.m;
+
+	FrustumPlanes frustum = {};
+	frustum.Planes[0] = NormalizePlane(m[0][3] + m[0][0], m[1][3] + m[1][0], m[2][3] + m[2][0], m[3][3] + m[3][0]); // Left
+	frustum.Planes[1] = NormalizePlane(m[0][3] - m[0][0], m[1][3] - m[1][0], m[2][3] - m[2][0], m[3][3] - m[3][0]); // Right
+	frustum.Planes[2] = NormalizePlane(m[0][3] + m[0][1], m[1][3] + m[1][1], m[2][3] + m[2][1], m[3][3] + m[3][1]); // Bottom
+	frustum.Planes[3] = NormalizePlane(m[0][3] - m[0][1], m[1][3] - m[1][1], m[2][3] - m[2][1], m[3][3] - m[3][1]); // Top
+	frustum.Planes[4] = NormalizePlane(m[0][2]          , m[1][2]          , m[2][2]          , m[3][2]          ); // Near
+	frustum.Planes[5] = NormalizePlane(m[0][3] - m[0][2], m[1][3] - m[1][2], m[2][3] - m[2][2], m[3][3] - m[3][2]); // Far
+	return frustum;
+}
+#pragma endregion FrustumPlanes
+
+#pragma region BoundingVolumeArray
+gu::uint32 BoundingSphereArray::Push(const BoundingSphere& sphere)
+{
+	CenterX.Push(sphere.Center.x);
+	CenterY.Push(sphere.Center.y);
+	CenterZ.Push(sphere.Center.z);
+	Radius .Push(sphere.Radius);
+	return static_cast<uint32>(Radius.Size() - 1);
+}
+
+void BoundingSphereArray::Set(const gu::uint32 index, const BoundingSphere& sphere)
+{
+	Check(index < Size());
+	CenterX[index] = sphere.Center.x;
+	CenterY[index] = sphere.Center.y;
+	CenterZ[index] = sphere.Center.z;
+	Radius [index] = sphere.Radius;
+}
+
+void BoundingSphereArray::Reserve(const gu::uint64 capacity)
+{
+	CenterX.Reserve(capacity);
+	CenterY.Reserve(capacity);
+	CenterZ.Reserve(capacity);
+	Radius .Reserve(capacity);
+}
+
+void BoundingSphereArray::Clear()
+{
+	CenterX.Clear();
+	CenterY.Clear();
+	CenterZ.Clear();
+	Radius .Clear();
+}
+
+gu::uint32 BoundingBoxArray::Push(const BoundingBox& box)
+{
+	CenterX .Push(box.Center.x);
+	CenterY .Push(box.Center.y);
+	CenterZ .Push(box.Center.z);
+	ExtentsX.Push(box.Extents.x);
+	ExtentsY.Push(box.Extents.y);
+	ExtentsZ.Push(box.Extents.z);
+	return static_cast<uint32>(ExtentsX.Size() - 1);
+}
+
+void BoundingBoxArray::Set(const gu::uint32 index, const BoundingBox& box)
+{
+	Check(index < Size());
+	CenterX [index] = box.Center.x;
+	CenterY [index] = box.Center.y;
+	CenterZ [index] = box.Center.z;
+	ExtentsX[index] = box.Extents.x;
+	ExtentsY[index] = box.Extents.y;
+	ExtentsZ[index] = box.Extents.z;
+}
+
+void BoundingBoxArray::Reserve(const gu::uint64 capacity)
+{
+	CenterX .Reserve(capacity);
+	CenterY .Reserve(capacity);
+	CenterZ .Reserve(capacity);
+	ExtentsX.Reserve(capacity);
+	ExtentsY.Reserve(capacity);
+	ExtentsZ.Reserve(capacity);
+}
+
+void BoundingBoxArray::Clear()
+{
+	CenterX .Clear();
+	CenterY .Clear();
+	CenterZ .Clear();
+	ExtentsX.Clear();
+	ExtentsY.Clear();
+	ExtentsZ.Clear();
+}
+#pragma endregion BoundingVolumeArray
+
+#pragma region Culling Kernel
+namespace
+{
+	using CullSpheresFunction = void(*)(const FrustumPlanes*, const uint32, const BoundingSphereArray&, uint32* const*, uint64*);
+	using CullBoxesFunction   = void(*)(const FrustumPlanes*, const uint32, const BoundingBoxArray&   , uint32* const*, uint64*);
+
+	/*---------------------------------------------------------------
+			XJ[ł̔ (SIMD̒[ɂgp܂)
+	-----------------------------------------------------------------*/
+	void CullSpheresRemainder(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingSphereArray& spheres, uint32* const* visibleIndices, uint64* visibleCounts, const uint64 begin)
+	{
+		for (uint64 i = begin; i < spheres.Size(); ++i)
+		{
+			for (uint32 f = 0; f < frustumCount; ++f)
+			{
+				const uint32 isVisible = IsSphereVisible(frustums[f], spheres.CenterX[i], spheres.CenterY[i], spheres.CenterZ[i], spheres.Radius[i]) ? 1u : 0u;
+				visibleCounts[f] = CompactVisibleIndices(isVisible, 1, static_cast<uint32>(i), visibleIndices[f], visibleCounts[f]);
+			}
+		}
+	}
+
+	void CullBoxesRemainder(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingBoxArray& boxes, uint32* const* visibleIndices, uint64* visibleCounts, const uint64 begin)
+	{
+		for (uint64 i = begin; i < boxes.Size(); ++i)
+		{
+			for (uint32 f = 0; f < frustumCount; ++f)
+			{
+				const uint32 isVisible = IsBoxVisible(frustums[f], boxes.CenterX[i], boxes.CenterY[i], boxes.CenterZ[i], boxes.ExtentsX[i], boxes.ExtentsY[i], boxes.ExtentsZ[i]) ? 1u : 0u;
+				visibleCounts[f] = CompactVisibleIndices(isVisible, 1, static_cast<uint32>(i), visibleIndices[f], visibleCounts[f]);
+			}
+		}
+	}
+
+	void CullSpheresScalar(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingSphereArray& spheres, uint32* const* visibleIndices, uint64* visibleCounts)
+	{
+		CullSpheresRemainder(frustums, frustumCount, spheres, visibleIndices, visibleCounts, 0);
+	}
+
+	void CullBoxesScalar(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingBoxArray& boxes, uint32* const* visibleIndices, uint64* visibleCounts)
+	{
+		CullBoxesRemainder(frustums, frustumCount, boxes, visibleIndices, visibleCounts, 0);
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	/*---------------------------------------------------------------
+			SSE2 : 4 (oEfBO{[̓ǂݍ݂͑SŋL)
+	-----------------------------------------------------------------*/
+	void CullSpheresSSE2(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingSphereArray& spheres, uint32* const* visibleIndices, uint64* visibleCounts)
+	{
+		const uint64 count = spheres.Size();
+		const float* cx    = spheres.CenterX.Data();
+		const float* cy    = spheres.CenterY.Data();
+		const float* cz    = spheres.CenterZ.Data();
+		const float* r     = spheres.Radius .Data();
+
+		uint64 i = 0;
+		const __m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 x         = _mm_loadu_ps(cx + i);
+			const __m128 y         = _mm_loadu_ps(cy + i);
+			const __m128 z         = _mm_loadu_ps(cz + i);
+			const __m128 negRadius = _mm_sub_ps(zero, _mm_loadu_ps(r + i));
+
+			for (uint32 f = 0; f < frustumCount; ++f)
+			{
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (uint32 p = 0; p < FrustumPlanes::PLANE_COUNT; ++p)
+				{
+					const Float4& plane = frustums[f].Planes[p];
+					__m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), x);
+					distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+					distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+					distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+					inside   = _mm_and_ps(inside, _mm_cmpge_ps(distance, negRadius));
+				}
+				visibleCounts[f] = CompactVisibleIndices(static_cast<uint32>(_mm_movemask_ps(inside)), 4, static_cast<uint32>(i), visibleIndices[f], visibleCounts[f]);
+			}
+		}
+
+		CullSpheresRemainder(frustums, frustumCount, spheres, visibleIndices, visibleCounts, i);
+	}
+
+	void CullBoxesSSE2(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingBoxArray& boxes, uint32* const* visibleIndices, uint64* visibleCounts)
+	{
+		const uint64 count = boxes.Size();
+		const float* cx    = boxes.CenterX .Data();
+		const float* cy    = boxes.CenterY .Data();
+		const float* cz    = boxes.CenterZ .Data();
+		const float* ex    = boxes.ExtentsX.Data();
+		const float* ey    = boxes.ExtentsY.Data();
+		const float* ez    = boxes.ExtentsZ.Data();
+
+		uint64 i = 0;
+		const __m128 zero = _mm_setzero_ps();
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 x  = _mm_loadu_ps(cx + i);
+			const __m128 y  = _mm_loadu_ps(cy + i);
+			const __m128 z  = _mm_loadu_ps(cz + i);
+			const __m128 hx = _mm_loadu_ps(ex + i);
+			const __m128 hy = _mm_loadu_ps(ey + i);
+			const __m128 hz = _mm_loadu_ps(ez + i);
+
+			for (uint32 f = 0; f < frustumCount; ++f)
+			{
+				__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for (uint32 p = 0; p < FrustumPlanes::PLANE_COUNT; ++p)
+				{
+					// @̐ΒlExtents̓ς𕽖ʕ̔aƂĈ܂
+					const Float4& plane = frustums[f].Planes[p];
+					__m128 distance = _mm_mul_ps(_mm_set1_ps(plane.x), x);
+					distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+					distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+					distance = _mm_add_ps(distance, _mm_set1_ps(plane.w));
+
+					__m128 radius = _mm_mul_ps(_mm_set1_ps(std::fabs(plane.x)), hx);
+					radius   = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(std::fabs(plane.y)), hy));
+					radius   = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(std::fabs(plane.z)), hz));
+					inside   = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(distance, radius), zero));
+				}
+				visibleCounts[f] = CompactVisibleIndices(static_cast<uint32>(_mm_movemask_ps(inside)), 4, static_cast<uint32>(i), visibleIndices[f], visibleCounts[f]);
+			}
+		}
+
+		CullBoxesRemainder(frustums, frustumCount, boxes, visibleIndices, visibleCounts, i);
+	}
+
+	/*---------------------------------------------------------------
+			AVX2 : 8
+			XJ[łƌʂv邽, FMA͎gpɏZƉZ𕪂Ă܂.
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void CullSpheresAVX2(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingSphereArray& spheres, uint32* const* visibleIndices, uint64* visibleCounts)
+	{
+		const uint64 count = spheres.Size();
+		const float* cx    = spheres.CenterX.Data();
+		const float* cy    = spheres.CenterY.Data();
+		const float* cz    = spheres.CenterZ.Data();
+		const float* r     = spheres.Radius .Data();
+
+		uint64 i = 0;
+		const __m256 zero = _mm256_setzero_ps();
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x         = _mm256_loadu_ps(cx + i);
+			const __m256 y         = _mm256_loadu_ps(cy + i);
+			const __m256 z         = _mm256_loadu_ps(cz + i);
+			const __m256 negRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(r + i));
+
+			for (uint32 f = 0; f < frustumCount; ++f)
+			{
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (uint32 p = 0; p < FrustumPlanes::PLANE_COUNT; ++p)
+				{
+					const Float4& plane = frustums[f].Planes[p];
+					__m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), x);
+					distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+					distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+					distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+					inside   = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negRadius, _CMP_GE_OQ));
+				}
+				visibleCounts[f] = CompactVisibleIndices(static_cast<uint32>(_mm256_movemask_ps(inside)), 8, static_cast<uint32>(i), visibleIndices[f], visibleCounts[f]);
+			}
+		}
+		_mm256_zeroupper();
+
+		CullSpheresRemainder(frustums, frustumCount, spheres, visibleIndices, visibleCounts, i);
+	}
+
+	SIMD_TARGET_AVX2 void CullBoxesAVX2(const FrustumPlanes* frustums, const uint32 frustumCount, const BoundingBoxArray& boxes, uint32* const* visibleIndices, uint64* visibleCounts)
+	{
+		const uint64 count = boxes.Size();
+		const float* cx    = boxes.CenterX .Data();
+		const float* cy    = boxes.CenterY .Data();
+		const float* cz    = boxes.CenterZ .Data();
+		const float* ex    = boxes.ExtentsX.Data();
+		const float* ey    = boxes.ExtentsY.Data();
+		const float* ez    = boxes.ExtentsZ.Data();
+
+		uint64 i = 0;
+		const __m256 zero = _mm256_setzero_ps();
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x  = _mm256_loadu_ps(cx + i);
+			const __m256 y  = _mm256_loadu_ps(cy + i);
+			const __m256 z  = _mm256_loadu_ps(cz + i);
+			const __m256 hx = _mm256_loadu_ps(ex + i);
+			const __m256 hy = _mm256_loadu_ps(ey + i);
+			const __m256 hz = _mm256_loadu_ps(ez + i);
+
+			for (uint32 f = 0; f < frustumCount; ++f)
+			{
+				__m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+				for (uint32 p = 0; p < FrustumPlanes::PLANE_COUNT; ++p)
+				{
+					const Float4& plane = frustums[f].Planes[p];
+					__m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.x), x);
+					distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+					distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+					distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.w));
+
+					__m256 radius = _mm256_mul_ps(_mm256_set1_ps(std::fabs(plane.x)), hx);
+					radius   = _mm256_add_ps(radius, _mm256_mul_ps(_mm256_set1_ps(std::fabs(plane.y)), hy));
+					radius   = _mm256_add_ps(radius, _mm256_mul_ps(_mm256_set1_ps(std::fabs(plane.z)), hz));
+					inside   = _mm256_and_ps(inside, _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_GE_OQ));
+				}
+				visibleCounts[f] = CompactVisibleIndices(static_cast<uint32>(_mm256_movemask_ps(inside)), 8, static_cast<uint32>(i), visibleIndices[f], visibleCounts[f]);
+			}
+		}
+		_mm256_zeroupper();
+
+		CullBoxesRemainder(frustums, frustumCount, boxes, visibleIndices, visibleCounts, i);
+	}
+
+	/*---------------------------------------------------------------
+			SimdInstructionSet̏ɕׂ֐e[u
+			SSE4.1ŗL̖߂őȂӏ͖, SSE4.1SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr CullSpheresFunction CULL_SPHERES_FUNCTIONS[] = { CullSpheresScalar, CullSpheresSSE2, CullSpheresSSE2, CullSpheresAVX2 };
+	constexpr CullBoxesFunction   CULL_BOXES_FUNCTIONS  [] = { CullBoxesScalar  , CullBoxesSSE2  , CullBoxesSSE2  , CullBoxesAVX2   };
+#else
+	constexpr CullSpheresFunction CULL_SPHERES_FUNCTIONS[] = { CullSpheresScalar, CullSpheresScalar, CullSpheresScalar, CullSpheresScalar };
+	constexpr CullBoxesFunction   CULL_BOXES_FUNCTIONS  [] = { CullBoxesScalar  , CullBoxesScalar  , CullBoxesScalar  , CullBoxesScalar   };
+#endif
+
+	static_assert(sizeof(CULL_SPHERES_FUNCTIONS) / sizeof(CULL_SPHERES_FUNCTIONS[0]) == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(CULL_BOXES_FUNCTIONS)   / sizeof(CULL_BOXES_FUNCTIONS[0])   == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+}
+#pragma endregion Culling Kernel
+
+#pragma region FrustumCulling
+/*!**********************************************************************
+*  @brief     ƕ̎̔s, 䂲Ƃɉ̃CfbNXOl߂ŏo܂. @n
+*             gp閽߃ZbgCPUFeature::GetActiveŌ܂܂.
+*  @param[in]  const FrustumPlanes* ̔z
+*  @param[in]  const gu::uint32 ̐
+*  @param[in]  const BoundingSphereArray& s
+*  @param[out] gu::uint32* const* 䂲Ƃ̏o͐ (ꂼspheres.Size()ȏ̗̈悪Kvł)
+*  @param[out] gu::uint64* 䂲Ƃ̉
+*  @return     void
+*************************************************************************/
+void FrustumCulling::CullSpheres(const FrustumPlanes* frustums, const gu::uint32 frustumCount, const BoundingSphereArray& spheres, gu::uint32* const* visibleIndices, gu::uint64* visibleCounts)
+{
+	Check(frustums);
+	Check(visibleIndices);
+	Check(visibleCounts);
+
+	for (uint32 f = 0; f < frustumCount; ++f) { visibleCounts[f] = 0; }
+
+	CULL_SPHERES_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](frustums, frustumCount, spheres, visibleIndices, visibleCounts);
+}
+
+/*!**********************************************************************
+*  @brief     {bNXƕ̎̔s, 䂲Ƃɉ̃CfbNXOl߂ŏo܂. @n
+*             gp閽߃ZbgCPUFeature::GetActiveŌ܂܂.
+*  @param[in]  const FrustumPlanes* ̔z
+*  @param[in]  const gu::uint32 ̐
+*  @param[in]  const BoundingBoxArray& s{bNX
+*  @param[out] gu::uint32* const* 䂲Ƃ̏o͐ (ꂼboxes.Size()ȏ̗̈悪Kvł)
+*  @param[out] gu::uint64* 䂲Ƃ̉
+*  @return     void
+*************************************************************************/
+void FrustumCulling::CullBoxes(const FrustumPlanes* frustums, const gu::uint32 frustumCount, const BoundingBoxArray& boxes, gu::uint32* const* visibleIndices, gu::uint64* visibleCounts)
+{
+	Check(frustums);
+	Check(visibleIndices);
+	Check(visibleCounts);
+
+	for (uint32 f = 0; f < frustumCount; ++f) { visibleCounts[f] = 0; }
+
+	CULL_BOXES_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](frustums, frustumCount, boxes, visibleIndices, visibleCounts);
+}
+
+/*!**********************************************************************
+*  @brief     ̋̓(ꕔłĂ)肵܂.
+*************************************************************************/
+bool FrustumCulling::IsVisible(const FrustumPlanes& frustum, const BoundingSphere& sphere)
+{
+	return IsSphereVisible(frustum, sphere.Center.x, sphere.Center.y, sphere.Center.z, sphere.Radius);
+}
+
+/*!**********************************************************************
+*  @brief     ̃{bNX̓(ꕔłĂ)肵܂.
+*************************************************************************/
+bool FrustumCulling::IsVisible(const FrustumPlanes& frustum, const BoundingBox& box)
+{
+	return IsBoxVisible(frustum, box.Center.x, box.Center.y, box.Center.z, box.Extents.x, box.Extents.y, box.Extents.z);
+}
+#pragma endregion FrustumCulling
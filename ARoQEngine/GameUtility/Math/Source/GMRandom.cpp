@@ -0,0 +1,758 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMRandom.cpp
+///  @brief  ʂ̗ɐ邽߂̋[ł.
+///  @author toide
+///  @date   2026/10/20 0:42:18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GMRandom.hpp"
+#include "../Include/GMCPUFeature.hpp"
+#include "../Private/Simd/Include/GMSimdMacros.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <cmath>
+#include <cstring>
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			V[hl݂ɑւ̏Ȃ64bitl쐬܂
+	-----------------------------------------------------------------*/
+	uint64 SplitMix64(uint64& state)
+	{
+		uint64 z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	/*---------------------------------------------------------------
+			PCG64Ŏgp128bit̕Ȃ (ʂ̌̓I[o[t[Ő؂̂Ă܂)
+	-----------------------------------------------------------------*/
+	struct UInt128
+	{
+		uint64 High = 0;
+		uint64 Low  = 0;
+	};
+
+	__forceinline UInt128 Multiply64(const uint64 a, const uint64 b)
+	{
+	#if defined(_MSC_VER) && defined(_M_X64)
+		UInt128 result = {};
+		result.Low = _umul128(a, b, &result.High);
+		return result;
+	#elif defined(__SIZEOF_INT128__)
+		const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+		return { static_cast<uint64>(product >> 64), static_cast<uint64>(product) };
+	#else
+		const uint64 aLow = a & 0xFFFFFFFF, aHigh = a >> 32;
+		const uint64 bLow = b & 0xFFFFFFFF, bHigh = b >> 32;
+		const uint64 lowLow   = aLow  * bLow;
+		const uint64 highLow  = aHigh * bLow;
+		const uint64 lowHigh  = aLow  * bHigh;
+		const uint64 middle   = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + lowHigh;
+		return { aHigh * bHigh + (highLow >> 32) + (middle >> 32), (middle << 32) | (lowLow & 0xFFFFFFFF) };
+	#endif
+	}
+
+	__forceinline UInt128 Multiply(const UInt128& a, const UInt128& b)
+	{
+		UInt128 result = Multiply64(a.Low, b.Low);
+		result.High += a.Low * b.High + a.High * b.Low;
+		return result;
+	}
+
+	__forceinline UInt128 Add(const UInt128& a, const UInt128& b)
+	{
+		const uint64 low = a.Low + b.Low;
+		return { a.High + b.High + (low < a.Low ? 1 : 0), low };
+	}
+
+	/*! @brief PCG64̐`@̏搔*/
+	constexpr UInt128 PCG64_MULTIPLIER = { 0x2360ED051FC65DA4ull, 0x4385DF649FCCF645ull };
+
+	/*---------------------------------------------------------------
+			Ziggurat@̃e[u (256w)
+			X[i]͑wỉE[, F[i] = f(X[i])ł. X[0]͍ŉw (܂) 𓯂ʐς̒`Ƃ݂Ȃꍇ̕ł.
+	-----------------------------------------------------------------*/
+	constexpr int ZIGGURAT_LAYER_COUNT = 256;
+
+	struct ZigguratTable
+	{
+		double X[ZIGGURAT_LAYER_COUNT + 1] = {};
+		double F[ZIGGURAT_LAYER_COUNT + 1] = {};
+		double R = 0.0; //!< n܂ʒu
+	};
+
+	/*---------------------------------------------------------------
+			Kz : f(x) = exp(-x^2 / 2)
+	-----------------------------------------------------------------*/
+	const ZigguratTable& GetNormalTable()
+	{
+		static const ZigguratTable table = []()
+		{
+			constexpr double r = 3.654152885361008796;
+			constexpr double v = 0.00492867323399;
+
+			ZigguratTable result = {};
+			result.R    = r;
+			result.X[0] = v / std::exp(-0.5 * r * r);
+			result.X[1] = r;
+			for (int i = 2; i < ZIGGURAT_LAYER_COUNT; ++i)
+			{
+				const double y = v / result.X[i - 1] + std::exp(-0.5 * result.X[i - 1] * result.X[i - 1]);
+				result.X[i] = y < 1.0 ? std::sqrt(-2.0 * std::log(y)) : 0.0;
+			}
+			result.X[ZIGGURAT_LAYER_COUNT] = 0.0;
+
+			for (int i = 0; i <= ZIGGURAT_LAYER_COUNT; ++i) { result.F[i] = std::exp(-0.5 * result.X[i] * result.X[i]); }
+			return result;
+		}();
+		return table;
+	}
+
+	/*---------------------------------------------------------------
+			wz : f(x) = exp(-x)
+	-----------------------------------------------------------------*/
+	const ZigguratTable& GetExponentialTable()
+	{
+		static const ZigguratTable table = []()
+		{
+			constexpr double r = 7.697117470131049720307;
+			constexpr double v = 0.0039496598225815571993;
+
+			ZigguratTable result = {};
+			result.R    = r;
+			result.X[0] = v / std::exp(-r);
+			result.X[1] = r;
+			for (int i = 2; i < ZIGGURAT_LAYER_COUNT; ++i)
+			{
+				const double y = v / result.X[i - 1] + std::exp(-result.X[i - 1]);
+				result.X[i] = y < 1.0 ? -std::log(y) : 0.0;
+			}
+			result.X[ZIGGURAT_LAYER_COUNT] = 0.0;
+
+			for (int i = 0; i <= ZIGGURAT_LAYER_COUNT; ++i) { result.F[i] = std::exp(-result.X[i]); }
+			return result;
+		}();
+		return table;
+	}
+
+	/*---------------------------------------------------------------
+			64bit̗[0, 1), (0, 1]̎ɕϊ܂ (53bitgp܂)
+	-----------------------------------------------------------------*/
+	__forceinline double ToUnitDouble(const uint64 bits)         { return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0); }
+	__forceinline double ToPositiveUnitDouble(const uint64 bits) { return static_cast<double>((bits >> 11) + 1) * (1.0 / 9007199254740992.0); }
+
+	/*---------------------------------------------------------------
+			8{̐܂Ƃ߂Đi, output[block * 8 + lane]ɏ݂܂.
+			o͂̏Ԃ͑SĂ̖߃Zbgœł.
+	-----------------------------------------------------------------*/
+	using GenerateFunction = void(*)(uint64 (&)[4][BatchRandom::LANE_COUNT], uint64*, const uint64);
+
+	/*! @brief xɏubN. e[̏o͂L1LbVɎ܂悤ɂ܂.*/
+	constexpr uint64 GENERATE_CHUNK_BLOCK_COUNT = 64;
+
+	__forceinline uint64 RotateLeft(const uint64 value, const int shift)
+	{
+		return (value << shift) | (value >> (64 - shift));
+	}
+
+	void GenerateScalar(uint64 (&state)[4][BatchRandom::LANE_COUNT], uint64* output, const uint64 blockCount)
+	{
+		for (uint64 block = 0; block < blockCount; ++block)
+		{
+			for (uint32 lane = 0; lane < BatchRandom::LANE_COUNT; ++lane)
+			{
+				const uint64 s0 = state[0][lane], s1 = state[1][lane], s2 = state[2][lane], s3 = state[3][lane];
+				output[block * BatchRandom::LANE_COUNT + lane] = RotateLeft(s0 + s3, 23) + s0;
+
+				const uint64 t  = s1 << 17;
+				const uint64 n2 = s2 ^ s0;
+				const uint64 n3 = s3 ^ s1;
+				state[1][lane] = s1 ^ n2;
+				state[0][lane] = s0 ^ n3;
+				state[2][lane] = n2 ^ t;
+				state[3][lane] = RotateLeft(n3, 45);
+			}
+		}
+	}
+
+	using ConvertFloatFunction = void(*)(float*, const uint64, const float, const float);
+	using ConvertIntFunction   = void(*)(int32*, const uint64, const int32, const uint32);
+
+	/*---------------------------------------------------------------
+			32bit̗܂ꂽz, ̏[min, max)̎ɕϊ܂. (SIMDłƓʂƂȂ悤, FMA͎gp܂)
+	-----------------------------------------------------------------*/
+	void ConvertFloatScalar(float* data, const uint64 count, const float scale, const float offset)
+	{
+		for (uint64 i = 0; i < count; ++i)
+		{
+			uint32 bits = 0;
+			std::memcpy(&bits, data + i, sizeof(bits));
+			data[i] = static_cast<float>(static_cast<int32>(bits >> 8)) * scale + offset;
+		}
+	}
+
+	/*---------------------------------------------------------------
+			32bit̗Ɣ͈͂̐ς̏32bitŏlɑ܂
+	-----------------------------------------------------------------*/
+	void ConvertIntScalar(int32* data, const uint64 count, const int32 min, const uint32 range)
+	{
+		for (uint64 i = 0; i < count; ++i)
+		{
+			const uint32 offset = static_cast<uint32>((static_cast<uint64>(static_cast<uint32>(data[i])) * range) >> 32);
+			data[i] = static_cast<int32>(static_cast<uint32>(min) + offset);
+		}
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	/*---------------------------------------------------------------
+			SSE2 : 2[܂
+	-----------------------------------------------------------------*/
+	__forceinline __m128i RotateLeftSSE2(const __m128i value, const int shift)
+	{
+		return _mm_or_si128(_mm_slli_epi64(value, shift), _mm_srli_epi64(value, 64 - shift));
+	}
+
+	void GenerateSSE2(uint64 (&state)[4][BatchRandom::LANE_COUNT], uint64* output, const uint64 blockCount)
+	{
+		for (uint64 chunk = 0; chunk < blockCount; chunk += GENERATE_CHUNK_BLOCK_COUNT)
+		{
+			const uint64 chunkEnd = chunk + GENERATE_CHUNK_BLOCK_COUNT < blockCount ? chunk + GENERATE_CHUNK_BLOCK_COUNT : blockCount;
+
+			for (uint32 lane = 0; lane < BatchRandom::LANE_COUNT; lane += 2)
+			{
+				__m128i s0 = _mm_load_si128(reinterpret_cast<const __m128i*>(&state[0][lane]));
+				__m128i s1 = _mm_load_si128(reinterpret_cast<const __m128i*>(&state[1][lane]));
+				__m128i s2 = _mm_load_si128(reinterpret_cast<const __m128i*>(&state[2][lane]));
+				__m128i s3 = _mm_load_si128(reinterpret_cast<const __m128i*>(&state[3][lane]));
+
+				for (uint64 block = chunk; block < chunkEnd; ++block)
+				{
+					const __m128i result = _mm_add_epi64(RotateLeftSSE2(_mm_add_epi64(s0, s3), 23), s0);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + block * BatchRandom::LANE_COUNT + lane), result);
+
+					const __m128i t = _mm_slli_epi64(s1, 17);
+					s2 = _mm_xor_si128(s2, s0);
+					s3 = _mm_xor_si128(s3, s1);
+					s1 = _mm_xor_si128(s1, s2);
+					s0 = _mm_xor_si128(s0, s3);
+					s2 = _mm_xor_si128(s2, t);
+					s3 = RotateLeftSSE2(s3, 45);
+				}
+
+				_mm_store_si128(reinterpret_cast<__m128i*>(&state[0][lane]), s0);
+				_mm_store_si128(reinterpret_cast<__m128i*>(&state[1][lane]), s1);
+				_mm_store_si128(reinterpret_cast<__m128i*>(&state[2][lane]), s2);
+				_mm_store_si128(reinterpret_cast<__m128i*>(&state[3][lane]), s3);
+			}
+		}
+	}
+
+	void ConvertFloatSSE2(float* data, const uint64 count, const float scale, const float offset)
+	{
+		const __m128 scaleVector  = _mm_set1_ps(scale);
+		const __m128 offsetVector = _mm_set1_ps(offset);
+
+		uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i bits  = _mm_srli_epi32(_mm_castps_si128(_mm_loadu_ps(data + i)), 8);
+			const __m128  value = _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(bits), scaleVector), offsetVector);
+			_mm_storeu_ps(data + i, value);
+		}
+
+		ConvertFloatScalar(data + i, count - i, scale, offset);
+	}
+
+	/*---------------------------------------------------------------
+			mul_epu32͋Ԗڂ32bitm̐ς߂邽, Ԗڂ̓VtgĂvZ܂
+	-----------------------------------------------------------------*/
+	void ConvertIntSSE2(int32* data, const uint64 count, const int32 min, const uint32 range)
+	{
+		const __m128i rangeVector = _mm_set1_epi32(static_cast<int32>(range));
+		const __m128i minVector   = _mm_set1_epi32(min);
+		const __m128i highMask    = _mm_set_epi32(-1, 0, -1, 0);
+
+		uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+			const __m128i even = _mm_srli_epi64(_mm_mul_epu32(bits, rangeVector), 32);
+			const __m128i odd  = _mm_and_si128(_mm_mul_epu32(_mm_srli_epi64(bits, 32), rangeVector), highMask);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_add_epi32(_mm_or_si128(even, odd), minVector));
+		}
+
+		ConvertIntScalar(data + i, count - i, min, range);
+	}
+
+	/*---------------------------------------------------------------
+			AVX2 : 4[܂
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 __forceinline __m256i RotateLeftAVX2(const __m256i value, const int shift)
+	{
+		return _mm256_or_si256(_mm256_slli_epi64(value, shift), _mm256_srli_epi64(value, 64 - shift));
+	}
+
+	SIMD_TARGET_AVX2 void GenerateAVX2(uint64 (&state)[4][BatchRandom::LANE_COUNT], uint64* output, const uint64 blockCount)
+	{
+		for (uint64 chunk = 0; chunk < blockCount; chunk += GENERATE_CHUNK_BLOCK_COUNT)
+		{
+			const uint64 chunkEnd = chunk + GENERATE_CHUNK_BLOCK_COUNT < blockCount ? chunk + GENERATE_CHUNK_BLOCK_COUNT : blockCount;
+
+			for (uint32 lane = 0; lane < BatchRandom::LANE_COUNT; lane += 4)
+			{
+				__m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&state[0][lane]));
+				__m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&state[1][lane]));
+				__m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&state[2][lane]));
+				__m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&state[3][lane]));
+
+				for (uint64 block = chunk; block < chunkEnd; ++block)
+				{
+					const __m256i result = _mm256_add_epi64(RotateLeftAVX2(_mm256_add_epi64(s0, s3), 23), s0);
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + block * BatchRandom::LANE_COUNT + lane), result);
+
+					const __m256i t = _mm256_slli_epi64(s1, 17);
+					s2 = _mm256_xor_si256(s2, s0);
+					s3 = _mm256_xor_si256(s3, s1);
+					s1 = _mm256_xor_si256(s1, s2);
+					s0 = _mm256_xor_si256(s0, s3);
+					s2 = _mm256_xor_si256(s2, t);
+					s3 = RotateLeftAVX2(s3, 45);
+				}
+
+				_mm256_store_si256(reinterpret_cast<__m256i*>(&state[0][lane]), s0);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(&state[1][lane]), s1);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(&state[2][lane]), s2);
+				_mm256_store_si256(reinterpret_cast<__m256i*>(&state[3][lane]), s3);
+			}
+		}
+		_mm256_zeroupper();
+	}
+
+	SIMD_TARGET_AVX2 void ConvertFloatAVX2(float* data, const uint64 count, const float scale, const float offset)
+	{
+		const __m256 scaleVector  = _mm256_set1_ps(scale);
+		const __m256 offsetVector = _mm256_set1_ps(offset);
+
+		uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256i bits  = _mm256_srli_epi32(_mm256_castps_si256(_mm256_loadu_ps(data + i)), 8);
+			const __m256  value = _mm256_add_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(bits), scaleVector), offsetVector);
+			_mm256_storeu_ps(data + i, value);
+		}
+		_mm256_zeroupper();
+
+		ConvertFloatSSE2(data + i, count - i, scale, offset);
+	}
+
+	SIMD_TARGET_AVX2 void ConvertIntAVX2(int32* data, const uint64 count, const int32 min, const uint32 range)
+	{
+		const __m256i rangeVector = _mm256_set1_epi32(static_cast<int32>(range));
+		const __m256i minVector   = _mm256_set1_epi32(min);
+		const __m256i highMask    = _mm256_set_epi32(-1, 0, -1, 0, -1, 0, -1, 0);
+
+		uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256i bits = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+			const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(bits, rangeVector), 32);
+			const __m256i odd  = _mm256_and_si256(_mm256_mul_epu32(_mm256_srli_epi64(bits, 32), rangeVector), highMask);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), _mm256_add_epi32(_mm256_or_si256(even, odd), minVector));
+		}
+		_mm256_zeroupper();
+
+		ConvertIntSSE2(data + i, count - i, min, range);
+	}
+
+	/*---------------------------------------------------------------
+			SimdInstructionSet̏ɕׂ֐e[u
+			SSE4.1ŗL̖߂őȂӏ͖, SSE4.1SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr GenerateFunction     GENERATE_FUNCTIONS     [] = { GenerateScalar    , GenerateSSE2    , GenerateSSE2    , GenerateAVX2     };
+	constexpr ConvertFloatFunction CONVERT_FLOAT_FUNCTIONS[] = { ConvertFloatScalar, ConvertFloatSSE2, ConvertFloatSSE2, ConvertFloatAVX2 };
+	constexpr ConvertIntFunction   CONVERT_INT_FUNCTIONS  [] = { ConvertIntScalar  , ConvertIntSSE2  , ConvertIntSSE2  , ConvertIntAVX2   };
+#else
+	constexpr GenerateFunction     GENERATE_FUNCTIONS     [] = { GenerateScalar    , GenerateScalar    , GenerateScalar    , GenerateScalar     };
+	constexpr ConvertFloatFunction CONVERT_FLOAT_FUNCTIONS[] = { ConvertFloatScalar, ConvertFloatScalar, ConvertFloatScalar, ConvertFloatScalar };
+	constexpr ConvertIntFunction   CONVERT_INT_FUNCTIONS  [] = { ConvertIntScalar  , ConvertIntScalar  , ConvertIntScalar  , ConvertIntScalar   };
+#endif
+
+	static_assert(sizeof(GENERATE_FUNCTIONS)      / sizeof(GENERATE_FUNCTIONS[0])      == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(CONVERT_FLOAT_FUNCTIONS) / sizeof(CONVERT_FLOAT_FUNCTIONS[0]) == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(CONVERT_INT_FUNCTIONS)   / sizeof(CONVERT_INT_FUNCTIONS[0])   == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+
+	__forceinline GenerateFunction GetGenerateFunction()
+	{
+		return GENERATE_FUNCTIONS[static_cast<size_t>(CPUFeature::GetActive())];
+	}
+
+	/*---------------------------------------------------------------
+			o͐ubNPʂŒڗŖ, c̒[͈ꎞobt@oRŏ݂܂.
+			񂾃oCg32bit̗̔zƂĈ܂.
+	-----------------------------------------------------------------*/
+	void GenerateBytes(uint64 (&state)[4][BatchRandom::LANE_COUNT], void* output, const uint64 byteCount)
+	{
+		constexpr uint64 BLOCK_BYTE_COUNT = sizeof(uint64) * BatchRandom::LANE_COUNT;
+
+		const auto   generate   = GetGenerateFunction();
+		const uint64 blockCount = byteCount / BLOCK_BYTE_COUNT;
+		const uint64 restBytes  = byteCount % BLOCK_BYTE_COUNT;
+
+		// 64bitEɑĂȂo͐ł, ݂storeuōsߖ肠܂
+		generate(state, static_cast<uint64*>(output), blockCount);
+
+		if (restBytes > 0)
+		{
+			uint64 block[BatchRandom::LANE_COUNT] = {};
+			generate(state, block, 1);
+			std::memcpy(static_cast<uint8*>(output) + blockCount * BLOCK_BYTE_COUNT, block, restBytes);
+		}
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Xoshiro256PlusPlus
+/*!**********************************************************************
+*  @brief     2^128operator()Ă񂾏ꍇƓԂ܂Ői߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void Xoshiro256PlusPlus::Jump()
+{
+	static constexpr uint64 JUMP[4] = { 0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull };
+	Jump(JUMP);
+}
+
+/*!**********************************************************************
+*  @brief     2^192operator()Ă񂾏ꍇƓԂ܂Ői߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void Xoshiro256PlusPlus::LongJump()
+{
+	static constexpr uint64 LONG_JUMP[4] = { 0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull };
+	Jump(LONG_JUMP);
+}
+
+/*!**********************************************************************
+*  @brief     V[hlԂ܂.
+*  @param[in] const gu::uint64 seed
+*  @return    void
+*************************************************************************/
+void Xoshiro256PlusPlus::SetSeed(const gu::uint64 seed)
+{
+	uint64 splitMixState = seed;
+	for (auto& state : _state) { state = SplitMix64(splitMixState); }
+}
+
+/*!**********************************************************************
+*  @brief     Wvp̑ɏ]ďԂi߂܂.
+*  @param[in] const gu::uint64 (&)[4] 
+*  @return    void
+*************************************************************************/
+void Xoshiro256PlusPlus::Jump(const gu::uint64 (&polynomial)[4])
+{
+	uint64 s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+	for (const uint64 word : polynomial)
+	{
+		for (int bit = 0; bit < 64; ++bit)
+		{
+			if (word & (1ull << bit))
+			{
+				s0 ^= _state[0]; s1 ^= _state[1];
+				s2 ^= _state[2]; s3 ^= _state[3];
+			}
+			(*this)();
+		}
+	}
+	_state[0] = s0; _state[1] = s1; _state[2] = s2; _state[3] = s3;
+}
+#pragma endregion Xoshiro256PlusPlus
+
+#pragma region PCG64
+/*!**********************************************************************
+*  @brief     64bit̗Ԃ܂.
+*  @param[in] void
+*  @return    gu::uint64
+*************************************************************************/
+gu::uint64 PCG64::operator()()
+{
+	const UInt128 state = Add(Multiply({ _stateHigh, _stateLow }, PCG64_MULTIPLIER), { _incrementHigh, _incrementLow });
+	_stateHigh = state.High;
+	_stateLow  = state.Low;
+
+	// XSL-RR : ʂƉʂ̔rI_a, 6bit̐E]܂
+	const uint64 value    = state.High ^ state.Low;
+	const int    rotation = static_cast<int>(state.High >> 58);
+	return (value >> rotation) | (value << ((64 - rotation) & 63));
+}
+
+/*!**********************************************************************
+*  @brief     operator()deltaĂ񂾏ꍇƓԂ܂Ői߂܂. (Brown̕@)
+*  @param[in] const gu::uint64 64bit
+*  @param[in] const gu::uint64 64bit
+*  @return    void
+*************************************************************************/
+void PCG64::Advance(const gu::uint64 deltaHigh, const gu::uint64 deltaLow)
+{
+	UInt128 accumulateMultiplier = { 0, 1 };
+	UInt128 accumulateIncrement  = { 0, 0 };
+	UInt128 currentMultiplier    = PCG64_MULTIPLIER;
+	UInt128 currentIncrement     = { _incrementHigh, _incrementLow };
+
+	uint64 high = deltaHigh, low = deltaLow;
+	while (high != 0 || low != 0)
+	{
+		if (low & 1)
+		{
+			accumulateMultiplier = Multiply(accumulateMultiplier, currentMultiplier);
+			accumulateIncrement  = Add(Multiply(accumulateIncrement, currentMultiplier), currentIncrement);
+		}
+		currentIncrement  = Multiply(Add(currentMultiplier, { 0, 1 }), currentIncrement);
+		currentMultiplier = Multiply(currentMultiplier, currentMultiplier);
+
+		low  = (low >> 1) | (high << 63);
+		high = high >> 1;
+	}
+
+	const UInt128 state = Add(Multiply(accumulateMultiplier, { _stateHigh, _stateLow }), accumulateIncrement);
+	_stateHigh = state.High;
+	_stateLow  = state.Low;
+}
+
+/*!**********************************************************************
+*  @brief     V[hlƌnԍԂ܂.
+*  @param[in] const gu::uint64 seed
+*  @param[in] const gu::uint64 stream
+*  @return    void
+*************************************************************************/
+void PCG64::SetSeed(const gu::uint64 seed, const gu::uint64 stream)
+{
+	uint64 splitMixState = seed;
+	const uint64 seedHigh = SplitMix64(splitMixState);
+	const uint64 seedLow  = SplitMix64(splitMixState);
+
+	// ͊łKv邽, nԍ1bitɂ炵čŉʂ1ɂ܂
+	_incrementHigh = stream >> 63;
+	_incrementLow  = (stream << 1) | 1;
+
+	_stateHigh = 0;
+	_stateLow  = 0;
+	(*this)();
+
+	const UInt128 state = Add({ _stateHigh, _stateLow }, { seedHigh, seedLow });
+	_stateHigh = state.High;
+	_stateLow  = state.Low;
+	(*this)();
+}
+#pragma endregion PCG64
+
+#pragma region BatchRandom
+/*!**********************************************************************
+*  @brief     V[hlƌnԍ쐬܂.
+*  @param[in] const gu::uint64 seed
+*  @param[in] const gu::uint64 streamIndex
+*************************************************************************/
+BatchRandom::BatchRandom(const gu::uint64 seed, const gu::uint64 streamIndex)
+{
+	Xoshiro256PlusPlus generator(seed);
+	for (uint64 i = 0; i < streamIndex; ++i) { generator.LongJump(); }
+
+	*this = BatchRandom(generator);
+}
+
+/*!**********************************************************************
+*  @brief     ̏Ԃ쐬܂. [ƂJump, 2^128ꂽn蓖Ă܂.
+*  @param[in] const Xoshiro256PlusPlus& generator
+*************************************************************************/
+BatchRandom::BatchRandom(const Xoshiro256PlusPlus& generator)
+{
+	Xoshiro256PlusPlus laneGenerator = generator;
+	for (uint32 lane = 0; lane < LANE_COUNT; ++lane)
+	{
+		for (int i = 0; i < 4; ++i) { _state[i][lane] = laneGenerator.GetState()[i]; }
+		laneGenerator.Jump();
+	}
+}
+
+/*!**********************************************************************
+*  @brief     64biẗl݂܂.
+*  @param[out] gu::uint64* o͐
+*  @param[in]  const gu::uint64 vf
+*  @return     void
+*************************************************************************/
+void BatchRandom::FillUInt64(gu::uint64* output, const gu::uint64 count)
+{
+	GenerateBytes(_state, output, count * sizeof(uint64));
+}
+
+/*!**********************************************************************
+*  @brief     32biẗl݂܂.
+*  @param[out] gu::uint32* o͐
+*  @param[in]  const gu::uint64 vf
+*  @return     void
+*************************************************************************/
+void BatchRandom::FillUInt32(gu::uint32* output, const gu::uint64 count)
+{
+	GenerateBytes(_state, output, count * sizeof(uint32));
+}
+
+/*!**********************************************************************
+*  @brief     [min, max)̈l݂܂.
+*  @param[out] float* o͐
+*  @param[in]  const gu::uint64 vf
+*  @param[in]  const float ŏl
+*  @param[in]  const float ől
+*  @return     void
+*************************************************************************/
+void BatchRandom::FillFloat(float* output, const gu::uint64 count, const float min, const float max)
+{
+	static_assert(sizeof(float) == sizeof(uint32), "float must be 32bit.");
+
+	// o͐32bit̗ł, ̏Ŏɕϊ܂
+	GenerateBytes(_state, output, count * sizeof(float));
+
+	const float scale = (max - min) * (1.0f / 16777216.0f);
+	CONVERT_FLOAT_FUNCTIONS[static_cast<size_t>(CPUFeature::GetActive())](output, count, scale, min);
+}
+
+/*!**********************************************************************
+*  @brief     [min, max]̐̈l݂܂.
+*  @param[out] gu::int32* o͐
+*  @param[in]  const gu::uint64 vf
+*  @param[in]  const gu::int32 ŏl
+*  @param[in]  const gu::int32 ől
+*  @return     void
+*************************************************************************/
+void BatchRandom::FillInt32(gu::int32* output, const gu::uint64 count, const gu::int32 min, const gu::int32 max)
+{
+	Check(min <= max);
+
+	GenerateBytes(_state, output, count * sizeof(int32));
+
+	// ͈͂2^32̏ꍇ͗̂܂܎gp܂
+	const uint32 range = static_cast<uint32>(max) - static_cast<uint32>(min) + 1;
+	if (range == 0) { return; }
+
+	CONVERT_INT_FUNCTIONS[static_cast<size_t>(CPUFeature::GetActive())](output, count, min, range);
+}
+
+/*!**********************************************************************
+*  @brief     Kzɏ]Ziggurat@ŏ݂܂.
+*  @param[out] float* o͐
+*  @param[in]  const gu::uint64 vf
+*  @param[in]  const float 
+*  @param[in]  const float W΍
+*  @return     void
+*************************************************************************/
+void BatchRandom::FillNormal(float* output, const gu::uint64 count, const float mean, const float standardDeviation)
+{
+	const auto& table = GetNormalTable();
+
+	for (uint64 index = 0; index < count; ++index)
+	{
+		double x = 0.0;
+		while (true)
+		{
+			// 8bitőwI, 53bit(-1, 1)̈lƂĎgp܂
+			const uint64 bits  = NextBufferedUInt64();
+			const int    layer = static_cast<int>(bits & 0xFF);
+			const double u     = 2.0 * ToUnitDouble(bits) - 1.0;
+			x = u * table.X[layer];
+
+			// 99%͂̔Ŋm肵܂
+			if (std::abs(x) < table.X[layer + 1]) { break; }
+
+			// ŉw :  (|x| > R) Marsaglia̕@ŃTvO܂
+			if (layer == 0)
+			{
+				double tailX = 0.0, tailY = 0.0;
+				do
+				{
+					tailX = -std::log(ToPositiveUnitDouble(NextBufferedUInt64())) / table.R;
+					tailY = -std::log(ToPositiveUnitDouble(NextBufferedUInt64()));
+				} while (tailY + tailY < tailX * tailX);
+
+				x = u < 0.0 ? -(table.R + tailX) : table.R + tailX;
+				break;
+			}
+
+			// `̉E[̞̕, mxƔrč̑܂
+			const double y = table.F[layer + 1] + (table.F[layer] - table.F[layer + 1]) * ToUnitDouble(NextBufferedUInt64());
+			if (y < std::exp(-0.5 * x * x)) { break; }
+		}
+
+		output[index] = static_cast<float>(mean + standardDeviation * x);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     wzɏ]Ziggurat@ŏ݂܂.
+*  @param[out] float* o͐
+*  @param[in]  const gu::uint64 vf
+*  @param[in]  const float PʎԂ̔ ()
+*  @return     void
+*************************************************************************/
+void BatchRandom::FillExponential(float* output, const gu::uint64 count, const float lambda)
+{
+	Check(lambda > 0.0f);
+
+	const auto&  table        = GetExponentialTable();
+	const double inverseScale = 1.0 / lambda;
+
+	for (uint64 index = 0; index < count; ++index)
+	{
+		double x = 0.0;
+		while (true)
+		{
+			const uint64 bits  = NextBufferedUInt64();
+			const int    layer = static_cast<int>(bits & 0xFF);
+			x = ToUnitDouble(bits) * table.X[layer];
+
+			if (x < table.X[layer + 1]) { break; }
+
+			// wz͖L, R + wƂȂ܂
+			if (layer == 0)
+			{
+				x = table.R - std::log(ToPositiveUnitDouble(NextBufferedUInt64()));
+				break;
+			}
+
+			const double y = table.F[layer + 1] + (table.F[layer] - table.F[layer + 1]) * ToUnitDouble(NextBufferedUInt64());
+			if (y < std::exp(-x)) { break; }
+		}
+
+		output[index] = static_cast<float>(x * inverseScale);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̃obt@𗐐Ŗߒ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void BatchRandom::RefillBuffer()
+{
+	GetGenerateFunction()(_state, _buffer, BUFFER_SIZE / LANE_COUNT);
+	_bufferPosition = 0;
+}
+#pragma endregion BatchRandom
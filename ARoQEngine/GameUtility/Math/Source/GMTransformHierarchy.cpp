@@ -0,0 +1,687 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GMTransformHierarchy.cpp
+///  @brief  ʂTransform̐eqKw𕽒RȔzŕێ, [hs1̐`ł܂Ƃ߂čXVNXł.
+///  @author toide
+///  @date   2026/10/20 0:41:37
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GMTransformHierarchy.hpp"
+#include "../Include/GMCPUFeature.hpp"
+#include "../Private/Simd/Include/GMSimdMacros.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <vector>
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+using namespace gu;
+using namespace gm::details::transform;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			UpdateɎQƂz̐擪 (XbhԂŋL܂)
+	-----------------------------------------------------------------*/
+	struct UpdateContext
+	{
+		const uint32* ParentIndices;
+		uint8*        Flags;
+		const Float3* Positions;
+		const Float4* Rotations;
+		const Float3* Scales;
+		Float4x4*     LocalMatrices;
+		Float4x4*     WorldMatrices;
+	};
+
+	/*---------------------------------------------------------------
+			zVя (order[VCfbNX] = ÂCfbNX) ɕבւ܂
+	-----------------------------------------------------------------*/
+	template<class T>
+	void Permute(DynamicArray<T>& array, const DynamicArray<uint32>& order)
+	{
+		DynamicArray<T> result = {};
+		result.Resize(order.Size(), false);
+		for (uint64 i = 0; i < order.Size(); ++i)
+		{
+			result[i] = array[order[i]];
+		}
+		array = static_cast<DynamicArray<T>&&>(result);
+	}
+}
+
+#pragma region Update Kernel
+namespace
+{
+	using UpdateRangeFunction = void(*)(const UpdateContext&, const uint32, const uint32);
+
+	/*---------------------------------------------------------------
+			NH[^jI]s3s߂܂ (RotationQuaternionƓsxNg`)
+	-----------------------------------------------------------------*/
+	__forceinline void ComputeRotationRows(const Float4& q, float (&rows)[3][3])
+	{
+		const float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+		const float xx = q.x * x2 , yy = q.y * y2 , zz = q.z * z2;
+		const float xy = q.x * y2 , xz = q.x * z2 , yz = q.y * z2;
+		const float wx = q.w * x2 , wy = q.w * y2 , wz = q.w * z2;
+
+		rows[0][0] = 1.0f - (yy + zz); rows[0][1] = xy + wz;          rows[0][2] = xz - wy;
+		rows[1][0] = xy - wz;          rows[1][1] = 1.0f - (xx + zz); rows[1][2] = yz + wx;
+		rows[2][0] = xz + wy;          rows[2][1] = yz - wx;          rows[2][2] = 1.0f - (xx + yy);
+	}
+
+	/*---------------------------------------------------------------
+			XJ[ł̍XV
+	-----------------------------------------------------------------*/
+	void UpdateRangeScalar(const UpdateContext& context, const uint32 begin, const uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+		{
+			const uint8  flags  = context.Flags[i];
+			const uint32 parent = context.ParentIndices[i];
+			const bool isParentChanged = parent != INVALID_INDEX && (context.Flags[parent] & FLAG_WORLD_CHANGED) != 0;
+
+			if ((flags & (FLAG_LOCAL_DIRTY | FLAG_WORLD_DIRTY)) == 0 && !isParentChanged)
+			{
+				context.Flags[i] = 0;
+				continue;
+			}
+
+			auto& local = context.LocalMatrices[i].u.m;
+			if (flags & FLAG_LOCAL_DIRTY)
+			{
+				float rotation[3][3];
+				ComputeRotationRows(context.Rotations[i], rotation);
+
+				const Float3& scale    = context.Scales[i];
+				const Float3& position = context.Positions[i];
+				const float   scales[3] = { scale.x, scale.y, scale.z };
+				for (uint32 r = 0; r < 3; ++r)
+				{
+					local[r][0] = rotation[r][0] * scales[r];
+					local[r][1] = rotation[r][1] * scales[r];
+					local[r][2] = rotation[r][2] * scales[r];
+					local[r][3] = 0.0f;
+				}
+				local[3][0] = position.x; local[3][1] = position.y; local[3][2] = position.z; local[3][3] = 1.0f;
+			}
+
+			auto& world = context.WorldMatrices[i].u.m;
+			if (parent == INVALID_INDEX)
+			{
+				context.WorldMatrices[i] = context.LocalMatrices[i];
+			}
+			else
+			{
+				// [Js͍ŏI (0, 0, 0, 1) ̃AtBŝ, 0ƂȂ鍀̏Z͏ȗ܂.
+				const auto& p = context.WorldMatrices[parent].u.m;
+				for (uint32 r = 0; r < 4; ++r)
+				{
+					for (uint32 c = 0; c < 4; ++c)
+					{
+						world[r][c] = local[r][0] * p[0][c] + local[r][1] * p[1][c] + local[r][2] * p[2][c] + (r == 3 ? p[3][c] : 0.0f);
+					}
+				}
+			}
+
+			context.Flags[i] = FLAG_WORLD_CHANGED;
+		}
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	/*---------------------------------------------------------------
+			SSE2ł̍XV (4x4s1s1WX^ň܂)
+	-----------------------------------------------------------------*/
+	__forceinline __m128 TransformRow(const __m128 row, const __m128 p0, const __m128 p1, const __m128 p2)
+	{
+		const __m128 x = _mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 y = _mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1));
+		const __m128 z = _mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2));
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, p0), _mm_mul_ps(y, p1)), _mm_mul_ps(z, p2));
+	}
+
+	void UpdateRangeSSE2(const UpdateContext& context, const uint32 begin, const uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i)
+		{
+			const uint8  flags  = context.Flags[i];
+			const uint32 parent = context.ParentIndices[i];
+			const bool isParentChanged = parent != INVALID_INDEX && (context.Flags[parent] & FLAG_WORLD_CHANGED) != 0;
+
+			if ((flags & (FLAG_LOCAL_DIRTY | FLAG_WORLD_DIRTY)) == 0 && !isParentChanged)
+			{
+				context.Flags[i] = 0;
+				continue;
+			}
+
+			float* local = context.LocalMatrices[i].u.a;
+			__m128 l0, l1, l2, l3;
+			if (flags & FLAG_LOCAL_DIRTY)
+			{
+				float rotation[3][3];
+				ComputeRotationRows(context.Rotations[i], rotation);
+
+				const Float3& scale    = context.Scales[i];
+				const Float3& position = context.Positions[i];
+				l0 = _mm_mul_ps(_mm_setr_ps(rotation[0][0], rotation[0][1], rotation[0][2], 0.0f), _mm_set1_ps(scale.x));
+				l1 = _mm_mul_ps(_mm_setr_ps(rotation[1][0], rotation[1][1], rotation[1][2], 0.0f), _mm_set1_ps(scale.y));
+				l2 = _mm_mul_ps(_mm_setr_ps(rotation[2][0], rotation[2][1], rotation[2][2], 0.0f), _mm_set1_ps(scale.z));
+				l3 = _mm_setr_ps(position.x, position.y, position.z, 1.0f);
+				_mm_storeu_ps(local + 0 , l0);
+				_mm_storeu_ps(local + 4 , l1);
+				_mm_storeu_ps(local + 8 , l2);
+				_mm_storeu_ps(local + 12, l3);
+			}
+			else
+			{
+				l0 = _mm_loadu_ps(local + 0);
+				l1 = _mm_loadu_ps(local + 4);
+				l2 = _mm_loadu_ps(local + 8);
+				l3 = _mm_loadu_ps(local + 12);
+			}
+
+			float* world = context.WorldMatrices[i].u.a;
+			if (parent == INVALID_INDEX)
+			{
+				_mm_storeu_ps(world + 0 , l0);
+				_mm_storeu_ps(world + 4 , l1);
+				_mm_storeu_ps(world + 8 , l2);
+				_mm_storeu_ps(world + 12, l3);
+			}
+			else
+			{
+				// [Js͍ŏI (0, 0, 0, 1) ̃AtBŝ, 0ƂȂ鍀̏Z͏ȗ܂.
+				const float* p = context.WorldMatrices[parent].u.a;
+				const __m128 p0 = _mm_loadu_ps(p + 0);
+				const __m128 p1 = _mm_loadu_ps(p + 4);
+				const __m128 p2 = _mm_loadu_ps(p + 8);
+				const __m128 p3 = _mm_loadu_ps(p + 12);
+				_mm_storeu_ps(world + 0 , TransformRow(l0, p0, p1, p2));
+				_mm_storeu_ps(world + 4 , TransformRow(l1, p0, p1, p2));
+				_mm_storeu_ps(world + 8 , TransformRow(l2, p0, p1, p2));
+				_mm_storeu_ps(world + 12, _mm_add_ps(TransformRow(l3, p0, p1, p2), p3));
+			}
+
+			context.Flags[i] = FLAG_WORLD_CHANGED;
+		}
+	}
+
+	/*---------------------------------------------------------------
+			SimdInstructionSet̏ɕׂ֐e[u
+			4x4s1s傤128bitɎ܂, 256bitɂĂȂȂ, SSE4.1, AVX2SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr UpdateRangeFunction UPDATE_RANGE_FUNCTIONS[] = { UpdateRangeScalar, UpdateRangeSSE2, UpdateRangeSSE2, UpdateRangeSSE2 };
+#else
+	constexpr UpdateRangeFunction UPDATE_RANGE_FUNCTIONS[] = { UpdateRangeScalar, UpdateRangeScalar, UpdateRangeScalar, UpdateRangeScalar };
+#endif
+
+	static_assert(sizeof(UPDATE_RANGE_FUNCTIONS) / sizeof(UPDATE_RANGE_FUNCTIONS[0]) == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+}
+#pragma endregion Update Kernel
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     Pʍs̃m[h쐬܂.
+*  @param[in] const Handle ẽnh ([gƂꍇINVALID_HANDLE)
+*  @return    Handle
+*************************************************************************/
+TransformHierarchy::Handle TransformHierarchy::Create(const Handle parent)
+{
+	return Create(Float3(0.0f, 0.0f, 0.0f), Float4(0.0f, 0.0f, 0.0f, 1.0f), Float3(1.0f, 1.0f, 1.0f), parent);
+}
+
+/*!**********************************************************************
+*  @brief     [J̈ʒu, ], g嗦w肵ăm[h쐬܂.
+*  @param[in] const Float3& [J̈ʒu
+*  @param[in] const Float4& [J̉] (NH[^jI x, y, z, w)
+*  @param[in] const Float3& [J̊g嗦
+*  @param[in] const Handle ẽnh ([gƂꍇINVALID_HANDLE)
+*  @return    Handle
+*************************************************************************/
+TransformHierarchy::Handle TransformHierarchy::Create(const Float3& position, const Float4& rotation, const Float3& scale, const Handle parent)
+{
+	if (parent == INVALID_HANDLE)
+	{
+		return Append(position, rotation, scale, INVALID_INDEX);
+	}
+
+	Check(IsValid(parent));
+	if (!IsValid(parent)) { return INVALID_HANDLE; }
+
+	// ɒǉ[g͐eq̏Ԃ܂, q̏ꍇ͐e̕؂̊OɕԂߕבւKvł.
+	_isOrderDirty = true;
+	return Append(position, rotation, scale, _denseIndices[parent]);
+}
+
+/*!**********************************************************************
+*  @brief     m[hƂ̎qSč폜܂. q̃nh̎_ŖɂȂ܂.
+*  @param[in] const Handle 폜m[h
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::Destroy(const Handle handle)
+{
+	if (!IsValid(handle)) { return; }
+
+	// qA͈͂ƂĎo, ԂĂꍇ͐ɕבւ܂.
+	// 폜҂̃m[h͔͈͂Ɏc܂܈t邾̂, č폜Ăבւ͋N܂.
+	if (_isOrderDirty) { RebuildOrder(); }
+
+	const uint32 begin = _denseIndices[handle];
+	const uint32 end   = _subtreeEnds[begin];
+	for (uint32 i = begin; i < end; ++i)
+	{
+		if (_flags[i] & FLAG_REMOVED) { continue; }
+
+		_flags[i] |= FLAG_REMOVED;
+		_denseIndices[_handles[i]] = INVALID_INDEX;
+		_freeHandles.Push(_handles[i]);
+	}
+
+	_hasRemoved = true;
+}
+
+/*!**********************************************************************
+*  @brief     eύX܂. g̎qeɎw肵ꍇ͏z邽ߎs܂.
+*  @param[in] const Handle Ώۂ̃m[h
+*  @param[in] const Handle Ve ([gƂꍇINVALID_HANDLE)
+*  @return    bool ύXłꍇtrue
+*************************************************************************/
+bool TransformHierarchy::SetParent(const Handle handle, const Handle parent)
+{
+	if (!IsValid(handle)) { return false; }
+	if (parent != INVALID_HANDLE && !IsValid(parent)) { return false; }
+
+	const uint32 index       = _denseIndices[handle];
+	const uint32 parentIndex = parent == INVALID_HANDLE ? INVALID_INDEX : _denseIndices[parent];
+	if (_parentIndices[index] == parentIndex) { return true; }
+
+	// VȇcɎg܂܂ĂΏz܂
+	for (uint32 i = parentIndex; i != INVALID_INDEX; i = _parentIndices[i])
+	{
+		if (i == index) { return false; }
+	}
+
+	_parentIndices[index] = parentIndex;
+	_flags[index]        |= FLAG_WORLD_DIRTY;
+	_isOrderDirty         = true;
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     [J̈ʒuݒ肵܂.
+*  @param[in] const Handle Ώۂ̃m[h
+*  @param[in] const Float3& [J̈ʒu
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::SetLocalPosition(const Handle handle, const Float3& position)
+{
+	const uint32 index = GetDenseIndex(handle);
+	_positions[index] = position;
+	_flags[index]    |= FLAG_LOCAL_DIRTY;
+}
+
+/*!**********************************************************************
+*  @brief     [J̉]ݒ肵܂.
+*  @param[in] const Handle Ώۂ̃m[h
+*  @param[in] const Float4& [J̉] (Kς݂̃NH[^jI x, y, z, w)
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::SetLocalRotation(const Handle handle, const Float4& rotation)
+{
+	const uint32 index = GetDenseIndex(handle);
+	_rotations[index] = rotation;
+	_flags[index]    |= FLAG_LOCAL_DIRTY;
+}
+
+/*!**********************************************************************
+*  @brief     [J̊g嗦ݒ肵܂.
+*  @param[in] const Handle Ώۂ̃m[h
+*  @param[in] const Float3& [J̊g嗦
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::SetLocalScale(const Handle handle, const Float3& scale)
+{
+	const uint32 index = GetDenseIndex(handle);
+	_scales[index] = scale;
+	_flags[index] |= FLAG_LOCAL_DIRTY;
+}
+
+/*!**********************************************************************
+*  @brief     [J̈ʒu, ], g嗦܂Ƃ߂Đݒ肵܂.
+*  @param[in] const Handle Ώۂ̃m[h
+*  @param[in] const Float3& [J̈ʒu
+*  @param[in] const Float4& [J̉] (Kς݂̃NH[^jI x, y, z, w)
+*  @param[in] const Float3& [J̊g嗦
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::SetLocal(const Handle handle, const Float3& position, const Float4& rotation, const Float3& scale)
+{
+	const uint32 index = GetDenseIndex(handle);
+	_positions[index] = position;
+	_rotations[index] = rotation;
+	_scales   [index] = scale;
+	_flags    [index] |= FLAG_LOCAL_DIRTY;
+}
+
+/*!**********************************************************************
+*  @brief     ύX̂m[hƂ̎q̃[Js, [hsČvZ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::Update()
+{
+	if (_isOrderDirty || _hasRemoved) { RebuildOrder(); }
+	if (_handles.IsEmpty()) { return; }
+
+	const UpdateContext context =
+	{
+		_parentIndices.Data(), _flags.Data(), _positions.Data(), _rotations.Data(), _scales.Data(), _localMatrices.Data(), _worldMatrices.Data()
+	};
+
+	UPDATE_RANGE_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())](context, 0, static_cast<uint32>(_handles.Size()));
+}
+
+/*!**********************************************************************
+*  @brief     UpdateXbhōs܂. @n
+*             傫ȕ؂͍̃m[hɍXV, q̕؂ʃ^XNɕ܂.
+*  @param[in] gu::ThreadPool& sXbhv[
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::Update(gu::ThreadPool& threadPool)
+{
+	const uint32 threadCount = threadPool.GetThreadCount();
+	if (threadCount <= 1 || _handles.Size() < 2ull * MIN_NODES_PER_TASK)
+	{
+		Update();
+		return;
+	}
+
+	if (_isOrderDirty || _hasRemoved) { RebuildOrder(); }
+
+	// Ԃ̕΂ς, Xbh葽߂ɕ܂.
+	const uint32 taskCount = threadCount * 4;
+	if (_parallelTaskCount != taskCount) { BuildParallelPartition(taskCount); }
+
+	const UpdateContext context =
+	{
+		_parentIndices.Data(), _flags.Data(), _positions.Data(), _rotations.Data(), _scales.Data(), _localMatrices.Data(), _worldMatrices.Data()
+	};
+	const UpdateRangeFunction function = UPDATE_RANGE_FUNCTIONS[static_cast<uint8>(CPUFeature::GetActive())];
+
+	// ͈͂̊OɂcɍXV܂. (z̏Ԃŕł邽, eɏ܂)
+	for (uint64 i = 0; i < _parallelSerialNodes.Size(); ++i)
+	{
+		function(context, _parallelSerialNodes[i], _parallelSerialNodes[i] + 1);
+	}
+
+	std::vector<std::future<void>> futures;
+	futures.reserve(_parallelRanges.Size() / 2);
+	for (uint64 i = 0; i < _parallelRanges.Size(); i += 2)
+	{
+		const uint32 begin = _parallelRanges[i];
+		const uint32 end   = _parallelRanges[i + 1];
+		futures.push_back(threadPool.Submit([function, context, begin, end]() { function(context, begin, end); }));
+	}
+
+	for (auto& future : futures) { future.get(); }
+}
+
+/*!**********************************************************************
+*  @brief     ̈OɊmۂ܂.
+*  @param[in] const gu::uint64 m[h
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::Reserve(const gu::uint64 capacity)
+{
+	_handles      .Reserve(capacity);
+	_parentIndices.Reserve(capacity);
+	_subtreeEnds  .Reserve(capacity);
+	_flags        .Reserve(capacity);
+	_positions    .Reserve(capacity);
+	_rotations    .Reserve(capacity);
+	_scales       .Reserve(capacity);
+	_localMatrices.Reserve(capacity);
+	_worldMatrices.Reserve(capacity);
+	_denseIndices .Reserve(capacity);
+}
+
+/*!**********************************************************************
+*  @brief     SẴm[h폜܂. sς݂̃nh͑SĖɂȂ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::Clear()
+{
+	_handles      .Clear();
+	_parentIndices.Clear();
+	_subtreeEnds  .Clear();
+	_flags        .Clear();
+	_positions    .Clear();
+	_rotations    .Clear();
+	_scales       .Clear();
+	_localMatrices.Clear();
+	_worldMatrices.Clear();
+	_denseIndices .Clear();
+	_freeHandles  .Clear();
+	_parallelSerialNodes.Clear();
+	_parallelRanges     .Clear();
+	_parallelTaskCount = 0;
+	_isOrderDirty      = false;
+	_hasRemoved        = false;
+}
+#pragma endregion Public Function
+
+#pragma region Public Property
+/*!**********************************************************************
+*  @brief     ẽnhԂ܂. [g̏ꍇINVALID_HANDLEł.
+*  @param[in] const Handle Ώۂ̃m[h
+*  @return    Handle
+*************************************************************************/
+TransformHierarchy::Handle TransformHierarchy::GetParent(const Handle handle) const
+{
+	const uint32 parentIndex = _parentIndices[GetDenseIndex(handle)];
+	return parentIndex == INVALID_INDEX ? INVALID_HANDLE : _handles[parentIndex];
+}
+#pragma endregion Public Property
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     eqOɗ悤ɕבւ, 폜҂̃m[h菜܂. @n
+*             [D̍sɕׂ邽, em[h̎q͎g̒ɘAĕт܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::RebuildOrder()
+{
+	const uint32 oldCount = static_cast<uint32>(_handles.Size());
+
+	/*-------------------------------------------------------------------
+	-           q̈ꗗeƂɂ܂Ƃ߂܂ (offsets[i]`offsets[i + 1]i̎q)
+	---------------------------------------------------------------------*/
+	DynamicArray<uint32> offsets(oldCount + 1, 0u);
+	for (uint32 i = 0; i < oldCount; ++i)
+	{
+		if ((_flags[i] & FLAG_REMOVED) || _parentIndices[i] == INVALID_INDEX) { continue; }
+		++offsets[_parentIndices[i] + 1];
+	}
+	for (uint32 i = 0; i < oldCount; ++i) { offsets[i + 1] += offsets[i]; }
+
+	DynamicArray<uint32> children = {};
+	DynamicArray<uint32> cursors  = offsets;
+	children.Resize(offsets[oldCount], false);
+	for (uint32 i = 0; i < oldCount; ++i)
+	{
+		if ((_flags[i] & FLAG_REMOVED) || _parentIndices[i] == INVALID_INDEX) { continue; }
+		children[cursors[_parentIndices[i]]++] = i;
+	}
+
+	/*-------------------------------------------------------------------
+	-           [g[D̍sɕׂ܂ (Z̏Ԃ͌̕тۂ܂)
+	---------------------------------------------------------------------*/
+	DynamicArray<uint32> order = {};
+	DynamicArray<uint32> stack = {};
+	order.Reserve(oldCount);
+	for (uint32 root = 0; root < oldCount; ++root)
+	{
+		if ((_flags[root] & FLAG_REMOVED) || _parentIndices[root] != INVALID_INDEX) { continue; }
+
+		stack.Push(root);
+		while (!stack.IsEmpty())
+		{
+			const uint32 node = stack.Back();
+			stack.Pop();
+			order.Push(node);
+
+			for (uint32 c = offsets[node + 1]; c > offsets[node]; --c)
+			{
+				stack.Push(children[c - 1]);
+			}
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-           Vяɍ킹ĔzƃCfbNXu܂
+	---------------------------------------------------------------------*/
+	const uint32 newCount = static_cast<uint32>(order.Size());
+	DynamicArray<uint32> newIndices(oldCount, INVALID_INDEX);
+	for (uint32 i = 0; i < newCount; ++i) { newIndices[order[i]] = i; }
+
+	Permute(_handles      , order);
+	Permute(_parentIndices, order);
+	Permute(_flags        , order);
+	Permute(_positions    , order);
+	Permute(_rotations    , order);
+	Permute(_scales       , order);
+	Permute(_localMatrices, order);
+	Permute(_worldMatrices, order);
+
+	_subtreeEnds.Clear();
+	_subtreeEnds.Resize(newCount, false);
+	for (uint32 i = 0; i < newCount; ++i)
+	{
+		const uint32 parent = _parentIndices[i];
+		_parentIndices[i] = parent == INVALID_INDEX ? INVALID_INDEX : newIndices[parent];
+		_subtreeEnds  [i] = i + 1;
+		_denseIndices[_handles[i]] = i;
+	}
+
+	// q͐eɕԂ, e֕؂̏I[`܂.
+	for (uint32 i = newCount; i > 0; --i)
+	{
+		const uint32 parent = _parentIndices[i - 1];
+		if (parent != INVALID_INDEX && _subtreeEnds[parent] < _subtreeEnds[i - 1])
+		{
+			_subtreeEnds[parent] = _subtreeEnds[i - 1];
+		}
+	}
+
+	_isOrderDirty      = false;
+	_hasRemoved        = false;
+	_parallelTaskCount = 0;
+}
+
+/*!**********************************************************************
+*  @brief     XbhōXV邽߂̕쐬܂. @n
+*             ڕW̑傫ȉ̕؂ׂ͗荇̓m܂Ƃ߂1͈̔͂Ƃ, @n
+*             ڕW傫ȕ؂͍̃m[hɒPƂōXV, q̕؂ɕ܂.
+*  @param[in] const gu::uint32 ̖ڈ
+*  @return    void
+*************************************************************************/
+void TransformHierarchy::BuildParallelPartition(const gu::uint32 taskCount)
+{
+	_parallelSerialNodes.Clear();
+	_parallelRanges     .Clear();
+
+	const uint32 nodeCount   = static_cast<uint32>(_handles.Size());
+	const uint32 nodesPerTask = (nodeCount + taskCount - 1) / taskCount;
+	const uint32 targetSize   = nodesPerTask > MIN_NODES_PER_TASK ? nodesPerTask : MIN_NODES_PER_TASK;
+
+	uint32 rangeBegin = INVALID_INDEX;
+	uint32 rangeEnd   = INVALID_INDEX;
+	const auto flush = [&]()
+	{
+		if (rangeBegin == INVALID_INDEX) { return; }
+		_parallelRanges.Push(rangeBegin);
+		_parallelRanges.Push(rangeEnd);
+		rangeBegin = INVALID_INDEX;
+	};
+
+	uint32 i = 0;
+	while (i < nodeCount)
+	{
+		const uint32 end = _subtreeEnds[i];
+		if (end - i <= targetSize)
+		{
+			// O͈̔͂ƗאڂĂ, ܂Ƃ߂ĂڕW𒴂ȂΌ܂
+			if (rangeBegin != INVALID_INDEX && rangeEnd == i && end - rangeBegin <= targetSize)
+			{
+				rangeEnd = end;
+			}
+			else
+			{
+				flush();
+				rangeBegin = i;
+				rangeEnd   = end;
+			}
+			i = end;
+		}
+		else
+		{
+			// PƂōXV, ɕԍŏ̎q番𑱂܂
+			flush();
+			_parallelSerialNodes.Push(i);
+			++i;
+		}
+	}
+	flush();
+
+	_parallelTaskCount = taskCount;
+}
+
+/*!**********************************************************************
+*  @brief     m[hz̖ɒǉ܂.
+*  @param[in] const Float3& [J̈ʒu
+*  @param[in] const Float4& [J̉]
+*  @param[in] const Float3& [J̊g嗦
+*  @param[in] const gu::uint32 e̔z̃CfbNX
+*  @return    Handle
+*************************************************************************/
+TransformHierarchy::Handle TransformHierarchy::Append(const Float3& position, const Float4& rotation, const Float3& scale, const gu::uint32 parentIndex)
+{
+	const uint32 index = static_cast<uint32>(_handles.Size());
+
+	Handle handle = INVALID_HANDLE;
+	if (!_freeHandles.IsEmpty())
+	{
+		handle = _freeHandles.Back();
+		_freeHandles.Pop();
+		_denseIndices[handle] = index;
+	}
+	else
+	{
+		handle = static_cast<Handle>(_denseIndices.Size());
+		_denseIndices.Push(index);
+	}
+
+	_handles      .Push(handle);
+	_parentIndices.Push(parentIndex);
+	_subtreeEnds  .Push(index + 1);
+	_flags        .Push(FLAG_LOCAL_DIRTY);
+	_positions    .Push(position);
+	_rotations    .Push(rotation);
+	_scales       .Push(scale);
+	_localMatrices.Push(Float4x4());
+	_worldMatrices.Push(Float4x4());
+	_parallelTaskCount = 0;
+	return handle;
+}
+#pragma endregion Protected Function
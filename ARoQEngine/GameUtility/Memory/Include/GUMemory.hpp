@@ -2,6 +2,7 @@
 ///  @file   GUMemory.hpp
 ///  @brief  string.h̃bp[NXł. svinclude炵Ă邽, yʂł.@n
 ///          {NXł, ̑s܂. ̊m, , Rs[, ړ, r, [NAȂǂ̑삪\ł.@n
+///          GU_MEMORY_TRACKING_ENABLED1̏ꍇ, mۂXbhƂ̃^Oŕނ, ^OƂ̎gp, s[N, mۉ, \Z߂L^܂.@n
 ///  @author toide
 ///  @date   2023/12/02 23:07:20
 //////////////////////////////////////////////////////////////////////////////////
@@ -17,6 +18,17 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
+/*----------------------------------------------------------------------
+*  1ɂƊmۂƂ16bytẽwb_t, ^OƂ̎gpʂL^܂. @n
+*  0̏ꍇmalloc, free𒼐ڌĂяo, v̎擾֐͑S0Ԃ܂.
+*----------------------------------------------------------------------*/
+#ifndef GU_MEMORY_TRACKING_ENABLED
+	#if _DEBUG
+		#define GU_MEMORY_TRACKING_ENABLED (1)
+	#else
+		#define GU_MEMORY_TRACKING_ENABLED (0)
+	#endif
+#endif
 
 //////////////////////////////////////////////////////////////////////////////////
 //                               Class
@@ -24,6 +36,52 @@
 
 namespace gu
 {
+	/****************************************************************************
+	*				  			   MemoryTag
+	****************************************************************************/
+	/* @brief  mۂ̗pr\^Oł. MEMORY_TAG_SCOPEň͂񂾋Ԃ̊mۂɕt܂. @n
+	*          Rei╶͗prł͂Ȃߐp̃^O, mۂԂ̃^OɌvコ܂. @n
+	*          ^OǉꍇCountOf̑Oɒǉ, Memory::ToStringɂOǉĂ.
+	*****************************************************************************/
+	enum class MemoryTag : uint8
+	{
+		Default    = 0, //!< ^O̎wȂ
+		File       = 1, //!< t@C̓ǂݏp̃obt@
+		Graphics   = 2, //!< `p̃\[X (CPŮmۂ݂̂, GPU͊܂݂܂)
+		Physics    = 3, //!< Z
+		Audio      = 4, //!< 
+		GameObject = 5, //!< Q[IuWFNg
+		UI         = 6, //!< UI
+		Profiler   = 7, //!< vp̃c[
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			   MemoryStatistics
+	****************************************************************************/
+	/* @brief  ^OƂ̃gpʂ̓vł. Memory::GetStatisticsŎ擾_̒lێ܂.
+	*****************************************************************************/
+	struct MemoryStatistics
+	{
+		/*! @brief ݊mے̃oCg*/
+		uint64 LiveByteLength = 0;
+
+		/*! @brief mے̃oCg̍ől*/
+		uint64 PeakByteLength = 0;
+
+		/*! @brief ݊mے̌*/
+		uint64 LiveCount = 0;
+
+		/*! @brief NĂ̊mۉ (Reallocate܂݂܂)*/
+		uint64 TotalAllocationCount = 0;
+
+		/*! @brief NẲ*/
+		uint64 TotalFreeCount = 0;
+
+		/*! @brief gpʂ̗\Z (0̏ꍇ͗\ZȂ)*/
+		uint64 BudgetByteLength = 0;
+	};
+
 	/****************************************************************************
 	*				  			   GUMemory
 	****************************************************************************/
@@ -118,6 +176,62 @@ namespace gu
 		*************************************************************************/
 		static void FreeAligned(void* pointer);
 
+		#pragma region Tracking Function
+		/*!**********************************************************************
+		*  @brief     w肵^O̓v擾܂. 擾ɂXbh̊mۂ͐iނ, el͌ɓ̂̂ł͂܂.
+		*  @param[in] const MemoryTag ^O
+		*  @return    MemoryStatistics v
+		*************************************************************************/
+		static MemoryStatistics GetStatistics(const MemoryTag tag);
+
+		/*!**********************************************************************
+		*  @brief     SẴ^O̍v̓v擾܂. s[N̓^OƂ̃s[N̍vł͂Ȃ, Ŝ̃s[NԂ܂. @n
+		*             \Z̓^OƂɂ̂ݐݒ肳邽, BudgetByteLength0ɂȂ܂.
+		*  @param[in] void
+		*  @return    MemoryStatistics v
+		*************************************************************************/
+		static MemoryStatistics GetTotalStatistics();
+
+		/*!**********************************************************************
+		*  @brief     ^OƂ̎gpʂ̗\Zݒ肵܂. mۂɂ\Z𒴂ƂɈxxo, \Zɖ߂ƍĂьx܂.
+		*  @param[in] const MemoryTag ^O
+		*  @param[in] const uint64 \Z̃oCg (0ŗ\ZȂ)
+		*  @return    void
+		*************************************************************************/
+		static void SetBudget(const MemoryTag tag, const uint64 budgetByteLength);
+
+		/*!**********************************************************************
+		*  @brief     \Z𒴂ɌĂяo֐ݒ肵܂. nullptȑꍇ͕Wo͂Ɍx\܂. @n
+		*             mۂsXbhĂяo邽, ֐Memory::AllocateĂ΂Ȃł.
+		*  @param[in] BudgetExceededFunction Ăяo֐ (^O, ݂̎gp, \Z)
+		*  @return    void
+		*************************************************************************/
+		using BudgetExceededFunction = void(*)(const MemoryTag tag, const uint64 liveByteLength, const uint64 budgetByteLength);
+		static void SetBudgetExceededCallback(BudgetExceededFunction function);
+
+		/*!**********************************************************************
+		*  @brief     1̊mۂŃR[X^bNL^邩ݒ肵܂. L^mۂ͉܂ŕێ, @n
+		*             DumpStatisticsŃ[NƂďo͂܂. 0ŋL^܂.
+		*  @param[in] const uint32 L^̊Ԋu (1őSĂ̊mۂL^)
+		*  @return    void
+		*************************************************************************/
+		static void SetCallstackSampleRate(const uint32 everyNthAllocation);
+
+		/*!**********************************************************************
+		*  @brief     ^OƂ̓v, ĂȂL^ς݂̊mۂ̃R[X^bNeLXgŏo͂܂.
+		*  @param[in] const char* o͐̃t@CpX
+		*  @return    bool o͂ɐꍇtrue
+		*************************************************************************/
+		static bool DumpStatistics(const char* filePath);
+
+		/*!**********************************************************************
+		*  @brief     ĂяoXbhŌݗLȃ^Oݒ肵܂. ʏMEMORY_TAG_SCOPEĂяo܂.
+		*  @param[in] const MemoryTag ^O
+		*  @return    MemoryTag ݒ肷Õ^O
+		*************************************************************************/
+		static MemoryTag SetCurrentTag(const MemoryTag tag);
+		#pragma endregion Tracking Function
+
 		#pragma region Force Class Functiokn
 		/*!**********************************************************************
 		*  @brief     ftHgRXgN^IɌĂяo܂ @n
@@ -189,6 +303,16 @@ namespace gu
 		*  @return    bool [ɐݒ肳Ăꍇtrue, ȊOfalse
 		*************************************************************************/
 		static bool IsZero(const void* pointer, const uint64 byteLength);
+
+		/*!**********************************************************************
+		*  @brief     ĂяoXbhŌݗLȃ^OԂ܂.
+		*************************************************************************/
+		static MemoryTag GetCurrentTag();
+
+		/*!**********************************************************************
+		*  @brief     ^O̖OԂ܂.
+		*************************************************************************/
+		static const char* ToString(const MemoryTag tag);
 		#pragma endregion
 
 		#pragma region Public Constructor and Destructor
@@ -314,6 +438,41 @@ namespace gu
 		}
 	}
 #pragma endregion Implement
+
+	/****************************************************************************
+	*				  			   MemoryTagScope
+	****************************************************************************/
+	/* @brief  XR[v̊ԂĂяoXbh̃^O؂ւ, IɌ̃^O֖߂܂. @n
+	*          qɂꍇ͓̃^OD悳܂. MEMORY_TAG_SCOPE}NgpĂ.
+	*****************************************************************************/
+	class MemoryTagScope
+	{
+	public:
+		#pragma region Public Constructor and Destructor
+		explicit MemoryTagScope(const MemoryTag tag) : _previousTag(Memory::SetCurrentTag(tag)) {}
+
+		~MemoryTagScope() { Memory::SetCurrentTag(_previousTag); }
+
+		MemoryTagScope(const MemoryTagScope&) = delete;
+		MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		MemoryTag _previousTag = MemoryTag::Default;
+		#pragma endregion
+	};
 }
 
+/*----------------------------------------------------------------------
+*  XR[v̏I܂ł̊mۂɎw肵^Ot܂.
+*----------------------------------------------------------------------*/
+#if GU_MEMORY_TRACKING_ENABLED
+	#define MEMORY_TAG_CONCAT_IMPLEMENT(left, right) left##right
+	#define MEMORY_TAG_CONCAT(left, right) MEMORY_TAG_CONCAT_IMPLEMENT(left, right)
+	#define MEMORY_TAG_SCOPE(tag) gu::MemoryTagScope MEMORY_TAG_CONCAT(_memoryTagScope, __LINE__)(tag)
+#else
+	#define MEMORY_TAG_SCOPE(tag)
+#endif
+
 #endif
\ No newline at end of file
@@ -9,13 +9,225 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "../Include/GUMemory.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
 #include <string.h>
 #include <malloc.h>
+#if GU_MEMORY_TRACKING_ENABLED
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#if defined(_WIN32) || defined(_WIN64)
+#include <Windows.h>
+#elif defined(__has_include)
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#define GU_MEMORY_USE_EXECINFO (1)
+#endif
+#endif
+#endif
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
 using namespace gu;
 
+#if GU_MEMORY_TRACKING_ENABLED
+namespace
+{
+	/*---------------------------------------------------------------
+			mۂ̈̒Oɒuwb_ (16byte)
+			malloc16byteACgȂ悤, TCY16byteɑ܂.
+	-----------------------------------------------------------------*/
+	struct AllocationHeader
+	{
+		uint64    ByteLength = 0;     // p҂voCg
+		uint32    Offset     = 0;     // ۂ̊mې擪痘p҂̗̈܂ł̃oCg
+		MemoryTag Tag        = MemoryTag::Default;
+		uint8     IsSampled  = 0;     // R[X^bNL^mۂ
+		uint16    Magic      = 0;     // j, ďop
+	};
+	static_assert(sizeof(AllocationHeader) == 16, "AllocationHeader must be 16 bytes");
+
+	constexpr uint64 HEADER_SIZE       = sizeof(AllocationHeader);
+	constexpr uint16 HEADER_MAGIC      = 0xA110;
+	constexpr uint16 HEADER_FREED      = 0xDEAD;
+	constexpr uint32 MAX_STACK_DEPTH   = 16;
+	constexpr uint32 SKIP_STACK_FRAMES = 3; // CaptureCallstack, OnAllocated, Memory::Allocate*
+
+	/*---------------------------------------------------------------
+			^OƂ̃JE^. m, ͔Cӂ̃Xbhs邽ߑSatomicł.
+			mے̌͊mۉ񐔂Ɖ񐔂̍狁, 1̊mۂōXVatomic炵Ă܂.
+	-----------------------------------------------------------------*/
+	struct alignas(64) TagCounter
+	{
+		std::atomic<uint64> LiveByteLength   = 0;
+		std::atomic<uint64> PeakByteLength   = 0;
+		std::atomic<uint64> AllocationCount  = 0;
+		std::atomic<uint64> FreeCount        = 0;
+		std::atomic<uint64> BudgetByteLength = 0;
+		std::atomic_bool    IsOverBudget     = false;
+	};
+
+	/*---------------------------------------------------------------
+			R[X^bNL^m
+	-----------------------------------------------------------------*/
+	struct SampledAllocation
+	{
+		uint64    ByteLength = 0;
+		uint64    Sequence   = 0;
+		MemoryTag Tag        = MemoryTag::Default;
+		uint32    FrameCount = 0;
+		void*     Frames[MAX_STACK_DEPTH] = {};
+	};
+
+	/*---------------------------------------------------------------
+			L^̏
+			ÓIϐ̔jɉsĂQƂł悤, Ԃ͉܂.
+	-----------------------------------------------------------------*/
+	struct TrackingState
+	{
+		TagCounter          Counters[static_cast<uint32>(MemoryTag::CountOf)];
+		alignas(64) std::atomic<uint64> TotalLiveByteLength = 0;
+		std::atomic<uint64> TotalPeakByteLength = 0;
+		std::atomic<uint32> SampleRate          = 0;
+		std::atomic<uint64> SampleSequence      = 0;
+		std::atomic<Memory::BudgetExceededFunction> BudgetExceededCallback = nullptr;
+
+		std::mutex SampleMutex;
+		std::unordered_map<const void*, SampledAllocation> Samples;
+	};
+
+	TrackingState& GetState()
+	{
+		static TrackingState* state = new TrackingState();
+		return *state;
+	}
+
+	thread_local MemoryTag t_currentTag       = MemoryTag::Default;
+	thread_local uint32    t_sampleCountdown  = 0;
+
+	/*---------------------------------------------------------------
+			atomicȍől̍XV
+	-----------------------------------------------------------------*/
+	void UpdatePeak(std::atomic<uint64>& peak, const uint64 value)
+	{
+		uint64 current = peak.load(std::memory_order_relaxed);
+		while (current < value && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+	}
+
+	/*---------------------------------------------------------------
+			\Zߎ̊̌x
+	-----------------------------------------------------------------*/
+	void PrintBudgetExceeded(const MemoryTag tag, const uint64 liveByteLength, const uint64 budgetByteLength)
+	{
+		std::printf("[Memory] %s exceeded its budget: %llu / %llu bytes\n", Memory::ToString(tag),
+			static_cast<unsigned long long>(liveByteLength), static_cast<unsigned long long>(budgetByteLength));
+	}
+
+	/*---------------------------------------------------------------
+			ĂяõR[X^bN擾܂
+	-----------------------------------------------------------------*/
+	uint32 CaptureCallstack(void** frames)
+	{
+	#if defined(_WIN32) || defined(_WIN64)
+		return static_cast<uint32>(::RtlCaptureStackBackTrace(SKIP_STACK_FRAMES, MAX_STACK_DEPTH, frames, nullptr));
+	#elif defined(GU_MEMORY_USE_EXECINFO)
+		void* buffer[MAX_STACK_DEPTH + SKIP_STACK_FRAMES] = {};
+		const int count = ::backtrace(buffer, static_cast<int>(MAX_STACK_DEPTH + SKIP_STACK_FRAMES));
+		if (count <= static_cast<int>(SKIP_STACK_FRAMES)) { return 0; }
+		const uint32 frameCount = static_cast<uint32>(count) - SKIP_STACK_FRAMES;
+		memcpy(frames, buffer + SKIP_STACK_FRAMES, sizeof(void*) * frameCount);
+		return frameCount;
+	#else
+		(void)frames;
+		return 0;
+	#endif
+	}
+
+	/*---------------------------------------------------------------
+			mۂ̋L^. \Z𒴂ꍇ͒_ňxʒm܂.
+	-----------------------------------------------------------------*/
+	void OnAllocated(AllocationHeader* header, const void* user, const uint64 byteLength, const MemoryTag tag)
+	{
+		header->ByteLength = byteLength;
+		header->Tag        = tag;
+		header->IsSampled  = 0;
+		header->Magic      = HEADER_MAGIC;
+
+		auto& state   = GetState();
+		auto& counter = state.Counters[static_cast<uint32>(tag)];
+
+		const uint64 live = counter.LiveByteLength.fetch_add(byteLength, std::memory_order_relaxed) + byteLength;
+		counter.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+		UpdatePeak(counter.PeakByteLength, live);
+		UpdatePeak(state.TotalPeakByteLength, state.TotalLiveByteLength.fetch_add(byteLength, std::memory_order_relaxed) + byteLength);
+
+		const uint64 budget = counter.BudgetByteLength.load(std::memory_order_relaxed);
+		if (budget != 0 && live > budget && !counter.IsOverBudget.exchange(true, std::memory_order_relaxed))
+		{
+			const auto callback = state.BudgetExceededCallback.load(std::memory_order_relaxed);
+			(callback ? callback : PrintBudgetExceeded)(tag, live, budget);
+		}
+
+		/*-------------------------------------------------------------------
+		-      ԊuƂɃR[X^bNL^ (XbhƂ̃JEg_EŃbN܂)
+		---------------------------------------------------------------------*/
+		const uint32 sampleRate = state.SampleRate.load(std::memory_order_relaxed);
+		if (sampleRate == 0) { return; }
+
+		if (t_sampleCountdown == 0 || t_sampleCountdown > sampleRate) { t_sampleCountdown = sampleRate; }
+		if (--t_sampleCountdown != 0) { return; }
+
+		SampledAllocation sample = {};
+		sample.ByteLength = byteLength;
+		sample.Tag        = tag;
+		sample.Sequence   = state.SampleSequence.fetch_add(1, std::memory_order_relaxed);
+		sample.FrameCount = CaptureCallstack(sample.Frames);
+
+		std::scoped_lock lock(state.SampleMutex);
+		state.Samples[user] = sample;
+		header->IsSampled   = 1;
+	}
+
+	/*---------------------------------------------------------------
+			̋L^. ^O͊mێ̂̂gp܂.
+	-----------------------------------------------------------------*/
+	void OnFreed(AllocationHeader* header, const void* user)
+	{
+		Check(header->Magic == HEADER_MAGIC); // d, ܂Memory::AllocateȊOŊmۂ̈
+
+		auto& state   = GetState();
+		auto& counter = state.Counters[static_cast<uint32>(header->Tag)];
+
+		const uint64 live = counter.LiveByteLength.fetch_sub(header->ByteLength, std::memory_order_relaxed) - header->ByteLength;
+		counter.FreeCount.fetch_add(1, std::memory_order_relaxed);
+		state.TotalLiveByteLength.fetch_sub(header->ByteLength, std::memory_order_relaxed);
+
+		const uint64 budget = counter.BudgetByteLength.load(std::memory_order_relaxed);
+		if ((budget == 0 || live <= budget) && counter.IsOverBudget.load(std::memory_order_relaxed))
+		{
+			counter.IsOverBudget.store(false, std::memory_order_relaxed);
+		}
+
+		if (header->IsSampled)
+		{
+			std::scoped_lock lock(state.SampleMutex);
+			state.Samples.erase(user);
+		}
+		header->Magic = HEADER_FREED;
+	}
+
+	/*---------------------------------------------------------------
+			p҂̃|C^wb_擾܂
+	-----------------------------------------------------------------*/
+	AllocationHeader* GetHeader(void* user)
+	{
+		return reinterpret_cast<AllocationHeader*>(static_cast<uint8*>(user) - HEADER_SIZE);
+	}
+}
+#endif
+
 //////////////////////////////////////////////////////////////////////////////////
 //                             Implement
 //////////////////////////////////////////////////////////////////////////////////
@@ -100,28 +312,319 @@ bool Memory::IsZero(const void* pointer, const uint64 byteLength)
 	return true;
 }
 
+/*!**********************************************************************
+*  @brief     RXgN^ĂяoƂȂ̈悾mۂ܂ (Malloc)
+*  @param[in] const uint64 mۂ镶
+*  @return    void* mۂ̐擪AhX
+*************************************************************************/
 void* Memory::Allocate(const uint64 byteLength)
 {
+#if GU_MEMORY_TRACKING_ENABLED
+	uint8* base = static_cast<uint8*>(::malloc(byteLength + HEADER_SIZE));
+	if (base == nullptr) { return nullptr; }
+
+	void* user = base + HEADER_SIZE;
+	AllocationHeader* header = GetHeader(user);
+	header->Offset = static_cast<uint32>(HEADER_SIZE);
+	OnAllocated(header, user, byteLength, t_currentTag);
+	return user;
+#else
 	return ::malloc(byteLength);
+#endif
 }
 
+/*!**********************************************************************
+*  @brief     ̈Ċ蓖Ă܂. L^LɂĂꍇ, ^O͍ŏɊmۂ̂̂p܂.
+*  @param[in] void* Ċ蓖Ă郁̐擪AhX
+*  @param[in] const uint64 mۂoCg
+*  @return    void* Ċmۂ̐擪AhX
+*************************************************************************/
 void* Memory::Reallocate(void* pointer, const uint64 byteLength)
 {
+#if GU_MEMORY_TRACKING_ENABLED
+	if (pointer == nullptr) { return Allocate(byteLength); }
+	if (byteLength == 0)    { Free(pointer); return nullptr; }
+
+	AllocationHeader* header = GetHeader(pointer);
+	Check(header->Offset == HEADER_SIZE); // AllocateAlignedŊmۂ͍̈Ċ蓖Ăł܂
+
+	const uint64    oldByteLength = header->ByteLength;
+	const MemoryTag tag           = header->Tag;
+	OnFreed(header, pointer);
+
+	uint8* base = static_cast<uint8*>(::realloc(header, byteLength + HEADER_SIZE));
+	if (base == nullptr)
+	{
+		// ̗͎̈cĂ邽, L^߂܂
+		OnAllocated(header, pointer, oldByteLength, tag);
+		return nullptr;
+	}
+
+	void* user = base + HEADER_SIZE;
+	OnAllocated(GetHeader(user), user, byteLength, tag);
+	return user;
+#else
 	return realloc(pointer, byteLength);
+#endif
 }
 
+/*!**********************************************************************
+*  @brief     RXgN^ĂяoƂȂ̈悾mۂ܂ (Malloc) ACgwł܂.
+*  @param[in] const uint64 mۂ镶
+*  @param[in] const uint64 ACg (2̗ݏ)
+*  @return    void* mۂ̐擪AhX
+*************************************************************************/
 void* Memory::AllocateAligned(const uint64 byteLength, const uint64 alignment)
 {
+#if GU_MEMORY_TRACKING_ENABLED
+	// wb_uĂp҂̗̈悪ACg𖞂悤, ACg̔{炵܂
+	const uint64 offset = alignment > HEADER_SIZE ? alignment : HEADER_SIZE;
+
+	uint8* base = static_cast<uint8*>(::_aligned_malloc(byteLength + offset, alignment));
+	if (base == nullptr) { return nullptr; }
+
+	void* user = base + offset;
+	AllocationHeader* header = GetHeader(user);
+	header->Offset = static_cast<uint32>(offset);
+	OnAllocated(header, user, byteLength, t_currentTag);
+	return user;
+#else
 	return ::_aligned_malloc(byteLength, alignment);
+#endif
 }
 
+/*!**********************************************************************
+*  @brief     fXgN^ĂяoƂȂ̈悾j܂ (Free)
+*  @param[in] void* j郁̐擪AhX
+*  @return    void
+*************************************************************************/
 void Memory::Free(void* pointer)
 {
+#if GU_MEMORY_TRACKING_ENABLED
+	if (pointer == nullptr) { return; }
+
+	AllocationHeader* header = GetHeader(pointer);
+	Check(header->Offset == HEADER_SIZE); // AllocateAlignedŊmۂ̈FreeAlignedŉĂ
+	OnFreed(header, pointer);
+	::free(header);
+#else
 	::free(pointer);
+#endif
 }
 
+/*!**********************************************************************
+*  @brief     AllocateAlignedŊmۂ̈j܂.
+*  @param[in] void* j郁̐擪AhX
+*  @return    void
+*************************************************************************/
 void Memory::FreeAligned(void* pointer)
 {
+#if GU_MEMORY_TRACKING_ENABLED
+	if (pointer == nullptr) { return; }
+
+	AllocationHeader* header = GetHeader(pointer);
+	const uint32 offset = header->Offset;
+	OnFreed(header, pointer);
+	::_aligned_free(static_cast<uint8*>(pointer) - offset);
+#else
 	::_aligned_free(pointer);
+#endif
+}
+#pragma endregion Main Function
+
+#pragma region Tracking Function
+/*!**********************************************************************
+*  @brief     w肵^O̓v擾܂.
+*  @param[in] const MemoryTag ^O
+*  @return    MemoryStatistics v
+*************************************************************************/
+MemoryStatistics Memory::GetStatistics([[maybe_unused]] const MemoryTag tag)
+{
+	MemoryStatistics statistics = {};
+#if GU_MEMORY_TRACKING_ENABLED
+	const auto& counter = GetState().Counters[static_cast<uint32>(tag)];
+	statistics.LiveByteLength       = counter.LiveByteLength  .load(std::memory_order_relaxed);
+	statistics.PeakByteLength       = counter.PeakByteLength  .load(std::memory_order_relaxed);
+	statistics.TotalFreeCount       = counter.FreeCount       .load(std::memory_order_relaxed); // 񐔂ɓǂ, mے̌ɂȂȂ悤ɂ܂
+	statistics.TotalAllocationCount = counter.AllocationCount .load(std::memory_order_relaxed);
+	statistics.LiveCount            = statistics.TotalAllocationCount - statistics.TotalFreeCount;
+	statistics.BudgetByteLength     = counter.BudgetByteLength.load(std::memory_order_relaxed);
+#endif
+	return statistics;
+}
+
+/*!**********************************************************************
+*  @brief     SẴ^O̍v̓v擾܂.
+*  @param[in] void
+*  @return    MemoryStatistics v
+*************************************************************************/
+MemoryStatistics Memory::GetTotalStatistics()
+{
+	MemoryStatistics total = {};
+#if GU_MEMORY_TRACKING_ENABLED
+	for (uint32 i = 0; i < static_cast<uint32>(MemoryTag::CountOf); ++i)
+	{
+		const auto statistics = GetStatistics(static_cast<MemoryTag>(i));
+		total.LiveByteLength       += statistics.LiveByteLength;
+		total.LiveCount            += statistics.LiveCount;
+		total.TotalAllocationCount += statistics.TotalAllocationCount;
+		total.TotalFreeCount       += statistics.TotalFreeCount;
+	}
+	total.PeakByteLength = GetState().TotalPeakByteLength.load(std::memory_order_relaxed);
+#endif
+	return total;
+}
+
+/*!**********************************************************************
+*  @brief     ^OƂ̎gpʂ̗\Zݒ肵܂.
+*  @param[in] const MemoryTag ^O
+*  @param[in] const uint64 \Z̃oCg (0ŗ\ZȂ)
+*  @return    void
+*************************************************************************/
+void Memory::SetBudget([[maybe_unused]] const MemoryTag tag, [[maybe_unused]] const uint64 budgetByteLength)
+{
+#if GU_MEMORY_TRACKING_ENABLED
+	auto& counter = GetState().Counters[static_cast<uint32>(tag)];
+	counter.BudgetByteLength.store(budgetByteLength, std::memory_order_relaxed);
+	counter.IsOverBudget    .store(false, std::memory_order_relaxed);
+#endif
+}
+
+/*!**********************************************************************
+*  @brief     \Z𒴂ɌĂяo֐ݒ肵܂.
+*  @param[in] BudgetExceededFunction Ăяo֐
+*  @return    void
+*************************************************************************/
+void Memory::SetBudgetExceededCallback([[maybe_unused]] BudgetExceededFunction function)
+{
+#if GU_MEMORY_TRACKING_ENABLED
+	GetState().BudgetExceededCallback.store(function, std::memory_order_relaxed);
+#endif
+}
+
+/*!**********************************************************************
+*  @brief     1̊mۂŃR[X^bNL^邩ݒ肵܂.
+*  @param[in] const uint32 L^̊Ԋu (0ŋL^Ȃ)
+*  @return    void
+*************************************************************************/
+void Memory::SetCallstackSampleRate([[maybe_unused]] const uint32 everyNthAllocation)
+{
+#if GU_MEMORY_TRACKING_ENABLED
+	GetState().SampleRate.store(everyNthAllocation, std::memory_order_relaxed);
+#endif
+}
+
+/*!**********************************************************************
+*  @brief     ^OƂ̓v, ĂȂL^ς݂̊mۂ̃R[X^bNeLXgŏo͂܂.
+*  @param[in] const char* o͐̃t@CpX
+*  @return    bool o͂ɐꍇtrue
+*************************************************************************/
+bool Memory::DumpStatistics([[maybe_unused]] const char* filePath)
+{
+#if GU_MEMORY_TRACKING_ENABLED
+	if (filePath == nullptr) { return false; }
+
+	/*-------------------------------------------------------------------
+	-      L^ς݂̊mۂɕ, ݒ̓bNێ܂
+	---------------------------------------------------------------------*/
+	auto& state = GetState();
+	std::vector<SampledAllocation> samples;
+	{
+		std::scoped_lock lock(state.SampleMutex);
+		samples.reserve(state.Samples.size());
+		for (const auto& [pointer, sample] : state.Samples) { samples.push_back(sample); }
+	}
+
+	FILE* file = nullptr;
+#if defined(_MSC_VER)
+	if (fopen_s(&file, filePath, "wb") != 0) { file = nullptr; }
+#else
+	file = std::fopen(filePath, "wb");
+#endif
+	if (file == nullptr) { return false; }
+
+	const auto printRow = [file](const char* name, const MemoryStatistics& statistics)
+	{
+		std::fprintf(file, "%-12s %16llu %16llu %12llu %14llu %14llu %16llu%s\n", name,
+			static_cast<unsigned long long>(statistics.LiveByteLength),
+			static_cast<unsigned long long>(statistics.PeakByteLength),
+			static_cast<unsigned long long>(statistics.LiveCount),
+			static_cast<unsigned long long>(statistics.TotalAllocationCount),
+			static_cast<unsigned long long>(statistics.TotalFreeCount),
+			static_cast<unsigned long long>(statistics.BudgetByteLength),
+			statistics.BudgetByteLength != 0 && statistics.LiveByteLength > statistics.BudgetByteLength ? "  OVER BUDGET" : "");
+	};
+
+	std::fprintf(file, "%-12s %16s %16s %12s %14s %14s %16s\n", "Tag", "LiveBytes", "PeakBytes", "LiveCount", "Allocations", "Frees", "BudgetBytes");
+	for (uint32 i = 0; i < static_cast<uint32>(MemoryTag::CountOf); ++i)
+	{
+		printRow(ToString(static_cast<MemoryTag>(i)), GetStatistics(static_cast<MemoryTag>(i)));
+	}
+	printRow("Total", GetTotalStatistics());
+
+	std::fprintf(file, "\nSampled live allocations (1 in %u): %llu\n", state.SampleRate.load(std::memory_order_relaxed),
+		static_cast<unsigned long long>(samples.size()));
+	for (const auto& sample : samples)
+	{
+		std::fprintf(file, "#%llu %s %llu bytes\n", static_cast<unsigned long long>(sample.Sequence), ToString(sample.Tag),
+			static_cast<unsigned long long>(sample.ByteLength));
+		for (uint32 i = 0; i < sample.FrameCount; ++i)
+		{
+			std::fprintf(file, "    %p\n", sample.Frames[i]);
+		}
+	}
+
+	std::fclose(file);
+	return true;
+#else
+	return false;
+#endif
+}
+
+/*!**********************************************************************
+*  @brief     ĂяoXbhŌݗLȃ^Oݒ肵܂.
+*  @param[in] const MemoryTag ^O
+*  @return    MemoryTag ݒ肷Õ^O
+*************************************************************************/
+MemoryTag Memory::SetCurrentTag([[maybe_unused]] const MemoryTag tag)
+{
+#if GU_MEMORY_TRACKING_ENABLED
+	const MemoryTag previous = t_currentTag;
+	t_currentTag = tag;
+	return previous;
+#else
+	return MemoryTag::Default;
+#endif
+}
+
+/*!**********************************************************************
+*  @brief     ĂяoXbhŌݗLȃ^OԂ܂.
+*************************************************************************/
+MemoryTag Memory::GetCurrentTag()
+{
+#if GU_MEMORY_TRACKING_ENABLED
+	return t_currentTag;
+#else
+	return MemoryTag::Default;
+#endif
+}
+
+/*!**********************************************************************
+*  @brief     ^O̖OԂ܂.
+*************************************************************************/
+const char* Memory::ToString(const MemoryTag tag)
+{
+	switch (tag)
+	{
+		case MemoryTag::Default   : return "Default";
+		case MemoryTag::File      : return "File";
+		case MemoryTag::Graphics  : return "Graphics";
+		case MemoryTag::Physics   : return "Physics";
+		case MemoryTag::Audio     : return "Audio";
+		case MemoryTag::GameObject: return "GameObject";
+		case MemoryTag::UI        : return "UI";
+		case MemoryTag::Profiler  : return "Profiler";
+		default                   : return "Unknown";
+	}
 }
-#pragma endregion Main Function
\ No newline at end of file
+#pragma endregion Tracking Function
@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GUFramePipeline.hpp
+///  @brief  XVXbhƕ`Xbh̊ԂŃt[󂯓n߂̃pCvCł. @n
+///          XVXbhK̃XibvVbgobt@̂1Ƀt[N, `Xbh͓Ƀt[N-1ǂݍ݂܂. @n
+///          󂯓n͏ݍς, ǂݍݍς݂̃t[tFXlƂSemaphoreōs, ҋ@̓XbhubN܂.
+///  @author toide
+///  @date   2026/10/20 3:12:40
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GU_FRAME_PIPELINE_HPP
+#define GU_FRAME_PIPELINE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GUSemaphore.hpp"
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	/****************************************************************************
+	*				  			   FramePipeline
+	****************************************************************************/
+	/* @brief  1̏݃Xbh1̓ǂݍ݃Xbh̊Ԃ, K̃obt@ԂɎ󂯓n܂. @n
+	*          t[N̓obt@ N % K ɏ܂, ǂݍ݃Xbh͑SẴt[܂ꂽԂɎ󂯎܂. @n
+	*          K = 1̏ꍇ͏݂Ɠǂݍ݂݂Ɏs, K >= 2̏ꍇ͏݂őK - 1t[s܂. @n
+	*          obt@̎̂͗p҂ێ, {NXBegin*ŕԂCfbNX̔rǗ܂.
+	*****************************************************************************/
+	class FramePipeline : public NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ݐ̃obt@󂭂܂ő҂, ̃CfbNXԂ܂. ݃XbhĂяoĂ.
+		*  @param[out] uint32& ݐ̃obt@̃CfbNX
+		*  @return    bool StopĂ΂Ăꍇfalse
+		*************************************************************************/
+		bool BeginWrite(uint32& bufferIndex);
+
+		/*!**********************************************************************
+		*  @brief     BeginWriteŎ擾obt@ւ݂̏, ǂݍ݃Xbh֓n܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void EndWrite();
+
+		/*!**********************************************************************
+		*  @brief     ̃t[܂܂ő҂, ̃obt@̃CfbNXԂ܂. ǂݍ݃XbhĂяoĂ.
+		*  @param[out] uint32& ǂݍރobt@̃CfbNX
+		*  @return    bool StopĂ΂Ăꍇfalse
+		*************************************************************************/
+		bool BeginRead(uint32& bufferIndex);
+
+		/*!**********************************************************************
+		*  @brief     BeginReadŎ擾obt@̓ǂݍ݂, ݃Xbh֕ԋp܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void EndRead();
+
+		/*!**********************************************************************
+		*  @brief     w肵̃t[܂܂ő҂܂. , ǂݍ݈ȊÕXbht[̐isɍ킹đҋ@ꍇɎgp܂.
+		*  @param[in] const uint64 ҋ@鏑ݍς݂̃t[
+		*  @param[in] const int32 ^CAEg̃~b (̒l̏ꍇ͖)
+		*  @return    void
+		*************************************************************************/
+		void WaitForWrittenFrame(const uint64 frameCount, const int32 timeoutMilliSeconds = -1);
+
+		/*!**********************************************************************
+		*  @brief     ҋ@̑SẴXbhN, ȍ~Begin*falseŕԂ悤ɂ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Stop();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     obt@̐ (K) Ԃ܂.
+		*************************************************************************/
+		__forceinline uint32 GetBufferCount() const { return _bufferCount; }
+
+		/*!**********************************************************************
+		*  @brief     ݂t[Ԃ܂.
+		*************************************************************************/
+		__forceinline uint64 GetWrittenFrameCount() const { return _writtenSemaphore.GetCompletedValue(); }
+
+		/*!**********************************************************************
+		*  @brief     ǂݍ݂t[Ԃ܂.
+		*************************************************************************/
+		__forceinline uint64 GetReadFrameCount() const { return _readSemaphore.GetCompletedValue(); }
+
+		/*!**********************************************************************
+		*  @brief     StopĂ΂ꂽԂ܂.
+		*************************************************************************/
+		__forceinline bool IsStopped() const { return _isStopped.load(std::memory_order_acquire); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief obt@̐w肵č쐬܂ (0̏ꍇ1ƂĈ܂)*/
+		explicit FramePipeline(const uint32 bufferCount = 2) : _bufferCount(bufferCount == 0 ? 1 : bufferCount) {}
+
+		~FramePipeline() { Stop(); }
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ݂t[tFXlƂ܂*/
+		Semaphore _writtenSemaphore = {};
+
+		/*! @brief ǂݍ݂t[tFXlƂ܂*/
+		Semaphore _readSemaphore = {};
+
+		/*! @brief ɏރt[ԍ (݃Xbĥ݂ύX܂)*/
+		uint64 _writeFrame = 0;
+
+		/*! @brief ɓǂݍރt[ԍ (ǂݍ݃Xbĥ݂ύX܂)*/
+		uint64 _readFrame = 0;
+
+		/*! @brief obt@̐*/
+		uint32 _bufferCount = 2;
+
+		/*! @brief ~v*/
+		std::atomic_bool _isStopped = false;
+		#pragma endregion
+	};
+}
+
+#endif
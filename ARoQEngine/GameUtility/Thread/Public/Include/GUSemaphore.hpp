@@ -13,7 +13,9 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include <cstdint>
+#include <atomic>
 #include <mutex>
+#include <condition_variable>
 #include "GameUtility/Base/Include/GUOptional.hpp"
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -37,14 +39,14 @@ namespace gu
 		/****************************************************************************
 		**                Public Function
 		*****************************************************************************/
-		/* @brief : set the completed value and call something thread. */
+		/* @brief : set the completed value and wake all waiting threads. the value never decreases (smaller values are ignored). */
 		void Signal(const std::uint64_t value);
 
 		/* @brief : wait the thread until the value exceeds the completed value*/
 		void Wait(const std::uint64_t value, const gu::Optional<int> timeoutMilliSeconds = {});
 
 		/* @brief : return the desired completed value = wait value*/
-		std::uint64_t GetCompletedValue() const { return _completedValue; }
+		std::uint64_t GetCompletedValue() const { return _completedValue.load(std::memory_order_acquire); }
 
 		/****************************************************************************
 		**                Public Property
@@ -62,7 +64,7 @@ namespace gu
 		/****************************************************************************
 		**                Protected Property
 		*****************************************************************************/
-		std::uint64_t _completedValue = 0;
+		std::atomic<std::uint64_t> _completedValue = 0;
 
 		// ϐf[^\ɑ΂镡Xbh̓ANZX}~邽߂̃NX.
 		std::mutex _lockMutex = {};
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GUFramePipeline.cpp
+///  @brief  XVXbhƕ`Xbh̊ԂŃt[󂯓n߂̃pCvCł.
+///  @author toide
+///  @date   2026/10/20 3:12:40
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GUFramePipeline.hpp"
+#include <limits>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gu;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     ݐ̃obt@󂭂܂ő҂, ̃CfbNXԂ܂.
+*  @param[out] uint32& ݐ̃obt@̃CfbNX
+*  @return    bool StopĂ΂Ăꍇfalse
+*************************************************************************/
+bool FramePipeline::BeginWrite(uint32& bufferIndex)
+{
+	if (IsStopped()) { return false; }
+
+	/*-------------------------------------------------------------------
+	-      obt@ N % K Ogpt[ N - K ̓ǂݍ݊҂
+	---------------------------------------------------------------------*/
+	if (_writeFrame >= _bufferCount)
+	{
+		_readSemaphore.Wait(_writeFrame - _bufferCount + 1);
+	}
+
+	if (IsStopped()) { return false; }
+
+	bufferIndex = static_cast<uint32>(_writeFrame % _bufferCount);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     BeginWriteŎ擾obt@ւ݂̏, ǂݍ݃Xbh֓n܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void FramePipeline::EndWrite()
+{
+	++_writeFrame;
+	_writtenSemaphore.Signal(_writeFrame);
+}
+
+/*!**********************************************************************
+*  @brief     ̃t[܂܂ő҂, ̃obt@̃CfbNXԂ܂.
+*  @param[out] uint32& ǂݍރobt@̃CfbNX
+*  @return    bool StopĂ΂Ăꍇfalse
+*************************************************************************/
+bool FramePipeline::BeginRead(uint32& bufferIndex)
+{
+	if (IsStopped()) { return false; }
+
+	_writtenSemaphore.Wait(_readFrame + 1);
+
+	if (IsStopped()) { return false; }
+
+	bufferIndex = static_cast<uint32>(_readFrame % _bufferCount);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     BeginReadŎ擾obt@̓ǂݍ݂, ݃Xbh֕ԋp܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void FramePipeline::EndRead()
+{
+	++_readFrame;
+	_readSemaphore.Signal(_readFrame);
+}
+
+/*!**********************************************************************
+*  @brief     w肵̃t[܂܂ő҂܂.
+*  @param[in] const uint64 ҋ@鏑ݍς݂̃t[
+*  @param[in] const int32 ^CAEg̃~b (̒l̏ꍇ͖)
+*  @return    void
+*************************************************************************/
+void FramePipeline::WaitForWrittenFrame(const uint64 frameCount, const int32 timeoutMilliSeconds)
+{
+	if (IsStopped()) { return; }
+
+	if (timeoutMilliSeconds < 0) { _writtenSemaphore.Wait(frameCount); }
+	else                         { _writtenSemaphore.Wait(frameCount, timeoutMilliSeconds); }
+}
+
+/*!**********************************************************************
+*  @brief     ҋ@̑SẴXbhN, ȍ~Begin*falseŕԂ悤ɂ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void FramePipeline::Stop()
+{
+	if (_isStopped.exchange(true, std::memory_order_acq_rel)) { return; }
+
+	// tFXlőɂ邱Ƃ, ǂ̒l҂ĂXbhҋ@𔲂܂
+	_writtenSemaphore.Signal(std::numeric_limits<uint64>::max());
+	_readSemaphore   .Signal(std::numeric_limits<uint64>::max());
+}
+#pragma endregion Public Function
@@ -29,7 +29,8 @@ using namespace gu;
 ****************************************************************************/
 /* @fn        void Semaphore::Signal(const std::uint64_t value)
 *
-*  @brief     JE^[w̒lɍXV܂
+*  @brief     JE^[w̒lɍXV, ҋ@̑SẴXbhN܂. @n
+*             tFXlƂĒP邽, ݂̒l菬l͖܂.
 *
 *  @param[in] const std::uint64_t Xbh񍐂邽߂ɕKvȑ҂߂̒l
 *
@@ -41,10 +42,11 @@ void Semaphore::Signal(const std::uint64_t value)
 	std::unique_lock<std::mutex> lock(_lockMutex);
 	
 	// l̍XV
-	_completedValue = value;
+	if (value <= _completedValue.load(std::memory_order_relaxed)) { return; }
+	_completedValue.store(value, std::memory_order_release);
 
-	// XbhĂыN
-	_conditionVariable.notify_one();
+	// قȂl҂Xbhꍇ邽, SẴXbhĂыN
+	_conditionVariable.notify_all();
 }
 
 /****************************************************************************
@@ -17,6 +17,8 @@
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHITypeCore.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GraphicsCore/Engine/Include/ParallelCommandRecorder.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUUploadRing.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -38,6 +40,9 @@ public:
 	#pragma region Static Const
 	static constexpr gu::uint32 FRAME_BUFFER_COUNT = 3;
 
+	/*! @brief 1t[̃Abv[hO̗e [byte]*/
+	static constexpr gu::uint64 UPLOAD_RING_BYTE_SIZE_PER_FRAME = 8 * 1024 * 1024;
+
 	static constexpr gu::uint32 VSYNC = 1; // 0: don't wait, 1:wait(60fps)
 	#pragma endregion
 
@@ -103,6 +108,23 @@ public:
 	*  @return    void
 	*************************************************************************/
 	void WaitExecutionGPUCommands(const rhi::core::CommandListType type, const gu::uint64 waitValue, const bool stopCPU);
+
+	/*!**********************************************************************
+	*  @brief     `pX[J[XbhƂ̃R}hXgɕɋL^, 錾GraphicsL[֓܂. @n
+	*             ܂łGraphicsR}hXgɎs, ͉ʂւ̕`𑱂悤ĂыL^Jn܂. @n
+	*             N"single_list_record"ꍇ, r̂GraphicsR}hXg֏ԂɋL^܂.
+	*  @param[in] const gu::DynamicArray<ParallelRecordPass>& `pX (L^)
+	*  @return    void
+	*************************************************************************/
+	void ParallelRecord(const gu::DynamicArray<ParallelRecordPass>& passes);
+
+	/*!**********************************************************************
+	*  @brief     Abv[hOɗ\񂵂Rs[GraphicsR}hXgɐς݂܂. @n
+	*             BeginDrawFrameEndDrawFramełŌĂ΂邽, t[̓rŏ񂾓eɕ`Ɏgꍇ̂݌ĂяoĂ.
+	*  @param[in] void
+	*  @return    void
+	*************************************************************************/
+	void FlushUploads();
 	
 	#pragma endregion
 
@@ -128,6 +150,13 @@ public:
 	*************************************************************************/
 	__forceinline RHICommandQueuePtr GetCommandQueue(const rhi::core::CommandListType type) const noexcept { return _commandQueues.At(type); }
 
+	/*!**********************************************************************
+	*  @brief     t[Ƃ̃Abv[hɎgO擾܂. 񂾗݂̈͌̃t[̊܂ŗLł.
+	*  @param[in] void
+	*  @return    gu::SharedPointer<rhi::core::GPUUploadRing>
+	*************************************************************************/
+	__forceinline gu::SharedPointer<rhi::core::GPUUploadRing> GetUploadRing() const noexcept { return _uploadRing; }
+
 	/*!**********************************************************************
 	*  @brief     ftHgRenderPass̎擾. _[pXJn, ʂ̃NAs܂.  
 	*  @param[in] const rhi::core::CommandListType R}hXg̎
@@ -223,6 +252,15 @@ protected:
 	gu::SharedPointer<rhi::core::RHIRenderPass> _renderPass = { nullptr }; 
 	gu::SharedPointer<rhi::core::RHIRenderPass> _drawContinueRenderPass = nullptr;
 	gu::DynamicArray<gu::SharedPointer<rhi::core::RHIFrameBuffer>> _frameBuffers = { nullptr };
+
+	/*! @brief `pXɋL^邽߂̃t[Ƃ̃R}hXg̃v[*/
+	gu::SharedPointer<ParallelCommandRecorder> _parallelRecorder = nullptr;
+
+	/*! @brief t[Ƃ̃Abv[hW񂷂iIMapAbv[hobt@*/
+	gu::SharedPointer<rhi::core::GPUUploadRing> _uploadRing = nullptr;
+
+	/*! @brief Abv[hO1t[p̃fBXNv^̊𔻒肷邽߂̃t[ԍ. tFX̓t[Ƃɍ蒼ߕʂɐ܂*/
+	gu::uint64 _frameSerial = 0;
 	
 	/* @brief : current frame index*/
 	gu::uint32 _currentFrameIndex = 0;
@@ -294,6 +332,8 @@ protected:
 	static constexpr int CBV_DESC_COUNT = 1024 * 10;
 	static constexpr int UAV_DESC_COUNT = 1024 * 10;
 	static constexpr int SRV_DESC_COUNT = 1024 * 10;
+	static constexpr int TRANSIENT_CBV_DESC_COUNT = 1024 * 2; // CBV_DESC_COUNT̂t[Ƃɍėp
+	static constexpr int TRANSIENT_SRV_DESC_COUNT = 1024 * 2; // SRV_DESC_COUNT̂t[Ƃɍėp
 	static constexpr int MAX_SAMPLER_STATE = 16;
 
 	#pragma endregion 
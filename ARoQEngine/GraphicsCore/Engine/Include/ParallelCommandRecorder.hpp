@@ -0,0 +1,166 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ParallelCommandRecorder.hpp
+///  @brief  `pX̕`施߂𕡐̃[J[Xbh̃R}hXgɕċL^, 錾ɕׂĕԂ܂.
+///  @author toide
+///  @date   2026/10/20 16:05:19
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PARALLEL_COMMAND_RECORDER_HPP
+#define PARALLEL_COMMAND_RECORDER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHITypeCore.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+#include <functional>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+/****************************************************************************
+*				  			ParallelRecordPass
+****************************************************************************/
+/* @brief  ɋL^`pXł. `施 [0, DrawCount) Ԃɕ, ԂƂRecordĂяo܂. @n
+*          R}hXg܂ŃpCvC̏Ԃ͈pȂ, SetupŖݒ肵Ă. @n
+*          _[pX͋ԂƂɊJn邽, ǂݍݎɃNAȂ_[pXw肵Ă.
+*****************************************************************************/
+struct ParallelRecordPass
+{
+	/*! @brief fobOp̖O*/
+	gu::tstring Name = SP("");
+
+	/*! @brief `施߂̐*/
+	gu::uint32 DrawCount = 0;
+
+	/*! @brief 1̃R}hXgɋL^ŏ̕`施ߐ. Ȃ`ׂȂ悤ɂ܂*/
+	gu::uint32 MinDrawsPerList = 256;
+
+	/*! @brief L^ɊJn郌_[pX. nullptȑꍇ͊Jn܂. t[obt@͋L^ORenderTarget̏ԂɂĂĂ*/
+	gu::SharedPointer<rhi::core::RHIRenderPass> RenderPass = nullptr;
+
+	/*! @brief RenderPassŎgpt[obt@*/
+	gu::SharedPointer<rhi::core::RHIFrameBuffer> FrameBuffer = nullptr;
+
+	/*! @brief R}hXgƂ1xĂ΂܂. fBXNv^q[v, \[XCAEg, pCvC, r[|[gݒ肵܂*/
+	std::function<void(const RHICommandListPtr&)> Setup = nullptr;
+
+	/*! @brief `施 [begin, end) L^܂. قȂXbh瓯ɌĂ΂܂*/
+	std::function<void(const RHICommandListPtr&, const gu::uint32 begin, const gu::uint32 end)> Record = nullptr;
+};
+
+/****************************************************************************
+*				  			ParallelCommandRecorder
+****************************************************************************/
+/* @brief  t[Ƃ̃R}hXg (AP[^) ̃v[, `pX[J[XbhŕɋL^܂. @n
+*          ԂR}hXg̓pX̐錾, pXł͕`施߂̏ɕł邽, ̂܂1xɎsΒP̃XgƓɂȂ܂. @n
+*          R}hXg̎擾Ǝs͌ĂяõXbhōs, [J[͎̃Xgɂ̂݋L^܂. @n
+*          [J[̃Xg̓\[X̏ԂύXȂ, oA͌ĂяoŋL^Oɐݒ肵Ă.
+*****************************************************************************/
+class ParallelCommandRecorder : public gu::NonCopyable
+{
+public:
+	#pragma region Public Function
+	/*!**********************************************************************
+	*  @brief     `pXɋL^܂. SĂ̋L^I܂őҋ@܂.
+	*  @param[in] const gu::DynamicArray<ParallelRecordPass>& `pX (L^)
+	*  @param[in] const gu::uint32 t[̃CfbNX. ̃t[GPȔĂKv܂
+	*  @return    gu::DynamicArray<RHICommandListPtr> L^IR}hXg (s)
+	*************************************************************************/
+	gu::DynamicArray<RHICommandListPtr> Record(const gu::DynamicArray<ParallelRecordPass>& passes, const gu::uint32 frameIndex);
+
+	/*!**********************************************************************
+	*  @brief     t[GPȔɌĂяo, ̃t[̃R}hXg擪ėpł悤ɂ܂. @n
+	*             t[ŕRecordĂяoꍇ, sς݂̃Xg㏑Ȃ悤̈ʒugp܂.
+	*  @param[in] const gu::uint32 t[̃CfbNX
+	*  @return    void
+	*************************************************************************/
+	void BeginFrame(const gu::uint32 frameIndex);
+
+	/*!**********************************************************************
+	*  @brief     rp, `pX1̃R}hXg֏ԂɋL^܂.
+	*  @param[in] const RHICommandListPtr& L^̃R}hXg
+	*  @param[in] const gu::DynamicArray<ParallelRecordPass>& `pX (L^)
+	*  @return    void
+	*************************************************************************/
+	void RecordSerial(const RHICommandListPtr& commandList, const gu::DynamicArray<ParallelRecordPass>& passes);
+	#pragma endregion
+
+	#pragma region Public Property
+	/*! @brief [J[Xbh̐*/
+	__forceinline gu::uint32 GetWorkerCount() const noexcept { return _workerCount; }
+
+	/*! @brief ŐL^Ɋ| [ms]*/
+	__forceinline gu::double64 GetLastRecordMilliseconds() const noexcept { return _lastRecordMilliseconds; }
+
+	/*! @brief ŐL^ŊeR}hXg̋L^Ɋ|Ԃ̍v [ms]. L^ * [J[Ƃ̔䂪񉻂̌ɂȂ܂*/
+	__forceinline gu::double64 GetLastWorkerMilliseconds() const noexcept { return _lastWorkerMilliseconds; }
+
+	/*! @brief ŐL^ŎgpR}hXg̐*/
+	__forceinline gu::uint32 GetLastCommandListCount() const noexcept { return _lastCommandListCount; }
+	#pragma endregion
+
+	#pragma region Public Constructor and Destructor
+	/*! @brief R}hXg쐬foCX, t[, [J[Xbh (0̏ꍇ̓RA - 1) ŏ܂*/
+	ParallelCommandRecorder(const RHIDevicePtr& device, const gu::uint32 frameCount, const gu::uint32 workerCount = 0);
+
+	/*! @brief fXgN^*/
+	~ParallelCommandRecorder();
+	#pragma endregion
+
+protected:
+	#pragma region Protected Function
+	/*! @brief t[̃v[slotԖڂ̃R}hXg擾܂. ꍇ͍쐬܂*/
+	RHICommandListPtr AcquireCommandList(const gu::uint32 frameIndex, const gu::uint32 slot);
+
+	/*! @brief 1̋ԂL^܂*/
+	static void RecordRange(const RHICommandListPtr& commandList, const ParallelRecordPass& pass, const gu::uint32 begin, const gu::uint32 end, const bool beginRecording);
+	#pragma endregion
+
+	#pragma region Protected Property
+	/*! @brief L^̒P (pX̃CfbNXƕ`施߂̋)*/
+	struct RecordTask
+	{
+		gu::uint32 PassIndex = 0;
+		gu::uint32 Begin     = 0;
+		gu::uint32 End       = 0;
+	};
+
+	/*! @brief R}hXg쐬foCX*/
+	RHIDevicePtr _device = nullptr;
+
+	/*! @brief t[Ƃ̃R}hXg̃v[. eXg͐p̃AP[^܂*/
+	gu::DynamicArray<gu::DynamicArray<RHICommandListPtr>> _commandListPools = {};
+
+	/*! @brief t[Ƃ̎Ɏgpv[̈ʒu. BeginFrame0ɖ߂܂*/
+	gu::DynamicArray<gu::uint32> _nextSlots = {};
+
+	/*! @brief L^sXbhv[*/
+	gu::SharedPointer<gu::ThreadPool> _threadPool = nullptr;
+
+	/*! @brief [J[Xbh̐*/
+	gu::uint32 _workerCount = 1;
+
+	/*! @brief ŐL^Ɋ| [ms]*/
+	gu::double64 _lastRecordMilliseconds = 0.0;
+
+	/*! @brief ŐL^ŊeR}hXg̋L^Ɋ|Ԃ̍v [ms]*/
+	gu::double64 _lastWorkerMilliseconds = 0.0;
+
+	/*! @brief ŐL^ŎgpR}hXg̐*/
+	gu::uint32 _lastCommandListCount = 0;
+	#pragma endregion
+};
+
+#endif
@@ -29,6 +29,9 @@
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorHeap.hpp"
 #include "GameUtility/Base/Include/Screen.hpp"
+#include "GameUtility/Base/Include/GUProfiler.hpp"
+#include "GameUtility/Base/Include/GUCommandLine.hpp"
+#include "GameUtility/Base/Include/GUParse.hpp"
 #include <iostream>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -90,6 +93,16 @@ void LowLevelGraphicsEngine::StartUp(const GraphicsAPI apiVersion, void* hwnd, v
 	_commandLists[core::CommandListType::Compute]  = _device->CreateCommandList(_device->CreateCommandAllocator(core::CommandListType::Compute , SP("ComputeAllocator")) , SP("ComputeCommandList"));
 	_commandLists[core::CommandListType::Copy]     = _device->CreateCommandList(_device->CreateCommandAllocator(core::CommandListType::Copy    , SP("CopyAllocator"))    , SP("CopyCommandList"));
 
+	/*-------------------------------------------------------------------
+	-      Set up parallel recording command lists
+	---------------------------------------------------------------------*/
+	_parallelRecorder = gu::MakeShared<ParallelCommandRecorder>(_device, FRAME_BUFFER_COUNT);
+
+	/*-------------------------------------------------------------------
+	-      Set up upload ring
+	---------------------------------------------------------------------*/
+	_uploadRing = gu::MakeShared<core::GPUUploadRing>(_device, UPLOAD_RING_BYTE_SIZE_PER_FRAME, FRAME_BUFFER_COUNT);
+
 	/*-------------------------------------------------------------------
 	-      Create fence
 	---------------------------------------------------------------------*/
@@ -139,6 +152,8 @@ void LowLevelGraphicsEngine::StartUp(const GraphicsAPI apiVersion, void* hwnd, v
 *************************************************************************/
 void LowLevelGraphicsEngine::BeginDrawFrame()
 {
+	PROFILE_FUNCTION();
+
 	/*-------------------------------------------------------------------
 	-      Get each command list
 	---------------------------------------------------------------------*/
@@ -150,6 +165,12 @@ void LowLevelGraphicsEngine::BeginDrawFrame()
 	---------------------------------------------------------------------*/
 	graphicsCommandList->BeginRecording(false);
 	computeCommandList ->BeginRecording(false);
+
+	// O񂱂̃t[ԍŎgpL^p̃Xg, EndDrawFrameGPŮ҂Ă邽ߍėpł܂
+	_parallelRecorder->BeginFrame(_currentFrameIndex);
+
+	// t[Oŏ܂ꂽAbv[h`ɃRs[܂
+	_uploadRing->FlushCopies(graphicsCommandList);
 	_beginDrawFrameTimeStamp = _commandQueues[core::CommandListType::Graphics]->GetCalibrationTimestamp();
 }
 
@@ -160,6 +181,8 @@ void LowLevelGraphicsEngine::BeginDrawFrame()
 *************************************************************************/
 void LowLevelGraphicsEngine::EndDrawFrame()
 {
+	PROFILE_FUNCTION();
+
 	/*-------------------------------------------------------------------
 	-      Finish recording commands list
 	---------------------------------------------------------------------*/
@@ -172,6 +195,7 @@ void LowLevelGraphicsEngine::EndDrawFrame()
 	if (graphicsCommandList->IsOpen())
 	{
 		graphicsCommandList->EndRenderPass();
+		_uploadRing->FlushCopies(graphicsCommandList);
 		graphicsCommandList->CopyResource(_swapchain->GetBuffer((gu::uint8)_currentFrameIndex), _frameBuffers[_currentFrameIndex]->GetRenderTarget());
 		graphicsCommandList->EndRecording();
 	}
@@ -179,29 +203,65 @@ void LowLevelGraphicsEngine::EndDrawFrame()
 	/*-------------------------------------------------------------------
 	-          Execute GPU Command
 	---------------------------------------------------------------------*/
-	_commandQueues[core::CommandListType::Compute]->Execute({ computeCommandList });
-	_commandQueues[core::CommandListType::Compute]->Signal(_fence, ++_fenceValue);
+	{
+		PROFILE_SCOPE("Execute Command Lists");
+		_commandQueues[core::CommandListType::Compute]->Execute({ computeCommandList });
+		_commandQueues[core::CommandListType::Compute]->Signal(_fence, ++_fenceValue);
 
-	_commandQueues[core::CommandListType::Graphics]->Wait(_fence, _fenceValue);
-	_commandQueues[core::CommandListType::Graphics]->Execute({ graphicsCommandList });
-	_commandQueues[core::CommandListType::Graphics]->Signal(_fence, ++_fenceValue);
+		_commandQueues[core::CommandListType::Graphics]->Wait(_fence, _fenceValue);
+		_commandQueues[core::CommandListType::Graphics]->Execute({ graphicsCommandList });
+		_commandQueues[core::CommandListType::Graphics]->Signal(_fence, ++_fenceValue);
+	}
+
+	/*-------------------------------------------------------------------
+	-      ̃t[̃Abv[h1t[p̃fBXNv^, GPŮ܂ŎgpƂċL^܂
+	---------------------------------------------------------------------*/
+	const auto& cbvSrvUavHeap = _device->GetDefaultHeap(core::DescriptorHeapType::CBV);
+	const auto  cbvTransient  = cbvSrvUavHeap->GetTransientAllocator(core::DescriptorHeapType::CBV);
+	const auto  srvTransient  = cbvSrvUavHeap->GetTransientAllocator(core::DescriptorHeapType::SRV);
+	const gu::uint64 transientDescriptorCount = (cbvTransient ? cbvTransient->GetUsedCount() : 0) + (srvTransient ? srvTransient->GetUsedCount() : 0);
+
+	_uploadRing->EndFrame(++_frameSerial);
+	cbvSrvUavHeap->EndFrame(_frameSerial);
 
 	/*-------------------------------------------------------------------
 	-          Flip Screen
 	---------------------------------------------------------------------*/
-	_swapchain->Present(_fence, _fenceValue);
-	_fence->Wait(_fenceValue);
+	{
+		PROFILE_SCOPE("Present");
+		_swapchain->Present(_fence, _fenceValue);
+	}
+	{
+		PROFILE_SCOPE("Wait GPU");
+		_fence->Wait(_fenceValue);
+		_uploadRing->Recycle(_frameSerial);
+		cbvSrvUavHeap->Recycle(_frameSerial);
+	}
 
 	/*-------------------------------------------------------------------
 	-      GPU Command Wait
 	---------------------------------------------------------------------*/
-	_currentFrameIndex = _swapchain->PrepareNextImage(_fence, ++_fenceValue);
-	SetUpFence(); // reset fence value for the next frame
+	{
+		PROFILE_SCOPE("Prepare Next Image");
+		_currentFrameIndex = _swapchain->PrepareNextImage(_fence, ++_fenceValue);
+		SetUpFence(); // reset fence value for the next frame
+	}
 
 	_endDrawFrameTimeStamp = _commandQueues[core::CommandListType::Graphics]->GetCalibrationTimestamp();
 	_gpuTimer = (_endDrawFrameTimeStamp.GPUMicroseconds - _beginDrawFrameTimeStamp.GPUMicroseconds) / 1e6;
 	_cpuTimer = (_endDrawFrameTimeStamp.CPUMicroseconds - _beginDrawFrameTimeStamp.CPUMicroseconds) / 1e6;
-	
+
+	PROFILE_COUNTER("GPU Frame Time (ms)", _gpuTimer * 1e3);
+	PROFILE_COUNTER("CPU Frame Time (ms)", _cpuTimer * 1e3);
+
+	const auto& stateStatistics = graphicsCommandList->GetStateStatistics();
+	PROFILE_COUNTER("Issued State Commands"  , stateStatistics.GetTotalIssuedCount());
+	PROFILE_COUNTER("Filtered State Commands", stateStatistics.GetTotalFilteredCount());
+
+	PROFILE_COUNTER("Upload Allocations", _uploadRing->GetLastFrameAllocationCount());
+	PROFILE_COUNTER("Upload Fallbacks"  , _uploadRing->GetLastFrameFallbackCount());
+	PROFILE_COUNTER("Upload Time (ms)"  , _uploadRing->GetLastFrameUploadMilliseconds());
+	PROFILE_COUNTER("Transient Descriptors", transientDescriptorCount);
 }
 
 /*!**********************************************************************
@@ -262,6 +322,105 @@ void LowLevelGraphicsEngine::WaitExecutionGPUCommands(const rhi::core::CommandLi
 	if (stopCPU) { _fence->Wait(waitValue); } // cpu stop
 }
 
+/*!**********************************************************************
+*  @brief     `pX[J[XbhƂ̃R}hXgɕɋL^, 錾GraphicsL[֓܂.
+*  @param[in] const gu::DynamicArray<ParallelRecordPass>& `pX (L^)
+*  @return    void
+*************************************************************************/
+void LowLevelGraphicsEngine::ParallelRecord(const gu::DynamicArray<ParallelRecordPass>& passes)
+{
+	PROFILE_FUNCTION();
+
+	const auto& commandList = _commandLists[CommandListType::Graphics];
+
+	/*-------------------------------------------------------------------
+	-          Record on the single graphics command list (for comparison)
+	---------------------------------------------------------------------*/
+	static const bool useSingleList = gu::Parse::Contains(gu::CommandLine::Get(), SP("single_list_record"));
+	if (useSingleList)
+	{
+		_parallelRecorder->RecordSerial(commandList, passes);
+		commandList->BeginRenderPass(_drawContinueRenderPass, _frameBuffers[_currentFrameIndex]);
+		PROFILE_COUNTER("Record Time (ms)", _parallelRecorder->GetLastRecordMilliseconds());
+		PROFILE_COUNTER("Record Worker Time (ms)", _parallelRecorder->GetLastWorkerMilliseconds());
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-          Transit the render targets before recording.
+	-          Workers only read the resource state, so no barrier is recorded in parallel.
+	-          The render targets stay in RenderTarget afterwards, the same as the single list path.
+	---------------------------------------------------------------------*/
+	commandList->EndRenderPass();
+	for (const auto& pass : passes)
+	{
+		if (!pass.FrameBuffer) { continue; }
+
+		for (const auto& renderTarget : pass.FrameBuffer->GetRenderTargets())
+		{
+			commandList->PushTransitionBarrier(renderTarget, ResourceState::RenderTarget);
+		}
+	}
+	commandList->FlushResourceBarriers();
+
+	/*-------------------------------------------------------------------
+	-          Close the graphics command list recorded so far.
+	-          The frame buffer is detached so that closing does not transit it to Present.
+	---------------------------------------------------------------------*/
+	commandList->DetachFrameBuffer();
+	commandList->EndRecording();
+
+	/*-------------------------------------------------------------------
+	-          Record the passes on the worker command lists
+	---------------------------------------------------------------------*/
+	const auto workerLists = _parallelRecorder->Record(passes, _currentFrameIndex);
+	PROFILE_COUNTER("Record Time (ms)", _parallelRecorder->GetLastRecordMilliseconds());
+	PROFILE_COUNTER("Record Worker Time (ms)", _parallelRecorder->GetLastWorkerMilliseconds());
+	PROFILE_COUNTER("Record Command Lists", _parallelRecorder->GetLastCommandListCount());
+
+	/*-------------------------------------------------------------------
+	-          Execute in the declared order
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<RHICommandListPtr> commandLists = {};
+	commandLists.Reserve(workerLists.Size() + 1);
+	commandLists.Push(commandList);
+	for (const auto& workerList : workerLists)
+	{
+		commandLists.Push(workerList);
+	}
+	_commandQueues[CommandListType::Graphics]->Execute(commandLists);
+
+	/*-------------------------------------------------------------------
+	-         Restart the graphics command list
+	---------------------------------------------------------------------*/
+	commandList->BeginRecording(true);
+	commandList->BeginRenderPass(_drawContinueRenderPass, _frameBuffers[_currentFrameIndex]);
+}
+
+/*!**********************************************************************
+*  @brief     Abv[hOɗ\񂵂Rs[GraphicsR}hXgɐς݂܂. @n
+*             _[pX̓Rs[ς߂Ȃ, xĂ`ĊJ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void LowLevelGraphicsEngine::FlushUploads()
+{
+	if (_uploadRing->GetPendingCopyCount() == 0) { return; }
+
+	const auto& commandList = _commandLists[CommandListType::Graphics];
+	if (!commandList->IsOpen()) { return; }
+
+	const bool isInRenderPass = commandList->IsInRenderPass();
+	if (isInRenderPass) { commandList->EndRenderPass(); }
+
+	_uploadRing->FlushCopies(commandList);
+
+	if (isInRenderPass)
+	{
+		commandList->BeginRenderPass(_drawContinueRenderPass, _frameBuffers[_currentFrameIndex]);
+	}
+}
+
 /****************************************************************************
 *                     OnResize
 ****************************************************************************/
@@ -346,6 +505,10 @@ void LowLevelGraphicsEngine::ShutDown()
 	---------------------------------------------------------------------*/
 	if (_fence) { _fence.Reset(); }
 
+	if (_parallelRecorder) { _parallelRecorder.Reset(); }
+
+	if (_uploadRing) { _uploadRing.Reset(); }
+
 	if(!_commandLists.IsEmpty()){_commandLists.Clear(); }
 
 	if (!_commandQueues.IsEmpty()) { _commandQueues.Clear(); }
@@ -382,9 +545,11 @@ void LowLevelGraphicsEngine::SetUpHeap()
 	heapCount.CBVDescCount = CBV_DESC_COUNT; 
 	heapCount.SRVDescCount = SRV_DESC_COUNT;
 	heapCount.UAVDescCount = UAV_DESC_COUNT;
-	heapCount.DSVDescCount = _apiVersion == GraphicsAPI::DirectX12 ? DSV_DESC_COUNT : 0;
-	heapCount.RTVDescCount = _apiVersion == GraphicsAPI::DirectX12 ? RTV_DESC_COUNT : 0;
+	heapCount.DSVDescCount = _apiVersion == GraphicsAPI::DirectX12 || _apiVersion == GraphicsAPI::Null ? DSV_DESC_COUNT : 0;
+	heapCount.RTVDescCount = _apiVersion == GraphicsAPI::DirectX12 || _apiVersion == GraphicsAPI::Null ? RTV_DESC_COUNT : 0;
 	heapCount.SamplerDescCount = MAX_SAMPLER_STATE;
+	heapCount.TransientCBVDescCount = TRANSIENT_CBV_DESC_COUNT;
+	heapCount.TransientSRVDescCount = TRANSIENT_SRV_DESC_COUNT;
 	_device->SetUpDefaultHeap(heapCount);
 
 }
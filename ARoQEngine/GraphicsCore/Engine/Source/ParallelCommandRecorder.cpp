@@ -0,0 +1,260 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ParallelCommandRecorder.cpp
+///  @brief  `pX̕`施߂𕡐̃[J[Xbh̃R}hXgɕċL^, 錾ɕׂĕԂ܂.
+///  @author toide
+///  @date   2026/10/20 16:05:19
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/Engine/Include/ParallelCommandRecorder.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandAllocator.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIRenderpass.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+ParallelCommandRecorder::ParallelCommandRecorder(const RHIDevicePtr& device, const gu::uint32 frameCount, const gu::uint32 workerCount)
+	: _device(device)
+{
+	Checkf(_device, "device is nullptr.\n");
+	Checkf(frameCount > 0, "frameCount must be greater than 0.\n");
+
+	/*-------------------------------------------------------------------
+	-      ĂяõXbh͋L^̊҂Ȃ̂, RA - 1 [J[Ƃ܂
+	---------------------------------------------------------------------*/
+	if (workerCount > 0)
+	{
+		_workerCount = workerCount;
+	}
+	else
+	{
+		const gu::uint32 hardwareCount = static_cast<gu::uint32>(std::thread::hardware_concurrency());
+		_workerCount = hardwareCount > 1 ? hardwareCount - 1 : 1;
+	}
+
+	_commandListPools.Resize(frameCount);
+	_nextSlots       .Resize(frameCount);
+}
+
+ParallelCommandRecorder::~ParallelCommandRecorder()
+{
+	// L^̃^XNcȂ悤, Xbhv[ɔj܂
+	_threadPool.Reset();
+	_commandListPools.Clear();
+	_commandListPools.ShrinkToFit();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     `pXɋL^܂. SĂ̋L^I܂őҋ@܂.
+*  @param[in] const gu::DynamicArray<ParallelRecordPass>& `pX (L^)
+*  @param[in] const gu::uint32 t[̃CfbNX. ̃t[GPȔĂKv܂
+*  @return    gu::DynamicArray<RHICommandListPtr> L^IR}hXg (s)
+*************************************************************************/
+gu::DynamicArray<RHICommandListPtr> ParallelCommandRecorder::Record(const gu::DynamicArray<ParallelRecordPass>& passes, const gu::uint32 frameIndex)
+{
+	Checkf(frameIndex < _commandListPools.Size(), "frameIndex is out of range.\n");
+
+	const auto start = std::chrono::steady_clock::now();
+
+	/*-------------------------------------------------------------------
+	-      `施߂Ԃɕ܂. ^XN̕т̂܂܎sɂȂ܂
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<RecordTask> tasks = {};
+	for (gu::uint32 passIndex = 0; passIndex < passes.Size(); ++passIndex)
+	{
+		const auto& pass = passes[passIndex];
+		if (pass.DrawCount == 0 || !pass.Record) { continue; }
+
+		const gu::uint32 minDraws  = pass.MinDrawsPerList > 0 ? pass.MinDrawsPerList : 1;
+		const gu::uint32 listCount = std::max(1u, std::min((pass.DrawCount + minDraws - 1) / minDraws, _workerCount));
+		const gu::uint32 drawCount = (pass.DrawCount + listCount - 1) / listCount;
+
+		for (gu::uint32 begin = 0; begin < pass.DrawCount; begin += drawCount)
+		{
+			tasks.Push({ passIndex, begin, std::min(begin + drawCount, pass.DrawCount) });
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-      R}hXg̎擾 (쐬) ͌ĂяõXbhōs܂. 
+	-      t[ŐɎsXgGPUgp̂, ̈ʒu擾܂
+	---------------------------------------------------------------------*/
+	const gu::uint32 firstSlot = _nextSlots[frameIndex];
+	gu::DynamicArray<RHICommandListPtr> commandLists = {};
+	commandLists.Reserve(tasks.Size());
+	for (gu::uint32 i = 0; i < tasks.Size(); ++i)
+	{
+		commandLists.Push(AcquireCommandList(frameIndex, firstSlot + i));
+	}
+	_nextSlots[frameIndex] = firstSlot + static_cast<gu::uint32>(tasks.Size());
+
+	/*-------------------------------------------------------------------
+	-      eԂ[J[ŋL^܂. 1Ԃ̏ꍇ͂̂܂܋L^܂
+	---------------------------------------------------------------------*/
+	// eԂ̋L^Ԃ͎̗vfɂ̂ݏނ, r͕svł
+	std::vector<double> taskMilliseconds(tasks.Size(), 0.0);
+
+	if (tasks.Size() == 1)
+	{
+		RecordRange(commandLists[0], passes[tasks[0].PassIndex], tasks[0].Begin, tasks[0].End, true);
+		taskMilliseconds[0] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+	else if (tasks.Size() > 1)
+	{
+		if (!_threadPool)
+		{
+			_threadPool = gu::MakeShared<gu::ThreadPool>(_workerCount);
+		}
+
+		std::vector<std::future<void>> futures = {};
+		futures.reserve(tasks.Size());
+		for (gu::uint32 i = 0; i < tasks.Size(); ++i)
+		{
+			futures.push_back(_threadPool->Submit([&passes, &tasks, &commandLists, &taskMilliseconds, i]()
+			{
+				const auto taskStart = std::chrono::steady_clock::now();
+				RecordRange(commandLists[i], passes[tasks[i].PassIndex], tasks[i].Begin, tasks[i].End, true);
+				taskMilliseconds[i] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - taskStart).count();
+			}));
+		}
+
+		// SẴ^XN̊҂Ă, ŏ̗OĂяo֕Ԃ܂
+		std::exception_ptr exception = nullptr;
+		for (auto& future : futures)
+		{
+			try
+			{
+				future.get();
+			}
+			catch (...)
+			{
+				if (!exception) { exception = std::current_exception(); }
+			}
+		}
+		if (exception) { std::rethrow_exception(exception); }
+	}
+
+	_lastCommandListCount   = static_cast<gu::uint32>(commandLists.Size());
+	_lastRecordMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	_lastWorkerMilliseconds = 0.0;
+	for (const auto milliseconds : taskMilliseconds) { _lastWorkerMilliseconds += milliseconds; }
+	return commandLists;
+}
+
+/*!**********************************************************************
+*  @brief     t[GPȔɌĂяo, ̃t[̃R}hXg擪ėpł悤ɂ܂.
+*  @param[in] const gu::uint32 t[̃CfbNX
+*  @return    void
+*************************************************************************/
+void ParallelCommandRecorder::BeginFrame(const gu::uint32 frameIndex)
+{
+	Checkf(frameIndex < _nextSlots.Size(), "frameIndex is out of range.\n");
+	_nextSlots[frameIndex] = 0;
+}
+
+/*!**********************************************************************
+*  @brief     rp, `pX1̃R}hXg֏ԂɋL^܂.
+*  @param[in] const RHICommandListPtr& L^̃R}hXg
+*  @param[in] const gu::DynamicArray<ParallelRecordPass>& `pX (L^)
+*  @return    void
+*************************************************************************/
+void ParallelCommandRecorder::RecordSerial(const RHICommandListPtr& commandList, const gu::DynamicArray<ParallelRecordPass>& passes)
+{
+	Checkf(commandList && commandList->IsOpen(), "commandList must be recording.\n");
+
+	const auto start = std::chrono::steady_clock::now();
+
+	for (const auto& pass : passes)
+	{
+		if (pass.DrawCount == 0 || !pass.Record) { continue; }
+		RecordRange(commandList, pass, 0, pass.DrawCount, false);
+	}
+
+	_lastCommandListCount   = 1;
+	_lastRecordMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	_lastWorkerMilliseconds = _lastRecordMilliseconds;
+}
+
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     t[̃v[slotԖڂ̃R}hXg擾܂. ꍇ͍쐬܂.
+*  @param[in] const gu::uint32 t[̃CfbNX
+*  @param[in] const gu::uint32 v[̈ʒu
+*  @return    RHICommandListPtr
+*************************************************************************/
+RHICommandListPtr ParallelCommandRecorder::AcquireCommandList(const gu::uint32 frameIndex, const gu::uint32 slot)
+{
+	auto& pool = _commandListPools[frameIndex];
+
+	while (pool.Size() <= slot)
+	{
+		const auto number    = gu::tstring::FromNumber(frameIndex) + SP("_") + gu::tstring::FromNumber(static_cast<gu::uint32>(pool.Size()));
+		const auto allocator = _device->CreateCommandAllocator(CommandListType::Graphics, SP("ParallelAllocator") + number);
+		pool.Push(_device->CreateCommandList(allocator, SP("ParallelCommandList") + number));
+	}
+
+	return pool[slot];
+}
+
+/*!**********************************************************************
+*  @brief     1̋ԂL^܂.
+*  @param[in] const RHICommandListPtr& L^̃R}hXg
+*  @param[in] const ParallelRecordPass& `pX
+*  @param[in] const gu::uint32 Ԃ̐擪
+*  @param[in] const gu::uint32 Ԃ̏I[ (܂܂Ȃ)
+*  @param[in] const bool R}hXg̋L^̊JnƏIs
+*  @return    void
+*************************************************************************/
+void ParallelCommandRecorder::RecordRange(const RHICommandListPtr& commandList, const ParallelRecordPass& pass, const gu::uint32 begin, const gu::uint32 end, const bool beginRecording)
+{
+	if (beginRecording)
+	{
+		commandList->BeginRecording(false);
+	}
+
+	const bool hasRenderPass = pass.RenderPass && pass.FrameBuffer;
+	if (hasRenderPass)
+	{
+		commandList->BeginRenderPass(pass.RenderPass, pass.FrameBuffer);
+	}
+
+	if (pass.Setup) { pass.Setup(commandList); }
+
+	pass.Record(commandList, begin, end);
+
+	if (hasRenderPass && beginRecording)
+	{
+		commandList->EndRenderPass();
+	}
+
+	if (beginRecording)
+	{
+		// ̃[J[_[^[Qbg̏ԂQƂĂ邽, ۂPresent֑Jڂ܂
+		commandList->DetachFrameBuffer();
+		commandList->EndRecording();
+	}
+}
+#pragma endregion Protected Function
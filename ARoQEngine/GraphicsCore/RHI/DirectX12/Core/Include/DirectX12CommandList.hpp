@@ -14,6 +14,8 @@
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
 #include "DirectX12Core.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUSortedMap.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorAllocator.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -84,6 +86,23 @@ namespace rhi::directX12
 		*************************************************************************/
 		virtual void SetDescriptorHeap(const gu::SharedPointer<core::RHIDescriptorHeap>& heap) override;
 
+		/*!**********************************************************************
+		*  @brief     [gp[^̃CfbNXɃfBXNv^e[uݒ肵܂. e[u̍Đݒ͎菜܂.
+		*  @param[in] const gu::uint32 [gp[^̃CfbNX
+		*  @param[in] const gu::uint64 fBXNv^e[u̐擪 (D3D12_GPU_DESCRIPTOR_HANDLE::ptr)
+		*  @return    void
+		*************************************************************************/
+		void SetRootDescriptorTable(const gu::uint32 index, const gu::uint64 gpuHandle);
+
+		/*!**********************************************************************
+		*  @brief     ̃t[gpAfBXNv^, R}hXgƂ͈͂̕甭s܂. 
+		*  @param[in]  const core::DescriptorHeapType fBXNv^̎
+		*  @param[in]  const gu::uint32 
+		*  @param[out] gu::uint32& 擪̃CfbNX (ނƂ͈͓̔)
+		*  @return     bool 1t[p͈̔͂Ȃ, ܂͊mۂĂȂꍇfalse
+		*************************************************************************/
+		bool AllocateTransientDescriptors(const core::DescriptorHeapType heapType, const gu::uint32 count, gu::uint32& firstIndex) override;
+
 		#pragma endregion Main Draw Frame
         #pragma region Query
 		/*!**********************************************************************
@@ -396,6 +415,16 @@ namespace rhi::directX12
 		/*! @brief directX12ŎgpR}hXg*/
 		CommandListComPtr _commandList = nullptr;
 
+		/*! @brief 1t[p̃fBXNv^͈͂̕, ̐ẽAP[^*/
+		struct TransientDescriptorRange
+		{
+			gu::SharedPointer<core::DescriptorLinearAllocator> Parent = nullptr;
+			gu::SharedPointer<core::DescriptorThreadRange>     Range  = nullptr;
+		};
+
+		/*! @brief fBXNv^̎ނƂ1t[p͈̕. BeginRecording (t[̐擪) Ŏ܂*/
+		gu::SortedMap<core::DescriptorHeapType, TransientDescriptorRange> _transientRanges = {};
+
 		#pragma endregion Protected Member Variable
 		
 	private:
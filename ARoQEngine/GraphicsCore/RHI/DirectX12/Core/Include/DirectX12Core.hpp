@@ -264,6 +264,7 @@ struct D3D12_GLOBAL_ROOT_SIGNATURE;
 struct D3D12_LOCAL_ROOT_SIGNATURE;
 struct ID3D12CommandSignature;
 struct ID3D12QueryHeap;
+struct ID3D12PipelineLibrary;
 
 using ICommandQueue     = ID3D12CommandQueue;
 using ICommandAllocator = ID3D12CommandAllocator;
@@ -274,6 +275,7 @@ using IDescriptorHeap   = ID3D12DescriptorHeap;
 using IBlob             = ID3D10Blob;
 using ICommandSignature = ID3D12CommandSignature;
 using IQueryHeap        = ID3D12QueryHeap;
+using IPipelineLibrary  = ID3D12PipelineLibrary;
 
 using DeviceComPtr           = ComPtr<IDevice>;
 using AdapterComPtr          = ComPtr<IAdapter>;
@@ -294,6 +296,7 @@ using HeapComPtr             = ComPtr<IHeap>;
 using InfoQueuePtr           = ComPtr<IInfoQueue>;
 using CommandSignaturePtr    = ComPtr<ICommandSignature>;
 using QueryHeapPtr           = ComPtr<IQueryHeap>;
+using PipelineLibraryComPtr  = ComPtr<IPipelineLibrary>;
 
 #endif DirectX12_CORE_HPP
 
@@ -53,6 +53,9 @@ namespace rhi::directX12
 		/* @brief : Reset view offset*/
 		void Reset(const ResetFlag flag = ResetFlag::OnlyOffset) override;
 
+		/* @brief : Reserve the tail of the type range for descriptors used only in one frame*/
+		void ReserveTransient(const core::DescriptorHeapType type, const gu::uint32 count) override;
+
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
@@ -72,6 +75,12 @@ namespace rhi::directX12
 		inline DescriptorHeapComPtr GetHeap() const noexcept { return _descriptorHeap; }
 		
 		inline size_t GetDescriptorByteSize() const noexcept { return _descriptorByteSize; }
+
+		/* @brief : Return the per-frame linear allocator of the type (nullptr if not reserved)*/
+		gu::SharedPointer<core::DescriptorLinearAllocator> GetTransientAllocator(const core::DescriptorHeapType type) const override
+		{
+			return _resourceAllocators.Contains(type) ? _resourceAllocators.At(type).GetTransientAllocator() : nullptr;
+		}
 		/****************************************************************************
 		**                Constructor and Destructor
 		*****************************************************************************/
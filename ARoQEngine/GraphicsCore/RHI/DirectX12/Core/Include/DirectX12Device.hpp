@@ -28,8 +28,15 @@ struct INTCExtensionInfo;
 //////////////////////////////////////////////////////////////////////////////////
 //                          Device class
 //////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	class GPUShaderCache;
+}
+
 namespace rhi::directX12
 {
+	class GPUPipelineStateCache;
+
 	/****************************************************************************
 	*				  			Device class
 	****************************************************************************/
@@ -250,6 +257,20 @@ namespace rhi::directX12
 		*************************************************************************/
 		DeviceComPtr GetDevice() const noexcept { return _device; }
 
+		/*!**********************************************************************
+		*  @brief     pCvCXe[gLbVԂ܂. Lqq̃pCvCL, IɃfBXN֕ۑ܂.
+		*  @param[in] void
+		*  @return    const gu::SharedPointer<GPUPipelineStateCache>&
+		*************************************************************************/
+		__forceinline const gu::SharedPointer<GPUPipelineStateCache>& GetPipelineStateCache() const noexcept { return _pipelineStateCache; }
+
+		/*!**********************************************************************
+		*  @brief     VF[_[LbVԂ܂. ͂̃VF[_[̓RpCɃfBXNԂ܂.
+		*  @param[in] void
+		*  @return    const gu::SharedPointer<core::GPUShaderCache>&
+		*************************************************************************/
+		__forceinline const gu::SharedPointer<core::GPUShaderCache>& GetShaderCache() const noexcept { return _shaderCache; }
+
 		gu::uint32 GetShadingRateImageTileSize() const { return _variableRateShadingImageTileSize; }
 		
 		virtual gu::SharedPointer<core::RHIDescriptorHeap> GetDefaultHeap(const core::DescriptorHeapType heapType) override;
@@ -518,6 +539,24 @@ namespace rhi::directX12
 		---------------------------------------------------------------------*/
 		CommandSignaturePtr _drawIndexedIndirectCommandSignature = nullptr;
 
+		/*-------------------------------------------------------------------
+		-               Pipeline state cache
+		---------------------------------------------------------------------*/
+		/*! @brief pCvCXe[gLbV*/
+		gu::SharedPointer<GPUPipelineStateCache> _pipelineStateCache = nullptr;
+
+		/*! @brief pCvCXe[gLbV̕ۑ*/
+		static constexpr const gu::tchar* PIPELINE_STATE_CACHE_FILE_PATH = SP("PipelineStateCache.dx12");
+
+		/*-------------------------------------------------------------------
+		-               Shader cache
+		---------------------------------------------------------------------*/
+		/*! @brief VF[_[LbV*/
+		gu::SharedPointer<core::GPUShaderCache> _shaderCache = nullptr;
+
+		/*! @brief VF[_[LbṼt@CofBNg*/
+		static constexpr const gu::tchar* SHADER_CACHE_DIRECTORY = SP("ShaderCache");
+
 	private:
 		#pragma region Private Enum Class
 		// Descriotor heap
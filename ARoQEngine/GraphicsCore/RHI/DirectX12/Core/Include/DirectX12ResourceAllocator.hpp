@@ -12,8 +12,11 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "DirectX12BaseStruct.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorAllocator.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
-#include <queue>
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <stdexcept>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -28,7 +31,9 @@ namespace rhi::directX12
 	*				  			ResourceAllocator
 	****************************************************************************/
 	/* @class     ResourceAllocator
-	*  @brief     CPU and GPU index management
+	*  @brief     CPU and GPU index management @n
+	*             CfbNX̔score::DescriptorIndexAllocatorōs, ̃Xbh瓯ɌĂяo܂. @n
+	*             Rs[ꍇ͓CfbNX̊ǗL܂.
 	*****************************************************************************/
 	class ResourceAllocator : public gu::Copyable
 	{
@@ -41,16 +46,12 @@ namespace rhi::directX12
 		*----------------------------------------------------------------------*/
 		inline UINT IssueID()
 		{
-			if ((UINT)_currentID + 1 > _maxDescriptorCount) { MessageBox(NULL, L"The number of IDs has exceeded the expected number. ", L"Warning", MB_ICONWARNING); }
-
-			if (!_availableID.empty()) 
+			const auto id = _indexAllocator->Allocate();
+			if (id == core::DescriptorIndexAllocator::INVALID_INDEX) 
 			{
-				const auto id = _availableID.front();
-				_availableID.pop();
-				return id; 
+				throw std::runtime_error("The number of IDs has exceeded the expected number. ");
 			}
-
-			_currentID++; return _currentID;
+			return id;
 		}
 
 		/*----------------------------------------------------------------------
@@ -58,26 +59,36 @@ namespace rhi::directX12
 		*----------------------------------------------------------------------*/
 		inline void FreeID(const UINT id)
 		{
-			if (id >= _maxDescriptorCount) { OutputDebugStringA("Non available id"); return; }
-
-			_availableID.push(id);
+			if (!_indexAllocator->Free(id)) { OutputDebugStringA("Non available id"); }
 		}
 
 		/*----------------------------------------------------------------------
 		*  @brief :  q[v̒g͉, ̂܂ID݂̂Ԃɖ߂܂
 		*----------------------------------------------------------------------*/
-		inline void ResetID(UINT offsetIndex = 0)
+		inline void ResetID()
 		{
-			_currentID = INVALID_ID + offsetIndex;
+			_indexAllocator->Reset();
+			if (_transientAllocator) { _transientAllocator->Reset(); }
+		}
+
+		/*----------------------------------------------------------------------
+		*  @brief :  ͈̖͂transientCount1t[gpfBXNv^pɊmۂ܂. @n
+		*            풓pID͎c [0, max - transientCount) 甭s܂. GPUACh̎̂݌ĂяoĂ.
+		*----------------------------------------------------------------------*/
+		inline void SetTransientCount(const UINT transientCount)
+		{
+			Checkf(transientCount < _maxDescriptorCount || _maxDescriptorCount == 0, "The transient count must be less than the max descriptor count.");
+			_transientCount = transientCount;
+			SetUpRange();
 		}
 
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
 		/*----------------------------------------------------------------------
-		*  @brief :  ݂Heap̈̔zɑ΂Ăǂ̃CfbNXɓĂ邩Ԃ܂.
+		*  @brief :  sς݂ID̐Ԃ܂.
 		*----------------------------------------------------------------------*/
-		inline UINT GetCurrentID() const { return _currentID; }
+		inline UINT GetAllocatedCount() const { return _indexAllocator->GetAllocatedCount(); }
 
 		/*----------------------------------------------------------------------
 		*  @brief :  fBXNv^q[ṽoCgTCYԂ܂.maxDescriptorViewCount * OneDescriptorSize
@@ -89,23 +100,22 @@ namespace rhi::directX12
 		*----------------------------------------------------------------------*/
 		inline UINT GetMaxDescriptorCount() const { return _maxDescriptorCount; }
 
+		/*----------------------------------------------------------------------
+		*  @brief :  1t[gpfBXNv^̃AP[^Ԃ܂. mۂĂȂꍇnullptrł.
+		*----------------------------------------------------------------------*/
+		inline const gu::SharedPointer<core::DescriptorLinearAllocator>& GetTransientAllocator() const { return _transientAllocator; }
+
 		/* @brief : Return DirectX12::CPU_DESCRIPTOR_HANDLE*/
 		inline CPU_DESC_HANDLER GetCPUDescHandler(UINT offsetIndex = 0) const
 		{
-			if (offsetIndex > _maxDescriptorCount)
-			{
-				MessageBox(NULL, L"The number of IDs has exceeded the expected number. ", L"Warning", MB_ICONWARNING);
-			}
+			Checkf(offsetIndex <= _maxDescriptorCount, "The number of IDs has exceeded the expected number. ");
 			return CPU_DESC_HANDLER(_cpuHeapPtr, offsetIndex, _descriptorSize);
 		}
 
 		/* @brief : Return DirectX12::GPU_DESCRIPTOR_HANDLE*/
 		inline GPU_DESC_HANDLER GetGPUDescHandler(UINT offsetIndex = 0) const
 		{
-			if (offsetIndex > _maxDescriptorCount)
-			{
-				MessageBox(NULL, L"The number of IDs has exceeded the expected number. ", L"Warning", MB_ICONWARNING);
-			}
+			Checkf(offsetIndex <= _maxDescriptorCount, "The number of IDs has exceeded the expected number. ");
 			return GPU_DESC_HANDLER(_gpuHeapPtr, offsetIndex, _descriptorSize);
 		}
 
@@ -115,7 +125,7 @@ namespace rhi::directX12
 			_descriptorSize     = descriptorSize;
 			_cpuHeapPtr         = cpuHeapPtr;
 			_gpuHeapPtr         = gpuHeapPtr;
-			_currentID          = INVALID_ID;
+			SetUpRange(); // Resizeł͊̃fBXNv^Rs[邽, sς݂ID͕ێ܂
 		}
 
 		/****************************************************************************
@@ -132,6 +142,17 @@ namespace rhi::directX12
 		/****************************************************************************
 		**                Private Function
 		*****************************************************************************/
+		/*----------------------------------------------------------------------
+		*  @brief :  풓p1t[p͈̔͂ݒ肵܂. 1t[p͈͔̔͂sς݂̂̂jč蒼܂.
+		*----------------------------------------------------------------------*/
+		inline void SetUpRange()
+		{
+			const UINT transientCount = _transientCount < _maxDescriptorCount ? _transientCount : 0;
+			_indexAllocator->Resize(_maxDescriptorCount - transientCount);
+
+			_transientAllocator = transientCount > 0 ?
+				gu::MakeShared<core::DescriptorLinearAllocator>(_maxDescriptorCount - transientCount, transientCount) : nullptr;
+		}
 
 		/****************************************************************************
 		**                Private Property
@@ -143,12 +164,12 @@ namespace rhi::directX12
 		UINT                        _descriptorSize = 0;
 		
 		UINT                        _maxDescriptorCount = 0;
-		
-		int                         _currentID = INVALID_ID;
 
-		std::queue<UINT> _availableID = {};
+		UINT                        _transientCount = 0; // ͈̖͂1t[p̃fBXNv^̐
+		
+		gu::SharedPointer<core::DescriptorIndexAllocator> _indexAllocator = gu::MakeShared<core::DescriptorIndexAllocator>();
 
-		static constexpr int INVALID_ID = -1;
+		gu::SharedPointer<core::DescriptorLinearAllocator> _transientAllocator = nullptr;
 	};
 }
 
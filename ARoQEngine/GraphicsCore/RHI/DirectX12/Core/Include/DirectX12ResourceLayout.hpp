@@ -71,6 +71,13 @@ namespace rhi::directX12
 		*  @return    gu::uint8
 		*************************************************************************/
 		gu::uint8 GetConstant32BitsCount() const noexcept { return _constant32BitsCount; }
+
+		/*!**********************************************************************
+		*  @brief     VACYRootSignaturẽnbVlԂ܂. pCvCXe[gLbṼL[Ɏgp܂.
+		*  @param[in] void
+		*  @return    gu::uint64
+		*************************************************************************/
+		__forceinline gu::uint64 GetRootSignatureHash() const noexcept { return _rootSignatureHash; }
 		
 		/*!**********************************************************************
 		*  @brief     Unordered Access View邩Ԃ܂
@@ -175,6 +182,9 @@ namespace rhi::directX12
 
 		/*! @brief DynamicSampler݂邩*/
 		gu::uint8 _dynamicSamplerCount = 0;
+
+		/*! @brief VACYRootSignaturẽnbVl*/
+		gu::uint64 _rootSignatureHash = 0;
 		#pragma endregion
 
 
@@ -38,6 +38,12 @@ using namespace rhi::directX12;
 using namespace Microsoft::WRL;
 using namespace gu;
 
+namespace
+{
+	/*! @brief lCeBũIuWFNg̃AhXCommandStateCache̔rL[ɂ܂*/
+	__forceinline gu::uint64 ToStateKey(const void* nativeObject) noexcept { return reinterpret_cast<gu::uint64>(nativeObject); }
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 //                          Implement
 //////////////////////////////////////////////////////////////////////////////////
@@ -107,6 +113,23 @@ void RHICommandList::BeginRecording(const bool stillMidFrame)
 		ThrowIfFailed(_commandList->Reset(static_cast<RHICommandAllocator*>(_commandAllocator.Get())->GetAllocator().Get(), nullptr));
 	}
 	
+	/*-------------------------------------------------------------------
+	-        Reset͉ݒ肳ĂȂ, ݒς݂̏Ԃj܂
+	---------------------------------------------------------------------*/
+	_stateCache.Invalidate();
+	if (!stillMidFrame) { _stateCache.ResetStatistics(); }
+
+	/*-------------------------------------------------------------------
+	-        Õt[͈͂͐̕eRecycleōėp邽, ܂
+	---------------------------------------------------------------------*/
+	if (!stillMidFrame)
+	{
+		for (auto& transientRange : _transientRanges)
+		{
+			if (transientRange.Value.Range) { transientRange.Value.Range->Reset(); }
+		}
+	}
+
 	/*-------------------------------------------------------------------
 	-        R}hXgL^\ԂɕύX܂
 	---------------------------------------------------------------------*/
@@ -200,6 +223,7 @@ void RHICommandList::Reset(const gu::SharedPointer<rhi::core::RHICommandAllocato
 	/*-------------------------------------------------------------------
 	-        R}hXgJĂԂɂ
 	---------------------------------------------------------------------*/
+	_stateCache.Invalidate();
 	_isOpen = true;
 	_beginRenderPass = false;
 }
@@ -212,7 +236,8 @@ void RHICommandList::Reset(const gu::SharedPointer<rhi::core::RHICommandAllocato
 *************************************************************************/
 void RHICommandList::BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer)
 {
-	if (_renderPass == renderPass && _frameBuffer == frameBuffer)
+	// R}hXgReset͍ēxݒ肷Kv邽, Jn̏ꍇ̂ݏȗ܂
+	if (_beginRenderPass && _renderPass == renderPass && _frameBuffer == frameBuffer)
 	{
 		return;
 	}
@@ -344,7 +369,63 @@ void RHICommandList::SetShadingRateImage(const gu::SharedPointer<core::GPUTextur
 void RHICommandList::SetDescriptorHeap(const gu::SharedPointer<core::RHIDescriptorHeap>& heap)
 {
 	const auto dxHeap = gu::StaticPointerCast<directX12::RHIDescriptorHeap>(heap);
+	if (!_stateCache.SetObject(core::CommandStateType::DescriptorHeap, ToStateKey(dxHeap->GetHeap().Get()))) { return; }
+
 	_commandList->SetDescriptorHeaps(1, dxHeap->GetHeap().GetAddressOf());
+
+	// q[v؂ւƐݒς݂̃fBXNv^e[u͖ɂȂ܂
+	_stateCache.Invalidate(core::CommandStateType::DescriptorTable);
+}
+
+/*!**********************************************************************
+*  @brief     [gp[^̃CfbNXɃfBXNv^e[uݒ肵܂. e[u̍Đݒ͎菜܂.
+*  @param[in] const gu::uint32 [gp[^̃CfbNX
+*  @param[in] const gu::uint64 fBXNv^e[u̐擪 (D3D12_GPU_DESCRIPTOR_HANDLE::ptr)
+*  @return    void
+*************************************************************************/
+void RHICommandList::SetRootDescriptorTable(const gu::uint32 index, const gu::uint64 gpuHandle)
+{
+	const bool isCompute = GetType() == core::CommandListType::Compute;
+	if (!_stateCache.SetDescriptorTable(isCompute, index, gpuHandle)) { return; }
+
+	const D3D12_GPU_DESCRIPTOR_HANDLE handle = { .ptr = gpuHandle };
+
+	if (isCompute)
+	{
+		_commandList->SetComputeRootDescriptorTable(index, handle);
+	}
+	else
+	{
+		_commandList->SetGraphicsRootDescriptorTable(index, handle);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̃t[gpAfBXNv^, R}hXgƂ͈͂̕甭s܂.
+*  @param[in]  const core::DescriptorHeapType fBXNv^̎
+*  @param[in]  const gu::uint32 
+*  @param[out] gu::uint32& 擪̃CfbNX (ނƂ͈͓̔)
+*  @return     bool 1t[p͈̔͂Ȃ, ܂͊mۂĂȂꍇfalse
+*************************************************************************/
+bool RHICommandList::AllocateTransientDescriptors(const core::DescriptorHeapType heapType, const gu::uint32 count, gu::uint32& firstIndex)
+{
+	const auto heap = _device->GetDefaultHeap(heapType);
+	if (!heap) { return false; }
+
+	const auto parent = heap->GetTransientAllocator(heapType);
+	if (!parent) { return false; }
+
+	/*-------------------------------------------------------------------
+	-        q[vResizeŐe蒼ꂽꍇ͕͈͂蒼܂
+	---------------------------------------------------------------------*/
+	auto& transientRange = _transientRanges[heapType];
+	if (transientRange.Parent.Get() != parent.Get())
+	{
+		transientRange.Parent = parent;
+		transientRange.Range  = gu::MakeShared<core::DescriptorThreadRange>(*parent);
+	}
+
+	return transientRange.Range->Allocate(count, firstIndex);
 }
 
 #pragma region Query
@@ -410,6 +491,8 @@ void RHICommandList::EndQuery(const core::QueryResultLocation& location)
 *************************************************************************/
 void RHICommandList::SetPrimitiveTopology(const core::PrimitiveTopology topology)
 {
+	if (!_stateCache.SetPrimitiveTopology(topology)) { return; }
+
 	_commandList->IASetPrimitiveTopology(EnumConverter::Convert(topology));
 }
 
@@ -439,8 +522,9 @@ void RHICommandList::SetViewport(const core::Viewport& viewport)
 		.bottom = static_cast<LONG>(viewport.TopLeftY + viewport.Height)
 	};
 
-	_commandList->RSSetViewports(1, &v);
-	_commandList->RSSetScissorRects(1, &r);
+	const core::ScissorRect rect(r.left, r.top, r.right, r.bottom);
+	if (_stateCache.SetViewports(&viewport, 1)) { _commandList->RSSetViewports(1, &v); }
+	if (_stateCache.SetScissors (&rect, 1))     { _commandList->RSSetScissorRects(1, &r); }
 }
 
 
@@ -471,8 +555,14 @@ void RHICommandList::SetViewport(const core::Viewport* viewport, const gu::uint3
 		r[i].right  = static_cast<LONG>(viewport[i].TopLeftX + viewport[i].Width);
 		r[i].bottom = static_cast<LONG>(viewport[i].TopLeftY + viewport[i].Height);
 	}
-	_commandList->RSSetViewports   (numViewport, v.Data());
-	_commandList->RSSetScissorRects(numViewport, r.Data());
+	gu::DynamicArray<core::ScissorRect> rects(numViewport);
+	for (uint32 i = 0; i < numViewport; ++i)
+	{
+		rects[i] = core::ScissorRect(r[i].left, r[i].top, r[i].right, r[i].bottom);
+	}
+
+	if (_stateCache.SetViewports(viewport, numViewport))   { _commandList->RSSetViewports   (numViewport, v.Data()); }
+	if (_stateCache.SetScissors(rects.Data(), numViewport)) { _commandList->RSSetScissorRects(numViewport, r.Data()); }
 }
 
 /*!**********************************************************************
@@ -505,8 +595,15 @@ void RHICommandList::SetStereoViewport(const core::Viewport& leftView, const cor
 		{(LONG)viewports[1].TopLeftX, (LONG)viewports[1].TopLeftY, (LONG)(viewports[1].TopLeftX + viewports[1].Width), (LONG)(viewports[1].TopLeftY + viewports[1].Height)}
 	};
 
-	_commandList->RSSetViewports   (2, viewports);
-	_commandList->RSSetScissorRects(2, scissorRects);
+	const core::Viewport views[2] = { leftView, rightView };
+	const core::ScissorRect rects[2] = 
+	{
+		core::ScissorRect(scissorRects[0].left, scissorRects[0].top, scissorRects[0].right, scissorRects[0].bottom),
+		core::ScissorRect(scissorRects[1].left, scissorRects[1].top, scissorRects[1].right, scissorRects[1].bottom)
+	};
+
+	if (_stateCache.SetViewports(views, 2)) { _commandList->RSSetViewports   (2, viewports); }
+	if (_stateCache.SetScissors (rects, 2)) { _commandList->RSSetScissorRects(2, scissorRects); }
 }
 
 /*!**********************************************************************
@@ -517,13 +614,15 @@ void RHICommandList::SetStereoViewport(const core::Viewport& leftView, const cor
 *************************************************************************/
 void RHICommandList::SetScissor(const core::ScissorRect* rect, const gu::uint32 numRect)
 {
+	if (!_stateCache.SetScissors(rect, numRect)) { return; }
+
 	gu::DynamicArray<D3D12_RECT> r(numRect);
 	for (UINT i = 0; i < numRect; ++i)
 	{
-		r[i].left   = rect->Left;
-		r[i].right  = rect->Right;
-		r[i].bottom = rect->Bottom;
-		r[i].top    = rect->Top;
+		r[i].left   = rect[i].Left;
+		r[i].right  = rect[i].Right;
+		r[i].bottom = rect[i].Bottom;
+		r[i].top    = rect[i].Top;
 	}
 	_commandList->RSSetScissorRects(numRect, r.Data());
 }
@@ -550,8 +649,8 @@ void RHICommandList::SetViewportAndScissor(const core::Viewport& viewport, const
 	r.bottom = rect.Bottom;
 	r.top    = rect.Top;
 
-	_commandList->RSSetViewports(1, &v);
-	_commandList->RSSetScissorRects(1, &r);
+	if (_stateCache.SetViewports(&viewport, 1)) { _commandList->RSSetViewports(1, &v); }
+	if (_stateCache.SetScissors (&rect, 1))     { _commandList->RSSetScissorRects(1, &r); }
 }
 
 void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer)
@@ -562,42 +661,83 @@ void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& b
 		static_cast<UINT>(buffer->GetTotalByteSize()),
 		static_cast<UINT>(buffer->GetElementByteSize())
 	};
+
+	const core::CommandStateBufferView state = { view.BufferLocation, view.SizeInBytes, view.StrideInBytes };
+	gu::uint32 changedStart = 0, changedCount = 0;
+	if (!_stateCache.SetVertexBuffers(&state, 1, 0, changedStart, changedCount)) { return; }
+
 	// Regist command list
 	_commandList->IASetVertexBuffers(0, 1, &view);
 }
 
 void RHICommandList::SetResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
 {
-	_commandList->SetGraphicsRootSignature(gu::StaticPointerCast<directX12::RHIResourceLayout>(resourceLayout)->GetRootSignature().Get());
+	const auto rootSignature = gu::StaticPointerCast<directX12::RHIResourceLayout>(resourceLayout)->GetRootSignature();
+	if (!_stateCache.SetObject(core::CommandStateType::GraphicsResourceLayout, ToStateKey(rootSignature.Get()))) { return; }
+
+	_commandList->SetGraphicsRootSignature(rootSignature.Get());
+
+	// [gVOl`؂ւƃ[gp[^͑SĖɂȂ܂
+	_stateCache.InvalidateDescriptorTables(false);
 }
 
 void RHICommandList::SetComputeResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
 {
-	_commandList->SetComputeRootSignature(gu::StaticPointerCast<directX12::RHIResourceLayout>(resourceLayout)->GetRootSignature().Get());
+	const auto rootSignature = gu::StaticPointerCast<directX12::RHIResourceLayout>(resourceLayout)->GetRootSignature();
+	if (!_stateCache.SetObject(core::CommandStateType::ComputeResourceLayout, ToStateKey(rootSignature.Get()))) { return; }
+
+	_commandList->SetComputeRootSignature(rootSignature.Get());
+	_stateCache.InvalidateDescriptorTables(true);
 }
 
 void RHICommandList::SetGraphicsPipeline(const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipelineState)
 {
 	SetPrimitiveTopology(pipelineState->GetInputAssemblyState()->GetPrimitiveTopology());
-	_commandList->SetPipelineState(gu::StaticPointerCast<directX12::GPUGraphicsPipelineState>(pipelineState)->GetPipeline().Get());
+
+	// 񓯊쐬fallback̃pCvCԂ, ɍւ邽, lCeBũpCvCŔr܂
+	const auto pipeline = gu::StaticPointerCast<directX12::GPUGraphicsPipelineState>(pipelineState)->GetPipeline();
+	if (!_stateCache.SetObject(core::CommandStateType::GraphicsPipeline, ToStateKey(pipeline.Get()))) { return; }
+
+	_commandList->SetPipelineState(pipeline.Get());
+
+	// DirectX12ł̓OtBNXƃRs[gŃpCvC̐ݒ悪ł
+	_stateCache.Invalidate(core::CommandStateType::ComputePipeline);
 }
 
 void RHICommandList::SetComputePipeline(const gu::SharedPointer<core::GPUComputePipelineState>& pipelineState)
 {
-	_commandList->SetPipelineState(gu::StaticPointerCast<directX12::GPUComputePipelineState>(pipelineState)->GetPipeline().Get());
+	const auto pipeline = gu::StaticPointerCast<directX12::GPUComputePipelineState>(pipelineState)->GetPipeline();
+	if (!_stateCache.SetObject(core::CommandStateType::ComputePipeline, ToStateKey(pipeline.Get()))) { return; }
+
+	_commandList->SetPipelineState(pipeline.Get());
+	_stateCache.Invalidate(core::CommandStateType::GraphicsPipeline);
 }
+
+/*!**********************************************************************
+*  @brief     _obt@AXbgɐݒ肵܂. O񂩂ςXbg͈݂̔͂̂1x̖߂Őݒ肵܂.
+*  @param[in] const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& _obt@̔z
+*  @param[in] const gu::uint64 擪̃Xbg
+*  @return    void
+*************************************************************************/
 void RHICommandList::SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const gu::uint64 startSlot)
 {
-	auto views = gu::DynamicArray<D3D12_VERTEX_BUFFER_VIEW>(buffers.Size());
-	for (uint64 i = 0; i < views.Size(); ++i)
+	auto views  = gu::DynamicArray<D3D12_VERTEX_BUFFER_VIEW>(buffers.Size());
+	auto states = gu::DynamicArray<core::CommandStateBufferView>(buffers.Size());
+	for (uint64 i = 0; i < buffers.Size(); ++i)
 	{
-		Check(buffers[i]->GetUsage() == core::BufferCreateFlags::VertexBuffer);
-		views[i].BufferLocation = gu::StaticPointerCast<directX12::GPUBuffer>(buffers[i])->GetResourcePtr()->GetGPUVirtualAddress();
-		views[i].SizeInBytes    = static_cast<gu::uint32>(buffers[i]->GetTotalByteSize());
-		views[i].StrideInBytes  = static_cast<gu::uint32>(buffers[i]->GetElementByteSize());
+		const auto& buffer = buffers[i];
+		Check(buffer->GetUsage() == core::BufferCreateFlags::VertexBuffer);
+		views[i].BufferLocation = gu::StaticPointerCast<directX12::GPUBuffer>(buffer)->GetResourcePtr()->GetGPUVirtualAddress();
+		views[i].SizeInBytes    = static_cast<gu::uint32>(buffer->GetTotalByteSize());
+		views[i].StrideInBytes  = static_cast<gu::uint32>(buffer->GetElementByteSize());
+		states[i] = { views[i].BufferLocation, views[i].SizeInBytes, views[i].StrideInBytes };
 	}
 
-	_commandList->IASetVertexBuffers(static_cast<gu::uint32>(startSlot), static_cast<UINT>(views.Size()), views.Data());
+	gu::uint32 changedStart = 0, changedCount = 0;
+	if (!_stateCache.SetVertexBuffers(states.Data(), static_cast<gu::uint32>(states.Size()), static_cast<gu::uint32>(startSlot), changedStart, changedCount)) { return; }
+
+	const gu::uint64 offset = changedStart - startSlot;
+	_commandList->IASetVertexBuffers(changedStart, changedCount, views.Data() + offset);
 }
 
 /*!**********************************************************************
@@ -613,6 +753,8 @@ void RHICommandList::SetIndexBuffer(const gu::SharedPointer<core::GPUBuffer>& bu
 	view.SizeInBytes    = static_cast<gu::uint32>(buffer->GetTotalByteSize());
 	view.Format         = (DXGI_FORMAT)core::PixelFormatInfo::GetConst(indexType).PlatformFormat;
 
+	if (!_stateCache.SetIndexBuffer({ view.BufferLocation, view.SizeInBytes, 0 }, indexType)) { return; }
+
 	_commandList->IASetIndexBuffer(&view);
 }
 
@@ -841,12 +983,15 @@ void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>&
 	/*-------------------------------------------------------------------
 	-         Rs[̏ԂƏIԂ̒`
 	---------------------------------------------------------------------*/
-	core::ResourceState barrierAfterStates[]   = { destination->GetResourceState(), source->GetResourceState() };
-	core::ResourceState barrierBeforeStates[]  = { CopyDestination, CopySource };
+	const core::ResourceState barrierBeforeStates[] = { destination->GetResourceState(), source->GetResourceState() };
+
+	// ɃRs[p̏Ԃɂꍇ̓oA𒣂܂. Abv[hq[vGeneralRead̂܂܃Rs[Ɏg܂.
+	const bool needsDestinationBarrier = barrierBeforeStates[0] != CopyDestination;
+	const bool needsSourceBarrier      = barrierBeforeStates[1] != CopySource && barrierBeforeStates[1] != GeneralRead;
 
 	// oAɂ, \[X̓ǂݕ`
-	_barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), barrierAfterStates[0]);
-	_barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source     ), barrierAfterStates[1]);
+	if (needsDestinationBarrier) { _barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), CopyDestination); }
+	if (needsSourceBarrier)      { _barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source     ), CopySource); }
 	_barrierBatcher->Flush(_commandList.Get());
 
 	/*-------------------------------------------------------------------
@@ -857,8 +1002,8 @@ void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>&
 	/*-------------------------------------------------------------------
 	-          ̏Ԃɖ߂
 	---------------------------------------------------------------------*/
-	_barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), barrierBeforeStates[0]);
-	_barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source)     , barrierBeforeStates[1]);
+	if (needsDestinationBarrier) { _barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), barrierBeforeStates[0]); }
+	if (needsSourceBarrier)      { _barrierBatcher->PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source)     , barrierBeforeStates[1]); }
 	_barrierBatcher->Flush(_commandList.Get());
 }
 
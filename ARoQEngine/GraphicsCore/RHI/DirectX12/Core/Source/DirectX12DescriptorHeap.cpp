@@ -248,6 +248,26 @@ void RHIDescriptorHeap::Reset(const ResetFlag flag)
 
 	}
 }
+
+/****************************************************************************
+*                     ReserveTransient
+****************************************************************************/
+/* @fn        void RHIDescriptorHeap::ReserveTransient(const core::DescriptorHeapType type, const gu::uint32 count)
+*
+*  @brief     Reserve the tail of the type range for descriptors used only in one frame.
+*             The reservation is kept across Resize. Call before allocating views of the type.
+*
+*  @param[in] const core::DescriptorHeapType type
+*  @param[in] const gu::uint32 count
+*
+*  @return @@void
+*****************************************************************************/
+void RHIDescriptorHeap::ReserveTransient(const core::DescriptorHeapType type, const gu::uint32 count)
+{
+	if (!_heapInfo.Contains(type)) { throw std::runtime_error("Not include heap type"); }
+
+	_resourceAllocators[type].SetTransientCount(count);
+}
 #pragma endregion Public Function
 #pragma region Private Function
 bool RHIDescriptorHeap::CheckCorrectViewConbination(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos)
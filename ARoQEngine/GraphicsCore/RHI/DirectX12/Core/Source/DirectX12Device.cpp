@@ -28,6 +28,8 @@
 #include "GraphicsCore/RHI/DirectX12/Resource/Include/DirectX12GPUSampler.hpp"
 #include "GraphicsCore/RHI/DirectX12/Resource/Include/DirectX12GPUResourceView.hpp"
 #include "GraphicsCore/RHI/DirectX12/PipelineState/Include/DirectX12GPUPipelineFactory.hpp"
+#include "GraphicsCore/RHI/DirectX12/PipelineState/Include/DirectX12GPUPipelineStateCache.hpp"
+#include "GraphicsCore/RHI/DirectX12/PipelineState/Include/DirectX12ShaderCacheCompiler.hpp"
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Debug.hpp"
 #include "GraphicsCore/RHI/DirectX12/RayTracing/Include/DirectX12RayTracingASInstance.hpp"
 #include "GraphicsCore/RHI/DirectX12/RayTracing/Include/DirectX12RayTracingBLASBuffer.hpp"
@@ -36,6 +38,7 @@
 #include "Platform/Core/Include/CoreOS.hpp"
 #include "GameUtility/Math/Include/GMMatrix.hpp"
 #include "GameUtility/Base/Include/GUStringConverter.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
 #include <d3d12.h>
 #include <dxgi1_6.h>
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
@@ -129,6 +132,16 @@ RHIDevice::RHIDevice(const gu::SharedPointer<core::RHIDisplayAdapter>& adapter,
 	SetupDisplayHDRMetaData();
 	SetupDefaultCommandSignatures();
 	CheckAtomicOperation();
+
+	/*-------------------------------------------------------------------
+	-        ŐNŕۑpCvCCuǂݍ
+	---------------------------------------------------------------------*/
+	_pipelineStateCache = gu::MakeShared<GPUPipelineStateCache>(_device, PIPELINE_STATE_CACHE_FILE_PATH);
+
+	/*-------------------------------------------------------------------
+	-        VF[_[̃RpCʂfBXNɃLbV
+	---------------------------------------------------------------------*/
+	_shaderCache = gu::MakeShared<core::GPUShaderCache>(gu::StaticPointerCast<core::IShaderCacheCompiler>(gu::MakeShared<ShaderCacheCompiler>()), SHADER_CACHE_DIRECTORY);
 	
 #if USE_PIX
 	_pixDLLHandle = platform::core::OS::GetDLLHandle(L"WinPixEventRuntime.dll");
@@ -170,6 +183,18 @@ void RHIDevice::SetUpDefaultHeap(const core::DefaultHeapCount& heapCount)
 	_defaultHeap[DefaultHeapType::DSV]->Resize(core::DescriptorHeapType::DSV, heapCount.DSVDescCount);
 	_defaultHeap[DefaultHeapType::Sampler]->Resize(core::DescriptorHeapType::SAMPLER, heapCount.SamplerDescCount);
 
+	/*-------------------------------------------------------------------
+	-      Reserve the per-frame range at the tail of CBV and SRV
+	---------------------------------------------------------------------*/
+	if (heapCount.TransientCBVDescCount > 0)
+	{
+		_defaultHeap[DefaultHeapType::CBV_SRV_UAV]->ReserveTransient(core::DescriptorHeapType::CBV, heapCount.TransientCBVDescCount);
+	}
+	if (heapCount.TransientSRVDescCount > 0)
+	{
+		_defaultHeap[DefaultHeapType::CBV_SRV_UAV]->ReserveTransient(core::DescriptorHeapType::SRV, heapCount.TransientSRVDescCount);
+	}
+
 }
 
 /*!**********************************************************************
@@ -184,6 +209,18 @@ void RHIDevice::Destroy()
 	DestroyIntelExtensionContext();
 #endif
 
+	/*-------------------------------------------------------------------
+	-     쐬̃pCvC҂, ̋N̂߂ɃfBXN֕ۑ
+	---------------------------------------------------------------------*/
+	if (_pipelineStateCache)
+	{
+		_pipelineStateCache->WaitIdle();
+		_pipelineStateCache->Save();
+		_pipelineStateCache.Reset();
+	}
+
+	if (_shaderCache) { _shaderCache.Reset(); }
+
 	/*-------------------------------------------------------------------
 	-              Clear default descriptor heap
 	---------------------------------------------------------------------*/
@@ -272,6 +309,7 @@ gu::SharedPointer<core::RHISwapchain>  RHIDevice::CreateSwapchain(const core::Sw
 
 gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const core::DescriptorHeapType heapType, const size_t maxDescriptorCount)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	auto heapPtr = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<directX12::RHIDescriptorHeap>(SharedFromThis()));
 	heapPtr->Resize(heapType, maxDescriptorCount);
 	return heapPtr;
@@ -279,6 +317,7 @@ gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const
 
 gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const gu::SortedMap<core::DescriptorHeapType, size_t>& heapInfo)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	auto heapPtr = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<directX12::RHIDescriptorHeap>(SharedFromThis()));
 	heapPtr->Resize(heapInfo);
 	return heapPtr;
@@ -331,16 +370,19 @@ gu::SharedPointer<core::GPUSampler> RHIDevice::CreateSampler(const core::Sampler
 
 gu::SharedPointer<core::GPUBuffer>  RHIDevice::CreateBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	return gu::StaticPointerCast<core::GPUBuffer>(gu::MakeShared<directX12::GPUBuffer>(SharedFromThis(), metaData, name));
 }
 
 gu::SharedPointer<core::GPUTexture> RHIDevice::CreateTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	return gu::StaticPointerCast<core::GPUTexture>(gu::MakeShared<directX12::GPUTexture>(SharedFromThis(), metaData, name));
 }
 
 gu::SharedPointer<core::GPUTexture> RHIDevice::CreateTextureEmpty()
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	return gu::StaticPointerCast<core::GPUTexture>(gu::MakeShared<directX12::GPUTexture>(SharedFromThis()));
 }
 
@@ -15,6 +15,7 @@
 #include "../Include/DirectX12Debug.hpp"
 #include "../Include/DirectX12EnumConverter.hpp"
 #include "../../Resource/Include/DirectX12GPUSampler.hpp"
+#include "GameUtility/Base/Include/GUHash.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -323,6 +324,8 @@ void RHIResourceLayout::SetUp()
 		return;
 	};
 
+	_rootSignatureHash = gu::Hash::XX_64(rootSigBlob->GetBufferPointer(), rootSigBlob->GetBufferSize());
+
 	_rootSignature->SetName(L"RootSignature");
 	
 }
@@ -15,6 +15,9 @@
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Core.hpp"
 #define COM_NO_WINDOWS_H
 #include <d3d12.h>
+#include <atomic>
+#include <future>
+#include <mutex>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -42,16 +45,40 @@ namespace rhi::directX12
 		*************************************************************************/
 		void CompleteSetting(const gu::tstring& name) override;
 
+		/*!**********************************************************************
+		*  @brief     pCvCobNOEhXbhō쐬܂. ܂łfallback̃pCvCŕ`悵܂.
+		*  @param[in] const gu::tstring fobO\ (쐬ɐݒ肵܂)
+		*  @param[in] const gu::SharedPointer<core::GPUGraphicsPipelineState>& ܂łɎgp쐬ς݂̃pCvC. nullptȑꍇ͎gpɊ҂܂.
+		*  @return    void
+		*************************************************************************/
+		void CompleteSettingAsync(const gu::tstring& name, const gu::SharedPointer<core::GPUGraphicsPipelineState>& fallback) override;
+
 		#pragma endregion
 
 		#pragma region Public Property
 
 		/*!**********************************************************************
-		*  @brief     DirectX12ŎgpGraphics Pipelinẽ|C^
+		*  @brief     DirectX12ŎgpGraphics Pipelinẽ|C^. @n
+		*             񓯊쐬ĂȂꍇfallback̃pCvCԂ܂. fallbackꍇ͊҂܂. @n
+		*             ͌ʂێ邽, ȍ~̌ĂяołfuturemF܂.
 		*  @param[in] void
 		*  @return    PipelineStateComPtr
 		*************************************************************************/
-		PipelineStateComPtr GetPipeline() const noexcept { return _graphicsPipeline; }
+		PipelineStateComPtr GetPipeline() const;
+
+		/*!**********************************************************************
+		*  @brief     pCvC̍쐬Ă邩Ԃ܂.
+		*  @param[in] void
+		*  @return    bool
+		*************************************************************************/
+		bool IsReady() const override;
+
+		/*!**********************************************************************
+		*  @brief     pCvCXe[gLbṼL[Ԃ܂.
+		*  @param[in] void
+		*  @return    gu::uint64
+		*************************************************************************/
+		__forceinline gu::uint64 GetPipelineHash() const noexcept { return _pipelineHash; }
 
 		/*!**********************************************************************
 		*  @brief     gPSOĐۂɎgp܂. PSÖꕔŃLbVgp邱Ƃō}܂.
@@ -65,7 +92,7 @@ namespace rhi::directX12
 		*  @param[in] const gu::tstring& name
 		*  @return    void
 		*************************************************************************/
-		void SetName(const gu::tstring& name) override { _graphicsPipeline->SetName(name.CString());}
+		void SetName(const gu::tstring& name) override { if (_graphicsPipeline) { _graphicsPipeline->SetName(name.CString()); } }
 
 		#pragma endregion
 		
@@ -74,8 +101,8 @@ namespace rhi::directX12
 		/*! @brief ftHgRXgN^*/
 		GPUGraphicsPipelineState() = default;
 		
-		/*! @brief fXgN^*/
-		~GPUGraphicsPipelineState() = default;
+		/*! @brief fXgN^. 񓯊쐬̏ꍇ, LqqQƂXe[gێ܂܊҂܂*/
+		~GPUGraphicsPipelineState();
 		
 		/*! @brief RenderPassResourceLayoutgď*/
 		explicit GPUGraphicsPipelineState(
@@ -88,15 +115,38 @@ namespace rhi::directX12
 	protected:
 
 		#pragma region Protected Function
+		/*! @brief eXe[gDirectX12̃pCvCLqq쐬܂*/
+		D3D12_GRAPHICS_PIPELINE_STATE_DESC CreateDesc() const;
+
+		/*! @brief 񓯊쐬pCvC_graphicsPipelineɕێ, LbVƖOݒ肵܂. 쐬̏ꍇ͊҂܂*/
+		PipelineStateComPtr LatchPendingPipeline() const;
 		#pragma endregion
 
 		#pragma region Protected Property
 
-		/*! @brief DirectX12gpGraphics Pipeline*/
-		PipelineStateComPtr _graphicsPipeline = nullptr;
+		/*! @brief DirectX12gpGraphics Pipeline. 񓯊쐬̏ꍇ͊ɍŏɎgpXbhݒ肵܂*/
+		mutable PipelineStateComPtr _graphicsPipeline = nullptr;
 
 		/*! @brief pCvC̍ۂɎgpLbV*/
-		BlobComPtr _cachePSO = nullptr;
+		mutable BlobComPtr _cachePSO = nullptr;
+
+		/*! @brief 񓯊쐬̃pCvC*/
+		std::shared_future<PipelineStateComPtr> _pendingPipeline = {};
+
+		/*! @brief 񓯊쐬̊ɐݒ肷fobO\*/
+		gu::tstring _pendingName = {};
+
+		/*! @brief _graphicsPipelineݒς݂. ̃XbhL^ꍇfuturemFɓǂ߂悤ɂ܂*/
+		mutable std::atomic<bool> _isPipelineLatched = false;
+
+		/*! @brief 񓯊쐬̌ʂ_graphicsPipelineɐݒ肷ۂ̔r*/
+		mutable std::mutex _latchMutex;
+
+		/*! @brief 񓯊쐬܂ŎgppCvC*/
+		gu::SharedPointer<core::GPUGraphicsPipelineState> _fallbackPipeline = nullptr;
+
+		/*! @brief pCvCXe[gLbṼL[*/
+		gu::uint64 _pipelineHash = 0;
 
 		#pragma endregion
 	};
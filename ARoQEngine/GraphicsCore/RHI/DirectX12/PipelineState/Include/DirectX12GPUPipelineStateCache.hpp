@@ -12,10 +12,24 @@
 //////////////////////////////////////////////////////////////////////////////////
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Core.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+#include "GameUtility/Container/Include/GUSortedMap.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <future>
+#include <mutex>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
+struct D3D12_COMPUTE_PIPELINE_STATE_DESC;
+
+namespace gu
+{
+	class ThreadPool;
+}
 
 //////////////////////////////////////////////////////////////////////////////////
 //                               Class
@@ -23,58 +37,202 @@
 
 namespace rhi::directX12
 {
+	/****************************************************************************
+	*				  			   GPUPipelineStateCacheStatistics
+	****************************************************************************/
+	/* @brief  pCvCXe[gLbV̓vł. NԂ̔rɎgp܂.
+	*****************************************************************************/
+	struct GPUPipelineStateCacheStatistics
+	{
+		/*! @brief 쐬v̑*/
+		gu::uint64 RequestCount = 0;
+
+		/*! @brief sɍ쐬ς, ܂͍쐬̃pCvCėp*/
+		gu::uint64 RuntimeHitCount = 0;
+
+		/*! @brief fBXÑpCvCCuǂݍ񂾉*/
+		gu::uint64 LibraryHitCount = 0;
+
+		/*! @brief hCoŃRpC*/
+		gu::uint64 CompileCount = 0;
+
+		/*! @brief obNOEhXbhō쐬Jn*/
+		gu::uint64 AsyncRequestCount = 0;
+
+		/*! @brief pCvC̍쐬 (RpCƃCu̓ǂݍ) Ɋ|v [ms]*/
+		double CreateMilliseconds = 0.0;
+
+		/*! @brief LbVt@C̓ǂݍ݂ƃpCvCCu̍쐬Ɋ| [ms]*/
+		double OpenMilliseconds = 0.0;
+
+		/*! @brief LbVt@C݂̏Ɋ| [ms]*/
+		double SaveMilliseconds = 0.0;
+	};
+
 	/****************************************************************************
 	*				  			   DirectX12PipelineStateCache
 	****************************************************************************/
 	/* @brief  DirecrtX12̃pCvCXe[gLbVNX@n
-	*          pCvCXe[g̓ԂςȂꍇ, LbVg܂킷Ƃ, ʂGPUɃR}h𔭍sȂ悤ɂ܂
+	*          pCvCXe[g̓ԂςȂꍇ, LbVg܂킷Ƃ, ʂGPUɃR}h𔭍sȂ悤ɂ܂ @n
+	*          L[͑SẴXe[g̋Lqq, VF[_[̃oCgR[h, RootSignature狁߂nbVlł. @n
+	*          1. s, 쐬ς݂܂͍쐬̃pCvCL܂ @n
+	*          2. ID3D12PipelineLibraryɍ쐬pCvCi[, SaveŃfBXNɏoƂŎÑRpCȂ܂ @n
+	*          hCoA_v^ςꍇ, ǂݍ񂾃LbV͔jč蒼܂.
 	*****************************************************************************/
-	class GPUPipelineStateCache
+	class GPUPipelineStateCache : public gu::NonCopyable
 	{
 	public:
-		#pragma region Public Function
+		using PipelineFuture = std::shared_future<PipelineStateComPtr>;
 
-		#pragma endregion 
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     OtBNXpCvC̋LqqLbṼL[߂܂. CachedPSO͊܂݂܂.
+		*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+		*  @param[in] const gu::uint64 VACYRootSignaturẽnbVl
+		*  @return    gu::uint64 nbVl
+		*************************************************************************/
+		static gu::uint64 ComputeHash(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 rootSignatureHash);
+
+		/*!**********************************************************************
+		*  @brief     Rs[gpCvC̋LqqLbṼL[߂܂. CachedPSO͊܂݂܂.
+		*  @param[in] const D3D12_COMPUTE_PIPELINE_STATE_DESC& Lqq
+		*  @param[in] const gu::uint64 VACYRootSignaturẽnbVl
+		*  @return    gu::uint64 nbVl
+		*************************************************************************/
+		static gu::uint64 ComputeHash(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const gu::uint64 rootSignatureHash);
+
+		/*!**********************************************************************
+		*  @brief     LbVɂpCvCԂ܂. ꍇ̓Cu̓ǂݍ݂RpCs, ܂ő҂܂.
+		*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+		*  @param[in] const gu::uint64 ComputeHashŋ߂nbVl
+		*  @return    PipelineStateComPtr
+		*************************************************************************/
+		PipelineStateComPtr GetOrCreate(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 hash);
+
+		/*!**********************************************************************
+		*  @brief     LbVɂpCvCԂ܂. ꍇ̓Cu̓ǂݍ݂RpCs, ܂ő҂܂.
+		*  @param[in] const D3D12_COMPUTE_PIPELINE_STATE_DESC& Lqq
+		*  @param[in] const gu::uint64 ComputeHashŋ߂nbVl
+		*  @return    PipelineStateComPtr
+		*************************************************************************/
+		PipelineStateComPtr GetOrCreate(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const gu::uint64 hash);
+
+		/*!**********************************************************************
+		*  @brief     LbVɖꍇ, obNOEhXbhŃpCvC쐬܂.
+		*  @note      LqqwVF[_[RootSignature, Ԃfuture܂ŌĂяoŕێĂ.
+		*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+		*  @param[in] const gu::uint64 ComputeHashŋ߂nbVl
+		*  @return    PipelineFuture 쐬ɃpCvCԂfuture
+		*************************************************************************/
+		PipelineFuture GetOrCreateAsync(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 hash);
+
+		/*!**********************************************************************
+		*  @brief     Vi[pCvCꍇ, pCvCCuVACYăt@Cɏo܂.
+		*  @param[in] void
+		*  @return    bool oɎsꍇfalse
+		*************************************************************************/
+		bool Save();
+
+		/*!**********************************************************************
+		*  @brief     쐬̃pCvCSđ҂܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void WaitIdle();
+		#pragma endregion
 
 		#pragma region Public Property
+		/*! @brief LbVt@Č`ςꍇɍXV܂*/
+		static constexpr gu::uint32 FILE_VERSION = 1;
 
-		#pragma endregion 
+		/*! @brief v*/
+		GPUPipelineStateCacheStatistics GetStatistics() const;
 
-		#pragma region Public Operator 
+		/*! @brief fBXNLbVgp\ (hCopCvCCuT|[gĂ邩)*/
+		__forceinline bool IsPersistent() const noexcept { return _library != nullptr; }
 
-		#pragma endregion 
+		/*! @brief LbVt@C̃pX*/
+		__forceinline const gu::tstring& GetFilePath() const noexcept { return _filePath; }
+		#pragma endregion
 
 		#pragma region Public Constructor and Destructor
+		/*! @brief _foCXƃLbVt@C̃pXŏ܂. t@C΃pCvCCuǂݍ݂܂*/
+		GPUPipelineStateCache(const DeviceComPtr& device, const gu::tstring& filePath);
 
-		#pragma endregion 
+		/*! @brief fXgN^. 쐬̃pCvC҂܂. t@Cւ̏o͍sȂ, SaveĂł*/
+		~GPUPipelineStateCache();
+		#pragma endregion
 
 	protected:
-		#pragma region Protected Constructor and Destructor
+		#pragma region Protected Function
+		/*! @brief LbVt@Cǂݍ, pCvCCu쐬܂*/
+		void OpenLibrary();
 
-		#pragma endregion 
+		/*! @brief Cu̓ǂݍ݂RpCŃOtBNXpCvC쐬܂*/
+		PipelineStateComPtr CreatePipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 hash);
 
-		#pragma region Protected Function
+		/*! @brief Cu̓ǂݍ݂RpCŃRs[gpCvC쐬܂*/
+		PipelineStateComPtr CreatePipeline(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const gu::uint64 hash);
 
-		#pragma endregion 
+		/*! @brief RpCpCvCCuɊi[܂*/
+		void StorePipeline(const wchar_t* name, const PipelineStateComPtr& pipeline);
 
-		#pragma region Protected Property
+		/*! @brief LbVς݂쐬futureT܂. ꍇpromisefutureo^, Ăяo쐬S܂*/
+		bool FindOrRegister(const gu::uint64 hash, std::promise<PipelineStateComPtr>& promise, PipelineFuture& future);
 
+		/*! @brief 쐬ʂ𓝌vɉ܂*/
+		void RecordCreate(const bool isLibraryHit, const double milliseconds);
+
+		/*! @brief pCvCCuɊi[閼O*/
+		static void GetLibraryName(const gu::uint64 hash, wchar_t (&name)[17]);
 		#pragma endregion
 
-	private:
-		#pragma region Private Constructor and Destructor
+		#pragma region Protected Property
+		/*! @brief LbVt@C̐擪ɏޏ*/
+		struct FileHeader
+		{
+			gu::uint32 Magic    = 0;
+			gu::uint32 Version  = 0;
+			gu::uint64 ByteSize = 0;
+		};
 
-		#pragma endregion
+		/*! @brief LbVt@C̎ʎq 'APSO'*/
+		static constexpr gu::uint32 FILE_MAGIC = 0x4F535041;
+
+		/*! @brief _foCX*/
+		DeviceComPtr _device = nullptr;
+
+		/*! @brief fBXNɕۑpCvCCu. T|[gȂꍇnullptr*/
+		PipelineLibraryComPtr _library = nullptr;
+
+		/*! @brief pCvCCuQƂVACYς݃f[^. Cu蒷ێKv܂*/
+		gu::DynamicArray<gu::uint8> _libraryData = {};
 
-		#pragma region Private Function
+		/*! @brief LbVt@C̃pX*/
+		gu::tstring _filePath = SP("");
 
-		#pragma endregion 
+		/*! @brief nbVlƂ̍쐬ς, ܂͍쐬̃pCvC*/
+		gu::SortedMap<gu::uint64, PipelineFuture> _pipelines = {};
 
-		#pragma region Private Property
+		/*! @brief obNOEhRpCp̃Xbhv[. ŏ̔񓯊vō쐬܂*/
+		gu::SharedPointer<gu::ThreadPool> _threadPool = nullptr;
 
-		#pragma endregion 
+		/*! @brief v*/
+		GPUPipelineStateCacheStatistics _statistics = {};
 
+		/*! @brief _pipelines, _threadPool, _statisticsی삵܂*/
+		mutable std::mutex _mutex = {};
+
+		/*! @brief pCvCCuւ̃ANZXی삵܂*/
+		std::mutex _libraryMutex = {};
+
+		/*! @brief Saveȍ~ɐVpCvCi[*/
+		bool _isLibraryDirty = false;
+
+		/*! @brief pso_cache_statsœv\܂*/
+		bool _printStatistics = false;
+		#pragma endregion
 	};
 
 }
-#endif
\ No newline at end of file
+#endif
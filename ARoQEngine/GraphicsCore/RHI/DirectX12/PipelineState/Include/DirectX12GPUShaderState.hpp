@@ -92,19 +92,15 @@ namespace rhi::directX12
 
 		#pragma region Protected Function
 		/*!**********************************************************************
-		*  @brief     ShaderModel6.0ȏœ삵܂.DXILƂԌɃRpC܂ 
+		*  @brief     ShaderModel6.0ȏœ삵܂.DXILƂԌɃRpC܂. @n
+		*             RpCʂ̓foCX̃VF[_[LbV擾, ꍇ̂݃RpC܂.
 		*  @param[in] const core::ShaderCompilerOption	
 		*  @return    void
 		*************************************************************************/
 		void DXILCompile(const core::ShaderCompilerOption& option);
-		
-		/*!**********************************************************************
-		*  @brief     ShaderModel6.0ȏœ삵܂. https://simoncoenen.com/blog/programming/graphics/DxcCompiling
-		*  @param[in] const core::ShaderCompilerOption& 
-		*  @param[out]gu::DynamicArray<const gu::tchar*>& R}hC̈ 
-		*  @return    void
-		*************************************************************************/
-		void SetupDXILArguments(const core::ShaderCompilerOption& option, gu::DynamicArray<const gu::tchar*>& arguments);
+
+		/*! @brief LbṼoCgD3DBlobɃRs[܂*/
+		BlobComPtr CreateBlob(const gu::DynamicArray<gu::uint8>& data) const;
 
 		BlobComPtr DxCompile(const gu::tstring& fileName, const D3D_SHADER_MACRO* defines, const gu::tstring& entryPoint, const gu::tstring& target);
 		
@@ -0,0 +1,82 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DirectX12ShaderCacheCompiler.hpp
+///  @brief  VF[_[LbVgpDXC̃RpCł. DXC̃CX^X̓XbhƂɎg񂵂܂.
+///  @author toide
+///  @date   2026/10/20 14:02:37
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef DIRECTX12_SHADER_CACHE_COMPILER_HPP
+#define DIRECTX12_SHADER_CACHE_COMPILER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUShaderCache.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace rhi::directX12
+{
+	/****************************************************************************
+	*				  			ShaderCacheCompiler
+	****************************************************************************/
+	/* @brief  ShaderModel6.0ȏ̃VF[_[DXILɃRpC܂. @n
+	*          IDxcUtils, IDxcCompiler3, includenh̓XbhƂ1x쐬, ȍ~̃RpCŎg񂵂܂. @n
+	*          ǂݍ񂾃C̃\[Xincludet@C͑SēẽnbVlƋɈˑt@CƂĕԂ܂.
+	*****************************************************************************/
+	class ShaderCacheCompiler : public core::IShaderCacheCompiler
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     VF[_[RpC܂. ̃Xbh瓯ɌĂ΂܂.
+		*  @param[in]  const core::ShaderCompilerOption& RpCݒ
+		*  @param[out] core::ShaderCacheBlob& oCgR[hƃtNVf[^
+		*  @param[out] gu::DynamicArray<core::ShaderDependency>& ǂݍ񂾑SẴt@CƂ̓ẽnbVl
+		*  @return     bool RpCɐꍇtrue
+		*************************************************************************/
+		virtual bool Compile(const core::ShaderCompilerOption& option, core::ShaderCacheBlob& result, gu::DynamicArray<core::ShaderDependency>& dependencies) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     DXC̃o[Wƃrhݒ (̍œKxς邽) 狁߂nbVlł.
+		*  @param[in] void
+		*  @return    gu::uint64
+		*************************************************************************/
+		virtual gu::uint64 GetCompilerHash() const override { return _compilerHash; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^. DXC̃o[W擾܂*/
+		ShaderCacheCompiler();
+
+		/*! @brief fXgN^*/
+		~ShaderCacheCompiler() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*!**********************************************************************
+		*  @brief     DXCɓnR}hC̈ݒ肵܂. https://simoncoenen.com/blog/programming/graphics/DxcCompiling
+		*  @param[in]  const core::ShaderCompilerOption& RpCݒ
+		*  @param[in]  const gu::DynamicArray<gu::tstring>& QƂ镶 (-T, -Fc, -Fo). ĂяoŃRpCI܂ŕێ܂
+		*  @param[out] gu::DynamicArray<const gu::tchar*>& R}hC̈
+		*  @return     void
+		*************************************************************************/
+		void SetupArguments(const core::ShaderCompilerOption& option, const gu::DynamicArray<gu::tstring>& storage, gu::DynamicArray<const gu::tchar*>& arguments) const;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief RpC̃nbVl*/
+		gu::uint64 _compilerHash = 0;
+		#pragma endregion
+	};
+}
+#endif
@@ -14,10 +14,13 @@
 #include "../Include/DirectX12GPUInputAssemblyState.hpp"
 #include "../Include/DirectX12GPURasterizerState.hpp"
 #include "../Include/DirectX12GPUShaderState.hpp"
+#include "../Include/DirectX12GPUPipelineStateCache.hpp"
 #include "../../Core/Include/DirectX12ResourceLayout.hpp"
 #include "../../Core/Include/DirectX12Device.hpp"
 #include "../../Core/Include/DirectX12Debug.hpp"
 #include "../../Core/Include/DirectX12EnumConverter.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <chrono>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
 //////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +30,14 @@ using namespace rhi::directX12;
 //                          Implement
 //////////////////////////////////////////////////////////////////////////////////
 #pragma region Graphic PSO
+GPUGraphicsPipelineState::~GPUGraphicsPipelineState()
+{
+	if (_pendingPipeline.valid())
+	{
+		_pendingPipeline.wait();
+	}
+}
+
 /*!**********************************************************************
 *  @brief     ComputePipeline쐬ł^C~Oœ삳܂. Descriptor쐬܂.
 *  @param[in] const gu::tstring fobO\
@@ -34,9 +45,126 @@ using namespace rhi::directX12;
 *************************************************************************/
 void GPUGraphicsPipelineState::CompleteSetting(const gu::tstring& name)
 {
-	DeviceComPtr dxDevice = nullptr;
-	dxDevice = static_cast<RHIDevice*>(_device.Get())->GetDevice();
+	if (_pendingPipeline.valid())
+	{
+		_pendingPipeline.wait();
+	}
+
+	const auto rhiDevice = static_cast<RHIDevice*>(_device.Get());
+	const auto desc      = CreateDesc();
+
+	/*-------------------------------------------------------------------
+	-       Create Graphic pipelineState (Lqq̃pCvC͍ėp܂)
+	---------------------------------------------------------------------*/
+	const auto rootSignatureHash = _resourceLayout ? static_cast<RHIResourceLayout*>(_resourceLayout.Get())->GetRootSignatureHash() : 0;
+	_pipelineHash     = GPUPipelineStateCache::ComputeHash(desc, rootSignatureHash);
+	_graphicsPipeline = rhiDevice->GetPipelineStateCache()->GetOrCreate(desc, _pipelineHash);
+	_pendingPipeline  = {};
+	_fallbackPipeline = nullptr;
+
+	_graphicsPipeline->GetCachedBlob(_cachePSO.ReleaseAndGetAddressOf());
+	SetName(name);
+	_isPipelineLatched.store(true, std::memory_order_release);
+}
+
+/*!**********************************************************************
+*  @brief     pCvCobNOEhXbhō쐬܂. ܂łfallback̃pCvCŕ`悵܂.
+*  @param[in] const gu::tstring fobO\ (쐬ɐݒ肵܂)
+*  @param[in] const gu::SharedPointer<core::GPUGraphicsPipelineState>& ܂łɎgp쐬ς݂̃pCvC
+*  @return    void
+*************************************************************************/
+void GPUGraphicsPipelineState::CompleteSettingAsync(const gu::tstring& name, const gu::SharedPointer<core::GPUGraphicsPipelineState>& fallback)
+{
+	Checkf(fallback.Get() != this, "fallback must be another pipeline state");
+
+	// Lqq̓Xe[g̃|C^QƂ邽, 쐬̃pCvC΃Xe[gOɑ҂܂
+	if (_pendingPipeline.valid())
+	{
+		_pendingPipeline.wait();
+	}
+
+	const auto rhiDevice = static_cast<RHIDevice*>(_device.Get());
+	const auto desc      = CreateDesc();
+
+	const auto rootSignatureHash = _resourceLayout ? static_cast<RHIResourceLayout*>(_resourceLayout.Get())->GetRootSignatureHash() : 0;
+	_pipelineHash     = GPUPipelineStateCache::ComputeHash(desc, rootSignatureHash);
+	_isPipelineLatched.store(false, std::memory_order_relaxed);
+	_pendingPipeline  = rhiDevice->GetPipelineStateCache()->GetOrCreateAsync(desc, _pipelineHash);
+	_pendingName      = name;
+	_fallbackPipeline = fallback;
+	_graphicsPipeline = nullptr;
+	_cachePSO         = nullptr;
+}
+
+/*!**********************************************************************
+*  @brief     DirectX12ŎgpGraphics Pipelinẽ|C^. @n
+*             񓯊쐬ĂȂꍇfallback̃pCvCԂ܂. fallbackꍇ͊҂܂. @n
+*             ͌ʂێ邽, ȍ~̌ĂяołfuturemF܂.
+*  @param[in] void
+*  @return    PipelineStateComPtr
+*************************************************************************/
+PipelineStateComPtr GPUGraphicsPipelineState::GetPipeline() const
+{
+	if (_isPipelineLatched.load(std::memory_order_acquire) || !_pendingPipeline.valid())
+	{
+		return _graphicsPipeline;
+	}
+
+	if (_fallbackPipeline && _pendingPipeline.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+	{
+		return static_cast<GPUGraphicsPipelineState*>(_fallbackPipeline.Get())->GetPipeline();
+	}
+
+	return LatchPendingPipeline();
+}
+
+/*!**********************************************************************
+*  @brief     pCvC̍쐬Ă邩Ԃ܂.
+*  @param[in] void
+*  @return    bool
+*************************************************************************/
+bool GPUGraphicsPipelineState::IsReady() const
+{
+	if (_isPipelineLatched.load(std::memory_order_acquire) || !_pendingPipeline.valid()) { return true; }
+
+	if (_pendingPipeline.wait_for(std::chrono::seconds(0)) != std::future_status::ready) { return false; }
+
+	LatchPendingPipeline();
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     񓯊쐬pCvC_graphicsPipelineɕێ, LbVƖOݒ肵܂. @n
+*             ̃Xbh瓯ɌĂ΂ꂽꍇݒ1񂾂s܂. 쐬̏ꍇ͊҂܂.
+*  @param[in] void
+*  @return    PipelineStateComPtr
+*************************************************************************/
+PipelineStateComPtr GPUGraphicsPipelineState::LatchPendingPipeline() const
+{
+	std::scoped_lock lock(_latchMutex);
+	if (_isPipelineLatched.load(std::memory_order_relaxed))
+	{
+		return _graphicsPipeline;
+	}
 
+	_graphicsPipeline = _pendingPipeline.get();
+	if (_graphicsPipeline)
+	{
+		_graphicsPipeline->GetCachedBlob(_cachePSO.ReleaseAndGetAddressOf());
+		_graphicsPipeline->SetName(_pendingName.CString());
+	}
+
+	_isPipelineLatched.store(true, std::memory_order_release);
+	return _graphicsPipeline;
+}
+
+/*!**********************************************************************
+*  @brief     eXe[gDirectX12̃pCvCLqq쐬܂
+*  @param[in] void
+*  @return    D3D12_GRAPHICS_PIPELINE_STATE_DESC
+*************************************************************************/
+D3D12_GRAPHICS_PIPELINE_STATE_DESC GPUGraphicsPipelineState::CreateDesc() const
+{
 	/*-------------------------------------------------------------------
 	-                      Set Descriptor
 	---------------------------------------------------------------------*/
@@ -63,23 +191,13 @@ void GPUGraphicsPipelineState::CompleteSetting(const gu::tstring& name)
 	desc.SampleDesc.Quality    = 0;
 	desc.SampleMask            = UINT_MAX;
 
-	if (_cachePSO)
-	{
-		desc.CachedPSO = D3D12_CACHED_PIPELINE_STATE{ _cachePSO->GetBufferPointer(), _cachePSO->GetBufferSize() };
-	}
-
 	for (gu::uint32 i = 0; i < _renderPass->GetColorAttachmentSize(); ++i)
 	{
 		const auto format = _renderPass->GetColorAttachment(i)->Format;
 		desc.RTVFormats[i] = (DXGI_FORMAT)core::PixelFormatInfo::GetConst(format).PlatformFormat;
 	}
-	
-	/*-------------------------------------------------------------------
-	-                      Create Graphic pipelineState
-	---------------------------------------------------------------------*/
-	ThrowIfFailed(dxDevice->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(_graphicsPipeline.GetAddressOf())));
-	_graphicsPipeline->GetCachedBlob(_cachePSO.GetAddressOf());
-	SetName(name);
+
+	return desc;
 }
 #pragma endregion Graphic PSO
 
@@ -91,7 +209,7 @@ void GPUGraphicsPipelineState::CompleteSetting(const gu::tstring& name)
 *************************************************************************/
 void GPUComputePipelineState::CompleteSetting(const gu::tstring& name)
 {
-	const auto dxDevice = gu::StaticPointerCast<directX12::RHIDevice>(_device)->GetDevice();
+	const auto rhiDevice = gu::StaticPointerCast<directX12::RHIDevice>(_device);
 	const auto dxLayout = gu::StaticPointerCast<directX12::RHIResourceLayout>(_resourceLayout);
 	const auto dxShader = gu::StaticPointerCast<directX12::GPUShaderState>(_computeShaderState);
 
@@ -104,13 +222,12 @@ void GPUComputePipelineState::CompleteSetting(const gu::tstring& name)
 	desc.pRootSignature = _resourceLayout ? dxLayout->GetRootSignature().Get() : nullptr;
 	desc.NodeMask       = _device->GetGPUMask().Value();
 	
-	if (_cachePSO)
-	{
-		desc.CachedPSO = D3D12_CACHED_PIPELINE_STATE{ _cachePSO->GetBufferPointer(), _cachePSO->GetBufferSize() };
-	}
-	
-	ThrowIfFailed(dxDevice->CreateComputePipelineState(&desc, IID_PPV_ARGS(&_computePipeline)));
-	_computePipeline->GetCachedBlob(_cachePSO.GetAddressOf());
+	/*-------------------------------------------------------------------
+	-       Create Compute pipelineState (Lqq̃pCvC͍ėp܂)
+	---------------------------------------------------------------------*/
+	const auto pipelineHash = GPUPipelineStateCache::ComputeHash(desc, _resourceLayout ? dxLayout->GetRootSignatureHash() : 0);
+	_computePipeline = rhiDevice->GetPipelineStateCache()->GetOrCreate(desc, pipelineHash);
+	_computePipeline->GetCachedBlob(_cachePSO.ReleaseAndGetAddressOf());
 	SetName(name);
 }
 
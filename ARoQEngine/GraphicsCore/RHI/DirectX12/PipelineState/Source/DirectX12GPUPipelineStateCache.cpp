@@ -0,0 +1,624 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DirectX12GPUPipelineStateCache.cpp
+///  @brief  DirecrtX12̃pCvCXe[gLbVNX
+///  @author toide
+///  @date   2026/10/20 11:04:27
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/DirectX12GPUPipelineStateCache.hpp"
+#include "../../Core/Include/DirectX12Debug.hpp"
+#include "Platform/Core/Include/CoreFileSystem.hpp"
+#include "GameUtility/Base/Include/GUHash.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUParse.hpp"
+#include "GameUtility/Base/Include/GUCommandLine.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <d3d12.h>
+#include <chrono>
+#include <cstdio>
+#include <cwchar>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::directX12;
+
+namespace
+{
+	/****************************************************************************
+	*				  			   PipelineStateHasher
+	****************************************************************************/
+	/* @brief  Lqq̃tB[hɃoCg֋l, Ōɂ܂Ƃ߂ănbV܂. @n
+	*          \̂̃pfBO܂߂Ȃ悤, tB[hPʂŒǉ܂.
+	*****************************************************************************/
+	struct PipelineStateHasher
+	{
+		gu::DynamicArray<gu::uint8> Bytes = {};
+
+		template<typename T>
+		void Add(const T& value)
+		{
+			const auto offset = Bytes.Size();
+			Bytes.Resize(offset + sizeof(T), true);
+			gu::Memory::Copy(Bytes.Data() + offset, &value, sizeof(T));
+		}
+
+		void AddString(const char* text)
+		{
+			if (text == nullptr) { Add<gu::uint8>(0); return; }
+
+			for (; *text != '\0'; ++text) { Add(*text); }
+			Add<char>('\0');
+		}
+
+		void AddShader(const D3D12_SHADER_BYTECODE& shader)
+		{
+			Add<gu::uint64>(shader.BytecodeLength);
+			Add<gu::uint64>(shader.pShaderBytecode ? gu::Hash::XX_64(shader.pShaderBytecode, shader.BytecodeLength) : 0);
+		}
+
+		void AddStencilOperation(const D3D12_DEPTH_STENCILOP_DESC& desc)
+		{
+			Add(desc.StencilFailOp);
+			Add(desc.StencilDepthFailOp);
+			Add(desc.StencilPassOp);
+			Add(desc.StencilFunc);
+		}
+
+		gu::uint64 Finish() const
+		{
+			return gu::Hash::XX_64(Bytes.Data(), Bytes.Size());
+		}
+	};
+
+	/*! @brief oߎ [ms]*/
+	double GetElapsedMilliseconds(const std::chrono::steady_clock::time_point& start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUPipelineStateCache::GPUPipelineStateCache(const DeviceComPtr& device, const gu::tstring& filePath)
+	: _device(device), _filePath(filePath)
+{
+	Checkf(_device, "device is nullptr");
+
+	_printStatistics = gu::Parse::Contains(gu::CommandLine::Get(), SP("pso_cache_stats"));
+
+	OpenLibrary();
+}
+
+GPUPipelineStateCache::~GPUPipelineStateCache()
+{
+	WaitIdle();
+
+	_threadPool.Reset();
+	_pipelines.Clear();
+	_library.Reset();
+	_libraryData.Clear();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     OtBNXpCvC̋LqqLbṼL[߂܂. CachedPSO͊܂݂܂.
+*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 VACYRootSignaturẽnbVl
+*  @return    gu::uint64 nbVl
+*************************************************************************/
+gu::uint64 GPUPipelineStateCache::ComputeHash(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 rootSignatureHash)
+{
+	PipelineStateHasher hasher = {};
+	hasher.Bytes.Reserve(512);
+
+	hasher.Add<gu::uint8>(0); // graphics
+	hasher.Add(rootSignatureHash);
+
+	/*-------------------------------------------------------------------
+	-                      Shader
+	---------------------------------------------------------------------*/
+	hasher.AddShader(desc.VS);
+	hasher.AddShader(desc.PS);
+	hasher.AddShader(desc.DS);
+	hasher.AddShader(desc.HS);
+	hasher.AddShader(desc.GS);
+
+	hasher.Add(desc.StreamOutput.NumEntries);
+	for (gu::uint32 i = 0; i < desc.StreamOutput.NumEntries; ++i)
+	{
+		const auto& entry = desc.StreamOutput.pSODeclaration[i];
+		hasher.Add(entry.Stream);
+		hasher.AddString(entry.SemanticName);
+		hasher.Add(entry.SemanticIndex);
+		hasher.Add(entry.StartComponent);
+		hasher.Add(entry.ComponentCount);
+		hasher.Add(entry.OutputSlot);
+	}
+	hasher.Add(desc.StreamOutput.NumStrides);
+	for (gu::uint32 i = 0; i < desc.StreamOutput.NumStrides; ++i)
+	{
+		hasher.Add(desc.StreamOutput.pBufferStrides[i]);
+	}
+	hasher.Add(desc.StreamOutput.RasterizedStream);
+
+	/*-------------------------------------------------------------------
+	-                      Blend state
+	---------------------------------------------------------------------*/
+	hasher.Add(desc.BlendState.AlphaToCoverageEnable);
+	hasher.Add(desc.BlendState.IndependentBlendEnable);
+	for (const auto& renderTarget : desc.BlendState.RenderTarget)
+	{
+		hasher.Add(renderTarget.BlendEnable);
+		hasher.Add(renderTarget.LogicOpEnable);
+		hasher.Add(renderTarget.SrcBlend);
+		hasher.Add(renderTarget.DestBlend);
+		hasher.Add(renderTarget.BlendOp);
+		hasher.Add(renderTarget.SrcBlendAlpha);
+		hasher.Add(renderTarget.DestBlendAlpha);
+		hasher.Add(renderTarget.BlendOpAlpha);
+		hasher.Add(renderTarget.LogicOp);
+		hasher.Add(renderTarget.RenderTargetWriteMask);
+	}
+	hasher.Add(desc.SampleMask);
+
+	/*-------------------------------------------------------------------
+	-                      Rasterizer state
+	---------------------------------------------------------------------*/
+	hasher.Add(desc.RasterizerState.FillMode);
+	hasher.Add(desc.RasterizerState.CullMode);
+	hasher.Add(desc.RasterizerState.FrontCounterClockwise);
+	hasher.Add(desc.RasterizerState.DepthBias);
+	hasher.Add(desc.RasterizerState.DepthBiasClamp);
+	hasher.Add(desc.RasterizerState.SlopeScaledDepthBias);
+	hasher.Add(desc.RasterizerState.DepthClipEnable);
+	hasher.Add(desc.RasterizerState.MultisampleEnable);
+	hasher.Add(desc.RasterizerState.AntialiasedLineEnable);
+	hasher.Add(desc.RasterizerState.ForcedSampleCount);
+	hasher.Add(desc.RasterizerState.ConservativeRaster);
+
+	/*-------------------------------------------------------------------
+	-                      Depth stencil state
+	---------------------------------------------------------------------*/
+	hasher.Add(desc.DepthStencilState.DepthEnable);
+	hasher.Add(desc.DepthStencilState.DepthWriteMask);
+	hasher.Add(desc.DepthStencilState.DepthFunc);
+	hasher.Add(desc.DepthStencilState.StencilEnable);
+	hasher.Add(desc.DepthStencilState.StencilReadMask);
+	hasher.Add(desc.DepthStencilState.StencilWriteMask);
+	hasher.AddStencilOperation(desc.DepthStencilState.FrontFace);
+	hasher.AddStencilOperation(desc.DepthStencilState.BackFace);
+
+	/*-------------------------------------------------------------------
+	-                      Input layout
+	---------------------------------------------------------------------*/
+	hasher.Add(desc.InputLayout.NumElements);
+	for (gu::uint32 i = 0; i < desc.InputLayout.NumElements; ++i)
+	{
+		const auto& element = desc.InputLayout.pInputElementDescs[i];
+		hasher.AddString(element.SemanticName);
+		hasher.Add(element.SemanticIndex);
+		hasher.Add(element.Format);
+		hasher.Add(element.InputSlot);
+		hasher.Add(element.AlignedByteOffset);
+		hasher.Add(element.InputSlotClass);
+		hasher.Add(element.InstanceDataStepRate);
+	}
+	hasher.Add(desc.IBStripCutValue);
+	hasher.Add(desc.PrimitiveTopologyType);
+
+	/*-------------------------------------------------------------------
+	-                      Render pass
+	---------------------------------------------------------------------*/
+	hasher.Add(desc.NumRenderTargets);
+	for (gu::uint32 i = 0; i < desc.NumRenderTargets; ++i)
+	{
+		hasher.Add(desc.RTVFormats[i]);
+	}
+	hasher.Add(desc.DSVFormat);
+	hasher.Add(desc.SampleDesc.Count);
+	hasher.Add(desc.SampleDesc.Quality);
+	hasher.Add(desc.NodeMask);
+	hasher.Add(desc.Flags);
+
+	return hasher.Finish();
+}
+
+/*!**********************************************************************
+*  @brief     Rs[gpCvC̋LqqLbṼL[߂܂. CachedPSO͊܂݂܂.
+*  @param[in] const D3D12_COMPUTE_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 VACYRootSignaturẽnbVl
+*  @return    gu::uint64 nbVl
+*************************************************************************/
+gu::uint64 GPUPipelineStateCache::ComputeHash(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const gu::uint64 rootSignatureHash)
+{
+	PipelineStateHasher hasher = {};
+
+	hasher.Add<gu::uint8>(1); // compute
+	hasher.Add(rootSignatureHash);
+	hasher.AddShader(desc.CS);
+	hasher.Add(desc.NodeMask);
+	hasher.Add(desc.Flags);
+
+	return hasher.Finish();
+}
+
+/*!**********************************************************************
+*  @brief     LbVɂpCvCԂ܂. ꍇ̓Cu̓ǂݍ݂RpCs, ܂ő҂܂.
+*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 ComputeHashŋ߂nbVl
+*  @return    PipelineStateComPtr
+*************************************************************************/
+PipelineStateComPtr GPUPipelineStateCache::GetOrCreate(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 hash)
+{
+	std::promise<PipelineStateComPtr> promise = {};
+	PipelineFuture future = {};
+
+	if (FindOrRegister(hash, promise, future)) { return future.get(); }
+
+	try
+	{
+		const auto pipeline = CreatePipeline(desc, hash);
+		promise.set_value(pipeline);
+		return pipeline;
+	}
+	catch (...)
+	{
+		promise.set_exception(std::current_exception());
+		throw;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     LbVɂpCvCԂ܂. ꍇ̓Cu̓ǂݍ݂RpCs, ܂ő҂܂.
+*  @param[in] const D3D12_COMPUTE_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 ComputeHashŋ߂nbVl
+*  @return    PipelineStateComPtr
+*************************************************************************/
+PipelineStateComPtr GPUPipelineStateCache::GetOrCreate(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const gu::uint64 hash)
+{
+	std::promise<PipelineStateComPtr> promise = {};
+	PipelineFuture future = {};
+
+	if (FindOrRegister(hash, promise, future)) { return future.get(); }
+
+	try
+	{
+		const auto pipeline = CreatePipeline(desc, hash);
+		promise.set_value(pipeline);
+		return pipeline;
+	}
+	catch (...)
+	{
+		promise.set_exception(std::current_exception());
+		throw;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     LbVɖꍇ, obNOEhXbhŃpCvC쐬܂.
+*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 ComputeHashŋ߂nbVl
+*  @return    PipelineFuture 쐬ɃpCvCԂfuture
+*************************************************************************/
+GPUPipelineStateCache::PipelineFuture GPUPipelineStateCache::GetOrCreateAsync(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 hash)
+{
+	std::scoped_lock lock(_mutex);
+
+	_statistics.RequestCount++;
+
+	if (_pipelines.Contains(hash))
+	{
+		_statistics.RuntimeHitCount++;
+		return _pipelines.At(hash);
+	}
+
+	/*-------------------------------------------------------------------
+	-     `XbhWȂ悤, RA̔RpCɎgp܂
+	---------------------------------------------------------------------*/
+	if (!_threadPool)
+	{
+		const auto threadCount = std::thread::hardware_concurrency() / 2;
+		_threadPool = gu::MakeShared<gu::ThreadPool>(threadCount > 0 ? threadCount : 1);
+	}
+
+	_statistics.AsyncRequestCount++;
+
+	const auto future = _threadPool->Submit([this, desc, hash]() { return CreatePipeline(desc, hash); }).share();
+	_pipelines[hash] = future;
+	return future;
+}
+
+/*!**********************************************************************
+*  @brief     Vi[pCvCꍇ, pCvCCuVACYăt@Cɏo܂.
+*  @param[in] void
+*  @return    bool oɎsꍇfalse
+*************************************************************************/
+bool GPUPipelineStateCache::Save()
+{
+	if (!_library) { return false; }
+
+	std::scoped_lock lock(_libraryMutex);
+
+	if (!_isLibraryDirty) { return true; }
+
+	const auto start = std::chrono::steady_clock::now();
+
+	/*-------------------------------------------------------------------
+	-                 Serialize pipeline library
+	---------------------------------------------------------------------*/
+	FileHeader header = {};
+	header.Magic    = FILE_MAGIC;
+	header.Version  = FILE_VERSION;
+	header.ByteSize = _library->GetSerializedSize();
+
+	gu::DynamicArray<gu::uint8> data(header.ByteSize);
+	if (FAILED(_library->Serialize(data.Data(), data.Size())))
+	{
+		return false;
+	}
+
+	/*-------------------------------------------------------------------
+	-                 Write file
+	---------------------------------------------------------------------*/
+	{
+		const auto fileHandle = platform::core::IFileSystem::Get()->OpenWrite(_filePath, false, false, false);
+		if (!fileHandle) { return false; }
+
+		if (!fileHandle->Write(&header, sizeof(FileHeader)) || !fileHandle->Write(data.Data(), data.Size()))
+		{
+			return false;
+		}
+	}
+
+	_isLibraryDirty = false;
+
+	/*-------------------------------------------------------------------
+	-                 Statistics
+	---------------------------------------------------------------------*/
+	const auto statistics = [&]()
+	{
+		std::scoped_lock statisticsLock(_mutex);
+		_statistics.SaveMilliseconds = GetElapsedMilliseconds(start);
+		return _statistics;
+	}();
+
+	if (_printStatistics)
+	{
+		printf("PSO cache : request %llu, runtime hit %llu, library hit %llu, compile %llu, async %llu, create %.2f ms, open %.2f ms, save %.2f ms (%llu bytes)\n",
+			statistics.RequestCount, statistics.RuntimeHitCount, statistics.LibraryHitCount, statistics.CompileCount, statistics.AsyncRequestCount,
+			statistics.CreateMilliseconds, statistics.OpenMilliseconds, statistics.SaveMilliseconds, header.ByteSize);
+	}
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     쐬̃pCvCSđ҂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void GPUPipelineStateCache::WaitIdle()
+{
+	gu::DynamicArray<PipelineFuture> futures = {};
+	{
+		std::scoped_lock lock(_mutex);
+		futures.Reserve(_pipelines.Size());
+		for (const auto& pipeline : _pipelines)
+		{
+			futures.Push(pipeline.Value);
+		}
+	}
+
+	for (const auto& future : futures)
+	{
+		future.wait();
+	}
+}
+#pragma endregion Public Function
+
+#pragma region Public Property
+/*!**********************************************************************
+*  @brief     vԂ܂.
+*  @param[in] void
+*  @return    GPUPipelineStateCacheStatistics
+*************************************************************************/
+GPUPipelineStateCacheStatistics GPUPipelineStateCache::GetStatistics() const
+{
+	std::scoped_lock lock(_mutex);
+	return _statistics;
+}
+#pragma endregion Public Property
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     LbVt@Cǂݍ, pCvCCu쐬܂. @n
+*             hCoA_v^قȂ, ܂̓t@CĂꍇ͋̃Cun߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void GPUPipelineStateCache::OpenLibrary()
+{
+	const auto start      = std::chrono::steady_clock::now();
+	const auto fileSystem = platform::core::IFileSystem::Get();
+
+	/*-------------------------------------------------------------------
+	-                 Read file
+	---------------------------------------------------------------------*/
+	if (fileSystem->FileExists(_filePath))
+	{
+		const auto fileHandle = fileSystem->OpenRead(_filePath, false, false);
+
+		FileHeader header = {};
+		if (fileHandle && fileHandle->Read(&header, sizeof(FileHeader)) &&
+			header.Magic   == FILE_MAGIC &&
+			header.Version == FILE_VERSION &&
+			static_cast<gu::uint64>(fileHandle->Size()) == sizeof(FileHeader) + header.ByteSize)
+		{
+			_libraryData.Resize(header.ByteSize);
+			if (!fileHandle->Read(_libraryData.Data(), _libraryData.Size()))
+			{
+				_libraryData.Clear();
+			}
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-                 Create pipeline library
+	---------------------------------------------------------------------*/
+	HRESULT result = _device->CreatePipelineLibrary(_libraryData.IsEmpty() ? nullptr : _libraryData.Data(), _libraryData.Size(), IID_PPV_ARGS(_library.GetAddressOf()));
+
+	// D3D12_ERROR_DRIVER_VERSION_MISMATCH, D3D12_ERROR_ADAPTER_NOT_FOUND, E_INVALIDARG : ÂLbV͔jď㏑܂
+	if (FAILED(result) && !_libraryData.IsEmpty())
+	{
+		_libraryData.Clear();
+		_isLibraryDirty = true;
+		result = _device->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(_library.ReleaseAndGetAddressOf()));
+	}
+
+	// DXGI_ERROR_UNSUPPORTED : s̏dr̂ݍs܂
+	if (FAILED(result))
+	{
+		_library.Reset();
+		_isLibraryDirty = false;
+	}
+
+	_statistics.OpenMilliseconds = GetElapsedMilliseconds(start);
+
+	if (_printStatistics)
+	{
+		printf("PSO cache : open %.2f ms (%llu bytes%s)\n", _statistics.OpenMilliseconds, static_cast<gu::uint64>(_libraryData.Size()), _library ? "" : ", pipeline library unsupported");
+	}
+}
+
+/*!**********************************************************************
+*  @brief     Cu̓ǂݍ݂RpCŃOtBNXpCvC쐬܂
+*  @param[in] const D3D12_GRAPHICS_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 nbVl
+*  @return    PipelineStateComPtr
+*************************************************************************/
+PipelineStateComPtr GPUPipelineStateCache::CreatePipeline(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const gu::uint64 hash)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	wchar_t name[17] = {};
+	GetLibraryName(hash, name);
+
+	// Cu͓œ܂. O̓ǂݍ݂̂݋֎~܂, FindOrRegister1XbhɌ肵Ă܂
+	PipelineStateComPtr pipeline = nullptr;
+	const bool isLibraryHit = _library && SUCCEEDED(_library->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(pipeline.GetAddressOf())));
+
+	if (!isLibraryHit)
+	{
+		ThrowIfFailed(_device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(pipeline.ReleaseAndGetAddressOf())));
+		StorePipeline(name, pipeline);
+	}
+
+	RecordCreate(isLibraryHit, GetElapsedMilliseconds(start));
+	return pipeline;
+}
+
+/*!**********************************************************************
+*  @brief     Cu̓ǂݍ݂RpCŃRs[gpCvC쐬܂
+*  @param[in] const D3D12_COMPUTE_PIPELINE_STATE_DESC& Lqq
+*  @param[in] const gu::uint64 nbVl
+*  @return    PipelineStateComPtr
+*************************************************************************/
+PipelineStateComPtr GPUPipelineStateCache::CreatePipeline(const D3D12_COMPUTE_PIPELINE_STATE_DESC& desc, const gu::uint64 hash)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	wchar_t name[17] = {};
+	GetLibraryName(hash, name);
+
+	PipelineStateComPtr pipeline = nullptr;
+	const bool isLibraryHit = _library && SUCCEEDED(_library->LoadComputePipeline(name, &desc, IID_PPV_ARGS(pipeline.GetAddressOf())));
+
+	if (!isLibraryHit)
+	{
+		ThrowIfFailed(_device->CreateComputePipelineState(&desc, IID_PPV_ARGS(pipeline.ReleaseAndGetAddressOf())));
+		StorePipeline(name, pipeline);
+	}
+
+	RecordCreate(isLibraryHit, GetElapsedMilliseconds(start));
+	return pipeline;
+}
+
+/*!**********************************************************************
+*  @brief     RpCpCvCCuɊi[܂. SaveŃt@Cɏo܂.
+*  @param[in] const wchar_t* CuɊi[閼O
+*  @param[in] const PipelineStateComPtr& pCvC
+*  @return    void
+*************************************************************************/
+void GPUPipelineStateCache::StorePipeline(const wchar_t* name, const PipelineStateComPtr& pipeline)
+{
+	if (!_library) { return; }
+
+	std::scoped_lock lock(_libraryMutex);
+
+	// Oi[ς݂̏ꍇE_INVALIDARGԂ܂, e͓Ȃ̂Ŗ܂
+	if (SUCCEEDED(_library->StorePipeline(name, pipeline.Get())))
+	{
+		_isLibraryDirty = true;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     LbVς݂쐬futureT܂. ꍇpromisefutureo^, Ăяo쐬S܂
+*  @param[in]  const gu::uint64 nbVl
+*  @param[in]  std::promise<PipelineStateComPtr>& 쐬Sꍇɓo^promise
+*  @param[out] PipelineFuture& future
+*  @return     bool ꍇtrue
+*************************************************************************/
+bool GPUPipelineStateCache::FindOrRegister(const gu::uint64 hash, std::promise<PipelineStateComPtr>& promise, PipelineFuture& future)
+{
+	std::scoped_lock lock(_mutex);
+
+	_statistics.RequestCount++;
+
+	if (_pipelines.Contains(hash))
+	{
+		_statistics.RuntimeHitCount++;
+		future = _pipelines.At(hash);
+		return true;
+	}
+
+	_pipelines[hash] = promise.get_future().share();
+	return false;
+}
+
+/*!**********************************************************************
+*  @brief     쐬ʂ𓝌vɉ܂
+*  @param[in] const bool Cuǂݍ񂾂
+*  @param[in] const double 쐬Ɋ| [ms]
+*  @return    void
+*************************************************************************/
+void GPUPipelineStateCache::RecordCreate(const bool isLibraryHit, const double milliseconds)
+{
+	std::scoped_lock lock(_mutex);
+
+	if (isLibraryHit) { _statistics.LibraryHitCount++; }
+	else              { _statistics.CompileCount++; }
+
+	_statistics.CreateMilliseconds += milliseconds;
+}
+
+/*!**********************************************************************
+*  @brief     pCvCCuɊi[閼O (nbVl16i\L) 쐬܂
+*  @param[in]  const gu::uint64 nbVl
+*  @param[out] wchar_t (&)[17] O
+*  @return     void
+*************************************************************************/
+void GPUPipelineStateCache::GetLibraryName(const gu::uint64 hash, wchar_t (&name)[17])
+{
+	swprintf_s(name, L"%016llX", hash);
+}
+#pragma endregion Protected Function
@@ -12,13 +12,15 @@
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12EnumConverter.hpp"
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Core.hpp"
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Debug.hpp"
+#include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Device.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUShaderCache.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
 #include "GameUtility/Base/Include/GUAssert.hpp"
 #include "Platform/Core/Include/CoreFileSystem.hpp"
 #include "GameUtility/File/Include/UnicodeUtility.hpp"
 #include <sstream>
 #include <fstream>
 #include <d3dcompiler.h>
-#include <dxcapi.h>
 
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -129,230 +131,36 @@ void GPUShaderState::LoadBinary(const core::ShaderType type, const gu::tstring&
 }
 
 #pragma region DxCompile
+/*!**********************************************************************
+*  @brief     ShaderModel6.0ȏœ삵܂. DXILƂԌɃRpC܂. @n
+*             \[X, include, defineł΃foCX̃VF[_[LbV (, fBXN) ̌ʂgp܂.
+*  @param[in] const core::ShaderCompilerOption& 
+*  @return    void
+*************************************************************************/
 void GPUShaderState::DXILCompile(const core::ShaderCompilerOption& option)
 {
-	const auto fileSystem = platform::core::IFileSystem::Get();
-
-	/*-------------------------------------------------------------------
-	-         DXCCu쐬, VF[_[R[h̓ǂݍ݂RpCs
-	---------------------------------------------------------------------*/
-	ComPtr<IDxcLibrary> dxcLibrary = nullptr;
-	ThrowIfFailed(DxcCreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(dxcLibrary.GetAddressOf())));
-	
-	/*-------------------------------------------------------------------
-	-          DXCRpC쐬
-	---------------------------------------------------------------------*/
-	ComPtr<IDxcCompiler3> dxcCompiler = nullptr;
-	ThrowIfFailed(DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&dxcCompiler)));
-
-	/*-------------------------------------------------------------------
-	-			DXC̃tNVpUtilNX쐬
-	---------------------------------------------------------------------*/
-	ComPtr<IDxcUtils> dxcUtils = nullptr;
-	ThrowIfFailed(DxcCreateInstance(CLSID_DxcUtils, IID_PPV_ARGS(&dxcUtils)));
-
-	/*-------------------------------------------------------------------
-	-			\[XR[h̏쐬
-	---------------------------------------------------------------------*/
-	ComPtr<IDxcBlobEncoding> sourceBlob = nullptr;
-	UINT32 codePage = CP_UTF8;
-	ThrowIfFailed(dxcLibrary->CreateBlobFromFile(option.FileName.CString(), &codePage, &sourceBlob));
-
-	const DxcBuffer sourceBuffer = { sourceBlob->GetBufferPointer(), sourceBlob->GetBufferSize(), codePage };
-
-	/*-------------------------------------------------------------------
-	-			Includer̍쐬
-	---------------------------------------------------------------------*/
-	ComPtr<IDxcIncludeHandler> dxcIncludeHandler = nullptr;
-	dxcLibrary->CreateIncludeHandler(&dxcIncludeHandler);
-
-	/*-------------------------------------------------------------------
-	-                  Create Blob data of the source code
-	---------------------------------------------------------------------*/
-	gu::DynamicArray<const gu::tchar*> arguments = {};
-	SetupDXILArguments(option, arguments);
-
-	/*-------------------------------------------------------------------
-	-         VF[_[^[Qbgݒ ex) vs_6.0, ps_6.1... ([JϐɂȂƐɓȂߐ؂o܂)
-	---------------------------------------------------------------------*/
-	const gu::tstring target = GetShaderTypeName(option.Type) + SP("_") + gu::tstring(Format(option.Version));
-	arguments.Push(L"-T");
-	arguments.Push(target.CString());
-
-	/*-------------------------------------------------------------------
-	-         RpC̎s
-	---------------------------------------------------------------------*/
-	ComPtr<IDxcResult> compileResult = nullptr;
-
-	ThrowIfFailed(dxcCompiler->Compile(&sourceBuffer, arguments.Data(), (gu::uint32)arguments.Size(), dxcIncludeHandler.Get(),IID_PPV_ARGS(compileResult.GetAddressOf())));
-
-	if (!compileResult)
-	{
-		return;
-	}
-
-	/*-------------------------------------------------------------------
-	-         RpCꍇbytecodeԂ
-	---------------------------------------------------------------------*/
-	HRESULT compileStatus = S_OK;
-	compileResult->GetStatus(&compileStatus);
-
-	if (SUCCEEDED(compileStatus))
-	{
-		/*-------------------------------------------------------------------
-		-         VF[_[R[h擾
-		---------------------------------------------------------------------*/
-		ComPtr<IDxcBlobUtf16> sourceCodeNameBlob = nullptr;
-		Check  (compileResult->HasOutput(DXC_OUT_OBJECT));
-		ThrowIfFailed(compileResult->GetOutput(DXC_OUT_OBJECT, IID_PPV_ARGS(_sourceBlob.GetAddressOf()), sourceCodeNameBlob.GetAddressOf()));
-		
-		/*-------------------------------------------------------------------
-		-         VF[_[tNV擾
-		---------------------------------------------------------------------*/
-		ComPtr<IDxcBlobUtf16> reflectionNameBlob = nullptr;
-		Check  (compileResult->HasOutput(DXC_OUT_REFLECTION));
-		ThrowIfFailed(compileResult->GetOutput(DXC_OUT_REFLECTION, IID_PPV_ARGS(_reflectionBlob.GetAddressOf()), reflectionNameBlob.GetAddressOf()));
-		
-		/*-------------------------------------------------------------------
-		-         t@Co
-		---------------------------------------------------------------------*/
-		if (!option.DebugOutputDirectory.IsEmpty())
-		{
-			/*const auto      reflectionFileName = option.DebugOutputDirectory + SP("\\") + fileSystem->GetFileName(option.FileName) + SP(".d3dasm");
-			const auto      reflectionFile     = fileSystem->OpenWrite(reflectionFileName);
-			const DxcBuffer reflectionBuffer   = { _reflectionBlob->GetBufferPointer(), _reflectionBlob->GetBufferSize() };
-			ComPtr<ID3D12LibraryReflection> libraryReflection = nullptr;
-			dxcUtils->CreateReflection(&reflectionBuffer, IID_PPV_ARGS(&libraryReflection));*/
+	const auto rhiDevice   = gu::StaticPointerCast<directX12::RHIDevice>(_device);
+	const auto shaderCache = rhiDevice->GetShaderCache();
+	Check(shaderCache);
 
-		}
+	const auto blob = shaderCache->GetOrCompile(option);
+	Confirmf(blob, "Failed to compile shader");
 
-		return;
-	}
-	
-	if (!compileResult) { return; }
-
-	/*-------------------------------------------------------------------
-	-         RpCoȂꍇ, G[bZ[Wo
-	---------------------------------------------------------------------*/
-	ComPtr <IDxcBlobEncoding> errorBlob = nullptr;
-	const auto errorResult = compileResult->GetErrorBuffer(&errorBlob);
-	if (SUCCEEDED(errorResult) && errorBlob)
-	{
-		gu::string errorMessage = "Compilation failed with errors: \n%hs\n";
-		errorMessage += (const char*)errorBlob->GetBufferPointer();
-		_RPTN(_CRT_ERROR, "%s", errorMessage.CString());
-	}
+	_sourceBlob     = CreateBlob(blob->ByteCode);
+	_reflectionBlob = blob->Reflection.IsEmpty() ? nullptr : CreateBlob(blob->Reflection);
 }
 
 /*!**********************************************************************
-*  @brief     ShaderModel6.0ȏœ삵܂.
-*  @param[in] const core::ShaderCompilerOption&
-*  @param[out]gu::DynamicArray<const gu::tchar*>& R}hC̈
-*  @return    void
+*  @brief     LbṼoCgD3DBlobɃRs[܂.
+*  @param[in] const gu::DynamicArray<gu::uint8>& oCg
+*  @return    BlobComPtr
 *************************************************************************/
-void GPUShaderState::SetupDXILArguments(const core::ShaderCompilerOption& option, gu::DynamicArray<const gu::tchar*>& arguments)
+BlobComPtr GPUShaderState::CreateBlob(const gu::DynamicArray<gu::uint8>& data) const
 {
-	const auto fileSystem = platform::core::IFileSystem::Get();
-
-	arguments.Reserve(2 * (option.IncludeDirectories.Size() + option.Defines.Size() + 4)); // +4 is for -T, -E -Fc, -Fo
-	for (const auto& directory : option.IncludeDirectories)
-	{
-		arguments.Push(L"-I");
-		arguments.Push(directory.CString());
-	}
-
-	/*-------------------------------------------------------------------
-	-               fobOs, DXIL̒ԌeLXgo͂
-	---------------------------------------------------------------------*/
-	if (!option.DebugOutputDirectory.IsEmpty())
-	{
-		const auto asmFileName  = option.DebugOutputDirectory + SP("\\") + fileSystem->GetFileName(option.FileName) + SP(".d3dasm");
-		const auto dxilFileName = option.DebugOutputDirectory + SP("\\") + fileSystem->GetFileName(option.FileName) + SP(".cso");
-		arguments.Push(L" -Fc");
-		arguments.Push(asmFileName.CString());
-
-		arguments.Push(L" -Fo ");
-		arguments.Push(dxilFileName.CString());
-	}
-
-	/*-------------------------------------------------------------------
-	-        œKݒ
-	---------------------------------------------------------------------*/
-	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::Debug))
-	{
-		arguments.Push(L"-Od");
-	}
-	else if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::LowLevelOptimization))
-	{
-		arguments.Push(L"-O1");
-	}
-	else
-	{
-	#if _DEBUG
-		arguments.Push(L"-Od");
-	#else
-		arguments.Push(L"-O3");
-	#endif
-	}
-
-	/*-------------------------------------------------------------------
-	-        x
-	---------------------------------------------------------------------*/
-	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::WarningAsErrors))
-	{
-		arguments.Push(L"-WX");
-	}
-	else if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::NoWarnings))
-	{
-		arguments.Push(L"-no-warnings");
-	}
-
-	/*-------------------------------------------------------------------
-	-        PDBt@C𐶐
-	---------------------------------------------------------------------*/
-	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::GenerateDebugSymbol))
-	{
-		if(gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::DebugNameForSource))
-		{
-			arguments.Push(L"-Zss");
-		}
-		else if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::DebugNameForBinary))
-		{
-			arguments.Push(L"-Zsb");
-		}
-		else
-		{
-			arguments.Push(L"-Zsb");
-		}
-
-		arguments.Push(L"-Zi");
-		arguments.Push(L"-Qembed_debug");
-		arguments.Push(L"-Fd");
-		arguments.Push(L".\\");
-	}
-
-	/*-------------------------------------------------------------------
-	-        BindingSpace肷
-	---------------------------------------------------------------------*/
-	if(gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::AutoBindingSpace))
-	{
-		arguments.Push(L"-auto-binding-space");
-	}
-
-	/*-------------------------------------------------------------------
-	-         Gg|Cgݒ
-	---------------------------------------------------------------------*/
-	arguments.Push(L"-E");
-	arguments.Push(option.EntryPoint.CString());
-
-	/*-------------------------------------------------------------------
-	-         }Nݒ
-	---------------------------------------------------------------------*/
-	for (const auto& define : option.Defines)
-	{
-		arguments.Push(L"-D");
-		arguments.Push(define.CString());
-	}
+	BlobComPtr blob = nullptr;
+	ThrowIfFailed(D3DCreateBlob(data.Size(), blob.GetAddressOf()));
+	gu::Memory::Copy(blob->GetBufferPointer(), data.Data(), data.Size());
+	return blob;
 }
 
 BlobComPtr GPUShaderState::DxCompile(const gu::tstring& fileName, const D3D_SHADER_MACRO* defines, const gu::tstring& entryPoint, const gu::tstring& target)
@@ -0,0 +1,362 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DirectX12ShaderCacheCompiler.cpp
+///  @brief  VF[_[LbVgpDXC̃RpCł. DXC̃CX^X̓XbhƂɎg񂵂܂.
+///  @author toide
+///  @date   2026/10/20 14:02:37
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/DirectX12ShaderCacheCompiler.hpp"
+#include "../Include/DirectX12GPUShaderState.hpp"
+#include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Core.hpp"
+#include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Debug.hpp"
+#include "Platform/Core/Include/CoreFileSystem.hpp"
+#include "GameUtility/Base/Include/GUHash.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <dxcapi.h>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::directX12;
+
+namespace
+{
+	/****************************************************************************
+	*				  			DXCContext
+	****************************************************************************/
+	/* @brief  XbhƂɕێDXC̃CX^Xł. IDxcCompiler3̓XbhZ[tł͂ȂߋL܂.
+	*****************************************************************************/
+	struct DXCContext
+	{
+		ComPtr<IDxcUtils>          Utils          = nullptr;
+		ComPtr<IDxcCompiler3>      Compiler       = nullptr;
+		ComPtr<IDxcIncludeHandler> IncludeHandler = nullptr;
+	};
+
+	/*! @brief ĂяoXbhDXC̃CX^XԂ܂. ŏ̌Ăяoō쐬܂*/
+	DXCContext& GetThreadContext()
+	{
+		thread_local DXCContext context = {};
+
+		if (!context.Compiler)
+		{
+			ThrowIfFailed(DxcCreateInstance(CLSID_DxcUtils   , IID_PPV_ARGS(context.Utils.GetAddressOf())));
+			ThrowIfFailed(DxcCreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(context.Compiler.GetAddressOf())));
+			ThrowIfFailed(context.Utils->CreateDefaultIncludeHandler(context.IncludeHandler.GetAddressOf()));
+		}
+		return context;
+	}
+
+	/*! @brief ˑt@CƂċL^܂. t@C𕡐ǂݍ񂾏ꍇ1xL^܂*/
+	void RecordDependency(gu::DynamicArray<core::ShaderDependency>& dependencies, const gu::tchar* filePath, IDxcBlob* blob)
+	{
+		const gu::tstring path(filePath);
+		for (const auto& dependency : dependencies)
+		{
+			if (dependency.FilePath == path) { return; }
+		}
+
+		core::ShaderDependency dependency = {};
+		dependency.FilePath    = path;
+		dependency.ContentHash = gu::Hash::XX_64(blob->GetBufferPointer(), blob->GetBufferSize());
+		dependencies.Push(dependency);
+	}
+
+	/****************************************************************************
+	*				  			RecordingIncludeHandler
+	****************************************************************************/
+	/* @brief  includenhœǂݍ, ǂݍ񂾃t@Cˑt@CƂċL^܂. @n
+	*          RpCX^bNɒu, QƃJEg͊Ǘ܂.
+	*****************************************************************************/
+	class RecordingIncludeHandler final : public IDxcIncludeHandler
+	{
+	public:
+		HRESULT STDMETHODCALLTYPE LoadSource(LPCWSTR fileName, IDxcBlob** includeSource) override
+		{
+			const auto result = _handler->LoadSource(fileName, includeSource);
+			if (SUCCEEDED(result) && includeSource && *includeSource)
+			{
+				RecordDependency(_dependencies, fileName, *includeSource);
+			}
+			return result;
+		}
+
+		HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** object) override
+		{
+			if (riid == __uuidof(IDxcIncludeHandler) || riid == __uuidof(IUnknown))
+			{
+				*object = static_cast<IDxcIncludeHandler*>(this);
+				return S_OK;
+			}
+
+			*object = nullptr;
+			return E_NOINTERFACE;
+		}
+
+		ULONG STDMETHODCALLTYPE AddRef () override { return 1; }
+		ULONG STDMETHODCALLTYPE Release() override { return 1; }
+
+		RecordingIncludeHandler(IDxcIncludeHandler* handler, gu::DynamicArray<core::ShaderDependency>& dependencies)
+			: _handler(handler), _dependencies(dependencies) {};
+
+	private:
+		IDxcIncludeHandler* _handler = nullptr;
+		gu::DynamicArray<core::ShaderDependency>& _dependencies;
+	};
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+ShaderCacheCompiler::ShaderCacheCompiler()
+{
+	/*-------------------------------------------------------------------
+	-      DXC̃o[Wςꍇ̓fBXÑLbVgp܂
+	---------------------------------------------------------------------*/
+	struct CompilerVersion
+	{
+		gu::uint32 Major       = 0;
+		gu::uint32 Minor       = 0;
+		gu::uint32 CommitCount = 0;
+		gu::uint32 IsDebug     = 0;
+	} version = {};
+
+#if _DEBUG
+	version.IsDebug = 1;
+#endif
+
+	const auto& context = GetThreadContext();
+
+	ComPtr<IDxcVersionInfo> versionInfo = nullptr;
+	if (SUCCEEDED(context.Compiler.As(&versionInfo)))
+	{
+		versionInfo->GetVersion(&version.Major, &version.Minor);
+	}
+
+	ComPtr<IDxcVersionInfo2> versionInfo2 = nullptr;
+	if (SUCCEEDED(context.Compiler.As(&versionInfo2)))
+	{
+		char* commitHash = nullptr;
+		if (SUCCEEDED(versionInfo2->GetCommitInfo(&version.CommitCount, &commitHash)))
+		{
+			CoTaskMemFree(commitHash);
+		}
+	}
+
+	_compilerHash = gu::Hash::XX_64(&version, sizeof(version));
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     VF[_[RpC܂. ̃Xbh瓯ɌĂ΂܂.
+*  @param[in]  const core::ShaderCompilerOption& RpCݒ
+*  @param[out] core::ShaderCacheBlob& oCgR[hƃtNVf[^
+*  @param[out] gu::DynamicArray<core::ShaderDependency>& ǂݍ񂾑SẴt@CƂ̓ẽnbVl
+*  @return     bool RpCɐꍇtrue
+*************************************************************************/
+bool ShaderCacheCompiler::Compile(const core::ShaderCompilerOption& option, core::ShaderCacheBlob& result, gu::DynamicArray<core::ShaderDependency>& dependencies)
+{
+	auto& context = GetThreadContext();
+
+	/*-------------------------------------------------------------------
+	-			\[XR[h̓ǂݍ
+	---------------------------------------------------------------------*/
+	ComPtr<IDxcBlobEncoding> sourceBlob = nullptr;
+	UINT32 codePage = CP_UTF8;
+	if (FAILED(context.Utils->LoadFile(option.FileName.CString(), &codePage, sourceBlob.GetAddressOf())))
+	{
+		_RPTN(_CRT_WARN, "Failed to load shader file: %ls\n", option.FileName.CString());
+		return false;
+	}
+
+	RecordDependency(dependencies, option.FileName.CString(), sourceBlob.Get());
+
+	const DxcBuffer sourceBuffer = { sourceBlob->GetBufferPointer(), sourceBlob->GetBufferSize(), codePage };
+
+	/*-------------------------------------------------------------------
+	-      R}hC̈ (QƂ镶̓RpCI܂ŕێ܂)
+	---------------------------------------------------------------------*/
+	const auto fileSystem = platform::core::IFileSystem::Get();
+	gu::DynamicArray<gu::tstring> storage = {};
+	storage.Push(GPUShaderState::GetShaderTypeName(option.Type) + SP("_") + GPUShaderState::Format(option.Version));
+	if (!option.DebugOutputDirectory.IsEmpty())
+	{
+		storage.Push(option.DebugOutputDirectory + SP("\\") + fileSystem->GetFileName(option.FileName) + SP(".d3dasm"));
+		storage.Push(option.DebugOutputDirectory + SP("\\") + fileSystem->GetFileName(option.FileName) + SP(".cso"));
+	}
+
+	gu::DynamicArray<const gu::tchar*> arguments = {};
+	SetupArguments(option, storage, arguments);
+
+	/*-------------------------------------------------------------------
+	-         RpC̎s
+	---------------------------------------------------------------------*/
+	RecordingIncludeHandler includeHandler(context.IncludeHandler.Get(), dependencies);
+
+	ComPtr<IDxcResult> compileResult = nullptr;
+	ThrowIfFailed(context.Compiler->Compile(&sourceBuffer, arguments.Data(), (gu::uint32)arguments.Size(), &includeHandler, IID_PPV_ARGS(compileResult.GetAddressOf())));
+
+	if (!compileResult) { return false; }
+
+	HRESULT compileStatus = S_OK;
+	compileResult->GetStatus(&compileStatus);
+
+	/*-------------------------------------------------------------------
+	-         RpCoȂꍇ, G[bZ[Wo
+	---------------------------------------------------------------------*/
+	if (FAILED(compileStatus))
+	{
+		ComPtr<IDxcBlobEncoding> errorBlob = nullptr;
+		const auto errorResult = compileResult->GetErrorBuffer(&errorBlob);
+		if (SUCCEEDED(errorResult) && errorBlob)
+		{
+			gu::string errorMessage = "Compilation failed with errors: \n%hs\n";
+			errorMessage += (const char*)errorBlob->GetBufferPointer();
+			_RPTN(_CRT_ERROR, "%s", errorMessage.CString());
+		}
+		return false;
+	}
+
+	/*-------------------------------------------------------------------
+	-         VF[_[R[hƃtNV擾
+	---------------------------------------------------------------------*/
+	ComPtr<IDxcBlob> objectBlob     = nullptr;
+	ComPtr<IDxcBlob> reflectionBlob = nullptr;
+	Check(compileResult->HasOutput(DXC_OUT_OBJECT));
+	ThrowIfFailed(compileResult->GetOutput(DXC_OUT_OBJECT, IID_PPV_ARGS(objectBlob.GetAddressOf()), nullptr));
+
+	if (compileResult->HasOutput(DXC_OUT_REFLECTION))
+	{
+		ThrowIfFailed(compileResult->GetOutput(DXC_OUT_REFLECTION, IID_PPV_ARGS(reflectionBlob.GetAddressOf()), nullptr));
+	}
+
+	result.ByteCode.Resize(objectBlob->GetBufferSize());
+	gu::Memory::Copy(result.ByteCode.Data(), objectBlob->GetBufferPointer(), objectBlob->GetBufferSize());
+
+	if (reflectionBlob)
+	{
+		result.Reflection.Resize(reflectionBlob->GetBufferSize());
+		gu::Memory::Copy(result.Reflection.Data(), reflectionBlob->GetBufferPointer(), reflectionBlob->GetBufferSize());
+	}
+	return true;
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     DXCɓnR}hC̈ݒ肵܂.
+*  @param[in]  const core::ShaderCompilerOption& RpCݒ
+*  @param[in]  const gu::DynamicArray<gu::tstring>& QƂ镶 (-T, -Fc, -Fo)
+*  @param[out] gu::DynamicArray<const gu::tchar*>& R}hC̈
+*  @return     void
+*************************************************************************/
+void ShaderCacheCompiler::SetupArguments(const core::ShaderCompilerOption& option, const gu::DynamicArray<gu::tstring>& storage, gu::DynamicArray<const gu::tchar*>& arguments) const
+{
+	arguments.Reserve(2 * (option.IncludeDirectories.Size() + option.Defines.Size() + 4) + 8); // +4 is for -T, -E -Fc, -Fo
+	for (const auto& directory : option.IncludeDirectories)
+	{
+		arguments.Push(L"-I");
+		arguments.Push(directory.CString());
+	}
+
+	/*-------------------------------------------------------------------
+	-         VF[_[^[Qbgݒ ex) vs_6_0, ps_6_1...
+	---------------------------------------------------------------------*/
+	arguments.Push(L"-T");
+	arguments.Push(storage[0].CString());
+
+	/*-------------------------------------------------------------------
+	-               fobOs, DXIL̒ԌeLXgo͂
+	---------------------------------------------------------------------*/
+	if (storage.Size() >= 3)
+	{
+		arguments.Push(L"-Fc");
+		arguments.Push(storage[1].CString());
+
+		arguments.Push(L"-Fo");
+		arguments.Push(storage[2].CString());
+	}
+
+	/*-------------------------------------------------------------------
+	-        œKݒ
+	---------------------------------------------------------------------*/
+	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::Debug))
+	{
+		arguments.Push(L"-Od");
+	}
+	else if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::LowLevelOptimization))
+	{
+		arguments.Push(L"-O1");
+	}
+	else
+	{
+	#if _DEBUG
+		arguments.Push(L"-Od");
+	#else
+		arguments.Push(L"-O3");
+	#endif
+	}
+
+	/*-------------------------------------------------------------------
+	-        x
+	---------------------------------------------------------------------*/
+	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::WarningAsErrors))
+	{
+		arguments.Push(L"-WX");
+	}
+	else if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::NoWarnings))
+	{
+		arguments.Push(L"-no-warnings");
+	}
+
+	/*-------------------------------------------------------------------
+	-        PDBt@C𐶐
+	---------------------------------------------------------------------*/
+	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::GenerateDebugSymbol))
+	{
+		if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::DebugNameForSource))
+		{
+			arguments.Push(L"-Zss");
+		}
+		else
+		{
+			arguments.Push(L"-Zsb");
+		}
+
+		arguments.Push(L"-Zi");
+		arguments.Push(L"-Qembed_debug");
+		arguments.Push(L"-Fd");
+		arguments.Push(L".\\");
+	}
+
+	/*-------------------------------------------------------------------
+	-        BindingSpace肷
+	---------------------------------------------------------------------*/
+	if (gu::HasAllFlags(option.OptimizationFlags, core::ShaderCompilerFlags::AutoBindingSpace))
+	{
+		arguments.Push(L"-auto-binding-space");
+	}
+
+	/*-------------------------------------------------------------------
+	-         Gg|Cgݒ
+	---------------------------------------------------------------------*/
+	arguments.Push(L"-E");
+	arguments.Push(option.EntryPoint.CString());
+
+	/*-------------------------------------------------------------------
+	-         }Nݒ
+	---------------------------------------------------------------------*/
+	for (const auto& define : option.Defines)
+	{
+		arguments.Push(L"-D");
+		arguments.Push(define.CString());
+	}
+}
+#pragma endregion Protected Function
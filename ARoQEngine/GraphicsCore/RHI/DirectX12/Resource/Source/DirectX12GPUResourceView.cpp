@@ -97,14 +97,9 @@ void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& comman
 	/*-------------------------------------------------------------------
 	-             Set Descirptor Table
 	---------------------------------------------------------------------*/
-	const auto dxCommandList = gu::StaticPointerCast<directX12::RHICommandList>(commandList)->GetCommandList();
-	if (commandList->GetType() == core::CommandListType::Graphics)
+	if (commandList->GetType() == core::CommandListType::Graphics || commandList->GetType() == core::CommandListType::Compute)
 	{
-		dxCommandList->SetGraphicsRootDescriptorTable(index, GetGPUHandler());
-	}
-	else if (commandList->GetType() == core::CommandListType::Compute)
-	{
-		dxCommandList->SetComputeRootDescriptorTable(index, GetGPUHandler());
+		gu::StaticPointerCast<directX12::RHICommandList>(commandList)->SetRootDescriptorTable(index, GetGPUHandler().ptr);
 	}
 	else
 	{
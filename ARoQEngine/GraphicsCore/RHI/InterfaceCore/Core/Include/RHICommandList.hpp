@@ -12,6 +12,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "RHICommonState.hpp"
+#include "RHICommandStateCache.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
 #include "GameUtility/Container/Include/GUDynamicArray.hpp"
@@ -94,6 +95,13 @@ namespace rhi::core
 		*************************************************************************/
 		bool IsOpen() const { return _isOpen; }
 
+		/*!**********************************************************************
+		*  @brief     _[pX̋L^mF܂
+		*  @param[in] void
+		*  @return    bool : BeginRenderPassEndRenderPass܂ł̊ԂtrueɂȂ
+		*************************************************************************/
+		bool IsInRenderPass() const { return _beginRenderPass; }
+
 		/*!**********************************************************************
 		*  @brief     R}hXgĐVKɃAP[^ɋlߍ߂ȂԂł邩mF܂. @n
 		*             ԂɂȂ, R}hL[Execute֐ĂяoGPU߂sĂ. 
@@ -102,6 +110,15 @@ namespace rhi::core
 		*************************************************************************/
 		bool IsClosed() const { return !_isOpen; }
 
+		/*!**********************************************************************
+		*  @brief     L^̃_[pXƃt[obt@O܂. @n
+		*             EndRecordingł̃_[^[QbgPresentւ̑JڂsȂȂ邽, @n
+		*             ̃R}hXgœt[obt@ɕ`悷ꍇ, \[X̏ԂR}hXgύXȂ悤ɂ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void DetachFrameBuffer() { _renderPass.Reset(); _frameBuffer.Reset(); }
+
 		#pragma endregion Main Draw Frame
 
 		/*!**********************************************************************
@@ -117,6 +134,17 @@ namespace rhi::core
 		*  @return    void
 		*************************************************************************/
 		virtual void SetDescriptorHeap(const gu::SharedPointer<RHIDescriptorHeap>& heap) = 0;
+
+		/*!**********************************************************************
+		*  @brief     ̃t[gpAfBXNv^, ftHgq[v1t[p͈̔͂甭s܂. @n
+		*             R}hXgƂ͈͂̕猴qȂŔs邽, L^̃Xbĥ݌ĂяoĂ. @n
+		*             ͈͂BeginRecording (t[̐擪) Ŏ܂.
+		*  @param[in]  const DescriptorHeapType fBXNv^̎
+		*  @param[in]  const gu::uint32 
+		*  @param[out] gu::uint32& 擪̃CfbNX (ނƂ͈͓̔)
+		*  @return     bool 1t[p͈̔͂Ȃ, ܂͑ΉĂȂꍇfalse
+		*************************************************************************/
+		virtual bool AllocateTransientDescriptors([[maybe_unused]] const DescriptorHeapType heapType, [[maybe_unused]] const gu::uint32 count, [[maybe_unused]] gu::uint32& firstIndex) { return false; }
 		//virtual void SetConstant32Bits(gu::DynamicArray<Value32Bit>& values) = 0;
 		//virtual void CopyBuffer(const gu::SharedPointer<GPUBuffer>& source, const gu::SharedPointer<GPUBuffer>& destination, const size_t size, const size_t sourceOffset = 0, const size_t destinationOffset = 0) = 0;*/
 		//virtual void TransitLayout(const gu::SharedPointer<GPUTexture>& texture, const ResourceLayout& newLayout) = 0;
@@ -400,6 +428,12 @@ namespace rhi::core
 		*************************************************************************/
 		void SetDevice(gu::SharedPointer<RHIDevice> device) { _device = device; }
 
+		/*!**********************************************************************
+		*  @brief     hCoɓnԐݒ薽߂, Ԃ̍ĐݒƂĎ菜߂̐Ԃ܂. BeginRecording (t[̐擪) 0ɖ߂܂.
+		*  @return    const CommandStateStatistics& v
+		*************************************************************************/
+		const CommandStateStatistics& GetStateStatistics() const noexcept { return _stateCache.GetStatistics(); }
+
 		/*!**********************************************************************
 		*  @brief     fobO\ݒ肵܂
 		*  @param[in] const gu::tstring& \
@@ -455,6 +489,9 @@ namespace rhi::core
 		/*! @brief : R}hXglߍ߂Ԃɂ邩mF܂*/
 		bool _isOpen = false;
 
+		/*! @brief ݒς݂̕`. Ԃ̍Đݒ菜܂*/
+		CommandStateCache _stateCache = {};
+
 		/*! @brief : _[pXsĂ邩.*/
 		bool _beginRenderPass = false;
 
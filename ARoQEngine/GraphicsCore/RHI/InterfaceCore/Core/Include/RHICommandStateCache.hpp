@@ -0,0 +1,261 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RHICommandStateCache.hpp
+///  @brief  R}hXgɐݒς݂̕`Ԃێ, Ԃ̍ĐݒhCoɓnOɎ菜܂.
+///  @author toide
+///  @date   2026/10/20 17:12:48
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RHI_COMMAND_STATE_CACHE_HPP
+#define RHI_COMMAND_STATE_CACHE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "RHICommonState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	/****************************************************************************
+	*				  			CommandStateType
+	****************************************************************************/
+	/* @brief  d菜Ώۂ̕`Ԃ̎ނł
+	*****************************************************************************/
+	enum class CommandStateType : gu::uint8
+	{
+		GraphicsPipeline,       //!< OtBNXpCvC
+		ComputePipeline,        //!< Rs[gpCvC
+		GraphicsResourceLayout, //!< OtBNXp̃\[XCAEg
+		ComputeResourceLayout,  //!< Rs[gp̃\[XCAEg
+		DescriptorHeap,         //!< fBXNv^q[v
+		PrimitiveTopology,      //!< v~eBug|W[
+		VertexBuffer,           //!< _obt@
+		IndexBuffer,            //!< CfbNXobt@
+		Viewport,               //!< r[|[g
+		Scissor,                //!< VU[`
+		DescriptorTable,        //!< fBXNv^e[u
+		CountOf                 //!< ސ
+	};
+
+	/****************************************************************************
+	*				  			CommandStateBufferView
+	****************************************************************************/
+	/* @brief  _obt@, CfbNXobt@̐ݒeł. lCeBu̖߂ɓnl̂̂ێ܂.
+	*****************************************************************************/
+	struct CommandStateBufferView
+	{
+		/*! @brief GPUzAhX (DirectX12) ܂VkBuffer̃nh (Vulkan). 0͖ݒł*/
+		gu::uint64 Location = 0;
+
+		/*! @brief obt@̃oCgTCY*/
+		gu::uint64 ByteSize = 0;
+
+		/*! @brief 1_̃oCgTCY (CfbNXobt@ł0)*/
+		gu::uint32 Stride = 0;
+
+		bool operator==(const CommandStateBufferView&) const = default;
+	};
+
+	/****************************************************************************
+	*				  			CommandStateStatistics
+	****************************************************************************/
+	/* @brief  hCoɓnݒ薽߂, d̂ߎ菜ݒ薽߂̐ł
+	*****************************************************************************/
+	struct CommandStateStatistics
+	{
+		/*! @brief hCoɓnݒ薽߂̐*/
+		gu::uint64 IssuedCount[static_cast<gu::uint32>(CommandStateType::CountOf)] = {};
+
+		/*! @brief d̂ߎ菜ݒ薽߂̐*/
+		gu::uint64 FilteredCount[static_cast<gu::uint32>(CommandStateType::CountOf)] = {};
+
+		/*! @brief hCoɓnݒ薽߂̍v*/
+		gu::uint64 GetTotalIssuedCount() const noexcept;
+
+		/*! @brief 菜ݒ薽߂̍v*/
+		gu::uint64 GetTotalFilteredCount() const noexcept;
+	};
+
+	/****************************************************************************
+	*				  			CommandStateCache
+	****************************************************************************/
+	/* @brief  R}hXgɐݒς݂̕` (VhEXe[g) ł. @n
+	*          eSet֐͏Ԃςꍇ̂trueԂ, Ăяotruȅꍇ̂݃lCeBu̖߂L^܂. @n
+	*          ԂRHĨbp[ł͂Ȃ, lCeBu̖߂ɓnl (ID3D12PipelineState*, GPUzAhX, VkPipelineȂ) Ŕr܂. @n
+	*          bp[̃AhX, 񓯊쐬ɂpCvC̍ւŒgς, jɕʂ̃IuWFNg֍ėp邽ߎgp܂. @n
+	*          lCeBũIuWFNg͋L^R}h̎sI܂ŉłȂ, L^ɓlʂ̃IuWFNgwƂ͂܂. @n
+	*          R}hXgResetۂInvalidateőSĂ̏Ԃ𖢐ݒɖ߂Ă. @n
+	*          N"disable_state_filter"ꍇ͔r̂ߑSĂ̖߂̂܂ܒʂ܂.
+	*****************************************************************************/
+	class CommandStateCache
+	{
+	public:
+		#pragma region Static Const
+		/*! @brief ێ钸_obt@̃Xbg*/
+		static constexpr gu::uint32 MAX_VERTEX_BUFFER_SLOT = 32;
+
+		/*! @brief ێr[|[gƃVU[`̐*/
+		static constexpr gu::uint32 MAX_VIEWPORT = 16;
+
+		/*! @brief ێfBXNv^e[u̐ ([gp[^̃CfbNX)*/
+		static constexpr gu::uint32 MAX_DESCRIPTOR_TABLE = 64;
+		#pragma endregion
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     pCvC, \[XCAEg, fBXNv^q[v̂悤ɃIuWFNg1Ō܂Ԃݒ肵܂.
+		*  @param[in] const CommandStateType Ԃ̎
+		*  @param[in] const gu::uint64 lCeBũIuWFNg̃nh (0͖ݒ)
+		*  @return    bool Ԃςꍇtrue
+		*************************************************************************/
+		bool SetObject(const CommandStateType type, const gu::uint64 nativeHandle);
+
+		/*!**********************************************************************
+		*  @brief     v~eBug|W[ݒ肵܂.
+		*  @param[in] const PrimitiveTopology g|W[
+		*  @return    bool Ԃςꍇtrue
+		*************************************************************************/
+		bool SetPrimitiveTopology(const PrimitiveTopology topology);
+
+		/*!**********************************************************************
+		*  @brief     _obt@AXbgɐݒ肵܂. ωXbĝ݂1͈̔͂ɂ܂Ƃ߂ĕԂ܂.
+		*  @param[in]  const CommandStateBufferView* _obt@̃r[̔z
+		*  @param[in]  const gu::uint32 z̐
+		*  @param[in]  const gu::uint32 擪̃Xbg
+		*  @param[out] gu::uint32& ݒ肵Xbg̐擪
+		*  @param[out] gu::uint32& ݒ肵Xbg̐
+		*  @return     bool 1łXbgςꍇtrue
+		*************************************************************************/
+		bool SetVertexBuffers(const CommandStateBufferView* views, const gu::uint32 count, const gu::uint32 startSlot, gu::uint32& changedStartSlot, gu::uint32& changedCount);
+
+		/*!**********************************************************************
+		*  @brief     CfbNXobt@ݒ肵܂.
+		*  @param[in] const CommandStateBufferView& CfbNXobt@̃r[
+		*  @param[in] const PixelFormat CfbNX̌^
+		*  @return    bool Ԃςꍇtrue
+		*************************************************************************/
+		bool SetIndexBuffer(const CommandStateBufferView& view, const PixelFormat indexType);
+
+		/*!**********************************************************************
+		*  @brief     r[|[gݒ肵܂.
+		*  @param[in] const Viewport* r[|[g̔z
+		*  @param[in] const gu::uint32 z̐
+		*  @return    bool Ԃςꍇtrue
+		*************************************************************************/
+		bool SetViewports(const Viewport* viewports, const gu::uint32 count);
+
+		/*!**********************************************************************
+		*  @brief     VU[`ݒ肵܂.
+		*  @param[in] const ScissorRect* VU[`̔z
+		*  @param[in] const gu::uint32 z̐
+		*  @return    bool Ԃςꍇtrue
+		*************************************************************************/
+		bool SetScissors(const ScissorRect* rects, const gu::uint32 count);
+
+		/*!**********************************************************************
+		*  @brief     [gp[^̃CfbNXɃfBXNv^e[uݒ肵܂.
+		*  @param[in] const bool Rs[gp
+		*  @param[in] const gu::uint32 [gp[^̃CfbNX
+		*  @param[in] const gu::uint64 fBXNv^GPUAhX
+		*  @return    bool Ԃςꍇtrue
+		*************************************************************************/
+		bool SetDescriptorTable(const bool isCompute, const gu::uint32 index, const gu::uint64 gpuHandle);
+
+		/*!**********************************************************************
+		*  @brief     SĂ̏Ԃ𖢐ݒɖ߂܂. R}hXgResetɌĂяo܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Invalidate();
+
+		/*!**********************************************************************
+		*  @brief     w肵ނ̏Ԃ𖢐ݒɖ߂܂. lCeBuŏԂ㏑ꍇɌĂяo܂.
+		*  @param[in] const CommandStateType Ԃ̎
+		*  @return    void
+		*************************************************************************/
+		void Invalidate(const CommandStateType type);
+
+		/*!**********************************************************************
+		*  @brief     fBXNv^e[u𖢐ݒɖ߂܂. \[XCAEgύXƃ[gp[^͑SĖɂȂ܂.
+		*  @param[in] const bool Rs[gp
+		*  @return    void
+		*************************************************************************/
+		void InvalidateDescriptorTables(const bool isCompute);
+
+		/*! @brief v0ɖ߂܂*/
+		void ResetStatistics() noexcept { _statistics = {}; }
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief hCoɓnݒ薽߂Ǝ菜ݒ薽߂̐*/
+		__forceinline const CommandStateStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/*! @brief d菜ǂ*/
+		__forceinline bool IsEnabled() const noexcept { return _isEnabled; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		CommandStateCache();
+
+		/*! @brief fXgN^*/
+		~CommandStateCache() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief ʂ𓝌vɉ, ̂܂ܕԂ܂*/
+		__forceinline bool Count(const CommandStateType type, const bool changed) noexcept
+		{
+			if (changed) { _statistics.IssuedCount  [static_cast<gu::uint32>(type)]++; }
+			else         { _statistics.FilteredCount[static_cast<gu::uint32>(type)]++; }
+			return changed;
+		}
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief IuWFNg1Ō܂Ԃ̃lCeBunh (CommandStateTypẽCfbNX). 0͖ݒł*/
+		gu::uint64 _objects[static_cast<gu::uint32>(CommandStateType::CountOf)] = {};
+
+		/*! @brief _obt@*/
+		CommandStateBufferView _vertexBuffers[MAX_VERTEX_BUFFER_SLOT] = {};
+
+		/*! @brief CfbNXobt@*/
+		CommandStateBufferView _indexBuffer = {};
+
+		/*! @brief fBXNv^e[u [graphics, compute]. 0͖ݒł*/
+		gu::uint64 _descriptorTables[2][MAX_DESCRIPTOR_TABLE] = {};
+
+		/*! @brief r[|[g*/
+		Viewport _viewports[MAX_VIEWPORT] = {};
+
+		/*! @brief VU[`*/
+		ScissorRect _scissors[MAX_VIEWPORT] = {};
+
+		/*! @brief ݒς݂̃r[|[g̐. 0͖ݒł*/
+		gu::uint32 _viewportCount = 0;
+
+		/*! @brief ݒς݂̃VU[`̐. 0͖ݒł*/
+		gu::uint32 _scissorCount = 0;
+
+		/*! @brief CfbNX̌^*/
+		PixelFormat _indexType = PixelFormat::Unknown;
+
+		/*! @brief v~eBug|W[. CountOfPrimitiveTopology͖ݒł*/
+		PrimitiveTopology _topology = PrimitiveTopology::CountOfPrimitiveTopology;
+
+		/*! @brief v*/
+		CommandStateStatistics _statistics = {};
+
+		/*! @brief d菜ǂ*/
+		bool _isEnabled = true;
+		#pragma endregion
+	};
+}
+#endif
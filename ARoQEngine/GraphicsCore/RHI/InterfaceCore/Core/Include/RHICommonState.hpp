@@ -34,7 +34,8 @@ namespace rhi::core
 	{
 		Unknown    = 0, //!< OtBNXAPIw肵ĂȂ 
 		DirectX12  = 1, //!< DirectX12
-		Vulkan     = 2  //!< Vulkan
+		Vulkan     = 2, //!< Vulkan
+		Null       = 3  //!< GPUgp, R}hCPUɋL^邾̃obNGh (wbhXł̌v, AeXgp)
 	};
 
 	/****************************************************************************
@@ -1121,6 +1122,8 @@ namespace rhi::core
 		gu::uint32 SamplerDescCount = 0; //!< Dynamic Sampler StatẽfBXNv^q[v̌
 		gu::uint32 RTVDescCount = 0;     //!< Render Target View̃fBXNv^q[v̌
 		gu::uint32 DSVDescCount = 0;     //!< Depth Stencil View̃fBXNv^q[v̌
+		gu::uint32 TransientCBVDescCount = 0; //!< CBVDescCount̂, 1t[gp (t[Ƃɍėp) 
+		gu::uint32 TransientSRVDescCount = 0; //!< SRVDescCount̂, 1t[gp (t[Ƃɍėp) 
 	};
 
 	/****************************************************************************
@@ -0,0 +1,270 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RHIDescriptorAllocator.hpp
+///  @brief  OtBNXAPIɈˑȂfBXNv^̃CfbNXǗł. @n
+///          풓p̃rbgZbgɂAP[^, t[Ƃ̐`AP[^, XbhƂ͈͂̕񋟂܂.
+///  @author toide
+///  @date   2026/10/20 15:12:44
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RHI_DESCRIPTOR_ALLOCATOR_HPP
+#define RHI_DESCRIPTOR_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Container/Include/GUQueue.hpp"
+#include <atomic>
+#include <memory>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace rhi::core
+{
+	/****************************************************************************
+	*				  			DescriptorIndexAllocator
+	****************************************************************************/
+	/* @brief  풓fBXNv^̃CfbNX𔭍s܂. @n
+	*          1rbg1̃fBXNv^ɑΉrbgZbg (1) , 64[hƂɋ󂫂邩ʂ̃rbgZbgŋ󂫂T܂. @n
+	*          Allocate, Free̓bNgp, ̃Xbh瓯ɌĂяo܂. Resize, Reset͑̌ĂяoƓɍsȂł.
+	*****************************************************************************/
+	class DescriptorIndexAllocator : public gu::NonCopyable
+	{
+	public:
+		/*! @brief ȃCfbNX*/
+		static constexpr gu::uint32 INVALID_INDEX = 0xFFFFFFFF;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     󂢂ĂCfbNX1s܂.
+		*  @param[in] void
+		*  @return    gu::uint32 CfbNX. 󂫂ꍇINVALID_INDEX
+		*************************************************************************/
+		gu::uint32 Allocate();
+
+		/*!**********************************************************************
+		*  @brief     CfbNX󂫏Ԃɖ߂܂.
+		*  @param[in] const gu::uint32 CfbNX
+		*  @return    bool ͈͊O, ɋ󂢂Ăꍇfalse
+		*************************************************************************/
+		bool Free(const gu::uint32 index);
+
+		/*!**********************************************************************
+		*  @brief     sς݂̃CfbNXۂ܂܍ő吔ύX܂. kꍇ, ͈͊ÕCfbNX͔j܂.
+		*  @param[in] const gu::uint32 ő吔
+		*  @return    void
+		*************************************************************************/
+		void Resize(const gu::uint32 capacity);
+
+		/*!**********************************************************************
+		*  @brief     SẴCfbNX󂫏Ԃɖ߂܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Reset();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief słő吔*/
+		__forceinline gu::uint32 GetCapacity() const noexcept { return _capacity; }
+
+		/*! @brief sς݂̐*/
+		__forceinline gu::uint32 GetAllocatedCount() const noexcept { return _allocatedCount.load(std::memory_order_relaxed); }
+
+		/*! @brief CfbNXsς݂*/
+		bool IsAllocated(const gu::uint32 index) const noexcept;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		DescriptorIndexAllocator() = default;
+
+		/*! @brief ő吔ŏ܂*/
+		explicit DescriptorIndexAllocator(const gu::uint32 capacity) { Resize(capacity); }
+
+		/*! @brief fXgN^*/
+		~DescriptorIndexAllocator() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief w肵[h󂫃rbg1擾܂*/
+		bool TryAllocateFromWord(const gu::uint32 wordIndex, gu::uint32& index);
+
+		/*! @brief [ĥ, capacitỹCfbNXɑΉrbg*/
+		static gu::uint64 GetValidMask(const gu::uint32 wordIndex, const gu::uint32 capacity) noexcept;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief 1rbg1̃CfbNXɑΉ܂. 1͋*/
+		std::unique_ptr<std::atomic<gu::uint64>[]> _freeBits = nullptr;
+
+		/*! @brief 1rbg_freeBits1[hɑΉ܂. 1͂̃[hɋ󂫂\܂*/
+		std::unique_ptr<std::atomic<gu::uint64>[]> _summaryBits = nullptr;
+
+		/*! @brief ő吔*/
+		gu::uint32 _capacity = 0;
+
+		/*! @brief _freeBits̃[h*/
+		gu::uint32 _wordCount = 0;
+
+		/*! @brief _summaryBits̃[h*/
+		gu::uint32 _summaryCount = 0;
+
+		/*! @brief sς݂̐*/
+		std::atomic<gu::uint32> _allocatedCount = 0;
+
+		/*! @brief O󂫂_summaryBits̃[h. T̊JnʒuɎg܂*/
+		std::atomic<gu::uint32> _searchHint = 0;
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			DescriptorLinearAllocator
+	****************************************************************************/
+	/* @brief  1t[gpfBXNv^A͈͂Ŕs܂. @n
+	*          Oobt@ƂĎgp, EndFrameŋL^tFXl̊RecycleɓnƂ̃t[͈̔͂ėp܂. @n
+	*          Allocate̓bNgp, ̃Xbh瓯ɌĂяo܂. EndFrame, Recycle1̃Xbh (`Xbh) ĂяoĂ.
+	*****************************************************************************/
+	class DescriptorLinearAllocator : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     Acount̃fBXNv^𔭍s܂. ͈͂̓O̖܂܂.
+		*  @param[in]  const gu::uint32 
+		*  @param[out] gu::uint32& 擪̃CfbNX (RXgN^Ŏw肵offset܂݂܂)
+		*  @return     bool GPUŎgp͈̔͂ƏdȂꍇfalse
+		*************************************************************************/
+		bool Allocate(const gu::uint32 count, gu::uint32& index);
+
+		/*!**********************************************************************
+		*  @brief     ݂̃t[Ŕs͈͂, tFXl܂ŎgpƂċL^܂.
+		*  @param[in] const gu::uint64 ̃t[̃R}h𑗐MɃVOitFXl
+		*  @return    void
+		*************************************************************************/
+		void EndFrame(const gu::uint64 fenceValue);
+
+		/*!**********************************************************************
+		*  @brief     tFXlȉ̃t[͈̔͂ėp\ɂ܂.
+		*  @param[in] const gu::uint64 GPUŊtFXl
+		*  @return    void
+		*************************************************************************/
+		void Recycle(const gu::uint64 completedFenceValue);
+
+		/*!**********************************************************************
+		*  @brief     SĂ͈̔͂ėp\ɂ܂. GPUACh̎̂݌ĂяoĂ.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Reset();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief O̐擪̃CfbNX*/
+		__forceinline gu::uint32 GetOffset() const noexcept { return _offset; }
+
+		/*! @brief Ȏ傫*/
+		__forceinline gu::uint32 GetCapacity() const noexcept { return _capacity; }
+
+		/*! @brief gp̐ (܂Ȃ߂ɓǂݔ΂܂݂܂)*/
+		__forceinline gu::uint64 GetUsedCount() const noexcept { return _head.load(std::memory_order_relaxed) - _tail.load(std::memory_order_relaxed); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		DescriptorLinearAllocator() = default;
+
+		/*! @brief q[v͈̔ [offset, offset + capacity) ŏ܂*/
+		DescriptorLinearAllocator(const gu::uint32 offset, const gu::uint32 capacity) : _offset(offset), _capacity(capacity) {};
+
+		/*! @brief fXgN^*/
+		~DescriptorLinearAllocator() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief t[̏I[ƃtFXl*/
+		struct FrameRecord
+		{
+			gu::uint64 FenceValue = 0;
+			gu::uint64 Head       = 0;
+		};
+
+		/*! @brief q[ṽO̐擪*/
+		gu::uint32 _offset = 0;
+
+		/*! @brief Ȏ傫*/
+		gu::uint32 _capacity = 0;
+
+		/*! @brief ɔsʒu. P, capacity̏]Öʒuł*/
+		std::atomic<gu::uint64> _head = 0;
+
+		/*! @brief GPUŎgp͈̔͂̐擪*/
+		std::atomic<gu::uint64> _tail = 0;
+
+		/*! @brief ҂̃t[*/
+		gu::Queue<FrameRecord> _frames = {};
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			DescriptorThreadRange
+	****************************************************************************/
+	/* @brief  Xbh (R}hXg̋L^) Ƃɕێ, DescriptorLinearAllocator͈͂̕ł. @n
+	*          e1xchunkSize܂Ƃ߂Ċmۂ, ̒ł͌qg킸ɔs܂. @n
+	*          ̃XbhŋLȂł. t[̊JnResetĂяoĂ.
+	*****************************************************************************/
+	class DescriptorThreadRange : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     Acount̃fBXNv^𔭍s܂.
+		*  @param[in]  const gu::uint32 
+		*  @param[out] gu::uint32& 擪̃CfbNX
+		*  @return     bool e͈̔͂Ȃꍇfalse
+		*************************************************************************/
+		bool Allocate(const gu::uint32 count, gu::uint32& index);
+
+		/*! @brief ێĂ镔͈͂܂. c͐ẽt[Ƌɍėp܂*/
+		__forceinline void Reset() noexcept { _current = _end = 0; }
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ͈͂̎c*/
+		__forceinline gu::uint32 GetRemainingCount() const noexcept { return _end - _current; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ẽAP[^1xɊmۂŏ܂*/
+		explicit DescriptorThreadRange(DescriptorLinearAllocator& parent, const gu::uint32 chunkSize = 64) : _parent(parent), _chunkSize(chunkSize) {};
+
+		/*! @brief fXgN^*/
+		~DescriptorThreadRange() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ẽAP[^*/
+		DescriptorLinearAllocator& _parent;
+
+		/*! @brief 1xɊmۂ*/
+		gu::uint32 _chunkSize = 64;
+
+		/*! @brief ɔsCfbNX*/
+		gu::uint32 _current = 0;
+
+		/*! @brief ͈͂̏I[*/
+		gu::uint32 _end = 0;
+		#pragma endregion
+	};
+}
+#endif
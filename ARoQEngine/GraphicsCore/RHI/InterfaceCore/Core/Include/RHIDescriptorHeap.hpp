@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorAllocator.hpp"
 #include "GameUtility/Base/Include/GUSmartPointer.hpp"
 #include "GameUtility/Container/Include/GUSortedMap.hpp"
 //////////////////////////////////////////////////////////////////////////////////
@@ -62,6 +63,18 @@ namespace rhi::core
 		
 		/* @brief : Reset view offset*/
 		virtual void Reset(const ResetFlag flag = ResetFlag::OnlyOffset) = 0;
+
+		/* @brief : Reserve the tail of the type range for descriptors used only in one frame. Call before allocating views of the type (not supported in vulkan api)*/
+		virtual void ReserveTransient([[maybe_unused]] const DescriptorHeapType type, [[maybe_unused]] const gu::uint32 count) {};
+
+		/* @brief : Allocate count contiguous descriptors valid until the frame is recycled. Return false if the transient range is full or not reserved*/
+		bool AllocateTransient(const DescriptorHeapType type, const gu::uint32 count, DescriptorID& firstID);
+
+		/* @brief : Record the transient descriptors issued in this frame as in use until frameSerial completes*/
+		void EndFrame(const gu::uint64 frameSerial);
+
+		/* @brief : Make the transient descriptors of the completed frames reusable*/
+		void Recycle(const gu::uint64 completedFrameSerial);
 		/****************************************************************************
 		**                Public Property
 		*****************************************************************************/
@@ -69,6 +82,9 @@ namespace rhi::core
 		
 		// @brief: Return descriptor heap type (cbv, rtv, dsv)
 		bool HasHeapType(const DescriptorHeapType desiredType) const noexcept { return _heapInfo.Contains(desiredType); }
+
+		/* @brief : Return the per-frame linear allocator of the type (nullptr if ReserveTransient was not called)*/
+		virtual gu::SharedPointer<DescriptorLinearAllocator> GetTransientAllocator([[maybe_unused]] const DescriptorHeapType type) const { return nullptr; }
 		
 		/****************************************************************************
 		**                Constructor and Destructor
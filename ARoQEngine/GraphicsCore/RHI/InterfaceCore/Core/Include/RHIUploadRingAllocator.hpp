@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RHIUploadRingAllocator.hpp
+///  @brief  Abv[hpobt@̗̈t[PʂŔs, tFX̊ɍėp郊OAP[^ł. @n
+///          GPU\[Xɂ͐Gꂸ, ItZbǧvẐ݂s܂.
+///  @author toide
+///  @date   2026/10/20 18:20:05
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RHI_UPLOAD_RING_ALLOCATOR_HPP
+#define RHI_UPLOAD_RING_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Container/Include/GUQueue.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace rhi::core
+{
+	/****************************************************************************
+	*				  			UploadRingAllocator
+	****************************************************************************/
+	/* @brief  ecapacitỹobt@OƂĎg, ACg𑵂̈𔭍s܂. @n
+	*          EndFrameł̃t[ɔs̈tFXlƕRÂ, RecycleɊtFXlnƌÂt[珇ɍėp܂. @n
+	*          Ɏ܂Ȃ̈͐擪mۂ, ̗]͂̃t[̎gpʂɊ܂߂܂. @n
+	*          `Xbĥ݌ĂяoĂ.
+	*****************************************************************************/
+	class UploadRingAllocator : public gu::NonCopyable
+	{
+	public:
+		/*! @brief mۂɎsƂItZbg*/
+		static constexpr gu::uint64 INVALID_OFFSET = 0xFFFFFFFFFFFFFFFF;
+
+		/*! @brief ̃ACg (萔obt@̃ACg)*/
+		static constexpr gu::uint64 DEFAULT_ALIGNMENT = 256;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ̈𔭍s܂.
+		*  @param[in] const gu::uint64 oCgTCY
+		*  @param[in] const gu::uint64 ACg (2̗ݏ)
+		*  @return    gu::uint64 obt@̐擪̃ItZbg. 󂫂ꍇINVALID_OFFSET
+		*************************************************************************/
+		gu::uint64 Allocate(const gu::uint64 byteSize, const gu::uint64 alignment = DEFAULT_ALIGNMENT);
+
+		/*!**********************************************************************
+		*  @brief     ݂̃t[Ŕs̈, GPȔ̊tFXlƕRÂ܂.
+		*  @param[in] const gu::uint64 tFXl
+		*  @return    void
+		*************************************************************************/
+		void EndFrame(const gu::uint64 fenceValue);
+
+		/*!**********************************************************************
+		*  @brief     tFXl܂ł̃t[̗̈ėp\ɂ܂.
+		*  @param[in] const gu::uint64 tFXl
+		*  @return    void
+		*************************************************************************/
+		void Recycle(const gu::uint64 completedFenceValue);
+
+		/*!**********************************************************************
+		*  @brief     SĂ̗̈󂫏Ԃɖ߂܂. GPUSĂ̗̈gIĂꍇ̂݌ĂяoĂ.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Reset();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief e [byte]*/
+		__forceinline gu::uint64 GetCapacity() const noexcept { return _capacity; }
+
+		/*! @brief gp̗e (܂ėpĂȂt[܂) [byte]*/
+		__forceinline gu::uint64 GetUsedSize() const noexcept { return _usedSize; }
+
+		/*! @brief ݂̃t[Ŕs*/
+		__forceinline gu::uint32 GetFrameAllocationCount() const noexcept { return _frameAllocationCount; }
+
+		/*! @brief ݂̃t[ŔsoCgTCY (ACg̗]܂)*/
+		__forceinline gu::uint64 GetFrameAllocatedSize() const noexcept { return _frameSize; }
+
+		/*! @brief GPŮ҂Ăt[̐*/
+		__forceinline gu::uint32 GetPendingFrameCount() const noexcept { return _pendingFrameCount; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief eʂw肵ď܂*/
+		explicit UploadRingAllocator(const gu::uint64 capacity);
+
+		/*! @brief fXgN^*/
+		~UploadRingAllocator() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief GPŮ҂Ăt[*/
+		struct FrameRecord
+		{
+			/*! @brief t[̊tFXl*/
+			gu::uint64 FenceValue = 0;
+
+			/*! @brief t[ŎgpoCgTCY*/
+			gu::uint64 Size = 0;
+		};
+
+		/*! @brief e*/
+		gu::uint64 _capacity = 0;
+
+		/*! @brief ɔsʒu*/
+		gu::uint64 _head = 0;
+
+		/*! @brief gp̗̈̐擪*/
+		gu::uint64 _tail = 0;
+
+		/*! @brief gp̗e*/
+		gu::uint64 _usedSize = 0;
+
+		/*! @brief ݂̃t[ŎgpoCgTCY*/
+		gu::uint64 _frameSize = 0;
+
+		/*! @brief ݂̃t[Ŕs*/
+		gu::uint32 _frameAllocationCount = 0;
+
+		/*! @brief GPŮ҂Ăt[̐*/
+		gu::uint32 _pendingFrameCount = 0;
+
+		/*! @brief GPŮ҂Ăt[ (Â)*/
+		gu::Queue<FrameRecord> _frames = {};
+		#pragma endregion
+	};
+}
+
+#endif
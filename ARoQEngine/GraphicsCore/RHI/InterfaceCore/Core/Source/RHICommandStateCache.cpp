@@ -0,0 +1,312 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RHICommandStateCache.cpp
+///  @brief  R}hXgɐݒς݂̕`Ԃێ, Ԃ̍ĐݒhCoɓnOɎ菜܂.
+///  @author toide
+///  @date   2026/10/20 17:12:48
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/RHICommandStateCache.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUCommandLine.hpp"
+#include "GameUtility/Base/Include/GUParse.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+namespace
+{
+	bool IsSameViewport(const Viewport& left, const Viewport& right)
+	{
+		return left.TopLeftX == right.TopLeftX && left.TopLeftY == right.TopLeftY
+			&& left.Width    == right.Width    && left.Height   == right.Height
+			&& left.MinDepth == right.MinDepth && left.MaxDepth == right.MaxDepth;
+	}
+
+	bool IsSameScissor(const ScissorRect& left, const ScissorRect& right)
+	{
+		return left.Left  == right.Left  && left.Top    == right.Top
+			&& left.Right == right.Right && left.Bottom == right.Bottom;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Statistics
+gu::uint64 CommandStateStatistics::GetTotalIssuedCount() const noexcept
+{
+	gu::uint64 total = 0;
+	for (const auto count : IssuedCount) { total += count; }
+	return total;
+}
+
+gu::uint64 CommandStateStatistics::GetTotalFilteredCount() const noexcept
+{
+	gu::uint64 total = 0;
+	for (const auto count : FilteredCount) { total += count; }
+	return total;
+}
+#pragma endregion Statistics
+
+#pragma region Constructor and Destructor
+CommandStateCache::CommandStateCache()
+{
+	static const bool isDisabled = gu::Parse::Contains(gu::CommandLine::Get(), SP("disable_state_filter"));
+	_isEnabled = !isDisabled;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     pCvC, \[XCAEg, fBXNv^q[v̂悤ɃIuWFNg1Ō܂Ԃݒ肵܂.
+*  @param[in] const CommandStateType Ԃ̎
+*  @param[in] const gu::uint64 lCeBũIuWFNg̃nh (0͖ݒ)
+*  @return    bool Ԃςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetObject(const CommandStateType type, const gu::uint64 nativeHandle)
+{
+	auto& current = _objects[static_cast<gu::uint32>(type)];
+
+	const bool changed = !_isEnabled || nativeHandle == 0 || current != nativeHandle;
+	current = nativeHandle;
+	return Count(type, changed);
+}
+
+/*!**********************************************************************
+*  @brief     v~eBug|W[ݒ肵܂.
+*  @param[in] const PrimitiveTopology g|W[
+*  @return    bool Ԃςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetPrimitiveTopology(const PrimitiveTopology topology)
+{
+	const bool changed = !_isEnabled || _topology != topology;
+	_topology = topology;
+	return Count(CommandStateType::PrimitiveTopology, changed);
+}
+
+/*!**********************************************************************
+*  @brief     _obt@AXbgɐݒ肵܂. ωXbĝ݂1͈̔͂ɂ܂Ƃ߂ĕԂ܂.
+*  @param[in]  const CommandStateBufferView* _obt@̃r[̔z
+*  @param[in]  const gu::uint32 z̐
+*  @param[in]  const gu::uint32 擪̃Xbg
+*  @param[out] gu::uint32& ݒ肵Xbg̐擪
+*  @param[out] gu::uint32& ݒ肵Xbg̐
+*  @return     bool 1łXbgςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetVertexBuffers(const CommandStateBufferView* views, const gu::uint32 count, const gu::uint32 startSlot, gu::uint32& changedStartSlot, gu::uint32& changedCount)
+{
+	changedStartSlot = startSlot;
+	changedCount     = count;
+
+	// ێłȂXbg܂ޏꍇ͂̂܂ܒʂ܂
+	if (!_isEnabled || startSlot + count > MAX_VERTEX_BUFFER_SLOT)
+	{
+		for (gu::uint32 i = 0; i < count && startSlot + i < MAX_VERTEX_BUFFER_SLOT; ++i)
+		{
+			_vertexBuffers[startSlot + i] = views[i];
+		}
+		return Count(CommandStateType::VertexBuffer, true);
+	}
+
+	/*-------------------------------------------------------------------
+	-      ωXbg̍ŏƍŌ, ̊Ԃ܂Ƃ߂Đݒ肵܂
+	---------------------------------------------------------------------*/
+	gu::uint32 first = count;
+	gu::uint32 last  = 0;
+	for (gu::uint32 i = 0; i < count; ++i)
+	{
+		auto& current = _vertexBuffers[startSlot + i];
+		if (views[i].Location != 0 && current == views[i]) { continue; }
+
+		current = views[i];
+		if (first == count) { first = i; }
+		last = i;
+	}
+
+	if (first == count)
+	{
+		changedCount = 0;
+		return Count(CommandStateType::VertexBuffer, false);
+	}
+
+	changedStartSlot = startSlot + first;
+	changedCount     = last - first + 1;
+	return Count(CommandStateType::VertexBuffer, true);
+}
+
+/*!**********************************************************************
+*  @brief     CfbNXobt@ݒ肵܂.
+*  @param[in] const CommandStateBufferView& CfbNXobt@̃r[
+*  @param[in] const PixelFormat CfbNX̌^
+*  @return    bool Ԃςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetIndexBuffer(const CommandStateBufferView& view, const PixelFormat indexType)
+{
+	const bool changed = !_isEnabled || view.Location == 0 || _indexBuffer != view || _indexType != indexType;
+	_indexBuffer = view;
+	_indexType   = indexType;
+	return Count(CommandStateType::IndexBuffer, changed);
+}
+
+/*!**********************************************************************
+*  @brief     r[|[gݒ肵܂.
+*  @param[in] const Viewport* r[|[g̔z
+*  @param[in] const gu::uint32 z̐
+*  @return    bool Ԃςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetViewports(const Viewport* viewports, const gu::uint32 count)
+{
+	if (!_isEnabled || count == 0 || count > MAX_VIEWPORT)
+	{
+		_viewportCount = 0;
+		return Count(CommandStateType::Viewport, true);
+	}
+
+	bool changed = _viewportCount != count;
+	for (gu::uint32 i = 0; i < count && !changed; ++i)
+	{
+		changed = !IsSameViewport(_viewports[i], viewports[i]);
+	}
+
+	if (changed)
+	{
+		for (gu::uint32 i = 0; i < count; ++i) { _viewports[i] = viewports[i]; }
+		_viewportCount = count;
+	}
+	return Count(CommandStateType::Viewport, changed);
+}
+
+/*!**********************************************************************
+*  @brief     VU[`ݒ肵܂.
+*  @param[in] const ScissorRect* VU[`̔z
+*  @param[in] const gu::uint32 z̐
+*  @return    bool Ԃςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetScissors(const ScissorRect* rects, const gu::uint32 count)
+{
+	if (!_isEnabled || count == 0 || count > MAX_VIEWPORT)
+	{
+		_scissorCount = 0;
+		return Count(CommandStateType::Scissor, true);
+	}
+
+	bool changed = _scissorCount != count;
+	for (gu::uint32 i = 0; i < count && !changed; ++i)
+	{
+		changed = !IsSameScissor(_scissors[i], rects[i]);
+	}
+
+	if (changed)
+	{
+		for (gu::uint32 i = 0; i < count; ++i) { _scissors[i] = rects[i]; }
+		_scissorCount = count;
+	}
+	return Count(CommandStateType::Scissor, changed);
+}
+
+/*!**********************************************************************
+*  @brief     [gp[^̃CfbNXɃfBXNv^e[uݒ肵܂.
+*  @param[in] const bool Rs[gp
+*  @param[in] const gu::uint32 [gp[^̃CfbNX
+*  @param[in] const gu::uint64 fBXNv^GPUAhX
+*  @return    bool Ԃςꍇtrue
+*************************************************************************/
+bool CommandStateCache::SetDescriptorTable(const bool isCompute, const gu::uint32 index, const gu::uint64 gpuHandle)
+{
+	if (!_isEnabled || index >= MAX_DESCRIPTOR_TABLE)
+	{
+		return Count(CommandStateType::DescriptorTable, true);
+	}
+
+	auto& current = _descriptorTables[isCompute ? 1 : 0][index];
+
+	const bool changed = gpuHandle == 0 || current != gpuHandle;
+	current = gpuHandle;
+	return Count(CommandStateType::DescriptorTable, changed);
+}
+
+/*!**********************************************************************
+*  @brief     SĂ̏Ԃ𖢐ݒɖ߂܂. R}hXgResetɌĂяo܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void CommandStateCache::Invalidate()
+{
+	for (auto& object : _objects)       { object = 0; }
+	for (auto& buffer : _vertexBuffers) { buffer = {}; }
+	_indexBuffer = {};
+	InvalidateDescriptorTables(false);
+	InvalidateDescriptorTables(true);
+
+	_viewportCount = 0;
+	_scissorCount  = 0;
+	_indexType     = PixelFormat::Unknown;
+	_topology      = PrimitiveTopology::CountOfPrimitiveTopology;
+}
+
+/*!**********************************************************************
+*  @brief     w肵ނ̏Ԃ𖢐ݒɖ߂܂. lCeBuŏԂ㏑ꍇɌĂяo܂.
+*  @param[in] const CommandStateType Ԃ̎
+*  @return    void
+*************************************************************************/
+void CommandStateCache::Invalidate(const CommandStateType type)
+{
+	switch (type)
+	{
+		case CommandStateType::PrimitiveTopology:
+		{
+			_topology = PrimitiveTopology::CountOfPrimitiveTopology;
+			break;
+		}
+		case CommandStateType::VertexBuffer:
+		{
+			for (auto& buffer : _vertexBuffers) { buffer = {}; }
+			break;
+		}
+		case CommandStateType::IndexBuffer:
+		{
+			_indexBuffer = {};
+			_indexType   = PixelFormat::Unknown;
+			break;
+		}
+		case CommandStateType::Viewport:
+		{
+			_viewportCount = 0;
+			break;
+		}
+		case CommandStateType::Scissor:
+		{
+			_scissorCount = 0;
+			break;
+		}
+		case CommandStateType::DescriptorTable:
+		{
+			InvalidateDescriptorTables(false);
+			InvalidateDescriptorTables(true);
+			break;
+		}
+		default:
+		{
+			Check(type != CommandStateType::CountOf);
+			_objects[static_cast<gu::uint32>(type)] = 0;
+			break;
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     fBXNv^e[u𖢐ݒɖ߂܂. \[XCAEgύXƃ[gp[^͑SĖɂȂ܂.
+*  @param[in] const bool Rs[gp
+*  @return    void
+*************************************************************************/
+void CommandStateCache::InvalidateDescriptorTables(const bool isCompute)
+{
+	for (auto& table : _descriptorTables[isCompute ? 1 : 0]) { table = 0; }
+}
+#pragma endregion Main Function
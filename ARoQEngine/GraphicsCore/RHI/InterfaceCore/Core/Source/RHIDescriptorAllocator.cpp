@@ -0,0 +1,326 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RHIDescriptorAllocator.cpp
+///  @brief  OtBNXAPIɈˑȂfBXNv^̃CfbNXǗł.
+///  @author toide
+///  @date   2026/10/20 15:12:44
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/RHIDescriptorAllocator.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <bit>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+namespace
+{
+	constexpr gu::uint32 BITS_PER_WORD = 64;
+
+	/*! @brief rbg烏[h߂܂*/
+	constexpr gu::uint32 GetWordCount(const gu::uint32 bitCount) noexcept
+	{
+		return (bitCount + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region DescriptorIndexAllocator
+/*!**********************************************************************
+*  @brief     󂢂ĂCfbNX1s܂.
+*  @param[in] void
+*  @return    gu::uint32 CfbNX. 󂫂ꍇINVALID_INDEX
+*************************************************************************/
+gu::uint32 DescriptorIndexAllocator::Allocate()
+{
+	if (_summaryCount == 0) { return INVALID_INDEX; }
+
+	/*-------------------------------------------------------------------
+	-      O񌩂ʒuʂ̃rbgZbg񂵂܂
+	---------------------------------------------------------------------*/
+	const auto start = _searchHint.load(std::memory_order_relaxed);
+	for (gu::uint32 i = 0; i < _summaryCount; ++i)
+	{
+		const auto summaryIndex = (start + i) % _summaryCount;
+		auto       summary      = _summaryBits[summaryIndex].load(std::memory_order_acquire);
+
+		while (summary != 0)
+		{
+			const auto bit       = static_cast<gu::uint32>(std::countr_zero(summary));
+			const auto bitMask   = 1ull << bit;
+			const auto wordIndex = summaryIndex * BITS_PER_WORD + bit;
+
+			gu::uint32 index = INVALID_INDEX;
+			if (TryAllocateFromWord(wordIndex, index))
+			{
+				_searchHint.store(summaryIndex, std::memory_order_relaxed);
+				_allocatedCount.fetch_add(1, std::memory_order_relaxed);
+				return index;
+			}
+
+			/*-------------------------------------------------------------------
+			-      [h܂Ă߃qg܂.
+			-      OFreeꂽꍇ肱ڂȂ悤, ɂxmF܂
+			---------------------------------------------------------------------*/
+			_summaryBits[summaryIndex].fetch_and(~bitMask, std::memory_order_acq_rel);
+			if (_freeBits[wordIndex].load(std::memory_order_acquire) != 0)
+			{
+				_summaryBits[summaryIndex].fetch_or(bitMask, std::memory_order_release);
+			}
+
+			summary &= ~bitMask;
+		}
+	}
+
+	return INVALID_INDEX;
+}
+
+/*!**********************************************************************
+*  @brief     CfbNX󂫏Ԃɖ߂܂.
+*  @param[in] const gu::uint32 CfbNX
+*  @return    bool ͈͊O, ɋ󂢂Ăꍇfalse
+*************************************************************************/
+bool DescriptorIndexAllocator::Free(const gu::uint32 index)
+{
+	if (index >= _capacity) { return false; }
+
+	const auto wordIndex = index / BITS_PER_WORD;
+	const auto bitMask   = 1ull << (index % BITS_PER_WORD);
+
+	const auto previous = _freeBits[wordIndex].fetch_or(bitMask, std::memory_order_acq_rel);
+	if (previous & bitMask)
+	{
+		Checkf(false, "descriptor index is freed twice");
+		return false;
+	}
+
+	// [h̃rbg𗧂ĂɃqg𗧂Ă邽, Allocate͕Kǂ炩܂
+	_summaryBits[wordIndex / BITS_PER_WORD].fetch_or(1ull << (wordIndex % BITS_PER_WORD), std::memory_order_release);
+	_allocatedCount.fetch_sub(1, std::memory_order_relaxed);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     sς݂̃CfbNXۂ܂܍ő吔ύX܂. kꍇ, ͈͊ÕCfbNX͔j܂.
+*  @param[in] const gu::uint32 ő吔
+*  @return    void
+*************************************************************************/
+void DescriptorIndexAllocator::Resize(const gu::uint32 capacity)
+{
+	const auto wordCount    = GetWordCount(capacity);
+	const auto summaryCount = GetWordCount(wordCount);
+
+	auto freeBits    = std::make_unique<std::atomic<gu::uint64>[]>(wordCount);
+	auto summaryBits = std::make_unique<std::atomic<gu::uint64>[]>(summaryCount);
+
+	gu::uint32 allocatedCount = 0;
+	for (gu::uint32 wordIndex = 0; wordIndex < wordCount; ++wordIndex)
+	{
+		/*-------------------------------------------------------------------
+		-      V͈͂͋, ͈͈̔͂ȑȌԂp܂
+		---------------------------------------------------------------------*/
+		const auto newMask = GetValidMask(wordIndex, capacity);
+		auto       bits    = newMask;
+
+		if (wordIndex < _wordCount)
+		{
+			const auto oldMask = GetValidMask(wordIndex, _capacity);
+			const auto oldBits = _freeBits[wordIndex].load(std::memory_order_relaxed);
+			bits = (newMask & ~oldMask) | (oldBits & oldMask & newMask);
+		}
+
+		freeBits[wordIndex].store(bits, std::memory_order_relaxed);
+		allocatedCount += static_cast<gu::uint32>(std::popcount(newMask) - std::popcount(bits));
+
+		if (bits != 0)
+		{
+			summaryBits[wordIndex / BITS_PER_WORD].fetch_or(1ull << (wordIndex % BITS_PER_WORD), std::memory_order_relaxed);
+		}
+	}
+
+	_freeBits     = std::move(freeBits);
+	_summaryBits  = std::move(summaryBits);
+	_capacity     = capacity;
+	_wordCount    = wordCount;
+	_summaryCount = summaryCount;
+	_allocatedCount.store(allocatedCount, std::memory_order_release);
+	_searchHint    .store(0, std::memory_order_relaxed);
+}
+
+/*!**********************************************************************
+*  @brief     SẴCfbNX󂫏Ԃɖ߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DescriptorIndexAllocator::Reset()
+{
+	for (gu::uint32 wordIndex = 0; wordIndex < _wordCount; ++wordIndex)
+	{
+		_freeBits[wordIndex].store(GetValidMask(wordIndex, _capacity), std::memory_order_relaxed);
+	}
+
+	for (gu::uint32 summaryIndex = 0; summaryIndex < _summaryCount; ++summaryIndex)
+	{
+		_summaryBits[summaryIndex].store(GetValidMask(summaryIndex, _wordCount), std::memory_order_relaxed);
+	}
+
+	_allocatedCount.store(0, std::memory_order_release);
+	_searchHint    .store(0, std::memory_order_relaxed);
+}
+
+/*!**********************************************************************
+*  @brief     CfbNXsς݂Ԃ܂.
+*  @param[in] const gu::uint32 CfbNX
+*  @return    bool
+*************************************************************************/
+bool DescriptorIndexAllocator::IsAllocated(const gu::uint32 index) const noexcept
+{
+	if (index >= _capacity) { return false; }
+
+	const auto bits = _freeBits[index / BITS_PER_WORD].load(std::memory_order_acquire);
+	return (bits & (1ull << (index % BITS_PER_WORD))) == 0;
+}
+
+/*!**********************************************************************
+*  @brief     w肵[h󂫃rbg1擾܂.
+*  @param[in]  const gu::uint32 [h̃CfbNX
+*  @param[out] gu::uint32& 擾CfbNX
+*  @return     bool [h܂Ăꍇfalse
+*************************************************************************/
+bool DescriptorIndexAllocator::TryAllocateFromWord(const gu::uint32 wordIndex, gu::uint32& index)
+{
+	auto& word = _freeBits[wordIndex];
+	auto  bits = word.load(std::memory_order_acquire);
+
+	while (bits != 0)
+	{
+		const auto bit = static_cast<gu::uint32>(std::countr_zero(bits));
+
+		// sꍇbitsŐV̒lɍXV邽, ̂܂܎̋󂫂T܂
+		if (word.compare_exchange_weak(bits, bits & ~(1ull << bit), std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			index = wordIndex * BITS_PER_WORD + bit;
+			return true;
+		}
+	}
+	return false;
+}
+
+/*!**********************************************************************
+*  @brief     [ĥ, capacitỹCfbNXɑΉrbgԂ܂.
+*  @param[in] const gu::uint32 [h̃CfbNX
+*  @param[in] const gu::uint32 ő吔
+*  @return    gu::uint64
+*************************************************************************/
+gu::uint64 DescriptorIndexAllocator::GetValidMask(const gu::uint32 wordIndex, const gu::uint32 capacity) noexcept
+{
+	const auto begin = static_cast<gu::uint64>(wordIndex) * BITS_PER_WORD;
+	if (begin >= capacity)                 { return 0; }
+	if (begin + BITS_PER_WORD <= capacity) { return ~0ull; }
+	return (1ull << (capacity - begin)) - 1;
+}
+#pragma endregion DescriptorIndexAllocator
+
+#pragma region DescriptorLinearAllocator
+/*!**********************************************************************
+*  @brief     Acount̃fBXNv^𔭍s܂. ͈͂̓O̖܂܂.
+*  @param[in]  const gu::uint32 
+*  @param[out] gu::uint32& 擪̃CfbNX (RXgN^Ŏw肵offset܂݂܂)
+*  @return     bool GPUŎgp͈̔͂ƏdȂꍇfalse
+*************************************************************************/
+bool DescriptorLinearAllocator::Allocate(const gu::uint32 count, gu::uint32& index)
+{
+	if (count == 0 || count > _capacity) { return false; }
+
+	auto head = _head.load(std::memory_order_relaxed);
+	while (true)
+	{
+		/*-------------------------------------------------------------------
+		-      ܂ꍇ, O̐擪甭s܂
+		---------------------------------------------------------------------*/
+		const auto position = head % _capacity;
+		const auto begin    = position + count > _capacity ? head + (_capacity - position) : head;
+		const auto end      = begin + count;
+
+		if (end - _tail.load(std::memory_order_acquire) > _capacity) { return false; }
+
+		if (_head.compare_exchange_weak(head, end, std::memory_order_acq_rel, std::memory_order_relaxed))
+		{
+			index = _offset + static_cast<gu::uint32>(begin % _capacity);
+			return true;
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ݂̃t[Ŕs͈͂, tFXl܂ŎgpƂċL^܂.
+*  @param[in] const gu::uint64 ̃t[̃R}h𑗐MɃVOitFXl
+*  @return    void
+*************************************************************************/
+void DescriptorLinearAllocator::EndFrame(const gu::uint64 fenceValue)
+{
+	_frames.Push(FrameRecord{ .FenceValue = fenceValue, .Head = _head.load(std::memory_order_acquire) });
+}
+
+/*!**********************************************************************
+*  @brief     tFXlȉ̃t[͈̔͂ėp\ɂ܂.
+*  @param[in] const gu::uint64 GPUŊtFXl
+*  @return    void
+*************************************************************************/
+void DescriptorLinearAllocator::Recycle(const gu::uint64 completedFenceValue)
+{
+	while (!_frames.IsEmpty() && _frames.Front().FenceValue <= completedFenceValue)
+	{
+		_tail.store(_frames.Front().Head, std::memory_order_release);
+		_frames.Pop();
+	}
+}
+
+/*!**********************************************************************
+*  @brief     SĂ͈̔͂ėp\ɂ܂. GPUACh̎̂݌ĂяoĂ.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DescriptorLinearAllocator::Reset()
+{
+	_frames.Clear();
+	_head.store(0, std::memory_order_release);
+	_tail.store(0, std::memory_order_release);
+}
+#pragma endregion DescriptorLinearAllocator
+
+#pragma region DescriptorThreadRange
+/*!**********************************************************************
+*  @brief     Acount̃fBXNv^𔭍s܂.
+*  @param[in]  const gu::uint32 
+*  @param[out] gu::uint32& 擪̃CfbNX
+*  @return     bool e͈̔͂Ȃꍇfalse
+*************************************************************************/
+bool DescriptorThreadRange::Allocate(const gu::uint32 count, gu::uint32& index)
+{
+	/*-------------------------------------------------------------------
+	-      ͈͂Ȃꍇ̂ݐemۂ܂ (q͂ł)
+	---------------------------------------------------------------------*/
+	if (_current + count > _end)
+	{
+		const auto chunkCount = count > _chunkSize ? count : _chunkSize;
+
+		gu::uint32 begin = 0;
+		if (!_parent.Allocate(chunkCount, begin)) { return false; }
+
+		_current = begin;
+		_end     = begin + chunkCount;
+	}
+
+	index     = _current;
+	_current += count;
+	return true;
+}
+#pragma endregion DescriptorThreadRange
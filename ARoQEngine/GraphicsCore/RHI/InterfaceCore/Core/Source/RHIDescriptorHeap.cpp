@@ -21,4 +21,72 @@ using namespace rhi::core;
 RHIDescriptorHeap::~RHIDescriptorHeap()
 {
 	if (!_heapInfo.IsEmpty()) { _heapInfo.Clear(); }
+}
+
+/****************************************************************************
+*                     AllocateTransient
+****************************************************************************/
+/* @fn        bool RHIDescriptorHeap::AllocateTransient(const DescriptorHeapType type, const gu::uint32 count, DescriptorID& firstID)
+*
+*  @brief     Allocate count contiguous descriptors valid until the frame is recycled. 
+*             Safe to call from several threads at once.
+*
+*  @param[in]  const DescriptorHeapType type
+*  @param[in]  const gu::uint32 count
+*  @param[out] DescriptorID& first descriptor index in the type range
+*
+*  @return @@bool false if the transient range is full or not reserved
+*****************************************************************************/
+bool RHIDescriptorHeap::AllocateTransient(const DescriptorHeapType type, const gu::uint32 count, DescriptorID& firstID)
+{
+	const auto allocator = GetTransientAllocator(type);
+	if (!allocator) { return false; }
+
+	return allocator->Allocate(count, firstID);
+}
+
+/****************************************************************************
+*                     EndFrame
+****************************************************************************/
+/* @fn        void RHIDescriptorHeap::EndFrame(const gu::uint64 frameSerial)
+*
+*  @brief     Record the transient descriptors issued in this frame as in use until frameSerial completes.
+*             Call from the render thread after the frame's command lists are submitted.
+*
+*  @param[in] const gu::uint64 frameSerial
+*
+*  @return @@void
+*****************************************************************************/
+void RHIDescriptorHeap::EndFrame(const gu::uint64 frameSerial)
+{
+	for (const auto& heapInfo : _heapInfo)
+	{
+		if (const auto allocator = GetTransientAllocator(heapInfo.Key))
+		{
+			allocator->EndFrame(frameSerial);
+		}
+	}
+}
+
+/****************************************************************************
+*                     Recycle
+****************************************************************************/
+/* @fn        void RHIDescriptorHeap::Recycle(const gu::uint64 completedFrameSerial)
+*
+*  @brief     Make the transient descriptors of the frames up to completedFrameSerial reusable.
+*             Call from the render thread after waiting for the GPU.
+*
+*  @param[in] const gu::uint64 completedFrameSerial
+*
+*  @return @@void
+*****************************************************************************/
+void RHIDescriptorHeap::Recycle(const gu::uint64 completedFrameSerial)
+{
+	for (const auto& heapInfo : _heapInfo)
+	{
+		if (const auto allocator = GetTransientAllocator(heapInfo.Key))
+		{
+			allocator->Recycle(completedFrameSerial);
+		}
+	}
 }
\ No newline at end of file
@@ -15,6 +15,8 @@
 #include "GraphicsCore/RHI/DirectX12/Core/Include/DirectX12Instance.hpp"
 // Vulkan
 #include "GraphicsCore/RHI/Vulkan/Core/Include/VulkanInstance.hpp"
+// Null
+#include "GraphicsCore/RHI/Null/Core/Include/NullInstance.hpp"
 #include "GameUtility/Base/Include/GUParse.hpp"
 #include "GameUtility/Base/Include/GUCommandLine.hpp"
 #include "stdio.h"
@@ -48,6 +50,11 @@ gu::SharedPointer<RHIInstance> rhi::core::RHIInstance::CreateInstance(const core
 			printf("Vulkan\n"); 
 			return gu::MakeShared<rhi::vulkan::RHIInstance>(debugCreateInfo); 
 		}
+		case GraphicsAPI::Null:
+		{
+			printf("Null\n");
+			return gu::MakeShared<rhi::null::RHIInstance>(debugCreateInfo);
+		}
 		default:
 		{
 			Confirmf(false, "Unknown API");
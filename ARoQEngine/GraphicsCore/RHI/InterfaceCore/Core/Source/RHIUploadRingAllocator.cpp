@@ -0,0 +1,141 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RHIUploadRingAllocator.cpp
+///  @brief  Abv[hpobt@̗̈t[PʂŔs, tFX̊ɍėp郊OAP[^ł.
+///  @author toide
+///  @date   2026/10/20 18:20:05
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/RHIUploadRingAllocator.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+UploadRingAllocator::UploadRingAllocator(const gu::uint64 capacity) : _capacity(capacity)
+{
+	Checkf(capacity > 0, "capacity must be greater than 0.\n");
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     ̈𔭍s܂.
+*  @param[in] const gu::uint64 oCgTCY
+*  @param[in] const gu::uint64 ACg (2̗ݏ)
+*  @return    gu::uint64 obt@̐擪̃ItZbg. 󂫂ꍇINVALID_OFFSET
+*************************************************************************/
+gu::uint64 UploadRingAllocator::Allocate(const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	Checkf(alignment > 0 && (alignment & (alignment - 1)) == 0, "alignment must be a power of 2.\n");
+
+	if (byteSize == 0 || byteSize > _capacity || _usedSize >= _capacity) { return INVALID_OFFSET; }
+
+	// gp̗̈悪ꍇ͐擪g܂
+	if (_usedSize == 0)
+	{
+		_head = 0;
+		_tail = 0;
+	}
+
+	const gu::uint64 alignedHead = (_head + alignment - 1) & ~(alignment - 1);
+	gu::uint64 offset = INVALID_OFFSET;
+	gu::uint64 end    = 0;
+
+	/*-------------------------------------------------------------------
+	-      [tail, head) gp̏ꍇ͖, ܂Ȃΐ擪 [0, tail) g܂
+	---------------------------------------------------------------------*/
+	if (_head >= _tail)
+	{
+		if (alignedHead + byteSize <= _capacity)
+		{
+			offset = alignedHead;
+			end    = alignedHead + byteSize;
+		}
+		else if (byteSize <= _tail)
+		{
+			offset = 0;
+			end    = byteSize;
+		}
+	}
+	/*-------------------------------------------------------------------
+	-      ܂ԂĂꍇ [head, tail) ̊Ԃ̂ݎg܂
+	---------------------------------------------------------------------*/
+	else if (alignedHead + byteSize <= _tail)
+	{
+		offset = alignedHead;
+		end    = alignedHead + byteSize;
+	}
+
+	if (offset == INVALID_OFFSET) { return INVALID_OFFSET; }
+
+	// ܂Ԃꍇ͖̗]gpʂɊ܂߂܂
+	const gu::uint64 consumed = offset == 0 && _head > 0 ? (_capacity - _head) + end : end - _head;
+
+	_head       = end;
+	_usedSize  += consumed;
+	_frameSize += consumed;
+	_frameAllocationCount++;
+	return offset;
+}
+
+/*!**********************************************************************
+*  @brief     ݂̃t[Ŕs̈, GPȔ̊tFXlƕRÂ܂.
+*  @param[in] const gu::uint64 tFXl
+*  @return    void
+*************************************************************************/
+void UploadRingAllocator::EndFrame(const gu::uint64 fenceValue)
+{
+	if (_frameSize > 0)
+	{
+		_frames.Push(FrameRecord{ fenceValue, _frameSize });
+		_pendingFrameCount++;
+	}
+
+	_frameSize            = 0;
+	_frameAllocationCount = 0;
+}
+
+/*!**********************************************************************
+*  @brief     tFXl܂ł̃t[̗̈ėp\ɂ܂.
+*  @param[in] const gu::uint64 tFXl
+*  @return    void
+*************************************************************************/
+void UploadRingAllocator::Recycle(const gu::uint64 completedFenceValue)
+{
+	while (!_frames.IsEmpty() && _frames.Front().FenceValue <= completedFenceValue)
+	{
+		const auto size = _frames.Front().Size;
+		_frames.Pop();
+		_pendingFrameCount--;
+
+		_tail      = (_tail + size) % _capacity;
+		_usedSize -= size;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     SĂ̗̈󂫏Ԃɖ߂܂. GPUSĂ̗̈gIĂꍇ̂݌ĂяoĂ.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void UploadRingAllocator::Reset()
+{
+	_frames.Clear();
+	_pendingFrameCount    = 0;
+	_head                 = 0;
+	_tail                 = 0;
+	_usedSize             = 0;
+	_frameSize            = 0;
+	_frameAllocationCount = 0;
+}
+#pragma endregion Main Function
@@ -106,6 +106,15 @@ namespace rhi::core
 		*  @return    void
 		*************************************************************************/
 		virtual void CompleteSetting(const gu::tstring& name = SP("GraphicsPipeline")) = 0;
+
+		/*!**********************************************************************
+		*  @brief     pCvCobNOEhō쐬܂. ܂łfallback̃pCvCŕ`悵܂. @n
+		*             񓯊쐬ɑΉĂȂAPIł, CompleteSettingƓ܂ő҂܂.
+		*  @param[in] const gu::tstring fobO\
+		*  @param[in] const gu::SharedPointer<GPUGraphicsPipelineState>& ܂łɎgp쐬ς݂̃pCvC. nullptȑꍇ͎gpɊ҂܂.
+		*  @return    void
+		*************************************************************************/
+		virtual void CompleteSettingAsync(const gu::tstring& name, [[maybe_unused]] const gu::SharedPointer<GPUGraphicsPipelineState>& fallback) { CompleteSetting(name); }
 		
 		#pragma endregion
 
@@ -326,6 +335,13 @@ namespace rhi::core
 		*************************************************************************/
 		virtual void SetName(const gu::tstring& name) = 0;
 
+		/*!**********************************************************************
+		*  @brief     pCvC̍쐬Ă邩Ԃ܂. CompleteSettingAsyncgpꍇ̂falseɂȂ܂.
+		*  @param[in] void
+		*  @return    bool
+		*************************************************************************/
+		virtual bool IsReady() const { return true; }
+
 		#pragma endregion
 		
 		#pragma region Public Constructor and Destructor
@@ -0,0 +1,278 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GPUShaderCache.hpp
+///  @brief  VF[_[̃RpCʂ, ͂̓e狁߂nbVlŃƃfBXNɃLbV܂.
+///  @author toide
+///  @date   2026/10/20 13:21:08
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GPU_SHADER_CACHE_HPP
+#define GPU_SHADER_CACHE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GPUShaderCompiler.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+#include <future>
+#include <mutex>
+#include <unordered_map>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace rhi::core
+{
+	/****************************************************************************
+	*				  			ShaderCacheBlob
+	****************************************************************************/
+	/* @brief  LbVɊi[RpCʂł.
+	*****************************************************************************/
+	struct ShaderCacheBlob
+	{
+		/*! @brief VF[_[̃oCgR[h*/
+		gu::DynamicArray<gu::uint8> ByteCode = {};
+
+		/*! @brief tNVf[^. o͂ȂRpCł͋ł*/
+		gu::DynamicArray<gu::uint8> Reflection = {};
+	};
+
+	/****************************************************************************
+	*				  			ShaderDependency
+	****************************************************************************/
+	/* @brief  RpCɓǂݍ񂾃t@C (C̃\[Xinclude) Ƃ̓ẽnbVlł.
+	*****************************************************************************/
+	struct ShaderDependency
+	{
+		/*! @brief RpCt@CpX*/
+		gu::tstring FilePath = SP("");
+
+		/*! @brief t@CẽnbVl (XX_64)*/
+		gu::uint64 ContentHash = 0;
+	};
+
+	/****************************************************************************
+	*				  			IShaderCacheCompiler
+	****************************************************************************/
+	/* @brief  VF[_[LbVgpRpCł. @n
+	*          OtBNXAPIƂ̎, LbV݂̂؂邽߂̃X^uōւ܂.
+	*****************************************************************************/
+	class IShaderCacheCompiler
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     VF[_[RpC܂. ̃Xbh瓯ɌĂ΂܂.
+		*  @param[in]  const ShaderCompilerOption& RpCݒ
+		*  @param[out] ShaderCacheBlob& RpC
+		*  @param[out] gu::DynamicArray<ShaderDependency>& ǂݍ񂾑SẴt@CƂ̓ẽnbVl
+		*  @return     bool RpCɐꍇtrue
+		*************************************************************************/
+		virtual bool Compile(const ShaderCompilerOption& option, ShaderCacheBlob& result, gu::DynamicArray<ShaderDependency>& dependencies) = 0;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     RpC̃o[Wrhݒ肩狁߂nbVlł. ςꍇ̓fBXÑLbV𖳌ɂ܂.
+		*  @param[in] void
+		*  @return    gu::uint64
+		*************************************************************************/
+		virtual gu::uint64 GetCompilerHash() const = 0;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief fXgN^*/
+		virtual ~IShaderCacheCompiler() = default;
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			GPUShaderCacheStatistics
+	****************************************************************************/
+	/* @brief  VF[_[LbV̓vł.
+	*****************************************************************************/
+	struct GPUShaderCacheStatistics
+	{
+		/*! @brief v̑*/
+		gu::uint64 RequestCount = 0;
+
+		/*! @brief Ԃ (ɗvꂽꍇ܂݂܂)*/
+		gu::uint64 MemoryHitCount = 0;
+
+		/*! @brief fBXNǂݍ񂾉*/
+		gu::uint64 DiskHitCount = 0;
+
+		/*! @brief RpC*/
+		gu::uint64 CompileCount = 0;
+
+		/*! @brief ˑt@C̓eςĂߔj*/
+		gu::uint64 InvalidatedCount = 0;
+
+		/*! @brief RpCɎs*/
+		gu::uint64 FailedCount = 0;
+
+		/*! @brief RpCɊ|v [ms]*/
+		double CompileMilliseconds = 0.0;
+	};
+
+	/****************************************************************************
+	*				  			GPUShaderCache
+	****************************************************************************/
+	/* @brief  VF[_[̃RpCʂLbV܂. @n
+	*          1. ݒ (t@C, Gg|Cg, ^[Qbg, define, includefBNg, tO, RpC) ̃nbVlŃGgT܂ @n
+	*          2. GgL^ˑt@C (C̃\[Xinclude̕) ݂̌̓ẽnbVlvꍇ̂ݍėp܂ @n
+	*          3. ɖꍇ CacheDirectory/<ݒ̃nbVl>.shader ǂݍ, Âꍇ̓RpCďo܂ @n
+	*          t@CẽnbVl̓t@CƂ1xvZ邽, s̕ύXInvalidateFileŒʒmĂ.
+	*****************************************************************************/
+	class GPUShaderCache : public gu::NonCopyable
+	{
+	public:
+		using BlobPointer = gu::SharedPointer<ShaderCacheBlob>;
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     LbVRpCʂԂ܂. Âꍇ̓RpC܂.
+		*  @param[in] const ShaderCompilerOption& RpCݒ
+		*  @return    BlobPointer RpC. sꍇnullptr
+		*************************************************************************/
+		BlobPointer GetOrCompile(const ShaderCompilerOption& option);
+
+		/*!**********************************************************************
+		*  @brief     ̐ݒ (p[~e[V) [J[XbhɐU蕪ăRpC܂.
+		*  @param[in] const gu::DynamicArray<ShaderCompilerOption>& RpCݒ
+		*  @return    gu::DynamicArray<BlobPointer> optionsƓԂ̃RpC. ŝnullptr
+		*************************************************************************/
+		gu::DynamicArray<BlobPointer> CompileBatch(const gu::DynamicArray<ShaderCompilerOption>& options);
+
+		/*!**********************************************************************
+		*  @brief     RpCݒ̃nbVl߂܂. t@C̓eDebugOutputDirectory͊܂݂܂.
+		*  @param[in] const ShaderCompilerOption& RpCݒ
+		*  @return    gu::uint64 nbVl
+		*************************************************************************/
+		gu::uint64 ComputeOptionHash(const ShaderCompilerOption& option) const;
+
+		/*!**********************************************************************
+		*  @brief     t@CύXꂽƂʒm܂. ̗vł̃t@CɈˑGg͓e؂܂.
+		*  @param[in] const gu::tstring& t@CpX
+		*  @return    void
+		*************************************************************************/
+		void InvalidateFile(const gu::tstring& filePath);
+
+		/*!**********************************************************************
+		*  @brief     SẴt@CẽnbVlj܂. zbg[hɎgp܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void InvalidateAllFiles();
+
+		/*!**********************************************************************
+		*  @brief     ̃LbVSĔj܂. fBXÑLbV͎c܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief LbVt@Č`ςꍇɍXV܂*/
+		static constexpr gu::uint32 FILE_VERSION = 1;
+
+		/*! @brief v*/
+		GPUShaderCacheStatistics GetStatistics() const;
+
+		/*! @brief LbVt@CofBNg*/
+		__forceinline const gu::tstring& GetCacheDirectory() const noexcept { return _cacheDirectory; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief RpCƃLbVt@CofBNgŏ܂. fBNg̏ꍇ݂̓̂ŃLbV܂*/
+		GPUShaderCache(const gu::SharedPointer<IShaderCacheCompiler>& compiler, const gu::tstring& cacheDirectory);
+
+		/*! @brief fXgN^*/
+		~GPUShaderCache();
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief , fBXN, RpC̏ɌʂT܂*/
+		BlobPointer Resolve(const ShaderCompilerOption& option, const gu::uint64 optionHash);
+
+		/*! @brief ˑt@C̓eL^ƓmF܂*/
+		bool IsUpToDate(const gu::DynamicArray<ShaderDependency>& dependencies);
+
+		/*! @brief t@CẽnbVlԂ܂. ǂݍ߂Ȃꍇ0ł*/
+		gu::uint64 GetFileHash(const gu::tstring& filePath);
+
+		/*! @brief fBXÑLbVt@Cǂݍ݂܂*/
+		bool Load(const gu::uint64 optionHash, gu::DynamicArray<ShaderDependency>& dependencies, ShaderCacheBlob& blob) const;
+
+		/*! @brief fBXNɃLbVt@Co܂*/
+		bool Save(const gu::uint64 optionHash, const gu::DynamicArray<ShaderDependency>& dependencies, const ShaderCacheBlob& blob) const;
+
+		/*! @brief LbVt@C̃pX*/
+		gu::tstring GetCacheFilePath(const gu::uint64 optionHash) const;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ̃LbV*/
+		struct Entry
+		{
+			gu::DynamicArray<ShaderDependency> Dependencies = {};
+			BlobPointer                        Blob         = nullptr;
+		};
+
+		/*! @brief LbVt@C̐擪ɏޏ*/
+		struct FileHeader
+		{
+			gu::uint32 Magic           = 0;
+			gu::uint32 Version         = 0;
+			gu::uint64 CompilerHash    = 0;
+			gu::uint64 OptionHash      = 0;
+			gu::uint64 DependencyCount = 0;
+			gu::uint64 ByteCodeSize    = 0;
+			gu::uint64 ReflectionSize  = 0;
+		};
+
+		/*! @brief LbVt@C̎ʎq 'ASHC'*/
+		static constexpr gu::uint32 FILE_MAGIC = 0x43485341;
+
+		/*! @brief RpC*/
+		gu::SharedPointer<IShaderCacheCompiler> _compiler = nullptr;
+
+		/*! @brief LbVt@CofBNg*/
+		gu::tstring _cacheDirectory = SP("");
+
+		/*! @brief ݒ̃nbVlƂ̃Gg*/
+		std::unordered_map<gu::uint64, Entry> _entries = {};
+
+		/*! @brief 쐬̌. ݒ𓯎ɗvꂽꍇ1xRpC܂*/
+		std::unordered_map<gu::uint64, std::shared_future<BlobPointer>> _inFlight = {};
+
+		/*! @brief t@CpX̃nbVlƂ̃t@CẽnbVl*/
+		std::unordered_map<gu::uint64, gu::uint64> _fileHashes = {};
+
+		/*! @brief CompileBatchŎgpXbhv[. ŏ̌Ăяoō쐬܂*/
+		gu::SharedPointer<gu::ThreadPool> _threadPool = nullptr;
+
+		/*! @brief v*/
+		GPUShaderCacheStatistics _statistics = {};
+
+		/*! @brief SẴoی삵܂*/
+		mutable std::mutex _mutex = {};
+
+		/*! @brief shader_cache_statsœv\܂*/
+		bool _printStatistics = false;
+		#pragma endregion
+	};
+}
+#endif
@@ -47,6 +47,12 @@ namespace rhi::core
 
 		// @brief : Offline Compile, already compiled fileName(filePath)
 		virtual void LoadBinary(const core::ShaderType type, const gu::tstring& fileName) = 0;
+
+		/*! @brief VF[_[^[Qbg̐ړ (vs, ps, lib...) Ԃ܂. VF[_[LbṼRpCgp܂*/
+		static gu::tstring GetShaderTypeName(ShaderType shaderType);
+
+		/*! @brief VF[_[o[W6_0̌`ŕԂ܂*/
+		static gu::tstring Format(float version);
 		#pragma endregion
 
 		#pragma region Public Property
@@ -115,10 +121,6 @@ namespace rhi::core
 		#pragma endregion
 
 		#pragma region Protected Function
-		gu::tstring GetShaderTypeName(ShaderType shaderType);
-
-		gu::tstring Format(float version);
-
 		/*!**********************************************************************
 		*  @brief     LȃVF[_[ݒ肩ǂԂ܂
 		*  @param[in] void
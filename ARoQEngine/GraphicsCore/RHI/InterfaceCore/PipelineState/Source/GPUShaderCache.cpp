@@ -0,0 +1,546 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GPUShaderCache.cpp
+///  @brief  VF[_[̃RpCʂ, ͂̓e狁߂nbVlŃƃfBXNɃLbV܂.
+///  @author toide
+///  @date   2026/10/20 13:21:08
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GPUShaderCache.hpp"
+#include "GameUtility/Base/Include/GUHash.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Base/Include/GUParse.hpp"
+#include "GameUtility/Base/Include/GUCommandLine.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+namespace
+{
+	/*! @brief loCgƂĖɒǉ܂*/
+	template<typename T>
+	void AppendBytes(gu::DynamicArray<gu::uint8>& bytes, const T& value)
+	{
+		const auto offset = bytes.Size();
+		bytes.Resize(offset + sizeof(T), true);
+		gu::Memory::Copy(bytes.Data() + offset, &value, sizeof(T));
+	}
+
+	/*! @brief 𒷂tŖɒǉ܂*/
+	void AppendString(gu::DynamicArray<gu::uint8>& bytes, const gu::tstring& string)
+	{
+		const auto byteSize = string.Size() * sizeof(gu::tchar);
+		AppendBytes(bytes, static_cast<gu::uint64>(string.Size()));
+
+		const auto offset = bytes.Size();
+		bytes.Resize(offset + byteSize, true);
+		gu::Memory::Copy(bytes.Data() + offset, string.CString(), byteSize);
+	}
+
+	/*! @brief oCg񂩂lǂݍ݂܂. ͈͊Ȍꍇfalse*/
+	template<typename T>
+	bool ReadBytes(const gu::DynamicArray<gu::uint8>& bytes, gu::uint64& offset, T& value)
+	{
+		if (offset + sizeof(T) > bytes.Size()) { return false; }
+
+		gu::Memory::Copy(&value, bytes.Data() + offset, sizeof(T));
+		offset += sizeof(T);
+		return true;
+	}
+
+	/*! @brief gu::tstringstd::filesystem::pathɕϊ܂. vbgtH[ɈˑȂt@CɎg܂*/
+	std::filesystem::path ToPath(const gu::tstring& path)
+	{
+		return std::filesystem::path(path.CString());
+	}
+
+	/*! @brief t@C̓eSēǂݍ݂܂. JȂꍇfalse*/
+	bool ReadAllBytes(const gu::tstring& filePath, gu::DynamicArray<gu::uint8>& bytes)
+	{
+		std::ifstream stream(ToPath(filePath), std::ios::binary | std::ios::ate);
+		if (!stream) { return false; }
+
+		const auto size = static_cast<gu::uint64>(stream.tellg());
+		bytes.Resize(size);
+		if (size == 0) { return true; }
+
+		stream.seekg(0, std::ios::beg);
+		return static_cast<bool>(stream.read(reinterpret_cast<char*>(bytes.Data()), static_cast<std::streamsize>(size)));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUShaderCache::GPUShaderCache(const gu::SharedPointer<IShaderCacheCompiler>& compiler, const gu::tstring& cacheDirectory)
+	: _compiler(compiler), _cacheDirectory(cacheDirectory)
+{
+	Checkf(_compiler, "compiler is nullptr");
+
+	_printStatistics = gu::Parse::Contains(gu::CommandLine::Get(), SP("shader_cache_stats"));
+
+	if (!_cacheDirectory.IsEmpty())
+	{
+		// 쐬łȂꍇSaves邾, ̃LbV͎g܂
+		std::error_code error = {};
+		std::filesystem::create_directories(ToPath(_cacheDirectory), error);
+	}
+}
+
+GPUShaderCache::~GPUShaderCache()
+{
+	// CompileBatch甲OɑSđ҂, Xbhv[ɎcĂƂ͂܂
+	_threadPool.Reset();
+
+	if (_printStatistics)
+	{
+		const auto statistics = GetStatistics();
+		printf("Shader cache : request %llu, memory hit %llu, disk hit %llu, compile %llu (%.2f ms), invalidated %llu, failed %llu\n",
+			statistics.RequestCount, statistics.MemoryHitCount, statistics.DiskHitCount, statistics.CompileCount,
+			statistics.CompileMilliseconds, statistics.InvalidatedCount, statistics.FailedCount);
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     LbVRpCʂԂ܂. Âꍇ̓RpC܂.
+*  @param[in] const ShaderCompilerOption& RpCݒ
+*  @return    BlobPointer RpC. sꍇnullptr
+*************************************************************************/
+GPUShaderCache::BlobPointer GPUShaderCache::GetOrCompile(const ShaderCompilerOption& option)
+{
+	const auto optionHash = ComputeOptionHash(option);
+
+	/*-------------------------------------------------------------------
+	-      ݒ쐬̏ꍇ, ̌ʂ҂܂
+	---------------------------------------------------------------------*/
+	std::promise<BlobPointer>       promise = {};
+	std::shared_future<BlobPointer> future  = {};
+	{
+		std::scoped_lock lock(_mutex);
+		_statistics.RequestCount++;
+
+		if (const auto found = _inFlight.find(optionHash); found != _inFlight.end())
+		{
+			_statistics.MemoryHitCount++;
+			future = found->second;
+		}
+		else
+		{
+			_inFlight[optionHash] = promise.get_future().share();
+		}
+	}
+
+	if (future.valid()) { return future.get(); }
+
+	/*-------------------------------------------------------------------
+	-      , fBXN, RpC̏ɒT܂
+	---------------------------------------------------------------------*/
+	BlobPointer blob = nullptr;
+	try
+	{
+		blob = Resolve(option, optionHash);
+		promise.set_value(blob);
+	}
+	catch (...)
+	{
+		promise.set_exception(std::current_exception());
+
+		std::scoped_lock lock(_mutex);
+		_inFlight.erase(optionHash);
+		throw;
+	}
+
+	std::scoped_lock lock(_mutex);
+	_inFlight.erase(optionHash);
+	return blob;
+}
+
+/*!**********************************************************************
+*  @brief     ̐ݒ (p[~e[V) [J[XbhɐU蕪ăRpC܂.
+*  @param[in] const gu::DynamicArray<ShaderCompilerOption>& RpCݒ
+*  @return    gu::DynamicArray<BlobPointer> optionsƓԂ̃RpC. ŝnullptr
+*************************************************************************/
+gu::DynamicArray<GPUShaderCache::BlobPointer> GPUShaderCache::CompileBatch(const gu::DynamicArray<ShaderCompilerOption>& options)
+{
+	gu::DynamicArray<BlobPointer> results(options.Size());
+	if (options.IsEmpty()) { return results; }
+
+	{
+		std::scoped_lock lock(_mutex);
+		if (!_threadPool)
+		{
+			const auto threadCount = std::thread::hardware_concurrency();
+			_threadPool = gu::MakeShared<gu::ThreadPool>(threadCount > 0 ? threadCount : 1);
+		}
+	}
+
+	std::vector<std::future<void>> futures = {};
+	futures.reserve(options.Size());
+	for (gu::uint64 i = 0; i < options.Size(); ++i)
+	{
+		futures.push_back(_threadPool->Submit([this, &options, &results, i]()
+		{
+			results[i] = GetOrCompile(options[i]);
+		}));
+	}
+
+	for (auto& future : futures)
+	{
+		future.get();
+	}
+
+	return results;
+}
+
+/*!**********************************************************************
+*  @brief     RpCݒ̃nbVl߂܂. t@C̓eDebugOutputDirectory͊܂݂܂.
+*  @param[in] const ShaderCompilerOption& RpCݒ
+*  @return    gu::uint64 nbVl
+*************************************************************************/
+gu::uint64 GPUShaderCache::ComputeOptionHash(const ShaderCompilerOption& option) const
+{
+	gu::DynamicArray<gu::uint8> bytes = {};
+	bytes.Reserve(256);
+
+	AppendBytes(bytes, _compiler->GetCompilerHash());
+	AppendBytes(bytes, option.Type);
+	AppendBytes(bytes, option.Version);
+	AppendBytes(bytes, option.OptimizationFlags);
+	AppendString(bytes, option.FileName);
+	AppendString(bytes, option.EntryPoint);
+
+	// }N̍Ē`⌟̈ႢŌʂς邽, яL[Ɋ܂߂܂
+	AppendBytes(bytes, static_cast<gu::uint64>(option.Defines.Size()));
+	for (const auto& define : option.Defines)
+	{
+		AppendString(bytes, define);
+	}
+
+	AppendBytes(bytes, static_cast<gu::uint64>(option.IncludeDirectories.Size()));
+	for (const auto& directory : option.IncludeDirectories)
+	{
+		AppendString(bytes, directory);
+	}
+
+	return gu::Hash::XX_64(bytes.Data(), bytes.Size());
+}
+
+/*!**********************************************************************
+*  @brief     t@CύXꂽƂʒm܂. ̗vł̃t@CɈˑGg͓e؂܂.
+*  @param[in] const gu::tstring& t@CpX
+*  @return    void
+*************************************************************************/
+void GPUShaderCache::InvalidateFile(const gu::tstring& filePath)
+{
+	std::scoped_lock lock(_mutex);
+	_fileHashes.erase(filePath.GetTypedHash());
+}
+
+/*!**********************************************************************
+*  @brief     SẴt@CẽnbVlj܂. zbg[hɎgp܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void GPUShaderCache::InvalidateAllFiles()
+{
+	std::scoped_lock lock(_mutex);
+	_fileHashes.clear();
+}
+
+/*!**********************************************************************
+*  @brief     ̃LbVSĔj܂. fBXÑLbV͎c܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void GPUShaderCache::Clear()
+{
+	std::scoped_lock lock(_mutex);
+	_entries.clear();
+	_fileHashes.clear();
+}
+#pragma endregion Public Function
+
+#pragma region Public Property
+/*!**********************************************************************
+*  @brief     vԂ܂.
+*  @param[in] void
+*  @return    GPUShaderCacheStatistics
+*************************************************************************/
+GPUShaderCacheStatistics GPUShaderCache::GetStatistics() const
+{
+	std::scoped_lock lock(_mutex);
+	return _statistics;
+}
+#pragma endregion Public Property
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     , fBXN, RpC̏ɌʂT܂
+*  @param[in] const ShaderCompilerOption& RpCݒ
+*  @param[in] const gu::uint64 ݒ̃nbVl
+*  @return    BlobPointer RpC. sꍇnullptr
+*************************************************************************/
+GPUShaderCache::BlobPointer GPUShaderCache::Resolve(const ShaderCompilerOption& option, const gu::uint64 optionHash)
+{
+	/*-------------------------------------------------------------------
+	-                      Memory
+	---------------------------------------------------------------------*/
+	Entry entry = {};
+	bool  hasEntry = false;
+	{
+		std::scoped_lock lock(_mutex);
+		if (const auto found = _entries.find(optionHash); found != _entries.end())
+		{
+			entry    = found->second;
+			hasEntry = true;
+		}
+	}
+
+	if (hasEntry)
+	{
+		if (IsUpToDate(entry.Dependencies))
+		{
+			std::scoped_lock lock(_mutex);
+			_statistics.MemoryHitCount++;
+			return entry.Blob;
+		}
+
+		std::scoped_lock lock(_mutex);
+		_statistics.InvalidatedCount++;
+	}
+
+	/*-------------------------------------------------------------------
+	-                      Disk
+	---------------------------------------------------------------------*/
+	else
+	{
+		ShaderCacheBlob blob = {};
+		if (Load(optionHash, entry.Dependencies, blob))
+		{
+			if (IsUpToDate(entry.Dependencies))
+			{
+				entry.Blob = gu::MakeShared<ShaderCacheBlob>(std::move(blob));
+
+				std::scoped_lock lock(_mutex);
+				_statistics.DiskHitCount++;
+				_entries[optionHash] = entry;
+				return entry.Blob;
+			}
+
+			std::scoped_lock lock(_mutex);
+			_statistics.InvalidatedCount++;
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-                      Compile
+	---------------------------------------------------------------------*/
+	const auto start = std::chrono::steady_clock::now();
+
+	ShaderCacheBlob blob = {};
+	entry.Dependencies.Clear();
+	const bool succeeded = _compiler->Compile(option, blob, entry.Dependencies);
+
+	const auto milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	if (!succeeded)
+	{
+		// sʂ̓LbVȂ, \[X𒼂Ύ̗vōăRpC܂
+		std::scoped_lock lock(_mutex);
+		_statistics.FailedCount++;
+		_statistics.CompileMilliseconds += milliseconds;
+		_entries.erase(optionHash);
+		return nullptr;
+	}
+
+	entry.Blob = gu::MakeShared<ShaderCacheBlob>(std::move(blob));
+	Save(optionHash, entry.Dependencies, *entry.Blob);
+
+	std::scoped_lock lock(_mutex);
+	_statistics.CompileCount++;
+	_statistics.CompileMilliseconds += milliseconds;
+
+	// RpCǂݍ񂾓eŐVƂ݂Ȃ܂
+	for (const auto& dependency : entry.Dependencies)
+	{
+		_fileHashes[dependency.FilePath.GetTypedHash()] = dependency.ContentHash;
+	}
+	_entries[optionHash] = entry;
+	return entry.Blob;
+}
+
+/*!**********************************************************************
+*  @brief     ˑt@C̓eL^ƓmF܂
+*  @param[in] const gu::DynamicArray<ShaderDependency>& ˑt@C
+*  @return    bool Sēꍇtrue
+*************************************************************************/
+bool GPUShaderCache::IsUpToDate(const gu::DynamicArray<ShaderDependency>& dependencies)
+{
+	if (dependencies.IsEmpty()) { return false; }
+
+	for (const auto& dependency : dependencies)
+	{
+		if (GetFileHash(dependency.FilePath) != dependency.ContentHash)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     t@CẽnbVlԂ܂. 1xvZt@CInvalidateFile܂ōČvZ܂.
+*  @param[in] const gu::tstring& t@CpX
+*  @return    gu::uint64 nbVl. ǂݍ߂Ȃꍇ0
+*************************************************************************/
+gu::uint64 GPUShaderCache::GetFileHash(const gu::tstring& filePath)
+{
+	const auto pathHash = filePath.GetTypedHash();
+	{
+		std::scoped_lock lock(_mutex);
+		if (const auto found = _fileHashes.find(pathHash); found != _fileHashes.end())
+		{
+			return found->second;
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-      t@C̓ǂݍ݂̓bN̊Oōs܂
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<gu::uint8> content = {};
+	if (!ReadAllBytes(filePath, content)) { return 0; }
+
+	const auto contentHash = gu::Hash::XX_64(content.Data(), content.Size());
+
+	std::scoped_lock lock(_mutex);
+	_fileHashes[pathHash] = contentHash;
+	return contentHash;
+}
+
+/*!**********************************************************************
+*  @brief     fBXÑLbVt@Cǂݍ݂܂
+*  @param[in]  const gu::uint64 ݒ̃nbVl
+*  @param[out] gu::DynamicArray<ShaderDependency>& ˑt@C
+*  @param[out] ShaderCacheBlob& RpC
+*  @return     bool ǂݍ߂ꍇtrue
+*************************************************************************/
+bool GPUShaderCache::Load(const gu::uint64 optionHash, gu::DynamicArray<ShaderDependency>& dependencies, ShaderCacheBlob& blob) const
+{
+	if (_cacheDirectory.IsEmpty()) { return false; }
+
+	/*-------------------------------------------------------------------
+	-                      Read file
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<gu::uint8> bytes = {};
+	if (!ReadAllBytes(GetCacheFilePath(optionHash), bytes) || bytes.IsEmpty()) { return false; }
+
+	/*-------------------------------------------------------------------
+	-                      Header
+	---------------------------------------------------------------------*/
+	gu::uint64 offset = 0;
+	FileHeader header = {};
+	if (!ReadBytes(bytes, offset, header)) { return false; }
+
+	if (header.Magic        != FILE_MAGIC   ||
+		header.Version      != FILE_VERSION ||
+		header.CompilerHash != _compiler->GetCompilerHash() ||
+		header.OptionHash   != optionHash)
+	{
+		return false;
+	}
+
+	/*-------------------------------------------------------------------
+	-                      Dependencies
+	---------------------------------------------------------------------*/
+	dependencies.Clear();
+	dependencies.Reserve(header.DependencyCount);
+	for (gu::uint64 i = 0; i < header.DependencyCount; ++i)
+	{
+		ShaderDependency dependency = {};
+		gu::uint64       length     = 0;
+		if (!ReadBytes(bytes, offset, dependency.ContentHash) || !ReadBytes(bytes, offset, length)) { return false; }
+		if (offset + length * sizeof(gu::tchar) > bytes.Size()) { return false; }
+
+		dependency.FilePath.Assign(reinterpret_cast<const gu::tchar*>(bytes.Data() + offset), length);
+		offset += length * sizeof(gu::tchar);
+		dependencies.Push(dependency);
+	}
+
+	/*-------------------------------------------------------------------
+	-                      Blob
+	---------------------------------------------------------------------*/
+	if (offset + header.ByteCodeSize + header.ReflectionSize != bytes.Size()) { return false; }
+
+	blob.ByteCode  .Resize(header.ByteCodeSize);
+	blob.Reflection.Resize(header.ReflectionSize);
+	gu::Memory::Copy(blob.ByteCode.Data()  , bytes.Data() + offset, header.ByteCodeSize);
+	gu::Memory::Copy(blob.Reflection.Data(), bytes.Data() + offset + header.ByteCodeSize, header.ReflectionSize);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     fBXNɃLbVt@Co܂
+*  @param[in] const gu::uint64 ݒ̃nbVl
+*  @param[in] const gu::DynamicArray<ShaderDependency>& ˑt@C
+*  @param[in] const ShaderCacheBlob& RpC
+*  @return    bool oꍇtrue
+*************************************************************************/
+bool GPUShaderCache::Save(const gu::uint64 optionHash, const gu::DynamicArray<ShaderDependency>& dependencies, const ShaderCacheBlob& blob) const
+{
+	if (_cacheDirectory.IsEmpty()) { return false; }
+
+	FileHeader header = {};
+	header.Magic           = FILE_MAGIC;
+	header.Version         = FILE_VERSION;
+	header.CompilerHash    = _compiler->GetCompilerHash();
+	header.OptionHash      = optionHash;
+	header.DependencyCount = dependencies.Size();
+	header.ByteCodeSize    = blob.ByteCode.Size();
+	header.ReflectionSize  = blob.Reflection.Size();
+
+	gu::DynamicArray<gu::uint8> bytes = {};
+	bytes.Reserve(sizeof(FileHeader) + header.ByteCodeSize + header.ReflectionSize + dependencies.Size() * 128);
+
+	AppendBytes(bytes, header);
+	for (const auto& dependency : dependencies)
+	{
+		AppendBytes (bytes, dependency.ContentHash);
+		AppendString(bytes, dependency.FilePath);
+	}
+
+	const auto offset = bytes.Size();
+	bytes.Resize(offset + header.ByteCodeSize + header.ReflectionSize, true);
+	if (header.ByteCodeSize   > 0) { gu::Memory::Copy(bytes.Data() + offset, blob.ByteCode.Data(), header.ByteCodeSize); }
+	if (header.ReflectionSize > 0) { gu::Memory::Copy(bytes.Data() + offset + header.ByteCodeSize, blob.Reflection.Data(), header.ReflectionSize); }
+
+	std::ofstream stream(ToPath(GetCacheFilePath(optionHash)), std::ios::binary | std::ios::trunc);
+	if (!stream) { return false; }
+
+	return static_cast<bool>(stream.write(reinterpret_cast<const char*>(bytes.Data()), static_cast<std::streamsize>(bytes.Size())));
+}
+
+/*!**********************************************************************
+*  @brief     LbVt@C̃pXԂ܂
+*  @param[in] const gu::uint64 ݒ̃nbVl
+*  @return    gu::tstring CacheDirectory/<ݒ̃nbVl>.shader
+*************************************************************************/
+gu::tstring GPUShaderCache::GetCacheFilePath(const gu::uint64 optionHash) const
+{
+	return _cacheDirectory + SP("/") + gu::tstring::FromNumber(optionHash) + SP(".shader");
+}
+#pragma endregion Protected Function
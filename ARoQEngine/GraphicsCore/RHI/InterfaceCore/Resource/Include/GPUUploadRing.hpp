@@ -0,0 +1,203 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GPUUploadRing.hpp
+///  @brief  t[̗eʂiIMapAbv[hobt@̈؂o, @n
+///          GPUBufferւ̃Rs[܂Ƃ߂Ĕs܂. ̈̓tFX̊ɍėp܂.
+///  @author toide
+///  @date   2026/10/20 18:42:31
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef GPU_UPLOAD_RING_HPP
+#define GPU_UPLOAD_RING_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIUploadRingAllocator.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+
+namespace rhi::core
+{
+	class RHIDevice;
+	class RHICommandList;
+	class GPUBuffer;
+
+	/****************************************************************************
+	*				  			UploadAllocation
+	****************************************************************************/
+	/* @brief  GPUUploadRing؂oAbv[ḧł. ̃t[̊܂ŗLł.
+	*****************************************************************************/
+	struct UploadAllocation
+	{
+		/*! @brief ̈Abv[hobt@*/
+		gu::SharedPointer<GPUBuffer> Buffer = nullptr;
+
+		/*! @brief obt@̐擪̃ItZbg [byte]*/
+		gu::uint64 Offset = 0;
+
+		/*! @brief ݐCPUAhX*/
+		gu::uint8* CPUAddress = nullptr;
+
+		/*! @brief 萔obt@ȂǂƂĒڎQƂꍇGPUAhX*/
+		gu::uint64 GPUAddress = 0;
+
+		/*! @brief Lȗ̈悩*/
+		__forceinline bool IsValid() const noexcept { return CPUAddress != nullptr; }
+	};
+
+	/****************************************************************************
+	*				  			GPUUploadRing
+	****************************************************************************/
+	/* @brief  t[Ƃ̃Abv[h1̑傫ȃAbv[hobt@ɏW񂵂܂. @n
+	*          Allocate256byteEɑ̈Ԃ, UploadBuffer̗͂̈ɏ񂾏ŃRs[\񂵂܂. @n
+	*          \񂵂Rs[FlushCopiesŃoA܂Ƃ߂1񂸂, ACopyBufferRegionƂĔs܂. @n
+	*          Oɋ󂫂ꍇ, ̃t[܂ŕێp̃Abv[hobt@ɐ؂ւ܂. @n
+	*          XVXbhŏ񂾒萔`XbhRs[邽, e֐͔r䂳Ă܂.
+	*****************************************************************************/
+	class GPUUploadRing : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     Abv[ḧ؂o܂. 񂾓e݂͌̃t[܂ŕێ܂.
+		*  @param[in] const gu::uint64 oCgTCY
+		*  @param[in] const gu::uint64 ACg (2̗ݏ)
+		*  @return    UploadAllocation Abv[ḧ
+		*************************************************************************/
+		UploadAllocation Allocate(const gu::uint64 byteSize, const gu::uint64 alignment = UploadRingAllocator::DEFAULT_ALIGNMENT);
+
+		/*!**********************************************************************
+		*  @brief     f[^Abv[ḧɏ, destinationւ̃Rs[\񂵂܂. @n
+		*             CPU珑߂obt@̏ꍇ͂̏Œڏ݂܂.
+		*  @param[in] const gu::SharedPointer<GPUBuffer>& Rs[̃obt@
+		*  @param[in] const void* ރf[^
+		*  @param[in] const gu::uint64 oCgTCY
+		*  @param[in] const gu::uint64 Rs[̃ItZbg [byte]
+		*  @return    void
+		*************************************************************************/
+		void UploadBuffer(const gu::SharedPointer<GPUBuffer>& destination, const void* data, const gu::uint64 byteSize, const gu::uint64 destinationOffset = 0);
+
+		/*!**********************************************************************
+		*  @brief     \񂵂Rs[R}hXgɐς݂܂. Rs[̏Ԃ͌ɖ߂܂.
+		*  @param[in] const gu::SharedPointer<RHICommandList>& L^GraphicsCopỹR}hXg
+		*  @return    void
+		*************************************************************************/
+		void FlushCopies(const gu::SharedPointer<RHICommandList>& commandList);
+
+		/*!**********************************************************************
+		*  @brief     ݂̃t[Ő؂ö, t[̊lƕRÂ܂.
+		*  @param[in] const gu::uint64 t[̊l
+		*  @return    void
+		*************************************************************************/
+		void EndFrame(const gu::uint64 fenceValue);
+
+		/*!**********************************************************************
+		*  @brief     l܂ł̃t[̗̈Ɛpobt@܂.
+		*  @param[in] const gu::uint64 l
+		*  @return    void
+		*************************************************************************/
+		void Recycle(const gu::uint64 completedFenceValue);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief OŜ̗e [byte]*/
+		__forceinline gu::uint64 GetCapacity() const noexcept { return _allocator.GetCapacity(); }
+
+		/*! @brief \񒆂̃Rs[̐*/
+		__forceinline gu::uint64 GetPendingCopyCount() const { std::scoped_lock lock(_mutex); return _pendingCopies.Size(); }
+
+		/*! @brief Õt[Ő؂o*/
+		__forceinline gu::uint32 GetLastFrameAllocationCount() const noexcept { return _lastFrameAllocationCount; }
+
+		/*! @brief Õt[Ő؂ooCgTCY*/
+		__forceinline gu::uint64 GetLastFrameAllocatedSize() const noexcept { return _lastFrameAllocatedSize; }
+
+		/*! @brief Õt[ŃOɎ܂炸pobt@쐬*/
+		__forceinline gu::uint32 GetLastFrameFallbackCount() const noexcept { return _lastFrameFallbackCount; }
+
+		/*! @brief Õt[ŏ݂ƃRs[̔sɊ|CPU [ms]*/
+		__forceinline double GetLastFrameUploadMilliseconds() const noexcept { return _lastFrameUploadMilliseconds; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief 1t[̗eʂƃt[w肵ăAbv[hobt@쐬܂*/
+		GPUUploadRing(const gu::SharedPointer<RHIDevice>& device, const gu::uint64 byteSizePerFrame, const gu::uint32 frameCount);
+
+		/*! @brief fXgN^*/
+		~GPUUploadRing();
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief rs킸ɗ̈؂o܂*/
+		UploadAllocation AllocateWithoutLock(const gu::uint64 byteSize, const gu::uint64 alignment);
+
+		/*! @brief OɎ܂Ȃ̈p̃Abv[hobt@Ƃč쐬܂*/
+		UploadAllocation AllocateFallback(const gu::uint64 byteSize);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief \񂵂Rs[*/
+		struct PendingCopy
+		{
+			gu::SharedPointer<GPUBuffer> Destination       = nullptr;
+			gu::uint64                   DestinationOffset = 0;
+			gu::SharedPointer<GPUBuffer> Source            = nullptr;
+			gu::uint64                   SourceOffset      = 0;
+			gu::uint64                   ByteSize          = 0;
+		};
+
+		/*! @brief t[̊܂ŕێp̃Abv[hobt@*/
+		struct FallbackBuffer
+		{
+			/*! @brief 쐬t[̊l. EndFrame܂ł͖mł*/
+			gu::uint64 FenceValue = UploadRingAllocator::INVALID_OFFSET;
+
+			gu::SharedPointer<GPUBuffer> Buffer = nullptr;
+		};
+
+		/*! @brief _foCX*/
+		gu::SharedPointer<RHIDevice> _device = nullptr;
+
+		/*! @brief O, \񂵂Rs[, v̔r*/
+		mutable std::mutex _mutex;
+
+		/*! @brief iIMapAbv[hobt@*/
+		gu::SharedPointer<GPUBuffer> _buffer = nullptr;
+
+		/*! @brief ÕItZbǧvZ*/
+		UploadRingAllocator _allocator;
+
+		/*! @brief \񂵂Rs[*/
+		gu::DynamicArray<PendingCopy> _pendingCopies = {};
+
+		/*! @brief ҂Ăp̃Abv[hobt@*/
+		gu::DynamicArray<FallbackBuffer> _fallbackBuffers = {};
+
+		/*! @brief ݂̃t[Őpobt@쐬*/
+		gu::uint32 _frameFallbackCount = 0;
+
+		/*! @brief ݂̃t[Őpobt@ƂĐ؂ooCgTCY*/
+		gu::uint64 _frameFallbackSize = 0;
+
+		/*! @brief ݂̃t[݂̏ƃRs[̔sɊ|CPU [ms]*/
+		double _frameUploadMilliseconds = 0.0;
+
+		gu::uint32 _lastFrameAllocationCount    = 0;
+		gu::uint64 _lastFrameAllocatedSize      = 0;
+		gu::uint32 _lastFrameFallbackCount      = 0;
+		double     _lastFrameUploadMilliseconds = 0.0;
+		#pragma endregion
+	};
+}
+
+#endif
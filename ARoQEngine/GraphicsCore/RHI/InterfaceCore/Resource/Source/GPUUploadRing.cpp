@@ -0,0 +1,274 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GPUUploadRing.cpp
+///  @brief  t[̗eʂiIMapAbv[hobt@̈؂o, @n
+///          GPUBufferւ̃Rs[܂Ƃ߂Ĕs܂. ̈̓tFX̊ɍėp܂.
+///  @author toide
+///  @date   2026/10/20 18:42:31
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/GPUUploadRing.hpp"
+#include "../Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <chrono>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::core;
+
+namespace
+{
+	constexpr gu::uint64 UPLOAD_ALIGNMENT = UploadRingAllocator::DEFAULT_ALIGNMENT;
+
+	gu::uint64 AlignUp(const gu::uint64 value, const gu::uint64 alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	double ElapsedMilliseconds(const std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	gu::SharedPointer<GPUBuffer> CreateMappedUploadBuffer(const gu::SharedPointer<RHIDevice>& device, const gu::uint64 byteSize, const gu::tstring& name)
+	{
+		const auto count  = static_cast<gu::uint32>(AlignUp(byteSize, UPLOAD_ALIGNMENT) / UPLOAD_ALIGNMENT);
+		const auto buffer = device->CreateBuffer(GPUBufferMetaData::UploadBuffer(static_cast<gu::uint32>(UPLOAD_ALIGNMENT), count), name);
+		buffer->Map();
+		return buffer;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUUploadRing::GPUUploadRing(const gu::SharedPointer<RHIDevice>& device, const gu::uint64 byteSizePerFrame, const gu::uint32 frameCount)
+	: _device(device), _allocator(AlignUp(byteSizePerFrame * frameCount, UPLOAD_ALIGNMENT))
+{
+	Checkf(_device != nullptr, "device is nullptr");
+	Checkf(frameCount > 0, "frameCount must be greater than 0.\n");
+
+	// t[̗̈1̃obt@ɂ܂Ƃ, j܂Map܂܂ɂ܂
+	_buffer = CreateMappedUploadBuffer(_device, _allocator.GetCapacity(), SP("UploadRing"));
+}
+
+GPUUploadRing::~GPUUploadRing()
+{
+	for (auto& fallback : _fallbackBuffers)
+	{
+		fallback.Buffer->Unmap();
+	}
+	_fallbackBuffers.Clear();
+	_pendingCopies.Clear();
+
+	if (_buffer != nullptr) { _buffer->Unmap(); }
+	_buffer.Reset();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     Abv[ḧ؂o܂. 񂾓e݂͌̃t[܂ŕێ܂.
+*  @param[in] const gu::uint64 oCgTCY
+*  @param[in] const gu::uint64 ACg (2̗ݏ)
+*  @return    UploadAllocation Abv[ḧ
+*************************************************************************/
+UploadAllocation GPUUploadRing::Allocate(const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	std::scoped_lock lock(_mutex);
+	return AllocateWithoutLock(byteSize, alignment);
+}
+
+/*!**********************************************************************
+*  @brief     f[^Abv[ḧɏ, destinationւ̃Rs[\񂵂܂. @n
+*             CPU珑߂obt@̏ꍇ͂̏Œڏ݂܂.
+*  @param[in] const gu::SharedPointer<GPUBuffer>& Rs[̃obt@
+*  @param[in] const void* ރf[^
+*  @param[in] const gu::uint64 oCgTCY
+*  @param[in] const gu::uint64 Rs[̃ItZbg [byte]
+*  @return    void
+*************************************************************************/
+void GPUUploadRing::UploadBuffer(const gu::SharedPointer<GPUBuffer>& destination, const void* data, const gu::uint64 byteSize, const gu::uint64 destinationOffset)
+{
+	Checkf(destination != nullptr, "destination is nullptr");
+	Checkf(data, "data is nullptr");
+	Check(destinationOffset + byteSize <= destination->GetTotalByteSize());
+
+	if (byteSize == 0) { return; }
+
+	std::scoped_lock lock(_mutex);
+	const auto start = std::chrono::steady_clock::now();
+
+	if (destination->GetMetaData().IsCPUAccessible())
+	{
+		destination->UploadByte(data, byteSize, destinationOffset);
+	}
+	else
+	{
+		const auto allocation = AllocateWithoutLock(byteSize, UPLOAD_ALIGNMENT);
+		gu::Memory::Copy(allocation.CPUAddress, data, byteSize);
+
+		_pendingCopies.Push({ destination, destinationOffset, allocation.Buffer, allocation.Offset, byteSize });
+	}
+
+	_frameUploadMilliseconds += ElapsedMilliseconds(start);
+}
+
+/*!**********************************************************************
+*  @brief     \񂵂Rs[R}hXgɐς݂܂. Rs[̏Ԃ͌ɖ߂܂.
+*  @param[in] const gu::SharedPointer<RHICommandList>& L^GraphicsCopỹR}hXg
+*  @return    void
+*************************************************************************/
+void GPUUploadRing::FlushCopies(const gu::SharedPointer<RHICommandList>& commandList)
+{
+	std::scoped_lock lock(_mutex);
+	if (_pendingCopies.IsEmpty()) { return; }
+
+	Checkf(commandList != nullptr, "commandList is nullptr");
+
+	const auto start = std::chrono::steady_clock::now();
+
+	/*-------------------------------------------------------------------
+	-      Rs[悲ƂɌ̏Ԃo, CopyDestinationւ̑Jڂ1ɂ܂Ƃ߂܂
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<gu::SharedPointer<GPUBuffer>> destinations = {};
+	gu::DynamicArray<ResourceState>                states       = {};
+	for (const auto& copy : _pendingCopies)
+	{
+		bool isFound = false;
+		for (const auto& destination : destinations)
+		{
+			if (destination.Get() == copy.Destination.Get()) { isFound = true; break; }
+		}
+		if (isFound) { continue; }
+
+		destinations.Push(copy.Destination);
+		states      .Push(copy.Destination->GetResourceState());
+		commandList->PushTransitionBarrier(gu::StaticPointerCast<GPUResource>(copy.Destination), ResourceState::CopyDestination);
+	}
+	commandList->FlushResourceBarriers();
+
+	/*-------------------------------------------------------------------
+	-      ԂĂ邽, Rs[̓oA܂ɘAĔs܂
+	---------------------------------------------------------------------*/
+	for (const auto& copy : _pendingCopies)
+	{
+		commandList->CopyBufferRegion(copy.Destination, copy.DestinationOffset, copy.Source, copy.SourceOffset, copy.ByteSize);
+	}
+
+	/*-------------------------------------------------------------------
+	-      ̏Ԃɖ߂܂
+	---------------------------------------------------------------------*/
+	for (gu::uint64 i = 0; i < destinations.Size(); ++i)
+	{
+		commandList->PushTransitionBarrier(gu::StaticPointerCast<GPUResource>(destinations[i]), states[i]);
+	}
+	commandList->FlushResourceBarriers();
+
+	_pendingCopies.Clear();
+	_frameUploadMilliseconds += ElapsedMilliseconds(start);
+}
+
+/*!**********************************************************************
+*  @brief     ݂̃t[Ő؂ö, t[̊lƕRÂ܂.
+*  @param[in] const gu::uint64 t[̊l
+*  @return    void
+*************************************************************************/
+void GPUUploadRing::EndFrame(const gu::uint64 fenceValue)
+{
+	std::scoped_lock lock(_mutex);
+	Checkf(_pendingCopies.IsEmpty(), "FlushCopies must be called before EndFrame.\n");
+
+	for (auto& fallback : _fallbackBuffers)
+	{
+		if (fallback.FenceValue == UploadRingAllocator::INVALID_OFFSET) { fallback.FenceValue = fenceValue; }
+	}
+
+	_lastFrameAllocationCount    = _allocator.GetFrameAllocationCount() + _frameFallbackCount;
+	_lastFrameAllocatedSize      = _allocator.GetFrameAllocatedSize()   + _frameFallbackSize;
+	_lastFrameFallbackCount      = _frameFallbackCount;
+	_lastFrameUploadMilliseconds = _frameUploadMilliseconds;
+
+	_allocator.EndFrame(fenceValue);
+	_frameFallbackCount      = 0;
+	_frameFallbackSize       = 0;
+	_frameUploadMilliseconds = 0.0;
+}
+
+/*!**********************************************************************
+*  @brief     l܂ł̃t[̗̈Ɛpobt@܂.
+*  @param[in] const gu::uint64 l
+*  @return    void
+*************************************************************************/
+void GPUUploadRing::Recycle(const gu::uint64 completedFenceValue)
+{
+	std::scoped_lock lock(_mutex);
+	_allocator.Recycle(completedFenceValue);
+
+	for (gu::uint64 i = _fallbackBuffers.Size(); i > 0; --i)
+	{
+		auto& fallback = _fallbackBuffers[i - 1];
+		if (fallback.FenceValue > completedFenceValue) { continue; }
+
+		fallback.Buffer->Unmap();
+		_fallbackBuffers.RemoveAt(i - 1, false);
+	}
+}
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     rs킸ɗ̈؂o܂. Oɋ󂫂ꍇ͐p̃Abv[hobt@쐬܂.
+*  @param[in] const gu::uint64 oCgTCY
+*  @param[in] const gu::uint64 ACg (2̗ݏ)
+*  @return    UploadAllocation Abv[ḧ
+*************************************************************************/
+UploadAllocation GPUUploadRing::AllocateWithoutLock(const gu::uint64 byteSize, const gu::uint64 alignment)
+{
+	Checkf(byteSize > 0, "byteSize must be greater than 0.\n");
+
+	const auto offset = _allocator.Allocate(byteSize, alignment);
+	if (offset == UploadRingAllocator::INVALID_OFFSET)
+	{
+		return AllocateFallback(byteSize);
+	}
+
+	return UploadAllocation
+	{
+		.Buffer     = _buffer,
+		.Offset     = offset,
+		.CPUAddress = _buffer->GetCPUMappedAddress() + offset,
+		.GPUAddress = _buffer->GetGPUVirtualAddress() + offset
+	};
+}
+
+/*!**********************************************************************
+*  @brief     OɎ܂Ȃ̈p̃Abv[hobt@Ƃč쐬܂.
+*  @param[in] const gu::uint64 oCgTCY
+*  @return    UploadAllocation Abv[ḧ
+*************************************************************************/
+UploadAllocation GPUUploadRing::AllocateFallback(const gu::uint64 byteSize)
+{
+	const auto buffer = CreateMappedUploadBuffer(_device, byteSize, SP("UploadRingFallback"));
+	_fallbackBuffers.Push({ UploadRingAllocator::INVALID_OFFSET, buffer });
+
+	_frameFallbackCount++;
+	_frameFallbackSize += byteSize;
+
+	return UploadAllocation
+	{
+		.Buffer     = buffer,
+		.Offset     = 0,
+		.CPUAddress = buffer->GetCPUMappedAddress(),
+		.GPUAddress = buffer->GetGPUVirtualAddress()
+	};
+}
+#pragma endregion Protected Function
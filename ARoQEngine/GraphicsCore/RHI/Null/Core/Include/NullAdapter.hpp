@@ -0,0 +1,59 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullAdapter.hpp
+///  @brief  NullobNGh̕foCXł.
+///  @author toide
+///  @date   2026/10/20 11:27:36
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_ADAPTER_HPP
+#define NULL_ADAPTER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIAdapter.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIDisplayAdapter
+	****************************************************************************/
+	/* @brief  ̂ȂfoCXł. rfI͎, j^[ڑĂȂ̂ƂĈ܂.
+	*****************************************************************************/
+	class RHIDisplayAdapter : public core::RHIDisplayAdapter, public gu::EnableSharedFromThis<RHIDisplayAdapter>
+	{
+	public:
+		#pragma region Public Function
+		/*! @brief NullobNGh̘_foCX쐬܂*/
+		gu::SharedPointer<core::RHIDevice> CreateDevice() override;
+
+		/*! @brief foCX̖Oo͂܂*/
+		virtual void PrintInfo() const override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief j^[͐ڑĂȂ0Ԃ܂*/
+		virtual gu::uint64 GetOutputCount() const override { return 0; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIDisplayAdapter() = default;
+
+		/*! @brief fXgN^*/
+		~RHIDisplayAdapter() = default;
+
+		/*! @brief Instance|C^gď*/
+		explicit RHIDisplayAdapter(const gu::SharedPointer<core::RHIInstance>& instance);
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCommandAllocator.hpp
+///  @brief  NullobNGh̃R}hXg[i[CPUł. @n
+///          CleanUpł̓TCY0ɂ, mۍς݂̗͎̈̃t[ōėp܂.
+///  @author toide
+///  @date   2026/10/20 9:20:11
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_COMMAND_ALLOCATOR_HPP
+#define NULL_COMMAND_ALLOCATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandAllocator.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          CommandAllocatorClass
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHICommandAllocator
+	****************************************************************************/
+	/* @brief     R}hXgL^R}hXg[i[܂. @n
+	*             R}hL[Ŏs, CleanUpŒg܂.
+	*****************************************************************************/
+	class RHICommandAllocator : public rhi::core::RHICommandAllocator
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief  R}hXg[܂. mۍς݂͉̃܂. @n
+		*          oChꂽR}hXg͂̊֐Ă΂OɕĂKv܂.
+		*************************************************************************/
+		virtual void CleanUp() override;
+
+		/*!**********************************************************************
+		*  @brief     R}hXg[̖byteSizë̗mۂ, ̐擪Ԃ܂. @n
+		*             Ԃ|C^͎AllocateĂԂ܂ł̊ԂLł.
+		*  @param[in] const gu::uint64 mۂoCg
+		*  @return    gu::uint8* mۂ̈̐擪
+		*************************************************************************/
+		gu::uint8* Allocate(const gu::uint64 byteSize);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief   L^ς݂̃R}hXg[Ԃ܂
+		*************************************************************************/
+		__forceinline const gu::DynamicArray<gu::uint8>& GetCommandStream() const noexcept { return _commandStream; }
+
+		/*!**********************************************************************
+		*  @brief   L^ς݂̃R}hXg[̃oCgԂ܂
+		*************************************************************************/
+		__forceinline gu::uint64 GetCommandStreamByteSize() const noexcept { return _commandStream.Size(); }
+
+		/*!**********************************************************************
+		*  @brief   fobOp̕\ݒ肵܂
+		*************************************************************************/
+		virtual void SetName(const gu::tstring& name) override { _name = name; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+
+		/*! @brief ftHgRXgN^*/
+		RHICommandAllocator() = default;
+
+		/*! @brief fXgN^*/
+		~RHICommandAllocator() = default;
+
+		/*! @brief foCXƃR}hXg̎ނŐRXgN^*/
+		explicit RHICommandAllocator(
+			const gu::SharedPointer<rhi::core::RHIDevice>& device,
+			const core::CommandListType type,
+			const gu::tstring& name);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief R}hXg[*/
+		gu::DynamicArray<gu::uint8> _commandStream = {};
+
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+		#pragma endregion
+	};
+}
+#endif
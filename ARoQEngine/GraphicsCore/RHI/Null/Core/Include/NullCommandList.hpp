@@ -0,0 +1,281 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCommandList.hpp
+///  @brief  GPUg킸ɕ`R}hR}hXg[֋L^R}hXgł.
+///  @author toide
+///  @date   2026/10/20 10:05:31
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_COMMAND_LIST_HPP
+#define NULL_COMMAND_LIST_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "NullCore.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHICommandList
+	****************************************************************************/
+	/* @brief  `施߂R}hAP[^̃oCgɋL^܂. GPUւ̑M͍s܂. @n
+	*          L^eCommandStreamReaderœǂݏo, R}h̎ނƂ̐GetStatisticsŎ擾ł܂. @n
+	*          \[XoAFlushResourceBarriers܂ŗ߂Ă, ÕoAłJڂ͂܂Ƃ߂Ď菜܂.
+	*****************************************************************************/
+	class RHICommandList : public rhi::core::RHICommandList, public gu::EnableSharedFromThis<RHICommandList>
+	{
+	public:
+		#pragma region Public Function
+		#pragma region Main Draw Frame
+		/*!**********************************************************************
+		*  @brief     R}hXgL^ԂɕύX܂. Draw֐̍ŏɎgp܂ @n
+		*  @param[in] `t[ɌĂ΂ꍇɃR}hAP[^̒gReset邩肷booll.
+		*  @return    void
+		*************************************************************************/
+		virtual void BeginRecording(const bool stillMidFrame) override;
+
+		/*!**********************************************************************
+		*  @brief     R}hXgL^Ԃs\ԂɕύX܂. Draw֐̍ŌɎgp܂
+		*  @return    void
+		*************************************************************************/
+		virtual void EndRecording () override;
+
+		/*!**********************************************************************
+		*  @brief     VRenderPassJn܂.
+		*  @param[in] const gu::SharedPointer<core::RHIRenderPass>& JnRenderPass
+		*  @param[in] const gu::SharedPointer<core::RHIFrameBuffer>& `ΏۂFrameBuffer
+		*  @return    void
+		*************************************************************************/
+		virtual void BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer) override;
+
+		/*!**********************************************************************
+		*  @brief     RenderPassI܂.
+		*  @return    void
+		*************************************************************************/
+		virtual void EndRenderPass() override;
+
+		/*!**********************************************************************
+		*  @brief     R}hXgL^Ԃɖ߂܂. ނ̃R}hAP[^ł΍ւs܂.
+		*  @param[in] const gu::SharedPointer<core::RHICommandAllocator>& ւR}hAP[^
+		*  @return    void
+		*************************************************************************/
+		virtual void Reset(const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator = nullptr) override;
+		#pragma endregion Main Draw Frame
+
+		#pragma region GPU Command
+		/*! @brief [xlw͈͂ɓĂ邩eXg, ͈͊OȂ΃sNZj܂.*/
+		virtual void SetDepthBounds(const float minDepth, const float maxDepth) override;
+
+		/*! @brief sNZVF[_̎spxݒ肵܂*/
+		virtual void SetShadingRate(const core::ShadingRate shadingRate, const gu::DynamicArray<core::ShadingRateCombiner>& combiners) override;
+
+		/*! @brief sNZVF[_̎spxeNX`Őݒ肵܂*/
+		virtual void SetShadingRateImage(const gu::SharedPointer<core::GPUTexture>& texture) override;
+
+		/*! @brief fBXNv^q[vݒ肵܂*/
+		virtual void SetDescriptorHeap(const gu::SharedPointer<core::RHIDescriptorHeap>& heap) override;
+
+		/*! @brief GPǓvJn܂*/
+		virtual void BeginQuery(const core::QueryResultLocation& location) override;
+
+		/*! @brief GPǓvI܂*/
+		virtual void EndQuery(const core::QueryResultLocation& location) override;
+
+		#pragma region Graphics Command Function
+		/*! @brief v~eBug|W[ݒ肵܂*/
+		virtual void SetPrimitiveTopology(const core::PrimitiveTopology topology) override;
+
+		/*! @brief r[|[gݒ肵܂*/
+		virtual void SetViewport(const core::Viewport& viewport) override;
+
+		/*! @brief ̃r[|[gݒ肵܂*/
+		virtual void SetViewport(const core::Viewport* viewport, const gu::uint32 numViewport = 1) override;
+
+		/*! @brief VRpɍẼr[|[gݒ肵܂*/
+		virtual void SetStereoViewport(const core::Viewport& leftView, const core::Viewport& rightView) override;
+
+		/*! @brief VU[`ݒ肵܂*/
+		virtual void SetScissor(const core::ScissorRect* rect, const gu::uint32 numRect = 1) override;
+
+		/*! @brief r[|[gƃVU[`𓯎ɐݒ肵܂*/
+		virtual void SetViewportAndScissor(const core::Viewport& viewport, const core::ScissorRect& rect) override;
+
+		/*! @brief `p̃\[XCAEgݒ肵܂*/
+		virtual void SetResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		/*! @brief `pCvCݒ肵܂. v~eBug|W[ɐݒ肵܂*/
+		virtual void SetGraphicsPipeline(const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipeline) override;
+
+		/*! @brief _obt@1ݒ肵܂*/
+		virtual void SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer) override;
+
+		/*! @brief ̒_obt@ݒ肵܂*/
+		virtual void SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot = 0) override;
+
+		/*! @brief CfbNXobt@ݒ肵܂*/
+		virtual void SetIndexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::PixelFormat indexType = core::PixelFormat::R32_UINT) override;
+
+		/*! @brief CfbNXgpĕ`悵܂*/
+		virtual void DrawIndexed(const gu::uint32 indexCount, const gu::uint32 startIndexLocation = 0, const gu::uint32 baseVertexLocation = 0) override;
+
+		/*! @brief CX^VOgpĕ`悵܂*/
+		virtual void DrawIndexedInstanced(const gu::uint32 indexCountPerInstance, const gu::uint32 instanceCount, const gu::uint32 startIndexLocation = 0, const gu::uint32 baseVertexLocation = 0, const gu::uint32 startInstanceLocation = 0) override;
+
+		/*! @brief obt@gĕ`悵܂*/
+		virtual void DrawIndexedIndirect(const gu::SharedPointer<core::GPUBuffer>& argumentBuffer, const gu::uint32 drawCallCount) override;
+
+		/*! @brief bVVF[_s܂*/
+		virtual void DispatchMesh(const gu::uint32 threadGroupCountX = 1, const gu::uint32 threadGroupCountY = 1, const gu::uint32 threadGroupCountZ = 1) override;
+		#pragma endregion Graphics Command Function
+
+		#pragma region Compute Command Function
+		/*! @brief Rs[gp̃\[XCAEgݒ肵܂*/
+		virtual void SetComputeResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		/*! @brief Rs[gpCvCݒ肵܂*/
+		virtual void SetComputePipeline(const gu::SharedPointer<core::GPUComputePipelineState>& pipeline) override;
+
+		/*! @brief Rs[gVF[_s܂*/
+		virtual void Dispatch(gu::uint32 threadGroupCountX = 1, gu::uint32 threadGroupCountY = 1, gu::uint32 threadGroupCountZ = 1) override;
+		#pragma endregion Compute Command Function
+
+		#pragma region Copy Command Function
+		/*! @brief 傫̃eNX`mRs[܂*/
+		virtual void CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source) override;
+
+		/*! @brief 傫̃\[XmRs[܂*/
+		void CopyResource(const gu::SharedPointer<core::GPUResource>& dest, const gu::SharedPointer<core::GPUResource>& source);
+
+		/*! @brief obt@̈ꕔRs[܂. ͈͊O̎w͋L^܂*/
+		virtual void CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>& dest, const gu::uint64 destOffset, const gu::SharedPointer<core::GPUBuffer>& source, const gu::uint64 sourceOffset, const gu::uint64 copyByteSize) override;
+
+		/*! @brief eNX`̈ꕔRs[܂*/
+		virtual void CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& destination, const gu::SharedPointer<core::GPUTexture>& source, const core::GPUTextureCopyInfo& copyInfo) override;
+		#pragma endregion Copy Command Function
+		#pragma endregion GPU Command
+
+		#pragma region Resource Barrier
+		/*!**********************************************************************
+		*  @brief     \[X̏ԑJڂ𗭂߂Ă܂. ۂ̏ԂFlushResourceBarriersŕύX܂.
+		*  @param[in] const gu::SharedPointer<core::GPUResource>& Ώۂ̃\[X
+		*  @param[in] const core::ResourceState Jڌ̏
+		*  @param[in] const gu::uint32 Tu\[X
+		*  @return    void
+		*************************************************************************/
+		virtual void PushTransitionBarrier(const gu::SharedPointer<core::GPUResource>& resource, const core::ResourceState after, const gu::uint32 subresource = 0xffffffff) override;
+
+		/*! @brief L郊\[X̐؂ւ𗭂߂Ă܂*/
+		virtual void PushAliasingBarrier(const gu::SharedPointer<core::GPUResource>& before, const gu::SharedPointer<core::GPUResource>& after) override;
+
+		/*! @brief UnorderedAccess̏݊҂𗭂߂Ă܂*/
+		virtual void PushUAVBarrier(const gu::SharedPointer<core::GPUResource>& resource) override;
+
+		/*! @brief ߂ĂoA1ResourceBarrierR}hƂċL^܂*/
+		virtual void FlushResourceBarriers() override;
+		#pragma endregion Resource Barrier
+
+		/*!**********************************************************************
+		*  @brief     CPŨobt@, eNX`ւ݂̏L^܂. GPUBuffer::UploadByteGPUTexture::WriteĂ΂܂.
+		*  @param[in] const ObjectID ݐ̃\[X
+		*  @param[in] const gu::uint64 ݊Jnʒu
+		*  @param[in] const gu::uint64 񂾃oCg
+		*  @return    void
+		*************************************************************************/
+		void RecordUploadResource(const ObjectID resource, const gu::uint64 offsetByte, const gu::uint64 byteSize);
+
+		/*!**********************************************************************
+		*  @brief     \[Xr[̐ݒL^܂. GPUResourceView::BindĂ΂܂.
+		*  @param[in] const ObjectID \[Xr[
+		*  @param[in] const gu::uint32 WX^ԍ
+		*  @return    void
+		*************************************************************************/
+		void RecordBindResourceView(const ObjectID resourceView, const gu::uint32 index);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief L^̃R}hXg[Ԃ܂*/
+		const gu::DynamicArray<gu::uint8>& GetCommandStream() const;
+
+		/*! @brief ŌBeginRecording (Reset)ĂL^R}h̏WvԂ܂*/
+		__forceinline const CommandStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/*! @brief fobO\Ԃ܂*/
+		__forceinline const gu::tstring& GetName() const noexcept { return _name; }
+
+		/*! @brief fobO\ݒ肵܂*/
+		virtual void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief obt@, eNX`̌ŗLIDԂ܂. nullptȑꍇINVALID_OBJECT_IDł*/
+		static ObjectID GetObjectID(const core::GPUResource* resource);
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHICommandList() = default;
+
+		/*! @brief fXgN^*/
+		~RHICommandList() = default;
+
+		/*! @brief _foCXƃR}hAP[^gč쐬܂*/
+		explicit RHICommandList(const gu::SharedPointer<rhi::core::RHIDevice>& device, const gu::SharedPointer<rhi::core::RHICommandAllocator>& commandAllocator, const gu::tstring& name);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*!**********************************************************************
+		*  @brief     wb_񂾏ŃyC[ḧ̗mۂ܂.
+		*  @param[in] const CommandType R}h̎
+		*  @param[in] const gu::uint64 yC[h̃oCg
+		*  @return    gu::uint8* yC[h̐擪
+		*************************************************************************/
+		gu::uint8* AllocateCommand(const CommandType type, const gu::uint64 payloadByteSize);
+
+		/*! @brief Œ蒷̃yC[hR}hL^܂ (yC[h8byteEɕԂƂ͌Ȃ߃oCgPʂŃRs[܂)*/
+		template<typename Payload>
+		void RecordCommand(const CommandType type, const Payload& payload)
+		{
+			gu::Memory::Copy(AllocateCommand(type, sizeof(Payload)), &payload, sizeof(Payload));
+		}
+
+		/*! @brief zR}hL^܂*/
+		template<typename Element>
+		void RecordArrayCommand(const CommandType type, const gu::uint32 value, const Element* elements, const gu::uint32 count)
+		{
+			const ArrayCommand header = { count, value };
+
+			auto* payload = AllocateCommand(type, sizeof(ArrayCommand) + sizeof(Element) * count);
+			gu::Memory::Copy(payload, &header, sizeof(ArrayCommand));
+			if (count > 0) { gu::Memory::Copy(payload + sizeof(ArrayCommand), elements, sizeof(Element) * count); }
+		}
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief FlushResourceBarriers܂ŗ߂ĂoA*/
+		struct PendingBarrier
+		{
+			BarrierCommand                       Command  = {};
+			gu::SharedPointer<core::GPUResource> Resource = nullptr;
+		};
+
+		/*! @brief FlushResourceBarriers܂ŗ߂ĂoA*/
+		gu::DynamicArray<PendingBarrier> _pendingBarriers = {};
+
+		/*! @brief L^R}h̏Wv*/
+		CommandStatistics _statistics = {};
+
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+		#pragma endregion
+	};
+}
+#endif
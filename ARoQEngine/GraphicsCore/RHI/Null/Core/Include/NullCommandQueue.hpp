@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCommandQueue.hpp
+///  @brief  NullobNGh̃R}hL[ł. sR}hXg̏Wvs܂.
+///  @author toide
+///  @date   2026/10/20 10:41:17
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_COMMAND_QUEUE_HPP
+#define NULL_COMMAND_QUEUE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandQueue.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHICommandQueue
+	****************************************************************************/
+	/* @brief     R}hXgɋL^ꂽR}hWv܂. GPU, Execute_ŎsƂ݂Ȃ܂. @n
+	*             Signal͒ɃtFX̒lXV, WaitGPȖҋ@ɑ鏈߉񐔂𐔂܂.
+	*****************************************************************************/
+	class RHICommandQueue : public rhi::core::RHICommandQueue
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ̃R}hL[̎s҂܂. Execute_ŎsƂ݂Ȃ, 񐔂̏Wvs܂.
+		*  @param[in] const gu::SharedPointer<core::RHIFence> : s߂Fence
+		*  @param[in] const gu::uint64 : ҋ@Il
+		*************************************************************************/
+		void Wait  (const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value) override;
+
+		/*!**********************************************************************
+		*  @brief     tFX̒l(value)𒼂ɍXV܂
+		*  @param[in] const gu::SharedPointer<core::RHIFence>& s߂Fence
+		*  @param[in] const gu::uint64 XVl
+		*************************************************************************/
+		void Signal(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value) override;
+
+		/*!**********************************************************************
+		*  @brief     ꂽR}hXg̏WvZ܂.
+		*  @param[in] GPŨR}h𒙂߂R}hXgz
+		*************************************************************************/
+		void Execute(const gu::DynamicArray<gu::SharedPointer<rhi::core::RHICommandList>>& commandLists) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief fobO*/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief ^CX^v̎g (imbPʂ̂1GHz) Ԃ܂.*/
+		gu::uint64 GetTimestampFrequency() override;
+
+		/*! @brief CPǓvMicroSecondsPʂŕԂ܂. GPU̎ɂl܂*/
+		core::GPUTimingCalibrationTimestamp GetCalibrationTimestamp() override;
+
+		/*! @brief ŌResetStatisticsĂłsR}h̏WvԂ܂*/
+		__forceinline const CommandStatistics& GetStatistics() const noexcept { return _statistics; }
+
+		/*! @brief sR}hXg̐Ԃ܂*/
+		__forceinline gu::uint64 GetExecutedCommandListCount() const noexcept { return _executedCommandListCount; }
+
+		/*! @brief WaitĂ񂾉񐔂Ԃ܂*/
+		__forceinline gu::uint64 GetWaitCount() const noexcept { return _waitCount; }
+
+		/*! @brief Wv0ɖ߂܂*/
+		void ResetStatistics();
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHICommandQueue() = default;
+
+		/*! @brief fXgN^*/
+		~RHICommandQueue() = default;
+
+		/*! @brief foCXƃR}hL[̎ނw肵č쐬RXgN^*/
+		explicit RHICommandQueue(const gu::SharedPointer<rhi::core::RHIDevice>& device, const core::CommandListType type, const gu::tstring& name);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief sR}h̏Wv*/
+		CommandStatistics _statistics = {};
+
+		/*! @brief sR}hXg̐*/
+		gu::uint64 _executedCommandListCount = 0;
+
+		/*! @brief WaitĂ񂾉*/
+		gu::uint64 _waitCount = 0;
+
+		/*! @brief fobO*/
+		gu::tstring _name = SP("");
+		#pragma endregion
+	};
+}
+#endif
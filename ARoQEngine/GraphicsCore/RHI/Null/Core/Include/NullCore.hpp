@@ -0,0 +1,302 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCore.hpp
+///  @brief  GPUgȂNullobNGhŋʂɎgpR}hXg[̒`ł. @n
+///          R}h4bytẽwb_ƌŒ蒷̃yC[hAoCgɋl߂ċL^܂. @n
+///          GPUIuWFNg̓|C^ł͂ȂfoCXsŗLIDŋL^邽, 菇ō쐬ΎsƂɓoCgɂȂ܂.
+///  @author toide
+///  @date   2026/10/20 9:12:40
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_CORE_HPP
+#define NULL_CORE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/*! @brief foCXsGPUIuWFNǧŗLID. 0͖l (nullptr) \܂*/
+	using ObjectID = gu::uint32;
+
+	/*! @brief ȃIuWFNgID*/
+	constexpr ObjectID INVALID_OBJECT_ID = 0;
+
+	/****************************************************************************
+	*				  			CommandType
+	****************************************************************************/
+	/* @brief  R}hXg[ɋL^R}h̎ނł.
+	*****************************************************************************/
+	enum class CommandType : gu::uint8
+	{
+		BeginRenderPass,          //!< RenderPassCommand
+		EndRenderPass,            //!< yC[h
+		SetResourceLayout,        //!< ObjectCommand (ResourceLayout)
+		SetComputeResourceLayout, //!< ObjectCommand (ResourceLayout)
+		SetDescriptorHeap,        //!< ObjectCommand (DescriptorHeap)
+		SetGraphicsPipeline,      //!< ObjectCommand (GraphicsPipelineState)
+		SetComputePipeline,       //!< ObjectCommand (ComputePipelineState)
+		SetPrimitiveTopology,     //!< ValueCommand (PrimitiveTopology)
+		SetViewport,              //!< ArrayCommand + core::Viewport[Count]
+		SetScissor,               //!< ArrayCommand + core::ScissorRect[Count]
+		SetVertexBuffers,         //!< ArrayCommand (Value = JnXbg) + ObjectID[Count]
+		SetIndexBuffer,           //!< IndexBufferCommand
+		SetDepthBounds,           //!< DepthBoundsCommand
+		SetShadingRate,           //!< ArrayCommand (Value = ShadingRate) + ShadingRateCombiner[Count]
+		SetShadingRateImage,      //!< ObjectCommand (Texture)
+		BindResourceView,         //!< BindResourceViewCommand
+		DrawIndexed,              //!< DrawIndexedCommand
+		DrawIndexedInstanced,     //!< DrawIndexedInstancedCommand
+		DrawIndexedIndirect,      //!< DrawIndexedIndirectCommand
+		Dispatch,                 //!< DispatchCommand
+		DispatchMesh,             //!< DispatchCommand
+		CopyResource,             //!< CopyResourceCommand
+		CopyBufferRegion,         //!< CopyBufferRegionCommand
+		CopyTextureRegion,        //!< CopyTextureRegionCommand
+		UploadResource,           //!< UploadResourceCommand
+		ResourceBarrier,          //!< ArrayCommand + BarrierCommand[Count]
+		BeginQuery,               //!< QueryCommand
+		EndQuery,                 //!< QueryCommand
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			CommandHeader
+	****************************************************************************/
+	/* @brief  eR}h̐擪ɒu4bytẽwb_ł. ̃R}h̓wb_̒ォByteSizeɑ܂.
+	*****************************************************************************/
+	struct CommandHeader
+	{
+		/*! @brief R}h̎*/
+		CommandType Type = CommandType::CountOf;
+
+		/*! @brief \̈ (0)*/
+		gu::uint8 Reserved = 0;
+
+		/*! @brief wb_yC[h̃oCg (wb_4byteEɕԂ悤؂グĂ܂)*/
+		gu::uint16 ByteSize = 0;
+	};
+
+	/*! @brief 1GPUIuWFNgݒ肷R}h*/
+	struct ObjectCommand
+	{
+		ObjectID Object = INVALID_OBJECT_ID;
+	};
+
+	/*! @brief 1̒lݒ肷R}h*/
+	struct ValueCommand
+	{
+		gu::uint32 Value = 0;
+	};
+
+	/*! @brief ϒ̔z񂪒ɑR}h. Value̓R}hƂ̒ǉ̒lł*/
+	struct ArrayCommand
+	{
+		gu::uint32 Count = 0;
+		gu::uint32 Value = 0;
+	};
+
+	struct RenderPassCommand
+	{
+		ObjectID RenderPass  = INVALID_OBJECT_ID;
+		ObjectID FrameBuffer = INVALID_OBJECT_ID;
+	};
+
+	struct IndexBufferCommand
+	{
+		ObjectID   Buffer    = INVALID_OBJECT_ID;
+		gu::uint32 IndexType = 0;
+	};
+
+	struct DepthBoundsCommand
+	{
+		float MinDepth = 0.0f;
+		float MaxDepth = 1.0f;
+	};
+
+	struct BindResourceViewCommand
+	{
+		ObjectID   ResourceView = INVALID_OBJECT_ID;
+		gu::uint32 Index        = 0;
+	};
+
+	struct DrawIndexedCommand
+	{
+		gu::uint32 IndexCount         = 0;
+		gu::uint32 StartIndexLocation = 0;
+		gu::uint32 BaseVertexLocation = 0;
+	};
+
+	struct DrawIndexedInstancedCommand
+	{
+		gu::uint32 IndexCountPerInstance = 0;
+		gu::uint32 InstanceCount         = 0;
+		gu::uint32 StartIndexLocation    = 0;
+		gu::uint32 BaseVertexLocation    = 0;
+		gu::uint32 StartInstanceLocation = 0;
+	};
+
+	struct DrawIndexedIndirectCommand
+	{
+		ObjectID   ArgumentBuffer = INVALID_OBJECT_ID;
+		gu::uint32 DrawCallCount  = 0;
+	};
+
+	struct DispatchCommand
+	{
+		gu::uint32 ThreadGroupCountX = 1;
+		gu::uint32 ThreadGroupCountY = 1;
+		gu::uint32 ThreadGroupCountZ = 1;
+	};
+
+	struct CopyResourceCommand
+	{
+		ObjectID Destination = INVALID_OBJECT_ID;
+		ObjectID Source      = INVALID_OBJECT_ID;
+	};
+
+	struct CopyBufferRegionCommand
+	{
+		ObjectID   Destination       = INVALID_OBJECT_ID;
+		ObjectID   Source            = INVALID_OBJECT_ID;
+		gu::uint64 DestinationOffset = 0;
+		gu::uint64 SourceOffset      = 0;
+		gu::uint64 ByteSize          = 0;
+	};
+
+	struct CopyTextureRegionCommand
+	{
+		ObjectID                 Destination = INVALID_OBJECT_ID;
+		ObjectID                 Source      = INVALID_OBJECT_ID;
+		core::GPUTextureCopyInfo CopyInfo    = {};
+	};
+
+	struct UploadResourceCommand
+	{
+		ObjectID   Resource   = INVALID_OBJECT_ID;
+		gu::uint64 OffsetByte = 0;
+		gu::uint64 ByteSize   = 0;
+	};
+
+	struct QueryCommand
+	{
+		ObjectID   QueryHeap = INVALID_OBJECT_ID;
+		gu::uint32 QueryID   = 0;
+	};
+
+	/*! @brief \[XoA̎*/
+	enum class BarrierType : gu::uint8
+	{
+		Transition,
+		Aliasing,
+		UnorderedAccess
+	};
+
+	/*! @brief ResourceBarrier̔zvf*/
+	struct BarrierCommand
+	{
+		BarrierType         Type        = BarrierType::Transition;
+		core::ResourceState Before      = core::ResourceState::Common;
+		core::ResourceState After       = core::ResourceState::Common;
+		gu::uint8           Reserved    = 0;
+		ObjectID            Resource    = INVALID_OBJECT_ID; //!< AliasingłBeforẽ\[X
+		ObjectID            AfterObject = INVALID_OBJECT_ID; //!< AliasingAfter̃\[X
+		gu::uint32          Subresource = 0xffffffff;
+	};
+
+	/****************************************************************************
+	*				  			CommandStatistics
+	****************************************************************************/
+	/* @brief  L^, sR}h̏Wvł. R}hXg͋L^, R}hL[͎sɉZ܂.
+	*****************************************************************************/
+	struct CommandStatistics
+	{
+		/*! @brief R}h̎ނƂ̐*/
+		gu::uint64 CommandCounts[static_cast<gu::uint8>(CommandType::CountOf)] = {};
+
+		/*! @brief ResourceBarrierɊ܂܂oA̐ (łoA͊܂݂܂)*/
+		gu::uint64 BarrierCount = 0;
+
+		/*! @brief R}hXg[̃oCg*/
+		gu::uint64 ByteSize = 0;
+
+		/*! @brief w肵ނ̃R}h̐Ԃ܂*/
+		__forceinline gu::uint64 GetCount(const CommandType type) const { return CommandCounts[static_cast<gu::uint8>(type)]; }
+
+		/*! @brief SẴR}h̐Ԃ܂*/
+		__forceinline gu::uint64 GetTotalCount() const
+		{
+			gu::uint64 count = 0;
+			for (const auto commandCount : CommandCounts) { count += commandCount; }
+			return count;
+		}
+
+		/*! @brief `R}h̐Ԃ܂*/
+		__forceinline gu::uint64 GetDrawCallCount() const
+		{
+			return GetCount(CommandType::DrawIndexed) + GetCount(CommandType::DrawIndexedInstanced) + GetCount(CommandType::DrawIndexedIndirect);
+		}
+
+		/*! @brief ʂ̏WvZ܂*/
+		__forceinline void Add(const CommandStatistics& other)
+		{
+			for (gu::uint8 i = 0; i < static_cast<gu::uint8>(CommandType::CountOf); ++i) { CommandCounts[i] += other.CommandCounts[i]; }
+			BarrierCount += other.BarrierCount;
+			ByteSize     += other.ByteSize;
+		}
+
+		/*! @brief Wv0ɖ߂܂*/
+		__forceinline void Reset() { *this = CommandStatistics(); }
+	};
+
+	/****************************************************************************
+	*				  			CommandStreamReader
+	****************************************************************************/
+	/* @brief  L^ς݂̃R}hXg[擪1R}hǂݐi߂܂.
+	*****************************************************************************/
+	class CommandStreamReader
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ̃R}hǂݍ݂܂.
+		*  @param[out] const CommandHeader*& R}h̃wb_
+		*  @param[out] const gu::uint8*& yC[h̐擪 (ByteSize0̏ꍇLȈʒuw܂)
+		*  @return    bool ǂݍ߂ꍇtrue, I[ɒBꍇfalse
+		*************************************************************************/
+		__forceinline bool Next(const CommandHeader*& header, const gu::uint8*& payload)
+		{
+			if (_offset + sizeof(CommandHeader) > _byteSize) { return false; }
+
+			header  = reinterpret_cast<const CommandHeader*>(_stream + _offset);
+			payload = _stream + _offset + sizeof(CommandHeader);
+			_offset += sizeof(CommandHeader) + header->ByteSize;
+			return true;
+		}
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief L^ς݂̃oCggč쐬܂*/
+		explicit CommandStreamReader(const gu::DynamicArray<gu::uint8>& stream) : _stream(stream.Data()), _byteSize(stream.Size()) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief oCg̐擪*/
+		const gu::uint8* _stream = nullptr;
+
+		/*! @brief oCg̑傫*/
+		gu::uint64 _byteSize = 0;
+
+		/*! @brief ɓǂݍވʒu*/
+		gu::uint64 _offset = 0;
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,122 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullDescriptorHeap.hpp
+///  @brief  NullobNGh̃fBXNv^q[vł. fBXNv^{͎̂, ނƂID̔sƉ͕킵܂.
+///  @author toide
+///  @date   2026/10/20 9:44:06
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_DESCRIPTOR_HEAP_HPP
+#define NULL_DESCRIPTOR_HEAP_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorHeap.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIDescriptorHeap
+	****************************************************************************/
+	/* @brief  fBXNv^̎ނƂ, ő吔𒴂Ȃ悤ID𔭍s܂. @n
+	*          ꂽID͎AllocateŗD悵čėp܂. DirectX12Ɠ, RTV, DSV, Sampler͑̎ނƓq[vɒu܂.
+	*****************************************************************************/
+	class RHIDescriptorHeap : public rhi::core::RHIDescriptorHeap
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     w肵ނ̃fBXNv^ID𔭍s܂.
+		*  @param[in] const core::DescriptorHeapType fBXNv^̎
+		*  @param[in] const gu::SharedPointer<core::RHIResourceLayout>& (Vulkan̂ݎgp)
+		*  @return    DescriptorID q[ṽCfbNX
+		*************************************************************************/
+		DescriptorID Allocate(const core::DescriptorHeapType heapType, [[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout = nullptr) override;
+
+		/*!**********************************************************************
+		*  @brief     ID𖢎gpԂɖ߂܂.
+		*  @param[in] const core::DescriptorHeapType fBXNv^̎
+		*  @param[in] const DescriptorID q[ṽCfbNX
+		*  @return    void
+		*************************************************************************/
+		void Free(const core::DescriptorHeapType heapType, const DescriptorID offsetIndex) override;
+
+		/*!**********************************************************************
+		*  @brief     fBXNv^̎ނƂ̍ő吔ݒ肵܂. ɑ傫TCYmۂĂꍇ͉܂.
+		*  @param[in] const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& ނƂ̍ő吔
+		*  @return    void
+		*************************************************************************/
+		void Resize(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfo) override;
+
+		/*!**********************************************************************
+		*  @brief     1ނ̃fBXNv^̍ő吔ݒ肵܂.
+		*  @param[in] const core::DescriptorHeapType fBXNv^̎
+		*  @param[in] const size_t ő吔
+		*  @return    void
+		*************************************************************************/
+		void Resize(const core::DescriptorHeapType type, const size_t viewCount) override;
+
+		/*!**********************************************************************
+		*  @brief     sς݂IDSĖgpɖ߂܂. All̏ꍇ͍ő吔̐ݒj܂.
+		*  @param[in] const ResetFlag Zbg͈̔
+		*  @return    void
+		*************************************************************************/
+		void Reset(const ResetFlag flag = ResetFlag::OnlyOffset) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+
+		/*! @brief w肵ނ̎gp̃fBXNv^Ԃ܂*/
+		gu::uint32 GetUsedCount(const core::DescriptorHeapType heapType) const;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIDescriptorHeap() = default;
+
+		/*! @brief fXgN^*/
+		~RHIDescriptorHeap() = default;
+
+		/*! @brief _foCXgč쐬܂*/
+		explicit RHIDescriptorHeap(const gu::SharedPointer<core::RHIDevice>& device);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief RTV, DSV, Sampler̎ނƍĂȂmF܂*/
+		bool CheckCorrectViewConbination(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos) const;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief fBXNv^̎ނƂIDs*/
+		struct DescriptorAllocator
+		{
+			/*! @brief ő吔*/
+			gu::uint32 MaxCount = 0;
+
+			/*! @brief 擪甭sID̐*/
+			gu::uint32 IssuedCount = 0;
+
+			/*! @brief ꂽID*/
+			gu::DynamicArray<DescriptorID> FreeIDs = {};
+		};
+
+		/*! @brief fBXNv^̎ނƂIDs*/
+		gu::SortedMap<core::DescriptorHeapType, DescriptorAllocator> _allocators = {};
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+	};
+}
+#endif
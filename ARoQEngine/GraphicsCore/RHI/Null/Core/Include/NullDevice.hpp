@@ -0,0 +1,222 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullDevice.hpp
+///  @brief  GPUg킸Ƀ_[CPȔs_foCXł. @n
+///          GPU\[XCPUŖ͕킵, R}h͎sɃR}hXg[ƂċL^܂. @n
+///          GPU̖CIŃ_[CPUׂv, L^R}hrAeXgɎgp܂.
+///  @author toide
+///  @date   2026/10/20 9:31:52
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_DEVICE_HPP
+#define NULL_DEVICE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "NullCore.hpp"
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIDevice
+	****************************************************************************/
+	/* @brief  NullobNGh̘_foCXł. 쐬GPUIuWFNgɍ쐬̌ŗLID𔭍s܂. @n
+	*          Cg[VO֘ÃIuWFNg͍쐬ł, nullptrԂ܂.
+	*****************************************************************************/
+	class RHIDevice : public core::RHIDevice, public gu::EnableSharedFromThis<RHIDevice>
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ftHg̃fBXNv^q[vj܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Destroy() override;
+
+		/*!**********************************************************************
+		*  @brief     efBXNv^q[vDefaultHeapCountɊÂč쐬܂
+		*  @param[in] const core::DefaultHeapCount fBXNv^q[ṽTCY肷\
+		*  @return    void
+		*************************************************************************/
+		virtual void SetUpDefaultHeap(const core::DefaultHeapCount& heapCount) override;
+
+		virtual gu::SharedPointer<core::RHIFrameBuffer>             CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil = nullptr) override;
+
+		virtual gu::SharedPointer<core::RHIFrameBuffer>             CreateFrameBuffer(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil = nullptr) override;
+
+		virtual gu::SharedPointer<core::RHIFence>                   CreateFence(const gu::uint64 fenceValue = 0, const gu::tstring& name = SP("")) override;
+
+		virtual gu::SharedPointer<core::RHICommandList>             CreateCommandList(const gu::SharedPointer<core::RHICommandAllocator>& commandAllocator, const gu::tstring& name) override;
+
+		virtual gu::SharedPointer<core::RHICommandQueue>            CreateCommandQueue(const core::CommandListType type, const gu::tstring& name) override;
+
+		virtual gu::SharedPointer<core::RHICommandAllocator>        CreateCommandAllocator(const core::CommandListType type, const gu::tstring& name) override;
+
+		virtual gu::SharedPointer<core::RHISwapchain>               CreateSwapchain(const gu::SharedPointer<core::RHICommandQueue>& commandQueue, const core::WindowInfo& windowInfo, const core::PixelFormat& pixelFormat, const gu::uint8 frameBufferCount = 2, const gu::uint8 vsync = 0, const bool isValidHDR = true) override;
+
+		virtual gu::SharedPointer<core::RHISwapchain>               CreateSwapchain(const core::SwapchainDesc& desc) override;
+
+		virtual gu::SharedPointer<core::RHIDescriptorHeap>          CreateDescriptorHeap(const core::DescriptorHeapType heapType, const size_t maxDescriptorCount) override;
+
+		virtual gu::SharedPointer<core::RHIDescriptorHeap>          CreateDescriptorHeap(const gu::SortedMap<core::DescriptorHeapType, size_t>& heapInfo) override;
+
+		virtual gu::SharedPointer<core::RHIRenderPass>              CreateRenderPass(const gu::DynamicArray<core::Attachment>& colors, const gu::Optional<core::Attachment>& depth) override;
+
+		virtual gu::SharedPointer<core::RHIRenderPass>              CreateRenderPass(const core::Attachment& color, const gu::Optional<core::Attachment>& depth) override;
+
+		virtual gu::SharedPointer<core::GPUGraphicsPipelineState>   CreateGraphicPipelineState(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		virtual gu::SharedPointer<core::GPUComputePipelineState>    CreateComputePipelineState(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout) override;
+
+		virtual gu::SharedPointer<core::RHIResourceLayout>          CreateResourceLayout(const gu::DynamicArray<core::ResourceLayoutElement>& elements = {}, const gu::DynamicArray<core::SamplerLayoutElement>& samplers = {}, const gu::Optional<core::Constant32Bits>& constant32Bits = {}, const gu::tstring& name = SP("ResourceLayout")) override;
+
+		virtual gu::SharedPointer<core::GPUPipelineFactory>         CreatePipelineFactory() override;
+
+		virtual gu::SharedPointer<core::GPUResourceView>            CreateResourceView(const core::ResourceViewType viewType, const gu::SharedPointer<core::GPUTexture>& texture, const gu::uint32 mipSlice = 0, const gu::uint32 placeSlice = 0, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr) override;
+
+		virtual gu::SharedPointer<core::GPUResourceView>            CreateResourceView(const core::ResourceViewType viewType, const gu::SharedPointer<core::GPUBuffer>& buffer, const gu::uint32 mipSlice = 0, const gu::uint32 placeSlice = 0, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr) override;
+
+		virtual gu::SharedPointer<core::GPUSampler>                 CreateSampler(const core::SamplerInfo& samplerInfo) override;
+
+		virtual gu::SharedPointer<core::GPUBuffer>                  CreateBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name = SP("")) override;
+
+		virtual gu::SharedPointer<core::GPUTexture>                 CreateTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name = SP("")) override;
+
+		virtual gu::SharedPointer<core::GPUTexture>                 CreateTextureEmpty() override;
+
+		/*! @brief Cg[VOɂ͑ΉĂȂ, nullptrԂ܂*/
+		virtual gu::SharedPointer<core::RayTracingGeometry>         CreateRayTracingGeometry(const core::RayTracingGeometryFlags flags, const gu::SharedPointer<core::GPUBuffer>& vertexBuffer, const gu::SharedPointer<core::GPUBuffer>& indexBuffer = nullptr) override;
+
+		/*! @brief Cg[VOɂ͑ΉĂȂ, nullptrԂ܂*/
+		virtual gu::SharedPointer<core::ASInstance>                 CreateASInstance(
+			const gu::SharedPointer<core::BLASBuffer>& blasBuffer, const gm::Float3x4& blasTransform,
+			const gu::uint32 instanceID, const gu::uint32 instanceContributionToHitGroupIndex,
+			const gu::uint32 instanceMask = 0xFF, const core::RayTracingInstanceFlags flags = core::RayTracingInstanceFlags::None) override;
+
+		/*! @brief Cg[VOɂ͑ΉĂȂ, nullptrԂ܂*/
+		virtual gu::SharedPointer<core::BLASBuffer>                 CreateRayTracingBLASBuffer(const gu::DynamicArray<gu::SharedPointer<core::RayTracingGeometry>>& geometryDesc, const core::BuildAccelerationStructureFlags flags) override;
+
+		/*! @brief Cg[VOɂ͑ΉĂȂ, nullptrԂ܂*/
+		virtual gu::SharedPointer<core::TLASBuffer>                 CreateRayTracingTLASBuffer(const gu::DynamicArray<gu::SharedPointer<core::ASInstance>>& asInstances, const core::BuildAccelerationStructureFlags flags) override;
+
+		virtual gu::SharedPointer<core::RHIQuery>                   CreateQuery(const core::QueryHeapType heapType) override;
+
+		/*!**********************************************************************
+		*  @brief     GPUIuWFNǧŗLID𔭍s܂. 쐬1犄U܂.
+		*  @param[in] void
+		*  @return    ObjectID ŗLID
+		*************************************************************************/
+		__forceinline ObjectID IssueObjectID() { return _objectIDCounter.fetch_add(1, std::memory_order_relaxed) + 1; }
+
+		/*!**********************************************************************
+		*  @brief     CPUŖ͕킵obt@̉zGPUAhX𔭍s܂. 쐬łΖ񓯂lɂȂ܂.
+		*  @param[in] const gu::uint64 obt@̃oCg
+		*  @return    gu::uint64 zGPUAhX
+		*************************************************************************/
+		gu::uint64 IssueGPUVirtualAddress(const gu::uint64 byteSize);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*!**********************************************************************
+		*  @brief     ftHg̃fBXNv^q[vԂ܂.
+		*  @param[in] const core::DescriptorHeapType fBXNv^̎
+		*  @return    gu::SharedPointer<core::RHIDescriptorHeap>
+		*************************************************************************/
+		virtual gu::SharedPointer<core::RHIDescriptorHeap> GetDefaultHeap(const core::DescriptorHeapType heapType) override;
+
+		/*! @brief Variable Rate ShadingɑΉĂȂ0Ԃ܂*/
+		virtual gu::uint32 GetShadingRateImageTileSize() const override { return 0; }
+
+		/*! @brief fobO\ݒ肵܂*/
+		virtual void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief 쐬GPUIuWFNg̐Ԃ܂*/
+		__forceinline gu::uint32 GetObjectCount() const { return _objectIDCounter.load(std::memory_order_relaxed); }
+
+		/*! @brief CPUŖ͕킵ĂGPU\[X̑oCgԂ܂*/
+		__forceinline gu::uint64 GetAllocatedByteSize() const { return _allocatedByteSize.load(std::memory_order_relaxed); }
+
+		/*! @brief GPU\[X̍쐬, jɖ͕킵Ă郁ʂL^܂*/
+		__forceinline void AddAllocatedByteSize   (const gu::uint64 byteSize) { _allocatedByteSize.fetch_add(byteSize, std::memory_order_relaxed); }
+		__forceinline void RemoveAllocatedByteSize(const gu::uint64 byteSize) { _allocatedByteSize.fetch_sub(byteSize, std::memory_order_relaxed); }
+
+		/*-------------------------------------------------------------------
+		-               Device Support Check
+		---------------------------------------------------------------------*/
+		bool IsSupportedDxr                () const override { return false; }
+
+		bool IsSupportedHDR                () const override { return false; }
+
+		bool IsSupportedVariableRateShading() const override { return false; }
+
+		bool IsSupportedMeshShading        () const override { return false; }
+
+		bool IsSupportedDrawIndirected     () const override { return true; }
+
+		bool IsSupportedGeometryShader     () const override { return true; }
+
+		bool IsSupportedRenderPass         () const override { return true; }
+
+		bool IsSupportedDepthBoundsTest    () const override { return true; }
+
+		bool IsSupportedSamplerFeedback    () const override { return false; }
+
+		bool IsSupportedStencilReferenceFromPixelShader() const override { return false; }
+
+		bool IsSupportedWaveLane           () const override { return false; }
+
+		bool IsSupportedNative16bitOperation() const override { return false; }
+
+		bool IsSupportedAtomicOperation    () const override { return false; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIDevice() = default;
+
+		/*! @brief fXgN^*/
+		~RHIDevice();
+
+		/*! @brief foCXgč쐬܂*/
+		RHIDevice(const gu::SharedPointer<core::RHIDisplayAdapter>& adapter, const core::RHIMultiGPUMask& mask = core::RHIMultiGPUMask::SingleGPU());
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ftHg̃fBXNv^q[v̎*/
+		enum DefaultHeapType
+		{
+			CBV_SRV_UAV,
+			RTV,
+			DSV,
+			Sampler
+		};
+
+		/*! @brief ftHg̃fBXNv^q[v*/
+		gu::SortedMap<DefaultHeapType, gu::SharedPointer<core::RHIDescriptorHeap>> _defaultHeap = {};
+
+		/*! @brief sς݂̌ŗLID̐*/
+		std::atomic<ObjectID> _objectIDCounter = 0;
+
+		/*! @brief ɔs鉼zGPUAhX*/
+		std::atomic<gu::uint64> _gpuVirtualAddress = 0;
+
+		/*! @brief CPUŖ͕킵ĂGPU\[X̑oCg*/
+		std::atomic<gu::uint64> _allocatedByteSize = 0;
+
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("NullDevice");
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullFence.hpp
+///  @brief  NullobNGh̃tFXł. GPŮlCPU̒lŖ͕킵܂. @n
+///          R}hL[Signal͎s_őɊ邽, Waitőҋ@̂͂܂SignalĂȂl҂ꍇł.
+///  @author toide
+///  @date   2026/10/20 9:52:37
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_FENCE_HPP
+#define NULL_FENCE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
+#include <atomic>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIFence
+	****************************************************************************/
+	/* @brief  CPU̒lœ͕킷tFXł.
+	*****************************************************************************/
+	class RHIFence : public rhi::core::RHIFence
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     tFX̒lݒ肵܂. ɑ傫lݒ肳Ăꍇ͉܂.
+		*  @param[in] const std::uint64_t ݒ肷l
+		*  @return    void
+		*************************************************************************/
+		void Signal(const std::uint64_t value) override;
+
+		/*!**********************************************************************
+		*  @brief     tFX̒lvalueȏɂȂ܂őҋ@܂. ̃XbhSignal҂ꍇɂ̂ݑҋ@܂.
+		*  @param[in] const std::uint64_t ҋ@l
+		*  @return    void
+		*************************************************************************/
+		void Wait(const std::uint64_t value) override;
+
+		/*!**********************************************************************
+		*  @brief     ݂̃tFX̒lԂ܂.
+		*  @param[in] void
+		*  @return    std::uint64_t ݂̒l
+		*************************************************************************/
+		std::uint64_t GetCompletedValue() override { return _value.load(std::memory_order_acquire); }
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief fobO\ݒ肵܂*/
+		void SetName(const gu::tstring& name) override { _name = name; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIFence() = default;
+
+		/*! @brief fXgN^*/
+		~RHIFence() = default;
+
+		/*! @brief _foCXƏlgč쐬܂*/
+		explicit RHIFence(const gu::SharedPointer<rhi::core::RHIDevice>& device, const std::uint64_t initialValue = 0, const gu::tstring& name = SP("Fence"))
+			: rhi::core::RHIFence(device), _value(initialValue), _name(name) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief tFX̒l*/
+		std::atomic<std::uint64_t> _value = 0;
+
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("Fence");
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullFrameBuffer.hpp
+///  @brief  NullobNGh̃t[obt@ł.
+///  @author toide
+///  @date   2026/10/20 11:10:45
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_FRAME_BUFFER_HPP
+#define NULL_FRAME_BUFFER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFrameBuffer.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIFrameBuffer
+	****************************************************************************/
+	/* @brief  _[^[QbgƃfvXXeṼeNX`ResourceViewgpNXł. @n
+	*          r[DirectX12ƓfoCX̊̃q[vmۂ܂.
+	*****************************************************************************/
+	class RHIFrameBuffer : public rhi::core::RHIFrameBuffer
+	{
+	public:
+		#pragma region Public Property
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIFrameBuffer() = default;
+
+		/*! @brief fXgN^*/
+		~RHIFrameBuffer() = default;
+
+		/*! @brief ꖇ̃_[^[QbgƃfvXXeVg*/
+		explicit RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil);
+
+		/*! @brief ̃_[^[QbgƃfvXXeVg*/
+		explicit RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+
+	private:
+		#pragma region Private Function
+		/*! @brief er[쐬܂*/
+		void Prepare();
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,61 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullInstance.hpp
+///  @brief  GPUgȂNullobNGhI邽߂̃CX^Xł.
+///  @author toide
+///  @date   2026/10/20 11:27:36
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_INSTANCE_HPP
+#define NULL_INSTANCE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIInstance.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIInstance
+	****************************************************************************/
+	/* @brief  GPUł_[CPȔs邽߂̃CX^Xł. @n
+	*          foCX͏1 (Null Adapter) ݂̂ƂĈ܂.
+	*****************************************************************************/
+	class RHIInstance : public core::RHIInstance, public gu::EnableSharedFromThis<RHIInstance>
+	{
+	public:
+		#pragma region Public Function
+		/*! @brief Null AdapterԂ܂*/
+		virtual gu::SharedPointer<core::RHIDisplayAdapter> SearchHighPerformanceAdapter() override;
+
+		/*! @brief Null AdapterԂ܂*/
+		virtual gu::SharedPointer<core::RHIDisplayAdapter> SearchMinimumPowerAdapter() override;
+
+		/*! @brief Null Adapter܂ޔzԂ܂*/
+		virtual gu::DynamicArray<gu::SharedPointer<core::RHIDisplayAdapter>> EnumrateAdapters() const override;
+
+		/*! @brief o͗ɑSĂ̕foCXL܂*/
+		void LogAdapters() const override;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIInstance() = default;
+
+		/*! @brief DebuggergRXgN^. NullobNGhł͐ݒl̕ێs܂*/
+		RHIInstance(const core::RHIDebugCreateInfo& debugCreateInfo) : core::RHIInstance(debugCreateInfo) {};
+
+		/*! @brief fXgN^*/
+		~RHIInstance() = default;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullQuery.hpp
+///  @brief  NullobNGh̃NGq[vł.
+///  @author toide
+///  @date   2026/10/20 11:18:52
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_QUERY_HPP
+#define NULL_QUERY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIQuery.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			   RHIQuery
+	****************************************************************************/
+	/* @brief     NGID̔sƉs܂. vʂ͏܂܂.
+	*****************************************************************************/
+	class RHIQuery : public core::RHIQuery
+	{
+	public:
+		#pragma region Public Function
+		/*! @brief Queryp̊mۂĂȂ̈IndexԂ܂.*/
+		core::QueryResultLocation Allocate() override;
+
+		/*! @brief Queryp̎w肳ꂽIndex܂.*/
+		void Free(core::QueryResultLocation& location) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+
+		/*! @brief gp̃NG̐Ԃ܂*/
+		__forceinline gu::uint32 GetUsedCount() const noexcept { return _issuedCount - static_cast<gu::uint32>(_freeIDs.Size()); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIQuery() = default;
+
+		/*! @brief fXgN^*/
+		~RHIQuery() = default;
+
+		/*! @brief _foCXƃNG̎ނgč쐬܂*/
+		explicit RHIQuery(const gu::SharedPointer<core::RHIDevice>& device, const core::QueryHeapType heapType);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief 擪甭sID̐*/
+		gu::uint32 _issuedCount = 0;
+
+		/*! @brief ꂽID*/
+		gu::DynamicArray<gu::uint32> _freeIDs = {};
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullRenderPass.hpp
+///  @brief  NullobNGh̃_[pXł.
+///  @author toide
+///  @date   2026/10/20 11:03:28
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_RENDER_PASS_HPP
+#define NULL_RENDER_PASS_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIRenderPass.hpp"
+#include "NullDevice.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIRenderPass
+	****************************************************************************/
+	/* @brief     _[^[QbgƃfvXXeV̏݊Jn, I̐ݒ荀ڂł. R}hXg[ɂ͌ŗLIDŋL^܂.
+	*****************************************************************************/
+	class RHIRenderPass : public rhi::core::RHIRenderPass
+	{
+	public:
+		#pragma region Public Property
+		/*! @brief fobO\ݒ肵܂*/
+		virtual void SetName(const gu::tstring& name) override { _name = name; };
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIRenderPass() = default;
+
+		/*! @brief fXgN^*/
+		~RHIRenderPass() = default;
+
+		/*! @brief e_[^[QbgƃfvXXeV̏*/
+		explicit RHIRenderPass(const gu::SharedPointer<core::RHIDevice>& device, const gu::DynamicArray<core::Attachment>& colors, const gu::Optional<core::Attachment>& depth = {}) :
+			core::RHIRenderPass(device, colors, depth), _objectID(static_cast<null::RHIDevice*>(device.Get())->IssueObjectID()) {}
+
+		/*! @brief ̃_[^[QbgƃfvXXeVg*/
+		explicit RHIRenderPass(const gu::SharedPointer<core::RHIDevice>& device, const core::Attachment& color, const gu::Optional<core::Attachment>& depth = {}) :
+			core::RHIRenderPass(device, color, depth), _objectID(static_cast<null::RHIDevice*>(device.Get())->IssueObjectID()) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+	};
+}
+#endif
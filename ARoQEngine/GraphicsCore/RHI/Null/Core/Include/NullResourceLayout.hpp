@@ -0,0 +1,73 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullResourceLayout.hpp
+///  @brief  NullobNGh̃\[XCAEgł.
+///  @author toide
+///  @date   2026/10/20 11:03:28
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_RESOURCE_LAYOUT_HPP
+#define NULL_RESOURCE_LAYOUT_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIResourceLayout.hpp"
+#include "NullDevice.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHIResourceLayout
+	****************************************************************************/
+	/* @brief     VF[_ɓn\[X̕тێ邾̃\[XCAEgł. [gVOl`ɑ͍̂쐬܂.
+	*****************************************************************************/
+	class RHIResourceLayout : public rhi::core::RHIResourceLayout
+	{
+	public:
+		#pragma region Public Property
+		/*! @brief fobO\ݒ肵܂*/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief fobO\Ԃ܂*/
+		__forceinline const gu::tstring& GetName() const noexcept { return _name; }
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHIResourceLayout() = default;
+
+		/*! @brief fXgN^*/
+		~RHIResourceLayout() = default;
+
+		/*! @brief evfgč쐬܂*/
+		explicit RHIResourceLayout(
+			const gu::SharedPointer<core::RHIDevice>& device,
+			const gu::DynamicArray<core::ResourceLayoutElement>& elements = {},
+			const gu::DynamicArray<core::SamplerLayoutElement>& samplers = {},
+			const gu::Optional<core::Constant32Bits>& constant32Bits = {},
+			const gu::tstring& name = SP("ResourceLayout")
+		) : core::RHIResourceLayout(device, elements, samplers, constant32Bits), _name(name),
+			_objectID(static_cast<null::RHIDevice*>(device.Get())->IssueObjectID()) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullSwapchain.hpp
+///  @brief  EBhEȂNullobNGh̃Xbv`FCł.
+///  @author toide
+///  @date   2026/10/20 10:52:03
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_SWAPCHAIN_HPP
+#define NULL_SWAPCHAIN_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHISwapchain.hpp"
+#include "NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			RHISwapchain
+	****************************************************************************/
+	/* @brief     CPŨobNobt@Ԃɐ؂ւ邾̃Xbv`FCł. @n
+	*             ʂւ̕\͍sȂ, tXN[HDR̐؂ւ͐ݒl̍XVs܂.
+	*****************************************************************************/
+	class RHISwapchain : public rhi::core::RHISwapchain
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ̃obNobt@ɐ؂ւ, tFXsignalValueݒ肵܂.
+		*  @param[in] const gu::SharedPointer<core::RHIFence>& `\ɂȂƂʒmtFX
+		*  @param[in] const gu::uint64 ݒ肷l
+		*  @return    gu::uint32 ̃obNobt@̃CfbNX
+		*************************************************************************/
+		virtual gu::uint32 PrepareNextImage(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 signalValue) override;
+
+		/*!**********************************************************************
+		*  @brief     tFXwaitValueɒB̂҂Ă\񐔂𐔂܂.
+		*  @param[in] const gu::SharedPointer<core::RHIFence>& `抮ʒmtFX
+		*  @param[in] gu::uint64 ҋ@l
+		*  @return    void
+		*************************************************************************/
+		virtual void Present(const gu::SharedPointer<core::RHIFence>& fence, gu::uint64 waitValue) override;
+
+		/*!**********************************************************************
+		*  @brief     obNobt@w肵傫ō蒼܂.
+		*  @param[in] const gu::uint32 
+		*  @param[in] const gu::uint32 
+		*  @return    void
+		*************************************************************************/
+		virtual void Resize(const gu::uint32 width, const gu::uint32 height) override;
+
+		/*! @brief tXN[ݒL^܂*/
+		virtual void SwitchFullScreenMode(const bool isOn) override { _desc.IsFullScreen = isOn; }
+
+		/*! @brief HDRݒL^܂*/
+		virtual void SwitchHDRMode(const bool enableHDR) override { _desc.IsValidHDR = enableHDR; }
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ݕ`R}hlߍ݂obNobt@̃CfbNXԂ܂*/
+		virtual gu::uint8 GetCurrentBufferIndex() const override { return _currentBackBufferIndex; }
+
+		/*! @brief PresentĂ񂾉񐔂Ԃ܂*/
+		__forceinline gu::uint64 GetPresentCount() const noexcept { return _presentCount; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RHISwapchain() = default;
+
+		/*! @brief fXgN^*/
+		~RHISwapchain() = default;
+
+		/*! @brief */
+		explicit RHISwapchain(
+			const gu::SharedPointer<rhi::core::RHIDevice>& device,
+			const gu::SharedPointer<rhi::core::RHICommandQueue>& queue,
+			const rhi::core::WindowInfo& windowInfo,
+			const rhi::core::PixelFormat& pixelFormat,
+			const gu::uint8 frameBufferCount = 3, const gu::uint8 vsync = 0,
+			const bool isValidHDR = true,
+			const bool isFullScreen = false);
+
+		/*! @brief Descriptorł܂Ƃ߂ď*/
+		explicit RHISwapchain(const gu::SharedPointer<rhi::core::RHIDevice>& device, const core::SwapchainDesc& desc);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief ݂̐ݒŃobNobt@쐬܂*/
+		void SetUp();
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ݂̃obNobt@̃CfbNX*/
+		gu::uint8 _currentBackBufferIndex = 0;
+
+		/*! @brief PresentĂ񂾉*/
+		gu::uint64 _presentCount = 0;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullAdapter.cpp
+///  @brief  NullobNGh̕foCXł.
+///  @author toide
+///  @date   2026/10/20 11:27:36
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullAdapter.hpp"
+#include "../Include/NullDevice.hpp"
+#include <cstdio>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIDisplayAdapter::RHIDisplayAdapter(const gu::SharedPointer<core::RHIInstance>& instance) : core::RHIDisplayAdapter(instance)
+{
+	_name          = "Null Adapter";
+	_isDiscreteGPU = false;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     NullobNGh̘_foCX쐬܂
+*  @return    gu::SharedPointer<core::RHIDevice> _foCX
+*************************************************************************/
+gu::SharedPointer<core::RHIDevice> RHIDisplayAdapter::CreateDevice()
+{
+	return gu::MakeShared<RHIDevice>(SharedFromThis());
+}
+
+/*!**********************************************************************
+*  @brief     foCX̖Oo͂܂
+*  @return    void
+*************************************************************************/
+void RHIDisplayAdapter::PrintInfo() const
+{
+	printf("\n//////////////////////////\n Adapter : %s\n//////////////////////////\n", _name.CString());
+}
+#pragma endregion Public Function
@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCommandAllocator.cpp
+///  @brief  NullobNGh̃R}hXg[i[CPUł.
+///  @author toide
+///  @date   2026/10/20 9:20:11
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullCommandAllocator.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+namespace
+{
+	/*! @brief R}hXg[̏e*/
+	constexpr gu::uint64 INITIAL_STREAM_CAPACITY = 16 * 1024;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHICommandAllocator::RHICommandAllocator(const gu::SharedPointer<rhi::core::RHIDevice>& device, const core::CommandListType type, const gu::tstring& name)
+	: rhi::core::RHICommandAllocator(device, type), _name(name)
+{
+	_commandStream.Reserve(INITIAL_STREAM_CAPACITY);
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief  R}hXg[܂. mۍς݂͉̃܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RHICommandAllocator::CleanUp()
+{
+	_commandStream.Clear();
+}
+
+/*!**********************************************************************
+*  @brief     R}hXg[̖byteSizë̗mۂ, ̐擪Ԃ܂.
+*  @note      DynamicArray::Reserve͎w肵eʂ傤ǂɍĊmۂ邽, 2{L΂܂.
+*  @param[in] const gu::uint64 mۂoCg
+*  @return    gu::uint8* mۂ̈̐擪
+*************************************************************************/
+gu::uint8* RHICommandAllocator::Allocate(const gu::uint64 byteSize)
+{
+	const auto offset  = _commandStream.Size();
+	const auto newSize = offset + byteSize;
+
+	if (newSize > _commandStream.Capacity())
+	{
+		const auto doubled = _commandStream.Capacity() * 2;
+		_commandStream.Reserve(newSize > doubled ? newSize : doubled);
+	}
+
+	// ɑSďނߏ͍s܂
+	_commandStream.Resize(newSize, false);
+	return _commandStream.Data() + offset;
+}
+#pragma endregion Main Function
@@ -0,0 +1,660 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCommandList.cpp
+///  @brief  GPUg킸ɕ`R}hR}hXg[֋L^R}hXgł.
+///  @author toide
+///  @date   2026/10/20 10:05:31
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullCommandList.hpp"
+#include "../Include/NullCommandAllocator.hpp"
+#include "../Include/NullDevice.hpp"
+#include "../Include/NullRenderPass.hpp"
+#include "../Include/NullFrameBuffer.hpp"
+#include "../Include/NullResourceLayout.hpp"
+#include "../Include/NullDescriptorHeap.hpp"
+#include "../Include/NullQuery.hpp"
+#include "GraphicsCore/RHI/Null/PipelineState/Include/NullGPUPipelineState.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUBuffer.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUInputAssemblyState.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <cstdio>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHICommandList::RHICommandList(const gu::SharedPointer<rhi::core::RHIDevice>& device, const gu::SharedPointer<rhi::core::RHICommandAllocator>& commandAllocator, const gu::tstring& name) :
+	rhi::core::RHICommandList(device, commandAllocator), _name(name)
+{
+	_commandListType = _commandAllocator->GetCommandListType();
+	_commandListID   = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+	_isOpen          = false;
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Draw Frame
+/*!**********************************************************************
+*  @brief     R}hXgL^ԂɕύX܂. Draw֐̍ŏɎgp܂ @n
+*  @param[in] `t[ɌĂ΂ꍇɃR}hAP[^̒gReset邩肷booll.
+*  @return    void
+*************************************************************************/
+void RHICommandList::BeginRecording(const bool stillMidFrame)
+{
+	/*-------------------------------------------------------------------
+	-        R}hXgL^\Ԃꍇ, Reset邱ƂoȂ.
+	---------------------------------------------------------------------*/
+	if (IsOpen()) { return; }
+
+	/*-------------------------------------------------------------------
+	-        `t[̓rłȂCommandAllocator̃obt@擪ɖ߂.
+	---------------------------------------------------------------------*/
+	if (_commandAllocator && !stillMidFrame)
+	{
+		_commandAllocator->CleanUp();
+	}
+
+	_statistics.Reset();
+	_pendingBarriers.Clear();
+
+	_isOpen          = true;
+	_beginRenderPass = false;
+}
+
+/*!**********************************************************************
+*  @brief     R}hXgL^Ԃs\ԂɕύX܂. Draw֐̍ŌɎgp܂
+*  @return    void
+*************************************************************************/
+void RHICommandList::EndRecording()
+{
+	if (IsClosed()) { printf("Already closed.\n"); return; }
+
+	/*-------------------------------------------------------------------
+	-          Layout Transition (RenderTarget -> Present)
+	---------------------------------------------------------------------*/
+	if (_frameBuffer)
+	{
+		for (gu::uint64 i = 0; i < _frameBuffer->GetRenderTargetSize(); ++i)
+		{
+			PushTransitionBarrier(_frameBuffer->GetRenderTargets()[i], core::ResourceState::Present);
+		}
+	}
+	FlushResourceBarriers();
+
+	_isOpen          = false;
+	_beginRenderPass = false;
+}
+
+/*!**********************************************************************
+*  @brief     R}hXgL^Ԃɖ߂܂. ނ̃R}hAP[^ł΍ւs܂.
+*  @param[in] const gu::SharedPointer<core::RHICommandAllocator>& ւR}hAP[^
+*  @return    void
+*************************************************************************/
+void RHICommandList::Reset(const gu::SharedPointer<rhi::core::RHICommandAllocator>& commandAllocator)
+{
+	if (IsOpen()) { return; }
+
+	if (!commandAllocator) { return; }
+
+	if (commandAllocator->GetCommandListType() != GetType())
+	{
+		printf("Different commandList type\n");
+		return;
+	}
+
+	_commandAllocator = commandAllocator;
+	_statistics.Reset();
+	_pendingBarriers.Clear();
+
+	_isOpen          = true;
+	_beginRenderPass = false;
+}
+
+/*!**********************************************************************
+*  @brief     VRenderPassJn܂.
+*  @param[in] const gu::SharedPointer<core::RHIRenderPass>& JnRenderPass
+*  @param[in] const gu::SharedPointer<core::RHIFrameBuffer>& `ΏۂFrameBuffer
+*  @return    void
+*************************************************************************/
+void RHICommandList::BeginRenderPass(const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIFrameBuffer>& frameBuffer)
+{
+	if (_renderPass == renderPass && _frameBuffer == frameBuffer) { return; }
+
+	// _[pXႤꍇ, _[pXI
+	if (_renderPass) { EndRenderPass(); }
+
+	if (_beginRenderPass) { return; }
+
+	/*-------------------------------------------------------------------
+	-          Layout Transition (Present -> RenderTarget)
+	---------------------------------------------------------------------*/
+	for (gu::uint64 i = 0; i < frameBuffer->GetRenderTargetSize(); ++i)
+	{
+		PushTransitionBarrier(frameBuffer->GetRenderTargets()[i], core::ResourceState::RenderTarget);
+	}
+	FlushResourceBarriers();
+
+	RecordCommand(CommandType::BeginRenderPass, RenderPassCommand
+	{
+		static_cast<null::RHIRenderPass*>(renderPass.Get())->GetObjectID(),
+		static_cast<null::RHIFrameBuffer*>(frameBuffer.Get())->GetObjectID()
+	});
+
+	_renderPass      = renderPass;
+	_frameBuffer     = frameBuffer;
+	_beginRenderPass = true;
+}
+
+/*!**********************************************************************
+*  @brief     RenderPassI܂.
+*  @return    void
+*************************************************************************/
+void RHICommandList::EndRenderPass()
+{
+	if (!_beginRenderPass) { return; }
+
+	AllocateCommand(CommandType::EndRenderPass, 0);
+	_beginRenderPass = false;
+}
+#pragma endregion Main Draw Frame
+
+#pragma region GPU Command
+/*!**********************************************************************
+*  @brief     [xlw͈͂ɓĂ邩eXg, ͈͊OȂ΃sNZj܂.
+*  @param[in] const float ŏ̐[xl
+*  @param[in] const float ő̐[xl
+*  @return    void
+*************************************************************************/
+void RHICommandList::SetDepthBounds(const float minDepth, const float maxDepth)
+{
+	Checkf(0.0f <= minDepth && minDepth <= 1.0f, "minDepth must be between 0 and 1");
+	Checkf(0.0f <= maxDepth && maxDepth <= 1.0f, "maxDepth must be between 0 and 1");
+	Checkf(minDepth <= maxDepth, "minDepth must be less than maxDepth");
+
+	RecordCommand(CommandType::SetDepthBounds, DepthBoundsCommand{ minDepth, maxDepth });
+}
+
+/*!**********************************************************************
+*  @brief     sNZVF[_̎spxݒ肵܂
+*  @param[in] const core::ShadingRate spx
+*  @param[in] const gu::DynamicArray<core::ShadingRateCombiner>& @
+*  @return    void
+*************************************************************************/
+void RHICommandList::SetShadingRate(const core::ShadingRate shadingRate, const gu::DynamicArray<core::ShadingRateCombiner>& combiners)
+{
+	RecordArrayCommand(CommandType::SetShadingRate, static_cast<gu::uint32>(shadingRate), combiners.Data(), static_cast<gu::uint32>(combiners.Size()));
+}
+
+/*!**********************************************************************
+*  @brief     sNZVF[_̎spxeNX`Őݒ肵܂
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& spxi[eNX`
+*  @return    void
+*************************************************************************/
+void RHICommandList::SetShadingRateImage(const gu::SharedPointer<core::GPUTexture>& texture)
+{
+	RecordCommand(CommandType::SetShadingRateImage, ObjectCommand{ GetObjectID(texture.Get()) });
+}
+
+/*!**********************************************************************
+*  @brief     fBXNv^q[vݒ肵܂
+*  @param[in] const gu::SharedPointer<core::RHIDescriptorHeap>& fBXNv^q[v
+*  @return    void
+*************************************************************************/
+void RHICommandList::SetDescriptorHeap(const gu::SharedPointer<core::RHIDescriptorHeap>& heap)
+{
+	Checkf(heap, "heap is nullptr");
+
+	RecordCommand(CommandType::SetDescriptorHeap, ObjectCommand{ static_cast<null::RHIDescriptorHeap*>(heap.Get())->GetObjectID() });
+}
+
+/*!**********************************************************************
+*  @brief     GPǓvJn܂
+*  @param[in] const core::QueryResultLocation& vʂ̊i[
+*  @return    void
+*************************************************************************/
+void RHICommandList::BeginQuery(const core::QueryResultLocation& location)
+{
+	Checkf(location.Heap, "query heap is nullptr");
+
+	RecordCommand(CommandType::BeginQuery, QueryCommand{ static_cast<null::RHIQuery*>(location.Heap.Get())->GetObjectID(), location.QueryID });
+}
+
+/*!**********************************************************************
+*  @brief     GPǓvI܂
+*  @param[in] const core::QueryResultLocation& vʂ̊i[
+*  @return    void
+*************************************************************************/
+void RHICommandList::EndQuery(const core::QueryResultLocation& location)
+{
+	Checkf(location.Heap, "query heap is nullptr");
+
+	RecordCommand(CommandType::EndQuery, QueryCommand{ static_cast<null::RHIQuery*>(location.Heap.Get())->GetObjectID(), location.QueryID });
+}
+
+/*---------------------------------------------------------------
+					Graphics Command
+-----------------------------------------------------------------*/
+void RHICommandList::SetPrimitiveTopology(const core::PrimitiveTopology topology)
+{
+	RecordCommand(CommandType::SetPrimitiveTopology, ValueCommand{ static_cast<gu::uint32>(topology) });
+}
+
+void RHICommandList::SetViewport(const core::Viewport& viewport)
+{
+	SetViewport(&viewport, 1);
+}
+
+void RHICommandList::SetViewport(const core::Viewport* viewport, const gu::uint32 numViewport)
+{
+	Checkf(viewport, "viewport is nullptr");
+
+	RecordArrayCommand(CommandType::SetViewport, 0, viewport, numViewport);
+}
+
+void RHICommandList::SetStereoViewport(const core::Viewport& leftView, const core::Viewport& rightView)
+{
+	const core::Viewport viewports[2] = { leftView, rightView };
+
+	const core::ScissorRect scissorRects[2] =
+	{
+		core::ScissorRect((long)leftView .TopLeftX, (long)leftView .TopLeftY, (long)(leftView .TopLeftX + leftView .Width), (long)(leftView .TopLeftY + leftView .Height)),
+		core::ScissorRect((long)rightView.TopLeftX, (long)rightView.TopLeftY, (long)(rightView.TopLeftX + rightView.Width), (long)(rightView.TopLeftY + rightView.Height))
+	};
+
+	SetViewport(viewports, 2);
+	SetScissor (scissorRects, 2);
+}
+
+void RHICommandList::SetScissor(const core::ScissorRect* rect, const gu::uint32 numRect)
+{
+	Checkf(rect, "rect is nullptr");
+
+	RecordArrayCommand(CommandType::SetScissor, 0, rect, numRect);
+}
+
+void RHICommandList::SetViewportAndScissor(const core::Viewport& viewport, const core::ScissorRect& rect)
+{
+	SetViewport(&viewport, 1);
+	SetScissor (&rect, 1);
+}
+
+void RHICommandList::SetResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	Checkf(resourceLayout, "resource layout is nullptr");
+
+	RecordCommand(CommandType::SetResourceLayout, ObjectCommand{ static_cast<null::RHIResourceLayout*>(resourceLayout.Get())->GetObjectID() });
+}
+
+void RHICommandList::SetGraphicsPipeline(const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipeline)
+{
+	Checkf(pipeline, "pipeline is nullptr");
+
+	if (pipeline->GetInputAssemblyState())
+	{
+		SetPrimitiveTopology(pipeline->GetInputAssemblyState()->GetPrimitiveTopology());
+	}
+
+	RecordCommand(CommandType::SetGraphicsPipeline, ObjectCommand{ static_cast<null::GPUGraphicsPipelineState*>(pipeline.Get())->GetObjectID() });
+}
+
+void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer)
+{
+	const ObjectID id = GetObjectID(buffer.Get());
+	RecordArrayCommand(CommandType::SetVertexBuffers, 0, &id, 1);
+}
+
+void RHICommandList::SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot)
+{
+	gu::DynamicArray<ObjectID> ids(buffers.Size());
+	for (gu::uint64 i = 0; i < buffers.Size(); ++i)
+	{
+		Check(buffers[i]->GetUsage() == core::BufferCreateFlags::VertexBuffer);
+		ids[i] = GetObjectID(buffers[i].Get());
+	}
+
+	RecordArrayCommand(CommandType::SetVertexBuffers, static_cast<gu::uint32>(startSlot), ids.Data(), static_cast<gu::uint32>(ids.Size()));
+}
+
+void RHICommandList::SetIndexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::PixelFormat indexType)
+{
+	Checkf(buffer, "buffer is nullptr");
+
+	RecordCommand(CommandType::SetIndexBuffer, IndexBufferCommand{ GetObjectID(buffer.Get()), static_cast<gu::uint32>(indexType) });
+}
+
+void RHICommandList::DrawIndexed(const gu::uint32 indexCount, const gu::uint32 startIndexLocation, const gu::uint32 baseVertexLocation)
+{
+	RecordCommand(CommandType::DrawIndexed, DrawIndexedCommand{ indexCount, startIndexLocation, baseVertexLocation });
+}
+
+void RHICommandList::DrawIndexedInstanced(const gu::uint32 indexCountPerInstance, const gu::uint32 instanceCount, const gu::uint32 startIndexLocation, const gu::uint32 baseVertexLocation, const gu::uint32 startInstanceLocation)
+{
+	RecordCommand(CommandType::DrawIndexedInstanced, DrawIndexedInstancedCommand{ indexCountPerInstance, instanceCount, startIndexLocation, baseVertexLocation, startInstanceLocation });
+}
+
+void RHICommandList::DrawIndexedIndirect(const gu::SharedPointer<core::GPUBuffer>& argumentBuffer, const gu::uint32 drawCallCount)
+{
+	Checkf(argumentBuffer, "argument buffer is nullptr");
+
+	RecordCommand(CommandType::DrawIndexedIndirect, DrawIndexedIndirectCommand{ GetObjectID(argumentBuffer.Get()), drawCallCount });
+}
+
+void RHICommandList::DispatchMesh(const gu::uint32 threadGroupCountX, const gu::uint32 threadGroupCountY, const gu::uint32 threadGroupCountZ)
+{
+	Checkf(threadGroupCountX <= 65536, "ThreadGroupCountX must be less than 65536");
+	Checkf(threadGroupCountY <= 65536, "ThreadGroupCountY must be less than 65536");
+	Checkf(threadGroupCountZ <= 65536, "ThreadGroupCountZ must be less than 65536");
+
+	RecordCommand(CommandType::DispatchMesh, DispatchCommand{ threadGroupCountX, threadGroupCountY, threadGroupCountZ });
+}
+
+/*---------------------------------------------------------------
+					Compute Command
+-----------------------------------------------------------------*/
+void RHICommandList::SetComputeResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	Checkf(resourceLayout, "resource layout is nullptr");
+
+	RecordCommand(CommandType::SetComputeResourceLayout, ObjectCommand{ static_cast<null::RHIResourceLayout*>(resourceLayout.Get())->GetObjectID() });
+}
+
+void RHICommandList::SetComputePipeline(const gu::SharedPointer<core::GPUComputePipelineState>& pipeline)
+{
+	Checkf(pipeline, "pipeline is nullptr");
+
+	RecordCommand(CommandType::SetComputePipeline, ObjectCommand{ static_cast<null::GPUComputePipelineState*>(pipeline.Get())->GetObjectID() });
+}
+
+void RHICommandList::Dispatch(gu::uint32 threadGroupCountX, gu::uint32 threadGroupCountY, gu::uint32 threadGroupCountZ)
+{
+	Checkf(threadGroupCountX <= 65536, "ThreadGroupCountX must be less than 65536");
+	Checkf(threadGroupCountY <= 65536, "ThreadGroupCountY must be less than 65536");
+	Checkf(threadGroupCountZ <= 65536, "ThreadGroupCountZ must be less than 65536");
+
+	RecordCommand(CommandType::Dispatch, DispatchCommand{ threadGroupCountX, threadGroupCountY, threadGroupCountZ });
+}
+
+/*---------------------------------------------------------------
+					Copy Command
+-----------------------------------------------------------------*/
+void RHICommandList::CopyResource(const gu::SharedPointer<core::GPUTexture>& dest, const gu::SharedPointer<core::GPUTexture>& source)
+{
+	CopyResource(gu::StaticPointerCast<core::GPUResource>(dest), gu::StaticPointerCast<core::GPUResource>(source));
+}
+
+/*!**********************************************************************
+*  @brief     傫̃\[XmRs[܂. ODirectX12ƓԑJڂL^܂.
+*  @param[in] const gu::SharedPointer<core::GPUResource>& Rs[
+*  @param[in] const gu::SharedPointer<core::GPUResource>& Rs[
+*  @return    void
+*************************************************************************/
+void RHICommandList::CopyResource(const gu::SharedPointer<core::GPUResource>& dest, const gu::SharedPointer<core::GPUResource>& source)
+{
+	Checkf(dest && source, "resource is nullptr");
+	Checkf(dest != source, "CopyResource cannot be used on the same resource.");
+
+	const auto destinationState = dest  ->GetResourceState();
+	const auto sourceState      = source->GetResourceState();
+
+	PushTransitionBarrier(dest  , core::ResourceState::CopyDestination);
+	PushTransitionBarrier(source, core::ResourceState::CopySource);
+	FlushResourceBarriers();
+
+	RecordCommand(CommandType::CopyResource, CopyResourceCommand{ GetObjectID(dest.Get()), GetObjectID(source.Get()) });
+
+	PushTransitionBarrier(dest  , destinationState);
+	PushTransitionBarrier(source, sourceState);
+	FlushResourceBarriers();
+}
+
+/*!**********************************************************************
+*  @brief     obt@̈ꕔRs[܂. CPUŎۂɃRs[s܂.
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& Rs[
+*  @param[in] const gu::uint64 Rs[̊Jnʒu
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& Rs[
+*  @param[in] const gu::uint64 Rs[̊Jnʒu
+*  @param[in] const gu::uint64 Rs[oCg
+*  @return    void
+*************************************************************************/
+void RHICommandList::CopyBufferRegion(const gu::SharedPointer<core::GPUBuffer>& destination, const gu::uint64 destinationOffset, const gu::SharedPointer<core::GPUBuffer>& source, const gu::uint64 sourceOffset, const gu::uint64 copyByteSize)
+{
+	const auto nullDestination = static_cast<null::GPUBuffer*>(destination.Get());
+	const auto nullSource      = static_cast<null::GPUBuffer*>(source.Get());
+
+	/*-------------------------------------------------------------------
+	-       Rs[\̃`FbN
+	---------------------------------------------------------------------*/
+	Checkf(nullDestination != nullSource, "CopyBufferRegion cannot be used on the same resource.");
+	Confirmf(destinationOffset + copyByteSize <= nullDestination->GetTotalByteSize(), "copy range exceeds the destination buffer");
+	Confirmf(sourceOffset      + copyByteSize <= nullSource     ->GetTotalByteSize(), "copy range exceeds the source buffer");
+
+	const auto destinationState = destination->GetResourceState();
+	const auto sourceState      = source     ->GetResourceState();
+
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), core::ResourceState::CopyDestination);
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source)     , core::ResourceState::CopySource);
+	FlushResourceBarriers();
+
+	RecordCommand(CommandType::CopyBufferRegion, CopyBufferRegionCommand{ nullDestination->GetObjectID(), nullSource->GetObjectID(), destinationOffset, sourceOffset, copyByteSize });
+
+	// CPŨobt@mȂ̂, ŎۂɃRs[Ă܂
+	if (copyByteSize > 0)
+	{
+		gu::Memory::Copy(nullDestination->GetCPUMemory() + destinationOffset, nullSource->GetCPUMemory() + sourceOffset, copyByteSize);
+	}
+
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), destinationState);
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source)     , sourceState);
+	FlushResourceBarriers();
+}
+
+/*!**********************************************************************
+*  @brief     eNX`̈ꕔRs[܂. ͈͂̊mFDirectX12Ɠł.
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& Rs[
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& Rs[
+*  @param[in] const core::GPUTextureCopyInfo& Rs[͈
+*  @return    void
+*************************************************************************/
+void RHICommandList::CopyTextureRegion(const gu::SharedPointer<core::GPUTexture>& destination, const gu::SharedPointer<core::GPUTexture>& source, const core::GPUTextureCopyInfo& copyInfo)
+{
+	Checkf(destination != source, "CopyTextureRegion cannot be used on the same resource.");
+	Checkf(copyInfo.ArraySliceCount + copyInfo.DestinationInitArraySlice <= destination->GetArrayLength(), "This function exceeds the array slice count in the destination texture\n");
+	Checkf(copyInfo.ArraySliceCount + copyInfo.SourceInitArraySlice      <= source     ->GetArrayLength(), "This function exceeds the array slice count in the source texture\n");
+
+	const auto destinationState = destination->GetResourceState();
+	const auto sourceState      = source     ->GetResourceState();
+
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), core::ResourceState::CopyDestination);
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source)     , core::ResourceState::CopySource);
+	FlushResourceBarriers();
+
+	RecordCommand(CommandType::CopyTextureRegion, CopyTextureRegionCommand{ GetObjectID(destination.Get()), GetObjectID(source.Get()), copyInfo });
+
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(destination), destinationState);
+	PushTransitionBarrier(gu::StaticPointerCast<core::GPUResource>(source)     , sourceState);
+	FlushResourceBarriers();
+}
+
+/*!**********************************************************************
+*  @brief     CPŨobt@, eNX`ւ݂̏L^܂. GPUBuffer::UploadByteGPUTexture::WriteĂ΂܂.
+*  @param[in] const ObjectID ݐ̃\[X
+*  @param[in] const gu::uint64 ݊Jnʒu
+*  @param[in] const gu::uint64 񂾃oCg
+*  @return    void
+*************************************************************************/
+void RHICommandList::RecordUploadResource(const ObjectID resource, const gu::uint64 offsetByte, const gu::uint64 byteSize)
+{
+	RecordCommand(CommandType::UploadResource, UploadResourceCommand{ resource, offsetByte, byteSize });
+}
+
+/*!**********************************************************************
+*  @brief     \[Xr[̐ݒL^܂. GPUResourceView::BindĂ΂܂.
+*  @param[in] const ObjectID \[Xr[
+*  @param[in] const gu::uint32 WX^ԍ
+*  @return    void
+*************************************************************************/
+void RHICommandList::RecordBindResourceView(const ObjectID resourceView, const gu::uint32 index)
+{
+	RecordCommand(CommandType::BindResourceView, BindResourceViewCommand{ resourceView, index });
+}
+#pragma endregion GPU Command
+
+#pragma region Resource Barrier
+/*!**********************************************************************
+*  @brief     \[X̏ԑJڂ𗭂߂Ă܂. Oɗ߂\[X̑Jڂɖ߂̏ꍇ, 菜܂.
+*  @param[in] const gu::SharedPointer<core::GPUResource>& Ώۂ̃\[X
+*  @param[in] const core::ResourceState Jڌ̏
+*  @param[in] const gu::uint32 Tu\[X
+*  @return    void
+*************************************************************************/
+void RHICommandList::PushTransitionBarrier(const gu::SharedPointer<core::GPUResource>& resource, const core::ResourceState after, const gu::uint32 subresource)
+{
+	Checkf(resource, "resource is nullptr");
+
+	const auto before = resource->GetResourceState();
+	if (before == after) { return; }
+
+	/*-------------------------------------------------------------------
+	-        ÕoAłꍇ͗Ƃ菜
+	---------------------------------------------------------------------*/
+	if (!_pendingBarriers.IsEmpty())
+	{
+		const auto& last = _pendingBarriers.Back();
+		if (last.Command.Type == BarrierType::Transition && last.Resource == resource &&
+			last.Command.Subresource == subresource && last.Command.Before == after)
+		{
+			resource->SetResourceState(after);
+			_pendingBarriers.Pop();
+			return;
+		}
+	}
+
+	BarrierCommand command = {};
+	command.Type        = BarrierType::Transition;
+	command.Before      = before;
+	command.After       = after;
+	command.Resource    = GetObjectID(resource.Get());
+	command.Subresource = subresource;
+
+	_pendingBarriers.Push(PendingBarrier{ command, resource });
+
+	// ̃oȂJڌ𐳂߂邽, ߂_ŏԂXVĂ܂
+	resource->SetResourceState(after);
+}
+
+/*!**********************************************************************
+*  @brief     L郊\[X̐؂ւ𗭂߂Ă܂
+*  @param[in] const gu::SharedPointer<core::GPUResource>& ؂ւÕ\[X
+*  @param[in] const gu::SharedPointer<core::GPUResource>& ؂ւ̃\[X
+*  @return    void
+*************************************************************************/
+void RHICommandList::PushAliasingBarrier(const gu::SharedPointer<core::GPUResource>& before, const gu::SharedPointer<core::GPUResource>& after)
+{
+	BarrierCommand command = {};
+	command.Type        = BarrierType::Aliasing;
+	command.Resource    = GetObjectID(before.Get());
+	command.AfterObject = GetObjectID(after.Get());
+
+	_pendingBarriers.Push(PendingBarrier{ command, after });
+}
+
+/*!**********************************************************************
+*  @brief     UnorderedAccess̏݊҂𗭂߂Ă܂
+*  @param[in] const gu::SharedPointer<core::GPUResource>& Ώۂ̃\[X
+*  @return    void
+*************************************************************************/
+void RHICommandList::PushUAVBarrier(const gu::SharedPointer<core::GPUResource>& resource)
+{
+	BarrierCommand command = {};
+	command.Type     = BarrierType::UnorderedAccess;
+	command.Resource = GetObjectID(resource.Get());
+
+	_pendingBarriers.Push(PendingBarrier{ command, resource });
+}
+
+/*!**********************************************************************
+*  @brief     ߂ĂoA1ResourceBarrierR}hƂċL^܂
+*  @return    void
+*************************************************************************/
+void RHICommandList::FlushResourceBarriers()
+{
+	if (_pendingBarriers.IsEmpty()) { return; }
+
+	const auto barrierCount = static_cast<gu::uint32>(_pendingBarriers.Size());
+
+	const ArrayCommand header = { barrierCount, 0 };
+	auto* payload = AllocateCommand(CommandType::ResourceBarrier, sizeof(ArrayCommand) + sizeof(BarrierCommand) * barrierCount);
+	gu::Memory::Copy(payload, &header, sizeof(ArrayCommand));
+	for (gu::uint32 i = 0; i < barrierCount; ++i)
+	{
+		gu::Memory::Copy(payload + sizeof(ArrayCommand) + sizeof(BarrierCommand) * i, &_pendingBarriers[i].Command, sizeof(BarrierCommand));
+	}
+
+	_statistics.BarrierCount += barrierCount;
+	_pendingBarriers.Clear();
+}
+#pragma endregion Resource Barrier
+
+#pragma region Property
+/*!**********************************************************************
+*  @brief     L^̃R}hXg[Ԃ܂
+*  @return    const gu::DynamicArray<gu::uint8>& R}hXg[
+*************************************************************************/
+const gu::DynamicArray<gu::uint8>& RHICommandList::GetCommandStream() const
+{
+	return static_cast<null::RHICommandAllocator*>(_commandAllocator.Get())->GetCommandStream();
+}
+
+/*!**********************************************************************
+*  @brief     obt@, eNX`̌ŗLIDԂ܂
+*  @param[in] const core::GPUResource* \[X
+*  @return    ObjectID ŗLID. nullptȑꍇINVALID_OBJECT_ID
+*************************************************************************/
+ObjectID RHICommandList::GetObjectID(const core::GPUResource* resource)
+{
+	if (resource == nullptr) { return INVALID_OBJECT_ID; }
+
+	return resource->IsBuffer() ?
+		static_cast<const null::GPUBuffer* >(static_cast<const core::GPUBuffer* >(resource))->GetObjectID() :
+		static_cast<const null::GPUTexture*>(static_cast<const core::GPUTexture*>(resource))->GetObjectID();
+}
+
+/*!**********************************************************************
+*  @brief     wb_񂾏ŃyC[ḧ̗mۂ܂. yC[h4bytePʂɐ؂グ܂.
+*  @param[in] const CommandType R}h̎
+*  @param[in] const gu::uint64 yC[h̃oCg
+*  @return    gu::uint8* yC[h̐擪
+*************************************************************************/
+gu::uint8* RHICommandList::AllocateCommand(const CommandType type, const gu::uint64 payloadByteSize)
+{
+	Checkf(_isOpen, "command list is closed");
+
+	const gu::uint64 alignedByteSize = (payloadByteSize + 3) & ~static_cast<gu::uint64>(3);
+	Confirmf(alignedByteSize <= 0xffff, "command payload is too large");
+
+	auto* memory = static_cast<null::RHICommandAllocator*>(_commandAllocator.Get())->Allocate(sizeof(CommandHeader) + alignedByteSize);
+
+	const CommandHeader header = { type, 0, static_cast<gu::uint16>(alignedByteSize) };
+	gu::Memory::Copy(memory, &header, sizeof(CommandHeader));
+
+	// ؂グ͎sƂɓoCgɂȂ悤0Ŗ߂܂
+	if (alignedByteSize != payloadByteSize)
+	{
+		gu::Memory::Zero(memory + sizeof(CommandHeader) + payloadByteSize, alignedByteSize - payloadByteSize);
+	}
+
+	_statistics.CommandCounts[static_cast<gu::uint8>(type)]++;
+	_statistics.ByteSize += sizeof(CommandHeader) + alignedByteSize;
+
+	return memory + sizeof(CommandHeader);
+}
+#pragma endregion Property
@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullCommandQueue.cpp
+///  @brief  NullobNGh̃R}hL[ł. sR}hXg̏Wvs܂.
+///  @author toide
+///  @date   2026/10/20 10:41:17
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullCommandQueue.hpp"
+#include "../Include/NullCommandList.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <chrono>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHICommandQueue::RHICommandQueue(const gu::SharedPointer<rhi::core::RHIDevice>& device, const core::CommandListType type, const gu::tstring& name)
+	: core::RHICommandQueue(device, type), _name(name)
+{
+
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     ̃R}hL[̎s҂܂. Execute_ŎsƂ݂Ȃ, 񐔂̏Wvs܂.
+*  @param[in] const gu::SharedPointer<core::RHIFence> : s߂Fence
+*  @param[in] const gu::uint64 : ҋ@Il
+*************************************************************************/
+void RHICommandQueue::Wait(const gu::SharedPointer<core::RHIFence>& fence, [[maybe_unused]] const gu::uint64 value)
+{
+	Checkf(fence, "fence is nullptr");
+	_waitCount++;
+}
+
+/*!**********************************************************************
+*  @brief     tFX̒l(value)𒼂ɍXV܂
+*  @param[in] const gu::SharedPointer<core::RHIFence>& s߂Fence
+*  @param[in] const gu::uint64 XVl
+*************************************************************************/
+void RHICommandQueue::Signal(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 value)
+{
+	Checkf(fence, "fence is nullptr");
+	fence->Signal(value);
+}
+
+/*!**********************************************************************
+*  @brief     ꂽR}hXg̏WvZ܂.
+*  @param[in] GPŨR}h𒙂߂R}hXgz
+*************************************************************************/
+void RHICommandQueue::Execute(const gu::DynamicArray<gu::SharedPointer<rhi::core::RHICommandList>>& commandLists)
+{
+	for (const auto& commandList : commandLists)
+	{
+		Confirmf(commandList->IsClosed(), "command list must be closed before execution");
+		Confirmf(commandList->GetType() == _commandListType, "command list type is different from the command queue");
+
+		_statistics.Add(static_cast<null::RHICommandList*>(commandList.Get())->GetStatistics());
+		_executedCommandListCount++;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     Wv0ɖ߂܂
+*  @return    void
+*************************************************************************/
+void RHICommandQueue::ResetStatistics()
+{
+	_statistics.Reset();
+	_executedCommandListCount = 0;
+	_waitCount                = 0;
+}
+#pragma endregion Main Function
+
+#pragma region Property
+/*!**********************************************************************
+*  @brief   ^CX^v̎gԂ܂. CPUimbPʂŎgp邽1GHzł.
+*************************************************************************/
+gu::uint64 RHICommandQueue::GetTimestampFrequency()
+{
+	return 1000000000;
+}
+
+/*!**********************************************************************
+*  @brief  CPǓvMicroSecondsPʂŎ擾܂. GPU̎ɂl܂
+*************************************************************************/
+core::GPUTimingCalibrationTimestamp RHICommandQueue::GetCalibrationTimestamp()
+{
+	const auto now = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+
+	core::GPUTimingCalibrationTimestamp timestamp = {};
+	timestamp.CPUMicroseconds = static_cast<gu::uint64>(now);
+	timestamp.GPUMicroseconds = static_cast<gu::uint64>(now);
+	return timestamp;
+}
+#pragma endregion Property
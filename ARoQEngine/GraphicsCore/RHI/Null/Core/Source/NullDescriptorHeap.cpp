@@ -0,0 +1,182 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullDescriptorHeap.cpp
+///  @brief  NullobNGh̃fBXNv^q[vł.
+///  @author toide
+///  @date   2026/10/20 9:44:06
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullDescriptorHeap.hpp"
+#include "../Include/NullDevice.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIDescriptorHeap::RHIDescriptorHeap(const gu::SharedPointer<core::RHIDevice>& device)
+	: core::RHIDescriptorHeap(device)
+{
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     w肵ނ̃fBXNv^ID𔭍s܂.
+*  @param[in] const core::DescriptorHeapType fBXNv^̎
+*  @param[in] const gu::SharedPointer<core::RHIResourceLayout>& (Vulkan̂ݎgp)
+*  @return    DescriptorID q[ṽCfbNX
+*************************************************************************/
+RHIDescriptorHeap::DescriptorID RHIDescriptorHeap::Allocate(const core::DescriptorHeapType heapType, [[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
+{
+	Confirmf(_allocators.Contains(heapType), "Not include heap type");
+
+	auto& allocator = _allocators[heapType];
+
+	/*-------------------------------------------------------------------
+	-			     Reuse free id
+	---------------------------------------------------------------------*/
+	if (!allocator.FreeIDs.IsEmpty())
+	{
+		const auto id = allocator.FreeIDs.Back();
+		allocator.FreeIDs.Pop();
+		return id;
+	}
+
+	/*-------------------------------------------------------------------
+	-			     Issue new id
+	---------------------------------------------------------------------*/
+	Confirmf(allocator.IssuedCount < allocator.MaxCount, "The number of IDs has exceeded the expected number.");
+	return allocator.IssuedCount++;
+}
+
+/*!**********************************************************************
+*  @brief     ID𖢎gpԂɖ߂܂.
+*  @param[in] const core::DescriptorHeapType fBXNv^̎
+*  @param[in] const DescriptorID q[ṽCfbNX
+*  @return    void
+*************************************************************************/
+void RHIDescriptorHeap::Free(const core::DescriptorHeapType heapType, const DescriptorID offsetIndex)
+{
+	if (!_allocators.Contains(heapType)) { return; }
+
+	auto& allocator = _allocators[heapType];
+	if (offsetIndex >= allocator.IssuedCount) { return; }
+
+	allocator.FreeIDs.Push(offsetIndex);
+}
+
+/*!**********************************************************************
+*  @brief     1ނ̃fBXNv^̍ő吔ݒ肵܂.
+*  @param[in] const core::DescriptorHeapType fBXNv^̎
+*  @param[in] const size_t ő吔
+*  @return    void
+*************************************************************************/
+void RHIDescriptorHeap::Resize(const core::DescriptorHeapType type, const size_t viewCount)
+{
+	if (_heapInfo.Contains(type) && _heapInfo.At(type) > viewCount) { return; }
+
+	gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize> heapInfo;
+	heapInfo[type] = viewCount;
+
+	Resize(heapInfo);
+}
+
+/*!**********************************************************************
+*  @brief     fBXNv^̎ނƂ̍ő吔ݒ肵܂. sς݂ID͂̂܂܈p܂.
+*  @param[in] const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& ނƂ̍ő吔
+*  @return    void
+*************************************************************************/
+void RHIDescriptorHeap::Resize(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos)
+{
+	Confirmf(CheckCorrectViewConbination(heapInfos), "wrong conbination view");
+
+	for (const auto& heapInfo : heapInfos)
+	{
+		if (_heapInfo.Contains(heapInfo.Key) && _heapInfo.At(heapInfo.Key) > heapInfo.Value) { continue; }
+
+		if (_heapInfo.Contains(heapInfo.Key)) { _totalHeapCount -= _heapInfo.At(heapInfo.Key); }
+
+		_heapInfo[heapInfo.Key]            = heapInfo.Value;
+		_allocators[heapInfo.Key].MaxCount = static_cast<gu::uint32>(heapInfo.Value);
+		_totalHeapCount += heapInfo.Value;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     sς݂IDSĖgpɖ߂܂. All̏ꍇ͍ő吔̐ݒj܂.
+*  @param[in] const ResetFlag Zbg͈̔
+*  @return    void
+*************************************************************************/
+void RHIDescriptorHeap::Reset(const ResetFlag flag)
+{
+	for (auto& allocator : _allocators)
+	{
+		allocator.Value.IssuedCount = 0;
+		allocator.Value.FreeIDs.Clear();
+	}
+
+	if (flag == ResetFlag::All)
+	{
+		_allocators.Clear();
+		_heapInfo.Clear();
+		_totalHeapCount = 0;
+	}
+}
+#pragma endregion Main Function
+
+#pragma region Property
+/*!**********************************************************************
+*  @brief     w肵ނ̎gp̃fBXNv^Ԃ܂
+*  @param[in] const core::DescriptorHeapType fBXNv^̎
+*  @return    gu::uint32 gp̐
+*************************************************************************/
+gu::uint32 RHIDescriptorHeap::GetUsedCount(const core::DescriptorHeapType heapType) const
+{
+	if (!_allocators.Contains(heapType)) { return 0; }
+
+	const auto& allocator = _allocators.At(heapType);
+	return allocator.IssuedCount - static_cast<gu::uint32>(allocator.FreeIDs.Size());
+}
+
+/*!**********************************************************************
+*  @brief     RTV, DSV, Sampler̎ނƍĂȂmF܂
+*  @param[in] const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& ނƂ̍ő吔
+*  @return    bool gݍ킹łtrue
+*************************************************************************/
+bool RHIDescriptorHeap::CheckCorrectViewConbination(const gu::SortedMap<core::DescriptorHeapType, MaxDescriptorSize>& heapInfos) const
+{
+	const auto isIsolatedType = [](const core::DescriptorHeapType type)
+	{
+		return type == core::DescriptorHeapType::RTV || type == core::DescriptorHeapType::DSV || type == core::DescriptorHeapType::SAMPLER;
+	};
+
+	bool hasIsolatedType = false;
+	auto isolatedType    = core::DescriptorHeapType::CBV;
+	for (const auto& heapInfo : heapInfos)
+	{
+		if (isIsolatedType(heapInfo.Key)) { hasIsolatedType = true; isolatedType = heapInfo.Key; }
+	}
+
+	// RTV, DSV, Sampler͊̐ݒ܂߂ĒPƂłKv܂
+	if (hasIsolatedType)
+	{
+		return heapInfos.Size() == 1 && (_heapInfo.IsEmpty() || (_heapInfo.Size() == 1 && _heapInfo.Contains(isolatedType)));
+	}
+
+	for (const auto& heapInfo : _heapInfo)
+	{
+		if (isIsolatedType(heapInfo.Key)) { return false; }
+	}
+	return true;
+}
+#pragma endregion Property
@@ -0,0 +1,50 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullFence.cpp
+///  @brief  NullobNGh̃tFXł.
+///  @author toide
+///  @date   2026/10/20 9:52:37
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullFence.hpp"
+#include <thread>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     tFX̒lݒ肵܂. ɑ傫lݒ肳Ăꍇ͉܂.
+*  @param[in] const std::uint64_t ݒ肷l
+*  @return    void
+*************************************************************************/
+void RHIFence::Signal(const std::uint64_t value)
+{
+	auto current = _value.load(std::memory_order_relaxed);
+	while (current < value && !_value.compare_exchange_weak(current, value, std::memory_order_release, std::memory_order_relaxed))
+	{
+		// current͎sɍŐV̒l֍XV܂
+	}
+}
+
+/*!**********************************************************************
+*  @brief     tFX̒lvalueȏɂȂ܂őҋ@܂.
+*  @param[in] const std::uint64_t ҋ@l
+*  @return    void
+*************************************************************************/
+void RHIFence::Wait(const std::uint64_t value)
+{
+	while (_value.load(std::memory_order_acquire) < value)
+	{
+		std::this_thread::yield();
+	}
+}
+#pragma endregion Main Function
@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullFrameBuffer.cpp
+///  @brief  NullobNGh̃t[obt@ł.
+///  @author toide
+///  @date   2026/10/20 11:10:45
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullFrameBuffer.hpp"
+#include "../Include/NullDevice.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIFrameBuffer::RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::DynamicArray<gu::SharedPointer<core::GPUTexture>>& renderTargets, const gu::SharedPointer<core::GPUTexture>& depthStencil)
+	: core::RHIFrameBuffer(device, renderPass, renderTargets, depthStencil)
+{
+	Prepare();
+}
+
+RHIFrameBuffer::RHIFrameBuffer(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::GPUTexture>& renderTarget, const gu::SharedPointer<core::GPUTexture>& depthStencil)
+	: core::RHIFrameBuffer(device, renderPass, renderTarget, depthStencil)
+{
+	Prepare();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Private Function
+/*!**********************************************************************
+*  @brief     er[쐬܂. DirectX12Ɠނ̃r[邽, fBXNv^̎gpv܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RHIFrameBuffer::Prepare()
+{
+	const auto nullDevice = static_cast<null::RHIDevice*>(_device.Get());
+
+	_objectID = nullDevice->IssueObjectID();
+
+	/*-------------------------------------------------------------------
+	-                Create Render Target View
+	---------------------------------------------------------------------*/
+	_renderTargetViews.Resize(_renderTargets.Size());
+	_renderTargetSRVs .Resize(_renderTargets.Size());
+	_renderTargetUAVs .Resize(_renderTargets.Size());
+
+	for (gu::uint32 i = 0; i < (gu::uint32)_renderTargets.Size(); ++i)
+	{
+		_renderTargetViews[i] = nullDevice->CreateResourceView(core::ResourceViewType::RenderTarget, _renderTargets[i], 0, 0, nullptr);
+		_renderTargetSRVs[i]  = nullDevice->CreateResourceView(core::ResourceViewType::Texture     , _renderTargets[i], 0, 0, nullptr);
+		_renderTargetUAVs[i]  = nullDevice->CreateResourceView(core::ResourceViewType::RWTexture   , _renderTargets[i], 0, 0, nullptr);
+	}
+
+	/*-------------------------------------------------------------------
+	-				 Set Depth / Stencil Descriptor
+	---------------------------------------------------------------------*/
+	if (_depthStencil)
+	{
+		_depthStencilView = nullDevice->CreateResourceView(core::ResourceViewType::DepthStencil, _depthStencil, 0, 0, nullptr);
+		_depthStencilSRV  = nullDevice->CreateResourceView(core::ResourceViewType::Texture     , _depthStencil, 0, 0, nullptr);
+	}
+}
+#pragma endregion Private Function
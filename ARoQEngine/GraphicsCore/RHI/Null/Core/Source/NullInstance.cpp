@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullInstance.cpp
+///  @brief  GPUgȂNullobNGhI邽߂̃CX^Xł.
+///  @author toide
+///  @date   2026/10/20 11:27:36
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullInstance.hpp"
+#include "../Include/NullAdapter.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     Null AdapterԂ܂
+*  @return    gu::SharedPointer<RHIDisplayAdapter> DisplayAdapter̃|C^
+*************************************************************************/
+gu::SharedPointer<core::RHIDisplayAdapter> RHIInstance::SearchHighPerformanceAdapter()
+{
+	return gu::MakeShared<RHIDisplayAdapter>(SharedFromThis());
+}
+
+/*!**********************************************************************
+*  @brief     Null AdapterԂ܂
+*  @return    gu::SharedPointer<RHIDisplayAdapter> DisplayAdapter̃|C^
+*************************************************************************/
+gu::SharedPointer<core::RHIDisplayAdapter> RHIInstance::SearchMinimumPowerAdapter()
+{
+	return gu::MakeShared<RHIDisplayAdapter>(SharedFromThis());
+}
+
+/*!**********************************************************************
+*  @brief     Null Adapter܂ޔzԂ܂
+*  @return    gu::DynamicArray<gu::SharedPointer<RHIDisplayAdapter>> : foCX̔z
+*************************************************************************/
+gu::DynamicArray<gu::SharedPointer<core::RHIDisplayAdapter>> RHIInstance::EnumrateAdapters() const
+{
+	gu::DynamicArray<gu::SharedPointer<core::RHIDisplayAdapter>> adapterLists = {};
+
+	const auto thisInstance = SharedFromThis();
+	adapterLists.Push(gu::MakeShared<RHIDisplayAdapter>(thisInstance));
+	return adapterLists;
+}
+
+/*!**********************************************************************
+*  @brief     o͗ɑSĂ̕foCXL܂
+*  @return    void
+*************************************************************************/
+void RHIInstance::LogAdapters() const
+{
+	auto adapterList = EnumrateAdapters();
+
+	for (auto& adapter : adapterList)
+	{
+		adapter->PrintInfo();
+	}
+}
+#pragma endregion Public Function
@@ -0,0 +1,63 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullQuery.cpp
+///  @brief  NullobNGh̃NGq[vł.
+///  @author toide
+///  @date   2026/10/20 11:18:52
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullQuery.hpp"
+#include "../Include/NullDevice.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHIQuery::RHIQuery(const gu::SharedPointer<core::RHIDevice>& device, const core::QueryHeapType heapType)
+	: core::RHIQuery(device, heapType)
+{
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     Queryp̊mۂĂȂ̈IndexԂ܂. ς݂IndexD悵čėp܂.
+*  @return    core::QueryResultLocation mۂʒu
+*************************************************************************/
+core::QueryResultLocation RHIQuery::Allocate()
+{
+	gu::uint32 queryID = 0;
+	if (!_freeIDs.IsEmpty())
+	{
+		queryID = _freeIDs.Back();
+		_freeIDs.Pop();
+	}
+	else
+	{
+		queryID = _issuedCount++;
+	}
+
+	return core::QueryResultLocation(SharedFromThis(), queryID, _queryHeapType);
+}
+
+/*!**********************************************************************
+*  @brief     Queryp̎w肳ꂽIndex܂.
+*  @param[in] core::QueryResultLocation& ʒu
+*  @return    void
+*************************************************************************/
+void RHIQuery::Free(core::QueryResultLocation& location)
+{
+	if (location.QueryID < _issuedCount) { _freeIDs.Push(location.QueryID); }
+
+	location.Heap = nullptr;
+}
+#pragma endregion Main Function
@@ -0,0 +1,105 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullSwapchain.cpp
+///  @brief  EBhEȂNullobNGh̃Xbv`FCł.
+///  @author toide
+///  @date   2026/10/20 10:52:03
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullSwapchain.hpp"
+#include "GraphicsCore/RHI/Null/Resource/Include/NullGPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIFence.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RHISwapchain::RHISwapchain(const gu::SharedPointer<rhi::core::RHIDevice>& device, const gu::SharedPointer<rhi::core::RHICommandQueue>& queue, const rhi::core::WindowInfo& windowInfo, const rhi::core::PixelFormat& pixelFormat, const gu::uint8 frameBufferCount, const gu::uint8 vsync, const bool isValidHDR, const bool isFullScreen)
+	: core::RHISwapchain(device, queue, windowInfo, pixelFormat, frameBufferCount, vsync, isValidHDR, isFullScreen)
+{
+	SetUp();
+}
+
+RHISwapchain::RHISwapchain(const gu::SharedPointer<rhi::core::RHIDevice>& device, const core::SwapchainDesc& desc)
+	: core::RHISwapchain(device, desc)
+{
+	SetUp();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     ̃obNobt@ɐ؂ւ, tFXsignalValueݒ肵܂.
+*  @param[in] const gu::SharedPointer<core::RHIFence>& `\ɂȂƂʒmtFX
+*  @param[in] const gu::uint64 ݒ肷l
+*  @return    gu::uint32 ̃obNobt@̃CfbNX
+*************************************************************************/
+gu::uint32 RHISwapchain::PrepareNextImage(const gu::SharedPointer<core::RHIFence>& fence, const gu::uint64 signalValue)
+{
+	_currentBackBufferIndex = static_cast<gu::uint8>((_currentBackBufferIndex + 1) % _desc.FrameBufferCount);
+
+	if (fence) { fence->Signal(signalValue); }
+
+	return _currentBackBufferIndex;
+}
+
+/*!**********************************************************************
+*  @brief     tFXwaitValueɒB̂҂Ă\񐔂𐔂܂.
+*  @param[in] const gu::SharedPointer<core::RHIFence>& `抮ʒmtFX
+*  @param[in] gu::uint64 ҋ@l
+*  @return    void
+*************************************************************************/
+void RHISwapchain::Present(const gu::SharedPointer<core::RHIFence>& fence, gu::uint64 waitValue)
+{
+	if (fence) { fence->Wait(waitValue); }
+
+	_presentCount++;
+}
+
+/*!**********************************************************************
+*  @brief     obNobt@w肵傫ō蒼܂.
+*  @param[in] const gu::uint32 
+*  @param[in] const gu::uint32 
+*  @return    void
+*************************************************************************/
+void RHISwapchain::Resize(const gu::uint32 width, const gu::uint32 height)
+{
+	if (_desc.WindowInfo.Width == width && _desc.WindowInfo.Height == height) { return; }
+
+	_desc.WindowInfo.Width  = width;
+	_desc.WindowInfo.Height = height;
+
+	SetUp();
+}
+
+/*!**********************************************************************
+*  @brief     ݂̐ݒŃobNobt@쐬܂. ŏ̃t[DirectX12ƓPresentԂn܂܂.
+*  @return    void
+*************************************************************************/
+void RHISwapchain::SetUp()
+{
+	Confirmf(_desc.FrameBufferCount > 0, "frame buffer count must be greater than 0");
+
+	_backBuffers.Clear();
+	_backBuffers.Resize(_desc.FrameBufferCount);
+
+	for (gu::uint8 i = 0; i < _desc.FrameBufferCount; ++i)
+	{
+		auto metaData  = core::GPUTextureMetaData::RenderTarget(_desc.WindowInfo.Width, _desc.WindowInfo.Height, _desc.PixelFormat);
+		metaData.State = core::ResourceState::Present;
+
+		_backBuffers[i] = gu::MakeShared<null::GPUTexture>(_device, metaData, SP("BackBuffer"));
+	}
+
+	_currentBackBufferIndex = 0;
+}
+#pragma endregion Main Function
@@ -0,0 +1,76 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUPipelineFactory.hpp
+///  @brief  NullobNGh̃pCvC̊eXe[g쐬܂.
+///  @author toide
+///  @date   2026/10/20 13:04:02
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_PIPELINE_FACTORY_HPP
+#define NULL_GPU_PIPELINE_FACTORY_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineFactory.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUPipelineFactory
+	****************************************************************************/
+	/* @brief  NullobNGh̊eXe[g쐬܂.
+	*****************************************************************************/
+	class GPUPipelineFactory : public core::GPUPipelineFactory
+	{
+	public:
+		#pragma region Public Function
+		/*! @brief _͂̐ݒ쐬܂*/
+		gu::SharedPointer<core::GPUInputAssemblyState> CreateInputAssemblyState(
+			const gu::DynamicArray<core::InputLayoutElement>& elements,
+			const core::PrimitiveTopology primitiveTopology = core::PrimitiveTopology::TriangleList) override;
+
+		/*! @brief X^CUXe[g쐬܂*/
+		gu::SharedPointer<core::GPURasterizerState> CreateRasterizerState(
+			const core::RasterizerProperty& rasterizerProperty) override;
+
+		/*! @brief [xXeVXe[g쐬܂*/
+		gu::SharedPointer<core::GPUDepthStencilState> CreateDepthStencilState(
+			const core::DepthStencilProperty& depthStencilProperty) override;
+
+		/*! @brief VF[_[쐬܂*/
+		gu::SharedPointer<core::GPUShaderState> CreateShaderState() override;
+
+		/*! @brief _[^[QbgƂɐݒ肷uhXe[g쐬܂*/
+		gu::SharedPointer<core::GPUBlendState> CreateBlendState(
+			const gu::DynamicArray<core::BlendProperty>& properties,
+			const bool alphaToCoverageEnable = false) override;
+
+		/*! @brief SẴ_[^[Qbgŋʂ̃uhXe[g쐬܂*/
+		gu::SharedPointer<core::GPUBlendState> CreateSingleBlendState(
+			const core::BlendProperty& blendProperty,
+			const bool alphaToCoverageEnable) override;
+
+		/*! @brief ̐ݒ̃uhXe[g_[^[Qbg̐쐬܂*/
+		gu::SharedPointer<core::GPUBlendState> CreateBlendState(const size_t numRenderTargets, const bool alphaToCoverageEnable = false) override;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUPipelineFactory() = default;
+
+		/*! @brief fXgN^*/
+		~GPUPipelineFactory() = default;
+
+		/*! @brief _foCXgč쐬܂*/
+		explicit GPUPipelineFactory(const gu::SharedPointer<core::RHIDevice>& device) : core::GPUPipelineFactory(device) {};
+		#pragma endregion
+	};
+}
+#endif
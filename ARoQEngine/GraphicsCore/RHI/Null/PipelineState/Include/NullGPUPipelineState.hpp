@@ -0,0 +1,136 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUPipelineState.hpp
+///  @brief  NullobNGh̃pCvCXe[gł.
+///  @author toide
+///  @date   2026/10/20 12:55:48
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_PIPELINE_STATE_HPP
+#define NULL_GPU_PIPELINE_STATE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUPipelineState.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUGraphicsPipelineState
+	****************************************************************************/
+	/* @brief  `p̃pCvCXe[gł. CompleteSettingł͊eXe[gĂ邩mF܂.
+	*****************************************************************************/
+	class GPUGraphicsPipelineState : public core::GPUGraphicsPipelineState
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     pCvC̐ݒ肪Ă邩mF, fobO\ݒ肵܂.
+		*  @param[in] const gu::tstring& fobO\
+		*  @return    void
+		*************************************************************************/
+		void CompleteSetting(const gu::tstring& name = SP("GraphicsPipeline")) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief fobO\ݒ肵܂*/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief fobO\Ԃ܂*/
+		__forceinline const gu::tstring& GetName() const noexcept { return _name; }
+
+		/*! @brief CompleteSettingĂяo*/
+		__forceinline bool HasCompleted() const noexcept { return _hasCompleted; }
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUGraphicsPipelineState() = default;
+
+		/*! @brief fXgN^*/
+		~GPUGraphicsPipelineState() = default;
+
+		/*! @brief _[pXƃ\[XCAEggč쐬܂*/
+		explicit GPUGraphicsPipelineState(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIResourceLayout>& layout);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+
+		/*! @brief CompleteSettingĂяo*/
+		bool _hasCompleted = false;
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			GPUComputePipelineState
+	****************************************************************************/
+	/* @brief  vZp̃pCvCXe[gł.
+	*****************************************************************************/
+	class GPUComputePipelineState : public core::GPUComputePipelineState
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     Rs[gVF[_[ݒ肳Ă邩mF, fobO\ݒ肵܂.
+		*  @param[in] const gu::tstring& fobO\
+		*  @return    void
+		*************************************************************************/
+		void CompleteSetting(const gu::tstring& name = SP("ComputePipeline")) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief fobO\ݒ肵܂*/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief fobO\Ԃ܂*/
+		__forceinline const gu::tstring& GetName() const noexcept { return _name; }
+
+		/*! @brief CompleteSettingĂяo*/
+		__forceinline bool HasCompleted() const noexcept { return _hasCompleted; }
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUComputePipelineState() = default;
+
+		/*! @brief fXgN^*/
+		~GPUComputePipelineState() = default;
+
+		/*! @brief \[XCAEggč쐬܂*/
+		explicit GPUComputePipelineState(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIResourceLayout>& layout);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+
+		/*! @brief CompleteSettingĂяo*/
+		bool _hasCompleted = false;
+		#pragma endregion
+	};
+}
+#endif
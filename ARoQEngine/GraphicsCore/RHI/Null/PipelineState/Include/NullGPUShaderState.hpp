@@ -0,0 +1,78 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUShaderState.hpp
+///  @brief  NullobNGh̃VF[_[ł. HLSL̃RpC͍s܂.
+///  @author toide
+///  @date   2026/10/20 12:47:10
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_SHADER_STATE_HPP
+#define NULL_GPU_SHADER_STATE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUShaderState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUShaderCompiler.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUShaderState
+	****************************************************************************/
+	/* @brief  Compileł̓o[WƃVF[_[ʂ̊mFs, t@C, Gg|Cg, }NׂoCgVF[_[R[hƂ܂. @n
+	*          ݒ肩͓oCg񂪍邽, VF[_[R[hgLbV̓mFɂgpł܂.
+	*****************************************************************************/
+	class GPUShaderState : public core::GPUShaderState
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     RpC̑, ݒ荀ڂ猈܂oCgVF[_[R[hƂč쐬܂.
+		*  @param[in] const core::ShaderCompilerOption& VF[_[RpC̐ݒ荀
+		*  @return    void
+		*************************************************************************/
+		void Compile(const core::ShaderCompilerOption& option) override;
+
+		/*!**********************************************************************
+		*  @brief     RpCς݂̃t@Ĉ܂܃VF[_[R[hƂēǂݍ݂܂.
+		*  @param[in] const core::ShaderType VF[_[̎
+		*  @param[in] const gu::tstring& t@CpX
+		*  @return    void
+		*************************************************************************/
+		void LoadBinary(const core::ShaderType type, const gu::tstring& fileName) override;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUShaderState() = default;
+
+		/*! @brief fXgN^*/
+		~GPUShaderState() = default;
+
+		/*! @brief foCXgč쐬܂. */
+		explicit GPUShaderState(const gu::SharedPointer<core::RHIDevice>& device) : core::GPUShaderState(device) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief VF[_[R[h̖ɒǉ܂*/
+		void AppendCode(const gu::tstring& text);
+
+		/*! @brief _code_blobDataɐݒ肵܂*/
+		void UpdateBlobData();
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief VF[_[R[h̎*/
+		gu::DynamicArray<gu::uint8> _code = {};
+		#pragma endregion
+	};
+}
+#endif
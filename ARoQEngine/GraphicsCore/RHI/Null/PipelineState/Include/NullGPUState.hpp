@@ -0,0 +1,117 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUState.hpp
+///  @brief  NullobNGh̃pCvC̊eXe[W̐ݒł. ݒlcorẽNXێĂ邽, ǉ͎̏܂.
+///  @author toide
+///  @date   2026/10/20 12:41:25
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_STATE_HPP
+#define NULL_GPU_STATE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUBlendState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPURasterizerState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUDepthStencilState.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUInputAssemblyState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUBlendState
+	****************************************************************************/
+	/* @brief  uhXe[gł.
+	*****************************************************************************/
+	class GPUBlendState : public core::GPUBlendState
+	{
+	public:
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUBlendState() = default;
+
+		/*! @brief fXgN^*/
+		~GPUBlendState() = default;
+
+		/*! @brief ʂɐݒ肷̃uhXe[g*/
+		explicit GPUBlendState(const gu::SharedPointer<core::RHIDevice>& device, const gu::DynamicArray<core::BlendProperty>& properties, const bool alphaToCoverageEnable)
+			: core::GPUBlendState(device, properties, alphaToCoverageEnable) {};
+
+		/*! @brief SẴ_[^[Qbgŋʂ̃vpeBgp*/
+		explicit GPUBlendState(const gu::SharedPointer<core::RHIDevice>& device, const core::BlendProperty& blendProperty, const bool alphaToCoverageEnable)
+			: core::GPUBlendState(device, blendProperty, alphaToCoverageEnable) {};
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			GPURasterizerState
+	****************************************************************************/
+	/* @brief  X^CUXe[gł.
+	*****************************************************************************/
+	class GPURasterizerState : public core::GPURasterizerState
+	{
+	public:
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPURasterizerState() = default;
+
+		/*! @brief fXgN^*/
+		~GPURasterizerState() = default;
+
+		/*! @brief RasterizerPropertygč쐬܂. */
+		explicit GPURasterizerState(const gu::SharedPointer<core::RHIDevice>& device, const core::RasterizerProperty& rasterizerProperty)
+			: core::GPURasterizerState(device, rasterizerProperty) {};
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			GPUDepthStencilState
+	****************************************************************************/
+	/* @brief  [xXeVXe[gł.
+	*****************************************************************************/
+	class GPUDepthStencilState : public core::GPUDepthStencilState
+	{
+	public:
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUDepthStencilState() = default;
+
+		/*! @brief fXgN^*/
+		~GPUDepthStencilState() = default;
+
+		/*! @brief DepthStencilPropertygč쐬܂. */
+		explicit GPUDepthStencilState(const gu::SharedPointer<core::RHIDevice>& device, const core::DepthStencilProperty& depthStencilProperty)
+			: core::GPUDepthStencilState(device, depthStencilProperty) {};
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			GPUInputAssemblyState
+	****************************************************************************/
+	/* @brief  _͂̐ݒł.
+	*****************************************************************************/
+	class GPUInputAssemblyState : public core::GPUInputAssemblyState
+	{
+	public:
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUInputAssemblyState() = default;
+
+		/*! @brief fXgN^*/
+		~GPUInputAssemblyState() = default;
+
+		/*! @brief {IInputAssembly Stageō쐬RXgN^*/
+		explicit GPUInputAssemblyState(const gu::SharedPointer<core::RHIDevice>& device, const gu::DynamicArray<core::InputLayoutElement>& elements,
+			const core::PrimitiveTopology primitiveTopology = core::PrimitiveTopology::TriangleList)
+			: core::GPUInputAssemblyState(device, elements, primitiveTopology) {};
+		#pragma endregion
+	};
+}
+#endif
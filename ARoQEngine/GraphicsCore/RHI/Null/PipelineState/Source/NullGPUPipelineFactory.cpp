@@ -0,0 +1,65 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUPipelineFactory.cpp
+///  @brief  NullobNGh̃pCvC̊eXe[g쐬܂.
+///  @author toide
+///  @date   2026/10/20 13:04:02
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUPipelineFactory.hpp"
+#include "../Include/NullGPUState.hpp"
+#include "../Include/NullGPUShaderState.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+gu::SharedPointer<core::GPUInputAssemblyState> GPUPipelineFactory::CreateInputAssemblyState(
+	const gu::DynamicArray<core::InputLayoutElement>& elements,
+	const core::PrimitiveTopology primitiveTopology)
+{
+	return gu::StaticPointerCast<core::GPUInputAssemblyState>(gu::MakeShared<null::GPUInputAssemblyState>(_device, elements, primitiveTopology));
+}
+
+gu::SharedPointer<core::GPURasterizerState> GPUPipelineFactory::CreateRasterizerState(
+	const core::RasterizerProperty& rasterizerProperty)
+{
+	return gu::StaticPointerCast<core::GPURasterizerState>(gu::MakeShared<null::GPURasterizerState>(_device, rasterizerProperty));
+}
+
+gu::SharedPointer<core::GPUDepthStencilState> GPUPipelineFactory::CreateDepthStencilState(
+	const core::DepthStencilProperty& depthStencilProperty)
+{
+	return gu::StaticPointerCast<core::GPUDepthStencilState>(gu::MakeShared<null::GPUDepthStencilState>(_device, depthStencilProperty));
+}
+
+gu::SharedPointer<core::GPUShaderState> GPUPipelineFactory::CreateShaderState()
+{
+	return gu::StaticPointerCast<core::GPUShaderState>(gu::MakeShared<null::GPUShaderState>(_device));
+}
+
+gu::SharedPointer<core::GPUBlendState> GPUPipelineFactory::CreateBlendState(
+	const gu::DynamicArray<core::BlendProperty>& properties, const bool alphaToCoverageEnable)
+{
+	return gu::StaticPointerCast<core::GPUBlendState>(gu::MakeShared<null::GPUBlendState>(_device, properties, alphaToCoverageEnable));
+}
+
+gu::SharedPointer<core::GPUBlendState> GPUPipelineFactory::CreateSingleBlendState(
+	const core::BlendProperty& blendProperty, const bool alphaToCoverageEnable)
+{
+	return gu::StaticPointerCast<core::GPUBlendState>(gu::MakeShared<null::GPUBlendState>(_device, blendProperty, alphaToCoverageEnable));
+}
+
+gu::SharedPointer<core::GPUBlendState> GPUPipelineFactory::CreateBlendState(const size_t numRenderTargets, const bool alphaToCoverageEnable)
+{
+	return gu::StaticPointerCast<core::GPUBlendState>(gu::MakeShared<null::GPUBlendState>(_device, gu::DynamicArray<core::BlendProperty>(numRenderTargets), alphaToCoverageEnable));
+}
+#pragma endregion Main Function
@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUPipelineState.cpp
+///  @brief  NullobNGh̃pCvCXe[gł.
+///  @author toide
+///  @date   2026/10/20 12:55:48
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUPipelineState.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Graphics Pipeline
+GPUGraphicsPipelineState::GPUGraphicsPipelineState(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIRenderPass>& renderPass, const gu::SharedPointer<core::RHIResourceLayout>& layout)
+	: core::GPUGraphicsPipelineState(device, renderPass, layout)
+{
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+}
+
+/*!**********************************************************************
+*  @brief     pCvC̐ݒ肪Ă邩mF, fobO\ݒ肵܂.
+*  @param[in] const gu::tstring& fobO\
+*  @return    void
+*************************************************************************/
+void GPUGraphicsPipelineState::CompleteSetting(const gu::tstring& name)
+{
+	Confirmf(_inputAssemblyState, "input assembly state is not set");
+	Confirmf(_vertexShaderState, "vertex shader is not set");
+	Check(_renderPass);
+
+	_name         = name;
+	_hasCompleted = true;
+}
+#pragma endregion Graphics Pipeline
+
+#pragma region Compute Pipeline
+GPUComputePipelineState::GPUComputePipelineState(const gu::SharedPointer<core::RHIDevice>& device, const gu::SharedPointer<core::RHIResourceLayout>& layout)
+	: core::GPUComputePipelineState(device, layout)
+{
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+}
+
+/*!**********************************************************************
+*  @brief     Rs[gVF[_[ݒ肳Ă邩mF, fobO\ݒ肵܂.
+*  @param[in] const gu::tstring& fobO\
+*  @return    void
+*************************************************************************/
+void GPUComputePipelineState::CompleteSetting(const gu::tstring& name)
+{
+	Confirmf(_computeShaderState, "compute shader is not set");
+
+	_name         = name;
+	_hasCompleted = true;
+}
+#pragma endregion Compute Pipeline
@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUShaderState.cpp
+///  @brief  NullobNGh̃VF[_[ł. HLSL̃RpC͍s܂.
+///  @author toide
+///  @date   2026/10/20 12:47:10
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUShaderState.hpp"
+#include "Platform/Core/Include/CoreFileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     RpC̑, ݒ荀ڂ猈܂oCgVF[_[R[hƂč쐬܂.
+*  @param[in] const core::ShaderCompilerOption& VF[_[RpC̐ݒ荀
+*  @return    void
+*************************************************************************/
+void GPUShaderState::Compile(const core::ShaderCompilerOption& option)
+{
+	/*-------------------------------------------------------------------
+	-         VF[_[o[W̃`FbN
+	---------------------------------------------------------------------*/
+	Check(0.0f < option.Version && option.Version <= NEWEST_VERSION);
+
+	_version = option.Version;
+
+	/*-------------------------------------------------------------------
+	-         VF[_[ʂ̃`FbN
+	---------------------------------------------------------------------*/
+	_shaderType = option.Type;
+
+	Check(IsValidShaderType());
+
+	/*-------------------------------------------------------------------
+	-         ݒ荀ڂVF[_[R[h쐬
+	---------------------------------------------------------------------*/
+	_code.Clear();
+	AppendCode(GetShaderTypeName(option.Type) + SP("_") + Format(option.Version));
+	AppendCode(option.FileName);
+	AppendCode(option.EntryPoint);
+	for (const auto& define : option.Defines)
+	{
+		AppendCode(define);
+	}
+
+	UpdateBlobData();
+}
+
+/*!**********************************************************************
+*  @brief     RpCς݂̃t@Ĉ܂܃VF[_[R[hƂēǂݍ݂܂.
+*  @param[in] const core::ShaderType VF[_[̎
+*  @param[in] const gu::tstring& t@CpX
+*  @return    void
+*************************************************************************/
+void GPUShaderState::LoadBinary(const core::ShaderType type, const gu::tstring& fileName)
+{
+	_shaderType = type;
+
+	const auto fileHandle = platform::core::IFileSystem::Get()->OpenRead(fileName, true, false);
+	Confirmf(fileHandle, "failed to open the shader binary");
+
+	_code.Resize(fileHandle->Size(), true);
+	fileHandle->Read(_code.Data(), _code.Size());
+
+	UpdateBlobData();
+}
+
+/*!**********************************************************************
+*  @brief     I[܂߂ăVF[_[R[h̖ɒǉ܂.
+*  @param[in] const gu::tstring& ǉ镶
+*  @return    void
+*************************************************************************/
+void GPUShaderState::AppendCode(const gu::tstring& text)
+{
+	const auto offset   = _code.Size();
+	const auto byteSize = (text.Size() + 1) * sizeof(gu::tchar);
+
+	_code.Resize(offset + byteSize, true);
+	gu::Memory::Copy(_code.Data() + offset, text.CString(), byteSize);
+}
+
+/*!**********************************************************************
+*  @brief     _code_blobDataɐݒ肵܂
+*  @return    void
+*************************************************************************/
+void GPUShaderState::UpdateBlobData()
+{
+	_blobData.Pointer  = _code.Data();
+	_blobData.ByteSize = _code.Size();
+}
+#pragma endregion Main Function
@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUBuffer.hpp
+///  @brief  CPUɊmۂNullobNGh̃obt@ł.
+///  @author toide
+///  @date   2026/10/20 11:40:14
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_BUFFER_HPP
+#define NULL_GPU_BUFFER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUBuffer
+	****************************************************************************/
+	/* @brief  obt@̒gCPUɕێ܂. q[v̎ނɊւ炸݂͒ɔf, @n
+	*          R}hXgnꂽꍇUploadBufferR}hƂċL^܂. GPUAhX̓foCXs鉼zIȒlł.
+	*****************************************************************************/
+	class GPUBuffer : public core::GPUBuffer
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     CPŨf[^obt@ɏ݂܂.
+		*  @param[in] const void* ރf[^
+		*  @param[in] const gu::uint64 ރoCg
+		*  @param[in] const gu::uint64 ݊Jnʒu
+		*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg (nullptȑꍇ͋L^܂)
+		*  @param[in] const bool MapĂ邩
+		*  @return    void
+		*************************************************************************/
+		virtual void UploadByte(const void* data, const gu::uint64 allocateByteSize, const gu::uint64 offsetByte, const gu::SharedPointer<core::RHICommandList>& commandList, const bool useMapManually) override;
+
+		/*!**********************************************************************
+		*  @brief     vfPʂCPŨf[^obt@ɏ݂܂.
+		*  @param[in] const void* ރf[^
+		*  @param[in] const gu::uint64 ޗvf
+		*  @param[in] const gu::uint64 ݊Jn̗vfʒu
+		*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg (nullptȑꍇ͋L^܂)
+		*  @param[in] const bool MapĂ邩
+		*  @return    void
+		*************************************************************************/
+		virtual void UploadIndex(const void* data, const gu::uint64 elementCount, const gu::uint64 offsetIndex, const gu::SharedPointer<core::RHICommandList>& commandList, const bool useMapManually) override;
+
+		/*! @brief CPUANZXł悤ɂ܂*/
+		virtual void Map() override;
+
+		/*! @brief CPŨANZXI܂*/
+		virtual void Unmap() override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief fobO\ݒ肵܂*/
+		virtual void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief fobO\Ԃ܂*/
+		__forceinline const gu::tstring& GetName() const noexcept { return _name; }
+
+		/*! @brief MapĂԂLCPŨAhXԂ܂*/
+		virtual gu::uint8* GetCPUMappedAddress() override { return _mappedData; };
+
+		/*! @brief foCXszIGPUAhXԂ܂*/
+		virtual gu::uint64 GetGPUVirtualAddress() override { return _gpuVirtualAddress; }
+
+		/*! @brief obt@̒gێĂCPUԂ܂. Map̗LɊւ炸Lł*/
+		__forceinline gu::uint8* GetCPUMemory() noexcept { return _memory.Data(); }
+
+		/*! @brief obt@̒gێĂCPUԂ܂. Map̗LɊւ炸Lł*/
+		__forceinline const gu::uint8* GetCPUMemory() const noexcept { return _memory.Data(); }
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUBuffer() = default;
+
+		/*! @brief fXgN^*/
+		~GPUBuffer();
+
+		/*! @brief obt@̍쐬gč쐬܂*/
+		explicit GPUBuffer(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUBufferMetaData& metaData, const gu::tstring& name = SP("Buffer"));
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief obt@̒g*/
+		gu::DynamicArray<gu::uint8> _memory = {};
+
+		/*! @brief MapĂԂCPŨAhX*/
+		gu::uint8* _mappedData = nullptr;
+
+		/*! @brief zIGPUAhX*/
+		gu::uint64 _gpuVirtualAddress = 0;
+
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+
+		/*! @brief MapĂ邩*/
+		bool _useCPUMapped = false;
+		#pragma endregion
+	};
+}
+#endif
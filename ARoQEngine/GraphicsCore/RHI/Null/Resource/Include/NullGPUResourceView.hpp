@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUResourceView.hpp
+///  @brief  NullobNGh̃\[Xr[ł.
+///  @author toide
+///  @date   2026/10/20 12:16:52
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_RESOURCE_VIEW_HPP
+#define NULL_GPU_RESOURCE_VIEW_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUResourceView
+	****************************************************************************/
+	/* @brief  DirectX12ƓΉŃfBXNv^q[vIDmۂ, Bindł̓r[̌ŗLIDR}hXg[ɋL^܂.
+	*****************************************************************************/
+	class GPUResourceView : public core::GPUResourceView
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     \[XCAEg̔zԍɃr[ݒ肵܂. Rs[p̃R}hXgɂ͐ݒł܂.
+		*  @param[in] const gu::SharedPointer<core::RHICommandList>& R}hXg
+		*  @param[in] const gu::uint32 \[XCAEg̔zԍ
+		*  @param[in] const gu::SharedPointer<core::RHIResourceLayout>& (Vulkan̂ݎgp)
+		*  @return    void
+		*************************************************************************/
+		void Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, [[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& layout = nullptr) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief mۂfBXNv^̎ނԂ܂*/
+		__forceinline core::DescriptorHeapType GetDescriptorHeapType() const noexcept { return _heapType; }
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUResourceView() = default;
+
+		/*! @brief fXgN^. mۂfBXNv^ID܂*/
+		~GPUResourceView();
+
+		/*! @brief obt@̃r[쐬܂*/
+		explicit GPUResourceView(const gu::SharedPointer<core::RHIDevice>& device, const core::ResourceViewType type, const gu::SharedPointer<core::GPUBuffer>& buffer,
+			const gu::uint32 mipSlice = 0, const gu::uint32 planeSlice = 0, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr);
+
+		/*! @brief eNX`̃r[쐬܂*/
+		explicit GPUResourceView(const gu::SharedPointer<core::RHIDevice>& device, const core::ResourceViewType type, const gu::SharedPointer<core::GPUTexture>& texture,
+			const gu::uint32 mipSlice = 0, const gu::uint32 planeSlice = 0, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap = nullptr);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief r[̎ނɑΉfBXNv^q[vI, IDmۂ܂*/
+		void AllocateDescriptor();
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief mۂfBXNv^̎*/
+		core::DescriptorHeapType _heapType = core::DescriptorHeapType::CBV;
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+
+		/*! @brief fBXNv^mۂ*/
+		bool _hasCreated = false;
+		#pragma endregion
+	};
+}
+#endif
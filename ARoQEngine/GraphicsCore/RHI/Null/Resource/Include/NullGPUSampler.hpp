@@ -0,0 +1,61 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUSampler.hpp
+///  @brief  NullobNGh̃Tv[ł.
+///  @author toide
+///  @date   2026/10/20 12:29:07
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_SAMPLER_HPP
+#define NULL_GPU_SAMPLER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUSampler.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUSampler
+	****************************************************************************/
+	/* @brief  Tv[ێ邾̃NXł. 
+	*****************************************************************************/
+	class GPUSampler : public core::GPUSampler
+	{
+	public:
+		#pragma region Public Property
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUSampler() = default;
+
+		/*! @brief fXgN^*/
+		~GPUSampler() = default;
+
+		/*! @brief _foCXƃTv[ŏ*/
+		explicit GPUSampler(const gu::SharedPointer<core::RHIDevice>& device, const core::SamplerInfo& samplerInfo)
+			: core::GPUSampler(device, samplerInfo)
+		{
+			_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+		}
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUTexture.hpp
+///  @brief  CPUɊmۂNullobNGh̃eNX`ł.
+///  @author toide
+///  @date   2026/10/20 11:58:31
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef NULL_GPU_TEXTURE_HPP
+#define NULL_GPU_TEXTURE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::null
+{
+	/****************************************************************************
+	*				  			GPUTexture
+	****************************************************************************/
+	/* @brief  eNX`̑傫Ǘ, f̃WriteLoadŏ܂ꂽɏ߂Ċmۂ܂. @n
+	*          _[^[Qbĝ悤GPUރeNX`CPU܂. 摜̃fR[h͍s܂.
+	*****************************************************************************/
+	class GPUTexture : public core::GPUTexture
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     t@C̒ĝ܂܉f̃ɓǂݍ݂܂. 摜̃fR[h͍s킸, ^f[^ύX܂.
+		*  @param[in] const gu::tstring& t@CpX
+		*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg
+		*  @return    void
+		*************************************************************************/
+		void Load(const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList) override;
+
+		/*! @brief GPU̓ǂݖ߂͍sȂ, ܂.*/
+		void Save([[maybe_unused]] const gu::tstring& filePath, [[maybe_unused]] const gu::SharedPointer<core::RHICommandList>& commandList, [[maybe_unused]] const gu::SharedPointer<core::RHICommandQueue>& commandQueue) override {};
+
+		/*!**********************************************************************
+		*  @brief     ~bv0̉f݂܂. pixel̓eNX`̃sNZtH[}bgŕ񂾃oCgƂĈ܂.
+		*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg
+		*  @param[in] const gm::RGBA* f
+		*  @return    void
+		*************************************************************************/
+		void Write(const gu::SharedPointer<core::RHICommandList>& commandList, const gm::RGBA* pixel) override;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief obt@ǂ*/
+		bool IsBuffer() const override { return false; }
+
+		/*! @brief eNX`ǂ*/
+		bool IsTexture() const override { return true; }
+
+		/*! @brief \[X̏Ԃݒ肵܂*/
+		void SetResourceState(const core::ResourceState state) override { _metaData.State = state; }
+
+		/*! @brief fobO\ݒ肵܂*/
+		void SetName(const gu::tstring& name) override { _name = name; }
+
+		/*! @brief fobO\Ԃ܂*/
+		__forceinline const gu::tstring& GetName() const noexcept { return _name; }
+
+		/*! @brief ܂ꂽf̃Ԃ܂. ܂x܂ĂȂꍇ͋ł*/
+		__forceinline const gu::DynamicArray<gu::uint8>& GetCPUMemory() const noexcept { return _memory; }
+
+		/*! @brief ŗLIDԂ܂*/
+		__forceinline ObjectID GetObjectID() const noexcept { return _objectID; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		GPUTexture() = default;
+
+		/*! @brief fXgN^*/
+		~GPUTexture();
+
+		/*! @brief LoadŎgp邽߂̋̃eNX`쐬܂*/
+		explicit GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const gu::tstring& name = SP(""));
+
+		/*! @brief eNX`̍쐬gč쐬܂*/
+		explicit GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUTextureMetaData& metaData, const gu::tstring& name = SP(""));
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief f̃mۂ, R}hXgɏ݂L^܂*/
+		void Upload(const void* data, const gu::uint64 byteSize, const gu::SharedPointer<core::RHICommandList>& commandList);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ܂ꂽf*/
+		gu::DynamicArray<gu::uint8> _memory = {};
+
+		/*! @brief fobO\*/
+		gu::tstring _name = SP("");
+
+		/*! @brief ŗLID*/
+		ObjectID _objectID = INVALID_OBJECT_ID;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,125 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUBuffer.cpp
+///  @brief  CPUɊmۂNullobNGh̃obt@ł.
+///  @author toide
+///  @date   2026/10/20 11:40:14
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUBuffer.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCommandList.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUBuffer::GPUBuffer(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUBufferMetaData& metaData, const gu::tstring& name)
+	: core::GPUBuffer(device, metaData, name), _name(name)
+{
+	const auto nullDevice = static_cast<null::RHIDevice*>(_device.Get());
+	const auto byteSize   = _metaData.GetTotalByte();
+
+	_memory.Resize(byteSize, true);
+	_gpuVirtualAddress = nullDevice->IssueGPUVirtualAddress(byteSize);
+	_objectID          = nullDevice->IssueObjectID();
+	nullDevice->AddAllocatedByteSize(byteSize);
+}
+
+GPUBuffer::~GPUBuffer()
+{
+	if (_device)
+	{
+		static_cast<null::RHIDevice*>(_device.Get())->RemoveAllocatedByteSize(_memory.Size());
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     CPŨf[^obt@ɏ݂܂. DirectX12ł͒ԃobt@oRꍇ, ł͒ڏ݂܂.
+*  @param[in] const void* ރf[^
+*  @param[in] const gu::uint64 ރoCg
+*  @param[in] const gu::uint64 ݊Jnʒu
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg (nullptȑꍇ͋L^܂)
+*  @param[in] const bool MapĂ邩
+*  @return    void
+*************************************************************************/
+void GPUBuffer::UploadByte(const void* data, const gu::uint64 allocateByteSize, const gu::uint64 offsetByte, const gu::SharedPointer<core::RHICommandList>& commandList, const bool useMapManually)
+{
+	Confirmf(allocateByteSize + offsetByte <= _memory.Size(), "upload range exceeds the buffer");
+
+	if (_metaData.IsCPUAccessible() && gu::HasAnyFlags(_metaData.Usage, core::BufferCreateFlags::AnyDynamic))
+	{
+		if (useMapManually)
+		{
+			Checkf(_useCPUMapped, "buffer is not mapped");
+			gu::Memory::Copy(&_mappedData[offsetByte], data, allocateByteSize);
+		}
+		else
+		{
+			Map();
+			gu::Memory::Copy(&_mappedData[offsetByte], data, allocateByteSize);
+			Unmap();
+		}
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-      GPUp̃obt@, Rs[R}hƂċL^Ă
+	---------------------------------------------------------------------*/
+	gu::Memory::Copy(_memory.Data() + offsetByte, data, allocateByteSize);
+
+	if (commandList)
+	{
+		static_cast<null::RHICommandList*>(commandList.Get())->RecordUploadResource(_objectID, offsetByte, allocateByteSize);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     vfPʂCPŨf[^obt@ɏ݂܂.
+*  @param[in] const void* ރf[^
+*  @param[in] const gu::uint64 ޗvf
+*  @param[in] const gu::uint64 ݊Jn̗vfʒu
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg
+*  @param[in] const bool MapĂ邩
+*  @return    void
+*************************************************************************/
+void GPUBuffer::UploadIndex(const void* data, const gu::uint64 elementCount, const gu::uint64 offsetIndex, const gu::SharedPointer<core::RHICommandList>& commandList, const bool useMapManually)
+{
+	Check(elementCount + offsetIndex <= _metaData.Count);
+	UploadByte(data, elementCount * _metaData.Stride, offsetIndex * _metaData.Stride, commandList, useMapManually);
+}
+
+/*!**********************************************************************
+*  @brief     CPUANZXł悤ɂ܂
+*  @return    void
+*************************************************************************/
+void GPUBuffer::Map()
+{
+	Check(_metaData.IsCPUAccessible());
+
+	_mappedData   = _memory.Data();
+	_useCPUMapped = true;
+}
+
+/*!**********************************************************************
+*  @brief     CPŨANZXI܂
+*  @return    void
+*************************************************************************/
+void GPUBuffer::Unmap()
+{
+	_mappedData   = nullptr;
+	_useCPUMapped = false;
+}
+#pragma endregion Main Function
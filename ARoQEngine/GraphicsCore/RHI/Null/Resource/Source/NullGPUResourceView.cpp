@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUResourceView.cpp
+///  @brief  NullobNGh̃\[Xr[ł.
+///  @author toide
+///  @date   2026/10/20 12:16:52
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUResourceView.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCommandList.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDescriptorHeap.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUResourceView::GPUResourceView(const gu::SharedPointer<core::RHIDevice>& device, const core::ResourceViewType type, const gu::SharedPointer<core::GPUBuffer>& buffer,
+	const gu::uint32 mipSlice, const gu::uint32 planeSlice, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap)
+	: core::GPUResourceView(device, type, mipSlice, planeSlice, customHeap)
+{
+	_buffer   = buffer;
+	_texture  = nullptr;
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+
+	if (_buffer) { AllocateDescriptor(); }
+}
+
+GPUResourceView::GPUResourceView(const gu::SharedPointer<core::RHIDevice>& device, const core::ResourceViewType type, const gu::SharedPointer<core::GPUTexture>& texture,
+	const gu::uint32 mipSlice, const gu::uint32 planeSlice, const gu::SharedPointer<core::RHIDescriptorHeap>& customHeap)
+	: core::GPUResourceView(device, type, mipSlice, planeSlice, customHeap)
+{
+	_texture  = texture;
+	_buffer   = nullptr;
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+
+	if (_texture) { AllocateDescriptor(); }
+}
+
+GPUResourceView::~GPUResourceView()
+{
+	if (_hasCreated && _heap)
+	{
+		_heap->Free(_heapType, _descriptorID);
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     \[XCAEg̔zԍɃr[ݒ肵܂. Rs[p̃R}hXgɂ͐ݒł܂.
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& R}hXg
+*  @param[in] const gu::uint32 \[XCAEg̔zԍ
+*  @param[in] const gu::SharedPointer<core::RHIResourceLayout>& (Vulkan̂ݎgp)
+*  @return    void
+*************************************************************************/
+void GPUResourceView::Bind(const gu::SharedPointer<core::RHICommandList>& commandList, const gu::uint32 index, [[maybe_unused]] const gu::SharedPointer<core::RHIResourceLayout>& layout)
+{
+	Confirmf(commandList->GetType() != core::CommandListType::Copy, "failed to bind root descriptor table");
+
+	static_cast<null::RHICommandList*>(commandList.Get())->RecordBindResourceView(_objectID, index);
+}
+
+/*!**********************************************************************
+*  @brief     r[̎ނɑΉfBXNv^q[vI, IDmۂ܂. JX^q[vw肳Ăꍇ͂g܂.
+*  @return    void
+*************************************************************************/
+void GPUResourceView::AllocateDescriptor()
+{
+	switch (_resourceViewType)
+	{
+		case core::ResourceViewType::ConstantBuffer:        { _heapType = core::DescriptorHeapType::CBV; break; }
+		case core::ResourceViewType::Texture:
+		case core::ResourceViewType::Buffer:
+		case core::ResourceViewType::StructuredBuffer:
+		case core::ResourceViewType::AccelerationStructure: { _heapType = core::DescriptorHeapType::SRV; break; }
+		case core::ResourceViewType::RWBuffer:
+		case core::ResourceViewType::RWTexture:
+		case core::ResourceViewType::RWStructuredBuffer:    { _heapType = core::DescriptorHeapType::UAV; break; }
+		case core::ResourceViewType::RenderTarget:          { _heapType = core::DescriptorHeapType::RTV; break; }
+		case core::ResourceViewType::DepthStencil:          { _heapType = core::DescriptorHeapType::DSV; break; }
+		default:
+		{
+			Confirmf(false, "not support descriptor view. (null api)");
+			return;
+		}
+	}
+
+	if (!_heap) { _heap = _device->GetDefaultHeap(_heapType); }
+
+	_descriptorID = _heap->Allocate(_heapType);
+	_hasCreated   = true;
+}
+#pragma endregion Main Function
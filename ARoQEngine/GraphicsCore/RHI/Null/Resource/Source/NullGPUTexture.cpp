@@ -0,0 +1,115 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   NullGPUTexture.cpp
+///  @brief  CPUɊmۂNullobNGh̃eNX`ł.
+///  @author toide
+///  @date   2026/10/20 11:58:31
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/NullGPUTexture.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullDevice.hpp"
+#include "GraphicsCore/RHI/Null/Core/Include/NullCommandList.hpp"
+#include "Platform/Core/Include/CoreFileSystem.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::null;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+GPUTexture::GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const gu::tstring& name)
+	: core::GPUTexture(device, name), _name(name)
+{
+	_objectID = static_cast<null::RHIDevice*>(_device.Get())->IssueObjectID();
+}
+
+GPUTexture::GPUTexture(const gu::SharedPointer<core::RHIDevice>& device, const core::GPUTextureMetaData& metaData, const gu::tstring& name)
+	: core::GPUTexture(device, metaData, name), _name(name)
+{
+	/*-------------------------------------------------------------------
+	-      GPUŊmۂz̑傫 (S~bv, Szvf)
+	---------------------------------------------------------------------*/
+	for (gu::uint8 mip = 0; mip < GetMipMapCount(); ++mip)
+	{
+		_physicalSize += GetByteSize(mip) * GetArrayLength();
+	}
+
+	const auto nullDevice = static_cast<null::RHIDevice*>(_device.Get());
+	_objectID = nullDevice->IssueObjectID();
+	nullDevice->AddAllocatedByteSize(_physicalSize);
+}
+
+GPUTexture::~GPUTexture()
+{
+	if (_device)
+	{
+		static_cast<null::RHIDevice*>(_device.Get())->RemoveAllocatedByteSize(_physicalSize);
+	}
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     t@C̒ĝ܂܉f̃ɓǂݍ݂܂. 摜̃fR[h͍s킸, ^f[^ύX܂.
+*  @param[in] const gu::tstring& t@CpX
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg
+*  @return    void
+*************************************************************************/
+void GPUTexture::Load(const gu::tstring& filePath, const gu::SharedPointer<core::RHICommandList>& commandList)
+{
+	Check(commandList);
+	Check(commandList->GetType() == core::CommandListType::Graphics);
+
+	const auto fileHandle = platform::core::IFileSystem::Get()->OpenRead(filePath, true, false);
+	Confirmf(fileHandle, "failed to open the texture file");
+
+	const auto fileSize = fileHandle->Size();
+	gu::DynamicArray<gu::uint8> fileData(fileSize, true);
+	fileHandle->Read(fileData.Data(), fileSize);
+
+	Upload(fileData.Data(), fileSize, commandList);
+}
+
+/*!**********************************************************************
+*  @brief     ~bv0̉f݂܂. pixel̓eNX`̃sNZtH[}bgŕ񂾃oCgƂĈ܂.
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg
+*  @param[in] const gm::RGBA* f
+*  @return    void
+*************************************************************************/
+void GPUTexture::Write(const gu::SharedPointer<core::RHICommandList>& commandList, const gm::RGBA* pixel)
+{
+	Check(commandList->GetType() == core::CommandListType::Graphics);
+	Check(pixel);
+
+	Upload(pixel, GetByteSize(0) * GetArrayLength(), commandList);
+}
+
+/*!**********************************************************************
+*  @brief     f̃mۂ, R}hXgɏ݂L^܂
+*  @param[in] const void* ރf[^
+*  @param[in] const gu::uint64 oCg
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& ݂L^R}hXg
+*  @return    void
+*************************************************************************/
+void GPUTexture::Upload(const void* data, const gu::uint64 byteSize, const gu::SharedPointer<core::RHICommandList>& commandList)
+{
+	if (_memory.Size() < byteSize)
+	{
+		_memory.Resize(byteSize, true);
+	}
+	gu::Memory::Copy(_memory.Data(), data, byteSize);
+
+	if (commandList)
+	{
+		static_cast<null::RHICommandList*>(commandList.Get())->RecordUploadResource(_objectID, 0, byteSize);
+	}
+}
+#pragma endregion Main Function
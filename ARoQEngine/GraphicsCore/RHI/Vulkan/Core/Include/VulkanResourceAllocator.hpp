@@ -12,11 +12,12 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include <vulkan/vulkan.h>
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorAllocator.hpp"
 #include "GameUtility/Base/Include/GUClassUtility.hpp"
 #include <vector>
 #include <stdexcept>
 #include <cassert>
-#include <queue>
+#include <algorithm>
 #include <Windows.h>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -33,7 +34,8 @@ namespace rhi::vulkan
 	*				  			 ResourceAllocator
 	****************************************************************************/
 	/* @class     ResourceAllocator
-	*  @brief     Resource view index management
+	*  @brief     Resource view index management @n
+	*             CfbNX̔score::DescriptorIndexAllocatorōs܂.
 	*****************************************************************************/
 	class ResourceAllocator : public gu::NonCopyable
 	{
@@ -47,44 +49,35 @@ namespace rhi::vulkan
 		{
 			assert(("descriptor set is nullptr", descriptorSet));
 
-			if ((std::uint32_t)_currentID + 1 > _maxDescriptorCount) 
+			const auto id = _indexAllocator.Allocate();
+			if (id == core::DescriptorIndexAllocator::INVALID_INDEX) 
 			{
 				throw std::runtime_error("The number of IDs has exceeded the expected number. "); 
 			}
 
-			if (!_availableID.empty())
-			{
-				const auto id = _availableID.front();
-				_availableID.pop();
-				_descriptorSets[id] = descriptorSet;
-				return id;
-			}
-
-			_descriptorSets.emplace_back(std::move(descriptorSet));
-			_currentID++;
-			return _currentID;
+			_descriptorSets[id] = descriptorSet;
+			return id;
 		}
 
 		/* @brief : free descriptor set and push available id*/
 		inline void FreeID(const std::uint32_t id)
 		{
-			if (id >= _maxDescriptorCount) { OutputDebugStringA("Non available id"); return; }
+			if (!_indexAllocator.IsAllocated(id)) { OutputDebugStringA("Non available id"); return; }
 
 			_descriptorSets[id] = VK_NULL_HANDLE;
-			_availableID.push(id);
+			_indexAllocator.Free(id);
 		}
 
 		/* @brief: Back offset ID (The contents of the heap are not reset.)*/
 		inline void ResetID()
 		{
-			_descriptorSets.clear(); _descriptorSets.shrink_to_fit();
-			_currentID = INVALID_ID;
-			std::queue<std::uint32_t>().swap(_availableID); // ɂ
+			std::fill(_descriptorSets.begin(), _descriptorSets.end(), VK_NULL_HANDLE);
+			_indexAllocator.Reset();
 		}
 
 		inline VkDescriptorSet GetDescriptorSet(DescriptorID index = 0) 
 		{
-			if (_descriptorSets.empty()) { return VK_NULL_HANDLE; }
+			if (index >= _descriptorSets.size()) { return VK_NULL_HANDLE; }
 
 			return _descriptorSets[index]; 
 		}
@@ -96,13 +89,14 @@ namespace rhi::vulkan
 		{
 			_maxDescriptorCount = maxDescriptorCount;
 			_descriptorPool     = pool;
-			_currentID          = INVALID_ID;
+			_descriptorSets.assign(maxDescriptorCount, VK_NULL_HANDLE);
+			_indexAllocator.Resize(maxDescriptorCount);
 			ResetID();
 		}
 		inline void SetDescriptorPool(const VkDescriptorPool pool) { _descriptorPool = pool; }
 		
-		/* @brief: Return current descriptor index */
-		inline int GetCurrentID() const { return _currentID; }
+		/* @brief: Return allocated descriptor count */
+		inline std::uint32_t GetAllocatedCount() const { return _indexAllocator.GetAllocatedCount(); }
 
 		/* @brief : Return max descritor count*/
 		inline std::uint32_t GetMaxDescriptorCount() const { return _maxDescriptorCount; }
@@ -112,7 +106,7 @@ namespace rhi::vulkan
 		ResourceAllocator() = default;
 
 		explicit ResourceAllocator(const std::uint32_t maxDescriptorCount, const VkDescriptorPool descriptorPool) 
-			: _descriptorPool(descriptorPool), _maxDescriptorCount(maxDescriptorCount) {}
+			: _descriptorPool(descriptorPool), _descriptorSets(maxDescriptorCount, VK_NULL_HANDLE), _maxDescriptorCount(maxDescriptorCount), _indexAllocator(maxDescriptorCount) {}
 		
 		~ResourceAllocator()
 		{
@@ -133,11 +127,7 @@ namespace rhi::vulkan
 		
 		std::uint32_t _maxDescriptorCount = 0;
 
-		int _currentID = INVALID_ID;
-
-		std::queue<std::uint32_t> _availableID = {};
-
-		static constexpr int INVALID_ID = -1;
+		core::DescriptorIndexAllocator _indexAllocator = {};
 	};
 }
 #endif
\ No newline at end of file
@@ -89,6 +89,9 @@ void RHICommandList::BeginRecording(const bool stillMidFrame)
 	---------------------------------------------------------------------*/
 	if (vkBeginCommandBuffer(_commandBuffer, &commandBeginInfo) != VK_SUCCESS) { throw std::runtime_error("failed to begin command buffers\n"); }
 
+	_stateCache.Invalidate();
+	if (!stillMidFrame) { _stateCache.ResetStatistics(); }
+
 	_isOpen = true;
 }
 
@@ -171,15 +174,17 @@ void RHICommandList::EndRenderPass()
 *****************************************************************************/
 void RHICommandList::SetViewport(const core::Viewport* viewport, const std::uint32_t numViewport)
 {
+	if (!_stateCache.SetViewports(viewport, numViewport)) { return; }
+
 	gu::DynamicArray<VkViewport> v(numViewport);
 	for (std::uint32_t i = 0; i < numViewport; ++i)
 	{
-		v[i].x        = viewport->TopLeftX;
-		v[i].y        = viewport->TopLeftY;
-		v[i].width    = viewport->Width;
-		v[i].height   = viewport->Height;
-		v[i].maxDepth = viewport->MaxDepth;
-		v[i].minDepth = viewport->MinDepth;
+		v[i].x        = viewport[i].TopLeftX;
+		v[i].y        = viewport[i].TopLeftY;
+		v[i].width    = viewport[i].Width;
+		v[i].height   = viewport[i].Height;
+		v[i].maxDepth = viewport[i].MaxDepth;
+		v[i].minDepth = viewport[i].MinDepth;
  	}
 	vkCmdSetViewport(_commandBuffer, 0, numViewport, v.Data());
 }
@@ -194,13 +199,15 @@ void RHICommandList::SetViewport(const core::Viewport* viewport, const std::uint
 *****************************************************************************/
 void RHICommandList::SetScissor(const core::ScissorRect* rect, const std::uint32_t numRect)
 {
+	if (!_stateCache.SetScissors(rect, numRect)) { return; }
+
 	gu::DynamicArray<VkRect2D> r(numRect);
 	for (UINT i = 0; i < numRect; ++i)
 	{
-		r[i].offset.x      = rect->Left;
-		r[i].offset.y      = rect->Top;
-		r[i].extent.width  = rect->Right;
-		r[i].extent.height = rect->Bottom;
+		r[i].offset.x      = rect[i].Left;
+		r[i].offset.y      = rect[i].Top;
+		r[i].extent.width  = rect[i].Right;
+		r[i].extent.height = rect[i].Bottom;
 	}
 	vkCmdSetScissor(_commandBuffer, 0, numRect, r.Data());
 }
@@ -229,8 +236,8 @@ void RHICommandList::SetViewportAndScissor(const core::Viewport& viewport, const
 	r.extent.height = rect.Bottom;
 	r.offset.y      = rect.Top;
 
-	vkCmdSetViewport(_commandBuffer, 0, 1, &v);
-	vkCmdSetScissor (_commandBuffer, 0, 1, &r);
+	if (_stateCache.SetViewports(&viewport, 1)) { vkCmdSetViewport(_commandBuffer, 0, 1, &v); }
+	if (_stateCache.SetScissors (&rect, 1))     { vkCmdSetScissor (_commandBuffer, 0, 1, &r); }
 }
 
 #pragma region Graphics Command 
@@ -247,39 +254,57 @@ void RHICommandList::SetViewportAndScissor(const core::Viewport& viewport, const
 *****************************************************************************/
 void RHICommandList::SetPrimitiveTopology(const core::PrimitiveTopology topology)
 {
+	if (!_stateCache.SetPrimitiveTopology(topology)) { return; }
+
 	vkCmdSetPrimitiveTopology(_commandBuffer, EnumConverter::Convert(topology));
 }
 void RHICommandList::SetResourceLayout(const gu::SharedPointer<core::RHIResourceLayout>& resourceLayout)
 {
+	// lCeBu̖߂͖, ȍ~̃fBXNv^̐ݒŎQƂ邾̂ߏɕێ܂
 	_resourceLayout = gu::StaticPointerCast<vulkan::RHIResourceLayout>(resourceLayout);
 }
 void RHICommandList::SetGraphicsPipeline(const gu::SharedPointer<core::GPUGraphicsPipelineState>& pipelineState)
 {
-	vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, gu::StaticPointerCast<vulkan::GPUGraphicsPipelineState>(pipelineState)->GetPipeline());
+	const auto pipeline = gu::StaticPointerCast<vulkan::GPUGraphicsPipelineState>(pipelineState)->GetPipeline();
+	if (!_stateCache.SetObject(core::CommandStateType::GraphicsPipeline, (gu::uint64)pipeline)) { return; }
+
+	vkCmdBindPipeline(_commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
 }
 
 void RHICommandList::SetVertexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer)
 {
 	auto vkBuffer = gu::StaticPointerCast<vulkan::GPUBuffer>(buffer)->GetBuffer();
+
+	const core::CommandStateBufferView state = { (gu::uint64)vkBuffer, buffer->GetTotalByteSize(), static_cast<gu::uint32>(buffer->GetElementByteSize()) };
+	std::uint32_t changedStart = 0, changedCount = 0;
+	if (!_stateCache.SetVertexBuffers(&state, 1, 0, changedStart, changedCount)) { return; }
+
 	VkDeviceSize offsets[] = { 0 };
 	vkCmdBindVertexBuffers(_commandBuffer, 0, 1, &vkBuffer, offsets);
 }
 void RHICommandList::SetVertexBuffers(const gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>& buffers, const size_t startSlot)
 {
 	auto vkBuffers = gu::DynamicArray<VkBuffer>(buffers.Size());
-	auto offsets   = gu::DynamicArray<VkDeviceSize>(buffers.Size(), 0);
-
-	for (size_t i = 0; i < vkBuffers.Size(); ++i)
+	auto states    = gu::DynamicArray<core::CommandStateBufferView>(buffers.Size());
+	for (size_t i = 0; i < buffers.Size(); ++i)
 	{
 		vkBuffers[i] = gu::StaticPointerCast<vulkan::GPUBuffer>(buffers[i])->GetBuffer();
+		states[i]    = { (gu::uint64)vkBuffers[i], buffers[i]->GetTotalByteSize(), static_cast<gu::uint32>(buffers[i]->GetElementByteSize()) };
 	}
 
-	vkCmdBindVertexBuffers(_commandBuffer, static_cast<std::uint32_t>(startSlot), 
-		static_cast<std::uint32_t>(vkBuffers.Size()), vkBuffers.Data(), offsets.Data());
+	// O񂩂ςXbg͈݂̔͂̂1x̖߂Őݒ肵܂
+	std::uint32_t changedStart = 0, changedCount = 0;
+	if (!_stateCache.SetVertexBuffers(states.Data(), static_cast<std::uint32_t>(states.Size()), static_cast<std::uint32_t>(startSlot), changedStart, changedCount)) { return; }
+
+	const size_t offset  = changedStart - startSlot;
+	auto         offsets = gu::DynamicArray<VkDeviceSize>(changedCount, 0);
+
+	vkCmdBindVertexBuffers(_commandBuffer, changedStart, changedCount, vkBuffers.Data() + offset, offsets.Data());
 }
 void RHICommandList::SetIndexBuffer(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::PixelFormat indexType)
 {
 	const auto vkBuffer = gu::StaticPointerCast<vulkan::GPUBuffer>(buffer)->GetBuffer();
+	if (!_stateCache.SetIndexBuffer({ (gu::uint64)vkBuffer, buffer->GetTotalByteSize(), 0 }, indexType)) { return; }
 	vkCmdBindIndexBuffer(_commandBuffer, vkBuffer, 0, (VkIndexType)core::PixelFormatInfo::GetConst(indexType).PlatformFormat);
 }
 #pragma endregion Graphics Command
@@ -32,6 +32,7 @@
 #include "GraphicsCore/RHI/Vulkan/RayTracing/Include/VulkanRayTracingGeometry.hpp"
 #include "GameUtility/Math/Include/GMMatrix.hpp"
 #include "GameUtility/File/Include/UnicodeUtility.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
 #include <string>
 #include <stdexcept>
 #include <Windows.h>
@@ -149,6 +150,7 @@ gu::SharedPointer<core::RHICommandAllocator> RHIDevice::CreateCommandAllocator(c
 
 gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const core::DescriptorHeapType heapType, const size_t maxDescriptorCount)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	auto heapPtr = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<vulkan::RHIDescriptorHeap>(SharedFromThis()));
 	heapPtr->Resize(heapType, maxDescriptorCount);
 	return heapPtr;
@@ -156,6 +158,7 @@ gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const
 
 gu::SharedPointer<core::RHIDescriptorHeap> RHIDevice::CreateDescriptorHeap(const gu::SortedMap<core::DescriptorHeapType, size_t>& heapInfo)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	auto heapPtr = gu::StaticPointerCast<core::RHIDescriptorHeap>(gu::MakeShared<vulkan::RHIDescriptorHeap>(SharedFromThis()));
 	heapPtr->Resize(heapInfo);
 	return heapPtr;
@@ -206,16 +209,19 @@ gu::SharedPointer<core::GPUResourceView> RHIDevice::CreateResourceView(const cor
 
 gu::SharedPointer<core::GPUBuffer>  RHIDevice::CreateBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	return gu::StaticPointerCast<core::GPUBuffer>(gu::MakeShared<vulkan::GPUBuffer>(SharedFromThis(), metaData));
 }
 
 gu::SharedPointer<core::GPUTexture> RHIDevice::CreateTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name)
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	return gu::StaticPointerCast<core::GPUTexture>(gu::MakeShared<vulkan::GPUTexture>(SharedFromThis(), metaData));
 }
 
 gu::SharedPointer<core::GPUTexture> RHIDevice::CreateTextureEmpty()
 {
+	MEMORY_TAG_SCOPE(gu::MemoryTag::Graphics);
 	return gu::StaticPointerCast<core::GPUTexture>(gu::MakeShared<vulkan::GPUTexture>(SharedFromThis()));
 }
 
@@ -0,0 +1,309 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraph.hpp
+///  @brief  pX̓ǂݏ̐錾oAƈꎞ\[XŊǗ郌_[Otł. @n
+///          t[ Reset -> Create/Import -> AddPass -> Compile -> Execute ̏Ɏgp܂.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RENDER_GRAPH_HPP
+#define RENDER_GRAPH_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "RenderGraphCore.hpp"
+#include "RenderGraphResourcePool.hpp"
+#include <functional>
+#include <mutex>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+namespace rhi::core
+{
+	class RHICommandList;
+	class GPUResource;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::graph
+{
+	class RenderGraph;
+
+	/****************************************************************************
+	*				  			RenderGraphContext
+	****************************************************************************/
+	/* @brief  pX̋L^ɓnł. nhۂGPU\[X܂.
+	*****************************************************************************/
+	class RenderGraphContext
+	{
+	public:
+		#pragma region Public Property
+		/*! @brief pXL^R}hXg*/
+		__forceinline const gu::SharedPointer<core::RHICommandList>& GetCommandList() const noexcept { return _commandList; }
+
+		/*! @brief nhweNX`*/
+		gu::SharedPointer<core::GPUTexture> GetTexture(const TextureHandle handle) const;
+
+		/*! @brief nhwobt@*/
+		gu::SharedPointer<core::GPUBuffer> GetBuffer(const BufferHandle handle) const;
+
+		/*! @brief ꎞeNX`̃r[. O\[X̃r[͌ĂяoŊǗĂ.*/
+		gu::SharedPointer<core::GPUResourceView> GetTextureView(const TextureHandle handle, const core::ResourceViewType viewType) const;
+
+		/*! @brief ꎞobt@̃r[. O\[X̃r[͌ĂяoŊǗĂ.*/
+		gu::SharedPointer<core::GPUResourceView> GetBufferView(const BufferHandle handle, const core::ResourceViewType viewType) const;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief OtƋL^̃R}hXgw肵č쐬܂*/
+		RenderGraphContext(RenderGraph* graph, const gu::SharedPointer<core::RHICommandList>& commandList) : _graph(graph), _commandList(commandList) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief s̃Ot*/
+		RenderGraph* _graph = nullptr;
+
+		/*! @brief L^̃R}hXg*/
+		gu::SharedPointer<core::RHICommandList> _commandList = nullptr;
+		#pragma endregion
+	};
+
+	/*! @brief pX̋L^֐*/
+	using RenderGraphExecuteFunction = std::function<void(const RenderGraphContext&)>;
+
+	/****************************************************************************
+	*				  			RenderGraphPassBuilder
+	****************************************************************************/
+	/* @brief  AddPassŕԂ, pXǂݏ郊\[XƂ̏Ԃ錾܂.
+	*****************************************************************************/
+	class RenderGraphPassBuilder
+	{
+	public:
+		#pragma region Public Function
+		/*! @brief eNX`w̏Ԃœǂݍ݂܂*/
+		RenderGraphPassBuilder& Read(const TextureHandle handle, const core::ResourceState state) { AddAccess(handle.Index, state, true, false); return *this; }
+
+		/*! @brief eNX`w̏Ԃŏ݂܂. ȑO̓e͎gp܂.*/
+		RenderGraphPassBuilder& Write(const TextureHandle handle, const core::ResourceState state) { AddAccess(handle.Index, state, false, true); return *this; }
+
+		/*! @brief eNX`̈ȑO̓eǂ񂾏ŏ݂܂ (UAV̉Z, RenderTargetLoadȂ)*/
+		RenderGraphPassBuilder& ReadWrite(const TextureHandle handle, const core::ResourceState state) { AddAccess(handle.Index, state, true, true); return *this; }
+
+		/*! @brief obt@w̏Ԃœǂݍ݂܂*/
+		RenderGraphPassBuilder& Read(const BufferHandle handle, const core::ResourceState state) { AddAccess(handle.Index, state, true, false); return *this; }
+
+		/*! @brief obt@w̏Ԃŏ݂܂. ȑO̓e͎gp܂.*/
+		RenderGraphPassBuilder& Write(const BufferHandle handle, const core::ResourceState state) { AddAccess(handle.Index, state, false, true); return *this; }
+
+		/*! @brief obt@̈ȑO̓eǂ񂾏ŏ݂܂*/
+		RenderGraphPassBuilder& ReadWrite(const BufferHandle handle, const core::ResourceState state) { AddAccess(handle.Index, state, true, true); return *this; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief OtƃpX̔ԍw肵č쐬܂*/
+		RenderGraphPassBuilder(RenderGraph* graph, const gu::uint32 passIndex) : _graph(graph), _passIndex(passIndex) {};
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief ANZXǉ܂. \[X𕡐錾ꍇ͓ǂݏ킹܂.*/
+		void AddAccess(const gu::uint32 resource, const core::ResourceState state, const bool isRead, const bool isWrite);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief 錾̃Ot*/
+		RenderGraph* _graph = nullptr;
+
+		/*! @brief 錾̃pX*/
+		gu::uint32 _passIndex = INVALID_INDEX;
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			RenderGraphExecuteDesc
+	****************************************************************************/
+	/* @brief  _[Ot̎s@ł.
+	*****************************************************************************/
+	struct RenderGraphExecuteDesc
+	{
+		/*! @brief ŏɋL^R}hXg (L^łKv܂)*/
+		gu::SharedPointer<core::RHICommandList> CommandList = nullptr;
+
+		/*! @brief L^p̋L^̃R}hXgԂ֐. nullptȑꍇ͑SẴpXCommandList֒ɋL^܂.*/
+		std::function<gu::SharedPointer<core::RHICommandList>()> AcquireCommandList = nullptr;
+
+		/*! @brief L^ɎgpXbhv[. nullptȑꍇ͌ĂяõXbhŏɋL^܂.*/
+		gu::ThreadPool* ThreadPool = nullptr;
+	};
+
+	/****************************************************************************
+	*				  			RenderGraph
+	****************************************************************************/
+	/* @brief  pX錾ǂݏRenderGraphCompilerŃoAƈꎞ\[X̔zu, L^܂. @n
+	*          ꎞ\[X̎̂RenderGraphResourcePoolt[܂ōėp܂. @n
+	*          L^ob`͕ʁX̃R}hXgɂȂ邽, ExecuteԂŕĎsĂ.
+	*****************************************************************************/
+	class RenderGraph : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     Otł̂ݎgpꎞeNX`錾܂. ̂Execute̒OɊ蓖Ă܂.
+		*  @param[in] const gu::tstring& fobO
+		*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+		*  @return    TextureHandle nh
+		*************************************************************************/
+		TextureHandle CreateTexture(const gu::tstring& name, const core::GPUTextureMetaData& metaData);
+
+		/*!**********************************************************************
+		*  @brief     Otł̂ݎgpꎞobt@錾܂. ̂Execute̒OɊ蓖Ă܂.
+		*  @param[in] const gu::tstring& fobO
+		*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+		*  @return    BufferHandle nh
+		*************************************************************************/
+		BufferHandle CreateBuffer(const gu::tstring& name, const core::GPUBufferMetaData& metaData);
+
+		/*!**********************************************************************
+		*  @brief     Ot̊Oō쐬eNX`o^܂. ݂̏ԂJڂn, ȈԂ͍ŌɎgpԂ̂܂܂ł. @n
+		*             o^ς݂̃eNX`nꍇ͊̃nhԂ܂.
+		*  @param[in] const gu::tstring& fobO
+		*  @param[in] const gu::SharedPointer<core::GPUTexture>& eNX`
+		*  @return    TextureHandle nh
+		*************************************************************************/
+		TextureHandle ImportTexture(const gu::tstring& name, const gu::SharedPointer<core::GPUTexture>& texture);
+
+		/*!**********************************************************************
+		*  @brief     Ot̊Oō쐬eNX`o^, OtIɎw̏Ԃ֖߂܂.
+		*  @param[in] const gu::tstring& fobO
+		*  @param[in] const gu::SharedPointer<core::GPUTexture>& eNX`
+		*  @param[in] const core::ResourceState OtȈ
+		*  @return    TextureHandle nh
+		*************************************************************************/
+		TextureHandle ImportTexture(const gu::tstring& name, const gu::SharedPointer<core::GPUTexture>& texture, const core::ResourceState finalState);
+
+		/*!**********************************************************************
+		*  @brief     Ot̊Oō쐬obt@o^܂. ݂̏ԂJڂn, ȈԂ͍ŌɎgpԂ̂܂܂ł.
+		*  @param[in] const gu::tstring& fobO
+		*  @param[in] const gu::SharedPointer<core::GPUBuffer>& obt@
+		*  @return    BufferHandle nh
+		*************************************************************************/
+		BufferHandle ImportBuffer(const gu::tstring& name, const gu::SharedPointer<core::GPUBuffer>& buffer);
+
+		/*!**********************************************************************
+		*  @brief     pXǉ܂. L^֐ExecuteɌĂ΂, JOꂽꍇ͌Ă΂܂.
+		*  @param[in] const gu::tstring& fobO
+		*  @param[in] const PassFlags pẌ
+		*  @param[in] const RenderGraphExecuteFunction& L^֐
+		*  @return    RenderGraphPassBuilder ǂݏ̐錾Ɏgp܂
+		*************************************************************************/
+		RenderGraphPassBuilder AddPass(const gu::tstring& name, const PassFlags flags, const RenderGraphExecuteFunction& function);
+
+		/*!**********************************************************************
+		*  @brief     錾ꂽpXƃ\[XRpC܂.
+		*  @param[in] void
+		*  @return    const CompiledRenderGraph& RpC
+		*************************************************************************/
+		const CompiledRenderGraph& Compile();
+
+		/*!**********************************************************************
+		*  @brief     ꎞ\[X̎̂蓖, oAƃpXL^܂.
+		*  @param[in] const RenderGraphExecuteDesc& s@
+		*  @return    gu::DynamicArray<gu::SharedPointer<core::RHICommandList>> L^R}hXgsɕׂ (擪desc.CommandList)
+		*************************************************************************/
+		gu::DynamicArray<gu::SharedPointer<core::RHICommandList>> Execute(const RenderGraphExecuteDesc& desc);
+
+		/*!**********************************************************************
+		*  @brief     錾pXƃ\[Xj, ̃t[̐錾󂯕t܂. ꎞ\[X̎̂̓v[ɖ߂܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Reset();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ÕRpC*/
+		__forceinline const CompiledRenderGraph& GetCompiledGraph() const noexcept { return _compiled; }
+
+		/*! @brief ÕRpCʂ̓v*/
+		__forceinline const RenderGraphStatistics& GetStatistics() const noexcept { return _compiled.Statistics; }
+
+		/*! @brief 錾ꂽ\[X*/
+		__forceinline const gu::DynamicArray<ResourceDesc>& GetResourceDescs() const noexcept { return _resources; }
+
+		/*! @brief 錾ꂽpX*/
+		__forceinline const gu::DynamicArray<PassDesc>& GetPassDescs() const noexcept { return _passes; }
+
+		/*! @brief ꎞ\[X̃v[*/
+		__forceinline const RenderGraphResourcePool& GetResourcePool() const noexcept { return _resourcePool; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RenderGraph() = default;
+
+		/*! @brief fXgN^*/
+		~RenderGraph() = default;
+
+		/*! @brief _foCXgč쐬܂*/
+		explicit RenderGraph(const gu::SharedPointer<core::RHIDevice>& device);
+		#pragma endregion
+
+	protected:
+		friend class RenderGraphContext;
+		friend class RenderGraphPassBuilder;
+
+		#pragma region Protected Function
+		/*! @brief ꎞ\[Xփv[̎̂蓖Ă܂*/
+		void RealizeResources();
+
+		/*! @brief oAL^܂. ۂ̏ԂJڌƓ̂͏Ȃ܂.*/
+		void RecordBarriers(const gu::SharedPointer<core::RHICommandList>& commandList, const CompiledBarrier* barriers, const gu::uint32 barrierCount);
+
+		/*! @brief z\[Xw*/
+		gu::SharedPointer<core::GPUResource> GetResource(const gu::uint32 resource) const;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief _foCX*/
+		gu::SharedPointer<core::RHIDevice> _device = nullptr;
+
+		/*! @brief ꎞ\[X̃v[*/
+		RenderGraphResourcePool _resourcePool = {};
+
+		/*! @brief 錾ꂽ\[X*/
+		gu::DynamicArray<ResourceDesc> _resources = {};
+
+		/*! @brief 錾ꂽpX*/
+		gu::DynamicArray<PassDesc> _passes = {};
+
+		/*! @brief pXƂ̋L^֐*/
+		gu::DynamicArray<RenderGraphExecuteFunction> _executeFunctions = {};
+
+		/*! @brief z\[XƂ̃eNX`̎*/
+		gu::DynamicArray<gu::SharedPointer<core::GPUTexture>> _textures = {};
+
+		/*! @brief z\[XƂ̃obt@̎*/
+		gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>> _buffers = {};
+
+		/*! @brief ÕRpC*/
+		CompiledRenderGraph _compiled = {};
+
+		/*! @brief ݂̐錾RpCς݂*/
+		bool _isCompiled = false;
+
+		/*! @brief L^̃r[쐬ی삵܂*/
+		std::mutex _viewMutex;
+		#pragma endregion
+	};
+}
+#endif
@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraphCompiler.hpp
+///  @brief  pXƃ\[X̋Lq, JO, vZ, ꎞ\[X̕ʖ蓖, oÃob`s܂.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RENDER_GRAPH_COMPILER_HPP
+#define RENDER_GRAPH_COMPILER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "RenderGraphCore.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::graph
+{
+	/****************************************************************************
+	*				  			RenderGraphCompiler
+	****************************************************************************/
+	/* @brief  _[Ot̃RpCł. GPU\[XfoCXɂ͐GȂ, CPÛ݂Ōʂ؂ł܂. @n
+	*          1. O\[Xւ݂̏NeverCull̃pXtɂǂ, o͂Ɋ^ȂpX폜܂ @n
+	*          2. 錾ۂ܂, ݂ɋȂL^\ȃpX1̃ob`ɂ܂Ƃ߂܂ @n
+	*          3. ob`Pʂňꎞ\[X̎, dȂ炸݊̂ꎞ\[X֓̂蓖Ă܂ @n
+	*          4. ̂ƂɏԂǐՂ, Ԃςꍇ̂݃ob`̐擪ł܂Ƃ߂ăoA𔭍s܂
+	*****************************************************************************/
+	class RenderGraphCompiler
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     pXƃ\[X̋Lq烌_[OtRpC܂.
+		*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+		*  @param[in] const gu::DynamicArray<PassDesc>& 錾ɕ񂾃pX̋Lq
+		*  @return    CompiledRenderGraph RpC
+		*************************************************************************/
+		static CompiledRenderGraph Compile(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes);
+
+		/*!**********************************************************************
+		*  @brief     eNX`̐oCgTCYԂ܂. SẴ~bvƔzvf܂݂܂.
+		*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+		*  @return    gu::uint64 oCgTCY
+		*************************************************************************/
+		static gu::uint64 GetTextureByteSize(const core::GPUTextureMetaData& metaData);
+
+		/*!**********************************************************************
+		*  @brief     2̃eNX`̍쐬񂪓̂Lł邩Ԃ܂. gp@̈Ⴂ͋e܂.
+		*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+		*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+		*  @return    bool Lłꍇtrue
+		*************************************************************************/
+		static bool IsAliasable(const core::GPUTextureMetaData& left, const core::GPUTextureMetaData& right);
+
+		/*!**********************************************************************
+		*  @brief     2̃obt@̍쐬񂪓̂Lł邩Ԃ܂. gp@̈Ⴂ͋e܂.
+		*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+		*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+		*  @return    bool Lłꍇtrue
+		*************************************************************************/
+		static bool IsAliasable(const core::GPUBufferMetaData& left, const core::GPUBufferMetaData& right);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief o͂Ɋ^ȂpX폜܂*/
+		static void CullPasses(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result);
+
+		/*! @brief ĂpXob`ɂ܂Ƃ, z\[X̎߂܂*/
+		static void BuildBatches(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result);
+
+		/*! @brief ̏dȂȂꎞ\[X֓̂蓖Ă܂*/
+		static void AssignPhysicalResources(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result);
+
+		/*! @brief ̂ƂɏԂǐՂ, ob`Ƃ̃oA쐬܂*/
+		static void BuildBarriers(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result);
+
+		/*! @brief JOƃob`Ȃꍇ̃oAς܂*/
+		static void CountNaiveBarriers(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result);
+		#pragma endregion
+	};
+}
+#endif
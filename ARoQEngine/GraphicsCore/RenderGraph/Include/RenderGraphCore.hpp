@@ -0,0 +1,303 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraphCore.hpp
+///  @brief  _[OtŎgpnh, pXƃ\[X̋Lq, RpCʂ`܂.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RENDER_GRAPH_CORE_HPP
+#define RENDER_GRAPH_CORE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommonState.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Base/Include/GUString.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::graph
+{
+	/*! @brief ȃCfbNX*/
+	constexpr gu::uint32 INVALID_INDEX = 0xffffffff;
+
+	/****************************************************************************
+	*				  			ResourceKind
+	****************************************************************************/
+	/* @brief  _[Ot\[X̎
+	*****************************************************************************/
+	enum class ResourceKind : gu::uint8
+	{
+		Texture, //!< eNX`
+		Buffer   //!< obt@
+	};
+
+	/****************************************************************************
+	*				  			PassFlags
+	****************************************************************************/
+	/* @brief  pẌw肷tO
+	*****************************************************************************/
+	enum class PassFlags : gu::uint8
+	{
+		None                   = 0,
+		NeverCull              = 1 << 0, //!< o͂gȂĂ폜܂ (Present, ǂݖ߂Ȃ)
+		AllowParallelRecording = 1 << 1, //!< ˑ̂ȂאڃpXƕʁX̃R}hXg֕ɋL^ł܂
+	};
+
+	ENUM_CLASS_FLAGS(PassFlags);
+
+	/****************************************************************************
+	*				  			TextureHandle
+	****************************************************************************/
+	/* @brief  _[Ot̃eNX`wnh. OtResetƖɂȂ܂.
+	*****************************************************************************/
+	struct TextureHandle
+	{
+		/*! @brief Ot̃\[Xԍ*/
+		gu::uint32 Index = INVALID_INDEX;
+
+		/*! @brief LȃnhԂ܂*/
+		__forceinline bool IsValid() const noexcept { return Index != INVALID_INDEX; }
+	};
+
+	/****************************************************************************
+	*				  			BufferHandle
+	****************************************************************************/
+	/* @brief  _[Ot̃obt@wnh. OtResetƖɂȂ܂.
+	*****************************************************************************/
+	struct BufferHandle
+	{
+		/*! @brief Ot̃\[Xԍ*/
+		gu::uint32 Index = INVALID_INDEX;
+
+		/*! @brief LȃnhԂ܂*/
+		__forceinline bool IsValid() const noexcept { return Index != INVALID_INDEX; }
+	};
+
+	/****************************************************************************
+	*				  			ResourceDesc
+	****************************************************************************/
+	/* @brief  RpC֓n\[X̋Lqł. GPU\[X͎Ȃ, CPÛ݂ŃRpCł܂.
+	*****************************************************************************/
+	struct ResourceDesc
+	{
+		/*! @brief fobOp̖O*/
+		gu::tstring Name = SP("");
+
+		/*! @brief \[X̎*/
+		ResourceKind Kind = ResourceKind::Texture;
+
+		/*! @brief Kind == TexturȅꍇɎgp쐬*/
+		core::GPUTextureMetaData TextureDesc = {};
+
+		/*! @brief Kind == BuffeȑꍇɎgp쐬*/
+		core::GPUBufferMetaData BufferDesc = {};
+
+		/*! @brief Ot̊Oō쐬ꂽ\[X. O\[Xւ݂̏̓Ot̏o͂ƂĈ, ʖ蓖Ă̑ΏۂɂȂ܂.*/
+		bool IsImported = false;
+
+		/*! @brief OtJn̏ (O\[X̂ݎgp܂)*/
+		core::ResourceState InitialState = core::ResourceState::Common;
+
+		/*! @brief OtIɖ߂Ԃ (O\[X̂ݎgp܂)*/
+		bool HasFinalState = false;
+
+		/*! @brief OtIɖ߂*/
+		core::ResourceState FinalState = core::ResourceState::Common;
+	};
+
+	/****************************************************************************
+	*				  			ResourceAccess
+	****************************************************************************/
+	/* @brief  pX1̃\[Xǂ̏Ԃœǂݏ邩܂.
+	*****************************************************************************/
+	struct ResourceAccess
+	{
+		/*! @brief Ot̃\[Xԍ*/
+		gu::uint32 Resource = INVALID_INDEX;
+
+		/*! @brief pX̎sɕKvȃ\[X̏*/
+		core::ResourceState State = core::ResourceState::Common;
+
+		/*! @brief ȑO̓eǂݍނ*/
+		bool IsRead = false;
+
+		/*! @brief eނ*/
+		bool IsWrite = false;
+	};
+
+	/****************************************************************************
+	*				  			PassDesc
+	****************************************************************************/
+	/* @brief  RpC֓npX̋Lqł. 錾̂܂܋L^ɂȂ܂.
+	*****************************************************************************/
+	struct PassDesc
+	{
+		/*! @brief fobOp̖O*/
+		gu::tstring Name = SP("");
+
+		/*! @brief pẌ*/
+		PassFlags Flags = PassFlags::None;
+
+		/*! @brief ǂݏ郊\[X (1̃\[X1x錾܂)*/
+		gu::DynamicArray<ResourceAccess> Accesses = {};
+	};
+
+	/****************************************************************************
+	*				  			BarrierType
+	****************************************************************************/
+	/* @brief  RpCsoA̎
+	*****************************************************************************/
+	enum class BarrierType : gu::uint8
+	{
+		Transition,   //!< ԑJ
+		UnorderedAccess //!< UAV̏ݓm̊҂
+	};
+
+	/****************************************************************************
+	*				  			CompiledBarrier
+	****************************************************************************/
+	/* @brief  ob`̑OɔsoAł. \[X͉z\[X̔ԍ, ̂PhysicalIndexň܂.
+	*****************************************************************************/
+	struct CompiledBarrier
+	{
+		/*! @brief oA̎*/
+		BarrierType Type = BarrierType::Transition;
+
+		/*! @brief ̏ԑJڂŏ߂Ďg\[X (oẢz\[X)*/
+		gu::uint32 Resource = INVALID_INDEX;
+
+		/*! @brief RpCz肷JڑȌ*/
+		core::ResourceState Before = core::ResourceState::Common;
+
+		/*! @brief Jڌ̏*/
+		core::ResourceState After = core::ResourceState::Common;
+	};
+
+	/****************************************************************************
+	*				  			CompiledBatch
+	****************************************************************************/
+	/* @brief  1FlushResourceBarriers, ̌ɑċL^pX͈̔͂ł. @n
+	*          ̃pXob`݂͌ɈˑȂ, ɋL^ł܂.
+	*****************************************************************************/
+	struct CompiledBatch
+	{
+		/*! @brief CompiledRenderGraph::PassOrder̊Jnʒu*/
+		gu::uint32 PassOffset = 0;
+
+		/*! @brief ob`̃pX*/
+		gu::uint32 PassCount = 0;
+
+		/*! @brief CompiledRenderGraph::Barriers̊Jnʒu*/
+		gu::uint32 BarrierOffset = 0;
+
+		/*! @brief ob`̑OɔsoA̐*/
+		gu::uint32 BarrierCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			PhysicalResourceDesc
+	****************************************************************************/
+	/* @brief  ̏dȂȂꎞ\[XL̂̋Lqł.
+	*****************************************************************************/
+	struct PhysicalResourceDesc
+	{
+		/*! @brief \[X̎*/
+		ResourceKind Kind = ResourceKind::Texture;
+
+		/*! @brief LSẲz\[X̎gp@킹eNX`̍쐬*/
+		core::GPUTextureMetaData TextureDesc = {};
+
+		/*! @brief LSẲz\[X̎gp@킹obt@̍쐬*/
+		core::GPUBufferMetaData BufferDesc = {};
+
+		/*! @brief oCgTCY*/
+		gu::uint64 ByteSize = 0;
+
+		/*! @brief ̎̂L鉼z\[X̐*/
+		gu::uint32 AliasCount = 0;
+	};
+
+	/****************************************************************************
+	*				  			RenderGraphStatistics
+	****************************************************************************/
+	/* @brief  RpCʂ̓vł. Naiven̒l, JOƃob`ɊepXʂɑJڂꍇ̌ςł.
+	*****************************************************************************/
+	struct RenderGraphStatistics
+	{
+		/*! @brief 錾ꂽpX*/
+		gu::uint32 PassCount = 0;
+
+		/*! @brief o͂Ɋ^Ȃߍ폜pX*/
+		gu::uint32 CulledPassCount = 0;
+
+		/*! @brief soA̐ (JڑOƑJڌオ̂͐܂)*/
+		gu::uint32 BarrierCount = 0;
+
+		/*! @brief FlushResourceBarriers̉*/
+		gu::uint32 BarrierBatchCount = 0;
+
+		/*! @brief epXʂɑJڂꍇ̃oA*/
+		gu::uint32 NaiveBarrierCount = 0;
+
+		/*! @brief epXʂɑJڂꍇFlushResourceBarriers̉*/
+		gu::uint32 NaiveBarrierBatchCount = 0;
+
+		/*! @brief ɋL^łob`*/
+		gu::uint32 ParallelBatchCount = 0;
+
+		/*! @brief gpꎞ\[X̐oCgTCY̍v*/
+		gu::uint64 TransientByteSize = 0;
+
+		/*! @brief ʖ蓖ČɎۂɊmۂ鐄oCgTCY*/
+		gu::uint64 AllocatedTransientByteSize = 0;
+
+		/*! @brief ʖ蓖ĂŐߖ񂵂oCgTCY*/
+		__forceinline gu::uint64 GetSavedTransientByteSize() const noexcept { return TransientByteSize - AllocatedTransientByteSize; }
+	};
+
+	/****************************************************************************
+	*				  			CompiledRenderGraph
+	****************************************************************************/
+	/* @brief  RpC̏o͂ł. sBatchesɏ, ŌFinalBarriers𔭍s܂.
+	*****************************************************************************/
+	struct CompiledRenderGraph
+	{
+		/*! @brief L^pX̔ԍL^ɕׂ (JOꂽpX͊܂݂܂)*/
+		gu::DynamicArray<gu::uint32> PassOrder = {};
+
+		/*! @brief oAƃpX̂܂Ƃ܂*/
+		gu::DynamicArray<CompiledBatch> Batches = {};
+
+		/*! @brief SẴob`̃oA*/
+		gu::DynamicArray<CompiledBarrier> Barriers = {};
+
+		/*! @brief OtIɊO\[Xw̏Ԃ֖߂oA*/
+		gu::DynamicArray<CompiledBarrier> FinalBarriers = {};
+
+		/*! @brief pXƂ̐tO*/
+		gu::DynamicArray<bool> IsPassAlive = {};
+
+		/*! @brief z\[XƂ̎̔ԍ. O\[XƖgp̃\[XINVALID_INDEXł.*/
+		gu::DynamicArray<gu::uint32> PhysicalIndex = {};
+
+		/*! @brief z\[XƂ̍ŏɎgpob`ԍ*/
+		gu::DynamicArray<gu::uint32> FirstBatch = {};
+
+		/*! @brief z\[XƂ̍ŌɎgpob`ԍ*/
+		gu::DynamicArray<gu::uint32> LastBatch = {};
+
+		/*! @brief ꎞ\[X̎*/
+		gu::DynamicArray<PhysicalResourceDesc> PhysicalResources = {};
+
+		/*! @brief v*/
+		RenderGraphStatistics Statistics = {};
+	};
+}
+#endif
@@ -0,0 +1,159 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraphResourcePool.hpp
+///  @brief  _[Oẗꎞ\[X̎̂t[܂ōėpv[ł.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef RENDER_GRAPH_RESOURCE_POOL_HPP
+#define RENDER_GRAPH_RESOURCE_POOL_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "RenderGraphCore.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUSmartPointer.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::core
+{
+	class RHIDevice;
+	class GPUTexture;
+	class GPUBuffer;
+	class GPUResourceView;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                         Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace rhi::graph
+{
+	/****************************************************************************
+	*				  			RenderGraphResourcePool
+	****************************************************************************/
+	/* @brief  RpC߂̂̍쐬ƈvGPU\[X, gpłȂ݂̂o܂. @n
+	*          t[gȂ\[XEndFrameŔj܂. r[̓\[XƂɎޕʂŃLbV܂.
+	*****************************************************************************/
+	class RenderGraphResourcePool : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     쐬ƈv関gp̃eNX`Ԃ܂. Ȃꍇ͐V쐬܂.
+		*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+		*  @param[in] const gu::tstring& V쐬ꍇ̃fobO
+		*  @return    gu::SharedPointer<core::GPUTexture> eNX`
+		*************************************************************************/
+		gu::SharedPointer<core::GPUTexture> AcquireTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name);
+
+		/*!**********************************************************************
+		*  @brief     쐬ƈv関gp̃obt@Ԃ܂. Ȃꍇ͐V쐬܂.
+		*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+		*  @param[in] const gu::tstring& V쐬ꍇ̃fobO
+		*  @return    gu::SharedPointer<core::GPUBuffer> obt@
+		*************************************************************************/
+		gu::SharedPointer<core::GPUBuffer> AcquireBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name);
+
+		/*!**********************************************************************
+		*  @brief     v[݂oeNX`̃r[Ԃ܂. ނ̃r[1x쐬܂.
+		*  @param[in] const gu::SharedPointer<core::GPUTexture>& AcquireTextureŎ擾eNX`
+		*  @param[in] const core::ResourceViewType r[̎
+		*  @return    gu::SharedPointer<core::GPUResourceView> r[
+		*************************************************************************/
+		gu::SharedPointer<core::GPUResourceView> GetTextureView(const gu::SharedPointer<core::GPUTexture>& texture, const core::ResourceViewType viewType);
+
+		/*!**********************************************************************
+		*  @brief     v[݂oobt@̃r[Ԃ܂. ނ̃r[1x쐬܂.
+		*  @param[in] const gu::SharedPointer<core::GPUBuffer>& AcquireBufferŎ擾obt@
+		*  @param[in] const core::ResourceViewType r[̎
+		*  @return    gu::SharedPointer<core::GPUResourceView> r[
+		*************************************************************************/
+		gu::SharedPointer<core::GPUResourceView> GetBufferView(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::ResourceViewType viewType);
+
+		/*!**********************************************************************
+		*  @brief     SẴ\[X𖢎gpɖ߂, MAX_UNUSED_FRAME_COUNT蒷gĂȂ\[Xj܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void EndFrame();
+
+		/*!**********************************************************************
+		*  @brief     SẴ\[Xj܂. GPUgpĂȂƂĂяoŕۏ؂Ă.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief j܂łɑ҂gpt[. `撆̃t[QƂ郊\[XjȂ悤, t[obt@傫܂*/
+		static constexpr gu::uint64 MAX_UNUSED_FRAME_COUNT = 8;
+
+		/*! @brief v[ێĂ郊\[X̐oCgTCY*/
+		__forceinline gu::uint64 GetPooledByteSize() const noexcept { return _pooledByteSize; }
+
+		/*! @brief v[ێĂ郊\[X*/
+		__forceinline gu::uint64 GetPooledResourceCount() const noexcept { return _textures.Size() + _buffers.Size(); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		/*! @brief ftHgRXgN^*/
+		RenderGraphResourcePool() = default;
+
+		/*! @brief fXgN^*/
+		~RenderGraphResourcePool();
+
+		/*! @brief _foCXgč쐬܂*/
+		explicit RenderGraphResourcePool(const gu::SharedPointer<core::RHIDevice>& device);
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Property
+		/*! @brief ނƂɃLbVr[*/
+		struct ViewEntry
+		{
+			core::ResourceViewType                   Type = core::ResourceViewType::Unknown;
+			gu::SharedPointer<core::GPUResourceView> View = nullptr;
+		};
+
+		/*! @brief v[ێeNX`*/
+		struct TextureEntry
+		{
+			gu::SharedPointer<core::GPUTexture> Texture       = nullptr;
+			core::GPUTextureMetaData            MetaData      = {};
+			gu::DynamicArray<ViewEntry>         Views         = {};
+			gu::uint64                          LastUsedFrame = 0;
+			bool                                IsInUse       = false;
+		};
+
+		/*! @brief v[ێobt@*/
+		struct BufferEntry
+		{
+			gu::SharedPointer<core::GPUBuffer> Buffer        = nullptr;
+			core::GPUBufferMetaData            MetaData      = {};
+			gu::DynamicArray<ViewEntry>        Views         = {};
+			gu::uint64                         LastUsedFrame = 0;
+			bool                               IsInUse       = false;
+		};
+
+		/*! @brief _foCX*/
+		gu::SharedPointer<core::RHIDevice> _device = nullptr;
+
+		/*! @brief eNX`*/
+		gu::DynamicArray<TextureEntry> _textures = {};
+
+		/*! @brief obt@*/
+		gu::DynamicArray<BufferEntry> _buffers = {};
+
+		/*! @brief EndFrameĂ񂾉*/
+		gu::uint64 _frameCount = 0;
+
+		/*! @brief ێĂ郊\[X̐oCgTCY*/
+		gu::uint64 _pooledByteSize = 0;
+		#pragma endregion
+	};
+}
+#endif
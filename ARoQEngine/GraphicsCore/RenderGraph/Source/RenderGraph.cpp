@@ -0,0 +1,429 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraph.cpp
+///  @brief  pX̓ǂݏ̐錾oAƈꎞ\[XŊǗ郌_[Otł.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/RenderGraph.hpp"
+#include "../Include/RenderGraphCompiler.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandList.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include <future>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::graph;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Context
+gu::SharedPointer<core::GPUTexture> RenderGraphContext::GetTexture(const TextureHandle handle) const
+{
+	Checkf(handle.IsValid() && _graph->_resources[handle.Index].Kind == ResourceKind::Texture, "handle is not texture.");
+	return _graph->_textures[handle.Index];
+}
+
+gu::SharedPointer<core::GPUBuffer> RenderGraphContext::GetBuffer(const BufferHandle handle) const
+{
+	Checkf(handle.IsValid() && _graph->_resources[handle.Index].Kind == ResourceKind::Buffer, "handle is not buffer.");
+	return _graph->_buffers[handle.Index];
+}
+
+gu::SharedPointer<core::GPUResourceView> RenderGraphContext::GetTextureView(const TextureHandle handle, const core::ResourceViewType viewType) const
+{
+	std::scoped_lock lock(_graph->_viewMutex);
+	return _graph->_resourcePool.GetTextureView(GetTexture(handle), viewType);
+}
+
+gu::SharedPointer<core::GPUResourceView> RenderGraphContext::GetBufferView(const BufferHandle handle, const core::ResourceViewType viewType) const
+{
+	std::scoped_lock lock(_graph->_viewMutex);
+	return _graph->_resourcePool.GetBufferView(GetBuffer(handle), viewType);
+}
+#pragma endregion Context
+
+#pragma region Pass Builder
+/*!**********************************************************************
+*  @brief     ANZXǉ܂. \[X𕡐錾ꍇ͓ǂݏ킹܂.
+*  @param[in] const gu::uint32 \[Xԍ
+*  @param[in] const core::ResourceState pXs̏
+*  @param[in] const bool ǂݍނ
+*  @param[in] const bool ނ
+*  @return    void
+*************************************************************************/
+void RenderGraphPassBuilder::AddAccess(const gu::uint32 resource, const core::ResourceState state, const bool isRead, const bool isWrite)
+{
+	Confirmf(resource < _graph->_resources.Size(), "Invalid render graph handle.");
+
+	auto& accesses = _graph->_passes[_passIndex].Accesses;
+	for (auto& access : accesses)
+	{
+		if (access.Resource != resource) { continue; }
+
+		Confirmf(access.State == state, "A pass cannot use one resource in two states.");
+		access.IsRead  = access.IsRead  || isRead;
+		access.IsWrite = access.IsWrite || isWrite;
+		return;
+	}
+
+	ResourceAccess access = {};
+	access.Resource = resource;
+	access.State    = state;
+	access.IsRead   = isRead;
+	access.IsWrite  = isWrite;
+	accesses.Push(access);
+
+	_graph->_isCompiled = false;
+}
+#pragma endregion Pass Builder
+
+#pragma region Constructor and Destructor
+RenderGraph::RenderGraph(const gu::SharedPointer<core::RHIDevice>& device) : _device(device), _resourcePool(device)
+{
+	Checkf(_device, "device is nullptr.");
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Setup Function
+/*!**********************************************************************
+*  @brief     Otł̂ݎgpꎞeNX`錾܂. ̂Execute̒OɊ蓖Ă܂.
+*  @param[in] const gu::tstring& fobO
+*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+*  @return    TextureHandle nh
+*************************************************************************/
+TextureHandle RenderGraph::CreateTexture(const gu::tstring& name, const core::GPUTextureMetaData& metaData)
+{
+	ResourceDesc desc = {};
+	desc.Name        = name;
+	desc.Kind        = ResourceKind::Texture;
+	desc.TextureDesc = metaData;
+
+	_resources.Push(desc);
+	_textures .Push(nullptr);
+	_buffers  .Push(nullptr);
+	_isCompiled = false;
+	return TextureHandle{ static_cast<gu::uint32>(_resources.Size() - 1) };
+}
+
+/*!**********************************************************************
+*  @brief     Otł̂ݎgpꎞobt@錾܂. ̂Execute̒OɊ蓖Ă܂.
+*  @param[in] const gu::tstring& fobO
+*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+*  @return    BufferHandle nh
+*************************************************************************/
+BufferHandle RenderGraph::CreateBuffer(const gu::tstring& name, const core::GPUBufferMetaData& metaData)
+{
+	ResourceDesc desc = {};
+	desc.Name       = name;
+	desc.Kind       = ResourceKind::Buffer;
+	desc.BufferDesc = metaData;
+
+	_resources.Push(desc);
+	_textures .Push(nullptr);
+	_buffers  .Push(nullptr);
+	_isCompiled = false;
+	return BufferHandle{ static_cast<gu::uint32>(_resources.Size() - 1) };
+}
+
+/*!**********************************************************************
+*  @brief     Ot̊Oō쐬eNX`o^܂. ݂̏ԂJڂn, ȈԂ͍ŌɎgpԂ̂܂܂ł.
+*  @param[in] const gu::tstring& fobO
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& eNX`
+*  @return    TextureHandle nh
+*************************************************************************/
+TextureHandle RenderGraph::ImportTexture(const gu::tstring& name, const gu::SharedPointer<core::GPUTexture>& texture)
+{
+	Confirmf(texture, "texture is nullptr.");
+
+	// eNX`ʖœo^ƏԂ̒ǐՂĂ܂, ̃nhԂ܂
+	for (gu::uint32 i = 0; i < static_cast<gu::uint32>(_resources.Size()); ++i)
+	{
+		if (_resources[i].IsImported && _textures[i] == texture) { return TextureHandle{ i }; }
+	}
+
+	ResourceDesc desc = {};
+	desc.Name         = name;
+	desc.Kind         = ResourceKind::Texture;
+	desc.TextureDesc  = texture->GetMetaData();
+	desc.IsImported   = true;
+	desc.InitialState = texture->GetResourceState();
+
+	_resources.Push(desc);
+	_textures .Push(texture);
+	_buffers  .Push(nullptr);
+	_isCompiled = false;
+	return TextureHandle{ static_cast<gu::uint32>(_resources.Size() - 1) };
+}
+
+/*!**********************************************************************
+*  @brief     Ot̊Oō쐬eNX`o^, OtIɎw̏Ԃ֖߂܂.
+*  @param[in] const gu::tstring& fobO
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& eNX`
+*  @param[in] const core::ResourceState OtȈ
+*  @return    TextureHandle nh
+*************************************************************************/
+TextureHandle RenderGraph::ImportTexture(const gu::tstring& name, const gu::SharedPointer<core::GPUTexture>& texture, const core::ResourceState finalState)
+{
+	const auto handle = ImportTexture(name, texture);
+	_resources[handle.Index].HasFinalState = true;
+	_resources[handle.Index].FinalState    = finalState;
+	return handle;
+}
+
+/*!**********************************************************************
+*  @brief     Ot̊Oō쐬obt@o^܂. ݂̏ԂJڂn, ȈԂ͍ŌɎgpԂ̂܂܂ł.
+*  @param[in] const gu::tstring& fobO
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& obt@
+*  @return    BufferHandle nh
+*************************************************************************/
+BufferHandle RenderGraph::ImportBuffer(const gu::tstring& name, const gu::SharedPointer<core::GPUBuffer>& buffer)
+{
+	Confirmf(buffer, "buffer is nullptr.");
+
+	for (gu::uint32 i = 0; i < static_cast<gu::uint32>(_resources.Size()); ++i)
+	{
+		if (_resources[i].IsImported && _buffers[i] == buffer) { return BufferHandle{ i }; }
+	}
+
+	ResourceDesc desc = {};
+	desc.Name         = name;
+	desc.Kind         = ResourceKind::Buffer;
+	desc.BufferDesc   = buffer->GetMetaData();
+	desc.IsImported   = true;
+	desc.InitialState = buffer->GetResourceState();
+
+	_resources.Push(desc);
+	_textures .Push(nullptr);
+	_buffers  .Push(buffer);
+	_isCompiled = false;
+	return BufferHandle{ static_cast<gu::uint32>(_resources.Size() - 1) };
+}
+
+/*!**********************************************************************
+*  @brief     pXǉ܂. L^֐ExecuteɌĂ΂, JOꂽꍇ͌Ă΂܂.
+*  @param[in] const gu::tstring& fobO
+*  @param[in] const PassFlags pẌ
+*  @param[in] const RenderGraphExecuteFunction& L^֐
+*  @return    RenderGraphPassBuilder ǂݏ̐錾Ɏgp܂
+*************************************************************************/
+RenderGraphPassBuilder RenderGraph::AddPass(const gu::tstring& name, const PassFlags flags, const RenderGraphExecuteFunction& function)
+{
+	PassDesc desc = {};
+	desc.Name  = name;
+	desc.Flags = flags;
+
+	_passes.Push(desc);
+	_executeFunctions.Push(function);
+	_isCompiled = false;
+	return RenderGraphPassBuilder(this, static_cast<gu::uint32>(_passes.Size() - 1));
+}
+
+/*!**********************************************************************
+*  @brief     錾pXƃ\[Xj, ̃t[̐錾󂯕t܂. ꎞ\[X̎̂̓v[ɖ߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RenderGraph::Reset()
+{
+	_resources       .Clear();
+	_passes          .Clear();
+	_executeFunctions.Clear();
+	_textures        .Clear();
+	_buffers         .Clear();
+	_isCompiled = false;
+
+	_resourcePool.EndFrame();
+}
+#pragma endregion Setup Function
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     錾ꂽpXƃ\[XRpC܂.
+*  @param[in] void
+*  @return    const CompiledRenderGraph& RpC
+*************************************************************************/
+const CompiledRenderGraph& RenderGraph::Compile()
+{
+	_compiled   = RenderGraphCompiler::Compile(_resources, _passes);
+	_isCompiled = true;
+	return _compiled;
+}
+
+/*!**********************************************************************
+*  @brief     ꎞ\[X̎̂蓖, oAƃpXL^܂. @n
+*             ̃pXob`, AcquireCommandListw肳Ă΃pXƂɕʂ̃R}hXg֕ɋL^܂.
+*  @param[in] const RenderGraphExecuteDesc& s@
+*  @return    gu::DynamicArray<gu::SharedPointer<core::RHICommandList>> L^R}hXgsɕׂ (擪desc.CommandList)
+*************************************************************************/
+gu::DynamicArray<gu::SharedPointer<core::RHICommandList>> RenderGraph::Execute(const RenderGraphExecuteDesc& desc)
+{
+	Confirmf(desc.CommandList, "command list is nullptr.");
+	if (!_isCompiled) { Compile(); }
+
+	RealizeResources();
+
+	gu::DynamicArray<gu::SharedPointer<core::RHICommandList>> commandLists = {};
+	commandLists.Push(desc.CommandList);
+
+	// L^̌, L^R}hXgKvɂȂ_Ŏ擾܂
+	gu::SharedPointer<core::RHICommandList> current = desc.CommandList;
+	const auto getCurrent = [&]()
+	{
+		if (!current)
+		{
+			current = desc.AcquireCommandList();
+			commandLists.Push(current);
+		}
+		return current;
+	};
+
+	for (const auto& batch : _compiled.Batches)
+	{
+		if (batch.BarrierCount > 0)
+		{
+			RecordBarriers(getCurrent(), &_compiled.Barriers[batch.BarrierOffset], batch.BarrierCount);
+		}
+
+		/*-------------------------------------------------------------------
+		-            Serial recording
+		---------------------------------------------------------------------*/
+		if (batch.PassCount == 1 || !desc.AcquireCommandList)
+		{
+			for (gu::uint32 i = 0; i < batch.PassCount; ++i)
+			{
+				const auto passIndex = _compiled.PassOrder[batch.PassOffset + i];
+				_executeFunctions[passIndex](RenderGraphContext(this, getCurrent()));
+			}
+			continue;
+		}
+
+		/*-------------------------------------------------------------------
+		-            Parallel recording
+		---------------------------------------------------------------------*/
+		gu::DynamicArray<gu::SharedPointer<core::RHICommandList>> passCommandLists(batch.PassCount);
+		for (gu::uint32 i = 0; i < batch.PassCount; ++i)
+		{
+			passCommandLists[i] = desc.AcquireCommandList();
+			commandLists.Push(passCommandLists[i]);
+		}
+
+		const auto recordPass = [this, &batch, &passCommandLists](const gu::uint32 i)
+		{
+			const auto passIndex = _compiled.PassOrder[batch.PassOffset + i];
+			_executeFunctions[passIndex](RenderGraphContext(this, passCommandLists[i]));
+		};
+
+		if (desc.ThreadPool)
+		{
+			std::vector<std::future<void>> futures;
+			futures.reserve(batch.PassCount);
+			for (gu::uint32 i = 0; i < batch.PassCount; ++i)
+			{
+				futures.push_back(desc.ThreadPool->Submit([&recordPass, i]() { recordPass(i); }));
+			}
+			for (auto& future : futures) { future.get(); }
+		}
+		else
+		{
+			for (gu::uint32 i = 0; i < batch.PassCount; ++i) { recordPass(i); }
+		}
+
+		current = nullptr;
+	}
+
+	if (!_compiled.FinalBarriers.IsEmpty())
+	{
+		RecordBarriers(getCurrent(), _compiled.FinalBarriers.Data(), static_cast<gu::uint32>(_compiled.FinalBarriers.Size()));
+	}
+
+	return commandLists;
+}
+#pragma endregion Main Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     ꎞ\[Xփv[̎̂蓖Ă܂. ̔ԍz\[X͓GPU\[Xw܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RenderGraph::RealizeResources()
+{
+	gu::DynamicArray<gu::SharedPointer<core::GPUTexture>> physicalTextures(_compiled.PhysicalResources.Size());
+	gu::DynamicArray<gu::SharedPointer<core::GPUBuffer>>  physicalBuffers (_compiled.PhysicalResources.Size());
+
+	for (gu::uint64 i = 0; i < _compiled.PhysicalResources.Size(); ++i)
+	{
+		const auto& physical = _compiled.PhysicalResources[i];
+		if (physical.Kind == ResourceKind::Texture)
+		{
+			physicalTextures[i] = _resourcePool.AcquireTexture(physical.TextureDesc, SP("RenderGraph::Texture"));
+		}
+		else
+		{
+			physicalBuffers[i] = _resourcePool.AcquireBuffer(physical.BufferDesc, SP("RenderGraph::Buffer"));
+		}
+	}
+
+	for (gu::uint64 i = 0; i < _resources.Size(); ++i)
+	{
+		const auto physicalIndex = _compiled.PhysicalIndex[i];
+		if (_resources[i].IsImported || physicalIndex == INVALID_INDEX) { continue; }
+
+		_textures[i] = physicalTextures[physicalIndex];
+		_buffers [i] = physicalBuffers [physicalIndex];
+	}
+}
+
+/*!**********************************************************************
+*  @brief     oAL^܂. ۂ̏ԂJڌƓ̂͏Ȃ܂.
+*  @param[in] const gu::SharedPointer<core::RHICommandList>& L^̃R}hXg
+*  @param[in] const CompiledBarrier* oA̐擪
+*  @param[in] const gu::uint32 oA̐
+*  @return    void
+*************************************************************************/
+void RenderGraph::RecordBarriers(const gu::SharedPointer<core::RHICommandList>& commandList, const CompiledBarrier* barriers, const gu::uint32 barrierCount)
+{
+	bool hasBarrier = false;
+	for (gu::uint32 i = 0; i < barrierCount; ++i)
+	{
+		const auto& barrier  = barriers[i];
+		const auto  resource = GetResource(barrier.Resource);
+
+		if (barrier.Type == BarrierType::UnorderedAccess)
+		{
+			commandList->PushUAVBarrier(resource);
+			hasBarrier = true;
+			continue;
+		}
+
+		if (resource->GetResourceState() == barrier.After) { continue; }
+
+		commandList->PushTransitionBarrier(resource, barrier.After);
+		hasBarrier = true;
+	}
+
+	if (hasBarrier) { commandList->FlushResourceBarriers(); }
+}
+
+/*!**********************************************************************
+*  @brief     z\[XŵԂ܂.
+*  @param[in] const gu::uint32 \[Xԍ
+*  @return    gu::SharedPointer<core::GPUResource> 
+*************************************************************************/
+gu::SharedPointer<core::GPUResource> RenderGraph::GetResource(const gu::uint32 resource) const
+{
+	if (_resources[resource].Kind == ResourceKind::Texture) { return _textures[resource]; }
+	return _buffers[resource];
+}
+#pragma endregion Protected Function
@@ -0,0 +1,514 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraphCompiler.cpp
+///  @brief  pXƃ\[X̋Lq, JO, vZ, ꎞ\[X̕ʖ蓖, oÃob`s܂.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/RenderGraphCompiler.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::graph;
+
+namespace
+{
+	/*! @brief ̂̍쐬̏ԂԂ܂*/
+	core::ResourceState GetCreationState(const ResourceDesc& desc)
+	{
+		return desc.Kind == ResourceKind::Texture ? desc.TextureDesc.State : desc.BufferDesc.State;
+	}
+
+	/*! @brief z\[X̐oCgTCYԂ܂*/
+	gu::uint64 GetResourceByteSize(const ResourceDesc& desc)
+	{
+		return desc.Kind == ResourceKind::Texture ? RenderGraphCompiler::GetTextureByteSize(desc.TextureDesc) : desc.BufferDesc.GetTotalByte();
+	}
+
+	/*! @brief 1ÕANZXƂ̊ԂUAVoAKv*/
+	bool NeedsUAVBarrier(const bool previousUAVWrite, const ResourceAccess& access)
+	{
+		return previousUAVWrite && access.State == core::ResourceState::UnorderedAccess;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     pXƃ\[X̋Lq烌_[OtRpC܂.
+*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+*  @param[in] const gu::DynamicArray<PassDesc>& 錾ɕ񂾃pX̋Lq
+*  @return    CompiledRenderGraph RpC
+*************************************************************************/
+CompiledRenderGraph RenderGraphCompiler::Compile(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes)
+{
+	for (const auto& pass : passes)
+	{
+		for (const auto& access : pass.Accesses)
+		{
+			Confirmf(access.Resource < resources.Size(), "Render graph pass refers to an unknown resource.");
+			Confirmf(access.IsRead || access.IsWrite, "Render graph access must read or write the resource.");
+		}
+	}
+
+	CompiledRenderGraph result = {};
+	result.Statistics.PassCount = static_cast<gu::uint32>(passes.Size());
+
+	CullPasses             (resources, passes, result);
+	BuildBatches           (resources, passes, result);
+	AssignPhysicalResources(resources, passes, result);
+	BuildBarriers          (resources, passes, result);
+	CountNaiveBarriers     (resources, passes, result);
+	return result;
+}
+#pragma endregion Main Function
+
+#pragma region Compile Step
+/*!**********************************************************************
+*  @brief     o͂Ɋ^ȂpX폜܂. @n
+*             납珇, KvƂĂ郊\[X֏ރpX𐶑, ̃pXǂރ\[XKvƂ܂. @n
+*             ǂݍ݂𔺂Ȃ݂͂ȑO̓e㏑邽, ȑȌ݂͕svɂȂ܂.
+*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+*  @param[in] const gu::DynamicArray<PassDesc>& pX̋Lq
+*  @param[out] CompiledRenderGraph& RpC
+*  @return    void
+*************************************************************************/
+void RenderGraphCompiler::CullPasses(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result)
+{
+	gu::DynamicArray<bool> isNeeded(resources.Size(), false);
+	result.IsPassAlive.Resize(passes.Size(), true, false);
+
+	for (gu::uint64 i = passes.Size(); i > 0; --i)
+	{
+		const auto  passIndex = i - 1;
+		const auto& pass      = passes[passIndex];
+
+		bool isAlive = gu::HasAnyFlags(pass.Flags, PassFlags::NeverCull);
+		for (const auto& access : pass.Accesses)
+		{
+			if (access.IsWrite && (resources[access.Resource].IsImported || isNeeded[access.Resource]))
+			{
+				isAlive = true;
+			}
+		}
+
+		result.IsPassAlive[passIndex] = isAlive;
+		if (!isAlive)
+		{
+			result.Statistics.CulledPassCount++;
+			continue;
+		}
+
+		for (const auto& access : pass.Accesses)
+		{
+			if (access.IsWrite && !access.IsRead) { isNeeded[access.Resource] = false; }
+		}
+		for (const auto& access : pass.Accesses)
+		{
+			if (access.IsRead) { isNeeded[access.Resource] = true; }
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ĂpX錾Ƀob`ւ܂Ƃ, z\[X̎߂܂. @n
+*             Õob`̑SẴpXƐVpXL^, \[Xւ݂̏قȂԂł̓ǂݍ݂ȂΓob`ɓ܂.
+*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+*  @param[in] const gu::DynamicArray<PassDesc>& pX̋Lq
+*  @param[out] CompiledRenderGraph& RpC
+*  @return    void
+*************************************************************************/
+void RenderGraphCompiler::BuildBatches(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result)
+{
+	/*-------------------------------------------------------------------
+	-            ݂̃ob`ł̃\[X̎g
+	---------------------------------------------------------------------*/
+	struct BatchAccess
+	{
+		gu::uint32          Batch   = INVALID_INDEX;
+		core::ResourceState State   = core::ResourceState::Common;
+		bool                IsWrite = false;
+	};
+
+	gu::DynamicArray<BatchAccess> batchAccesses(resources.Size());
+
+	result.FirstBatch.Resize(resources.Size(), true, INVALID_INDEX);
+	result.LastBatch .Resize(resources.Size(), true, INVALID_INDEX);
+
+	result.PassOrder.Reserve(passes.Size());
+	result.Batches  .Reserve(passes.Size());
+
+	bool isParallelBatch = false;
+	for (gu::uint32 passIndex = 0; passIndex < static_cast<gu::uint32>(passes.Size()); ++passIndex)
+	{
+		if (!result.IsPassAlive[passIndex]) { continue; }
+
+		const auto& pass       = passes[passIndex];
+		const bool  isParallel = gu::HasAnyFlags(pass.Flags, PassFlags::AllowParallelRecording);
+
+		/*-------------------------------------------------------------------
+		-            Can the pass join the current batch
+		---------------------------------------------------------------------*/
+		bool canJoin = !result.Batches.IsEmpty() && isParallelBatch && isParallel;
+		if (canJoin)
+		{
+			const auto currentBatch = static_cast<gu::uint32>(result.Batches.Size() - 1);
+			for (const auto& access : pass.Accesses)
+			{
+				const auto& batchAccess = batchAccesses[access.Resource];
+				if (batchAccess.Batch != currentBatch) { continue; }
+
+				if (batchAccess.IsWrite || access.IsWrite || batchAccess.State != access.State)
+				{
+					canJoin = false; break;
+				}
+			}
+		}
+
+		if (!canJoin)
+		{
+			CompiledBatch batch = {};
+			batch.PassOffset = static_cast<gu::uint32>(result.PassOrder.Size());
+			result.Batches.Push(batch);
+			isParallelBatch = isParallel;
+		}
+
+		/*-------------------------------------------------------------------
+		-            Register the pass
+		---------------------------------------------------------------------*/
+		const auto batchIndex = static_cast<gu::uint32>(result.Batches.Size() - 1);
+		result.Batches.Back().PassCount++;
+		result.PassOrder.Push(passIndex);
+
+		for (const auto& access : pass.Accesses)
+		{
+			auto& batchAccess = batchAccesses[access.Resource];
+			batchAccess.Batch   = batchIndex;
+			batchAccess.State   = access.State;
+			batchAccess.IsWrite = access.IsWrite;
+
+			if (result.FirstBatch[access.Resource] == INVALID_INDEX)
+			{
+				Confirmf(resources[access.Resource].IsImported || !access.IsRead,
+					"Render graph transient resource is read before it is written.");
+				result.FirstBatch[access.Resource] = batchIndex;
+			}
+			result.LastBatch[access.Resource] = batchIndex;
+		}
+	}
+
+	for (const auto& batch : result.Batches)
+	{
+		if (batch.PassCount > 1) { result.Statistics.ParallelBatchCount++; }
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̏dȂȂꎞ\[X֓̂蓖Ă܂. @n
+*             ŏɎgpob`̏, O̎gp҂̍ŏIob`g̊Jnob`O, 쐬Ɍ݊̂̂T܂.
+*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+*  @param[in] const gu::DynamicArray<PassDesc>& pX̋Lq
+*  @param[out] CompiledRenderGraph& RpC
+*  @return    void
+*************************************************************************/
+void RenderGraphCompiler::AssignPhysicalResources(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result)
+{
+	result.PhysicalIndex.Resize(resources.Size(), true, INVALID_INDEX);
+
+	/*-------------------------------------------------------------------
+	-     ̊JnɈꎞ\[Xׂ (ob`ɃpX𑖍ƎRɕ)
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<gu::uint32> transients = {};
+	transients.Reserve(resources.Size());
+
+	for (gu::uint32 batchIndex = 0; batchIndex < static_cast<gu::uint32>(result.Batches.Size()); ++batchIndex)
+	{
+		const auto& batch = result.Batches[batchIndex];
+		for (gu::uint32 i = 0; i < batch.PassCount; ++i)
+		{
+			for (const auto& access : passes[result.PassOrder[batch.PassOffset + i]].Accesses)
+			{
+				if (resources[access.Resource].IsImported)                { continue; }
+				if (result.FirstBatch[access.Resource] != batchIndex)     { continue; }
+				if (result.PhysicalIndex[access.Resource] != INVALID_INDEX) { continue; }
+
+				// xo^邽, ̒lňt܂
+				result.PhysicalIndex[access.Resource] = 0;
+				transients.Push(access.Resource);
+			}
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-     ̂̊蓖
+	---------------------------------------------------------------------*/
+	gu::DynamicArray<gu::uint32> physicalLastBatch = {};
+
+	for (const auto resourceIndex : transients)
+	{
+		const auto& desc     = resources[resourceIndex];
+		const auto  byteSize = GetResourceByteSize(desc);
+		result.Statistics.TransientByteSize += byteSize;
+
+		gu::uint32 physicalIndex = INVALID_INDEX;
+		for (gu::uint32 i = 0; i < static_cast<gu::uint32>(result.PhysicalResources.Size()); ++i)
+		{
+			const auto& physical = result.PhysicalResources[i];
+			if (physical.Kind != desc.Kind)                              { continue; }
+			if (physicalLastBatch[i] >= result.FirstBatch[resourceIndex]) { continue; }
+
+			const bool isAliasable = desc.Kind == ResourceKind::Texture ?
+				IsAliasable(physical.TextureDesc, desc.TextureDesc) :
+				IsAliasable(physical.BufferDesc , desc.BufferDesc);
+			if (isAliasable) { physicalIndex = i; break; }
+		}
+
+		if (physicalIndex == INVALID_INDEX)
+		{
+			PhysicalResourceDesc physical = {};
+			physical.Kind        = desc.Kind;
+			physical.TextureDesc = desc.TextureDesc;
+			physical.BufferDesc  = desc.BufferDesc;
+			physical.ByteSize    = byteSize;
+
+			physicalIndex = static_cast<gu::uint32>(result.PhysicalResources.Size());
+			result.PhysicalResources.Push(physical);
+			physicalLastBatch.Push(0);
+
+			result.Statistics.AllocatedTransientByteSize += byteSize;
+		}
+		else
+		{
+			auto& physical = result.PhysicalResources[physicalIndex];
+			physical.TextureDesc.Usage = physical.TextureDesc.Usage | desc.TextureDesc.Usage;
+			physical.BufferDesc .Usage = physical.BufferDesc .Usage | desc.BufferDesc .Usage;
+		}
+
+		result.PhysicalResources[physicalIndex].AliasCount++;
+		physicalLastBatch[physicalIndex]     = result.LastBatch[resourceIndex];
+		result.PhysicalIndex[resourceIndex] = physicalIndex;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̂ƂɏԂǐՂ, ob`Ƃ̃oA쐬܂. @n
+*             ꎞ\[X̍ŏ̎gpł, Ot[̏ԂȂߏɑJڂL^, sɕsvȂ̂Ȃ܂. @n
+*             vɂ͍쐬̏Ԃω̂𐔂܂.
+*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+*  @param[in] const gu::DynamicArray<PassDesc>& pX̋Lq
+*  @param[out] CompiledRenderGraph& RpC
+*  @return    void
+*************************************************************************/
+void RenderGraphCompiler::BuildBarriers(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result)
+{
+	/*-------------------------------------------------------------------
+	-     O\[X͉z\[X̔ԍ, ꎞ\[X͎̂̔ԍŏԂ܂
+	---------------------------------------------------------------------*/
+	struct TrackedState
+	{
+		core::ResourceState State      = core::ResourceState::Common;
+		bool                IsKnown    = false;
+		bool                IsUAVWrite = false;
+	};
+
+	const auto resourceCount = static_cast<gu::uint32>(resources.Size());
+	gu::DynamicArray<TrackedState> states(resources.Size() + result.PhysicalResources.Size());
+
+	for (gu::uint32 i = 0; i < resourceCount; ++i)
+	{
+		if (!resources[i].IsImported) { continue; }
+		states[i].State   = resources[i].InitialState;
+		states[i].IsKnown = true;
+	}
+	for (gu::uint64 i = 0; i < result.PhysicalResources.Size(); ++i)
+	{
+		const auto& physical = result.PhysicalResources[i];
+		states[resourceCount + i].State = physical.Kind == ResourceKind::Texture ? physical.TextureDesc.State : physical.BufferDesc.State;
+	}
+
+	const auto getStateIndex = [&](const gu::uint32 resource)
+	{
+		return resources[resource].IsImported ? resource : resourceCount + result.PhysicalIndex[resource];
+	};
+
+	/*-------------------------------------------------------------------
+	-     Batch barriers
+	---------------------------------------------------------------------*/
+	for (auto& batch : result.Batches)
+	{
+		batch.BarrierOffset = static_cast<gu::uint32>(result.Barriers.Size());
+
+		gu::uint32 effectiveCount = 0;
+		for (gu::uint32 i = 0; i < batch.PassCount; ++i)
+		{
+			for (const auto& access : passes[result.PassOrder[batch.PassOffset + i]].Accesses)
+			{
+				auto& state = states[getStateIndex(access.Resource)];
+
+				if (!state.IsKnown || state.State != access.State)
+				{
+					CompiledBarrier barrier = {};
+					barrier.Type     = BarrierType::Transition;
+					barrier.Resource = access.Resource;
+					barrier.Before   = state.State;
+					barrier.After    = access.State;
+					result.Barriers.Push(barrier);
+
+					if (barrier.Before != barrier.After) { effectiveCount++; }
+				}
+				else if (NeedsUAVBarrier(state.IsUAVWrite, access))
+				{
+					CompiledBarrier barrier = {};
+					barrier.Type     = BarrierType::UnorderedAccess;
+					barrier.Resource = access.Resource;
+					barrier.Before   = access.State;
+					barrier.After    = access.State;
+					result.Barriers.Push(barrier);
+					effectiveCount++;
+				}
+
+				state.State      = access.State;
+				state.IsKnown    = true;
+				state.IsUAVWrite = access.IsWrite && access.State == core::ResourceState::UnorderedAccess;
+			}
+		}
+
+		batch.BarrierCount = static_cast<gu::uint32>(result.Barriers.Size()) - batch.BarrierOffset;
+		result.Statistics.BarrierCount += effectiveCount;
+		if (effectiveCount > 0) { result.Statistics.BarrierBatchCount++; }
+	}
+
+	/*-------------------------------------------------------------------
+	-     Restore imported resources
+	---------------------------------------------------------------------*/
+	for (gu::uint32 i = 0; i < resourceCount; ++i)
+	{
+		if (!resources[i].IsImported || !resources[i].HasFinalState) { continue; }
+		if (states[i].State == resources[i].FinalState)             { continue; }
+
+		CompiledBarrier barrier = {};
+		barrier.Type     = BarrierType::Transition;
+		barrier.Resource = i;
+		barrier.Before   = states[i].State;
+		barrier.After    = resources[i].FinalState;
+		result.FinalBarriers.Push(barrier);
+	}
+
+	result.Statistics.BarrierCount += static_cast<gu::uint32>(result.FinalBarriers.Size());
+	if (!result.FinalBarriers.IsEmpty()) { result.Statistics.BarrierBatchCount++; }
+}
+
+/*!**********************************************************************
+*  @brief     JO, ʖ蓖, ob`Ȃꍇ̃oAς܂. @n
+*             SẴpX錾, g̎g\[XʂɑJڂĂFlushꍇz肵܂.
+*  @param[in] const gu::DynamicArray<ResourceDesc>& \[X̋Lq
+*  @param[in] const gu::DynamicArray<PassDesc>& pX̋Lq
+*  @param[out] CompiledRenderGraph& RpC
+*  @return    void
+*************************************************************************/
+void RenderGraphCompiler::CountNaiveBarriers(const gu::DynamicArray<ResourceDesc>& resources, const gu::DynamicArray<PassDesc>& passes, CompiledRenderGraph& result)
+{
+	gu::DynamicArray<core::ResourceState> states(resources.Size());
+	gu::DynamicArray<bool>                uavWrites(resources.Size(), false);
+	for (gu::uint64 i = 0; i < resources.Size(); ++i)
+	{
+		states[i] = resources[i].IsImported ? resources[i].InitialState : GetCreationState(resources[i]);
+	}
+
+	for (const auto& pass : passes)
+	{
+		gu::uint32 count = 0;
+		for (const auto& access : pass.Accesses)
+		{
+			if (states[access.Resource] != access.State || NeedsUAVBarrier(uavWrites[access.Resource], access)) { count++; }
+
+			states   [access.Resource] = access.State;
+			uavWrites[access.Resource] = access.IsWrite && access.State == core::ResourceState::UnorderedAccess;
+		}
+
+		result.Statistics.NaiveBarrierCount += count;
+		if (count > 0) { result.Statistics.NaiveBarrierBatchCount++; }
+	}
+
+	gu::uint32 finalCount = 0;
+	for (gu::uint64 i = 0; i < resources.Size(); ++i)
+	{
+		if (resources[i].IsImported && resources[i].HasFinalState && states[i] != resources[i].FinalState) { finalCount++; }
+	}
+	result.Statistics.NaiveBarrierCount += finalCount;
+	if (finalCount > 0) { result.Statistics.NaiveBarrierBatchCount++; }
+}
+#pragma endregion Compile Step
+
+#pragma region Property
+/*!**********************************************************************
+*  @brief     eNX`̐oCgTCYԂ܂. SẴ~bvƔzvf܂݂܂.
+*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+*  @return    gu::uint64 oCgTCY
+*************************************************************************/
+gu::uint64 RenderGraphCompiler::GetTextureByteSize(const core::GPUTextureMetaData& metaData)
+{
+	const auto blockBytes  = static_cast<gu::uint64>(core::PixelFormatInfo::GetConst(metaData.PixelFormat).BlockBytes);
+	const auto sampleCount = static_cast<gu::uint64>(metaData.Sample);
+	const auto mipCount    = metaData.MipMapLevels == 0 ? 1 : metaData.MipMapLevels;
+
+	gu::uint64 width  = metaData.Width;
+	gu::uint64 height = metaData.Height;
+	gu::uint64 depth  = metaData.Dimension == core::ResourceDimension::Texture3D ? metaData.DepthOrArraySize : 1;
+	const gu::uint64 arrayCount = metaData.Dimension == core::ResourceDimension::Texture3D ? 1 : metaData.DepthOrArraySize;
+
+	gu::uint64 byteSize = 0;
+	for (gu::uint32 mip = 0; mip < mipCount; ++mip)
+	{
+		byteSize += width * height * depth;
+		width  = width  > 1 ? width  / 2 : 1;
+		height = height > 1 ? height / 2 : 1;
+		depth  = depth  > 1 ? depth  / 2 : 1;
+	}
+	return byteSize * arrayCount * blockBytes * sampleCount;
+}
+
+/*!**********************************************************************
+*  @brief     2̃eNX`̍쐬񂪓̂Lł邩Ԃ܂. gp@̈Ⴂ͋e܂.
+*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+*  @return    bool Lłꍇtrue
+*************************************************************************/
+bool RenderGraphCompiler::IsAliasable(const core::GPUTextureMetaData& left, const core::GPUTextureMetaData& right)
+{
+	return left.Width            == right.Width
+		&& left.Height           == right.Height
+		&& left.DepthOrArraySize == right.DepthOrArraySize
+		&& left.MipMapLevels     == right.MipMapLevels
+		&& left.PixelFormat      == right.PixelFormat
+		&& left.Sample           == right.Sample
+		&& left.Dimension        == right.Dimension
+		&& left.ResourceType     == right.ResourceType
+		&& left.HeapType         == right.HeapType;
+}
+
+/*!**********************************************************************
+*  @brief     2̃obt@̍쐬񂪓̂Lł邩Ԃ܂. gp@̈Ⴂ͋e܂.
+*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+*  @return    bool Lłꍇtrue
+*************************************************************************/
+bool RenderGraphCompiler::IsAliasable(const core::GPUBufferMetaData& left, const core::GPUBufferMetaData& right)
+{
+	return left.Stride       == right.Stride
+		&& left.Count        == right.Count
+		&& left.Format       == right.Format
+		&& left.ResourceType == right.ResourceType
+		&& left.HeapType     == right.HeapType
+		&& left.InitData     == nullptr
+		&& right.InitData    == nullptr;
+}
+#pragma endregion Property
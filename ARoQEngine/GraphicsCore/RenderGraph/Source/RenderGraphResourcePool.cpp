@@ -0,0 +1,190 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraphResourcePool.cpp
+///  @brief  _[Oẗꎞ\[X̎̂t[܂ōėpv[ł.
+///  @author toide
+///  @date   2026/10/20 10:12:41
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/RenderGraphResourcePool.hpp"
+#include "../Include/RenderGraphCompiler.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDevice.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUTexture.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUBuffer.hpp"
+#include "GraphicsCore/RHI/InterfaceCore/Resource/Include/GPUResourceView.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi;
+using namespace rhi::graph;
+
+//////////////////////////////////////////////////////////////////////////////////
+//                          Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Constructor and Destructor
+RenderGraphResourcePool::RenderGraphResourcePool(const gu::SharedPointer<core::RHIDevice>& device) : _device(device)
+{
+	Checkf(_device, "device is nullptr.");
+}
+
+RenderGraphResourcePool::~RenderGraphResourcePool()
+{
+	Clear();
+}
+#pragma endregion Constructor and Destructor
+
+#pragma region Main Function
+/*!**********************************************************************
+*  @brief     쐬ƈv関gp̃eNX`Ԃ܂. Ȃꍇ͐V쐬܂.
+*  @param[in] const core::GPUTextureMetaData& eNX`̍쐬
+*  @param[in] const gu::tstring& V쐬ꍇ̃fobO
+*  @return    gu::SharedPointer<core::GPUTexture> eNX`
+*************************************************************************/
+gu::SharedPointer<core::GPUTexture> RenderGraphResourcePool::AcquireTexture(const core::GPUTextureMetaData& metaData, const gu::tstring& name)
+{
+	for (auto& entry : _textures)
+	{
+		if (entry.IsInUse) { continue; }
+		if (entry.MetaData.Usage != metaData.Usage || !RenderGraphCompiler::IsAliasable(entry.MetaData, metaData)) { continue; }
+
+		entry.IsInUse       = true;
+		entry.LastUsedFrame = _frameCount;
+		return entry.Texture;
+	}
+
+	TextureEntry entry = {};
+	entry.Texture       = _device->CreateTexture(metaData, name);
+	entry.MetaData      = metaData;
+	entry.LastUsedFrame = _frameCount;
+	entry.IsInUse       = true;
+	_textures.Push(entry);
+
+	_pooledByteSize += RenderGraphCompiler::GetTextureByteSize(metaData);
+	return entry.Texture;
+}
+
+/*!**********************************************************************
+*  @brief     쐬ƈv関gp̃obt@Ԃ܂. Ȃꍇ͐V쐬܂.
+*  @param[in] const core::GPUBufferMetaData& obt@̍쐬
+*  @param[in] const gu::tstring& V쐬ꍇ̃fobO
+*  @return    gu::SharedPointer<core::GPUBuffer> obt@
+*************************************************************************/
+gu::SharedPointer<core::GPUBuffer> RenderGraphResourcePool::AcquireBuffer(const core::GPUBufferMetaData& metaData, const gu::tstring& name)
+{
+	for (auto& entry : _buffers)
+	{
+		if (entry.IsInUse) { continue; }
+		if (entry.MetaData.Usage != metaData.Usage || !RenderGraphCompiler::IsAliasable(entry.MetaData, metaData)) { continue; }
+
+		entry.IsInUse       = true;
+		entry.LastUsedFrame = _frameCount;
+		return entry.Buffer;
+	}
+
+	BufferEntry entry = {};
+	entry.Buffer        = _device->CreateBuffer(metaData, name);
+	entry.MetaData      = metaData;
+	entry.LastUsedFrame = _frameCount;
+	entry.IsInUse       = true;
+	_buffers.Push(entry);
+
+	_pooledByteSize += metaData.GetTotalByte();
+	return entry.Buffer;
+}
+
+/*!**********************************************************************
+*  @brief     v[݂oeNX`̃r[Ԃ܂. ނ̃r[1x쐬܂.
+*  @param[in] const gu::SharedPointer<core::GPUTexture>& AcquireTextureŎ擾eNX`
+*  @param[in] const core::ResourceViewType r[̎
+*  @return    gu::SharedPointer<core::GPUResourceView> r[
+*************************************************************************/
+gu::SharedPointer<core::GPUResourceView> RenderGraphResourcePool::GetTextureView(const gu::SharedPointer<core::GPUTexture>& texture, const core::ResourceViewType viewType)
+{
+	for (auto& entry : _textures)
+	{
+		if (entry.Texture.Get() != texture.Get()) { continue; }
+
+		for (const auto& view : entry.Views)
+		{
+			if (view.Type == viewType) { return view.View; }
+		}
+
+		entry.Views.Push({ viewType, _device->CreateResourceView(viewType, texture) });
+		return entry.Views.Back().View;
+	}
+
+	Confirmf(false, "The texture is not owned by the render graph resource pool.");
+	return nullptr;
+}
+
+/*!**********************************************************************
+*  @brief     v[݂oobt@̃r[Ԃ܂. ނ̃r[1x쐬܂.
+*  @param[in] const gu::SharedPointer<core::GPUBuffer>& AcquireBufferŎ擾obt@
+*  @param[in] const core::ResourceViewType r[̎
+*  @return    gu::SharedPointer<core::GPUResourceView> r[
+*************************************************************************/
+gu::SharedPointer<core::GPUResourceView> RenderGraphResourcePool::GetBufferView(const gu::SharedPointer<core::GPUBuffer>& buffer, const core::ResourceViewType viewType)
+{
+	for (auto& entry : _buffers)
+	{
+		if (entry.Buffer.Get() != buffer.Get()) { continue; }
+
+		for (const auto& view : entry.Views)
+		{
+			if (view.Type == viewType) { return view.View; }
+		}
+
+		entry.Views.Push({ viewType, _device->CreateResourceView(viewType, buffer) });
+		return entry.Views.Back().View;
+	}
+
+	Confirmf(false, "The buffer is not owned by the render graph resource pool.");
+	return nullptr;
+}
+
+/*!**********************************************************************
+*  @brief     SẴ\[X𖢎gpɖ߂, MAX_UNUSED_FRAME_COUNT蒷gĂȂ\[Xj܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RenderGraphResourcePool::EndFrame()
+{
+	_frameCount++;
+
+	for (gu::uint64 i = _textures.Size(); i > 0; --i)
+	{
+		auto& entry = _textures[i - 1];
+		entry.IsInUse = false;
+		if (_frameCount - entry.LastUsedFrame <= MAX_UNUSED_FRAME_COUNT) { continue; }
+
+		_pooledByteSize -= RenderGraphCompiler::GetTextureByteSize(entry.MetaData);
+		_textures.RemoveAt(i - 1, false);
+	}
+
+	for (gu::uint64 i = _buffers.Size(); i > 0; --i)
+	{
+		auto& entry = _buffers[i - 1];
+		entry.IsInUse = false;
+		if (_frameCount - entry.LastUsedFrame <= MAX_UNUSED_FRAME_COUNT) { continue; }
+
+		_pooledByteSize -= entry.MetaData.GetTotalByte();
+		_buffers.RemoveAt(i - 1, false);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     SẴ\[Xj܂. GPUgpĂȂƂĂяoŕۏ؂Ă.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void RenderGraphResourcePool::Clear()
+{
+	_textures.Clear();
+	_buffers .Clear();
+	_pooledByteSize = 0;
+}
+#pragma endregion Main Function
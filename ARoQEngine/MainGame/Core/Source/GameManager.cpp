@@ -30,6 +30,7 @@ void GameManager::GameStart(const engine::StartUpParameters& parameters)
 void GameManager::GameUpdateMain()
 {
 	_sceneManager.CallSceneUpdate();
+	GameObject::FlushDestroyedGameObjects();
 }
 
 void GameManager::GameDrawMain()
@@ -13,6 +13,7 @@
 //////////////////////////////////////////////////////////////////////////////////
 #include "MainGame/Core/Include/Scene.hpp"
 #include "GameCore/Core/Include/ResourceManager.hpp"
+#include "GameCore/Rendering/UI/Public/Include/UIBatchRenderer.hpp"
 #include <memory>
 //////////////////////////////////////////////////////////////////////////////////
 //                              Define
@@ -30,7 +31,6 @@ namespace engine
 {
 	class Font;
 	class Text;
-	class UIRenderer;
 }
 namespace sample
 {
@@ -43,7 +43,7 @@ namespace sample
 	*****************************************************************************/
 	class SampleText : public Scene
 	{
-		using UIRendererPtr = gu::SharedPointer<engine::UIRenderer>;
+		using UIRendererPtr = gu::SharedPointer<engine::UIBatchRenderer>;
 		using TextPtr       = gu::SharedPointer<engine::Text>;
 		using FontPtr       = gu::SharedPointer<engine::Font>;
 		using GPUResourceCachePtr = gu::SharedPointer<rhi::core::GPUResourceCache>;
@@ -78,6 +78,7 @@ namespace sample
 		**                Protected Property
 		*****************************************************************************/
 		UIRendererPtr _renderer = nullptr;
+		engine::UIBatchHandle _textHandle = {};
 		TextPtr       _text     = nullptr;
 		FontPtr       _font     = nullptr;
 		GPUResourceCachePtr _resourceCache = nullptr;
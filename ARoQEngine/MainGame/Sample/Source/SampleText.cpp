@@ -9,7 +9,7 @@
 //                             Include
 //////////////////////////////////////////////////////////////////////////////////
 #include "MainGame/Sample/Include/SampleText.hpp"
-#include "GameCore/Rendering/UI/Public/Include/UIRenderer.hpp"
+#include "GameCore/Rendering/UI/Public/Include/UIBatchRenderer.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UIText.hpp"
 #include "GameCore/Rendering/UI/Public/Include/UIFont.hpp"
 #include "GameUtility/Base/Include/Screen.hpp"
@@ -69,8 +69,9 @@ void SampleText::Update()
 	};
 	_text = gu::MakeShared<Text>(CoordinateType::NDC, _font, info);
 
-	_renderer->Clear();
-	_renderer->AddFrameObjects(_text->GetTextImages(), _text->GetFontView());
+	// The quads are kept by the renderer, so only the changed text is expanded and uploaded.
+	if (_textHandle.IsValid()) { _renderer->Update(_textHandle, _text->GetTextImages()); }
+	else                       { _textHandle = _renderer->Add(*_text); }
 }
 /****************************************************************************
 *                       Draw
@@ -144,7 +145,7 @@ void SampleText::LoadMaterials()
 	_resourceCache->Load(SP("Resources/Cubemap.jpg"));
 
 	// Create UI Renderer
-	_renderer = gu::MakeShared<UIRenderer>(_engine);
+	_renderer = gu::MakeShared<UIBatchRenderer>(_engine);
 
 	/*-------------------------------------------------------------------
 	-             Close Copy CommandList and Flush CommandQueue
@@ -75,6 +75,7 @@ void SampleURP::Update()
 {
 	Scene::Update();
 	_camera->Update(_gameTimer);
+	_renderer->SetViewPosition(_camera->GetPosition());
 	_model->Update(_gameTimer->DeltaTime());
 	_floor->Update(_gameTimer->DeltaTime());
 
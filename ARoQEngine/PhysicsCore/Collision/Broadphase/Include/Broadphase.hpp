@@ -0,0 +1,207 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   Broadphase.hpp
+///  @brief  IAABB؂p, E{bNXdȂĂAN^[̑g܂Ƃ߂ċ߂܂. @n
+///          ÕyAvZȍ~ɖ؂֑}ꂽvLVړobt@ɐς, ̃{bNXŖ؂T܂. @n
+///          g64bit̃L[ƂďW, \[gŕׂďd菜܂. @n
+///          T͖؂ύXȂ, Xbhv[nƈړobt@𕪊ĕɎs܂.
+///  @author toide
+///  @date   2026/10/20 6:10:42
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_BROADPHASE_HPP
+#define PHYSICS_BROADPHASE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "DynamicAABBTree.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+namespace physics::collision::details::broadphase
+{
+	/*! @brief 1̃^XNŒTvLV̍ŏ. 菭Ȃꍇ͕܂*/
+	constexpr gu::uint32 MIN_QUERIES_PER_TASK = 256;
+
+	/*! @brief Ԃ̕΂ς, Xbh̉{̃^XNɕ邩*/
+	constexpr gu::uint32 TASKS_PER_THREAD = 4;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision
+{
+	/****************************************************************************
+	*				  			   BroadphasePair
+	****************************************************************************/
+	/* @brief  E{bNXdȂĂ2̃vLVł. ProxyA < ProxyBƂȂ悤Ɋi[܂.
+	*****************************************************************************/
+	struct BroadphasePair
+	{
+		gu::int32 ProxyA = details::tree::NULL_NODE;
+		gu::int32 ProxyB = details::tree::NULL_NODE;
+	};
+
+	/****************************************************************************
+	*				  			   Broadphase
+	****************************************************************************/
+	/* @brief  AN^[ƂɃvLV쐬, XebvMoveProxyŃ{bNXXV, UpdatePairsőg߂܂. @n
+	*          UpdatePairs͑}ꂽvLV܂ޑgԂ, ڐGێ鑤͑O܂ł̑gێĂ. @n
+	*          SĂ̑gKvȏꍇQueryAllPairsgp܂.
+	*****************************************************************************/
+	class Broadphase : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     vLV쐬܂. UpdatePairsŏdȂĂg񍐂܂.
+		*  @param[in] const geometry::AABB& AN^[̋E{bNX
+		*  @param[in] const gu::uint64 p҂̒l
+		*  @return    gu::int32 vLVID
+		*************************************************************************/
+		gu::int32 CreateProxy(const geometry::AABB& box, const gu::uint64 userData);
+
+		/*!**********************************************************************
+		*  @brief     vLVj܂.
+		*  @param[in] const gu::int32 vLVID
+		*  @return    void
+		*************************************************************************/
+		void DestroyProxy(const gu::int32 proxyID);
+
+		/*!**********************************************************************
+		*  @brief     vLṼ{bNXXV܂. ؂ɑ}ꍇ͈ړobt@ɐς݂܂.
+		*  @param[in] const gu::int32 vLVID
+		*  @param[in] const geometry::AABB& AN^[̐VE{bNX
+		*  @param[in] const gm::Float3& O񂩂̈ړ
+		*  @return    void
+		*************************************************************************/
+		void MoveProxy(const gu::int32 proxyID, const geometry::AABB& box, const gm::Float3& displacement);
+
+		/*!**********************************************************************
+		*  @brief     {bNXςĂȂĂ, UpdatePairsŃvLV̑g񍐂܂. (tB^̕ύXȂ)
+		*  @param[in] const gu::int32 vLVID
+		*  @return    void
+		*************************************************************************/
+		void TouchProxy(const gu::int32 proxyID);
+
+		/*!**********************************************************************
+		*  @brief     ړobt@̃vLV܂, L{bNXdȂĂg߂܂. ړobt@͋ɂȂ܂.
+		*  @param[out] gu::DynamicArray<BroadphasePair>& g (ProxyA, ProxyB̏, d)
+		*  @return    void
+		*************************************************************************/
+		void UpdatePairs(gu::DynamicArray<BroadphasePair>& pairs);
+
+		/*!**********************************************************************
+		*  @brief     UpdatePairsXbhōs܂.
+		*  @param[out] gu::DynamicArray<BroadphasePair>& g (ProxyA, ProxyB̏, d)
+		*  @param[in]  gu::ThreadPool& TsXbhv[
+		*  @return    void
+		*************************************************************************/
+		void UpdatePairs(gu::DynamicArray<BroadphasePair>& pairs, gu::ThreadPool& threadPool);
+
+		/*!**********************************************************************
+		*  @brief     ړɊ֌WȂ, L{bNXdȂĂSĂ̑g߂܂. ړobt@͕ύX܂.
+		*  @param[out] gu::DynamicArray<BroadphasePair>& g (ProxyA, ProxyB̏, d)
+		*  @return    void
+		*************************************************************************/
+		void QueryAllPairs(gu::DynamicArray<BroadphasePair>& pairs);
+
+		/*!**********************************************************************
+		*  @brief     QueryAllPairsXbhōs܂.
+		*  @param[out] gu::DynamicArray<BroadphasePair>& g (ProxyA, ProxyB̏, d)
+		*  @param[in]  gu::ThreadPool& TsXbhv[
+		*  @return    void
+		*************************************************************************/
+		void QueryAllPairs(gu::DynamicArray<BroadphasePair>& pairs, gu::ThreadPool& threadPool);
+
+		/*!**********************************************************************
+		*  @brief     ؂č\z܂. ̃vLV܂Ƃ߂č쐬, V[̓ǂݍ݌ɌĂяo܂. @n
+		*             L{bNX͕ςȂ, ܂g͕ς܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void RebuildTree();
+
+		/*!**********************************************************************
+		*  @brief     SẴvLVj܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief 2̃vLV̍L{bNXdȂĂ邩*/
+		__forceinline bool TestOverlap(const gu::int32 proxyA, const gu::int32 proxyB) const
+		{
+			return _tree.GetFatAABB(proxyA).Overlaps(_tree.GetFatAABB(proxyB));
+		}
+
+		/*! @brief vLVɊ֘Atp҂̒l*/
+		__forceinline gu::uint64 GetUserData(const gu::int32 proxyID) const { return _tree.GetUserData(proxyID); }
+
+		/*! @brief vLV̍L{bNX*/
+		__forceinline const geometry::AABB& GetFatAABB(const gu::int32 proxyID) const { return _tree.GetFatAABB(proxyID); }
+
+		/*! @brief vLV̐*/
+		__forceinline gu::int32 GetProxyCount() const { return _tree.GetProxyCount(); }
+
+		/*! @brief UpdatePairsŒTvLV̐*/
+		__forceinline gu::uint64 GetMoveCount() const { return _moveBuffer.Size(); }
+
+		/*! @brief ̖ (CLXgȂǂ̒TɎgp܂)*/
+		__forceinline const DynamicAABBTree& GetTree() const { return _tree; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		Broadphase() = default;
+
+		~Broadphase() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief TvLV̈ꗗ쐬܂. onlyMovedfalsȅꍇ͑SĂ̗tׂ܂*/
+		void GatherQueries(const bool onlyMoved);
+
+		/*! @brief [begin, end)̃vLVŖ؂T, gL[ƂĒǉ܂*/
+		void CollectPairs(const gu::uint64 begin, const gu::uint64 end, const bool onlyMoved, gu::DynamicArray<gu::uint64>& keys) const;
+
+		/*! @brief L[בւďd菜, gɕϊ܂*/
+		void SortPairs(gu::DynamicArray<BroadphasePair>& pairs);
+
+		/*! @brief ړobt@̃vLṼtO낵, obt@ɂ܂*/
+		void ClearMoveBuffer();
+
+		/*! @brief yAvZ𒀎, ܂̓Xbhōs܂*/
+		void ComputePairs(gu::DynamicArray<BroadphasePair>& pairs, const bool onlyMoved, gu::ThreadPool* threadPool);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief vLVi[*/
+		DynamicAABBTree _tree = {};
+
+		/*! @brief ÕyAvZȍ~ɑ}ꂽvLV*/
+		gu::DynamicArray<gu::int32> _moveBuffer = {};
+
+		/*! @brief TvLV*/
+		gu::DynamicArray<gu::int32> _queries = {};
+
+		/*! @brief g̃L[ ((ID << 32) | 傫ID) , \[g̍Ɨpobt@*/
+		gu::DynamicArray<gu::uint64> _pairKeys   = {};
+		gu::DynamicArray<gu::uint64> _sortBuffer = {};
+
+		/*! @brief s̃^XNƂ̃L[*/
+		gu::DynamicArray<gu::DynamicArray<gu::uint64>> _taskPairKeys = {};
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,272 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DynamicAABBTree.hpp
+///  @brief  ړAN^[̋E{bNXtɎIAABB؂ł. @n
+///          tɂ͎ۂ̃{bNX]ƈړʂ̕L(fat){bNXi[, ]͈͓̔̈ړł͖؂ύX܂. @n
+///          {bNX]𒴂ꍇ͗t菜đ}, c̃{bNXƍXV܂. @n
+///          }͕\ʐςɂRXg(SAH)ŏɂȂZTČ, }, 폜͉]ō̍1ȓɕۂ܂.
+///  @author toide
+///  @date   2026/10/20 6:10:42
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_DYNAMIC_AABB_TREE_HPP
+#define PHYSICS_DYNAMIC_AABB_TREE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "PhysicsCore/Geometry/Public/Include/GeometryBounds.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision::details::tree
+{
+	/*! @brief ݂Ȃm[h\CfbNX*/
+	constexpr gu::int32 NULL_NODE = -1;
+
+	/*! @brief TŎgpX^bN̔z̗vf. ʏ͐S̗tł܂, ꂽꍇ̓q[vɊmۂ܂*/
+	constexpr gu::int32 STACK_CAPACITY = 256;
+
+	/*! @brief t̃{bNXɉ] [m]*/
+	constexpr float AABB_MARGIN = 0.1f;
+
+	/*! @brief ړʂ̉{ړɃ{bNXL邩*/
+	constexpr float DISPLACEMENT_MULTIPLIER = 4.0f;
+
+	/*! @brief RebuildŕʒuTƂ̃r̐*/
+	constexpr gu::int32 REBUILD_BIN_COUNT = 16;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision
+{
+	/****************************************************************************
+	*				  			   DynamicAABBTreeNode
+	****************************************************************************/
+	/* @brief  ؂̃m[hł. t̓AN^[, m[h2̎q܂ރ{bNX\܂.
+	*****************************************************************************/
+	struct DynamicAABBTreeNode
+	{
+		/*! @brief t̏ꍇ͍L{bNX, m[h̏ꍇ͎q܂ރ{bNX*/
+		geometry::AABB Box = {};
+
+		/*! @brief tɊ֘Atp҂̒l*/
+		gu::uint64 UserData = 0;
+
+		/*! @brief ẽCfbNX. gp̃m[hł͎̖gpm[h̃CfbNX*/
+		gu::int32 ParentOrNext = details::tree::NULL_NODE;
+
+		/*! @brief q̃CfbNX (t̏ꍇNULL_NODE)*/
+		gu::int32 Child1 = details::tree::NULL_NODE;
+		gu::int32 Child2 = details::tree::NULL_NODE;
+
+		/*! @brief t0Ƃ (gp̃m[h-1)*/
+		gu::int32 Height = -1;
+
+		/*! @brief ÕyAvZȍ~ɑ}ꂽ*/
+		bool Moved = false;
+
+		/*! @brief t*/
+		__forceinline bool IsLeaf() const { return Child1 == details::tree::NULL_NODE; }
+	};
+
+	/****************************************************************************
+	*				  			   DynamicAABBTree
+	****************************************************************************/
+	/* @brief  vLV(t)ID̓m[h̃CfbNX, j܂ŕς܂. @n
+	*          m[h͔zɂ܂Ƃ߂Ċmۂ, jm[h͖gpXgōėp܂. @n
+	*          XbhZ[tł͂܂, ύXsȂԂQuery𕡐̃Xbh瓯ɌĂяo܂.
+	*****************************************************************************/
+	class DynamicAABBTree : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     vLV쐬, ]{bNXŖ؂ɑ}܂.
+		*  @param[in] const geometry::AABB& AN^[̋E{bNX
+		*  @param[in] const gu::uint64 p҂̒l
+		*  @return    gu::int32 vLVID
+		*************************************************************************/
+		gu::int32 CreateProxy(const geometry::AABB& box, const gu::uint64 userData);
+
+		/*!**********************************************************************
+		*  @brief     vLV؂菜, j܂.
+		*  @param[in] const gu::int32 vLVID
+		*  @return    void
+		*************************************************************************/
+		void DestroyProxy(const gu::int32 proxyID);
+
+		/*!**********************************************************************
+		*  @brief     vLṼ{bNXXV܂. i[ς݂̃{bNXɎ܂Ăꍇ͉܂. @n
+		*             ܂Ȃꍇ͗]ƈړʂ̕L{bNXő}܂.
+		*  @param[in] const gu::int32 vLVID
+		*  @param[in] const geometry::AABB& AN^[̐VE{bNX
+		*  @param[in] const gm::Float3& O񂩂̈ړ (ړփ{bNXL, }񐔂炵܂)
+		*  @return    bool }ꍇtrue
+		*************************************************************************/
+		bool MoveProxy(const gu::int32 proxyID, const geometry::AABB& box, const gm::Float3& displacement);
+
+		/*!**********************************************************************
+		*  @brief     {bNXƏdȂSĂ̗tɑ΂callbackĂяo܂. callbackfalseԂƒTł؂܂.
+		*  @param[in] const geometry::AABB& {bNX
+		*  @param[in] Function&& bool(gu::int32 proxyID)
+		*  @return    void
+		*************************************************************************/
+		template<class Function>
+		void Query(const geometry::AABB& box, Function&& callback) const;
+
+		/*!**********************************************************************
+		*  @brief     tcēm[h蒼, rSAHŃgbv_Eɖ؂č\z܂. @n
+		*             ̃vLV܂Ƃ߂č쐬, Ԃ̈ړŖ؂̎ꍇɌĂяo܂. @n
+		*             vLVIDƍL{bNX͕ς܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Rebuild();
+
+		/*!**********************************************************************
+		*  @brief     SẴm[hj܂. mۍς݂̔z͍ėp̂ߎc܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     ؂̍\ƃ{bNX؂܂. fobOp, m[hɔႵԂ܂.
+		*  @param[in] void
+		*  @return    bool
+		*************************************************************************/
+		bool Validate() const;
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief vLVɊ֘Atp҂̒l*/
+		__forceinline gu::uint64 GetUserData(const gu::int32 proxyID) const { return _nodes[proxyID].UserData; }
+
+		/*! @brief vLV̍L{bNX*/
+		__forceinline const geometry::AABB& GetFatAABB(const gu::int32 proxyID) const { return _nodes[proxyID].Box; }
+
+		/*! @brief OClearMovedĂł}ꂽ*/
+		__forceinline bool WasMoved(const gu::int32 proxyID) const { return _nodes[proxyID].Moved; }
+
+		/*! @brief }ꂽƂtO낵܂*/
+		__forceinline void ClearMoved(const gu::int32 proxyID) { _nodes[proxyID].Moved = false; }
+
+		/*! @brief m[hmۂz (tHeight == 0, gpHeight == -1)*/
+		__forceinline const gu::DynamicArray<DynamicAABBTreeNode>& GetNodes() const { return _nodes; }
+
+		/*! @brief [g̍ (̏ꍇ0)*/
+		__forceinline gu::int32 GetHeight() const { return _root == details::tree::NULL_NODE ? 0 : _nodes[_root].Height; }
+
+		/*! @brief vLV̐*/
+		__forceinline gu::int32 GetProxyCount() const { return _proxyCount; }
+
+		/*! @brief Sm[h̕\ʐς̍v[g̕\ʐςŊl. قǒT؂ł*/
+		float GetAreaRatio() const;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		DynamicAABBTree() = default;
+
+		~DynamicAABBTree() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief gp̃m[ho܂. Δzg܂*/
+		gu::int32 AllocateNode();
+
+		/*! @brief m[h𖢎gpXg֖߂܂*/
+		void FreeNode(const gu::int32 node);
+
+		/*! @brief SAH̃RXgŏƂȂZT, t}܂*/
+		void InsertLeaf(const gu::int32 leaf);
+
+		/*! @brief t؂菜܂. m[ĥ͔j܂*/
+		void RemoveLeaf(const gu::int32 leaf);
+
+		/*! @brief w肵m[h獪܂, ]ŕtۂȂ{bNXƍXV܂*/
+		void RefitAncestors(gu::int32 node);
+
+		/*! @brief q̍̍2ȏ̏ꍇɉ], ؂̐VԂ܂*/
+		gu::int32 Balance(const gu::int32 node);
+
+		/*! @brief _buildLeaves[begin, end)̗t畔؂쐬, ̍Ԃ܂*/
+		gu::int32 BuildSubtree(const gu::int32 begin, const gu::int32 end);
+
+		/*! @brief ؂̍\ƃ{bNXċAIɌ؂܂*/
+		bool ValidateNode(const gu::int32 node) const;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief SẴm[h*/
+		gu::DynamicArray<DynamicAABBTreeNode> _nodes = {};
+
+		/*! @brief ̃CfbNX*/
+		gu::int32 _root = details::tree::NULL_NODE;
+
+		/*! @brief gpXg̐擪*/
+		gu::int32 _freeList = details::tree::NULL_NODE;
+
+		/*! @brief vLV̐*/
+		gu::int32 _proxyCount = 0;
+
+		/*! @brief RebuildŎgpẗꗗ, ̃{bNX̒S*/
+		gu::DynamicArray<gu::int32>  _buildLeaves  = {};
+		gu::DynamicArray<gm::Float3> _buildCenters = {};
+		#pragma endregion
+	};
+
+	/*!**********************************************************************
+	*  @brief     {bNXƏdȂSĂ̗tɑ΂callbackĂяo܂. callbackfalseԂƒTł؂܂.
+	*  @param[in] const geometry::AABB& {bNX
+	*  @param[in] Function&& bool(gu::int32 proxyID)
+	*  @return    void
+	*************************************************************************/
+	template<class Function>
+	void DynamicAABBTree::Query(const geometry::AABB& box, Function&& callback) const
+	{
+		if (_root == details::tree::NULL_NODE) { return; }
+
+		gu::int32  localStack[details::tree::STACK_CAPACITY];
+		gu::DynamicArray<gu::int32> heapStack = {}; // ؂΂localStackꂽꍇɂmۂ܂
+		gu::int32* stack         = localStack;
+		gu::int32  stackCapacity = details::tree::STACK_CAPACITY;
+		gu::int32  stackCount    = 0;
+		stack[stackCount++] = _root;
+
+		const DynamicAABBTreeNode* nodes = &_nodes[0];
+		while (stackCount > 0)
+		{
+			const DynamicAABBTreeNode& node = nodes[stack[--stackCount]];
+			if (!node.Box.Overlaps(box)) { continue; }
+
+			if (node.IsLeaf())
+			{
+				if (!callback(static_cast<gu::int32>(&node - nodes))) { return; }
+			}
+			else
+			{
+				if (stackCount + 2 > stackCapacity)
+				{
+					stackCapacity *= 2;
+					heapStack.Resize(stackCapacity);
+					if (stack == localStack)
+					{
+						for (gu::int32 i = 0; i < stackCount; ++i) { heapStack[i] = localStack[i]; }
+					}
+					stack = heapStack.Data();
+				}
+				stack[stackCount++] = node.Child1;
+				stack[stackCount++] = node.Child2;
+			}
+		}
+	}
+}
+
+#endif
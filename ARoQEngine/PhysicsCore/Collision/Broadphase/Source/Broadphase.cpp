@@ -0,0 +1,319 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   Broadphase.cpp
+///  @brief  IAABB؂p, E{bNXdȂĂAN^[̑g܂Ƃ߂ċ߂܂.
+///  @author toide
+///  @date   2026/10/20 6:10:42
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/Broadphase.hpp"
+#include "GameUtility/Math/Include/GMSort.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <vector>
+#include <future>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics::collision;
+using namespace physics::collision::details::broadphase;
+using namespace physics::geometry;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			2ID, 32bitɒuL[܂
+	-----------------------------------------------------------------*/
+	__forceinline uint64 MakePairKey(const int32 a, const int32 b)
+	{
+		return a < b ? (static_cast<uint64>(a) << 32) | static_cast<uint32>(b)
+		             : (static_cast<uint64>(b) << 32) | static_cast<uint32>(a);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     vLV쐬܂. UpdatePairsŏdȂĂg񍐂܂.
+*  @param[in] const geometry::AABB& AN^[̋E{bNX
+*  @param[in] const gu::uint64 p҂̒l
+*  @return    gu::int32 vLVID
+*************************************************************************/
+int32 Broadphase::CreateProxy(const AABB& box, const uint64 userData)
+{
+	const int32 proxyID = _tree.CreateProxy(box, userData);
+	_moveBuffer.Push(proxyID);
+	return proxyID;
+}
+
+/*!**********************************************************************
+*  @brief     vLVj܂. ړobt@ɎcĂID, TɗtłȂΓǂݔ΂܂.
+*  @param[in] const gu::int32 vLVID
+*  @return    void
+*************************************************************************/
+void Broadphase::DestroyProxy(const int32 proxyID)
+{
+	_tree.DestroyProxy(proxyID);
+}
+
+/*!**********************************************************************
+*  @brief     vLṼ{bNXXV܂. ؂ɑ}ꍇ͈ړobt@ɐς݂܂.
+*  @param[in] const gu::int32 vLVID
+*  @param[in] const geometry::AABB& AN^[̐VE{bNX
+*  @param[in] const gm::Float3& O񂩂̈ړ
+*  @return    void
+*************************************************************************/
+void Broadphase::MoveProxy(const int32 proxyID, const AABB& box, const gm::Float3& displacement)
+{
+	const bool wasMoved = _tree.WasMoved(proxyID);
+	if (_tree.MoveProxy(proxyID, box, displacement) && !wasMoved)
+	{
+		_moveBuffer.Push(proxyID);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     {bNXςĂȂĂ, UpdatePairsŃvLV̑g񍐂܂.
+*  @param[in] const gu::int32 vLVID
+*  @return    void
+*************************************************************************/
+void Broadphase::TouchProxy(const int32 proxyID)
+{
+	_moveBuffer.Push(proxyID);
+}
+
+/*!**********************************************************************
+*  @brief     ړobt@̃vLV܂, L{bNXdȂĂg߂܂. ړobt@͋ɂȂ܂.
+*  @param[out] gu::DynamicArray<BroadphasePair>& g
+*  @return    void
+*************************************************************************/
+void Broadphase::UpdatePairs(DynamicArray<BroadphasePair>& pairs)
+{
+	ComputePairs(pairs, true, nullptr);
+}
+
+/*!**********************************************************************
+*  @brief     UpdatePairsXbhōs܂.
+*  @param[out] gu::DynamicArray<BroadphasePair>& g
+*  @param[in]  gu::ThreadPool& TsXbhv[
+*  @return    void
+*************************************************************************/
+void Broadphase::UpdatePairs(DynamicArray<BroadphasePair>& pairs, ThreadPool& threadPool)
+{
+	ComputePairs(pairs, true, &threadPool);
+}
+
+/*!**********************************************************************
+*  @brief     ړɊ֌WȂ, L{bNXdȂĂSĂ̑g߂܂.
+*  @param[out] gu::DynamicArray<BroadphasePair>& g
+*  @return    void
+*************************************************************************/
+void Broadphase::QueryAllPairs(DynamicArray<BroadphasePair>& pairs)
+{
+	ComputePairs(pairs, false, nullptr);
+}
+
+/*!**********************************************************************
+*  @brief     QueryAllPairsXbhōs܂.
+*  @param[out] gu::DynamicArray<BroadphasePair>& g
+*  @param[in]  gu::ThreadPool& TsXbhv[
+*  @return    void
+*************************************************************************/
+void Broadphase::QueryAllPairs(DynamicArray<BroadphasePair>& pairs, ThreadPool& threadPool)
+{
+	ComputePairs(pairs, false, &threadPool);
+}
+
+/*!**********************************************************************
+*  @brief     ؂č\z܂. L{bNX͕ςȂ, ܂g͕ς܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void Broadphase::RebuildTree()
+{
+	_tree.Rebuild();
+}
+
+/*!**********************************************************************
+*  @brief     SẴvLVj܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void Broadphase::Clear()
+{
+	_tree.Clear();
+	_moveBuffer.Clear();
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     yAvZ𒀎, ܂̓Xbhōs܂. @n
+*             T͖؂ύXȂ, TvLV͈͂ŕ, ^XNƂ̃L[z֏݂܂.
+*************************************************************************/
+void Broadphase::ComputePairs(DynamicArray<BroadphasePair>& pairs, const bool onlyMoved, ThreadPool* threadPool)
+{
+	GatherQueries(onlyMoved);
+	_pairKeys.Clear();
+
+	const uint64 queryCount  = _queries.Size();
+	const uint32 threadCount = threadPool ? threadPool->GetThreadCount() : 1;
+	if (threadCount <= 1 || queryCount < 2ull * MIN_QUERIES_PER_TASK)
+	{
+		CollectPairs(0, queryCount, onlyMoved, _pairKeys);
+	}
+	else
+	{
+		uint64 taskCount = static_cast<uint64>(threadCount) * TASKS_PER_THREAD;
+		if (taskCount > queryCount / MIN_QUERIES_PER_TASK) { taskCount = queryCount / MIN_QUERIES_PER_TASK; }
+		if (_taskPairKeys.Size() < taskCount) { _taskPairKeys.Resize(taskCount); }
+
+		std::vector<std::future<void>> futures;
+		futures.reserve(taskCount);
+		for (uint64 task = 0; task < taskCount; ++task)
+		{
+			const uint64 begin = queryCount * task       / taskCount;
+			const uint64 end   = queryCount * (task + 1) / taskCount;
+			DynamicArray<uint64>* keys = &_taskPairKeys[task];
+			futures.push_back(threadPool->Submit([this, begin, end, onlyMoved, keys]()
+			{
+				keys->Clear();
+				CollectPairs(begin, end, onlyMoved, *keys);
+			}));
+		}
+		for (auto& future : futures) { future.get(); }
+
+		/*-------------------------------------------------------------------
+		-      ^XNƂ̌ʂA܂
+		---------------------------------------------------------------------*/
+		uint64 totalCount = 0;
+		for (uint64 task = 0; task < taskCount; ++task) { totalCount += _taskPairKeys[task].Size(); }
+
+		_pairKeys.Resize(totalCount);
+		uint64 offset = 0;
+		for (uint64 task = 0; task < taskCount; ++task)
+		{
+			const auto& keys = _taskPairKeys[task];
+			if (keys.IsEmpty()) { continue; }
+			Memory::Copy(&_pairKeys[offset], &keys[0], keys.Size() * sizeof(uint64));
+			offset += keys.Size();
+		}
+	}
+
+	SortPairs(pairs);
+	if (onlyMoved) { ClearMoveBuffer(); }
+}
+
+/*!**********************************************************************
+*  @brief     TvLV̈ꗗ쐬܂. onlyMovedfalsȅꍇ͑SĂ̗tׂ܂.
+*************************************************************************/
+void Broadphase::GatherQueries(const bool onlyMoved)
+{
+	_queries.Clear();
+
+	const auto& nodes = _tree.GetNodes();
+	if (onlyMoved)
+	{
+		_queries.Reserve(_moveBuffer.Size());
+		for (uint64 i = 0; i < _moveBuffer.Size(); ++i)
+		{
+			// ړɔjꂽvLV͓ǂݔ΂܂ (ėpĂĂdSortPairsŎ菜܂)
+			const int32 proxyID = _moveBuffer[i];
+			if (nodes[proxyID].Height != 0) { continue; }
+			_queries.Push(proxyID);
+		}
+	}
+	else
+	{
+		_queries.Reserve(static_cast<uint64>(_tree.GetProxyCount()));
+		for (uint64 i = 0; i < nodes.Size(); ++i)
+		{
+			if (nodes[i].Height == 0) { _queries.Push(static_cast<int32>(i)); }
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     [begin, end)̃vLVŖ؂T, gL[ƂĒǉ܂. @n
+*             SĂ̑g߂ꍇ, ID傫肾ǉďdh܂. @n
+*             ړg߂ꍇ, ړĂID傫̒TɔC܂.
+*************************************************************************/
+void Broadphase::CollectPairs(const uint64 begin, const uint64 end, const bool onlyMoved, DynamicArray<uint64>& keys) const
+{
+	for (uint64 i = begin; i < end; ++i)
+	{
+		const int32 queryID = _queries[i];
+		const AABB& box     = _tree.GetFatAABB(queryID);
+
+		if (onlyMoved)
+		{
+			_tree.Query(box, [&](const int32 proxyID)
+			{
+				if (proxyID == queryID) { return true; }
+				if (proxyID > queryID && _tree.WasMoved(proxyID)) { return true; }
+
+				keys.Push(MakePairKey(queryID, proxyID));
+				return true;
+			});
+		}
+		else
+		{
+			_tree.Query(box, [&](const int32 proxyID)
+			{
+				if (proxyID <= queryID) { return true; }
+
+				keys.Push(MakePairKey(queryID, proxyID));
+				return true;
+			});
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     L[\[gŕבւďd菜, gɕϊ܂. sʂ̏Ԃ͈ł.
+*************************************************************************/
+void Broadphase::SortPairs(DynamicArray<BroadphasePair>& pairs)
+{
+	pairs.Clear();
+
+	const uint64 keyCount = _pairKeys.Size();
+	if (keyCount == 0) { return; }
+
+	if (_sortBuffer.Size() < keyCount) { _sortBuffer.Resize(keyCount); }
+	gm::Sort<uint64>::RadixSort(&_pairKeys[0], keyCount, &_sortBuffer[0]);
+
+	pairs.Reserve(keyCount);
+	uint64 previous = ~0ull;
+	for (uint64 i = 0; i < keyCount; ++i)
+	{
+		const uint64 key = _pairKeys[i];
+		if (key == previous) { continue; }
+		previous = key;
+
+		BroadphasePair pair = {};
+		pair.ProxyA = static_cast<int32>(key >> 32);
+		pair.ProxyB = static_cast<int32>(key & 0xFFFFFFFFull);
+		pairs.Push(pair);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ړobt@̃vLṼtO낵, obt@ɂ܂.
+*************************************************************************/
+void Broadphase::ClearMoveBuffer()
+{
+	const auto& nodes = _tree.GetNodes();
+	for (uint64 i = 0; i < _moveBuffer.Size(); ++i)
+	{
+		const int32 proxyID = _moveBuffer[i];
+		if (nodes[proxyID].Height == 0) { _tree.ClearMoved(proxyID); }
+	}
+	_moveBuffer.Clear();
+}
+#pragma endregion Protected Function
@@ -0,0 +1,713 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DynamicAABBTree.cpp
+///  @brief  ړAN^[̋E{bNXtɎIAABB؂ł.
+///  @author toide
+///  @date   2026/10/20 6:10:42
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/DynamicAABBTree.hpp"
+#include <cfloat>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics::collision;
+using namespace physics::collision::details::tree;
+using namespace physics::geometry;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			傫̒lԂ܂
+	-----------------------------------------------------------------*/
+	__forceinline int32 MaxHeight(const int32 a, const int32 b)
+	{
+		return a > b ? a : b;
+	}
+
+	/*---------------------------------------------------------------
+			}̒TŎgp
+	-----------------------------------------------------------------*/
+	struct InsertCandidate
+	{
+		int32 Node;
+		float InheritedCost;
+		float LowerBound;
+	};
+
+	constexpr int32 INSERT_HEAP_CAPACITY = 256;
+
+	/*---------------------------------------------------------------
+			ŏ̌擪ɕۂ񕪃q[v֒ǉ܂
+	-----------------------------------------------------------------*/
+	__forceinline void PushCandidate(InsertCandidate* heap, int32& count, const InsertCandidate& candidate)
+	{
+		int32 i = count++;
+		while (i > 0)
+		{
+			const int32 parent = (i - 1) >> 1;
+			if (heap[parent].LowerBound <= candidate.LowerBound) { break; }
+			heap[i] = heap[parent];
+			i = parent;
+		}
+		heap[i] = candidate;
+	}
+
+	/*---------------------------------------------------------------
+			ŏ̌o܂
+	-----------------------------------------------------------------*/
+	__forceinline InsertCandidate PopCandidate(InsertCandidate* heap, int32& count)
+	{
+		const InsertCandidate top  = heap[0];
+		const InsertCandidate last = heap[--count];
+
+		int32 i = 0;
+		while (true)
+		{
+			int32 child = 2 * i + 1;
+			if (child >= count) { break; }
+			if (child + 1 < count && heap[child + 1].LowerBound < heap[child].LowerBound) { ++child; }
+			if (last.LowerBound <= heap[child].LowerBound) { break; }
+			heap[i] = heap[child];
+			i = child;
+		}
+		if (count > 0) { heap[i] = last; }
+		return top;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     vLV쐬, ]{bNXŖ؂ɑ}܂.
+*  @param[in] const geometry::AABB& AN^[̋E{bNX
+*  @param[in] const gu::uint64 p҂̒l
+*  @return    gu::int32 vLVID
+*************************************************************************/
+int32 DynamicAABBTree::CreateProxy(const AABB& box, const uint64 userData)
+{
+	const int32 proxyID = AllocateNode();
+
+	DynamicAABBTreeNode& node = _nodes[proxyID];
+	node.Box      = box.Expand(AABB_MARGIN);
+	node.UserData = userData;
+	node.Height   = 0;
+	node.Moved    = true;
+
+	InsertLeaf(proxyID);
+	++_proxyCount;
+	return proxyID;
+}
+
+/*!**********************************************************************
+*  @brief     vLV؂菜, j܂.
+*  @param[in] const gu::int32 vLVID
+*  @return    void
+*************************************************************************/
+void DynamicAABBTree::DestroyProxy(const int32 proxyID)
+{
+	Check(0 <= proxyID && proxyID < static_cast<int32>(_nodes.Size()));
+	Check(_nodes[proxyID].IsLeaf() && _nodes[proxyID].Height == 0);
+
+	RemoveLeaf(proxyID);
+	FreeNode(proxyID);
+	--_proxyCount;
+}
+
+/*!**********************************************************************
+*  @brief     vLṼ{bNXXV܂. i[ς݂̃{bNXɎ܂Ăꍇ͉܂. @n
+*             ܂Ȃꍇ͗]ƈړʂ̕L{bNXő}܂.
+*  @param[in] const gu::int32 vLVID
+*  @param[in] const geometry::AABB& AN^[̐VE{bNX
+*  @param[in] const gm::Float3& O񂩂̈ړ
+*  @return    bool }ꍇtrue
+*************************************************************************/
+bool DynamicAABBTree::MoveProxy(const int32 proxyID, const AABB& box, const gm::Float3& displacement)
+{
+	Check(0 <= proxyID && proxyID < static_cast<int32>(_nodes.Size()));
+	Check(_nodes[proxyID].IsLeaf() && _nodes[proxyID].Height == 0);
+
+	/*-------------------------------------------------------------------
+	-      ], ړֈړʂ̐{L܂
+	---------------------------------------------------------------------*/
+	AABB fatBox = box.Expand(AABB_MARGIN);
+	const gm::Float3 d(DISPLACEMENT_MULTIPLIER * displacement.x, DISPLACEMENT_MULTIPLIER * displacement.y, DISPLACEMENT_MULTIPLIER * displacement.z);
+	if (d.x < 0.0f) { fatBox.Min.x += d.x; } else { fatBox.Max.x += d.x; }
+	if (d.y < 0.0f) { fatBox.Min.y += d.y; } else { fatBox.Max.y += d.y; }
+	if (d.z < 0.0f) { fatBox.Min.z += d.z; } else { fatBox.Max.z += d.z; }
+
+	/*-------------------------------------------------------------------
+	-      i[ς݂̃{bNXɎ܂ĂΖ؂͕ύX܂.
+	-      , ȂǂŊi[ς݂̃{bNX傫ꍇ͋ȔdȂ肪邽ߑ}܂
+	---------------------------------------------------------------------*/
+	const AABB& treeBox = _nodes[proxyID].Box;
+	if (treeBox.Contains(box))
+	{
+		const AABB hugeBox = fatBox.Expand(4.0f * AABB_MARGIN);
+		if (hugeBox.Contains(treeBox)) { return false; }
+	}
+
+	RemoveLeaf(proxyID);
+	_nodes[proxyID].Box   = fatBox;
+	_nodes[proxyID].Moved = true;
+	InsertLeaf(proxyID);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     tcēm[h蒼, rSAHŃgbv_Eɖ؂č\z܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DynamicAABBTree::Rebuild()
+{
+	if (_proxyCount < 2) { return; }
+
+	/*-------------------------------------------------------------------
+	-      tW, m[h͑SĖgpXg֖߂܂
+	---------------------------------------------------------------------*/
+	_buildLeaves .Clear();
+	_buildCenters.Clear();
+	_buildLeaves .Reserve(static_cast<uint64>(_proxyCount));
+	_buildCenters.Reserve(static_cast<uint64>(_proxyCount));
+
+	for (uint64 i = 0; i < _nodes.Size(); ++i)
+	{
+		DynamicAABBTreeNode& node = _nodes[i];
+		if (node.Height == 0)
+		{
+			_buildLeaves .Push(static_cast<int32>(i));
+			_buildCenters.Push(node.Box.GetCenter());
+		}
+		else if (node.Height > 0)
+		{
+			FreeNode(static_cast<int32>(i));
+		}
+	}
+
+	_root = BuildSubtree(0, static_cast<int32>(_buildLeaves.Size()));
+	_nodes[_root].ParentOrNext = NULL_NODE;
+}
+
+/*!**********************************************************************
+*  @brief     SẴm[hj܂. mۍς݂̔z͍ėp̂ߎc܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void DynamicAABBTree::Clear()
+{
+	_nodes.Clear();
+	_root       = NULL_NODE;
+	_freeList   = NULL_NODE;
+	_proxyCount = 0;
+}
+
+/*!**********************************************************************
+*  @brief     ؂̍\ƃ{bNX؂܂. fobOp, m[hɔႵԂ܂.
+*  @param[in] void
+*  @return    bool
+*************************************************************************/
+bool DynamicAABBTree::Validate() const
+{
+	if (_root != NULL_NODE && _nodes[_root].ParentOrNext != NULL_NODE) { return false; }
+	if (!ValidateNode(_root)) { return false; }
+
+	/*-------------------------------------------------------------------
+	-      gp̃m[hƖgpXg̃m[h̐z̗vfƈv邩
+	---------------------------------------------------------------------*/
+	int32 usedCount = 0;
+	int32 leafCount = 0;
+	for (uint64 i = 0; i < _nodes.Size(); ++i)
+	{
+		if (_nodes[i].Height < 0) { continue; }
+		++usedCount;
+		if (_nodes[i].Height == 0) { ++leafCount; }
+	}
+
+	int32 freeCount = 0;
+	for (int32 node = _freeList; node != NULL_NODE; node = _nodes[node].ParentOrNext)
+	{
+		if (_nodes[node].Height != -1) { return false; }
+		++freeCount;
+	}
+
+	return leafCount == _proxyCount && usedCount + freeCount == static_cast<int32>(_nodes.Size());
+}
+#pragma endregion Public Function
+
+#pragma region Public Property
+/*!**********************************************************************
+*  @brief     Sm[h̕\ʐς̍v[g̕\ʐςŊl. قǒT؂ł.
+*  @param[in] void
+*  @return    float
+*************************************************************************/
+float DynamicAABBTree::GetAreaRatio() const
+{
+	if (_root == NULL_NODE) { return 0.0f; }
+
+	float totalArea = 0.0f;
+	for (uint64 i = 0; i < _nodes.Size(); ++i)
+	{
+		if (_nodes[i].Height < 0) { continue; }
+		totalArea += _nodes[i].Box.GetSurfaceArea();
+	}
+	return totalArea / _nodes[_root].Box.GetSurfaceArea();
+}
+#pragma endregion Public Property
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     gp̃m[ho܂. Δzg܂. @n
+*             gŊ̃m[h̎QƂɂȂ邽, Ăяo͎QƂێȂł.
+*************************************************************************/
+int32 DynamicAABBTree::AllocateNode()
+{
+	int32 node = NULL_NODE;
+	if (_freeList == NULL_NODE)
+	{
+		node = static_cast<int32>(_nodes.Size());
+		_nodes.Push(DynamicAABBTreeNode());
+	}
+	else
+	{
+		node = _freeList;
+		_freeList = _nodes[node].ParentOrNext;
+		_nodes[node] = DynamicAABBTreeNode();
+	}
+
+	_nodes[node].Height = 0;
+	return node;
+}
+
+/*!**********************************************************************
+*  @brief     m[h𖢎gpXg֖߂܂.
+*************************************************************************/
+void DynamicAABBTree::FreeNode(const int32 node)
+{
+	_nodes[node].ParentOrNext = _freeList;
+	_nodes[node].Height       = -1;
+	_nodes[node].Moved        = false;
+	_freeList = node;
+}
+
+/*!**********************************************************************
+*  @brief     SAH̃RXgŏƂȂZT, t}܂. @n
+*             Ž₲Ƃ̃RXg, Ve̕\ʐς, c悪L镪̕\ʐ(pRXg)̘ał. @n
+*             ×~Ɏq֍~@̓_ȏԂő}Ɩ؂̎傫邽, @n
+*             Bittner̕}@ŉgĎ}Ȃ, RXgŏ̌Zɋ߂܂.
+*************************************************************************/
+void DynamicAABBTree::InsertLeaf(const int32 leaf)
+{
+	if (_root == NULL_NODE)
+	{
+		_root = leaf;
+		_nodes[_root].ParentOrNext = NULL_NODE;
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-      ZƂȂm[h𕪎}@ŒT܂
+	---------------------------------------------------------------------*/
+	const AABB  leafBox  = _nodes[leaf].Box;
+	const float leafArea = leafBox.GetSurfaceArea();
+
+	int32 index    = _root;
+	float bestCost = AABB::Union(_nodes[_root].Box, leafBox).GetSurfaceArea();
+
+	// ₩璲ׂ񕪃q[v (ꂽׂ͒Ɏ̂Ă܂)
+	InsertCandidate heap[INSERT_HEAP_CAPACITY];
+	int32 heapCount = 0;
+	PushCandidate(heap, heapCount, { _root, 0.0f, 0.0f });
+
+	while (heapCount > 0)
+	{
+		const InsertCandidate candidate = PopCandidate(heap, heapCount);
+		if (candidate.LowerBound >= bestCost) { break; }
+
+		const DynamicAABBTreeNode& node = _nodes[candidate.Node];
+		const float combinedArea = AABB::Union(node.Box, leafBox).GetSurfaceArea();
+
+		// ̃m[hƗt̐eVꍇ̃RXg
+		const float directCost = combinedArea + candidate.InheritedCost;
+		if (directCost < bestCost)
+		{
+			bestCost = directCost;
+			index    = candidate.Node;
+		}
+
+		if (node.IsLeaf()) { continue; }
+
+		// qZƂꍇ, ̃m[hL邽ߌpRXgɉ܂.
+		// q̐Ve͏ȂƂt̕\ʐς, Ƃ, ŗǂ̃RXgȂΎ}܂
+		const float childInheritedCost = candidate.InheritedCost + combinedArea - node.Box.GetSurfaceArea();
+		const float childLowerBound    = leafArea + childInheritedCost;
+		if (childLowerBound >= bestCost) { continue; }
+
+		if (heapCount + 2 > INSERT_HEAP_CAPACITY) { continue; }
+		PushCandidate(heap, heapCount, { node.Child1, childInheritedCost, childLowerBound });
+		PushCandidate(heap, heapCount, { node.Child2, childInheritedCost, childLowerBound });
+	}
+
+	/*-------------------------------------------------------------------
+	-      ZƗt܂Ƃ߂e쐬܂ (m[h̊mۂŎQƂɂȂ邽, mیɃANZX܂)
+	---------------------------------------------------------------------*/
+	const int32 sibling   = index;
+	const int32 newParent = AllocateNode();
+	const int32 oldParent = _nodes[sibling].ParentOrNext;
+
+	DynamicAABBTreeNode& parent = _nodes[newParent];
+	parent.ParentOrNext = oldParent;
+	parent.Box          = AABB::Union(leafBox, _nodes[sibling].Box);
+	parent.Height       = _nodes[sibling].Height + 1;
+	parent.Child1       = sibling;
+	parent.Child2       = leaf;
+
+	if (oldParent != NULL_NODE)
+	{
+		if (_nodes[oldParent].Child1 == sibling) { _nodes[oldParent].Child1 = newParent; }
+		else                                     { _nodes[oldParent].Child2 = newParent; }
+	}
+	else
+	{
+		_root = newParent;
+	}
+	_nodes[sibling].ParentOrNext = newParent;
+	_nodes[leaf]   .ParentOrNext = newParent;
+
+	/*-------------------------------------------------------------------
+	-      c̃{bNXƍXV܂
+	---------------------------------------------------------------------*/
+	RefitAncestors(_nodes[leaf].ParentOrNext);
+}
+
+/*!**********************************************************************
+*  @brief     t؂菜܂. e͌ZŒuĔj, cXV܂.
+*************************************************************************/
+void DynamicAABBTree::RemoveLeaf(const int32 leaf)
+{
+	if (leaf == _root)
+	{
+		_root = NULL_NODE;
+		return;
+	}
+
+	const int32 parent      = _nodes[leaf].ParentOrNext;
+	const int32 grandParent = _nodes[parent].ParentOrNext;
+	const int32 sibling     = _nodes[parent].Child1 == leaf ? _nodes[parent].Child2 : _nodes[parent].Child1;
+
+	if (grandParent != NULL_NODE)
+	{
+		if (_nodes[grandParent].Child1 == parent) { _nodes[grandParent].Child1 = sibling; }
+		else                                      { _nodes[grandParent].Child2 = sibling; }
+		_nodes[sibling].ParentOrNext = grandParent;
+		FreeNode(parent);
+
+		RefitAncestors(grandParent);
+	}
+	else
+	{
+		_root = sibling;
+		_nodes[sibling].ParentOrNext = NULL_NODE;
+		FreeNode(parent);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     w肵m[h獪܂, ]ŕtۂȂ{bNXƍXV܂.
+*************************************************************************/
+void DynamicAABBTree::RefitAncestors(int32 node)
+{
+	while (node != NULL_NODE)
+	{
+		node = Balance(node);
+
+		DynamicAABBTreeNode& current = _nodes[node];
+		const DynamicAABBTreeNode& child1 = _nodes[current.Child1];
+		const DynamicAABBTreeNode& child2 = _nodes[current.Child2];
+
+		current.Height = 1 + MaxHeight(child1.Height, child2.Height);
+		current.Box    = AABB::Union(child1.Box, child2.Box);
+
+		node = current.ParentOrNext;
+	}
+}
+
+/*!**********************************************************************
+*  @brief     q̍̍2ȏ̏ꍇ, ̎qグ]s, ؂̐VԂ܂. @n
+*             グq2̑̂, グqɎc, ႢA֓n܂.
+*
+*               A              C
+*              / \            / \
+*             B   C    ->    A   F ()
+*                / \        / \
+*               F   G      B   G
+*************************************************************************/
+int32 DynamicAABBTree::Balance(const int32 iA)
+{
+	DynamicAABBTreeNode& A = _nodes[iA];
+	if (A.IsLeaf() || A.Height < 2) { return iA; }
+
+	const int32 iB = A.Child1;
+	const int32 iC = A.Child2;
+	DynamicAABBTreeNode& B = _nodes[iB];
+	DynamicAABBTreeNode& C = _nodes[iC];
+
+	const int32 balance = C.Height - B.Height;
+
+	/*-------------------------------------------------------------------
+	-      Cグ܂
+	---------------------------------------------------------------------*/
+	if (balance > 1)
+	{
+		const int32 iF = C.Child1;
+		const int32 iG = C.Child2;
+		DynamicAABBTreeNode& F = _nodes[iF];
+		DynamicAABBTreeNode& G = _nodes[iG];
+
+		C.Child1       = iA;
+		C.ParentOrNext = A.ParentOrNext;
+		A.ParentOrNext = iC;
+
+		if (C.ParentOrNext != NULL_NODE)
+		{
+			if (_nodes[C.ParentOrNext].Child1 == iA) { _nodes[C.ParentOrNext].Child1 = iC; }
+			else                                     { _nodes[C.ParentOrNext].Child2 = iC; }
+		}
+		else
+		{
+			_root = iC;
+		}
+
+		if (F.Height > G.Height)
+		{
+			C.Child2       = iF;
+			A.Child2       = iG;
+			G.ParentOrNext = iA;
+			A.Box    = AABB::Union(B.Box, G.Box);
+			C.Box    = AABB::Union(A.Box, F.Box);
+			A.Height = 1 + MaxHeight(B.Height, G.Height);
+			C.Height = 1 + MaxHeight(A.Height, F.Height);
+		}
+		else
+		{
+			C.Child2       = iG;
+			A.Child2       = iF;
+			F.ParentOrNext = iA;
+			A.Box    = AABB::Union(B.Box, F.Box);
+			C.Box    = AABB::Union(A.Box, G.Box);
+			A.Height = 1 + MaxHeight(B.Height, F.Height);
+			C.Height = 1 + MaxHeight(A.Height, G.Height);
+		}
+		return iC;
+	}
+
+	/*-------------------------------------------------------------------
+	-      Bグ܂
+	---------------------------------------------------------------------*/
+	if (balance < -1)
+	{
+		const int32 iD = B.Child1;
+		const int32 iE = B.Child2;
+		DynamicAABBTreeNode& D = _nodes[iD];
+		DynamicAABBTreeNode& E = _nodes[iE];
+
+		B.Child1       = iA;
+		B.ParentOrNext = A.ParentOrNext;
+		A.ParentOrNext = iB;
+
+		if (B.ParentOrNext != NULL_NODE)
+		{
+			if (_nodes[B.ParentOrNext].Child1 == iA) { _nodes[B.ParentOrNext].Child1 = iB; }
+			else                                     { _nodes[B.ParentOrNext].Child2 = iB; }
+		}
+		else
+		{
+			_root = iB;
+		}
+
+		if (D.Height > E.Height)
+		{
+			B.Child2       = iD;
+			A.Child1       = iE;
+			E.ParentOrNext = iA;
+			A.Box    = AABB::Union(C.Box, E.Box);
+			B.Box    = AABB::Union(A.Box, D.Box);
+			A.Height = 1 + MaxHeight(C.Height, E.Height);
+			B.Height = 1 + MaxHeight(A.Height, D.Height);
+		}
+		else
+		{
+			B.Child2       = iE;
+			A.Child1       = iD;
+			D.ParentOrNext = iA;
+			A.Box    = AABB::Union(C.Box, D.Box);
+			B.Box    = AABB::Union(A.Box, E.Box);
+			A.Height = 1 + MaxHeight(C.Height, D.Height);
+			B.Height = 1 + MaxHeight(A.Height, E.Height);
+		}
+		return iB;
+	}
+
+	return iA;
+}
+
+/*!**********************************************************************
+*  @brief     _buildLeaves[begin, end)̗t畔؂쐬, ̍Ԃ܂. @n
+*             S͈̔͂łLrɕ, E (t̐ x \ʐ) ̘aŏƂȂ鋫Eŕ܂. @n
+*             SdȂĂĕłȂꍇ, Ŕɕ܂.
+*************************************************************************/
+int32 DynamicAABBTree::BuildSubtree(const int32 begin, const int32 end)
+{
+	const int32 count = end - begin;
+	if (count == 1) { return _buildLeaves[begin]; }
+
+	/*-------------------------------------------------------------------
+	-      S͈̔͂łLIт܂
+	---------------------------------------------------------------------*/
+	AABB centerBounds(_buildCenters[begin], _buildCenters[begin]);
+	for (int32 i = begin + 1; i < end; ++i)
+	{
+		centerBounds = AABB::Union(centerBounds, AABB(_buildCenters[i], _buildCenters[i]));
+	}
+
+	const gm::Float3 size = gm::Float3(centerBounds.Max.x - centerBounds.Min.x, centerBounds.Max.y - centerBounds.Min.y, centerBounds.Max.z - centerBounds.Min.z);
+	const int32 axis       = size.x >= size.y && size.x >= size.z ? 0 : (size.y >= size.z ? 1 : 2);
+	const float axisMin    = axis == 0 ? centerBounds.Min.x : (axis == 1 ? centerBounds.Min.y : centerBounds.Min.z);
+	const float axisExtent = axis == 0 ? size.x : (axis == 1 ? size.y : size.z);
+
+	int32 middle = begin + count / 2;
+	if (axisExtent > 0.0f)
+	{
+		/*-------------------------------------------------------------------
+		-      rƂɗt̐ƃ{bNXW߂܂
+		---------------------------------------------------------------------*/
+		int32 binCounts[REBUILD_BIN_COUNT] = {};
+		AABB  binBoxes [REBUILD_BIN_COUNT];
+		const float binScale = static_cast<float>(REBUILD_BIN_COUNT) / axisExtent;
+
+		const auto GetBin = [&](const int32 i)
+		{
+			const gm::Float3& c = _buildCenters[i];
+			const float value   = axis == 0 ? c.x : (axis == 1 ? c.y : c.z);
+			const int32 bin     = static_cast<int32>((value - axisMin) * binScale);
+			return bin < REBUILD_BIN_COUNT - 1 ? bin : REBUILD_BIN_COUNT - 1;
+		};
+
+		for (int32 i = begin; i < end; ++i)
+		{
+			const int32 bin = GetBin(i);
+			const AABB& box = _nodes[_buildLeaves[i]].Box;
+			binBoxes[bin]   = binCounts[bin] == 0 ? box : AABB::Union(binBoxes[bin], box);
+			++binCounts[bin];
+		}
+
+		/*-------------------------------------------------------------------
+		-      Eݐς\ʐς, 瑖čŏRXg̋ET܂
+		---------------------------------------------------------------------*/
+		float rightAreas [REBUILD_BIN_COUNT] = {};
+		int32 rightCounts[REBUILD_BIN_COUNT] = {};
+		AABB  accumulated = {};
+		int32 accumulatedCount = 0;
+		for (int32 bin = REBUILD_BIN_COUNT - 1; bin > 0; --bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				accumulated = accumulatedCount == 0 ? binBoxes[bin] : AABB::Union(accumulated, binBoxes[bin]);
+				accumulatedCount += binCounts[bin];
+			}
+			rightAreas [bin] = accumulatedCount > 0 ? accumulated.GetSurfaceArea() : 0.0f;
+			rightCounts[bin] = accumulatedCount;
+		}
+
+		int32 bestSplit = -1;
+		float bestCost  = FLT_MAX;
+		accumulatedCount = 0;
+		for (int32 bin = 0; bin < REBUILD_BIN_COUNT - 1; ++bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				accumulated = accumulatedCount == 0 ? binBoxes[bin] : AABB::Union(accumulated, binBoxes[bin]);
+				accumulatedCount += binCounts[bin];
+			}
+			if (accumulatedCount == 0 || rightCounts[bin + 1] == 0) { continue; }
+
+			const float cost = accumulatedCount * accumulated.GetSurfaceArea() + rightCounts[bin + 1] * rightAreas[bin + 1];
+			if (cost < bestCost)
+			{
+				bestCost  = cost;
+				bestSplit = bin;
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-      E荶̃r̗tOɏW߂܂
+		---------------------------------------------------------------------*/
+		if (bestSplit >= 0)
+		{
+			int32 left  = begin;
+			int32 right = end - 1;
+			while (left <= right)
+			{
+				if (GetBin(left) <= bestSplit) { ++left; continue; }
+
+				const int32      leafTemp   = _buildLeaves[left];
+				const gm::Float3 centerTemp = _buildCenters[left];
+				_buildLeaves [left]  = _buildLeaves[right];
+				_buildCenters[left]  = _buildCenters[right];
+				_buildLeaves [right] = leafTemp;
+				_buildCenters[right] = centerTemp;
+				--right;
+			}
+			if (left > begin && left < end) { middle = left; }
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-      q쐬Ăemۂ܂ (mۂŔz񂪐LтĂQƂɂȂȂ悤, CfbNXň܂)
+	---------------------------------------------------------------------*/
+	const int32 child1 = BuildSubtree(begin, middle);
+	const int32 child2 = BuildSubtree(middle, end);
+	const int32 parent = AllocateNode();
+
+	DynamicAABBTreeNode& node = _nodes[parent];
+	node.Child1 = child1;
+	node.Child2 = child2;
+	node.Box    = AABB::Union(_nodes[child1].Box, _nodes[child2].Box);
+	node.Height = 1 + MaxHeight(_nodes[child1].Height, _nodes[child2].Height);
+	node.Moved  = false;
+	_nodes[child1].ParentOrNext = parent;
+	_nodes[child2].ParentOrNext = parent;
+	return parent;
+}
+
+/*!**********************************************************************
+*  @brief     ؂̍\ƃ{bNXċAIɌ؂܂.
+*************************************************************************/
+bool DynamicAABBTree::ValidateNode(const int32 index) const
+{
+	if (index == NULL_NODE) { return true; }
+
+	const DynamicAABBTreeNode& node = _nodes[index];
+	if (node.IsLeaf())
+	{
+		return node.Child2 == NULL_NODE && node.Height == 0;
+	}
+
+	const int32 child1 = node.Child1;
+	const int32 child2 = node.Child2;
+	if (_nodes[child1].ParentOrNext != index || _nodes[child2].ParentOrNext != index) { return false; }
+
+	const int32 height = 1 + MaxHeight(_nodes[child1].Height, _nodes[child2].Height);
+	if (node.Height != height) { return false; }
+
+	if (!node.Box.Contains(_nodes[child1].Box) || !node.Box.Contains(_nodes[child2].Box)) { return false; }
+
+	return ValidateNode(child1) && ValidateNode(child2);
+}
+#pragma endregion Protected Function
@@ -0,0 +1,149 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   BatchedNarrowphase.hpp
+///  @brief  u[htF[Y̑g`̑gݍ킹ƂɐU蕪, gݍ킹̑gSIMD4/8g肵܂. @n
+///          ʂContactGenerator1g̔ƈv, ͂g̏Ԃ̂܂ܘAobt@ɏo͂܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_BATCHED_NARROWPHASE_HPP
+#define PHYSICS_BATCHED_NARROWPHASE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "ContactManifold.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision::details::narrowphase
+{
+	/*! @brief 1ɂ܂Ƃ߂Ĕ肷g̍ő吔 (AVX28[)*/
+	constexpr gu::uint32 MAX_BATCH_WIDTH = 8;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision
+{
+	/****************************************************************************
+	*				  			   NarrowphaseBucket
+	****************************************************************************/
+	/* @brief  `̑gݍ킹Ƃ̐U蕪ł. Generic͐pSIMDłȂgݍ킹, 1g肵܂.
+	*****************************************************************************/
+	enum class NarrowphaseBucket : gu::uint8
+	{
+		SphereSphere,   //!< Ƌ
+		SphereBox,      //!< ƃ{bNX
+		BoxBox,         //!< {bNXƃ{bNX (̂SIMD)
+		CapsuleCapsule, //!< JvZƃJvZ
+		Generic,        //!< ƃJvZ, {bNXƃJvZȂ
+		CountOf
+	};
+
+	/****************************************************************************
+	*				  			   NarrowphasePair
+	****************************************************************************/
+	/* @brief  肷`̑gł. `̔z̃CfbNXw肵܂.
+	*****************************************************************************/
+	struct NarrowphasePair
+	{
+		gu::uint32 ShapeA = 0;
+		gu::uint32 ShapeB = 0;
+	};
+
+	/****************************************************************************
+	*				  			   BatchedNarrowphase
+	****************************************************************************/
+	/* @brief  Begin, AddPairőgo^, Collideł܂Ƃ߂Ĕ肵܂. @n
+	*          gƂ̌ʂ̏ݐ͌܂Ă邽, U蕪̔菇Ɋւ炸o͓͂͂̏ԂɂȂ܂. @n
+	*          }jtH[hBodyA, BodyBɂ͑gShapeA, ShapeB, @ShapeAShapeB֌܂. @n
+	*          1̃CX^X̓XbhZ[tł͂Ȃ, ɔ肷ꍇ̓^XNƂɗpӂĂ.
+	*****************************************************************************/
+	class BatchedNarrowphase
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     o^gƑǑʂj܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Begin();
+
+		/*!**********************************************************************
+		*  @brief     肷gǉ܂.
+		*  @param[in] const gu::uint32 `ÃCfbNX
+		*  @param[in] const gu::uint32 `B̃CfbNX
+		*  @return    void
+		*************************************************************************/
+		__forceinline void AddPair(const gu::uint32 shapeA, const gu::uint32 shapeB)
+		{
+			NarrowphasePair pair = {};
+			pair.ShapeA = shapeA;
+			pair.ShapeB = shapeB;
+			_pairs.Push(pair);
+		}
+
+		/*!**********************************************************************
+		*  @brief     o^SĂ̑g𔻒肵, ڐGĂg̃}jtH[h͏ɋl߂ďo͂܂. @n
+		*             CPUFeature::GetActive̖߃ZbgɉScalar, SSE2(4g), AVX2(8g)̔֐gp܂.
+		*  @param[in] const CollisionShape* `̔z (g̃CfbNXw)
+		*  @return    void
+		*************************************************************************/
+		void Collide(const CollisionShape* shapes);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief o^g̐*/
+		__forceinline gu::uint32 GetPairCount() const { return static_cast<gu::uint32>(_pairs.Size()); }
+
+		/*! @brief U蕪悲Ƃ̑g̐ (OCollide)*/
+		__forceinline gu::uint32 GetBucketPairCount(const NarrowphaseBucket bucket) const { return static_cast<gu::uint32>(_buckets[static_cast<gu::uint8>(bucket)].Size()); }
+
+		/*! @brief ڐGĂg̃}jtH[h̐*/
+		__forceinline gu::uint32 GetManifoldCount() const { return _manifoldCount; }
+
+		/*! @brief ڐGĂg̃}jtH[h (͏ɘAĂ܂)*/
+		__forceinline       ContactManifold* GetManifolds()       { return _manifolds.Data(); }
+		__forceinline const ContactManifold* GetManifolds() const { return _manifolds.Data(); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		BatchedNarrowphase() = default;
+
+		~BatchedNarrowphase() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief g`̑gݍ킹ƂɐU蕪܂*/
+		void BuildBuckets(const CollisionShape* shapes);
+
+		/*! @brief 茋ʂ̂g͏̂܂ܐ擪֋l߂܂*/
+		void CompactManifolds();
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief o^g*/
+		gu::DynamicArray<NarrowphasePair> _pairs = {};
+
+		/*! @brief U蕪悲Ƃ̑g̃CfbNX. ŏbit͌`̏ԂւĔ肷邱Ƃ܂*/
+		gu::DynamicArray<gu::uint32> _buckets[static_cast<gu::uint8>(NarrowphaseBucket::CountOf)] = {};
+
+		/*! @brief gƂ̔茋 (Collidě͐擪_manifoldCountɋl߂Ă܂)*/
+		gu::DynamicArray<ContactManifold> _manifolds = {};
+
+		/*! @brief gƂ̐ڐGĂ邩*/
+		gu::DynamicArray<gu::uint8> _isHits = {};
+
+		/*! @brief ڐGĂg̐*/
+		gu::uint32 _manifoldCount = 0;
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ContactGenerator.hpp
+///  @brief  , {bNX, JvZ̑gݍ킹ƂɐڐG_߂XJ[̔֐Qł. @n
+///          SĂ̊֐͖@AB֌, ĂĂSPECULATIVE_DISTANCEȓłΐڐG_o͂܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_CONTACT_GENERATOR_HPP
+#define PHYSICS_CONTACT_GENERATOR_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "ContactManifold.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision
+{
+	/****************************************************************************
+	*				  			   BoxAxisType
+	****************************************************************************/
+	/* @brief  {bNXm̎̕ނł.
+	*****************************************************************************/
+	enum class BoxAxisType : gu::uint8
+	{
+		FaceA, //!< A̖ʂ̖@
+		FaceB, //!< B̖ʂ̖@
+		Edge,  //!< A̕ӂB̕ӂ̊O
+	};
+
+	/****************************************************************************
+	*				  			   BoxSeparatingAxis
+	****************************************************************************/
+	/* @brief  {bNXm̕ōł󂢎ł. ڐG_̐͂̎g, @n
+	*          ܂Ƃ߂(SIMD)s, ڐG_̐1gsƂł܂.
+	*****************************************************************************/
+	struct BoxSeparatingAxis
+	{
+		/*! @brief ̎*/
+		BoxAxisType Type = BoxAxisType::FaceA;
+
+		/*! @brief ʂ̏ꍇ͎̃CfbNX(0`2), ӂ̏ꍇA̕ * 3 + B̕*/
+		gu::uint32 Index = 0;
+
+		/*! @brief ̋ (̏ꍇ͂߂荞ݗ)*/
+		float Separation = 0.0f;
+
+		/*! @brief AB֌Pʖ@*/
+		gm::Float3 Normal = {};
+	};
+
+	/****************************************************************************
+	*				  			   ContactGenerator
+	****************************************************************************/
+	/* @brief  2̌`̐ڐG_߂܂. o͂}jtH[h̗͐ς0ŏ܂. @n
+	*          BodyA, BodyB͕ύXȂ, ĂяoŐݒ肵Ă.
+	*****************************************************************************/
+	class ContactGenerator
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     `̎ނɉ֐Ăяo܂. gݍ킹t̏ꍇ͓ւĔ肵, @𔽓]܂.
+		*  @param[in]  const CollisionShape& `A
+		*  @param[in]  const CollisionShape& `B
+		*  @param[out] ContactManifold& ڐG_
+		*  @return     bool ڐG_1ȏ゠ꍇtrue
+		*************************************************************************/
+		static bool Collide(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold);
+
+		/*! @brief Ƌ*/
+		static bool CollideSpheres(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold);
+
+		/*! @brief ƃ{bNX*/
+		static bool CollideSphereBox(const CollisionShape& sphere, const CollisionShape& box, ContactManifold& manifold);
+
+		/*! @brief ƃJvZ*/
+		static bool CollideSphereCapsule(const CollisionShape& sphere, const CollisionShape& capsule, ContactManifold& manifold);
+
+		/*!**********************************************************************
+		*  @brief     {bNXƃ{bNX𕪗(3+3, ӂ̑gݍ킹9)Ŕ肵܂. @n
+		*             ʂł󂢎̏ꍇ, ʂ̑ʂő̖ʂNbvčő4_o͂܂. @n
+		*             ӂ̑gݍ킹̏ꍇ, 2̕ӂ̍ŋߓ_1_o͂܂.
+		*  @param[in]  const CollisionShape& {bNXA
+		*  @param[in]  const CollisionShape& {bNXB
+		*  @param[out] ContactManifold& ڐG_
+		*  @return     bool
+		*************************************************************************/
+		static bool CollideBoxes(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold);
+
+		/*!**********************************************************************
+		*  @brief     {bNXm̕肾s, ł󂢎߂܂. @n
+		*             ӂ͖̎ʂ̎薾炩ɐ󂢏ꍇI, B̖ʂA̖ʂ薾炩ɐ󂢏ꍇIт܂.
+		*  @param[in]  const CollisionShape& {bNXA
+		*  @param[in]  const CollisionShape& {bNXB
+		*  @param[out] BoxSeparatingAxis& ł󂢎
+		*  @return     bool ꂩ̎SPECULATIVE_DISTANCE藣Ăꍇfalse
+		*************************************************************************/
+		static bool FindBoxSeparatingAxis(const CollisionShape& a, const CollisionShape& b, BoxSeparatingAxis& axis);
+
+		/*!**********************************************************************
+		*  @brief     FindBoxSeparatingAxisŋ߂{bNXm̐ڐG_𐶐܂.
+		*  @param[in]  const CollisionShape& {bNXA
+		*  @param[in]  const CollisionShape& {bNXB
+		*  @param[in]  const BoxSeparatingAxis& ł󂢎
+		*  @param[out] ContactManifold& ڐG_
+		*  @return     bool
+		*************************************************************************/
+		static bool CollideBoxesOnAxis(const CollisionShape& a, const CollisionShape& b, const BoxSeparatingAxis& axis, ContactManifold& manifold);
+
+		/*!**********************************************************************
+		*  @brief     {bNXƃJvZ𔻒肵܂. JvZ̗[, {bNX̒Sɍł߂̓_ƂĔ肵, @n
+		*             ł[_̖@Ƃقړ̓_܂Ƃ߂܂. (ߎł)
+		*  @param[in]  const CollisionShape& {bNX
+		*  @param[in]  const CollisionShape& JvZ
+		*  @param[out] ContactManifold& ڐG_
+		*  @return     bool
+		*************************************************************************/
+		static bool CollideBoxCapsule(const CollisionShape& box, const CollisionShape& capsule, ContactManifold& manifold);
+
+		/*!**********************************************************************
+		*  @brief     JvZƃJvZ̐m̍ŋߓ_Ŕ肵܂. قڕsȏꍇ͏dȂ͈̗͂[2_o͂܂.
+		*  @param[in]  const CollisionShape& JvZA
+		*  @param[in]  const CollisionShape& JvZB
+		*  @param[out] ContactManifold& ڐG_
+		*  @return     bool
+		*************************************************************************/
+		static bool CollideCapsules(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold);
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ContactManifold.hpp
+///  @brief  2̍̂̐ڐG\ڐGl(}jtH[h), ڐGɓn``܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_CONTACT_MANIFOLD_HPP
+#define PHYSICS_CONTACT_MANIFOLD_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "PhysicsCore/Geometry/Private/Include/GeometryType.hpp"
+#include "GameUtility/Base/Include/GUType.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision::details::narrowphase
+{
+	/*! @brief 1̃}jtH[hڐG_̍ő吔*/
+	constexpr gu::uint32 MAX_MANIFOLD_POINTS = 4;
+
+	/*! @brief ĂĂڐG_Ƃďo͂鋗 [m]. \o[͈͂̔͂ŋ߂Âx𐧌, ςݏd˂̂̐ڐG̏oh܂*/
+	constexpr float SPECULATIVE_DISTANCE = 0.02f;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::collision
+{
+	/****************************************************************************
+	*				  			   CollisionShape
+	****************************************************************************/
+	/* @brief  ڐGɓn[hԂ̌`ł. TypeɉĎgp郁oς܂. @n
+	*          Sphere : Radius, OBB (AABB]t̃{bNXƂĈ܂) : HalfExtents, Capsule : Radius, HalfHeight ([JY)
+	*****************************************************************************/
+	struct CollisionShape
+	{
+		/*! @brief `̎*/
+		geometry::GeometryType Type = geometry::GeometryType::Sphere;
+
+		/*! @brief S̈ʒu*/
+		gm::Float3 Position = {};
+
+		/*! @brief ] (x, y, z, w)*/
+		gm::Float4 Orientation = gm::Float4(0.0f, 0.0f, 0.0f, 1.0f);
+
+		/*! @brief {bNX̊e̔̒*/
+		gm::Float3 HalfExtents = {};
+
+		/*! @brief , JvZ̔a*/
+		float Radius = 0.0f;
+
+		/*! @brief JvZ2̔̒SԂ̋̔*/
+		float HalfHeight = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			   ContactPoint
+	****************************************************************************/
+	/* @brief  }jtH[h̐ڐG_ł. ~ς͐ς͎̃XebṽEH[X^[gɎgp܂.
+	*****************************************************************************/
+	struct ContactPoint
+	{
+		/*! @brief 2̕\ʂ̒_ ([h)*/
+		gm::Float3 Position = {};
+
+		/*! @brief ߂荞ݗ [m]. ̏ꍇ͗Ă鋗ł*/
+		float Penetration = 0.0f;
+
+		/*! @brief ÕXebv̐ڐG_ƑΉt邽߂̓ID (ڐG, , _܂)*/
+		gu::uint32 FeatureID = 0;
+
+		/*! @brief @2̐ڐɒ~ς͐*/
+		float NormalImpulse   = 0.0f;
+		float TangentImpulse1 = 0.0f;
+		float TangentImpulse2 = 0.0f;
+	};
+
+	/****************************************************************************
+	*				  			   ContactManifold
+	****************************************************************************/
+	/* @brief  2̍̂̊Ԃ̐ڐG_̏Wł. SĂ̐ڐG_Ŗ@L܂.
+	*****************************************************************************/
+	struct ContactManifold
+	{
+		/*! @brief ڐGĂ鍄̂̃CfbNX*/
+		gu::uint32 BodyA = 0;
+		gu::uint32 BodyB = 0;
+
+		/*! @brief AB֌Pʖ@*/
+		gm::Float3 Normal = {};
+
+		/*! @brief LȐڐG_̐*/
+		gu::uint32 PointCount = 0;
+
+		/*! @brief ڐG_*/
+		ContactPoint Points[details::narrowphase::MAX_MANIFOLD_POINTS] = {};
+	};
+}
+
+#endif
@@ -0,0 +1,1279 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   BatchedNarrowphase.cpp
+///  @brief  `̑gݍ킹ƂɐU蕪gSIMDł܂Ƃ߂Ĕ肵܂. @n
+///          SIMDłContactGeneratorƓԂŉZ(FMA͎gp܂), rbgPʂœʂo͂܂. @n
+///          GCC, Clang͏ZƉZ̑gݍ݊֐FMAɂ܂Ƃ߂邱Ƃ邽, vꍇ-ffp-contract=offŃrhĂ.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/BatchedNarrowphase.hpp"
+#include "../Include/ContactGenerator.hpp"
+#include "PhysicsCore/Core/Private/Include/PhysicsMath.hpp"
+#include "GameUtility/Math/Include/GMCPUFeature.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include <cstddef>
+#include <cmath>
+#include <cfloat>
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics;
+using namespace physics::collision;
+using namespace physics::collision::details::narrowphase;
+using namespace physics::details::math;
+using namespace physics::geometry;
+using namespace gm;
+using namespace gu;
+
+namespace
+{
+	/*! @brief U蕪̗vf, `̏ԂւĔ肷邱Ƃbit*/
+	constexpr uint32 SWAPPED_BIT = 0x80000000u;
+
+	/*! @brief ContactGeneratorƓel (, B̖ʂ͖̎炩ɐ󂢏ꍇIт܂)*/
+	constexpr float AXIS_RELATIVE_TOLERANCE = 0.95f;
+	constexpr float AXIS_ABSOLUTE_TOLERANCE = 0.001f;
+
+	using CollideFunction = void(*)(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits);
+
+	/*---------------------------------------------------------------
+			Sphere < Box < Capsulȅ (łȂ`-1)
+	-----------------------------------------------------------------*/
+	__forceinline int32 GetShapeOrder(const GeometryType type)
+	{
+		switch (type)
+		{
+			case GeometryType::Sphere : return 0;
+			case GeometryType::AABB   :
+			case GeometryType::OBB    : return 1;
+			case GeometryType::Capsule: return 2;
+			default                   : return -1;
+		}
+	}
+
+	/*---------------------------------------------------------------
+			U蕪̗vf, 肷鏇Ԃɕׂ2̌`o܂
+	-----------------------------------------------------------------*/
+	struct LaneShapes
+	{
+		const CollisionShape* First;
+		const CollisionShape* Second;
+	};
+
+	__forceinline LaneShapes GetLaneShapes(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32 entry)
+	{
+		const NarrowphasePair& pair = pairs[entry & ~SWAPPED_BIT];
+		const bool isSwapped = (entry & SWAPPED_BIT) != 0;
+
+		LaneShapes lane = {};
+		lane.First  = &shapes[isSwapped ? pair.ShapeB : pair.ShapeA];
+		lane.Second = &shapes[isSwapped ? pair.ShapeA : pair.ShapeB];
+		return lane;
+	}
+
+	/*---------------------------------------------------------------
+			ContactGenerator1g肵܂ (Scalar, Generic̐U蕪)
+	-----------------------------------------------------------------*/
+	void CollideScalar(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		for (uint64 i = 0; i < count; ++i)
+		{
+			const uint32           pairIndex = entries[i] & ~SWAPPED_BIT;
+			const NarrowphasePair& pair      = pairs[pairIndex];
+			ContactManifold&       manifold  = manifolds[pairIndex];
+
+			isHits[pairIndex] = ContactGenerator::Collide(shapes[pair.ShapeA], shapes[pair.ShapeB], manifold) ? 1 : 0;
+			manifold.BodyA    = pair.ShapeA;
+			manifold.BodyB    = pair.ShapeB;
+		}
+	}
+
+	#pragma region Batch
+	/*---------------------------------------------------------------
+			SIMD̃WX^֓ǂݍSoA`̓͂Əo.
+			g̐[ɖȂꍇ, Ō̑g𕡐Ė߂܂
+	-----------------------------------------------------------------*/
+	struct SphereBatch
+	{
+		alignas(32) float CenterAX[MAX_BATCH_WIDTH];
+		alignas(32) float CenterAY[MAX_BATCH_WIDTH];
+		alignas(32) float CenterAZ[MAX_BATCH_WIDTH];
+		alignas(32) float RadiusA [MAX_BATCH_WIDTH];
+		alignas(32) float CenterBX[MAX_BATCH_WIDTH];
+		alignas(32) float CenterBY[MAX_BATCH_WIDTH];
+		alignas(32) float CenterBZ[MAX_BATCH_WIDTH];
+		alignas(32) float RadiusB [MAX_BATCH_WIDTH];
+	};
+
+	struct SphereBoxBatch
+	{
+		alignas(32) float SphereX     [MAX_BATCH_WIDTH];
+		alignas(32) float SphereY     [MAX_BATCH_WIDTH];
+		alignas(32) float SphereZ     [MAX_BATCH_WIDTH];
+		alignas(32) float Radius      [MAX_BATCH_WIDTH];
+		alignas(32) float BoxX        [MAX_BATCH_WIDTH];
+		alignas(32) float BoxY        [MAX_BATCH_WIDTH];
+		alignas(32) float BoxZ        [MAX_BATCH_WIDTH];
+		alignas(32) float OrientationX[MAX_BATCH_WIDTH];
+		alignas(32) float OrientationY[MAX_BATCH_WIDTH];
+		alignas(32) float OrientationZ[MAX_BATCH_WIDTH];
+		alignas(32) float OrientationW[MAX_BATCH_WIDTH];
+		alignas(32) float HalfX       [MAX_BATCH_WIDTH];
+		alignas(32) float HalfY       [MAX_BATCH_WIDTH];
+		alignas(32) float HalfZ       [MAX_BATCH_WIDTH];
+	};
+
+	/*! @brief {bNX̒S, ]s̗(, ), ̒*/
+	struct BoxBatch
+	{
+		alignas(32) float CenterA[3]   [MAX_BATCH_WIDTH];
+		alignas(32) float AxisA  [3][3][MAX_BATCH_WIDTH];
+		alignas(32) float HalfA  [3]   [MAX_BATCH_WIDTH];
+		alignas(32) float CenterB[3]   [MAX_BATCH_WIDTH];
+		alignas(32) float AxisB  [3][3][MAX_BATCH_WIDTH];
+		alignas(32) float HalfB  [3]   [MAX_BATCH_WIDTH];
+	};
+
+	/*! @brief JvZ̗̎̐[Ɣa*/
+	struct CapsuleBatch
+	{
+		alignas(32) float StartA[3][MAX_BATCH_WIDTH];
+		alignas(32) float EndA  [3][MAX_BATCH_WIDTH];
+		alignas(32) float RadiusA  [MAX_BATCH_WIDTH];
+		alignas(32) float StartB[3][MAX_BATCH_WIDTH];
+		alignas(32) float EndB  [3][MAX_BATCH_WIDTH];
+		alignas(32) float RadiusB  [MAX_BATCH_WIDTH];
+
+		/*! @brief قڕs, ContactGenerator2_߂郌[*/
+		uint32 FallbackMask;
+	};
+
+	/*! @brief 1_̐ڐǦ. @͔肵Ԃ1ڂ̌`󂩂2ڂ֌܂*/
+	struct PointContactBatch
+	{
+		alignas(32) float NormalX    [MAX_BATCH_WIDTH];
+		alignas(32) float NormalY    [MAX_BATCH_WIDTH];
+		alignas(32) float NormalZ    [MAX_BATCH_WIDTH];
+		alignas(32) float PositionX  [MAX_BATCH_WIDTH];
+		alignas(32) float PositionY  [MAX_BATCH_WIDTH];
+		alignas(32) float PositionZ  [MAX_BATCH_WIDTH];
+		alignas(32) float Penetration[MAX_BATCH_WIDTH];
+		alignas(32) float FeatureID  [MAX_BATCH_WIDTH];
+		uint32 HitMask;
+	};
+
+	/*! @brief {bNXm̌̕*/
+	struct BoxAxisBatch
+	{
+		alignas(32) float Type      [MAX_BATCH_WIDTH];
+		alignas(32) float Index     [MAX_BATCH_WIDTH];
+		alignas(32) float Separation[MAX_BATCH_WIDTH];
+		alignas(32) float NormalX   [MAX_BATCH_WIDTH];
+		alignas(32) float NormalY   [MAX_BATCH_WIDTH];
+		alignas(32) float NormalZ   [MAX_BATCH_WIDTH];
+		uint32 SeparatedMask;
+	};
+
+	/*---------------------------------------------------------------
+			͂SoA`ɕׂ܂. ߂l͗Lȃ[ł
+	-----------------------------------------------------------------*/
+	__forceinline uint32 GetLaneCount(const uint64 remaining, const uint32 width)
+	{
+		return remaining < width ? static_cast<uint32>(remaining) : width;
+	}
+
+	uint32 GatherSpheres(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 remaining, const uint32 width, SphereBatch& batch)
+	{
+		const uint32 laneCount = GetLaneCount(remaining, width);
+		for (uint32 k = 0; k < width; ++k)
+		{
+			const LaneShapes lane = GetLaneShapes(shapes, pairs, entries[k < laneCount ? k : laneCount - 1]);
+			batch.CenterAX[k] = lane.First ->Position.x;
+			batch.CenterAY[k] = lane.First ->Position.y;
+			batch.CenterAZ[k] = lane.First ->Position.z;
+			batch.RadiusA [k] = lane.First ->Radius;
+			batch.CenterBX[k] = lane.Second->Position.x;
+			batch.CenterBY[k] = lane.Second->Position.y;
+			batch.CenterBZ[k] = lane.Second->Position.z;
+			batch.RadiusB [k] = lane.Second->Radius;
+		}
+		return laneCount;
+	}
+
+	uint32 GatherSphereBoxes(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 remaining, const uint32 width, SphereBoxBatch& batch)
+	{
+		const uint32 laneCount = GetLaneCount(remaining, width);
+		for (uint32 k = 0; k < width; ++k)
+		{
+			const LaneShapes lane = GetLaneShapes(shapes, pairs, entries[k < laneCount ? k : laneCount - 1]);
+			const CollisionShape& sphere = *lane.First;
+			const CollisionShape& box    = *lane.Second;
+			batch.SphereX     [k] = sphere.Position.x;
+			batch.SphereY     [k] = sphere.Position.y;
+			batch.SphereZ     [k] = sphere.Position.z;
+			batch.Radius      [k] = sphere.Radius;
+			batch.BoxX        [k] = box.Position.x;
+			batch.BoxY        [k] = box.Position.y;
+			batch.BoxZ        [k] = box.Position.z;
+			batch.OrientationX[k] = box.Orientation.x;
+			batch.OrientationY[k] = box.Orientation.y;
+			batch.OrientationZ[k] = box.Orientation.z;
+			batch.OrientationW[k] = box.Orientation.w;
+			batch.HalfX       [k] = box.HalfExtents.x;
+			batch.HalfY       [k] = box.HalfExtents.y;
+			batch.HalfZ       [k] = box.HalfExtents.z;
+		}
+		return laneCount;
+	}
+
+	uint32 GatherBoxes(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 remaining, const uint32 width, BoxBatch& batch)
+	{
+		const uint32 laneCount = GetLaneCount(remaining, width);
+		for (uint32 k = 0; k < width; ++k)
+		{
+			const LaneShapes lane = GetLaneShapes(shapes, pairs, entries[k < laneCount ? k : laneCount - 1]);
+
+			gm::Float3 axesA[3], axesB[3];
+			ToAxes(lane.First ->Orientation, axesA);
+			ToAxes(lane.Second->Orientation, axesB);
+
+			const float centerA[3] = { lane.First ->Position.x, lane.First ->Position.y, lane.First ->Position.z };
+			const float centerB[3] = { lane.Second->Position.x, lane.Second->Position.y, lane.Second->Position.z };
+			const float halfA  [3] = { lane.First ->HalfExtents.x, lane.First ->HalfExtents.y, lane.First ->HalfExtents.z };
+			const float halfB  [3] = { lane.Second->HalfExtents.x, lane.Second->HalfExtents.y, lane.Second->HalfExtents.z };
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				batch.CenterA[i][k]    = centerA[i];
+				batch.CenterB[i][k]    = centerB[i];
+				batch.HalfA  [i][k]    = halfA[i];
+				batch.HalfB  [i][k]    = halfB[i];
+				batch.AxisA  [i][0][k] = axesA[i].x;
+				batch.AxisA  [i][1][k] = axesA[i].y;
+				batch.AxisA  [i][2][k] = axesA[i].z;
+				batch.AxisB  [i][0][k] = axesB[i].x;
+				batch.AxisB  [i][1][k] = axesB[i].y;
+				batch.AxisB  [i][2][k] = axesB[i].z;
+			}
+		}
+		return laneCount;
+	}
+
+	uint32 GatherCapsules(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 remaining, const uint32 width, CapsuleBatch& batch)
+	{
+		const uint32 laneCount = GetLaneCount(remaining, width);
+		batch.FallbackMask = 0;
+		for (uint32 k = 0; k < width; ++k)
+		{
+			const LaneShapes lane = GetLaneShapes(shapes, pairs, entries[k < laneCount ? k : laneCount - 1]);
+			const CollisionShape& a = *lane.First;
+			const CollisionShape& b = *lane.Second;
+
+			// ContactGenerator̃JvZ̐ƓvZł
+			const gm::Float3 axisA  = Rotate(a.Orientation, gm::Float3(0.0f, a.HalfHeight, 0.0f));
+			const gm::Float3 axisB  = Rotate(b.Orientation, gm::Float3(0.0f, b.HalfHeight, 0.0f));
+			const gm::Float3 startA = Subtract(a.Position, axisA), endA = Add(a.Position, axisA);
+			const gm::Float3 startB = Subtract(b.Position, axisB), endB = Add(b.Position, axisB);
+
+			batch.StartA[0][k] = startA.x; batch.StartA[1][k] = startA.y; batch.StartA[2][k] = startA.z;
+			batch.EndA  [0][k] = endA.x;   batch.EndA  [1][k] = endA.y;   batch.EndA  [2][k] = endA.z;
+			batch.StartB[0][k] = startB.x; batch.StartB[1][k] = startB.y; batch.StartB[2][k] = startB.z;
+			batch.EndB  [0][k] = endB.x;   batch.EndB  [1][k] = endB.y;   batch.EndB  [2][k] = endB.z;
+			batch.RadiusA[k]   = a.Radius;
+			batch.RadiusB[k]   = b.Radius;
+
+			if (k < laneCount && a.HalfHeight > 0.0f && b.HalfHeight > 0.0f
+				&& std::fabs(Dot(Normalize(Subtract(endA, startA)), Normalize(Subtract(endB, startB)))) > 0.99f)
+			{
+				batch.FallbackMask |= 1u << k;
+			}
+		}
+		return laneCount;
+	}
+
+	/*---------------------------------------------------------------
+			1_̐ڐǦʂ}jtH[h֏݂܂.
+			ԂւĔ肵g, @ShapeAShapeB̌ɖ߂܂
+	-----------------------------------------------------------------*/
+	void ScatterPointContacts(const NarrowphasePair* pairs, const uint32* entries, const uint32 laneCount, const PointContactBatch& batch, ContactManifold* manifolds, uint8* isHits)
+	{
+		for (uint32 k = 0; k < laneCount; ++k)
+		{
+			const uint32 pairIndex = entries[k] & ~SWAPPED_BIT;
+			const bool   isHit     = ((batch.HitMask >> k) & 1u) != 0;
+			isHits[pairIndex] = isHit ? 1 : 0;
+			if (!isHit) { continue; }
+
+			const float sign = (entries[k] & SWAPPED_BIT) != 0 ? -1.0f : 1.0f;
+
+			ContactManifold& manifold = manifolds[pairIndex];
+			manifold.BodyA      = pairs[pairIndex].ShapeA;
+			manifold.BodyB      = pairs[pairIndex].ShapeB;
+			manifold.Normal     = gm::Float3(batch.NormalX[k] * sign, batch.NormalY[k] * sign, batch.NormalZ[k] * sign);
+			manifold.PointCount = 1;
+
+			ContactPoint& point   = manifold.Points[0];
+			point.Position        = gm::Float3(batch.PositionX[k], batch.PositionY[k], batch.PositionZ[k]);
+			point.Penetration     = batch.Penetration[k];
+			point.FeatureID       = static_cast<uint32>(batch.FeatureID[k]);
+			point.NormalImpulse   = 0.0f;
+			point.TangentImpulse1 = 0.0f;
+			point.TangentImpulse2 = 0.0f;
+		}
+	}
+
+	/*---------------------------------------------------------------
+			ĂȂ{bNX̑g, ߂ŐڐG_𐶐܂
+	-----------------------------------------------------------------*/
+	void ScatterBoxContacts(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint32 laneCount, const BoxAxisBatch& batch, ContactManifold* manifolds, uint8* isHits)
+	{
+		for (uint32 k = 0; k < laneCount; ++k)
+		{
+			const uint32 pairIndex = entries[k] & ~SWAPPED_BIT;
+			if ((batch.SeparatedMask >> k) & 1u)
+			{
+				isHits[pairIndex] = 0;
+				continue;
+			}
+
+			BoxSeparatingAxis axis = {};
+			axis.Type       = static_cast<BoxAxisType>(static_cast<uint8>(batch.Type[k]));
+			axis.Index      = static_cast<uint32>(batch.Index[k]);
+			axis.Separation = batch.Separation[k];
+			axis.Normal     = gm::Float3(batch.NormalX[k], batch.NormalY[k], batch.NormalZ[k]);
+
+			const NarrowphasePair& pair     = pairs[pairIndex];
+			ContactManifold&       manifold = manifolds[pairIndex];
+			isHits[pairIndex] = ContactGenerator::CollideBoxesOnAxis(shapes[pair.ShapeA], shapes[pair.ShapeB], axis, manifold) ? 1 : 0;
+			manifold.BodyA    = pair.ShapeA;
+			manifold.BodyB    = pair.ShapeB;
+		}
+	}
+
+	/*---------------------------------------------------------------
+			قڕsȃJvZ̑g, ContactGeneratorŔ肵܂
+	-----------------------------------------------------------------*/
+	void ScatterCapsuleFallbacks(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint32 fallbackMask, ContactManifold* manifolds, uint8* isHits)
+	{
+		for (uint32 mask = fallbackMask; mask != 0; mask &= mask - 1)
+		{
+			uint32 k = 0;
+			while (((mask >> k) & 1u) == 0) { ++k; }
+
+			const uint32           pairIndex = entries[k] & ~SWAPPED_BIT;
+			const NarrowphasePair& pair      = pairs[pairIndex];
+			ContactManifold&       manifold  = manifolds[pairIndex];
+			isHits[pairIndex] = ContactGenerator::CollideCapsules(shapes[pair.ShapeA], shapes[pair.ShapeB], manifold) ? 1 : 0;
+			manifold.BodyA    = pair.ShapeA;
+			manifold.BodyB    = pair.ShapeB;
+		}
+	}
+	#pragma endregion Batch
+
+#if PLATFORM_CPU_X86_FAMILY
+	#pragma region SSE2
+	/*---------------------------------------------------------------
+			SSE2 : 4g肵܂
+	-----------------------------------------------------------------*/
+	struct Vector3SSE2
+	{
+		__m128 X, Y, Z;
+	};
+
+	__forceinline __m128 SelectSSE2(const __m128 mask, const __m128 a, const __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	__forceinline __m128 AbsSSE2   (const __m128 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+	__forceinline __m128 NegateSSE2(const __m128 a) { return _mm_xor_ps   (_mm_set1_ps(-0.0f), a); }
+
+	/*! @brief x < 0 ? 0 : (x > 1 ? 1 : x)*/
+	__forceinline __m128 Clamp01SSE2(const __m128 x)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one  = _mm_set1_ps(1.0f);
+		return SelectSSE2(_mm_cmplt_ps(x, zero), zero, SelectSSE2(_mm_cmpgt_ps(x, one), one, x));
+	}
+
+	__forceinline Vector3SSE2 Load3SSE2(const float* x, const float* y, const float* z)
+	{
+		return { _mm_load_ps(x), _mm_load_ps(y), _mm_load_ps(z) };
+	}
+
+	__forceinline void Store3SSE2(const Vector3SSE2& v, float* x, float* y, float* z)
+	{
+		_mm_store_ps(x, v.X); _mm_store_ps(y, v.Y); _mm_store_ps(z, v.Z);
+	}
+
+	__forceinline Vector3SSE2 Add3SSE2     (const Vector3SSE2& a, const Vector3SSE2& b) { return { _mm_add_ps(a.X, b.X), _mm_add_ps(a.Y, b.Y), _mm_add_ps(a.Z, b.Z) }; }
+	__forceinline Vector3SSE2 Subtract3SSE2(const Vector3SSE2& a, const Vector3SSE2& b) { return { _mm_sub_ps(a.X, b.X), _mm_sub_ps(a.Y, b.Y), _mm_sub_ps(a.Z, b.Z) }; }
+	__forceinline Vector3SSE2 Scale3SSE2   (const Vector3SSE2& a, const __m128 s)       { return { _mm_mul_ps(a.X, s), _mm_mul_ps(a.Y, s), _mm_mul_ps(a.Z, s) }; }
+	__forceinline Vector3SSE2 Negate3SSE2  (const Vector3SSE2& a)                       { return { NegateSSE2(a.X), NegateSSE2(a.Y), NegateSSE2(a.Z) }; }
+
+	/*! @brief a + b * s*/
+	__forceinline Vector3SSE2 MultiplyAdd3SSE2(const Vector3SSE2& a, const Vector3SSE2& b, const __m128 s)
+	{
+		return { _mm_add_ps(a.X, _mm_mul_ps(b.X, s)), _mm_add_ps(a.Y, _mm_mul_ps(b.Y, s)), _mm_add_ps(a.Z, _mm_mul_ps(b.Z, s)) };
+	}
+
+	__forceinline __m128 Dot3SSE2(const Vector3SSE2& a, const Vector3SSE2& b)
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a.X, b.X), _mm_mul_ps(a.Y, b.Y)), _mm_mul_ps(a.Z, b.Z));
+	}
+
+	__forceinline Vector3SSE2 Cross3SSE2(const Vector3SSE2& a, const Vector3SSE2& b)
+	{
+		return
+		{
+			_mm_sub_ps(_mm_mul_ps(a.Y, b.Z), _mm_mul_ps(a.Z, b.Y)),
+			_mm_sub_ps(_mm_mul_ps(a.Z, b.X), _mm_mul_ps(a.X, b.Z)),
+			_mm_sub_ps(_mm_mul_ps(a.X, b.Y), _mm_mul_ps(a.Y, b.X))
+		};
+	}
+
+	__forceinline Vector3SSE2 Select3SSE2(const __m128 mask, const Vector3SSE2& a, const Vector3SSE2& b)
+	{
+		return { SelectSSE2(mask, a.X, b.X), SelectSSE2(mask, a.Y, b.Y), SelectSSE2(mask, a.Z, b.Z) };
+	}
+
+	/*! @brief NH[^jI(u, w)ł̉]. v' = (v + t w) + u x t, t = 2 (u x v)*/
+	__forceinline Vector3SSE2 Rotate3SSE2(const Vector3SSE2& u, const __m128 w, const Vector3SSE2& v)
+	{
+		const Vector3SSE2 t = Scale3SSE2(Cross3SSE2(u, v), _mm_set1_ps(2.0f));
+		return Add3SSE2(Add3SSE2(v, Scale3SSE2(t, w)), Cross3SSE2(u, t));
+	}
+
+	/*---------------------------------------------------------------
+			Ƌ
+	-----------------------------------------------------------------*/
+	void SphereContactSSE2(const SphereBatch& batch, PointContactBatch& result)
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one  = _mm_set1_ps(1.0f);
+
+		const Vector3SSE2 centerA = Load3SSE2(batch.CenterAX, batch.CenterAY, batch.CenterAZ);
+		const Vector3SSE2 centerB = Load3SSE2(batch.CenterBX, batch.CenterBY, batch.CenterBZ);
+		const __m128      radiusA = _mm_load_ps(batch.RadiusA);
+		const __m128      radiusB = _mm_load_ps(batch.RadiusB);
+
+		const Vector3SSE2 d           = Subtract3SSE2(centerB, centerA);
+		const __m128      distance    = _mm_sqrt_ps(Dot3SSE2(d, d));
+		const __m128      penetration = _mm_sub_ps(_mm_add_ps(radiusA, radiusB), distance);
+		const __m128      isHit       = _mm_cmpnlt_ps(penetration, _mm_set1_ps(-SPECULATIVE_DISTANCE));
+
+		const Vector3SSE2 direction = Scale3SSE2(d, _mm_div_ps(one, distance));
+		const Vector3SSE2 normal    = Select3SSE2(_mm_cmpgt_ps(distance, _mm_set1_ps(1e-6f)), direction, { zero, one, zero });
+
+		const Vector3SSE2 surfaceA = MultiplyAdd3SSE2(centerA, normal, radiusA);
+		const Vector3SSE2 surfaceB = MultiplyAdd3SSE2(centerB, normal, NegateSSE2(radiusB));
+		const Vector3SSE2 position = Scale3SSE2(Add3SSE2(surfaceA, surfaceB), _mm_set1_ps(0.5f));
+
+		Store3SSE2(normal  , result.NormalX  , result.NormalY  , result.NormalZ);
+		Store3SSE2(position, result.PositionX, result.PositionY, result.PositionZ);
+		_mm_store_ps(result.Penetration, penetration);
+		_mm_store_ps(result.FeatureID  , zero);
+		result.HitMask = static_cast<uint32>(_mm_movemask_ps(isHit));
+	}
+
+	void CollideSpheresSSE2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		SphereBatch       batch;
+		PointContactBatch result;
+		for (uint64 i = 0; i < count; i += 4)
+		{
+			const uint32 laneCount = GatherSpheres(shapes, pairs, entries + i, count - i, 4, batch);
+			SphereContactSSE2(batch, result);
+			ScatterPointContacts(pairs, entries + i, laneCount, result, manifolds, isHits);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			ƃ{bNX. {bNX̃[JԂōŋߓ_, S̏ꍇ͍ł߂ʂ牟o܂
+	-----------------------------------------------------------------*/
+	void SphereBoxContactSSE2(const SphereBoxBatch& batch, PointContactBatch& result)
+	{
+		const __m128 zero     = _mm_setzero_ps();
+		const __m128 one      = _mm_set1_ps(1.0f);
+		const __m128 minusOne = _mm_set1_ps(-1.0f);
+
+		const Vector3SSE2 center = Load3SSE2(batch.SphereX, batch.SphereY, batch.SphereZ);
+		const __m128      radius = _mm_load_ps(batch.Radius);
+		const Vector3SSE2 box    = Load3SSE2(batch.BoxX, batch.BoxY, batch.BoxZ);
+		const Vector3SSE2 u      = Load3SSE2(batch.OrientationX, batch.OrientationY, batch.OrientationZ);
+		const __m128      w      = _mm_load_ps(batch.OrientationW);
+		const Vector3SSE2 h      = Load3SSE2(batch.HalfX, batch.HalfY, batch.HalfZ);
+
+		const Vector3SSE2 local = Rotate3SSE2(Negate3SSE2(u), w, Subtract3SSE2(center, box));
+		const Vector3SSE2 clamped =
+		{
+			SelectSSE2(_mm_cmplt_ps(local.X, NegateSSE2(h.X)), NegateSSE2(h.X), SelectSSE2(_mm_cmpgt_ps(local.X, h.X), h.X, local.X)),
+			SelectSSE2(_mm_cmplt_ps(local.Y, NegateSSE2(h.Y)), NegateSSE2(h.Y), SelectSSE2(_mm_cmpgt_ps(local.Y, h.Y), h.Y, local.Y)),
+			SelectSSE2(_mm_cmplt_ps(local.Z, NegateSSE2(h.Z)), NegateSSE2(h.Z), SelectSSE2(_mm_cmpgt_ps(local.Z, h.Z), h.Z, local.Z))
+		};
+
+		const Vector3SSE2 d               = Subtract3SSE2(local, clamped);
+		const __m128      distanceSquared = Dot3SSE2(d, d);
+		const __m128      isOutside       = _mm_cmpgt_ps(distanceSquared, _mm_set1_ps(1e-12f));
+
+		/*-------------------------------------------------------------------
+		-      S{bNX̊O
+		---------------------------------------------------------------------*/
+		const __m128      distance          = _mm_sqrt_ps(distanceSquared);
+		const __m128      outsidePenetration = _mm_sub_ps(radius, distance);
+		const Vector3SSE2 outsideNormal      = Scale3SSE2(d, _mm_div_ps(one, distance));
+
+		/*-------------------------------------------------------------------
+		-      S{bNX̓ : x, y, z̏, ߂ʂΒu܂
+		---------------------------------------------------------------------*/
+		const __m128 distanceX = _mm_sub_ps(h.X, AbsSSE2(local.X));
+		const __m128 distanceY = _mm_sub_ps(h.Y, AbsSSE2(local.Y));
+		const __m128 distanceZ = _mm_sub_ps(h.Z, AbsSSE2(local.Z));
+		const __m128 isY       = _mm_cmplt_ps(distanceY, distanceX);
+		const __m128 minXY     = SelectSSE2(isY, distanceY, distanceX);
+		const __m128 isZ       = _mm_cmplt_ps(distanceZ, minXY);
+		const __m128 selectY   = _mm_andnot_ps(isZ, isY);
+		const __m128 selectX   = _mm_andnot_ps(_mm_or_ps(isY, isZ), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+		const __m128 minDistance = SelectSSE2(isZ, distanceZ, minXY);
+
+		const __m128 signX = SelectSSE2(_mm_cmpge_ps(local.X, zero), one, minusOne);
+		const __m128 signY = SelectSSE2(_mm_cmpge_ps(local.Y, zero), one, minusOne);
+		const __m128 signZ = SelectSSE2(_mm_cmpge_ps(local.Z, zero), one, minusOne);
+
+		const Vector3SSE2 insideNormal = { _mm_and_ps(selectX, signX), _mm_and_ps(selectY, signY), _mm_and_ps(isZ, signZ) };
+		const Vector3SSE2 insideSurface =
+		{
+			SelectSSE2(selectX, _mm_mul_ps(signX, h.X), local.X),
+			SelectSSE2(selectY, _mm_mul_ps(signY, h.Y), local.Y),
+			SelectSSE2(isZ    , _mm_mul_ps(signZ, h.Z), local.Z)
+		};
+		const __m128 insidePenetration = _mm_add_ps(radius, minDistance);
+		const __m128 insideFeature     = SelectSSE2(isZ, _mm_set1_ps(3.0f), SelectSSE2(isY, _mm_set1_ps(2.0f), one));
+
+		/*-------------------------------------------------------------------
+		-      [hԂ֖߂܂
+		---------------------------------------------------------------------*/
+		const Vector3SSE2 localNormal  = Select3SSE2(isOutside, outsideNormal, insideNormal);
+		const Vector3SSE2 localSurface = Select3SSE2(isOutside, clamped, insideSurface);
+		const __m128      penetration  = SelectSSE2(isOutside, outsidePenetration, insidePenetration);
+		const __m128      isHit        = _mm_or_ps(_mm_cmpngt_ps(distanceSquared, _mm_set1_ps(1e-12f)), _mm_cmpnlt_ps(outsidePenetration, _mm_set1_ps(-SPECULATIVE_DISTANCE)));
+
+		const Vector3SSE2 normal        = Rotate3SSE2(u, w, localNormal);
+		const Vector3SSE2 surfaceBox    = Add3SSE2(box, Rotate3SSE2(u, w, localSurface));
+		const Vector3SSE2 surfaceSphere = MultiplyAdd3SSE2(center, normal, NegateSSE2(radius));
+		const Vector3SSE2 position      = Scale3SSE2(Add3SSE2(surfaceBox, surfaceSphere), _mm_set1_ps(0.5f));
+
+		// @̓{bNX狅֌Ă邽, {bNX֔]܂
+		Store3SSE2(Negate3SSE2(normal), result.NormalX, result.NormalY, result.NormalZ);
+		Store3SSE2(position, result.PositionX, result.PositionY, result.PositionZ);
+		_mm_store_ps(result.Penetration, penetration);
+		_mm_store_ps(result.FeatureID  , _mm_andnot_ps(isOutside, insideFeature));
+		result.HitMask = static_cast<uint32>(_mm_movemask_ps(isHit));
+	}
+
+	void CollideSphereBoxesSSE2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		SphereBoxBatch    batch;
+		PointContactBatch result;
+		for (uint64 i = 0; i < count; i += 4)
+		{
+			const uint32 laneCount = GatherSphereBoxes(shapes, pairs, entries + i, count - i, 4, batch);
+			SphereBoxContactSSE2(batch, result);
+			ScatterPointContacts(pairs, entries + i, laneCount, result, manifolds, isHits);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			{bNXƃ{bNX̕ (3+3, ӂ̑gݍ킹9)
+	-----------------------------------------------------------------*/
+	void FindBoxAxesSSE2(const BoxBatch& batch, BoxAxisBatch& result)
+	{
+		const __m128 zero        = _mm_setzero_ps();
+		const __m128 one         = _mm_set1_ps(1.0f);
+		const __m128 speculative = _mm_set1_ps(SPECULATIVE_DISTANCE);
+		const __m128 relative    = _mm_set1_ps(AXIS_RELATIVE_TOLERANCE);
+		const __m128 absolute    = _mm_set1_ps(AXIS_ABSOLUTE_TOLERANCE);
+
+		Vector3SSE2 axisA[3], axisB[3];
+		__m128      halfA[3], halfB[3];
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			axisA[i] = Load3SSE2(batch.AxisA[i][0], batch.AxisA[i][1], batch.AxisA[i][2]);
+			axisB[i] = Load3SSE2(batch.AxisB[i][0], batch.AxisB[i][1], batch.AxisB[i][2]);
+			halfA[i] = _mm_load_ps(batch.HalfA[i]);
+			halfB[i] = _mm_load_ps(batch.HalfB[i]);
+		}
+		const Vector3SSE2 d = Subtract3SSE2(Load3SSE2(batch.CenterB[0], batch.CenterB[1], batch.CenterB[2]), Load3SSE2(batch.CenterA[0], batch.CenterA[1], batch.CenterA[2]));
+
+		__m128 absC[3][3], dA[3], dB[3];
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			for (uint32 j = 0; j < 3; ++j)
+			{
+				absC[i][j] = _mm_add_ps(AbsSSE2(Dot3SSE2(axisA[i], axisB[j])), _mm_set1_ps(1e-6f));
+			}
+			dA[i] = Dot3SSE2(d, axisA[i]);
+			dB[i] = Dot3SSE2(d, axisB[i]);
+		}
+
+		__m128      isSeparated    = zero;
+		__m128      bestSeparation = _mm_set1_ps(-FLT_MAX);
+		__m128      bestType       = zero;
+		__m128      bestIndex      = zero;
+		Vector3SSE2 bestNormal     = { zero, zero, zero };
+
+		/*-------------------------------------------------------------------
+		-      A̖
+		---------------------------------------------------------------------*/
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			const __m128 radiusB    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(halfB[0], absC[i][0]), _mm_mul_ps(halfB[1], absC[i][1])), _mm_mul_ps(halfB[2], absC[i][2]));
+			const __m128 separation = _mm_sub_ps(AbsSSE2(dA[i]), _mm_add_ps(halfA[i], radiusB));
+			isSeparated = _mm_or_ps(isSeparated, _mm_cmpgt_ps(separation, speculative));
+
+			const __m128 isBetter = _mm_cmpgt_ps(separation, bestSeparation);
+			bestSeparation = SelectSSE2(isBetter, separation, bestSeparation);
+			bestType       = SelectSSE2(isBetter, zero, bestType);
+			bestIndex      = SelectSSE2(isBetter, _mm_set1_ps(static_cast<float>(i)), bestIndex);
+			bestNormal     = Select3SSE2(isBetter, Select3SSE2(_mm_cmpge_ps(dA[i], zero), axisA[i], Negate3SSE2(axisA[i])), bestNormal);
+		}
+
+		/*-------------------------------------------------------------------
+		-      B̖
+		---------------------------------------------------------------------*/
+		const __m128 faceThresholdA = _mm_add_ps(_mm_mul_ps(relative, bestSeparation), absolute);
+		for (uint32 j = 0; j < 3; ++j)
+		{
+			const __m128 radiusA    = _mm_add_ps(_mm_add_ps(_mm_mul_ps(halfA[0], absC[0][j]), _mm_mul_ps(halfA[1], absC[1][j])), _mm_mul_ps(halfA[2], absC[2][j]));
+			const __m128 separation = _mm_sub_ps(AbsSSE2(dB[j]), _mm_add_ps(radiusA, halfB[j]));
+			isSeparated = _mm_or_ps(isSeparated, _mm_cmpgt_ps(separation, speculative));
+
+			const __m128 isBetter = _mm_and_ps(_mm_cmpgt_ps(separation, faceThresholdA), _mm_cmpgt_ps(separation, bestSeparation));
+			bestSeparation = SelectSSE2(isBetter, separation, bestSeparation);
+			bestType       = SelectSSE2(isBetter, one, bestType);
+			bestIndex      = SelectSSE2(isBetter, _mm_set1_ps(static_cast<float>(j)), bestIndex);
+			bestNormal     = Select3SSE2(isBetter, Select3SSE2(_mm_cmpge_ps(dB[j], zero), axisB[j], Negate3SSE2(axisB[j])), bestNormal);
+		}
+
+		/*-------------------------------------------------------------------
+		-      ӂ̑gݍ킹
+		---------------------------------------------------------------------*/
+		const __m128 faceThreshold = _mm_add_ps(_mm_mul_ps(relative, bestSeparation), absolute);
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			const uint32 i1 = (i + 1) % 3;
+			const uint32 i2 = (i + 2) % 3;
+			for (uint32 j = 0; j < 3; ++j)
+			{
+				const uint32 j1 = (j + 1) % 3;
+				const uint32 j2 = (j + 2) % 3;
+
+				const Vector3SSE2 axis    = Cross3SSE2(axisA[i], axisB[j]);
+				const __m128      length  = _mm_sqrt_ps(Dot3SSE2(axis, axis));
+				const __m128      isValid = _mm_cmpnlt_ps(length, _mm_set1_ps(1e-5f));
+
+				const __m128 radiusA    = _mm_add_ps(_mm_mul_ps(halfA[i1], absC[i2][j]), _mm_mul_ps(halfA[i2], absC[i1][j]));
+				const __m128 radiusB    = _mm_add_ps(_mm_mul_ps(halfB[j1], absC[i][j2]), _mm_mul_ps(halfB[j2], absC[i][j1]));
+				const __m128 distance   = Dot3SSE2(d, axis);
+				const __m128 separation = _mm_div_ps(_mm_sub_ps(AbsSSE2(distance), _mm_add_ps(radiusA, radiusB)), length);
+				isSeparated = _mm_or_ps(isSeparated, _mm_and_ps(isValid, _mm_cmpgt_ps(separation, speculative)));
+
+				const __m128 isBetter = _mm_and_ps(isValid, _mm_and_ps(_mm_cmpgt_ps(separation, faceThreshold), _mm_cmpgt_ps(separation, bestSeparation)));
+				const __m128 scale    = _mm_div_ps(SelectSSE2(_mm_cmpge_ps(distance, zero), one, _mm_set1_ps(-1.0f)), length);
+				bestSeparation = SelectSSE2(isBetter, separation, bestSeparation);
+				bestType       = SelectSSE2(isBetter, _mm_set1_ps(2.0f), bestType);
+				bestIndex      = SelectSSE2(isBetter, _mm_set1_ps(static_cast<float>(i * 3 + j)), bestIndex);
+				bestNormal     = Select3SSE2(isBetter, Scale3SSE2(axis, scale), bestNormal);
+			}
+		}
+
+		_mm_store_ps(result.Type      , bestType);
+		_mm_store_ps(result.Index     , bestIndex);
+		_mm_store_ps(result.Separation, bestSeparation);
+		Store3SSE2(bestNormal, result.NormalX, result.NormalY, result.NormalZ);
+		result.SeparatedMask = static_cast<uint32>(_mm_movemask_ps(isSeparated));
+	}
+
+	void CollideBoxesSSE2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		BoxBatch     batch;
+		BoxAxisBatch result;
+		for (uint64 i = 0; i < count; i += 4)
+		{
+			const uint32 laneCount = GatherBoxes(shapes, pairs, entries + i, count - i, 4, batch);
+			FindBoxAxesSSE2(batch, result);
+			ScatterBoxContacts(shapes, pairs, entries + i, laneCount, result, manifolds, isHits);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			JvZƃJvZ. ̐m̍ŋߓ_ (Ericson 5.1.9) ̕SČvZđI܂
+	-----------------------------------------------------------------*/
+	void ClosestPointsSSE2(const CapsuleBatch& batch, SphereBatch& closest)
+	{
+		const __m128 zero    = _mm_setzero_ps();
+		const __m128 one     = _mm_set1_ps(1.0f);
+		const __m128 epsilon = _mm_set1_ps(1e-12f);
+
+		const Vector3SSE2 p1 = Load3SSE2(batch.StartA[0], batch.StartA[1], batch.StartA[2]);
+		const Vector3SSE2 p2 = Load3SSE2(batch.StartB[0], batch.StartB[1], batch.StartB[2]);
+		const Vector3SSE2 d1 = Subtract3SSE2(Load3SSE2(batch.EndA[0], batch.EndA[1], batch.EndA[2]), p1);
+		const Vector3SSE2 d2 = Subtract3SSE2(Load3SSE2(batch.EndB[0], batch.EndB[1], batch.EndB[2]), p2);
+		const Vector3SSE2 r  = Subtract3SSE2(p1, p2);
+
+		const __m128 a = Dot3SSE2(d1, d1);
+		const __m128 e = Dot3SSE2(d2, d2);
+		const __m128 f = Dot3SSE2(d2, r);
+		const __m128 c = Dot3SSE2(d1, r);
+		const __m128 b = Dot3SSE2(d1, d2);
+		const __m128 isPointA = _mm_cmple_ps(a, epsilon);
+		const __m128 isPointB = _mm_cmple_ps(e, epsilon);
+
+		const __m128 denom = _mm_sub_ps(_mm_mul_ps(a, e), _mm_mul_ps(b, b));
+		const __m128 s0    = Clamp01SSE2(SelectSSE2(_mm_cmpgt_ps(denom, epsilon), _mm_div_ps(_mm_sub_ps(_mm_mul_ps(b, f), _mm_mul_ps(c, e)), denom), zero));
+		const __m128 t0    = _mm_div_ps(_mm_add_ps(_mm_mul_ps(b, s0), f), e);
+		const __m128 isLow  = _mm_cmplt_ps(t0, zero);
+		const __m128 isHigh = _mm_cmpgt_ps(t0, one);
+
+		const __m128 sLow    = Clamp01SSE2(_mm_div_ps(NegateSSE2(c), a));
+		const __m128 sHigh   = Clamp01SSE2(_mm_div_ps(_mm_sub_ps(b, c), a));
+		const __m128 sLine   = SelectSSE2(isLow, sLow, SelectSSE2(isHigh, sHigh, s0));
+		const __m128 tLine   = SelectSSE2(isLow, zero, SelectSSE2(isHigh, one, t0));
+		const __m128 tPointA = Clamp01SSE2(_mm_div_ps(f, e));
+
+		const __m128 s = SelectSSE2(isPointA, zero, SelectSSE2(isPointB, sLow, sLine));
+		const __m128 t = SelectSSE2(isPointB, zero, SelectSSE2(isPointA, tPointA, tLine));
+
+		Store3SSE2(MultiplyAdd3SSE2(p1, d1, s), closest.CenterAX, closest.CenterAY, closest.CenterAZ);
+		Store3SSE2(MultiplyAdd3SSE2(p2, d2, t), closest.CenterBX, closest.CenterBY, closest.CenterBZ);
+		_mm_store_ps(closest.RadiusA, _mm_load_ps(batch.RadiusA));
+		_mm_store_ps(closest.RadiusB, _mm_load_ps(batch.RadiusB));
+	}
+
+	void CollideCapsulesSSE2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		CapsuleBatch      batch;
+		SphereBatch       closest;
+		PointContactBatch result;
+		for (uint64 i = 0; i < count; i += 4)
+		{
+			const uint32 laneCount = GatherCapsules(shapes, pairs, entries + i, count - i, 4, batch);
+			ClosestPointsSSE2(batch, closest);
+			SphereContactSSE2(closest, result);
+			ScatterPointContacts(pairs, entries + i, laneCount, result, manifolds, isHits);
+			ScatterCapsuleFallbacks(shapes, pairs, entries + i, batch.FallbackMask, manifolds, isHits);
+		}
+	}
+	#pragma endregion SSE2
+
+	#pragma region AVX2
+	/*---------------------------------------------------------------
+			AVX2 : 8g肵܂. Z̏ԂSSE2łƓł.
+			Gather, ScatterSSE߂ŃRpC邽, ĂяoOɏ128bitNA܂
+	-----------------------------------------------------------------*/
+	struct Vector3AVX2
+	{
+		__m256 X, Y, Z;
+	};
+
+	SIMD_TARGET_AVX2 __forceinline __m256 SelectAVX2(const __m256 mask, const __m256 a, const __m256 b) { return _mm256_blendv_ps(b, a, mask); }
+	SIMD_TARGET_AVX2 __forceinline __m256 AbsAVX2   (const __m256 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+	SIMD_TARGET_AVX2 __forceinline __m256 NegateAVX2(const __m256 a) { return _mm256_xor_ps   (_mm256_set1_ps(-0.0f), a); }
+
+	/*! @brief x < 0 ? 0 : (x > 1 ? 1 : x)*/
+	SIMD_TARGET_AVX2 __forceinline __m256 Clamp01AVX2(const __m256 x)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+		return SelectAVX2(_mm256_cmp_ps(x, zero, _CMP_LT_OQ), zero, SelectAVX2(_mm256_cmp_ps(x, one, _CMP_GT_OQ), one, x));
+	}
+
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Load3AVX2(const float* x, const float* y, const float* z)
+	{
+		return { _mm256_load_ps(x), _mm256_load_ps(y), _mm256_load_ps(z) };
+	}
+
+	SIMD_TARGET_AVX2 __forceinline void Store3AVX2(const Vector3AVX2& v, float* x, float* y, float* z)
+	{
+		_mm256_store_ps(x, v.X); _mm256_store_ps(y, v.Y); _mm256_store_ps(z, v.Z);
+	}
+
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Add3AVX2     (const Vector3AVX2& a, const Vector3AVX2& b) { return { _mm256_add_ps(a.X, b.X), _mm256_add_ps(a.Y, b.Y), _mm256_add_ps(a.Z, b.Z) }; }
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Subtract3AVX2(const Vector3AVX2& a, const Vector3AVX2& b) { return { _mm256_sub_ps(a.X, b.X), _mm256_sub_ps(a.Y, b.Y), _mm256_sub_ps(a.Z, b.Z) }; }
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Scale3AVX2   (const Vector3AVX2& a, const __m256 s)       { return { _mm256_mul_ps(a.X, s), _mm256_mul_ps(a.Y, s), _mm256_mul_ps(a.Z, s) }; }
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Negate3AVX2  (const Vector3AVX2& a)                       { return { NegateAVX2(a.X), NegateAVX2(a.Y), NegateAVX2(a.Z) }; }
+
+	/*! @brief a + b * s (FMA͊ۂ߂ς邽ߎgp܂)*/
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 MultiplyAdd3AVX2(const Vector3AVX2& a, const Vector3AVX2& b, const __m256 s)
+	{
+		return { _mm256_add_ps(a.X, _mm256_mul_ps(b.X, s)), _mm256_add_ps(a.Y, _mm256_mul_ps(b.Y, s)), _mm256_add_ps(a.Z, _mm256_mul_ps(b.Z, s)) };
+	}
+
+	SIMD_TARGET_AVX2 __forceinline __m256 Dot3AVX2(const Vector3AVX2& a, const Vector3AVX2& b)
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a.X, b.X), _mm256_mul_ps(a.Y, b.Y)), _mm256_mul_ps(a.Z, b.Z));
+	}
+
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Cross3AVX2(const Vector3AVX2& a, const Vector3AVX2& b)
+	{
+		return
+		{
+			_mm256_sub_ps(_mm256_mul_ps(a.Y, b.Z), _mm256_mul_ps(a.Z, b.Y)),
+			_mm256_sub_ps(_mm256_mul_ps(a.Z, b.X), _mm256_mul_ps(a.X, b.Z)),
+			_mm256_sub_ps(_mm256_mul_ps(a.X, b.Y), _mm256_mul_ps(a.Y, b.X))
+		};
+	}
+
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Select3AVX2(const __m256 mask, const Vector3AVX2& a, const Vector3AVX2& b)
+	{
+		return { SelectAVX2(mask, a.X, b.X), SelectAVX2(mask, a.Y, b.Y), SelectAVX2(mask, a.Z, b.Z) };
+	}
+
+	SIMD_TARGET_AVX2 __forceinline Vector3AVX2 Rotate3AVX2(const Vector3AVX2& u, const __m256 w, const Vector3AVX2& v)
+	{
+		const Vector3AVX2 t = Scale3AVX2(Cross3AVX2(u, v), _mm256_set1_ps(2.0f));
+		return Add3AVX2(Add3AVX2(v, Scale3AVX2(t, w)), Cross3AVX2(u, t));
+	}
+
+	/*---------------------------------------------------------------
+			Ƌ
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void SphereContactAVX2(const SphereBatch& batch, PointContactBatch& result)
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+
+		const Vector3AVX2 centerA = Load3AVX2(batch.CenterAX, batch.CenterAY, batch.CenterAZ);
+		const Vector3AVX2 centerB = Load3AVX2(batch.CenterBX, batch.CenterBY, batch.CenterBZ);
+		const __m256      radiusA = _mm256_load_ps(batch.RadiusA);
+		const __m256      radiusB = _mm256_load_ps(batch.RadiusB);
+
+		const Vector3AVX2 d           = Subtract3AVX2(centerB, centerA);
+		const __m256      distance    = _mm256_sqrt_ps(Dot3AVX2(d, d));
+		const __m256      penetration = _mm256_sub_ps(_mm256_add_ps(radiusA, radiusB), distance);
+		const __m256      isHit       = _mm256_cmp_ps(penetration, _mm256_set1_ps(-SPECULATIVE_DISTANCE), _CMP_NLT_UQ);
+
+		const Vector3AVX2 direction = Scale3AVX2(d, _mm256_div_ps(one, distance));
+		const Vector3AVX2 normal    = Select3AVX2(_mm256_cmp_ps(distance, _mm256_set1_ps(1e-6f), _CMP_GT_OQ), direction, { zero, one, zero });
+
+		const Vector3AVX2 surfaceA = MultiplyAdd3AVX2(centerA, normal, radiusA);
+		const Vector3AVX2 surfaceB = MultiplyAdd3AVX2(centerB, normal, NegateAVX2(radiusB));
+		const Vector3AVX2 position = Scale3AVX2(Add3AVX2(surfaceA, surfaceB), _mm256_set1_ps(0.5f));
+
+		Store3AVX2(normal  , result.NormalX  , result.NormalY  , result.NormalZ);
+		Store3AVX2(position, result.PositionX, result.PositionY, result.PositionZ);
+		_mm256_store_ps(result.Penetration, penetration);
+		_mm256_store_ps(result.FeatureID  , zero);
+		result.HitMask = static_cast<uint32>(_mm256_movemask_ps(isHit));
+	}
+
+	SIMD_TARGET_AVX2 void CollideSpheresAVX2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		SphereBatch       batch;
+		PointContactBatch result;
+		for (uint64 i = 0; i < count; i += 8)
+		{
+			const uint32 laneCount = GatherSpheres(shapes, pairs, entries + i, count - i, 8, batch);
+			SphereContactAVX2(batch, result);
+			_mm256_zeroupper();
+			ScatterPointContacts(pairs, entries + i, laneCount, result, manifolds, isHits);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			ƃ{bNX
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void SphereBoxContactAVX2(const SphereBoxBatch& batch, PointContactBatch& result)
+	{
+		const __m256 zero     = _mm256_setzero_ps();
+		const __m256 one      = _mm256_set1_ps(1.0f);
+		const __m256 minusOne = _mm256_set1_ps(-1.0f);
+
+		const Vector3AVX2 center = Load3AVX2(batch.SphereX, batch.SphereY, batch.SphereZ);
+		const __m256      radius = _mm256_load_ps(batch.Radius);
+		const Vector3AVX2 box    = Load3AVX2(batch.BoxX, batch.BoxY, batch.BoxZ);
+		const Vector3AVX2 u      = Load3AVX2(batch.OrientationX, batch.OrientationY, batch.OrientationZ);
+		const __m256      w      = _mm256_load_ps(batch.OrientationW);
+		const Vector3AVX2 h      = Load3AVX2(batch.HalfX, batch.HalfY, batch.HalfZ);
+
+		const Vector3AVX2 local = Rotate3AVX2(Negate3AVX2(u), w, Subtract3AVX2(center, box));
+		const Vector3AVX2 clamped =
+		{
+			SelectAVX2(_mm256_cmp_ps(local.X, NegateAVX2(h.X), _CMP_LT_OQ), NegateAVX2(h.X), SelectAVX2(_mm256_cmp_ps(local.X, h.X, _CMP_GT_OQ), h.X, local.X)),
+			SelectAVX2(_mm256_cmp_ps(local.Y, NegateAVX2(h.Y), _CMP_LT_OQ), NegateAVX2(h.Y), SelectAVX2(_mm256_cmp_ps(local.Y, h.Y, _CMP_GT_OQ), h.Y, local.Y)),
+			SelectAVX2(_mm256_cmp_ps(local.Z, NegateAVX2(h.Z), _CMP_LT_OQ), NegateAVX2(h.Z), SelectAVX2(_mm256_cmp_ps(local.Z, h.Z, _CMP_GT_OQ), h.Z, local.Z))
+		};
+
+		const Vector3AVX2 d               = Subtract3AVX2(local, clamped);
+		const __m256      distanceSquared = Dot3AVX2(d, d);
+		const __m256      isOutside       = _mm256_cmp_ps(distanceSquared, _mm256_set1_ps(1e-12f), _CMP_GT_OQ);
+
+		const __m256      distance           = _mm256_sqrt_ps(distanceSquared);
+		const __m256      outsidePenetration = _mm256_sub_ps(radius, distance);
+		const Vector3AVX2 outsideNormal      = Scale3AVX2(d, _mm256_div_ps(one, distance));
+
+		const __m256 distanceX   = _mm256_sub_ps(h.X, AbsAVX2(local.X));
+		const __m256 distanceY   = _mm256_sub_ps(h.Y, AbsAVX2(local.Y));
+		const __m256 distanceZ   = _mm256_sub_ps(h.Z, AbsAVX2(local.Z));
+		const __m256 isY         = _mm256_cmp_ps(distanceY, distanceX, _CMP_LT_OQ);
+		const __m256 minXY       = SelectAVX2(isY, distanceY, distanceX);
+		const __m256 isZ         = _mm256_cmp_ps(distanceZ, minXY, _CMP_LT_OQ);
+		const __m256 selectY     = _mm256_andnot_ps(isZ, isY);
+		const __m256 selectX     = _mm256_andnot_ps(_mm256_or_ps(isY, isZ), _mm256_castsi256_ps(_mm256_set1_epi32(-1)));
+		const __m256 minDistance = SelectAVX2(isZ, distanceZ, minXY);
+
+		const __m256 signX = SelectAVX2(_mm256_cmp_ps(local.X, zero, _CMP_GE_OQ), one, minusOne);
+		const __m256 signY = SelectAVX2(_mm256_cmp_ps(local.Y, zero, _CMP_GE_OQ), one, minusOne);
+		const __m256 signZ = SelectAVX2(_mm256_cmp_ps(local.Z, zero, _CMP_GE_OQ), one, minusOne);
+
+		const Vector3AVX2 insideNormal = { _mm256_and_ps(selectX, signX), _mm256_and_ps(selectY, signY), _mm256_and_ps(isZ, signZ) };
+		const Vector3AVX2 insideSurface =
+		{
+			SelectAVX2(selectX, _mm256_mul_ps(signX, h.X), local.X),
+			SelectAVX2(selectY, _mm256_mul_ps(signY, h.Y), local.Y),
+			SelectAVX2(isZ    , _mm256_mul_ps(signZ, h.Z), local.Z)
+		};
+		const __m256 insidePenetration = _mm256_add_ps(radius, minDistance);
+		const __m256 insideFeature     = SelectAVX2(isZ, _mm256_set1_ps(3.0f), SelectAVX2(isY, _mm256_set1_ps(2.0f), one));
+
+		const Vector3AVX2 localNormal  = Select3AVX2(isOutside, outsideNormal, insideNormal);
+		const Vector3AVX2 localSurface = Select3AVX2(isOutside, clamped, insideSurface);
+		const __m256      penetration  = SelectAVX2(isOutside, outsidePenetration, insidePenetration);
+		const __m256      isHit        = _mm256_or_ps(_mm256_cmp_ps(distanceSquared, _mm256_set1_ps(1e-12f), _CMP_NGT_UQ), _mm256_cmp_ps(outsidePenetration, _mm256_set1_ps(-SPECULATIVE_DISTANCE), _CMP_NLT_UQ));
+
+		const Vector3AVX2 normal        = Rotate3AVX2(u, w, localNormal);
+		const Vector3AVX2 surfaceBox    = Add3AVX2(box, Rotate3AVX2(u, w, localSurface));
+		const Vector3AVX2 surfaceSphere = MultiplyAdd3AVX2(center, normal, NegateAVX2(radius));
+		const Vector3AVX2 position      = Scale3AVX2(Add3AVX2(surfaceBox, surfaceSphere), _mm256_set1_ps(0.5f));
+
+		Store3AVX2(Negate3AVX2(normal), result.NormalX, result.NormalY, result.NormalZ);
+		Store3AVX2(position, result.PositionX, result.PositionY, result.PositionZ);
+		_mm256_store_ps(result.Penetration, penetration);
+		_mm256_store_ps(result.FeatureID  , _mm256_andnot_ps(isOutside, insideFeature));
+		result.HitMask = static_cast<uint32>(_mm256_movemask_ps(isHit));
+	}
+
+	SIMD_TARGET_AVX2 void CollideSphereBoxesAVX2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		SphereBoxBatch    batch;
+		PointContactBatch result;
+		for (uint64 i = 0; i < count; i += 8)
+		{
+			const uint32 laneCount = GatherSphereBoxes(shapes, pairs, entries + i, count - i, 8, batch);
+			SphereBoxContactAVX2(batch, result);
+			_mm256_zeroupper();
+			ScatterPointContacts(pairs, entries + i, laneCount, result, manifolds, isHits);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			{bNXƃ{bNX̕
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void FindBoxAxesAVX2(const BoxBatch& batch, BoxAxisBatch& result)
+	{
+		const __m256 zero        = _mm256_setzero_ps();
+		const __m256 one         = _mm256_set1_ps(1.0f);
+		const __m256 speculative = _mm256_set1_ps(SPECULATIVE_DISTANCE);
+		const __m256 relative    = _mm256_set1_ps(AXIS_RELATIVE_TOLERANCE);
+		const __m256 absolute    = _mm256_set1_ps(AXIS_ABSOLUTE_TOLERANCE);
+
+		Vector3AVX2 axisA[3], axisB[3];
+		__m256      halfA[3], halfB[3];
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			axisA[i] = Load3AVX2(batch.AxisA[i][0], batch.AxisA[i][1], batch.AxisA[i][2]);
+			axisB[i] = Load3AVX2(batch.AxisB[i][0], batch.AxisB[i][1], batch.AxisB[i][2]);
+			halfA[i] = _mm256_load_ps(batch.HalfA[i]);
+			halfB[i] = _mm256_load_ps(batch.HalfB[i]);
+		}
+		const Vector3AVX2 d = Subtract3AVX2(Load3AVX2(batch.CenterB[0], batch.CenterB[1], batch.CenterB[2]), Load3AVX2(batch.CenterA[0], batch.CenterA[1], batch.CenterA[2]));
+
+		__m256 absC[3][3], dA[3], dB[3];
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			for (uint32 j = 0; j < 3; ++j)
+			{
+				absC[i][j] = _mm256_add_ps(AbsAVX2(Dot3AVX2(axisA[i], axisB[j])), _mm256_set1_ps(1e-6f));
+			}
+			dA[i] = Dot3AVX2(d, axisA[i]);
+			dB[i] = Dot3AVX2(d, axisB[i]);
+		}
+
+		__m256      isSeparated    = zero;
+		__m256      bestSeparation = _mm256_set1_ps(-FLT_MAX);
+		__m256      bestType       = zero;
+		__m256      bestIndex      = zero;
+		Vector3AVX2 bestNormal     = { zero, zero, zero };
+
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			const __m256 radiusB    = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(halfB[0], absC[i][0]), _mm256_mul_ps(halfB[1], absC[i][1])), _mm256_mul_ps(halfB[2], absC[i][2]));
+			const __m256 separation = _mm256_sub_ps(AbsAVX2(dA[i]), _mm256_add_ps(halfA[i], radiusB));
+			isSeparated = _mm256_or_ps(isSeparated, _mm256_cmp_ps(separation, speculative, _CMP_GT_OQ));
+
+			const __m256 isBetter = _mm256_cmp_ps(separation, bestSeparation, _CMP_GT_OQ);
+			bestSeparation = SelectAVX2(isBetter, separation, bestSeparation);
+			bestType       = SelectAVX2(isBetter, zero, bestType);
+			bestIndex      = SelectAVX2(isBetter, _mm256_set1_ps(static_cast<float>(i)), bestIndex);
+			bestNormal     = Select3AVX2(isBetter, Select3AVX2(_mm256_cmp_ps(dA[i], zero, _CMP_GE_OQ), axisA[i], Negate3AVX2(axisA[i])), bestNormal);
+		}
+
+		const __m256 faceThresholdA = _mm256_add_ps(_mm256_mul_ps(relative, bestSeparation), absolute);
+		for (uint32 j = 0; j < 3; ++j)
+		{
+			const __m256 radiusA    = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(halfA[0], absC[0][j]), _mm256_mul_ps(halfA[1], absC[1][j])), _mm256_mul_ps(halfA[2], absC[2][j]));
+			const __m256 separation = _mm256_sub_ps(AbsAVX2(dB[j]), _mm256_add_ps(radiusA, halfB[j]));
+			isSeparated = _mm256_or_ps(isSeparated, _mm256_cmp_ps(separation, speculative, _CMP_GT_OQ));
+
+			const __m256 isBetter = _mm256_and_ps(_mm256_cmp_ps(separation, faceThresholdA, _CMP_GT_OQ), _mm256_cmp_ps(separation, bestSeparation, _CMP_GT_OQ));
+			bestSeparation = SelectAVX2(isBetter, separation, bestSeparation);
+			bestType       = SelectAVX2(isBetter, one, bestType);
+			bestIndex      = SelectAVX2(isBetter, _mm256_set1_ps(static_cast<float>(j)), bestIndex);
+			bestNormal     = Select3AVX2(isBetter, Select3AVX2(_mm256_cmp_ps(dB[j], zero, _CMP_GE_OQ), axisB[j], Negate3AVX2(axisB[j])), bestNormal);
+		}
+
+		const __m256 faceThreshold = _mm256_add_ps(_mm256_mul_ps(relative, bestSeparation), absolute);
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			const uint32 i1 = (i + 1) % 3;
+			const uint32 i2 = (i + 2) % 3;
+			for (uint32 j = 0; j < 3; ++j)
+			{
+				const uint32 j1 = (j + 1) % 3;
+				const uint32 j2 = (j + 2) % 3;
+
+				const Vector3AVX2 axis    = Cross3AVX2(axisA[i], axisB[j]);
+				const __m256      length  = _mm256_sqrt_ps(Dot3AVX2(axis, axis));
+				const __m256      isValid = _mm256_cmp_ps(length, _mm256_set1_ps(1e-5f), _CMP_NLT_UQ);
+
+				const __m256 radiusA    = _mm256_add_ps(_mm256_mul_ps(halfA[i1], absC[i2][j]), _mm256_mul_ps(halfA[i2], absC[i1][j]));
+				const __m256 radiusB    = _mm256_add_ps(_mm256_mul_ps(halfB[j1], absC[i][j2]), _mm256_mul_ps(halfB[j2], absC[i][j1]));
+				const __m256 distance   = Dot3AVX2(d, axis);
+				const __m256 separation = _mm256_div_ps(_mm256_sub_ps(AbsAVX2(distance), _mm256_add_ps(radiusA, radiusB)), length);
+				isSeparated = _mm256_or_ps(isSeparated, _mm256_and_ps(isValid, _mm256_cmp_ps(separation, speculative, _CMP_GT_OQ)));
+
+				const __m256 isBetter = _mm256_and_ps(isValid, _mm256_and_ps(_mm256_cmp_ps(separation, faceThreshold, _CMP_GT_OQ), _mm256_cmp_ps(separation, bestSeparation, _CMP_GT_OQ)));
+				const __m256 scale    = _mm256_div_ps(SelectAVX2(_mm256_cmp_ps(distance, zero, _CMP_GE_OQ), one, _mm256_set1_ps(-1.0f)), length);
+				bestSeparation = SelectAVX2(isBetter, separation, bestSeparation);
+				bestType       = SelectAVX2(isBetter, _mm256_set1_ps(2.0f), bestType);
+				bestIndex      = SelectAVX2(isBetter, _mm256_set1_ps(static_cast<float>(i * 3 + j)), bestIndex);
+				bestNormal     = Select3AVX2(isBetter, Scale3AVX2(axis, scale), bestNormal);
+			}
+		}
+
+		_mm256_store_ps(result.Type      , bestType);
+		_mm256_store_ps(result.Index     , bestIndex);
+		_mm256_store_ps(result.Separation, bestSeparation);
+		Store3AVX2(bestNormal, result.NormalX, result.NormalY, result.NormalZ);
+		result.SeparatedMask = static_cast<uint32>(_mm256_movemask_ps(isSeparated));
+	}
+
+	SIMD_TARGET_AVX2 void CollideBoxesAVX2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		BoxBatch     batch;
+		BoxAxisBatch result;
+		for (uint64 i = 0; i < count; i += 8)
+		{
+			const uint32 laneCount = GatherBoxes(shapes, pairs, entries + i, count - i, 8, batch);
+			FindBoxAxesAVX2(batch, result);
+			_mm256_zeroupper();
+			ScatterBoxContacts(shapes, pairs, entries + i, laneCount, result, manifolds, isHits);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			JvZƃJvZ
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void ClosestPointsAVX2(const CapsuleBatch& batch, SphereBatch& closest)
+	{
+		const __m256 zero    = _mm256_setzero_ps();
+		const __m256 one     = _mm256_set1_ps(1.0f);
+		const __m256 epsilon = _mm256_set1_ps(1e-12f);
+
+		const Vector3AVX2 p1 = Load3AVX2(batch.StartA[0], batch.StartA[1], batch.StartA[2]);
+		const Vector3AVX2 p2 = Load3AVX2(batch.StartB[0], batch.StartB[1], batch.StartB[2]);
+		const Vector3AVX2 d1 = Subtract3AVX2(Load3AVX2(batch.EndA[0], batch.EndA[1], batch.EndA[2]), p1);
+		const Vector3AVX2 d2 = Subtract3AVX2(Load3AVX2(batch.EndB[0], batch.EndB[1], batch.EndB[2]), p2);
+		const Vector3AVX2 r  = Subtract3AVX2(p1, p2);
+
+		const __m256 a = Dot3AVX2(d1, d1);
+		const __m256 e = Dot3AVX2(d2, d2);
+		const __m256 f = Dot3AVX2(d2, r);
+		const __m256 c = Dot3AVX2(d1, r);
+		const __m256 b = Dot3AVX2(d1, d2);
+		const __m256 isPointA = _mm256_cmp_ps(a, epsilon, _CMP_LE_OQ);
+		const __m256 isPointB = _mm256_cmp_ps(e, epsilon, _CMP_LE_OQ);
+
+		const __m256 denom  = _mm256_sub_ps(_mm256_mul_ps(a, e), _mm256_mul_ps(b, b));
+		const __m256 s0     = Clamp01AVX2(SelectAVX2(_mm256_cmp_ps(denom, epsilon, _CMP_GT_OQ), _mm256_div_ps(_mm256_sub_ps(_mm256_mul_ps(b, f), _mm256_mul_ps(c, e)), denom), zero));
+		const __m256 t0     = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(b, s0), f), e);
+		const __m256 isLow  = _mm256_cmp_ps(t0, zero, _CMP_LT_OQ);
+		const __m256 isHigh = _mm256_cmp_ps(t0, one , _CMP_GT_OQ);
+
+		const __m256 sLow    = Clamp01AVX2(_mm256_div_ps(NegateAVX2(c), a));
+		const __m256 sHigh   = Clamp01AVX2(_mm256_div_ps(_mm256_sub_ps(b, c), a));
+		const __m256 sLine   = SelectAVX2(isLow, sLow, SelectAVX2(isHigh, sHigh, s0));
+		const __m256 tLine   = SelectAVX2(isLow, zero, SelectAVX2(isHigh, one, t0));
+		const __m256 tPointA = Clamp01AVX2(_mm256_div_ps(f, e));
+
+		const __m256 s = SelectAVX2(isPointA, zero, SelectAVX2(isPointB, sLow, sLine));
+		const __m256 t = SelectAVX2(isPointB, zero, SelectAVX2(isPointA, tPointA, tLine));
+
+		Store3AVX2(MultiplyAdd3AVX2(p1, d1, s), closest.CenterAX, closest.CenterAY, closest.CenterAZ);
+		Store3AVX2(MultiplyAdd3AVX2(p2, d2, t), closest.CenterBX, closest.CenterBY, closest.CenterBZ);
+		_mm256_store_ps(closest.RadiusA, _mm256_load_ps(batch.RadiusA));
+		_mm256_store_ps(closest.RadiusB, _mm256_load_ps(batch.RadiusB));
+	}
+
+	SIMD_TARGET_AVX2 void CollideCapsulesAVX2(const CollisionShape* shapes, const NarrowphasePair* pairs, const uint32* entries, const uint64 count, ContactManifold* manifolds, uint8* isHits)
+	{
+		CapsuleBatch      batch;
+		SphereBatch       closest;
+		PointContactBatch result;
+		for (uint64 i = 0; i < count; i += 8)
+		{
+			const uint32 laneCount = GatherCapsules(shapes, pairs, entries + i, count - i, 8, batch);
+			ClosestPointsAVX2(batch, closest);
+			SphereContactAVX2(closest, result);
+			_mm256_zeroupper();
+			ScatterPointContacts(pairs, entries + i, laneCount, result, manifolds, isHits);
+			ScatterCapsuleFallbacks(shapes, pairs, entries + i, batch.FallbackMask, manifolds, isHits);
+		}
+	}
+	#pragma endregion AVX2
+
+	/*---------------------------------------------------------------
+			[NarrowphaseBucket][SimdInstructionSet]̊֐e[u
+			SSE4.1ŗL̖߂őȂӏ͖, SSE4.1SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr CollideFunction COLLIDE_FUNCTIONS[][static_cast<size_t>(SimdInstructionSet::CountOf)] =
+	{
+		{ CollideScalar, CollideSpheresSSE2    , CollideSpheresSSE2    , CollideSpheresAVX2     },
+		{ CollideScalar, CollideSphereBoxesSSE2, CollideSphereBoxesSSE2, CollideSphereBoxesAVX2 },
+		{ CollideScalar, CollideBoxesSSE2      , CollideBoxesSSE2      , CollideBoxesAVX2       },
+		{ CollideScalar, CollideCapsulesSSE2   , CollideCapsulesSSE2   , CollideCapsulesAVX2    },
+		{ CollideScalar, CollideScalar         , CollideScalar         , CollideScalar          },
+	};
+#else
+	constexpr CollideFunction COLLIDE_FUNCTIONS[][static_cast<size_t>(SimdInstructionSet::CountOf)] =
+	{
+		{ CollideScalar, CollideScalar, CollideScalar, CollideScalar },
+		{ CollideScalar, CollideScalar, CollideScalar, CollideScalar },
+		{ CollideScalar, CollideScalar, CollideScalar, CollideScalar },
+		{ CollideScalar, CollideScalar, CollideScalar, CollideScalar },
+		{ CollideScalar, CollideScalar, CollideScalar, CollideScalar },
+	};
+#endif
+
+	static_assert(sizeof(COLLIDE_FUNCTIONS) / sizeof(COLLIDE_FUNCTIONS[0]) == static_cast<size_t>(NarrowphaseBucket::CountOf), "function table must cover every bucket.");
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     o^gƑǑʂj܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void BatchedNarrowphase::Begin()
+{
+	_pairs.Clear();
+	_manifoldCount = 0;
+}
+
+/*!**********************************************************************
+*  @brief     o^SĂ̑g𔻒肵, ڐGĂg̃}jtH[h͏ɋl߂ďo͂܂.
+*  @param[in] const CollisionShape* `̔z
+*  @return    void
+*************************************************************************/
+void BatchedNarrowphase::Collide(const CollisionShape* shapes)
+{
+	const uint64 pairCount = _pairs.Size();
+	_manifoldCount = 0;
+	if (pairCount == 0) { return; }
+
+	BuildBuckets(shapes);
+
+	// SĂ̑gꂩ̐U蕪ŏ܂邽, ͕svł
+	_manifolds.Clear();
+	_manifolds.Resize(pairCount, false);
+	_isHits.Clear();
+	_isHits.Resize(pairCount, false);
+
+	const uint8 instructionSet = static_cast<uint8>(CPUFeature::GetActive());
+	for (uint8 bucket = 0; bucket < static_cast<uint8>(NarrowphaseBucket::CountOf); ++bucket)
+	{
+		if (_buckets[bucket].IsEmpty()) { continue; }
+
+		COLLIDE_FUNCTIONS[bucket][instructionSet](shapes, _pairs.Data(), _buckets[bucket].Data(), _buckets[bucket].Size(), _manifolds.Data(), _isHits.Data());
+	}
+
+	CompactManifolds();
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     g`̑gݍ킹ƂɐU蕪܂. t̑gݍ킹({bNXƋȂ)͓ւĔ肷t܂.
+*  @param[in] const CollisionShape* `̔z
+*  @return    void
+*************************************************************************/
+void BatchedNarrowphase::BuildBuckets(const CollisionShape* shapes)
+{
+	for (auto& bucket : _buckets) { bucket.Clear(); }
+
+	const uint32 pairCount = static_cast<uint32>(_pairs.Size());
+	for (uint32 i = 0; i < pairCount; ++i)
+	{
+		const int32 orderA = GetShapeOrder(shapes[_pairs[i].ShapeA].Type);
+		const int32 orderB = GetShapeOrder(shapes[_pairs[i].ShapeB].Type);
+		const int32 lower  = orderA < orderB ? orderA : orderB;
+		const int32 upper  = orderA < orderB ? orderB : orderA;
+
+		NarrowphaseBucket bucket = NarrowphaseBucket::Generic;
+		if      (lower == 0 && upper == 0) { bucket = NarrowphaseBucket::SphereSphere;   }
+		else if (lower == 0 && upper == 1) { bucket = NarrowphaseBucket::SphereBox;      }
+		else if (lower == 1 && upper == 1) { bucket = NarrowphaseBucket::BoxBox;         }
+		else if (lower == 2 && upper == 2) { bucket = NarrowphaseBucket::CapsuleCapsule; }
+
+		// Generic ContactGenerator::Collide Ԃւ邽߈t܂
+		const bool isSwapped = bucket != NarrowphaseBucket::Generic && orderA > orderB;
+		_buckets[static_cast<uint8>(bucket)].Push(isSwapped ? (i | SWAPPED_BIT) : i);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ڐGĂg̃}jtH[h͏̂܂ܐ擪֋l߂܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void BatchedNarrowphase::CompactManifolds()
+{
+	const uint64 pairCount = _pairs.Size();
+
+	uint32 count = 0;
+	for (uint64 i = 0; i < pairCount; ++i)
+	{
+		if (!_isHits[i]) { continue; }
+
+		// gpĂȂڐG_̓Rs[܂
+		if (count != i)
+		{
+			const ContactManifold& source = _manifolds[i];
+			Memory::Copy(&_manifolds[count], &source, offsetof(ContactManifold, Points) + source.PointCount * sizeof(ContactPoint));
+		}
+		++count;
+	}
+	_manifoldCount = count;
+}
+#pragma endregion Protected Function
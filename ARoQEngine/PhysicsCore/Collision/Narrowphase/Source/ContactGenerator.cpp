@@ -0,0 +1,787 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ContactGenerator.cpp
+///  @brief  , {bNX, JvZ̑gݍ킹ƂɐڐG_߂XJ[̔֐Qł.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/ContactGenerator.hpp"
+#include "PhysicsCore/Core/Private/Include/PhysicsMath.hpp"
+#include <cfloat>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics;
+using namespace physics::collision;
+using namespace physics::collision::details::narrowphase;
+using namespace physics::details::math;
+using namespace physics::geometry;
+using namespace gu;
+
+namespace
+{
+	/*! @brief ӂ̑gݍ킹̎ʂ̎D悷邽߂̋el. ʂ̐ڐG̕_肷邽, 炩ɐ󂢏ꍇӂIт܂*/
+	constexpr float AXIS_RELATIVE_TOLERANCE = 0.95f;
+	constexpr float AXIS_ABSOLUTE_TOLERANCE = 0.001f;
+
+	/*! @brief Nbv̑p`̍ő咸_ (lp`4̕ʂŃNbvƍő8_)*/
+	constexpr uint32 MAX_CLIP_VERTICES = 8;
+
+	/*---------------------------------------------------------------
+			x, y, zCfbNXŎo܂
+	-----------------------------------------------------------------*/
+	__forceinline float GetComponent(const gm::Float3& v, const uint32 i)
+	{
+		return i == 0 ? v.x : (i == 1 ? v.y : v.z);
+	}
+
+	/*---------------------------------------------------------------
+			}jtH[h, @ݒ肵܂
+	-----------------------------------------------------------------*/
+	__forceinline void BeginManifold(ContactManifold& manifold, const gm::Float3& normal)
+	{
+		manifold.Normal     = normal;
+		manifold.PointCount = 0;
+	}
+
+	/*---------------------------------------------------------------
+			ڐG_ǉ܂
+	-----------------------------------------------------------------*/
+	__forceinline void AddPoint(ContactManifold& manifold, const gm::Float3& position, const float penetration, const uint32 featureID)
+	{
+		ContactPoint& point   = manifold.Points[manifold.PointCount++];
+		point.Position        = position;
+		point.Penetration     = penetration;
+		point.FeatureID       = featureID;
+		point.NormalImpulse   = 0.0f;
+		point.TangentImpulse1 = 0.0f;
+		point.TangentImpulse2 = 0.0f;
+	}
+
+	/*---------------------------------------------------------------
+			2̋̐ڐG. @AB, ʒu͕\ʂ̒_ł
+	-----------------------------------------------------------------*/
+	bool SphereSphereContact(const gm::Float3& centerA, const float radiusA, const gm::Float3& centerB, const float radiusB, gm::Float3& normal, float& penetration, gm::Float3& position)
+	{
+		const gm::Float3 d        = Subtract(centerB, centerA);
+		const float      distance = Length(d);
+		penetration = radiusA + radiusB - distance;
+		if (penetration < -SPECULATIVE_DISTANCE) { return false; }
+
+		normal = distance > 1e-6f ? Scale(d, 1.0f / distance) : gm::Float3(0.0f, 1.0f, 0.0f);
+
+		const gm::Float3 surfaceA = MultiplyAdd(centerA, normal,  radiusA);
+		const gm::Float3 surfaceB = MultiplyAdd(centerB, normal, -radiusB);
+		position = Scale(Add(surfaceA, surfaceB), 0.5f);
+		return true;
+	}
+
+	/*---------------------------------------------------------------
+			{bNXƋ̐ڐG. @̓{bNX狅֌܂.
+			̒S{bNX̓ɂꍇ, ł߂ʂ牟o܂
+	-----------------------------------------------------------------*/
+	bool BoxSphereContact(const CollisionShape& box, const gm::Float3& center, const float radius, gm::Float3& normal, float& penetration, gm::Float3& position, uint32& featureID)
+	{
+		const gm::Float3 local = InverseRotate(box.Orientation, Subtract(center, box.Position));
+		const gm::Float3& h    = box.HalfExtents;
+
+		const gm::Float3 clamped
+		(
+			local.x < -h.x ? -h.x : (local.x > h.x ? h.x : local.x),
+			local.y < -h.y ? -h.y : (local.y > h.y ? h.y : local.y),
+			local.z < -h.z ? -h.z : (local.z > h.z ? h.z : local.z)
+		);
+
+		const gm::Float3 d = Subtract(local, clamped);
+		const float distanceSquared = LengthSquared(d);
+
+		gm::Float3 localNormal = {};
+		gm::Float3 localSurface = clamped;
+		if (distanceSquared > 1e-12f)
+		{
+			/*-------------------------------------------------------------------
+			-      S{bNX̊O
+			---------------------------------------------------------------------*/
+			const float distance = std::sqrt(distanceSquared);
+			penetration = radius - distance;
+			if (penetration < -SPECULATIVE_DISTANCE) { return false; }
+
+			localNormal = Scale(d, 1.0f / distance);
+			featureID   = 0;
+		}
+		else
+		{
+			/*-------------------------------------------------------------------
+			-      S{bNX̓ : ł߂ʂT܂
+			---------------------------------------------------------------------*/
+			uint32 axis        = 0;
+			float  minDistance = FLT_MAX;
+			float  sign        = 1.0f;
+			for (uint32 i = 0; i < 3; ++i)
+			{
+				const float value = GetComponent(local, i);
+				const float half  = GetComponent(h, i);
+				const float distance = half - std::fabs(value);
+				if (distance < minDistance)
+				{
+					minDistance = distance;
+					axis        = i;
+					sign        = value >= 0.0f ? 1.0f : -1.0f;
+				}
+			}
+
+			localNormal = gm::Float3(axis == 0 ? sign : 0.0f, axis == 1 ? sign : 0.0f, axis == 2 ? sign : 0.0f);
+			localSurface = local;
+			if (axis == 0) { localSurface.x = sign * h.x; }
+			if (axis == 1) { localSurface.y = sign * h.y; }
+			if (axis == 2) { localSurface.z = sign * h.z; }
+
+			penetration = radius + minDistance;
+			featureID   = 1 + axis;
+		}
+
+		normal = Rotate(box.Orientation, localNormal);
+
+		const gm::Float3 surfaceBox    = Add(box.Position, Rotate(box.Orientation, localSurface));
+		const gm::Float3 surfaceSphere = MultiplyAdd(center, normal, -radius);
+		position = Scale(Add(surfaceBox, surfaceSphere), 0.5f);
+		return true;
+	}
+
+	/*---------------------------------------------------------------
+			_ւ̍ŋߓ_̃p[^ [0, 1]
+	-----------------------------------------------------------------*/
+	__forceinline float ClosestParameterOnSegment(const gm::Float3& point, const gm::Float3& start, const gm::Float3& end)
+	{
+		const gm::Float3 d = Subtract(end, start);
+		const float lengthSquared = LengthSquared(d);
+		if (lengthSquared <= 1e-12f) { return 0.0f; }
+
+		const float t = Dot(Subtract(point, start), d) / lengthSquared;
+		return t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+	}
+
+	/*---------------------------------------------------------------
+			2̐̍ŋߓ_ (Ericson, Real-Time Collision Detection 5.1.9)
+	-----------------------------------------------------------------*/
+	void ClosestPointsSegmentSegment(const gm::Float3& p1, const gm::Float3& q1, const gm::Float3& p2, const gm::Float3& q2, gm::Float3& c1, gm::Float3& c2)
+	{
+		const gm::Float3 d1 = Subtract(q1, p1);
+		const gm::Float3 d2 = Subtract(q2, p2);
+		const gm::Float3 r  = Subtract(p1, p2);
+		const float a = LengthSquared(d1);
+		const float e = LengthSquared(d2);
+		const float f = Dot(d2, r);
+
+		float s = 0.0f;
+		float t = 0.0f;
+		if (a <= 1e-12f && e <= 1e-12f)
+		{
+			s = t = 0.0f;
+		}
+		else if (a <= 1e-12f)
+		{
+			t = f / e;
+			t = t < 0.0f ? 0.0f : (t > 1.0f ? 1.0f : t);
+		}
+		else
+		{
+			const float c = Dot(d1, r);
+			if (e <= 1e-12f)
+			{
+				s = -c / a;
+				s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+			}
+			else
+			{
+				const float b     = Dot(d1, d2);
+				const float denom = a * e - b * b;
+				s = denom > 1e-12f ? (b * f - c * e) / denom : 0.0f;
+				s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+
+				t = (b * s + f) / e;
+				if (t < 0.0f)
+				{
+					t = 0.0f;
+					s = -c / a;
+					s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+				}
+				else if (t > 1.0f)
+				{
+					t = 1.0f;
+					s = (b - c) / a;
+					s = s < 0.0f ? 0.0f : (s > 1.0f ? 1.0f : s);
+				}
+			}
+		}
+
+		c1 = MultiplyAdd(p1, d1, s);
+		c2 = MultiplyAdd(p2, d2, t);
+	}
+
+	/*---------------------------------------------------------------
+			JvZ̗̎[
+	-----------------------------------------------------------------*/
+	__forceinline void GetCapsuleSegment(const CollisionShape& capsule, gm::Float3& start, gm::Float3& end)
+	{
+		const gm::Float3 axis = Rotate(capsule.Orientation, gm::Float3(0.0f, capsule.HalfHeight, 0.0f));
+		start = Subtract(capsule.Position, axis);
+		end   = Add     (capsule.Position, axis);
+	}
+
+	/*---------------------------------------------------------------
+			p`𕽖 dot(n, p) <= offset ŃNbv܂ (Sutherland-Hodgman)
+	-----------------------------------------------------------------*/
+	uint32 ClipPolygon(const gm::Float3* input, const uint32* inputIDs, const uint32 inputCount, const gm::Float3& n, const float offset, const uint32 clipID, gm::Float3* output, uint32* outputIDs)
+	{
+		if (inputCount == 0) { return 0; }
+
+		uint32 outputCount = 0;
+		gm::Float3 previous        = input[inputCount - 1];
+		float      previousDistance = Dot(n, previous) - offset;
+		for (uint32 i = 0; i < inputCount; ++i)
+		{
+			const gm::Float3& current         = input[i];
+			const float       currentDistance = Dot(n, current) - offset;
+
+			// ӂʂ؂ꍇ͌_ǉ܂
+			if ((previousDistance <= 0.0f) != (currentDistance <= 0.0f))
+			{
+				const float t = previousDistance / (previousDistance - currentDistance);
+				output   [outputCount] = Add(previous, Scale(Subtract(current, previous), t));
+				outputIDs[outputCount] = (inputIDs[i] << 4) | clipID;
+				++outputCount;
+			}
+			if (currentDistance <= 0.0f)
+			{
+				output   [outputCount] = current;
+				outputIDs[outputCount] = inputIDs[i];
+				++outputCount;
+			}
+
+			previous         = current;
+			previousDistance = currentDistance;
+		}
+		return outputCount;
+	}
+
+	/*---------------------------------------------------------------
+			5_ȏ̐ڐG_4_Ɍ炵܂.
+			ł[_, ł_, 2_Ԑ̗ŎOp`̖ʐςőƂȂ_c܂
+	-----------------------------------------------------------------*/
+	uint32 ReduceContacts(const gm::Float3* points, const float* penetrations, const uint32 count, const gm::Float3& normal, uint32* selected)
+	{
+		if (count <= MAX_MANIFOLD_POINTS)
+		{
+			for (uint32 i = 0; i < count; ++i) { selected[i] = i; }
+			return count;
+		}
+
+		uint32 first = 0;
+		for (uint32 i = 1; i < count; ++i)
+		{
+			if (penetrations[i] > penetrations[first]) { first = i; }
+		}
+
+		uint32 second = first;
+		float  maxDistance = -1.0f;
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const float distance = LengthSquared(Subtract(points[i], points[first]));
+			if (distance > maxDistance) { maxDistance = distance; second = i; }
+		}
+
+		const gm::Float3 edge = Subtract(points[second], points[first]);
+		uint32 third  = first;
+		uint32 fourth = first;
+		float  maxArea = 0.0f;
+		float  minArea = 0.0f;
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const float area = Dot(Cross(edge, Subtract(points[i], points[first])), normal);
+			if (area > maxArea) { maxArea = area; third  = i; }
+			if (area < minArea) { minArea = area; fourth = i; }
+		}
+
+		uint32 selectedCount = 0;
+		selected[selectedCount++] = first;
+		if (second != first) { selected[selectedCount++] = second; }
+		if (third  != first) { selected[selectedCount++] = third;  }
+		if (fourth != first) { selected[selectedCount++] = fourth; }
+		return selectedCount;
+	}
+
+	/*---------------------------------------------------------------
+			{bNX̌Ƒ傫
+	-----------------------------------------------------------------*/
+	struct BoxFrame
+	{
+		gm::Float3 Center;
+		gm::Float3 Axes[3];
+		float      Half[3];
+	};
+
+	__forceinline BoxFrame MakeBoxFrame(const CollisionShape& box)
+	{
+		BoxFrame frame = {};
+		frame.Center = box.Position;
+		ToAxes(box.Orientation, frame.Axes);
+		frame.Half[0] = box.HalfExtents.x;
+		frame.Half[1] = box.HalfExtents.y;
+		frame.Half[2] = box.HalfExtents.z;
+		return frame;
+	}
+
+	/*---------------------------------------------------------------
+			ʂɑ΂đ̃{bNX̖ʂNbv, ڐG_߂܂.
+			referenceNormal͊{bNX̊O, ̃{bNXĂ܂
+	-----------------------------------------------------------------*/
+	void CollideFaces(const BoxFrame& reference, const uint32 referenceAxis, const gm::Float3& referenceNormal, const BoxFrame& incident,
+		const gm::Float3& manifoldNormal, const uint32 featureBase, ContactManifold& manifold)
+	{
+		/*-------------------------------------------------------------------
+		-      ̃{bNX, ʂƍłt̖ʂT܂
+		---------------------------------------------------------------------*/
+		uint32 incidentAxis = 0;
+		float  minDot       = FLT_MAX;
+		float  incidentSign = 1.0f;
+		for (uint32 i = 0; i < 3; ++i)
+		{
+			const float d = Dot(incident.Axes[i], referenceNormal);
+			if (-std::fabs(d) < minDot)
+			{
+				minDot       = -std::fabs(d);
+				incidentAxis = i;
+				incidentSign = d > 0.0f ? -1.0f : 1.0f;
+			}
+		}
+
+		const uint32 i1 = (incidentAxis + 1) % 3;
+		const uint32 i2 = (incidentAxis + 2) % 3;
+		const gm::Float3 faceCenter = MultiplyAdd(incident.Center, incident.Axes[incidentAxis], incidentSign * incident.Half[incidentAxis]);
+		const gm::Float3 e1 = Scale(incident.Axes[i1], incident.Half[i1]);
+		const gm::Float3 e2 = Scale(incident.Axes[i2], incident.Half[i2]);
+
+		gm::Float3 polygon[2][MAX_CLIP_VERTICES];
+		uint32     ids    [2][MAX_CLIP_VERTICES];
+		polygon[0][0] = Add(Add(faceCenter, e1), e2);
+		polygon[0][1] = Add(Subtract(faceCenter, e1), e2);
+		polygon[0][2] = Subtract(Subtract(faceCenter, e1), e2);
+		polygon[0][3] = Subtract(Add(faceCenter, e1), e2);
+		for (uint32 i = 0; i < 4; ++i) { ids[0][i] = i + 1; }
+		uint32 count = 4;
+
+		/*-------------------------------------------------------------------
+		-      ʂ4̑ʂŃNbv܂
+		---------------------------------------------------------------------*/
+		const uint32 r1 = (referenceAxis + 1) % 3;
+		const uint32 r2 = (referenceAxis + 2) % 3;
+		const float  c1 = Dot(reference.Axes[r1], reference.Center);
+		const float  c2 = Dot(reference.Axes[r2], reference.Center);
+
+		uint32 current = 0;
+		count = ClipPolygon(polygon[current], ids[current], count, reference.Axes[r1]        ,  c1 + reference.Half[r1], 1, polygon[1 - current], ids[1 - current]); current = 1 - current;
+		count = ClipPolygon(polygon[current], ids[current], count, Negate(reference.Axes[r1]), -c1 + reference.Half[r1], 2, polygon[1 - current], ids[1 - current]); current = 1 - current;
+		count = ClipPolygon(polygon[current], ids[current], count, reference.Axes[r2]        ,  c2 + reference.Half[r2], 3, polygon[1 - current], ids[1 - current]); current = 1 - current;
+		count = ClipPolygon(polygon[current], ids[current], count, Negate(reference.Axes[r2]), -c2 + reference.Half[r2], 4, polygon[1 - current], ids[1 - current]); current = 1 - current;
+
+		/*-------------------------------------------------------------------
+		-      ʂ艺(܂͓@Iȋȓ)̓_c, 2̖ʂ̒_Ɉڂ܂
+		---------------------------------------------------------------------*/
+		const float faceOffset = Dot(referenceNormal, reference.Center) + reference.Half[referenceAxis];
+
+		gm::Float3 points      [MAX_CLIP_VERTICES];
+		float      penetrations[MAX_CLIP_VERTICES];
+		uint32     pointIDs    [MAX_CLIP_VERTICES];
+		uint32     pointCount = 0;
+		for (uint32 i = 0; i < count; ++i)
+		{
+			const float separation = Dot(referenceNormal, polygon[current][i]) - faceOffset;
+			if (separation > SPECULATIVE_DISTANCE) { continue; }
+
+			points      [pointCount] = MultiplyAdd(polygon[current][i], referenceNormal, -0.5f * separation);
+			penetrations[pointCount] = -separation;
+			pointIDs    [pointCount] = ids[current][i];
+			++pointCount;
+		}
+
+		uint32 selected[MAX_MANIFOLD_POINTS];
+		const uint32 selectedCount = ReduceContacts(points, penetrations, pointCount, referenceNormal, selected);
+
+		BeginManifold(manifold, manifoldNormal);
+		for (uint32 i = 0; i < selectedCount; ++i)
+		{
+			const uint32 index = selected[i];
+			AddPoint(manifold, points[index], penetrations[index], featureBase | (incidentAxis << 4) | (pointIDs[index] << 8));
+		}
+	}
+}
+
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     `̎ނɉ֐Ăяo܂. gݍ킹t̏ꍇ͓ւĔ肵, @𔽓]܂.
+*  @param[in]  const CollisionShape& `A
+*  @param[in]  const CollisionShape& `B
+*  @param[out] ContactManifold& ڐG_
+*  @return     bool ڐG_1ȏ゠ꍇtrue
+*************************************************************************/
+bool ContactGenerator::Collide(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold)
+{
+	// AABB]t̃{bNXƂĈ܂
+	const auto GetOrder = [](const GeometryType type)
+	{
+		switch (type)
+		{
+			case GeometryType::Sphere : return 0;
+			case GeometryType::AABB   :
+			case GeometryType::OBB    : return 1;
+			case GeometryType::Capsule: return 2;
+			default                   : return -1;
+		}
+	};
+
+	const int32 orderA = GetOrder(a.Type);
+	const int32 orderB = GetOrder(b.Type);
+	if (orderA < 0 || orderB < 0) { return false; }
+
+	/*-------------------------------------------------------------------
+	-      Sphere < Box < CapsulȅɕׂĔ肵܂
+	---------------------------------------------------------------------*/
+	const bool isSwapped = orderA > orderB;
+	const CollisionShape& first  = isSwapped ? b : a;
+	const CollisionShape& second = isSwapped ? a : b;
+	const int32 firstOrder  = isSwapped ? orderB : orderA;
+	const int32 secondOrder = isSwapped ? orderA : orderB;
+
+	bool isHit = false;
+	if      (firstOrder == 0 && secondOrder == 0) { isHit = CollideSpheres      (first, second, manifold); }
+	else if (firstOrder == 0 && secondOrder == 1) { isHit = CollideSphereBox    (first, second, manifold); }
+	else if (firstOrder == 0 && secondOrder == 2) { isHit = CollideSphereCapsule(first, second, manifold); }
+	else if (firstOrder == 1 && secondOrder == 1) { isHit = CollideBoxes        (first, second, manifold); }
+	else if (firstOrder == 1 && secondOrder == 2) { isHit = CollideBoxCapsule   (first, second, manifold); }
+	else                                          { isHit = CollideCapsules     (first, second, manifold); }
+
+	if (isHit && isSwapped) { manifold.Normal = Negate(manifold.Normal); }
+	return isHit;
+}
+
+/*!**********************************************************************
+*  @brief     Ƌ𔻒肵܂.
+*************************************************************************/
+bool ContactGenerator::CollideSpheres(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold)
+{
+	gm::Float3 normal = {}, position = {};
+	float penetration = 0.0f;
+	if (!SphereSphereContact(a.Position, a.Radius, b.Position, b.Radius, normal, penetration, position)) { return false; }
+
+	BeginManifold(manifold, normal);
+	AddPoint(manifold, position, penetration, 0);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     ƃ{bNX𔻒肵܂.
+*************************************************************************/
+bool ContactGenerator::CollideSphereBox(const CollisionShape& sphere, const CollisionShape& box, ContactManifold& manifold)
+{
+	gm::Float3 normal = {}, position = {};
+	float  penetration = 0.0f;
+	uint32 featureID   = 0;
+	if (!BoxSphereContact(box, sphere.Position, sphere.Radius, normal, penetration, position, featureID)) { return false; }
+
+	// @̓{bNX狅֌Ă邽, {bNX֔]܂
+	BeginManifold(manifold, Negate(normal));
+	AddPoint(manifold, position, penetration, featureID);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     ƃJvZ𔻒肵܂. JvZ̎ŋ̒Sɍł߂_ƂĈ܂.
+*************************************************************************/
+bool ContactGenerator::CollideSphereCapsule(const CollisionShape& sphere, const CollisionShape& capsule, ContactManifold& manifold)
+{
+	gm::Float3 start = {}, end = {};
+	GetCapsuleSegment(capsule, start, end);
+
+	const float      t       = ClosestParameterOnSegment(sphere.Position, start, end);
+	const gm::Float3 closest = MultiplyAdd(start, Subtract(end, start), t);
+
+	gm::Float3 normal = {}, position = {};
+	float penetration = 0.0f;
+	if (!SphereSphereContact(sphere.Position, sphere.Radius, closest, capsule.Radius, normal, penetration, position)) { return false; }
+
+	BeginManifold(manifold, normal);
+	AddPoint(manifold, position, penetration, 0);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     {bNXƃ{bNX𕪗Ŕ肵܂.
+*************************************************************************/
+bool ContactGenerator::CollideBoxes(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold)
+{
+	BoxSeparatingAxis axis = {};
+	if (!FindBoxSeparatingAxis(a, b, axis)) { return false; }
+
+	return CollideBoxesOnAxis(a, b, axis, manifold);
+}
+
+/*!**********************************************************************
+*  @brief     {bNXm̕(3+3, ӂ̑gݍ킹9)s, ł󂢎߂܂.
+*************************************************************************/
+bool ContactGenerator::FindBoxSeparatingAxis(const CollisionShape& a, const CollisionShape& b, BoxSeparatingAxis& axis)
+{
+	const BoxFrame frameA = MakeBoxFrame(a);
+	const BoxFrame frameB = MakeBoxFrame(b);
+	const gm::Float3 d = Subtract(frameB.Center, frameA.Center);
+
+	/*-------------------------------------------------------------------
+	-      m̓. ӂ̑gݍ킹̊Oς0ɋ߂ꍇɔĔȒl܂
+	---------------------------------------------------------------------*/
+	float C[3][3], absC[3][3];
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		for (uint32 j = 0; j < 3; ++j)
+		{
+			C   [i][j] = Dot(frameA.Axes[i], frameB.Axes[j]);
+			absC[i][j] = std::fabs(C[i][j]) + 1e-6f;
+		}
+	}
+
+	float dA[3], dB[3];
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		dA[i] = Dot(d, frameA.Axes[i]);
+		dB[i] = Dot(d, frameB.Axes[i]);
+	}
+
+	/*-------------------------------------------------------------------
+	-      A̖
+	---------------------------------------------------------------------*/
+	BoxAxisType bestType      = BoxAxisType::FaceA;
+	uint32     bestIndex      = 0;
+	float      bestSeparation = -FLT_MAX;
+	gm::Float3 bestNormal     = {};
+
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		const float radiusB    = frameB.Half[0] * absC[i][0] + frameB.Half[1] * absC[i][1] + frameB.Half[2] * absC[i][2];
+		const float separation = std::fabs(dA[i]) - (frameA.Half[i] + radiusB);
+		if (separation > SPECULATIVE_DISTANCE) { return false; }
+		if (separation > bestSeparation)
+		{
+			bestSeparation = separation;
+			bestType       = BoxAxisType::FaceA;
+			bestIndex      = i;
+			bestNormal     = dA[i] >= 0.0f ? frameA.Axes[i] : Negate(frameA.Axes[i]);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-      B̖ (A̖ʂƓx̏ꍇAʂɂ, ʂւ葱̂h܂)
+	---------------------------------------------------------------------*/
+	const float faceSeparationA = bestSeparation;
+	for (uint32 j = 0; j < 3; ++j)
+	{
+		const float radiusA    = frameA.Half[0] * absC[0][j] + frameA.Half[1] * absC[1][j] + frameA.Half[2] * absC[2][j];
+		const float separation = std::fabs(dB[j]) - (radiusA + frameB.Half[j]);
+		if (separation > SPECULATIVE_DISTANCE) { return false; }
+		if (separation > AXIS_RELATIVE_TOLERANCE * faceSeparationA + AXIS_ABSOLUTE_TOLERANCE && separation > bestSeparation)
+		{
+			bestSeparation = separation;
+			bestType       = BoxAxisType::FaceB;
+			bestIndex      = j;
+			bestNormal     = dB[j] >= 0.0f ? frameB.Axes[j] : Negate(frameB.Axes[j]);
+		}
+	}
+
+	/*-------------------------------------------------------------------
+	-      ӂ̑gݍ킹
+	---------------------------------------------------------------------*/
+	const float faceSeparation = bestSeparation;
+	for (uint32 i = 0; i < 3; ++i)
+	{
+		const uint32 i1 = (i + 1) % 3;
+		const uint32 i2 = (i + 2) % 3;
+		for (uint32 j = 0; j < 3; ++j)
+		{
+			const gm::Float3 axis   = Cross(frameA.Axes[i], frameB.Axes[j]);
+			const float      length = Length(axis);
+			if (length < 1e-5f) { continue; }
+
+			const uint32 j1 = (j + 1) % 3;
+			const uint32 j2 = (j + 2) % 3;
+			const float radiusA  = frameA.Half[i1] * absC[i2][j] + frameA.Half[i2] * absC[i1][j];
+			const float radiusB  = frameB.Half[j1] * absC[i][j2] + frameB.Half[j2] * absC[i][j1];
+			const float distance = Dot(d, axis);
+
+			const float separation = (std::fabs(distance) - (radiusA + radiusB)) / length;
+			if (separation > SPECULATIVE_DISTANCE) { return false; }
+			if (separation > AXIS_RELATIVE_TOLERANCE * faceSeparation + AXIS_ABSOLUTE_TOLERANCE && separation > bestSeparation)
+			{
+				bestSeparation = separation;
+				bestType       = BoxAxisType::Edge;
+				bestIndex      = i * 3 + j;
+				bestNormal     = Scale(axis, (distance >= 0.0f ? 1.0f : -1.0f) / length);
+			}
+		}
+	}
+
+	axis.Type       = bestType;
+	axis.Index      = bestIndex;
+	axis.Separation = bestSeparation;
+	axis.Normal     = bestNormal;
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     ł󂢎{bNXm̐ڐG_𐶐܂. @n
+*             ʂ̏ꍇ͊ʂ̑ʂő̖ʂNbv, ӂ̏ꍇ2̕ӂ̍ŋߓ_1_o͂܂.
+*************************************************************************/
+bool ContactGenerator::CollideBoxesOnAxis(const CollisionShape& a, const CollisionShape& b, const BoxSeparatingAxis& axis, ContactManifold& manifold)
+{
+	const BoxFrame    frameA     = MakeBoxFrame(a);
+	const BoxFrame    frameB     = MakeBoxFrame(b);
+	const gm::Float3& bestNormal = axis.Normal;
+
+	/*-------------------------------------------------------------------
+	-      ʂ̐ڐG
+	---------------------------------------------------------------------*/
+	if (axis.Type == BoxAxisType::FaceA)
+	{
+		CollideFaces(frameA, axis.Index, bestNormal, frameB, bestNormal, axis.Index << 1, manifold);
+		return manifold.PointCount > 0;
+	}
+	if (axis.Type == BoxAxisType::FaceB)
+	{
+		// B̖ʂ̊O̖@A, }jtH[h̖@(AB)Ƃ͋tɂȂ܂
+		CollideFaces(frameB, axis.Index, Negate(bestNormal), frameA, bestNormal, 0x1 | axis.Index << 1, manifold);
+		return manifold.PointCount > 0;
+	}
+
+	/*-------------------------------------------------------------------
+	-      ӂ̐ڐG : @ōłɋ߂ӂI, 2̕ӂ̍ŋߓ_̒_ڐG_ɂ܂
+	---------------------------------------------------------------------*/
+	const uint32 edgeA = axis.Index / 3;
+	const uint32 edgeB = axis.Index % 3;
+
+	gm::Float3 centerA = frameA.Center;
+	gm::Float3 centerB = frameB.Center;
+	for (uint32 k = 0; k < 3; ++k)
+	{
+		if (k != edgeA)
+		{
+			const float sign = Dot(frameA.Axes[k], bestNormal) >= 0.0f ? 1.0f : -1.0f;
+			centerA = MultiplyAdd(centerA, frameA.Axes[k], sign * frameA.Half[k]);
+		}
+		if (k != edgeB)
+		{
+			const float sign = Dot(frameB.Axes[k], bestNormal) >= 0.0f ? -1.0f : 1.0f;
+			centerB = MultiplyAdd(centerB, frameB.Axes[k], sign * frameB.Half[k]);
+		}
+	}
+
+	gm::Float3 closestA = {}, closestB = {};
+	ClosestPointsSegmentSegment(
+		MultiplyAdd(centerA, frameA.Axes[edgeA], -frameA.Half[edgeA]), MultiplyAdd(centerA, frameA.Axes[edgeA], frameA.Half[edgeA]),
+		MultiplyAdd(centerB, frameB.Axes[edgeB], -frameB.Half[edgeB]), MultiplyAdd(centerB, frameB.Axes[edgeB], frameB.Half[edgeB]),
+		closestA, closestB);
+
+	BeginManifold(manifold, bestNormal);
+	AddPoint(manifold, Scale(Add(closestA, closestB), 0.5f), -axis.Separation, 0x80000000u | (edgeA << 2) | edgeB);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     {bNXƃJvZ𔻒肵܂. JvZ̗[ƒSɋ߂_ƂĔ肵Ă܂Ƃ߂܂.
+*************************************************************************/
+bool ContactGenerator::CollideBoxCapsule(const CollisionShape& box, const CollisionShape& capsule, ContactManifold& manifold)
+{
+	gm::Float3 start = {}, end = {};
+	GetCapsuleSegment(capsule, start, end);
+
+	const float t = ClosestParameterOnSegment(box.Position, start, end);
+	const gm::Float3 samples[3] = { start, end, MultiplyAdd(start, Subtract(end, start), t) };
+	const uint32     sampleCount = (t > 1e-3f && t < 1.0f - 1e-3f) ? 3 : 2;
+
+	gm::Float3 normals     [3] = {};
+	gm::Float3 positions   [3] = {};
+	float      penetrations[3] = {};
+	bool       isHits      [3] = {};
+	int32      deepest = -1;
+	for (uint32 i = 0; i < sampleCount; ++i)
+	{
+		uint32 featureID = 0;
+		isHits[i] = BoxSphereContact(box, samples[i], capsule.Radius, normals[i], penetrations[i], positions[i], featureID);
+		if (isHits[i] && (deepest < 0 || penetrations[i] > penetrations[deepest])) { deepest = static_cast<int32>(i); }
+	}
+	if (deepest < 0) { return false; }
+
+	/*-------------------------------------------------------------------
+	-      ł[_̖@Lł_c, ̖@̂߂荞ݗʂɑ܂
+	---------------------------------------------------------------------*/
+	const gm::Float3 normal = normals[deepest];
+	BeginManifold(manifold, normal);
+	for (uint32 i = 0; i < sampleCount; ++i)
+	{
+		if (!isHits[i] || Dot(normals[i], normal) < 0.95f) { continue; }
+		AddPoint(manifold, positions[i], penetrations[i], i);
+	}
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     JvZƃJvZ̐m̍ŋߓ_Ŕ肵܂.
+*************************************************************************/
+bool ContactGenerator::CollideCapsules(const CollisionShape& a, const CollisionShape& b, ContactManifold& manifold)
+{
+	gm::Float3 startA = {}, endA = {}, startB = {}, endB = {};
+	GetCapsuleSegment(a, startA, endA);
+	GetCapsuleSegment(b, startB, endB);
+
+	gm::Float3 closestA = {}, closestB = {};
+	ClosestPointsSegmentSegment(startA, endA, startB, endB, closestA, closestB);
+
+	gm::Float3 normal = {}, position = {};
+	float penetration = 0.0f;
+	if (!SphereSphereContact(closestA, a.Radius, closestB, b.Radius, normal, penetration, position)) { return false; }
+
+	BeginManifold(manifold, normal);
+
+	/*-------------------------------------------------------------------
+	-      قڕsȏꍇ, B̎A̎ɎˉedȂ̗[ڐG_ɂ܂ (]炸ɉ悤)
+	---------------------------------------------------------------------*/
+	const gm::Float3 axisA = Normalize(Subtract(endA, startA));
+	const gm::Float3 axisB = Normalize(Subtract(endB, startB));
+	if (a.HalfHeight > 0.0f && b.HalfHeight > 0.0f && std::fabs(Dot(axisA, axisB)) > 0.99f)
+	{
+		const float t0 = Dot(Subtract(startB, a.Position), axisA);
+		const float t1 = Dot(Subtract(endB  , a.Position), axisA);
+		const float lower = std::fmax(-a.HalfHeight, std::fmin(t0, t1));
+		const float upper = std::fmin( a.HalfHeight, std::fmax(t0, t1));
+		if (upper - lower > 1e-3f)
+		{
+			const float parameters[2] = { lower, upper };
+			for (uint32 i = 0; i < 2; ++i)
+			{
+				const gm::Float3 pointA = MultiplyAdd(a.Position, axisA, parameters[i]);
+				const gm::Float3 pointB = MultiplyAdd(startB, Subtract(endB, startB), ClosestParameterOnSegment(pointA, startB, endB));
+				const float pointPenetration = a.Radius + b.Radius - Dot(Subtract(pointB, pointA), normal);
+				if (pointPenetration < -SPECULATIVE_DISTANCE) { continue; }
+
+				const gm::Float3 surfaceA = MultiplyAdd(pointA, normal,  a.Radius);
+				const gm::Float3 surfaceB = MultiplyAdd(pointB, normal, -b.Radius);
+				AddPoint(manifold, Scale(Add(surfaceA, surfaceB), 0.5f), pointPenetration, i + 1);
+			}
+			if (manifold.PointCount > 0) { return true; }
+		}
+	}
+
+	AddPoint(manifold, position, penetration, 0);
+	return true;
+}
+#pragma endregion Public Function
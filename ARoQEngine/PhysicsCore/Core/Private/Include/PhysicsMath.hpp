@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   PhysicsMath.hpp
+///  @brief  Z̓Ŏgp, Float3Float4(NH[^jI)𒼐ڈȉZQł. @n
+///          ڐG̐\o[͗vfPʂ̃XJ[ZŜ, SIMDWX^ւ̓ǂݍ݂܂ɌvZ܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_MATH_HPP
+#define PHYSICS_MATH_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Math/Include/GMVector.hpp"
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::details::math
+{
+	#pragma region Float3
+	__forceinline gm::Float3 Add     (const gm::Float3& a, const gm::Float3& b) { return gm::Float3(a.x + b.x, a.y + b.y, a.z + b.z); }
+	__forceinline gm::Float3 Subtract(const gm::Float3& a, const gm::Float3& b) { return gm::Float3(a.x - b.x, a.y - b.y, a.z - b.z); }
+	__forceinline gm::Float3 Scale   (const gm::Float3& a, const float s)       { return gm::Float3(a.x * s, a.y * s, a.z * s); }
+	__forceinline gm::Float3 Negate  (const gm::Float3& a)                      { return gm::Float3(-a.x, -a.y, -a.z); }
+
+	/*! @brief a + b * s*/
+	__forceinline gm::Float3 MultiplyAdd(const gm::Float3& a, const gm::Float3& b, const float s) { return gm::Float3(a.x + b.x * s, a.y + b.y * s, a.z + b.z * s); }
+
+	__forceinline float Dot(const gm::Float3& a, const gm::Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+	__forceinline gm::Float3 Cross(const gm::Float3& a, const gm::Float3& b)
+	{
+		return gm::Float3(a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x);
+	}
+
+	__forceinline float LengthSquared(const gm::Float3& a) { return Dot(a, a); }
+	__forceinline float Length       (const gm::Float3& a) { return std::sqrt(Dot(a, a)); }
+
+	/*! @brief 0ɋ߂ꍇfallbackԂ܂*/
+	__forceinline gm::Float3 Normalize(const gm::Float3& a, const gm::Float3& fallback = gm::Float3(0.0f, 1.0f, 0.0f))
+	{
+		const float length = Length(a);
+		return length > 1e-12f ? Scale(a, 1.0f / length) : fallback;
+	}
+
+	/*! @brief Kꂽnɒ2̒PʃxNg߂܂*/
+	__forceinline void ComputeBasis(const gm::Float3& n, gm::Float3& tangent1, gm::Float3& tangent2)
+	{
+		// 0.57735 = 1 / sqrt(3). ł̎Ƃ̊Oς, lIɈ肵ڐ܂
+		tangent1 = std::fabs(n.x) >= 0.57735f ? Normalize(gm::Float3(n.y, -n.x, 0.0f)) : Normalize(gm::Float3(0.0f, n.z, -n.y));
+		tangent2 = Cross(n, tangent1);
+	}
+	#pragma endregion Float3
+
+	#pragma region Quaternion
+	/*! @brief NH[^jI(x, y, z, w)ŃxNg]܂*/
+	__forceinline gm::Float3 Rotate(const gm::Float4& q, const gm::Float3& v)
+	{
+		// v' = v + 2w(q x v) + 2q x (q x v)
+		const gm::Float3 u(q.x, q.y, q.z);
+		const gm::Float3 t = Scale(Cross(u, v), 2.0f);
+		return Add(Add(v, Scale(t, q.w)), Cross(u, t));
+	}
+
+	/*! @brief NH[^jI̋t] (PʃNH[^jIOƂ܂)*/
+	__forceinline gm::Float3 InverseRotate(const gm::Float4& q, const gm::Float3& v)
+	{
+		return Rotate(gm::Float4(-q.x, -q.y, -q.z, q.w), v);
+	}
+
+	/*! @brief [JX, Y, Z[hԂɉ] (]s̗)*/
+	__forceinline void ToAxes(const gm::Float4& q, gm::Float3* axes)
+	{
+		const float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+		const float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+		const float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+		axes[0] = gm::Float3(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz)       , 2.0f * (xz - wy));
+		axes[1] = gm::Float3(2.0f * (xy - wz)       , 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx));
+		axes[2] = gm::Float3(2.0f * (xz + wy)       , 2.0f * (yz - wx)       , 1.0f - 2.0f * (xx + yy));
+	}
+	#pragma endregion Quaternion
+
+	#pragma region SymmetricMatrix3
+	/****************************************************************************
+	*				  			   SymmetricMatrix3
+	****************************************************************************/
+	/* @brief  [hԂ̋te\Ȃǂ̑Ώ3x3sł. Op6vfێ܂.
+	*****************************************************************************/
+	struct SymmetricMatrix3
+	{
+		float XX = 0.0f, YY = 0.0f, ZZ = 0.0f;
+		float XY = 0.0f, XZ = 0.0f, YZ = 0.0f;
+
+		__forceinline gm::Float3 Multiply(const gm::Float3& v) const
+		{
+			return gm::Float3(XX * v.x + XY * v.y + XZ * v.z,
+				              XY * v.x + YY * v.y + YZ * v.z,
+				              XZ * v.x + YZ * v.y + ZZ * v.z);
+		}
+	};
+	#pragma endregion SymmetricMatrix3
+}
+
+#endif
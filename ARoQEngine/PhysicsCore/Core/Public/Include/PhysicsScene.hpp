@@ -1,79 +1,380 @@
-////////////////////////////////////////////////////////////////////////////////////
-/////             @file   IGeometry.hpp
-/////             @brief  Geometry interface. 
-/////             @author Toide Yutaro
-/////             @date   2023_01_09
-////////////////////////////////////////////////////////////////////////////////////
-//#pragma once
-//#ifndef PHYSICS_SCENE_HPP
-//#define PHYSICS_SCENE_HPP
-//
-////////////////////////////////////////////////////////////////////////////////////
-////                             Include
-////////////////////////////////////////////////////////////////////////////////////
-//#include "GameUtility/Math/Include/GMVector.hpp"
-////////////////////////////////////////////////////////////////////////////////////
-////                              Define
-////////////////////////////////////////////////////////////////////////////////////
-//
-////////////////////////////////////////////////////////////////////////////////////
-////                               Class
-////////////////////////////////////////////////////////////////////////////////////
-//namespace physics::core
-//{
-//	class PhysicsSceneDesc
-//	{
-//	public:
-//		/****************************************************************************
-//		**                Public Function
-//		*****************************************************************************/
-//		
-//		/****************************************************************************
-//		**                Public Property
-//		*****************************************************************************/
-//		gm::Vector3 Gravity = {};
-//
-//		/****************************************************************************
-//		**                Constructor and Destructor
-//		*****************************************************************************/
-//
-//	};
-//
-//	/****************************************************************************
-//	*				  			  IGeometry
-//	****************************************************************************/
-//	/* @class     IGeometry
-//	*  @brief     Geometry interface
-//	*****************************************************************************/
-//	class PhysicsScene
-//	{
-//	public:
-//		/****************************************************************************
-//		**                Public Function
-//		*****************************************************************************/
-//		virtual void AddActor(){};
-//
-//		/****************************************************************************
-//		**                Public Property
-//		*****************************************************************************/
-//
-//		/****************************************************************************
-//		**                Constructor and Destructor
-//		*****************************************************************************/
-//		PhysicsScene(const PhysicsSceneDesc& sceneDesc);
-//
-//	protected:
-//		/****************************************************************************
-//		**                Constructor and Destructor
-//		*****************************************************************************/
-//
-//		/****************************************************************************
-//		**                Protected Function
-//		*****************************************************************************/
-//
-//		/****************************************************************************
-//		**                Protected Property
-//		*****************************************************************************/
-//	};
-//}
-//#endif
\ No newline at end of file
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   PhysicsScene.hpp
+///  @brief  ̂SoA`ł܂Ƃ߂ĕێ, V[Ŝ̎Ԃi߂܂. @n
+///          1Xebv u[htF[Y -> ڐG_̐(`̑gݍ킹ƂSIMD) -> x̐ϕ(SIMD) -> ̍쐬 -> Ƃ̍S̉() -> ʒu̐ϕ(SIMD) ̏ɍs܂. @n
+///          SĂ̍̂Ă铇͓Ɋ܂܂ꂸ, ڐG_̐ƍS̉ȗ܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_SCENE_HPP
+#define PHYSICS_SCENE_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "PhysicsCore/Collision/Broadphase/Include/Broadphase.hpp"
+#include "PhysicsCore/Collision/Narrowphase/Include/BatchedNarrowphase.hpp"
+#include "PhysicsCore/Dynamics/Include/ContactSolver.hpp"
+#include "PhysicsCore/Dynamics/Include/IslandBuilder.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+namespace physics::core::details::scene
+{
+	/*! @brief 1^XN̍ŏ̑g̐ (ڐG_̐). 菭Ȃꍇ͕܂*/
+	constexpr gu::uint32 MIN_PAIRS_PER_TASK = 128;
+
+	/*! @brief 1^XN̍ŏ̎d (̍̐ + }jtH[h)*/
+	constexpr gu::uint32 MIN_SOLVER_WORK_PER_TASK = 256;
+
+	/*! @brief Xbh̃^XN. ̑傫̕΂z邽, Xbh葽܂*/
+	constexpr gu::uint32 TASKS_PER_THREAD = 4;
+
+	/*! @brief IDvȂꍇ, ÕXebv̐ڐG_𓯂_Ƃ݂Ȃ [m]. @n
+	*          ʓmقڕsȔł̓NbsO镽ʂXebvւ, ID肵Ȃ߂ł.*/
+	constexpr float WARM_START_DISTANCE = 0.02f;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::core
+{
+	/****************************************************************************
+	*				  			   PhysicsSceneDesc
+	****************************************************************************/
+	/* @brief  V[̐ݒł.
+	*****************************************************************************/
+	struct PhysicsSceneDesc
+	{
+		/*! @brief d͉x [m/s^2]*/
+		gm::Float3 Gravity = gm::Float3(0.0f, -9.8f, 0.0f);
+
+		/*! @brief x̔*/
+		gu::uint32 VelocityIterations = 8;
+
+		/*! @brief ߂荞݂1XebvŖ߂ (Baumgarte艻)*/
+		float BaumgarteFactor = 0.2f;
+
+		/*! @brief ߂ɋe߂荞ݗ [m]*/
+		float LinearSlop = 0.005f;
+
+		/*! @brief ̑x [m/s] Ɗpx [rad/s] ԂTimeToSleepb͖܂*/
+		float SleepLinearVelocity  = 0.05f;
+		float SleepAngularVelocity = 0.05f;
+		float TimeToSleep          = 0.5f;
+	};
+
+	/****************************************************************************
+	*				  			   RigidBodyDesc
+	****************************************************************************/
+	/* @brief  ̂̍쐬̐ݒł. Mass0̏ꍇ͓ȂÓIȍ̂ɂȂ܂.
+	*****************************************************************************/
+	struct RigidBodyDesc
+	{
+		/*! @brief ` (Sphere, AABB, OBB, CapsuleɑΉ܂)*/
+		geometry::GeometryType ShapeType = geometry::GeometryType::Sphere;
+
+		/*! @brief {bNX̊e̔̒*/
+		gm::Float3 HalfExtents = gm::Float3(0.5f, 0.5f, 0.5f);
+
+		/*! @brief , JvZ̔a*/
+		float Radius = 0.5f;
+
+		/*! @brief JvZ2̔̒SԂ̋̔ ([JY)*/
+		float HalfHeight = 0.5f;
+
+		gm::Float3 Position        = {};
+		gm::Float4 Orientation     = gm::Float4(0.0f, 0.0f, 0.0f, 1.0f);
+		gm::Float3 LinearVelocity  = {};
+		gm::Float3 AngularVelocity = {};
+
+		/*! @brief  [kg]. 0̏ꍇ͐ÓIȍ*/
+		float Mass = 1.0f;
+
+		/*! @brief CW. 2̍̂̒l̑敽ςgp܂*/
+		float Friction = 0.6f;
+
+		/*! @brief x̌ [1/s]*/
+		float LinearDamping  = 0.0f;
+		float AngularDamping = 0.05f;
+	};
+
+	/****************************************************************************
+	*				  			   RigidBodyArray
+	****************************************************************************/
+	/* @brief  ̂SoA`ŕێzł. ϕSIMDŕ̍̂܂Ƃ߂ēǂݍނ, evfʁX̔zƂĎ܂.
+	*****************************************************************************/
+	struct RigidBodyArray
+	{
+	public:
+		#pragma region Public Property
+		/*-------------------------------------------------------------------
+		-      ϕœǂݏl
+		---------------------------------------------------------------------*/
+		gu::DynamicArray<float> PositionX        = {};
+		gu::DynamicArray<float> PositionY        = {};
+		gu::DynamicArray<float> PositionZ        = {};
+		gu::DynamicArray<float> OrientationX     = {};
+		gu::DynamicArray<float> OrientationY     = {};
+		gu::DynamicArray<float> OrientationZ     = {};
+		gu::DynamicArray<float> OrientationW     = {};
+		gu::DynamicArray<float> LinearVelocityX  = {};
+		gu::DynamicArray<float> LinearVelocityY  = {};
+		gu::DynamicArray<float> LinearVelocityZ  = {};
+		gu::DynamicArray<float> AngularVelocityX = {};
+		gu::DynamicArray<float> AngularVelocityY = {};
+		gu::DynamicArray<float> AngularVelocityZ = {};
+		gu::DynamicArray<float> ForceX           = {};
+		gu::DynamicArray<float> ForceY           = {};
+		gu::DynamicArray<float> ForceZ           = {};
+		gu::DynamicArray<float> TorqueX          = {};
+		gu::DynamicArray<float> TorqueY          = {};
+		gu::DynamicArray<float> TorqueZ          = {};
+
+		/*! @brief t (ÓIȍ̂0)*/
+		gu::DynamicArray<float> InverseMass = {};
+
+		/*! @brief [JԂ̊厲̋t[g*/
+		gu::DynamicArray<float> LocalInverseInertiaX = {};
+		gu::DynamicArray<float> LocalInverseInertiaY = {};
+		gu::DynamicArray<float> LocalInverseInertiaZ = {};
+
+		/*! @brief [hԂ̋te\ (Ώ̍s6). x̐ϕŉ]vZ, \o[Ŏgp܂*/
+		gu::DynamicArray<float> InverseInertiaXX = {};
+		gu::DynamicArray<float> InverseInertiaYY = {};
+		gu::DynamicArray<float> InverseInertiaZZ = {};
+		gu::DynamicArray<float> InverseInertiaXY = {};
+		gu::DynamicArray<float> InverseInertiaXZ = {};
+		gu::DynamicArray<float> InverseInertiaYZ = {};
+
+		/*! @brief x̌*/
+		gu::DynamicArray<float> LinearDamping  = {};
+		gu::DynamicArray<float> AngularDamping = {};
+
+		/*! @brief d͂ƊO͂ϕ邩 (NĂ铮Iȍ̂1, ȊO0). 򂹂SIMDŐϕ邽߂Ɏgp܂*/
+		gu::DynamicArray<float> MotionMask = {};
+
+		/*-------------------------------------------------------------------
+		-      ϕȊOŎgpl
+		---------------------------------------------------------------------*/
+		gu::DynamicArray<float> Friction  = {};
+
+		/*! @brief Î~Ă鎞 [s]*/
+		gu::DynamicArray<float> SleepTime = {};
+
+		gu::DynamicArray<bool>  IsAwake   = {};
+
+		/*! @brief `*/
+		gu::DynamicArray<geometry::GeometryType> ShapeType   = {};
+		gu::DynamicArray<gm::Float3>             HalfExtents = {};
+		gu::DynamicArray<float>                  Radius      = {};
+		gu::DynamicArray<float>                  HalfHeight  = {};
+
+		/*! @brief u[htF[ỸvLV*/
+		gu::DynamicArray<gu::int32> ProxyID = {};
+		#pragma endregion
+
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ɍ̂ǉ܂. ʂƌ`󂩂t[gvZ܂.
+		*  @param[in] const RigidBodyDesc& ݒ
+		*  @return    gu::uint32 ǉ̂̃CfbNX
+		*************************************************************************/
+		gu::uint32 Push(const RigidBodyDesc& desc);
+
+		/*!**********************************************************************
+		*  @brief     ̈OɊmۂ܂.
+		*************************************************************************/
+		void Reserve(const gu::uint64 capacity);
+
+		/*!**********************************************************************
+		*  @brief     vfSč폜܂. (Capacity͂̂܂܂ł)
+		*************************************************************************/
+		void Clear();
+
+		/*!**********************************************************************
+		*  @brief     i[ĂvfԂ܂
+		*************************************************************************/
+		__forceinline gu::uint64 Size() const { return InverseMass.Size(); }
+		#pragma endregion
+	};
+
+	/****************************************************************************
+	*				  			   PhysicsScene
+	****************************************************************************/
+	/* @brief  ̂̃V[ł. ̂AddBodyŒǉ, ԂꂽCfbNXő삵܂. (폜ɂ͑ΉĂ܂) @n
+	*          ThreadPoolnStep͐ڐG_̐Ɠ̍S̉ɍs܂. @n
+	*          ͏ɓԂ, 菇ŉ邽, ʂ̓XbhɈˑ܂.
+	*****************************************************************************/
+	class PhysicsScene : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     ̂ǉ܂.
+		*  @param[in] const RigidBodyDesc& ݒ
+		*  @return    gu::uint32 ̂̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddBody(const RigidBodyDesc& desc);
+
+		/*!**********************************************************************
+		*  @brief     ̃Xebvŉ [N] ƃgN [N m] ǉ܂. Ă鍄̂͋N܂.
+		*  @param[in] const gu::uint32 ̂̃CfbNX
+		*  @param[in] const gm::Float3& ͂܂̓gN
+		*  @return    void
+		*************************************************************************/
+		void AddForce (const gu::uint32 index, const gm::Float3& force);
+		void AddTorque(const gu::uint32 index, const gm::Float3& torque);
+
+		/*!**********************************************************************
+		*  @brief     xݒ肵܂. ÓIȍ̂ɂ͐ݒł܂. Ă鍄̂͋N܂.
+		*  @param[in] const gu::uint32 ̂̃CfbNX
+		*  @param[in] const gm::Float3& x [m/s] ܂͊px [rad/s]
+		*  @return    void
+		*************************************************************************/
+		void SetLinearVelocity (const gu::uint32 index, const gm::Float3& velocity);
+		void SetAngularVelocity(const gu::uint32 index, const gm::Float3& velocity);
+
+		/*!**********************************************************************
+		*  @brief     Ă鍄̂N܂. ڐGĂ鍄͎̂̃XebvœɓƋN܂.
+		*  @param[in] const gu::uint32 ̂̃CfbNX
+		*  @return    void
+		*************************************************************************/
+		void WakeUp(const gu::uint32 index);
+
+		/*!**********************************************************************
+		*  @brief     V[̎Ԃi߂܂.
+		*  @param[in] const float ԍ [s]
+		*  @return    void
+		*************************************************************************/
+		void Step(const float deltaTime);
+
+		/*!**********************************************************************
+		*  @brief     V[̎Ԃi߂܂. ڐG_̐Ɠ̍S̉ɍs܂.
+		*  @param[in] const float ԍ [s]
+		*  @param[in] gu::ThreadPool& Xbhv[
+		*  @return    void
+		*************************************************************************/
+		void Step(const float deltaTime, gu::ThreadPool& threadPool);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ̂̐*/
+		__forceinline gu::uint32 GetBodyCount() const { return static_cast<gu::uint32>(_bodies.Size()); }
+
+		/*! @brief ̂̔z*/
+		__forceinline const RigidBodyArray& GetBodies() const { return _bodies; }
+
+		/*! @brief ʒuƉ]*/
+		gm::Float3 GetPosition   (const gu::uint32 index) const;
+		gm::Float4 GetOrientation(const gu::uint32 index) const;
+
+		/*! @brief xƊpx*/
+		gm::Float3 GetLinearVelocity (const gu::uint32 index) const;
+		gm::Float3 GetAngularVelocity(const gu::uint32 index) const;
+
+		/*! @brief NĂ邩*/
+		__forceinline bool IsAwake(const gu::uint32 index) const { return _bodies.IsAwake[index]; }
+
+		/*! @brief ÕXebvŉ̐ (Ă铇͊܂݂܂)*/
+		__forceinline gu::uint32 GetIslandCount() const { return _islandBuilder.GetIslandCount(); }
+
+		/*! @brief ÕXebṽ}jtH[h̐*/
+		__forceinline gu::uint32 GetContactCount() const { return static_cast<gu::uint32>(_manifolds.Size()); }
+
+		/*! @brief ÕXebṽ}jtH[h*/
+		__forceinline const collision::ContactManifold* GetContacts() const { return _manifolds.Data(); }
+
+		/*! @brief ݒ*/
+		__forceinline const PhysicsSceneDesc& GetDesc() const { return _desc; }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		PhysicsScene() = default;
+
+		explicit PhysicsScene(const PhysicsSceneDesc& desc) : _desc(desc) {}
+
+		~PhysicsScene() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief Xebv̖{. threadPoolnullptȑꍇ͑SČĂяõXbhōs܂*/
+		void Step(const float deltaTime, gu::ThreadPool* threadPool);
+
+		/*! @brief NĂ鍄̂̃vLVړ, L{bNXdȂĂ鍄̂̑gXV܂*/
+		void UpdatePairs(const float deltaTime);
+
+		/*! @brief g͈̔͂̐ڐG_܂Ƃ߂Đ, ÕXebṽ}jtH[h͐ςp܂*/
+		void CollidePairs(const gu::uint64 begin, const gu::uint64 end, collision::BatchedNarrowphase& narrowphase) const;
+
+		/*! @brief SĂ̑g̐ڐG_𐶐܂*/
+		void UpdateContacts(gu::ThreadPool* threadPool);
+
+		/*! @brief ͈̔͂̍S, Ƃɖ邩ǂ߂܂*/
+		void SolveIslands(const gu::uint32 begin, const gu::uint32 end, dynamics::ContactSolver& solver, const float deltaTime);
+
+		/*! @brief SĂ̓܂*/
+		void SolveAllIslands(const float deltaTime, gu::ThreadPool* threadPool);
+
+		/*! @brief ̂̃[hԂ̋E{bNXvZ܂*/
+		geometry::AABB ComputeBounds(const gu::uint32 index) const;
+
+		/*! @brief ̂̌`[hԂ̐ڐGp̌`ɂ܂*/
+		collision::CollisionShape GetShape(const gu::uint32 index) const;
+
+		/*! @brief NĂ邩ύX, MotionMaskXV܂*/
+		void SetAwake(const gu::uint32 index, const bool isAwake);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ݒ*/
+		PhysicsSceneDesc _desc = {};
+
+		/*! @brief */
+		RigidBodyArray _bodies = {};
+
+		/*! @brief u[htF[Y*/
+		collision::Broadphase _broadphase = {};
+
+		/*! @brief u[htF[Y̏o͂, ÕXebvێĂ鍄̂̑g ((CfbNX << 32) | 傫CfbNX, )*/
+		gu::DynamicArray<collision::BroadphasePair> _broadphasePairs = {};
+		gu::DynamicArray<gu::uint64> _pairKeys    = {};
+		gu::DynamicArray<gu::uint64> _newPairKeys = {};
+		gu::DynamicArray<gu::uint64> _mergedKeys  = {};
+		gu::DynamicArray<gu::uint64> _sortBuffer  = {};
+
+		/*! @brief ݂ƑÕXebṽ}jtH[h (g̏)*/
+		gu::DynamicArray<collision::ContactManifold> _manifolds    = {};
+		gu::DynamicArray<collision::ContactManifold> _oldManifolds = {};
+
+		/*! @brief i[tF[Y̓͂ƂȂ鍄̂Ƃ̃[hԂ̌` (UpdateContacts̊ԂLł)*/
+		gu::DynamicArray<collision::CollisionShape> _shapes = {};
+
+		/*! @brief ^XNƂ̃i[tF[Y (}jtH[h̏o͐˂܂)*/
+		gu::DynamicArray<collision::BatchedNarrowphase> _narrowphases = {};
+
+		/*! @brief ̍쐬*/
+		dynamics::IslandBuilder _islandBuilder = {};
+
+		/*! @brief ^XNƂ̃\o[*/
+		gu::DynamicArray<dynamics::ContactSolver> _solvers = {};
+
+		/*! @brief ̂Ƃ̃\o[̃CfbNX (ԂLł)*/
+		gu::DynamicArray<gu::uint32> _solverIndices = {};
+		#pragma endregion
+	};
+}
+
+#endif
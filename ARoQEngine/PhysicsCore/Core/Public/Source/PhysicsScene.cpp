@@ -1,19 +1,1143 @@
-////////////////////////////////////////////////////////////////////////////////////
-////              @file   PhysicsScene.cpp
-/////             @brief  Management physics object
-/////             @author Toide Yutaro
-/////             @date   2023_01_09
-////////////////////////////////////////////////////////////////////////////////////
-//
-////////////////////////////////////////////////////////////////////////////////////
-////                             Include
-////////////////////////////////////////////////////////////////////////////////////
-//#include "../Include/PhysicsScene.hpp"
-////////////////////////////////////////////////////////////////////////////////////
-////                              Define
-////////////////////////////////////////////////////////////////////////////////////
-//using namespace physics::core;
-//
-////////////////////////////////////////////////////////////////////////////////////
-////                          Implement
-////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   PhysicsScene.cpp
+///  @brief  ̂SoA`ł܂Ƃ߂ĕێ, V[Ŝ̎Ԃi߂܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/PhysicsScene.hpp"
+#include "PhysicsCore/Core/Private/Include/PhysicsMath.hpp"
+#include "GameUtility/Math/Include/GMCPUFeature.hpp"
+#include "GameUtility/Math/Include/GMSort.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include "GameUtility/Memory/Include/GUMemory.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <future>
+#include <utility>
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics;
+using namespace physics::core;
+using namespace physics::core::details::scene;
+using namespace physics::collision;
+using namespace physics::dynamics;
+using namespace physics::geometry;
+using namespace physics::details::math;
+using namespace gm;
+using namespace gu;
+
+#pragma region Integration Kernel
+namespace
+{
+	using IntegrateVelocitiesFunction = void(*)(RigidBodyArray& bodies, const float deltaTime, const Float3& gravity);
+	using IntegratePositionsFunction  = void(*)(RigidBodyArray& bodies, const float deltaTime);
+
+	/*---------------------------------------------------------------
+			1̍̂̑xϕ܂. (XJ[łƊeSIMDł̒[)
+			[hԂ̋te\ R diag(I^-1) R^T ōXV, \o[Ŏgp܂.
+			SIMDłƌʂv邽, Z̏ԂSIMDłƓɂĂ܂.
+	-----------------------------------------------------------------*/
+	void IntegrateVelocity(RigidBodyArray& b, const uint64 i, const float deltaTime, const Float3& gravity)
+	{
+		/*-------------------------------------------------------------------
+		-      ]s
+		---------------------------------------------------------------------*/
+		const float qx = b.OrientationX[i], qy = b.OrientationY[i], qz = b.OrientationZ[i], qw = b.OrientationW[i];
+		const float x2 = qx + qx, y2 = qy + qy, z2 = qz + qz;
+		const float xx = qx * x2, yy = qy * y2, zz = qz * z2;
+		const float xy = qx * y2, xz = qx * z2, yz = qy * z2;
+		const float wx = qw * x2, wy = qw * y2, wz = qw * z2;
+
+		const float r00 = 1.0f - (yy + zz), r01 = xy - wz, r02 = xz + wy;
+		const float r10 = xy + wz, r11 = 1.0f - (xx + zz), r12 = yz - wx;
+		const float r20 = xz - wy, r21 = yz + wx, r22 = 1.0f - (xx + yy);
+
+		/*-------------------------------------------------------------------
+		-      [hԂ̋te\
+		---------------------------------------------------------------------*/
+		const float d0 = b.LocalInverseInertiaX[i], d1 = b.LocalInverseInertiaY[i], d2 = b.LocalInverseInertiaZ[i];
+		const float a0 = r00 * d0, a1 = r01 * d1, a2 = r02 * d2;
+		const float b0 = r10 * d0, b1 = r11 * d1, b2 = r12 * d2;
+		const float c0 = r20 * d0, c1 = r21 * d1, c2 = r22 * d2;
+
+		const float ixx = (a0 * r00 + a1 * r01) + a2 * r02;
+		const float iyy = (b0 * r10 + b1 * r11) + b2 * r12;
+		const float izz = (c0 * r20 + c1 * r21) + c2 * r22;
+		const float ixy = (a0 * r10 + a1 * r11) + a2 * r12;
+		const float ixz = (a0 * r20 + a1 * r21) + a2 * r22;
+		const float iyz = (b0 * r20 + b1 * r21) + b2 * r22;
+		b.InverseInertiaXX[i] = ixx; b.InverseInertiaYY[i] = iyy; b.InverseInertiaZZ[i] = izz;
+		b.InverseInertiaXY[i] = ixy; b.InverseInertiaXZ[i] = ixz; b.InverseInertiaYZ[i] = iyz;
+
+		/*-------------------------------------------------------------------
+		-      x : v = (v + (g + F / m) dt) / (1 + c dt)
+		---------------------------------------------------------------------*/
+		const float scaledTime    = deltaTime * b.MotionMask[i];
+		const float inverseMass   = b.InverseMass[i];
+		const float linearFactor  = 1.0f / (1.0f + deltaTime * b.LinearDamping[i]);
+		const float angularFactor = 1.0f / (1.0f + deltaTime * b.AngularDamping[i]);
+
+		b.LinearVelocityX[i] = (b.LinearVelocityX[i] + (gravity.x + b.ForceX[i] * inverseMass) * scaledTime) * linearFactor;
+		b.LinearVelocityY[i] = (b.LinearVelocityY[i] + (gravity.y + b.ForceY[i] * inverseMass) * scaledTime) * linearFactor;
+		b.LinearVelocityZ[i] = (b.LinearVelocityZ[i] + (gravity.z + b.ForceZ[i] * inverseMass) * scaledTime) * linearFactor;
+
+		const float tx = b.TorqueX[i], ty = b.TorqueY[i], tz = b.TorqueZ[i];
+		const float alphaX = (ixx * tx + ixy * ty) + ixz * tz;
+		const float alphaY = (ixy * tx + iyy * ty) + iyz * tz;
+		const float alphaZ = (ixz * tx + iyz * ty) + izz * tz;
+		b.AngularVelocityX[i] = (b.AngularVelocityX[i] + alphaX * scaledTime) * angularFactor;
+		b.AngularVelocityY[i] = (b.AngularVelocityY[i] + alphaY * scaledTime) * angularFactor;
+		b.AngularVelocityZ[i] = (b.AngularVelocityZ[i] + alphaZ * scaledTime) * angularFactor;
+
+		b.ForceX [i] = 0.0f; b.ForceY [i] = 0.0f; b.ForceZ [i] = 0.0f;
+		b.TorqueX[i] = 0.0f; b.TorqueY[i] = 0.0f; b.TorqueZ[i] = 0.0f;
+	}
+
+	/*---------------------------------------------------------------
+			1̍̂̈ʒuƉ]ϕ܂. q' = q + dt / 2 * (w, 0) * q ̌ɐK܂.
+	-----------------------------------------------------------------*/
+	void IntegratePosition(RigidBodyArray& b, const uint64 i, const float deltaTime)
+	{
+		const float vx = b.LinearVelocityX[i], vy = b.LinearVelocityY[i], vz = b.LinearVelocityZ[i];
+		b.PositionX[i] = b.PositionX[i] + vx * deltaTime;
+		b.PositionY[i] = b.PositionY[i] + vy * deltaTime;
+		b.PositionZ[i] = b.PositionZ[i] + vz * deltaTime;
+
+		const float halfTime = 0.5f * deltaTime;
+		const float wx = b.AngularVelocityX[i], wy = b.AngularVelocityY[i], wz = b.AngularVelocityZ[i];
+		const float qx = b.OrientationX[i], qy = b.OrientationY[i], qz = b.OrientationZ[i], qw = b.OrientationW[i];
+
+		const float nx = qx + ((wx * qw + wy * qz) - wz * qy) * halfTime;
+		const float ny = qy + ((wy * qw + wz * qx) - wx * qz) * halfTime;
+		const float nz = qz + ((wz * qw + wx * qy) - wy * qx) * halfTime;
+		const float nw = qw - ((wx * qx + wy * qy) + wz * qz) * halfTime;
+
+		const float inverseLength = 1.0f / std::sqrt(((nx * nx + ny * ny) + nz * nz) + nw * nw);
+		b.OrientationX[i] = nx * inverseLength;
+		b.OrientationY[i] = ny * inverseLength;
+		b.OrientationZ[i] = nz * inverseLength;
+		b.OrientationW[i] = nw * inverseLength;
+	}
+
+	/*---------------------------------------------------------------
+			XJ[
+	-----------------------------------------------------------------*/
+	void IntegrateVelocitiesScalar(RigidBodyArray& bodies, const float deltaTime, const Float3& gravity)
+	{
+		for (uint64 i = 0; i < bodies.Size(); ++i)
+		{
+			IntegrateVelocity(bodies, i, deltaTime, gravity);
+		}
+	}
+
+	void IntegratePositionsScalar(RigidBodyArray& bodies, const float deltaTime)
+	{
+		for (uint64 i = 0; i < bodies.Size(); ++i)
+		{
+			IntegratePosition(bodies, i, deltaTime);
+		}
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	/*---------------------------------------------------------------
+			SSE2 : 4ϕ
+	-----------------------------------------------------------------*/
+	void IntegrateVelocitiesSSE2(RigidBodyArray& b, const float deltaTime, const Float3& gravity)
+	{
+		const uint64 count = b.Size();
+		const __m128 one      = _mm_set1_ps(1.0f);
+		const __m128 zero     = _mm_setzero_ps();
+		const __m128 timeStep = _mm_set1_ps(deltaTime);
+		const __m128 gravityX = _mm_set1_ps(gravity.x);
+		const __m128 gravityY = _mm_set1_ps(gravity.y);
+		const __m128 gravityZ = _mm_set1_ps(gravity.z);
+
+		uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 qx = _mm_loadu_ps(&b.OrientationX[i]);
+			const __m128 qy = _mm_loadu_ps(&b.OrientationY[i]);
+			const __m128 qz = _mm_loadu_ps(&b.OrientationZ[i]);
+			const __m128 qw = _mm_loadu_ps(&b.OrientationW[i]);
+			const __m128 x2 = _mm_add_ps(qx, qx), y2 = _mm_add_ps(qy, qy), z2 = _mm_add_ps(qz, qz);
+			const __m128 xx = _mm_mul_ps(qx, x2), yy = _mm_mul_ps(qy, y2), zz = _mm_mul_ps(qz, z2);
+			const __m128 xy = _mm_mul_ps(qx, y2), xz = _mm_mul_ps(qx, z2), yz = _mm_mul_ps(qy, z2);
+			const __m128 wx = _mm_mul_ps(qw, x2), wy = _mm_mul_ps(qw, y2), wz = _mm_mul_ps(qw, z2);
+
+			const __m128 r00 = _mm_sub_ps(one, _mm_add_ps(yy, zz)), r01 = _mm_sub_ps(xy, wz), r02 = _mm_add_ps(xz, wy);
+			const __m128 r10 = _mm_add_ps(xy, wz), r11 = _mm_sub_ps(one, _mm_add_ps(xx, zz)), r12 = _mm_sub_ps(yz, wx);
+			const __m128 r20 = _mm_sub_ps(xz, wy), r21 = _mm_add_ps(yz, wx), r22 = _mm_sub_ps(one, _mm_add_ps(xx, yy));
+
+			const __m128 d0 = _mm_loadu_ps(&b.LocalInverseInertiaX[i]);
+			const __m128 d1 = _mm_loadu_ps(&b.LocalInverseInertiaY[i]);
+			const __m128 d2 = _mm_loadu_ps(&b.LocalInverseInertiaZ[i]);
+			const __m128 a0 = _mm_mul_ps(r00, d0), a1 = _mm_mul_ps(r01, d1), a2 = _mm_mul_ps(r02, d2);
+			const __m128 b0 = _mm_mul_ps(r10, d0), b1 = _mm_mul_ps(r11, d1), b2 = _mm_mul_ps(r12, d2);
+			const __m128 c0 = _mm_mul_ps(r20, d0), c1 = _mm_mul_ps(r21, d1), c2 = _mm_mul_ps(r22, d2);
+
+			const __m128 ixx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, r00), _mm_mul_ps(a1, r01)), _mm_mul_ps(a2, r02));
+			const __m128 iyy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b0, r10), _mm_mul_ps(b1, r11)), _mm_mul_ps(b2, r12));
+			const __m128 izz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(c0, r20), _mm_mul_ps(c1, r21)), _mm_mul_ps(c2, r22));
+			const __m128 ixy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, r10), _mm_mul_ps(a1, r11)), _mm_mul_ps(a2, r12));
+			const __m128 ixz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a0, r20), _mm_mul_ps(a1, r21)), _mm_mul_ps(a2, r22));
+			const __m128 iyz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(b0, r20), _mm_mul_ps(b1, r21)), _mm_mul_ps(b2, r22));
+			_mm_storeu_ps(&b.InverseInertiaXX[i], ixx); _mm_storeu_ps(&b.InverseInertiaYY[i], iyy); _mm_storeu_ps(&b.InverseInertiaZZ[i], izz);
+			_mm_storeu_ps(&b.InverseInertiaXY[i], ixy); _mm_storeu_ps(&b.InverseInertiaXZ[i], ixz); _mm_storeu_ps(&b.InverseInertiaYZ[i], iyz);
+
+			const __m128 scaledTime    = _mm_mul_ps(timeStep, _mm_loadu_ps(&b.MotionMask[i]));
+			const __m128 inverseMass   = _mm_loadu_ps(&b.InverseMass[i]);
+			const __m128 linearFactor  = _mm_div_ps(one, _mm_add_ps(one, _mm_mul_ps(timeStep, _mm_loadu_ps(&b.LinearDamping[i]))));
+			const __m128 angularFactor = _mm_div_ps(one, _mm_add_ps(one, _mm_mul_ps(timeStep, _mm_loadu_ps(&b.AngularDamping[i]))));
+
+			_mm_storeu_ps(&b.LinearVelocityX[i], _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&b.LinearVelocityX[i]), _mm_mul_ps(_mm_add_ps(gravityX, _mm_mul_ps(_mm_loadu_ps(&b.ForceX[i]), inverseMass)), scaledTime)), linearFactor));
+			_mm_storeu_ps(&b.LinearVelocityY[i], _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&b.LinearVelocityY[i]), _mm_mul_ps(_mm_add_ps(gravityY, _mm_mul_ps(_mm_loadu_ps(&b.ForceY[i]), inverseMass)), scaledTime)), linearFactor));
+			_mm_storeu_ps(&b.LinearVelocityZ[i], _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&b.LinearVelocityZ[i]), _mm_mul_ps(_mm_add_ps(gravityZ, _mm_mul_ps(_mm_loadu_ps(&b.ForceZ[i]), inverseMass)), scaledTime)), linearFactor));
+
+			const __m128 tx = _mm_loadu_ps(&b.TorqueX[i]), ty = _mm_loadu_ps(&b.TorqueY[i]), tz = _mm_loadu_ps(&b.TorqueZ[i]);
+			const __m128 alphaX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ixx, tx), _mm_mul_ps(ixy, ty)), _mm_mul_ps(ixz, tz));
+			const __m128 alphaY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ixy, tx), _mm_mul_ps(iyy, ty)), _mm_mul_ps(iyz, tz));
+			const __m128 alphaZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(ixz, tx), _mm_mul_ps(iyz, ty)), _mm_mul_ps(izz, tz));
+			_mm_storeu_ps(&b.AngularVelocityX[i], _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&b.AngularVelocityX[i]), _mm_mul_ps(alphaX, scaledTime)), angularFactor));
+			_mm_storeu_ps(&b.AngularVelocityY[i], _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&b.AngularVelocityY[i]), _mm_mul_ps(alphaY, scaledTime)), angularFactor));
+			_mm_storeu_ps(&b.AngularVelocityZ[i], _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(&b.AngularVelocityZ[i]), _mm_mul_ps(alphaZ, scaledTime)), angularFactor));
+
+			_mm_storeu_ps(&b.ForceX [i], zero); _mm_storeu_ps(&b.ForceY [i], zero); _mm_storeu_ps(&b.ForceZ [i], zero);
+			_mm_storeu_ps(&b.TorqueX[i], zero); _mm_storeu_ps(&b.TorqueY[i], zero); _mm_storeu_ps(&b.TorqueZ[i], zero);
+		}
+
+		for (; i < count; ++i) { IntegrateVelocity(b, i, deltaTime, gravity); }
+	}
+
+	void IntegratePositionsSSE2(RigidBodyArray& b, const float deltaTime)
+	{
+		const uint64 count = b.Size();
+		const __m128 one      = _mm_set1_ps(1.0f);
+		const __m128 timeStep = _mm_set1_ps(deltaTime);
+		const __m128 halfTime = _mm_set1_ps(0.5f * deltaTime);
+
+		uint64 i = 0;
+		for (; i + 4 <= count; i += 4)
+		{
+			_mm_storeu_ps(&b.PositionX[i], _mm_add_ps(_mm_loadu_ps(&b.PositionX[i]), _mm_mul_ps(_mm_loadu_ps(&b.LinearVelocityX[i]), timeStep)));
+			_mm_storeu_ps(&b.PositionY[i], _mm_add_ps(_mm_loadu_ps(&b.PositionY[i]), _mm_mul_ps(_mm_loadu_ps(&b.LinearVelocityY[i]), timeStep)));
+			_mm_storeu_ps(&b.PositionZ[i], _mm_add_ps(_mm_loadu_ps(&b.PositionZ[i]), _mm_mul_ps(_mm_loadu_ps(&b.LinearVelocityZ[i]), timeStep)));
+
+			const __m128 wx = _mm_loadu_ps(&b.AngularVelocityX[i]), wy = _mm_loadu_ps(&b.AngularVelocityY[i]), wz = _mm_loadu_ps(&b.AngularVelocityZ[i]);
+			const __m128 qx = _mm_loadu_ps(&b.OrientationX[i]), qy = _mm_loadu_ps(&b.OrientationY[i]);
+			const __m128 qz = _mm_loadu_ps(&b.OrientationZ[i]), qw = _mm_loadu_ps(&b.OrientationW[i]);
+
+			const __m128 nx = _mm_add_ps(qx, _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(wx, qw), _mm_mul_ps(wy, qz)), _mm_mul_ps(wz, qy)), halfTime));
+			const __m128 ny = _mm_add_ps(qy, _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(wy, qw), _mm_mul_ps(wz, qx)), _mm_mul_ps(wx, qz)), halfTime));
+			const __m128 nz = _mm_add_ps(qz, _mm_mul_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(wz, qw), _mm_mul_ps(wx, qy)), _mm_mul_ps(wy, qx)), halfTime));
+			const __m128 nw = _mm_sub_ps(qw, _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(wx, qx), _mm_mul_ps(wy, qy)), _mm_mul_ps(wz, qz)), halfTime));
+
+			const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(ny, ny)), _mm_mul_ps(nz, nz)), _mm_mul_ps(nw, nw));
+			const __m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+			_mm_storeu_ps(&b.OrientationX[i], _mm_mul_ps(nx, inverseLength));
+			_mm_storeu_ps(&b.OrientationY[i], _mm_mul_ps(ny, inverseLength));
+			_mm_storeu_ps(&b.OrientationZ[i], _mm_mul_ps(nz, inverseLength));
+			_mm_storeu_ps(&b.OrientationW[i], _mm_mul_ps(nw, inverseLength));
+		}
+
+		for (; i < count; ++i) { IntegratePosition(b, i, deltaTime); }
+	}
+
+	/*---------------------------------------------------------------
+			AVX2 : 8ϕ
+			XJ[łƌʂv邽, FMA͎gpɏZƉZ𕪂Ă܂.
+	-----------------------------------------------------------------*/
+	SIMD_TARGET_AVX2 void IntegrateVelocitiesAVX2(RigidBodyArray& b, const float deltaTime, const Float3& gravity)
+	{
+		const uint64 count = b.Size();
+		const __m256 one      = _mm256_set1_ps(1.0f);
+		const __m256 zero     = _mm256_setzero_ps();
+		const __m256 timeStep = _mm256_set1_ps(deltaTime);
+		const __m256 gravityX = _mm256_set1_ps(gravity.x);
+		const __m256 gravityY = _mm256_set1_ps(gravity.y);
+		const __m256 gravityZ = _mm256_set1_ps(gravity.z);
+
+		uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 qx = _mm256_loadu_ps(&b.OrientationX[i]);
+			const __m256 qy = _mm256_loadu_ps(&b.OrientationY[i]);
+			const __m256 qz = _mm256_loadu_ps(&b.OrientationZ[i]);
+			const __m256 qw = _mm256_loadu_ps(&b.OrientationW[i]);
+			const __m256 x2 = _mm256_add_ps(qx, qx), y2 = _mm256_add_ps(qy, qy), z2 = _mm256_add_ps(qz, qz);
+			const __m256 xx = _mm256_mul_ps(qx, x2), yy = _mm256_mul_ps(qy, y2), zz = _mm256_mul_ps(qz, z2);
+			const __m256 xy = _mm256_mul_ps(qx, y2), xz = _mm256_mul_ps(qx, z2), yz = _mm256_mul_ps(qy, z2);
+			const __m256 wx = _mm256_mul_ps(qw, x2), wy = _mm256_mul_ps(qw, y2), wz = _mm256_mul_ps(qw, z2);
+
+			const __m256 r00 = _mm256_sub_ps(one, _mm256_add_ps(yy, zz)), r01 = _mm256_sub_ps(xy, wz), r02 = _mm256_add_ps(xz, wy);
+			const __m256 r10 = _mm256_add_ps(xy, wz), r11 = _mm256_sub_ps(one, _mm256_add_ps(xx, zz)), r12 = _mm256_sub_ps(yz, wx);
+			const __m256 r20 = _mm256_sub_ps(xz, wy), r21 = _mm256_add_ps(yz, wx), r22 = _mm256_sub_ps(one, _mm256_add_ps(xx, yy));
+
+			const __m256 d0 = _mm256_loadu_ps(&b.LocalInverseInertiaX[i]);
+			const __m256 d1 = _mm256_loadu_ps(&b.LocalInverseInertiaY[i]);
+			const __m256 d2 = _mm256_loadu_ps(&b.LocalInverseInertiaZ[i]);
+			const __m256 a0 = _mm256_mul_ps(r00, d0), a1 = _mm256_mul_ps(r01, d1), a2 = _mm256_mul_ps(r02, d2);
+			const __m256 b0 = _mm256_mul_ps(r10, d0), b1 = _mm256_mul_ps(r11, d1), b2 = _mm256_mul_ps(r12, d2);
+			const __m256 c0 = _mm256_mul_ps(r20, d0), c1 = _mm256_mul_ps(r21, d1), c2 = _mm256_mul_ps(r22, d2);
+
+			const __m256 ixx = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a0, r00), _mm256_mul_ps(a1, r01)), _mm256_mul_ps(a2, r02));
+			const __m256 iyy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b0, r10), _mm256_mul_ps(b1, r11)), _mm256_mul_ps(b2, r12));
+			const __m256 izz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(c0, r20), _mm256_mul_ps(c1, r21)), _mm256_mul_ps(c2, r22));
+			const __m256 ixy = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a0, r10), _mm256_mul_ps(a1, r11)), _mm256_mul_ps(a2, r12));
+			const __m256 ixz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a0, r20), _mm256_mul_ps(a1, r21)), _mm256_mul_ps(a2, r22));
+			const __m256 iyz = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b0, r20), _mm256_mul_ps(b1, r21)), _mm256_mul_ps(b2, r22));
+			_mm256_storeu_ps(&b.InverseInertiaXX[i], ixx); _mm256_storeu_ps(&b.InverseInertiaYY[i], iyy); _mm256_storeu_ps(&b.InverseInertiaZZ[i], izz);
+			_mm256_storeu_ps(&b.InverseInertiaXY[i], ixy); _mm256_storeu_ps(&b.InverseInertiaXZ[i], ixz); _mm256_storeu_ps(&b.InverseInertiaYZ[i], iyz);
+
+			const __m256 scaledTime    = _mm256_mul_ps(timeStep, _mm256_loadu_ps(&b.MotionMask[i]));
+			const __m256 inverseMass   = _mm256_loadu_ps(&b.InverseMass[i]);
+			const __m256 linearFactor  = _mm256_div_ps(one, _mm256_add_ps(one, _mm256_mul_ps(timeStep, _mm256_loadu_ps(&b.LinearDamping[i]))));
+			const __m256 angularFactor = _mm256_div_ps(one, _mm256_add_ps(one, _mm256_mul_ps(timeStep, _mm256_loadu_ps(&b.AngularDamping[i]))));
+
+			_mm256_storeu_ps(&b.LinearVelocityX[i], _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&b.LinearVelocityX[i]), _mm256_mul_ps(_mm256_add_ps(gravityX, _mm256_mul_ps(_mm256_loadu_ps(&b.ForceX[i]), inverseMass)), scaledTime)), linearFactor));
+			_mm256_storeu_ps(&b.LinearVelocityY[i], _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&b.LinearVelocityY[i]), _mm256_mul_ps(_mm256_add_ps(gravityY, _mm256_mul_ps(_mm256_loadu_ps(&b.ForceY[i]), inverseMass)), scaledTime)), linearFactor));
+			_mm256_storeu_ps(&b.LinearVelocityZ[i], _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&b.LinearVelocityZ[i]), _mm256_mul_ps(_mm256_add_ps(gravityZ, _mm256_mul_ps(_mm256_loadu_ps(&b.ForceZ[i]), inverseMass)), scaledTime)), linearFactor));
+
+			const __m256 tx = _mm256_loadu_ps(&b.TorqueX[i]), ty = _mm256_loadu_ps(&b.TorqueY[i]), tz = _mm256_loadu_ps(&b.TorqueZ[i]);
+			const __m256 alphaX = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ixx, tx), _mm256_mul_ps(ixy, ty)), _mm256_mul_ps(ixz, tz));
+			const __m256 alphaY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ixy, tx), _mm256_mul_ps(iyy, ty)), _mm256_mul_ps(iyz, tz));
+			const __m256 alphaZ = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ixz, tx), _mm256_mul_ps(iyz, ty)), _mm256_mul_ps(izz, tz));
+			_mm256_storeu_ps(&b.AngularVelocityX[i], _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&b.AngularVelocityX[i]), _mm256_mul_ps(alphaX, scaledTime)), angularFactor));
+			_mm256_storeu_ps(&b.AngularVelocityY[i], _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&b.AngularVelocityY[i]), _mm256_mul_ps(alphaY, scaledTime)), angularFactor));
+			_mm256_storeu_ps(&b.AngularVelocityZ[i], _mm256_mul_ps(_mm256_add_ps(_mm256_loadu_ps(&b.AngularVelocityZ[i]), _mm256_mul_ps(alphaZ, scaledTime)), angularFactor));
+
+			_mm256_storeu_ps(&b.ForceX [i], zero); _mm256_storeu_ps(&b.ForceY [i], zero); _mm256_storeu_ps(&b.ForceZ [i], zero);
+			_mm256_storeu_ps(&b.TorqueX[i], zero); _mm256_storeu_ps(&b.TorqueY[i], zero); _mm256_storeu_ps(&b.TorqueZ[i], zero);
+		}
+		_mm256_zeroupper();
+
+		for (; i < count; ++i) { IntegrateVelocity(b, i, deltaTime, gravity); }
+	}
+
+	SIMD_TARGET_AVX2 void IntegratePositionsAVX2(RigidBodyArray& b, const float deltaTime)
+	{
+		const uint64 count = b.Size();
+		const __m256 one      = _mm256_set1_ps(1.0f);
+		const __m256 timeStep = _mm256_set1_ps(deltaTime);
+		const __m256 halfTime = _mm256_set1_ps(0.5f * deltaTime);
+
+		uint64 i = 0;
+		for (; i + 8 <= count; i += 8)
+		{
+			_mm256_storeu_ps(&b.PositionX[i], _mm256_add_ps(_mm256_loadu_ps(&b.PositionX[i]), _mm256_mul_ps(_mm256_loadu_ps(&b.LinearVelocityX[i]), timeStep)));
+			_mm256_storeu_ps(&b.PositionY[i], _mm256_add_ps(_mm256_loadu_ps(&b.PositionY[i]), _mm256_mul_ps(_mm256_loadu_ps(&b.LinearVelocityY[i]), timeStep)));
+			_mm256_storeu_ps(&b.PositionZ[i], _mm256_add_ps(_mm256_loadu_ps(&b.PositionZ[i]), _mm256_mul_ps(_mm256_loadu_ps(&b.LinearVelocityZ[i]), timeStep)));
+
+			const __m256 wx = _mm256_loadu_ps(&b.AngularVelocityX[i]), wy = _mm256_loadu_ps(&b.AngularVelocityY[i]), wz = _mm256_loadu_ps(&b.AngularVelocityZ[i]);
+			const __m256 qx = _mm256_loadu_ps(&b.OrientationX[i]), qy = _mm256_loadu_ps(&b.OrientationY[i]);
+			const __m256 qz = _mm256_loadu_ps(&b.OrientationZ[i]), qw = _mm256_loadu_ps(&b.OrientationW[i]);
+
+			const __m256 nx = _mm256_add_ps(qx, _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(wx, qw), _mm256_mul_ps(wy, qz)), _mm256_mul_ps(wz, qy)), halfTime));
+			const __m256 ny = _mm256_add_ps(qy, _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(wy, qw), _mm256_mul_ps(wz, qx)), _mm256_mul_ps(wx, qz)), halfTime));
+			const __m256 nz = _mm256_add_ps(qz, _mm256_mul_ps(_mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(wz, qw), _mm256_mul_ps(wx, qy)), _mm256_mul_ps(wy, qx)), halfTime));
+			const __m256 nw = _mm256_sub_ps(qw, _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(wx, qx), _mm256_mul_ps(wy, qy)), _mm256_mul_ps(wz, qz)), halfTime));
+
+			const __m256 lengthSquared = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(nx, nx), _mm256_mul_ps(ny, ny)), _mm256_mul_ps(nz, nz)), _mm256_mul_ps(nw, nw));
+			const __m256 inverseLength = _mm256_div_ps(one, _mm256_sqrt_ps(lengthSquared));
+			_mm256_storeu_ps(&b.OrientationX[i], _mm256_mul_ps(nx, inverseLength));
+			_mm256_storeu_ps(&b.OrientationY[i], _mm256_mul_ps(ny, inverseLength));
+			_mm256_storeu_ps(&b.OrientationZ[i], _mm256_mul_ps(nz, inverseLength));
+			_mm256_storeu_ps(&b.OrientationW[i], _mm256_mul_ps(nw, inverseLength));
+		}
+		_mm256_zeroupper();
+
+		for (; i < count; ++i) { IntegratePosition(b, i, deltaTime); }
+	}
+
+	/*---------------------------------------------------------------
+			SimdInstructionSet̏ɕׂ֐e[u
+			SSE4.1ŗL̖߂őȂӏ͖, SSE4.1SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr IntegrateVelocitiesFunction INTEGRATE_VELOCITIES_FUNCTIONS[] = { IntegrateVelocitiesScalar, IntegrateVelocitiesSSE2, IntegrateVelocitiesSSE2, IntegrateVelocitiesAVX2 };
+	constexpr IntegratePositionsFunction  INTEGRATE_POSITIONS_FUNCTIONS [] = { IntegratePositionsScalar , IntegratePositionsSSE2 , IntegratePositionsSSE2 , IntegratePositionsAVX2  };
+#else
+	constexpr IntegrateVelocitiesFunction INTEGRATE_VELOCITIES_FUNCTIONS[] = { IntegrateVelocitiesScalar, IntegrateVelocitiesScalar, IntegrateVelocitiesScalar, IntegrateVelocitiesScalar };
+	constexpr IntegratePositionsFunction  INTEGRATE_POSITIONS_FUNCTIONS [] = { IntegratePositionsScalar , IntegratePositionsScalar , IntegratePositionsScalar , IntegratePositionsScalar  };
+#endif
+
+	static_assert(sizeof(INTEGRATE_VELOCITIES_FUNCTIONS) / sizeof(INTEGRATE_VELOCITIES_FUNCTIONS[0]) == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(INTEGRATE_POSITIONS_FUNCTIONS)  / sizeof(INTEGRATE_POSITIONS_FUNCTIONS[0])  == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+}
+#pragma endregion Integration Kernel
+
+namespace
+{
+	/*---------------------------------------------------------------
+			̂̑g̃L[ (CfbNX32bitɂ܂)
+	-----------------------------------------------------------------*/
+	__forceinline uint64 MakePairKey(const uint32 a, const uint32 b)
+	{
+		return a < b ? (static_cast<uint64>(a) << 32) | b : (static_cast<uint64>(b) << 32) | a;
+	}
+
+	/*---------------------------------------------------------------
+			`Ǝʂ, [JԂ̊厲̋t[g߂܂
+			JvZ͉~, [̔킹ƂČvZ܂.
+	-----------------------------------------------------------------*/
+	Float3 ComputeLocalInverseInertia(const RigidBodyDesc& desc)
+	{
+		if (desc.Mass <= 0.0f) { return Float3(0.0f, 0.0f, 0.0f); }
+
+		const float mass = desc.Mass;
+		Float3 inertia = {};
+		switch (desc.ShapeType)
+		{
+			case GeometryType::Sphere:
+			{
+				const float moment = 0.4f * mass * desc.Radius * desc.Radius;
+				inertia = Float3(moment, moment, moment);
+				break;
+			}
+			case GeometryType::AABB:
+			case GeometryType::OBB:
+			{
+				const float x2 = desc.HalfExtents.x * desc.HalfExtents.x;
+				const float y2 = desc.HalfExtents.y * desc.HalfExtents.y;
+				const float z2 = desc.HalfExtents.z * desc.HalfExtents.z;
+				inertia = Float3(mass / 3.0f * (y2 + z2), mass / 3.0f * (x2 + z2), mass / 3.0f * (x2 + y2));
+				break;
+			}
+			case GeometryType::Capsule:
+			{
+				const float r  = desc.Radius;
+				const float h  = desc.HalfHeight;
+				const float cylinderVolume = 2.0f * h * r * r;
+				const float sphereVolume   = 4.0f / 3.0f * r * r * r;
+				const float cylinderMass   = mass * cylinderVolume / (cylinderVolume + sphereVolume);
+				const float sphereMass     = mass - cylinderMass;
+
+				const float axial   = 0.5f * cylinderMass * r * r + 0.4f * sphereMass * r * r;
+				const float lateral = cylinderMass * (0.25f * r * r + h * h / 3.0f)
+					+ sphereMass * (0.4f * r * r + h * h + 0.75f * h * r);
+				inertia = Float3(lateral, axial, lateral);
+				break;
+			}
+			default:
+			{
+				Check(false);
+				break;
+			}
+		}
+		return Float3(1.0f / inertia.x, 1.0f / inertia.y, 1.0f / inertia.z);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region RigidBodyArray
+gu::uint32 RigidBodyArray::Push(const RigidBodyDesc& desc)
+{
+	const bool   isDynamic      = desc.Mass > 0.0f;
+	const Float3 inverseInertia = ComputeLocalInverseInertia(desc);
+
+	PositionX       .Push(desc.Position.x);
+	PositionY       .Push(desc.Position.y);
+	PositionZ       .Push(desc.Position.z);
+	OrientationX    .Push(desc.Orientation.x);
+	OrientationY    .Push(desc.Orientation.y);
+	OrientationZ    .Push(desc.Orientation.z);
+	OrientationW    .Push(desc.Orientation.w);
+	LinearVelocityX .Push(isDynamic ? desc.LinearVelocity.x  : 0.0f);
+	LinearVelocityY .Push(isDynamic ? desc.LinearVelocity.y  : 0.0f);
+	LinearVelocityZ .Push(isDynamic ? desc.LinearVelocity.z  : 0.0f);
+	AngularVelocityX.Push(isDynamic ? desc.AngularVelocity.x : 0.0f);
+	AngularVelocityY.Push(isDynamic ? desc.AngularVelocity.y : 0.0f);
+	AngularVelocityZ.Push(isDynamic ? desc.AngularVelocity.z : 0.0f);
+	ForceX          .Push(0.0f);
+	ForceY          .Push(0.0f);
+	ForceZ          .Push(0.0f);
+	TorqueX         .Push(0.0f);
+	TorqueY         .Push(0.0f);
+	TorqueZ         .Push(0.0f);
+
+	InverseMass         .Push(isDynamic ? 1.0f / desc.Mass : 0.0f);
+	LocalInverseInertiaX.Push(inverseInertia.x);
+	LocalInverseInertiaY.Push(inverseInertia.y);
+	LocalInverseInertiaZ.Push(inverseInertia.z);
+	InverseInertiaXX    .Push(0.0f);
+	InverseInertiaYY    .Push(0.0f);
+	InverseInertiaZZ    .Push(0.0f);
+	InverseInertiaXY    .Push(0.0f);
+	InverseInertiaXZ    .Push(0.0f);
+	InverseInertiaYZ    .Push(0.0f);
+	LinearDamping       .Push(desc.LinearDamping);
+	AngularDamping      .Push(desc.AngularDamping);
+	MotionMask          .Push(isDynamic ? 1.0f : 0.0f);
+
+	Friction   .Push(desc.Friction);
+	SleepTime  .Push(0.0f);
+	IsAwake    .Push(isDynamic);
+	ShapeType  .Push(desc.ShapeType);
+	HalfExtents.Push(desc.HalfExtents);
+	Radius     .Push(desc.Radius);
+	HalfHeight .Push(desc.HalfHeight);
+	ProxyID    .Push(collision::details::tree::NULL_NODE);
+	return static_cast<uint32>(InverseMass.Size() - 1);
+}
+
+void RigidBodyArray::Reserve(const gu::uint64 capacity)
+{
+	PositionX           .Reserve(capacity); PositionY       .Reserve(capacity); PositionZ       .Reserve(capacity);
+	OrientationX        .Reserve(capacity); OrientationY    .Reserve(capacity); OrientationZ    .Reserve(capacity); OrientationW.Reserve(capacity);
+	LinearVelocityX     .Reserve(capacity); LinearVelocityY .Reserve(capacity); LinearVelocityZ .Reserve(capacity);
+	AngularVelocityX    .Reserve(capacity); AngularVelocityY.Reserve(capacity); AngularVelocityZ.Reserve(capacity);
+	ForceX              .Reserve(capacity); ForceY          .Reserve(capacity); ForceZ          .Reserve(capacity);
+	TorqueX             .Reserve(capacity); TorqueY         .Reserve(capacity); TorqueZ         .Reserve(capacity);
+	InverseMass         .Reserve(capacity);
+	LocalInverseInertiaX.Reserve(capacity); LocalInverseInertiaY.Reserve(capacity); LocalInverseInertiaZ.Reserve(capacity);
+	InverseInertiaXX    .Reserve(capacity); InverseInertiaYY.Reserve(capacity); InverseInertiaZZ.Reserve(capacity);
+	InverseInertiaXY    .Reserve(capacity); InverseInertiaXZ.Reserve(capacity); InverseInertiaYZ.Reserve(capacity);
+	LinearDamping       .Reserve(capacity); AngularDamping  .Reserve(capacity); MotionMask      .Reserve(capacity);
+	Friction            .Reserve(capacity); SleepTime       .Reserve(capacity); IsAwake         .Reserve(capacity);
+	ShapeType           .Reserve(capacity); HalfExtents     .Reserve(capacity); Radius          .Reserve(capacity);
+	HalfHeight          .Reserve(capacity); ProxyID         .Reserve(capacity);
+}
+
+void RigidBodyArray::Clear()
+{
+	PositionX           .Clear(); PositionY       .Clear(); PositionZ       .Clear();
+	OrientationX        .Clear(); OrientationY    .Clear(); OrientationZ    .Clear(); OrientationW.Clear();
+	LinearVelocityX     .Clear(); LinearVelocityY .Clear(); LinearVelocityZ .Clear();
+	AngularVelocityX    .Clear(); AngularVelocityY.Clear(); AngularVelocityZ.Clear();
+	ForceX              .Clear(); ForceY          .Clear(); ForceZ          .Clear();
+	TorqueX             .Clear(); TorqueY         .Clear(); TorqueZ         .Clear();
+	InverseMass         .Clear();
+	LocalInverseInertiaX.Clear(); LocalInverseInertiaY.Clear(); LocalInverseInertiaZ.Clear();
+	InverseInertiaXX    .Clear(); InverseInertiaYY.Clear(); InverseInertiaZZ.Clear();
+	InverseInertiaXY    .Clear(); InverseInertiaXZ.Clear(); InverseInertiaYZ.Clear();
+	LinearDamping       .Clear(); AngularDamping  .Clear(); MotionMask      .Clear();
+	Friction            .Clear(); SleepTime       .Clear(); IsAwake         .Clear();
+	ShapeType           .Clear(); HalfExtents     .Clear(); Radius          .Clear();
+	HalfHeight          .Clear(); ProxyID         .Clear();
+}
+#pragma endregion RigidBodyArray
+
+#pragma region PhysicsScene Public Function
+/*!**********************************************************************
+*  @brief     ̂ǉ܂.
+*  @param[in] const RigidBodyDesc& ݒ
+*  @return    gu::uint32 ̂̃CfbNX
+*************************************************************************/
+uint32 PhysicsScene::AddBody(const RigidBodyDesc& desc)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Physics);
+	Check(desc.ShapeType == GeometryType::Sphere || desc.ShapeType == GeometryType::AABB
+	   || desc.ShapeType == GeometryType::OBB    || desc.ShapeType == GeometryType::Capsule);
+
+	const uint32 index = _bodies.Push(desc);
+	_bodies.ProxyID[index] = _broadphase.CreateProxy(ComputeBounds(index), index);
+	return index;
+}
+
+/*!**********************************************************************
+*  @brief     ̃Xebvŉ͂ǉ܂. Ă鍄̂͋N܂.
+*************************************************************************/
+void PhysicsScene::AddForce(const uint32 index, const Float3& force)
+{
+	Check(index < _bodies.Size());
+	if (_bodies.InverseMass[index] <= 0.0f) { return; }
+
+	_bodies.ForceX[index] += force.x;
+	_bodies.ForceY[index] += force.y;
+	_bodies.ForceZ[index] += force.z;
+	WakeUp(index);
+}
+
+/*!**********************************************************************
+*  @brief     ̃XebvŉgNǉ܂. Ă鍄̂͋N܂.
+*************************************************************************/
+void PhysicsScene::AddTorque(const uint32 index, const Float3& torque)
+{
+	Check(index < _bodies.Size());
+	if (_bodies.InverseMass[index] <= 0.0f) { return; }
+
+	_bodies.TorqueX[index] += torque.x;
+	_bodies.TorqueY[index] += torque.y;
+	_bodies.TorqueZ[index] += torque.z;
+	WakeUp(index);
+}
+
+/*!**********************************************************************
+*  @brief     xݒ肵܂. ÓIȍ̂ɂ͐ݒł܂.
+*************************************************************************/
+void PhysicsScene::SetLinearVelocity(const uint32 index, const Float3& velocity)
+{
+	Check(index < _bodies.Size());
+	if (_bodies.InverseMass[index] <= 0.0f) { return; }
+
+	_bodies.LinearVelocityX[index] = velocity.x;
+	_bodies.LinearVelocityY[index] = velocity.y;
+	_bodies.LinearVelocityZ[index] = velocity.z;
+	WakeUp(index);
+}
+
+/*!**********************************************************************
+*  @brief     pxݒ肵܂. ÓIȍ̂ɂ͐ݒł܂.
+*************************************************************************/
+void PhysicsScene::SetAngularVelocity(const uint32 index, const Float3& velocity)
+{
+	Check(index < _bodies.Size());
+	if (_bodies.InverseMass[index] <= 0.0f) { return; }
+
+	_bodies.AngularVelocityX[index] = velocity.x;
+	_bodies.AngularVelocityY[index] = velocity.y;
+	_bodies.AngularVelocityZ[index] = velocity.z;
+	WakeUp(index);
+}
+
+/*!**********************************************************************
+*  @brief     Ă鍄̂N܂.
+*************************************************************************/
+void PhysicsScene::WakeUp(const uint32 index)
+{
+	Check(index < _bodies.Size());
+	if (_bodies.InverseMass[index] <= 0.0f) { return; }
+
+	_bodies.SleepTime[index] = 0.0f;
+	SetAwake(index, true);
+}
+
+/*!**********************************************************************
+*  @brief     V[̎Ԃi߂܂.
+*  @param[in] const float ԍ [s]
+*  @return    void
+*************************************************************************/
+void PhysicsScene::Step(const float deltaTime)
+{
+	Step(deltaTime, nullptr);
+}
+
+/*!**********************************************************************
+*  @brief     V[̎Ԃi߂܂. ڐG_̐Ɠ̍S̉ɍs܂.
+*  @param[in] const float ԍ [s]
+*  @param[in] gu::ThreadPool& Xbhv[
+*  @return    void
+*************************************************************************/
+void PhysicsScene::Step(const float deltaTime, ThreadPool& threadPool)
+{
+	Step(deltaTime, &threadPool);
+}
+#pragma endregion PhysicsScene Public Function
+
+#pragma region PhysicsScene Public Property
+Float3 PhysicsScene::GetPosition(const uint32 index) const
+{
+	return Float3(_bodies.PositionX[index], _bodies.PositionY[index], _bodies.PositionZ[index]);
+}
+
+Float4 PhysicsScene::GetOrientation(const uint32 index) const
+{
+	return Float4(_bodies.OrientationX[index], _bodies.OrientationY[index], _bodies.OrientationZ[index], _bodies.OrientationW[index]);
+}
+
+Float3 PhysicsScene::GetLinearVelocity(const uint32 index) const
+{
+	return Float3(_bodies.LinearVelocityX[index], _bodies.LinearVelocityY[index], _bodies.LinearVelocityZ[index]);
+}
+
+Float3 PhysicsScene::GetAngularVelocity(const uint32 index) const
+{
+	return Float3(_bodies.AngularVelocityX[index], _bodies.AngularVelocityY[index], _bodies.AngularVelocityZ[index]);
+}
+#pragma endregion PhysicsScene Public Property
+
+#pragma region PhysicsScene Protected Function
+/*!**********************************************************************
+*  @brief     Xebv̖{̂ł. xƈʒu̐ϕCPUFeature::GetActiveőI񂾖߃ZbgőSĂ̍̂܂Ƃ߂čs܂. @n
+*             Ă鍄̂MotionMask0őx0̂, ϕĂl͕ς܂.
+*  @param[in] const float ԍ [s]
+*  @param[in] gu::ThreadPool* Xbhv[ (nullptȑꍇ͌ĂяõXbhōs܂)
+*  @return    void
+*************************************************************************/
+void PhysicsScene::Step(const float deltaTime, ThreadPool* threadPool)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Physics);
+	if (deltaTime <= 0.0f || _bodies.Size() == 0) { return; }
+
+	const uint8 simd = static_cast<uint8>(CPUFeature::GetActive());
+
+	UpdatePairs(deltaTime);
+
+	UpdateContacts(threadPool);
+
+	INTEGRATE_VELOCITIES_FUNCTIONS[simd](_bodies, deltaTime, _desc.Gravity);
+
+	_islandBuilder.Build(static_cast<uint32>(_bodies.Size()), _bodies.InverseMass.Data(), _bodies.IsAwake.Data(),
+		_manifolds.Data(), static_cast<uint32>(_manifolds.Size()));
+
+	SolveAllIslands(deltaTime, threadPool);
+
+	INTEGRATE_POSITIONS_FUNCTIONS[simd](_bodies, deltaTime);
+}
+
+/*!**********************************************************************
+*  @brief     NĂ鍄̂̃vLVړ, L{bNXdȂĂ鍄̂̑gXV܂. @n
+*             u[htF[Y͑}ꂽvLV܂ޑgԂ, ÕXebv̑ĝ @n
+*             L{bNX܂dȂĂ̂ƍ킹, ̂̃CfbNX̏ɕׂ܂.
+*  @param[in] const float ԍ [s] (ړʂ̗\Ɏgp܂)
+*  @return    void
+*************************************************************************/
+void PhysicsScene::UpdatePairs(const float deltaTime)
+{
+	/*-------------------------------------------------------------------
+	-      NĂ鍄̂̃vLVړ
+	---------------------------------------------------------------------*/
+	const uint32 bodyCount = static_cast<uint32>(_bodies.Size());
+	for (uint32 i = 0; i < bodyCount; ++i)
+	{
+		if (!_bodies.IsAwake[i]) { continue; }
+
+		const Float3 displacement(_bodies.LinearVelocityX[i] * deltaTime, _bodies.LinearVelocityY[i] * deltaTime, _bodies.LinearVelocityZ[i] * deltaTime);
+		_broadphase.MoveProxy(_bodies.ProxyID[i], ComputeBounds(i), displacement);
+	}
+
+	_broadphasePairs.Clear();
+	_broadphase.UpdatePairs(_broadphasePairs);
+
+	/*-------------------------------------------------------------------
+	-      Vĝ̃CfbNX̃L[ɂĕׂ (ÓIȍ̓m͏)
+	---------------------------------------------------------------------*/
+	_newPairKeys.Clear();
+	for (uint64 i = 0; i < _broadphasePairs.Size(); ++i)
+	{
+		const uint32 a = static_cast<uint32>(_broadphase.GetUserData(_broadphasePairs[i].ProxyA));
+		const uint32 b = static_cast<uint32>(_broadphase.GetUserData(_broadphasePairs[i].ProxyB));
+		if (_bodies.InverseMass[a] <= 0.0f && _bodies.InverseMass[b] <= 0.0f) { continue; }
+
+		_newPairKeys.Push(MakePairKey(a, b));
+	}
+
+	if (!_newPairKeys.IsEmpty())
+	{
+		if (_sortBuffer.Size() < _newPairKeys.Size()) { _sortBuffer.Resize(_newPairKeys.Size()); }
+		gm::Sort<uint64>::RadixSort(&_newPairKeys[0], _newPairKeys.Size(), &_sortBuffer[0]);
+	}
+
+	/*-------------------------------------------------------------------
+	-      ÕXebv̑g (܂dȂĂ) ƕ
+	---------------------------------------------------------------------*/
+	_mergedKeys.Clear();
+	_mergedKeys.Reserve(_pairKeys.Size() + _newPairKeys.Size());
+
+	uint64 oldIndex = 0, newIndex = 0;
+	while (oldIndex < _pairKeys.Size() || newIndex < _newPairKeys.Size())
+	{
+		uint64 key = 0;
+		if (newIndex >= _newPairKeys.Size() || (oldIndex < _pairKeys.Size() && _pairKeys[oldIndex] < _newPairKeys[newIndex]))
+		{
+			key = _pairKeys[oldIndex++];
+
+			const uint32 a = static_cast<uint32>(key >> 32);
+			const uint32 b = static_cast<uint32>(key & 0xFFFFFFFF);
+			if (!_broadphase.TestOverlap(_bodies.ProxyID[a], _bodies.ProxyID[b])) { continue; }
+		}
+		else
+		{
+			key = _newPairKeys[newIndex++];
+		}
+
+		if (_mergedKeys.IsEmpty() || _mergedKeys.Back() != key)
+		{
+			_mergedKeys.Push(key);
+		}
+	}
+
+	std::swap(_pairKeys, _mergedKeys);
+}
+
+/*!**********************************************************************
+*  @brief     SĂ̑g̐ڐG_𐶐܂. gA͈͂ɕă^XNƂɂ܂Ƃ߂Ĕ肵, ͈͂̏ɘA邽, @n
+*             }jtH[h̓Xbhɂ炸g̏ɕт܂.
+*  @param[in] gu::ThreadPool* Xbhv[
+*  @return    void
+*************************************************************************/
+void PhysicsScene::UpdateContacts(ThreadPool* threadPool)
+{
+	std::swap(_manifolds, _oldManifolds);
+	_manifolds.Clear();
+
+	/*-------------------------------------------------------------------
+	-      i[tF[Y̓͂ƂȂ郏[hԂ̌`, ̂Ƃ1x܂
+	---------------------------------------------------------------------*/
+	const uint32 bodyCount = static_cast<uint32>(_bodies.Size());
+	_shapes.Clear();
+	_shapes.Resize(bodyCount, false);
+	for (uint32 i = 0; i < bodyCount; ++i) { _shapes[i] = GetShape(i); }
+
+	const uint64 pairCount   = _pairKeys.Size();
+	const uint32 threadCount = threadPool ? threadPool->GetThreadCount() : 1;
+
+	uint64 taskCount = 1;
+	if (threadCount > 1 && pairCount >= 2ull * MIN_PAIRS_PER_TASK)
+	{
+		taskCount = static_cast<uint64>(threadCount) * TASKS_PER_THREAD;
+		if (taskCount > pairCount / MIN_PAIRS_PER_TASK) { taskCount = pairCount / MIN_PAIRS_PER_TASK; }
+	}
+	if (_narrowphases.Size() < taskCount) { _narrowphases.Resize(taskCount); }
+
+	if (taskCount == 1)
+	{
+		CollidePairs(0, pairCount, _narrowphases[0]);
+	}
+	else
+	{
+		std::vector<std::future<void>> futures;
+		futures.reserve(taskCount);
+		for (uint64 task = 0; task < taskCount; ++task)
+		{
+			const uint64 begin = pairCount * task       / taskCount;
+			const uint64 end   = pairCount * (task + 1) / taskCount;
+			BatchedNarrowphase* narrowphase = &_narrowphases[task];
+			futures.push_back(threadPool->Submit([this, begin, end, narrowphase]()
+			{
+				CollidePairs(begin, end, *narrowphase);
+			}));
+		}
+		for (auto& future : futures) { future.get(); }
+	}
+
+	/*-------------------------------------------------------------------
+	-      ^XNƂ̌ʂA܂
+	---------------------------------------------------------------------*/
+	uint64 totalCount = 0;
+	for (uint64 task = 0; task < taskCount; ++task) { totalCount += _narrowphases[task].GetManifoldCount(); }
+
+	_manifolds.Resize(totalCount, false);
+	uint64 offset = 0;
+	for (uint64 task = 0; task < taskCount; ++task)
+	{
+		const BatchedNarrowphase& narrowphase = _narrowphases[task];
+		if (narrowphase.GetManifoldCount() == 0) { continue; }
+
+		Memory::Copy(&_manifolds[offset], narrowphase.GetManifolds(), narrowphase.GetManifoldCount() * sizeof(ContactManifold));
+		offset += narrowphase.GetManifoldCount();
+	}
+}
+
+/*!**********************************************************************
+*  @brief     g͈̔͂̐ڐG_𐶐܂. ǂNĂȂg͑ÕXebv̏Ԃ̂܂ܖĂ邽ߔ΂܂. @n
+*             ͌`̑gݍ킹Ƃɂ܂Ƃ߂BatchedNarrowphaseōs, o͂͑g̏̂܂܋l߂܂. @n
+*             ÕXebvɓg̃}jtH[h, IDvڐG_̗͐ςp܂(EH[X^[g).
+*  @param[in]  const gu::uint64 g͈̔͂̐擪
+*  @param[in]  const gu::uint64 g͈̔͂̏I[
+*  @param[out] collision::BatchedNarrowphase& Ɏgp, ʂێi[tF[Y
+*  @return     void
+*************************************************************************/
+void PhysicsScene::CollidePairs(const uint64 begin, const uint64 end, BatchedNarrowphase& narrowphase) const
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Physics);
+	narrowphase.Begin();
+	for (uint64 i = begin; i < end; ++i)
+	{
+		const uint64 key = _pairKeys[i];
+		const uint32 a   = static_cast<uint32>(key >> 32);
+		const uint32 b   = static_cast<uint32>(key & 0xFFFFFFFF);
+		if (!_bodies.IsAwake[a] && !_bodies.IsAwake[b]) { continue; }
+
+		narrowphase.AddPair(a, b);
+	}
+	narrowphase.Collide(_shapes.Data());
+
+	const uint64     oldCount      = _oldManifolds.Size();
+	const uint32     manifoldCount = narrowphase.GetManifoldCount();
+	ContactManifold* manifolds     = narrowphase.GetManifolds();
+	for (uint32 i = 0; i < manifoldCount; ++i)
+	{
+		ContactManifold& manifold = manifolds[i];
+		const uint64     key      = (static_cast<uint64>(manifold.BodyA) << 32) | manifold.BodyB;
+
+		/*-------------------------------------------------------------------
+		-      ÕXebṽ}jtH[h񕪒T (g̏ɕł܂)
+		---------------------------------------------------------------------*/
+		uint64 low = 0, high = oldCount;
+		while (low < high)
+		{
+			const uint64 middle = (low + high) / 2;
+			const uint64 middleKey = (static_cast<uint64>(_oldManifolds[middle].BodyA) << 32) | _oldManifolds[middle].BodyB;
+			if (middleKey < key) { low  = middle + 1; }
+			else                 { high = middle; }
+		}
+
+		if (low >= oldCount || _oldManifolds[low].BodyA != manifold.BodyA || _oldManifolds[low].BodyB != manifold.BodyB) { continue; }
+
+		const ContactManifold& old = _oldManifolds[low];
+		for (uint32 p = 0; p < manifold.PointCount; ++p)
+		{
+			// IDv_D悵, ΍ł߂_g܂
+			uint32 match           = old.PointCount;
+			float  closestDistance = WARM_START_DISTANCE * WARM_START_DISTANCE;
+			for (uint32 q = 0; q < old.PointCount; ++q)
+			{
+				if (old.Points[q].FeatureID == manifold.Points[p].FeatureID) { match = q; break; }
+
+				const float distance = LengthSquared(Subtract(old.Points[q].Position, manifold.Points[p].Position));
+				if (distance < closestDistance)
+				{
+					closestDistance = distance;
+					match           = q;
+				}
+			}
+			if (match == old.PointCount) { continue; }
+
+			manifold.Points[p].NormalImpulse   = old.Points[match].NormalImpulse;
+			manifold.Points[p].TangentImpulse1 = old.Points[match].TangentImpulse1;
+			manifold.Points[p].TangentImpulse2 = old.Points[match].TangentImpulse2;
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     SĂ̓܂. A͈͂ɕ, d(̐ + }jtH[h)قړȂ悤Ƀ^XN֊蓖Ă܂. @n
+*             1̓1̃^XNŉ, SĂ̍̂q傫ȓ͕ɂȂ܂.
+*  @param[in] const float ԍ [s]
+*  @param[in] gu::ThreadPool* Xbhv[
+*  @return    void
+*************************************************************************/
+void PhysicsScene::SolveAllIslands(const float deltaTime, ThreadPool* threadPool)
+{
+	const uint32 islandCount = _islandBuilder.GetIslandCount();
+	if (islandCount == 0) { return; }
+
+	if (_solverIndices.Size() < _bodies.Size()) { _solverIndices.Resize(_bodies.Size()); }
+
+	uint64 totalWork = 0;
+	for (uint32 i = 0; i < islandCount; ++i)
+	{
+		totalWork += _islandBuilder.GetIsland(i).BodyCount + _islandBuilder.GetIsland(i).ManifoldCount;
+	}
+
+	const uint32 threadCount = threadPool ? threadPool->GetThreadCount() : 1;
+	uint64 taskCount = static_cast<uint64>(threadCount) * TASKS_PER_THREAD;
+	if (taskCount > totalWork / MIN_SOLVER_WORK_PER_TASK) { taskCount = totalWork / MIN_SOLVER_WORK_PER_TASK; }
+	if (taskCount > islandCount)                          { taskCount = islandCount; }
+
+	if (threadCount <= 1 || taskCount <= 1)
+	{
+		if (_solvers.IsEmpty()) { _solvers.Resize(1); }
+		SolveIslands(0, islandCount, _solvers[0], deltaTime);
+		return;
+	}
+
+	if (_solvers.Size() < taskCount) { _solvers.Resize(taskCount); }
+
+	/*-------------------------------------------------------------------
+	-      dʂ̗ݐςtotalWork * task / taskCount𒴂ŋ؂
+	---------------------------------------------------------------------*/
+	std::vector<std::future<void>> futures;
+	futures.reserve(taskCount);
+
+	uint32 begin = 0;
+	uint64 work  = 0;
+	for (uint64 task = 0; task < taskCount && begin < islandCount; ++task)
+	{
+		const uint64 target = totalWork * (task + 1) / taskCount;
+		uint32 end = begin;
+		while (end < islandCount && (work < target || end == begin))
+		{
+			work += _islandBuilder.GetIsland(end).BodyCount + _islandBuilder.GetIsland(end).ManifoldCount;
+			++end;
+		}
+		if (task + 1 == taskCount) { end = islandCount; }
+
+		ContactSolver* solver = &_solvers[task];
+		futures.push_back(threadPool->Submit([this, begin, end, solver, deltaTime]()
+		{
+			SolveIslands(begin, end, *solver, deltaTime);
+		}));
+		begin = end;
+	}
+	for (auto& future : futures) { future.get(); }
+}
+
+/*!**********************************************************************
+*  @brief     ͈̔͂̍S, Ƃɖ邩ǂ߂܂. @n
+*             ̑SĂ̍̂Î~Ă鎞ԂTimeToSleep𒴂ꍇ͓Ɩ点, łȂΓƋN܂. @n
+*             Ă̂NĂ鍄̂ƐڐGēɓ, ̎_ŋN܂.
+*  @param[in] const gu::uint32 ͈̔͂̐擪
+*  @param[in] const gu::uint32 ͈̔͂̏I[
+*  @param[in] dynamics::ContactSolver& \o[
+*  @param[in] const float ԍ [s]
+*  @return    void
+*************************************************************************/
+void PhysicsScene::SolveIslands(const uint32 begin, const uint32 end, ContactSolver& solver, const float deltaTime)
+{
+	MEMORY_TAG_SCOPE(MemoryTag::Physics);
+	ContactSolverSettings settings = {};
+	settings.TimeStep           = deltaTime;
+	settings.VelocityIterations = _desc.VelocityIterations;
+	settings.BaumgarteFactor    = _desc.BaumgarteFactor;
+	settings.LinearSlop         = _desc.LinearSlop;
+
+	const float sleepLinear2  = _desc.SleepLinearVelocity  * _desc.SleepLinearVelocity;
+	const float sleepAngular2 = _desc.SleepAngularVelocity * _desc.SleepAngularVelocity;
+
+	const uint32* islandBodies    = _islandBuilder.GetBodies();
+	const uint32* islandManifolds = _islandBuilder.GetManifolds();
+	RigidBodyArray& b = _bodies;
+
+	for (uint32 islandIndex = begin; islandIndex < end; ++islandIndex)
+	{
+		const Island& island = _islandBuilder.GetIsland(islandIndex);
+
+		/*-------------------------------------------------------------------
+		-      ̍̂ƍS\o[֎ʂ
+		---------------------------------------------------------------------*/
+		solver.Begin();
+		for (uint32 i = 0; i < island.BodyCount; ++i)
+		{
+			const uint32 body = islandBodies[island.BodyOffset + i];
+
+			SolverBody solverBody = {};
+			solverBody.LinearVelocity    = Float3(b.LinearVelocityX [body], b.LinearVelocityY [body], b.LinearVelocityZ [body]);
+			solverBody.AngularVelocity   = Float3(b.AngularVelocityX[body], b.AngularVelocityY[body], b.AngularVelocityZ[body]);
+			solverBody.Position          = Float3(b.PositionX[body], b.PositionY[body], b.PositionZ[body]);
+			solverBody.InverseMass       = b.InverseMass[body];
+			solverBody.InverseInertia.XX = b.InverseInertiaXX[body];
+			solverBody.InverseInertia.YY = b.InverseInertiaYY[body];
+			solverBody.InverseInertia.ZZ = b.InverseInertiaZZ[body];
+			solverBody.InverseInertia.XY = b.InverseInertiaXY[body];
+			solverBody.InverseInertia.XZ = b.InverseInertiaXZ[body];
+			solverBody.InverseInertia.YZ = b.InverseInertiaYZ[body];
+			_solverIndices[body] = solver.AddBody(solverBody);
+		}
+
+		for (uint32 i = 0; i < island.ManifoldCount; ++i)
+		{
+			ContactManifold& manifold = _manifolds[islandManifolds[island.ManifoldOffset + i]];
+			const uint32 a = manifold.BodyA;
+			const uint32 c = manifold.BodyB;
+
+			// ÓIȍ͎̂ʂƊe\0̂, SĂ̐ÓIȍ̂Ń\o[̃CfbNX0L܂
+			const uint32 localA = b.InverseMass[a] > 0.0f ? _solverIndices[a] : 0;
+			const uint32 localB = b.InverseMass[c] > 0.0f ? _solverIndices[c] : 0;
+
+			solver.AddManifold(&manifold, localA, localB, std::sqrt(b.Friction[a] * b.Friction[c]));
+		}
+
+		solver.Solve(settings);
+
+		/*-------------------------------------------------------------------
+		-      x߂, ̍ŏ̐Î~Ԃ߂
+		---------------------------------------------------------------------*/
+		float minSleepTime = FLT_MAX;
+		for (uint32 i = 0; i < island.BodyCount; ++i)
+		{
+			const uint32      body       = islandBodies[island.BodyOffset + i];
+			const SolverBody& solverBody = solver.GetBody(_solverIndices[body]);
+			b.LinearVelocityX [body] = solverBody.LinearVelocity.x;
+			b.LinearVelocityY [body] = solverBody.LinearVelocity.y;
+			b.LinearVelocityZ [body] = solverBody.LinearVelocity.z;
+			b.AngularVelocityX[body] = solverBody.AngularVelocity.x;
+			b.AngularVelocityY[body] = solverBody.AngularVelocity.y;
+			b.AngularVelocityZ[body] = solverBody.AngularVelocity.z;
+
+			if (LengthSquared(solverBody.LinearVelocity) > sleepLinear2 || LengthSquared(solverBody.AngularVelocity) > sleepAngular2)
+			{
+				b.SleepTime[body] = 0.0f;
+			}
+			else
+			{
+				b.SleepTime[body] += deltaTime;
+			}
+			minSleepTime = b.SleepTime[body] < minSleepTime ? b.SleepTime[body] : minSleepTime;
+		}
+
+		/*-------------------------------------------------------------------
+		-      Ɩ点, ܂͋N
+		---------------------------------------------------------------------*/
+		const bool isSleeping = minSleepTime >= _desc.TimeToSleep;
+		for (uint32 i = 0; i < island.BodyCount; ++i)
+		{
+			const uint32 body = islandBodies[island.BodyOffset + i];
+			SetAwake(body, !isSleeping);
+			if (!isSleeping) { continue; }
+
+			b.LinearVelocityX [body] = 0.0f; b.LinearVelocityY [body] = 0.0f; b.LinearVelocityZ [body] = 0.0f;
+			b.AngularVelocityX[body] = 0.0f; b.AngularVelocityY[body] = 0.0f; b.AngularVelocityZ[body] = 0.0f;
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̂̃[hԂ̋E{bNXvZ܂.
+*  @param[in] const gu::uint32 ̂̃CfbNX
+*  @return    geometry::AABB E{bNX
+*************************************************************************/
+AABB PhysicsScene::ComputeBounds(const uint32 index) const
+{
+	const Float3 center(_bodies.PositionX[index], _bodies.PositionY[index], _bodies.PositionZ[index]);
+	const float  radius = _bodies.Radius[index];
+
+	switch (_bodies.ShapeType[index])
+	{
+		case GeometryType::AABB:
+		case GeometryType::OBB:
+		{
+			Float3 axes[3] = {};
+			ToAxes(GetOrientation(index), axes);
+
+			const Float3& h = _bodies.HalfExtents[index];
+			const Float3 extents(
+				std::fabs(axes[0].x) * h.x + std::fabs(axes[1].x) * h.y + std::fabs(axes[2].x) * h.z,
+				std::fabs(axes[0].y) * h.x + std::fabs(axes[1].y) * h.y + std::fabs(axes[2].y) * h.z,
+				std::fabs(axes[0].z) * h.x + std::fabs(axes[1].z) * h.y + std::fabs(axes[2].z) * h.z);
+			return AABB::FromCenterExtents(center, extents);
+		}
+		case GeometryType::Capsule:
+		{
+			const Float3 axis = Rotate(GetOrientation(index), Float3(0.0f, _bodies.HalfHeight[index], 0.0f));
+			return AABB::FromCenterExtents(center, Float3(std::fabs(axis.x) + radius, std::fabs(axis.y) + radius, std::fabs(axis.z) + radius));
+		}
+		default:
+		{
+			return AABB::FromCenterExtents(center, Float3(radius, radius, radius));
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̂̌`[hԂ̐ڐGp̌`ɂ܂.
+*  @param[in] const gu::uint32 ̂̃CfbNX
+*  @return    collision::CollisionShape `
+*************************************************************************/
+CollisionShape PhysicsScene::GetShape(const uint32 index) const
+{
+	CollisionShape shape = {};
+	shape.Type        = _bodies.ShapeType[index];
+	shape.Position    = GetPosition(index);
+	shape.Orientation = GetOrientation(index);
+	shape.HalfExtents = _bodies.HalfExtents[index];
+	shape.Radius      = _bodies.Radius[index];
+	shape.HalfHeight  = _bodies.HalfHeight[index];
+	return shape;
+}
+
+/*!**********************************************************************
+*  @brief     NĂ邩ύX, MotionMaskXV܂. ÓIȍ̂͏ɖĂ鈵ł.
+*  @param[in] const gu::uint32 ̂̃CfbNX
+*  @param[in] const bool NĂ邩
+*  @return    void
+*************************************************************************/
+void PhysicsScene::SetAwake(const uint32 index, const bool isAwake)
+{
+	const bool isDynamic = _bodies.InverseMass[index] > 0.0f;
+	_bodies.IsAwake   [index] = isAwake && isDynamic;
+	_bodies.MotionMask[index] = isAwake && isDynamic ? 1.0f : 0.0f;
+}
+#pragma endregion PhysicsScene Protected Function
@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ContactSolver.hpp
+///  @brief  1̓̐ڐGS𒀎CpX@(Sequential Impulse)ŉ܂. @n
+///          ̍̂͑xƎʂ̓AzɎʂĂ, ̓ƓɎsł܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_CONTACT_SOLVER_HPP
+#define PHYSICS_CONTACT_SOLVER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "PhysicsCore/Collision/Narrowphase/Include/ContactManifold.hpp"
+#include "PhysicsCore/Core/Private/Include/PhysicsMath.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::dynamics
+{
+	/****************************************************************************
+	*				  			   SolverBody
+	****************************************************************************/
+	/* @brief  \o[̂ł. ÓIȍ̂͋tʂƋte\0ɂ܂.
+	*****************************************************************************/
+	struct SolverBody
+	{
+		gm::Float3 LinearVelocity  = {};
+		gm::Float3 AngularVelocity = {};
+
+		/*! @brief [hԂ̏dSʒu (ڐG_܂ł̘řvZɎgp܂)*/
+		gm::Float3 Position = {};
+
+		float InverseMass = 0.0f;
+
+		/*! @brief [hԂ̋te\*/
+		details::math::SymmetricMatrix3 InverseInertia = {};
+	};
+
+	/****************************************************************************
+	*				  			   ContactSolverSettings
+	****************************************************************************/
+	/* @brief  \o[̐ݒł.
+	*****************************************************************************/
+	struct ContactSolverSettings
+	{
+		/*! @brief ԍ [s]*/
+		float TimeStep = 1.0f / 60.0f;
+
+		/*! @brief x̔*/
+		gu::uint32 VelocityIterations = 8;
+
+		/*! @brief ߂荞݂1XebvŖ߂ (Baumgarte艻)*/
+		float BaumgarteFactor = 0.2f;
+
+		/*! @brief ߂ɋe߂荞ݗ [m]*/
+		float LinearSlop = 0.005f;
+
+		/*! @brief ߂荞݂߂x̏ [m/s]*/
+		float MaxBiasVelocity = 4.0f;
+	};
+
+	/****************************************************************************
+	*				  			   ContactSolver
+	****************************************************************************/
+	/* @brief  Beginŏ, AddBodyAddManifoldœo^ĂSolveĂт܂. @n
+	*          CfbNX0̍̂͐ÓIȍ̂̑Ƃė\񂳂Ă, ܂ꂽx͖܂. @n
+	*          Solve̓}jtH[hɒ~ς͐ςǂŃEH[X^[g, ̗͐ς߂܂. @n
+*          Ɨp̔zg񂷂, Xbh(^XN)Ƃ1pӂĂ.
+	*****************************************************************************/
+	class ContactSolver
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     o^̂ƍSj, ÓIȍ̂̑ƂȂCfbNX0̍̂ǉ܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Begin();
+
+		/*!**********************************************************************
+		*  @brief     ̂ǉ܂.
+		*  @param[in] const SolverBody& 
+		*  @return    gu::uint32 \o[̃CfbNX
+		*************************************************************************/
+		gu::uint32 AddBody(const SolverBody& body);
+
+		/*!**********************************************************************
+		*  @brief     }jtH[hSƂĒǉ܂. ÓIȍ̂̓CfbNX0w肵܂.
+		*  @param[in] collision::ContactManifold* }jtH[h (Solveŗ͐ς߂܂)
+		*  @param[in] const gu::uint32 ÃCfbNXB̃CfbNX
+		*  @param[in] const float CW
+		*  @return    void
+		*************************************************************************/
+		void AddManifold(collision::ContactManifold* manifold, const gu::uint32 bodyA, const gu::uint32 bodyB, const float friction);
+
+		/*!**********************************************************************
+		*  @brief     S, EH[X^[ǧɑx̔s, ͐ς}jtH[h֏߂܂.
+		*  @param[in] const ContactSolverSettings& ݒ
+		*  @return    void
+		*************************************************************************/
+		void Solve(const ContactSolverSettings& settings);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief  (Solvě͉xĂ܂)*/
+		__forceinline const SolverBody& GetBody(const gu::uint32 index) const { return _bodies[index]; }
+
+		/*! @brief o^̂̐ (CfbNX0܂݂܂)*/
+		__forceinline gu::uint64 GetBodyCount() const { return _bodies.Size(); }
+
+		/*! @brief o^S̐*/
+		__forceinline gu::uint64 GetConstraintCount() const { return _constraints.Size(); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		ContactSolver() = default;
+
+		~ContactSolver() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief ڐG_Ƃ̘r, L, ڕWxvZ܂*/
+		void PrepareConstraints(const ContactSolverSettings& settings);
+
+		/*! @brief ÕXebv̗͐ς̂ɉ܂*/
+		void WarmStart();
+
+		/*! @brief SĂ̍S1񂸂܂*/
+		void SolveVelocities();
+
+		/*! @brief ͐ς}jtH[h֏߂܂*/
+		void StoreImpulses();
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief ڐG_Ƃ̍S*/
+		struct ConstraintPoint
+		{
+			gm::Float3 ArmA = {};
+			gm::Float3 ArmB = {};
+			float NormalMass   = 0.0f;
+			float TangentMass1 = 0.0f;
+			float TangentMass2 = 0.0f;
+			float Bias         = 0.0f;
+			float NormalImpulse   = 0.0f;
+			float TangentImpulse1 = 0.0f;
+			float TangentImpulse2 = 0.0f;
+		};
+
+		/*! @brief }jtH[hƂ̍S*/
+		struct Constraint
+		{
+			collision::ContactManifold* Manifold = nullptr;
+			gu::uint32 BodyA = 0;
+			gu::uint32 BodyB = 0;
+			gm::Float3 Normal   = {};
+			gm::Float3 Tangent1 = {};
+			gm::Float3 Tangent2 = {};
+			float      Friction = 0.0f;
+			gu::uint32 PointCount = 0;
+			ConstraintPoint Points[collision::details::narrowphase::MAX_MANIFOLD_POINTS] = {};
+		};
+
+		/*! @brief */
+		gu::DynamicArray<SolverBody> _bodies = {};
+
+		/*! @brief S*/
+		gu::DynamicArray<Constraint> _constraints = {};
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,112 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   IslandBuilder.hpp
+///  @brief  ڐGŌqIȍ̂fWf[^\(Union-Find)œɂ܂Ƃ߂܂. @n
+///          m͍̂LȂ, ƂɓƗ()SƂł܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_ISLAND_BUILDER_HPP
+#define PHYSICS_ISLAND_BUILDER_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "PhysicsCore/Collision/Narrowphase/Include/ContactManifold.hpp"
+#include "GameUtility/Base/Include/GUClassUtility.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::dynamics
+{
+	/****************************************************************************
+	*				  			   Island
+	****************************************************************************/
+	/* @brief  Ɋ܂܂鍄̂ƃ}jtH[h͈̔͂ł. IslandBuilder::GetBodies, GetManifolds̔zw܂.
+	*****************************************************************************/
+	struct Island
+	{
+		gu::uint32 BodyOffset     = 0;
+		gu::uint32 BodyCount      = 0;
+		gu::uint32 ManifoldOffset = 0;
+		gu::uint32 ManifoldCount  = 0;
+	};
+
+	/****************************************************************************
+	*				  			   IslandBuilder
+	****************************************************************************/
+	/* @brief  Iȍ̓m̐ڐGō̂܂. ÓIȍ͕̂̓ɑ邱Ƃł邽ߌɎg܂. @n
+	*          \͏ɏCfbNXIԂ, ̏ԂƓ̒̍̂̏Ԃ͓͂ɑ΂ČIł.
+	*****************************************************************************/
+	class IslandBuilder : public gu::NonCopyable
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     쐬܂. NĂ铮Iȍ̂, }jtH[hɊ܂܂铮Iȍ̂ɓ܂. @n
+		*             }jtH[hBodyA, BodyB͍̂̃CfbNXwĂKv܂.
+		*  @param[in] const gu::uint32 ̂̐
+		*  @param[in] const float* ̂Ƃ̋t (0̏ꍇ͐ÓIȍ)
+		*  @param[in] const bool* ̂Ƃ̋NĂ邩
+		*  @param[in] const collision::ContactManifold* }jtH[h̔z
+		*  @param[in] const gu::uint32 }jtH[h̐
+		*  @return    void
+		*************************************************************************/
+		void Build(const gu::uint32 bodyCount, const float* inverseMasses, const bool* isAwake,
+			const collision::ContactManifold* manifolds, const gu::uint32 manifoldCount);
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief ̐*/
+		__forceinline gu::uint32 GetIslandCount() const { return static_cast<gu::uint32>(_islands.Size()); }
+
+		/*! @brief */
+		__forceinline const Island& GetIsland(const gu::uint32 index) const { return _islands[index]; }
+
+		/*! @brief Ƃɕׂ̂̃CfbNX*/
+		__forceinline const gu::uint32* GetBodies() const { return _bodies.Data(); }
+
+		/*! @brief Ƃɕׂ}jtH[h̃CfbNX*/
+		__forceinline const gu::uint32* GetManifolds() const { return _manifolds.Data(); }
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		IslandBuilder() = default;
+
+		~IslandBuilder() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief \߂܂ (oH)*/
+		gu::uint32 FindRoot(gu::uint32 index);
+
+		/*! @brief 2̏W܂. CfbNX\ɂ܂*/
+		void Unite(const gu::uint32 a, const gu::uint32 b);
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief e̍̂̃CfbNX*/
+		gu::DynamicArray<gu::uint32> _parents = {};
+
+		/*! @brief \Ƃ̓̃CfbNX (ɓȂꍇUINT32_MAX)*/
+		gu::DynamicArray<gu::uint32> _islandIndices = {};
+
+		/*! @brief */
+		gu::DynamicArray<Island> _islands = {};
+
+		/*! @brief Ƃɕׂ̂ƃ}jtH[h*/
+		gu::DynamicArray<gu::uint32> _bodies    = {};
+		gu::DynamicArray<gu::uint32> _manifolds = {};
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,269 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ContactSolver.cpp
+///  @brief  1̓̐ڐGS𒀎CpX@(Sequential Impulse)ŉ܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/ContactSolver.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics;
+using namespace physics::dynamics;
+using namespace physics::collision;
+using namespace physics::details::math;
+using namespace gu;
+
+namespace
+{
+	/*---------------------------------------------------------------
+			dւ̒Pʗ͐ςɑ΂Lʂ̋t
+			1/m_A + 1/m_B + dE((I_A^-1 (r_A x d)) x r_A) + dE((I_B^-1 (r_B x d)) x r_B)
+	-----------------------------------------------------------------*/
+	__forceinline float ComputeInverseEffectiveMass(const SolverBody& a, const SolverBody& b, const gm::Float3& armA, const gm::Float3& armB, const gm::Float3& d)
+	{
+		const gm::Float3 crossA = Cross(armA, d);
+		const gm::Float3 crossB = Cross(armB, d);
+		return a.InverseMass + b.InverseMass
+			+ Dot(crossA, a.InverseInertia.Multiply(crossA))
+			+ Dot(crossB, b.InverseInertia.Multiply(crossB));
+	}
+
+	/*---------------------------------------------------------------
+			ڐG_łBɑ΂ȂΑxł͂Ȃ, Aɑ΂B̑Αx (@ŗ)
+	-----------------------------------------------------------------*/
+	__forceinline gm::Float3 ComputeRelativeVelocity(const SolverBody& a, const SolverBody& b, const gm::Float3& armA, const gm::Float3& armB)
+	{
+		const gm::Float3 velocityA = Add(a.LinearVelocity, Cross(a.AngularVelocity, armA));
+		const gm::Float3 velocityB = Add(b.LinearVelocity, Cross(b.AngularVelocity, armB));
+		return Subtract(velocityB, velocityA);
+	}
+
+	/*---------------------------------------------------------------
+			͐PA-P, B+PƂĉ܂
+	-----------------------------------------------------------------*/
+	__forceinline void ApplyImpulse(SolverBody& a, SolverBody& b, const gm::Float3& armA, const gm::Float3& armB, const gm::Float3& impulse)
+	{
+		a.LinearVelocity  = MultiplyAdd(a.LinearVelocity, impulse, -a.InverseMass);
+		a.AngularVelocity = Subtract(a.AngularVelocity, a.InverseInertia.Multiply(Cross(armA, impulse)));
+		b.LinearVelocity  = MultiplyAdd(b.LinearVelocity, impulse,  b.InverseMass);
+		b.AngularVelocity = Add(b.AngularVelocity, b.InverseInertia.Multiply(Cross(armB, impulse)));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     o^̂ƍSj, ÓIȍ̂̑ƂȂCfbNX0̍̂ǉ܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void ContactSolver::Begin()
+{
+	_bodies.Clear();
+	_constraints.Clear();
+	_bodies.Push(SolverBody());
+}
+
+/*!**********************************************************************
+*  @brief     ̂ǉ܂.
+*  @param[in] const SolverBody& 
+*  @return    gu::uint32 \o[̃CfbNX
+*************************************************************************/
+uint32 ContactSolver::AddBody(const SolverBody& body)
+{
+	_bodies.Push(body);
+	return static_cast<uint32>(_bodies.Size() - 1);
+}
+
+/*!**********************************************************************
+*  @brief     }jtH[hSƂĒǉ܂. ÓIȍ̂̓CfbNX0w肵܂.
+*  @param[in] collision::ContactManifold* }jtH[h
+*  @param[in] const gu::uint32 ÃCfbNXB̃CfbNX
+*  @param[in] const float CW
+*  @return    void
+*************************************************************************/
+void ContactSolver::AddManifold(ContactManifold* manifold, const uint32 bodyA, const uint32 bodyB, const float friction)
+{
+	Check(manifold);
+	Check(bodyA < _bodies.Size() && bodyB < _bodies.Size());
+
+	Constraint constraint = {};
+	constraint.Manifold   = manifold;
+	constraint.BodyA      = bodyA;
+	constraint.BodyB      = bodyB;
+	constraint.Friction   = friction;
+	constraint.PointCount = manifold->PointCount;
+	_constraints.Push(constraint);
+}
+
+/*!**********************************************************************
+*  @brief     S, EH[X^[ǧɑx̔s, ͐ς}jtH[h֏߂܂.
+*  @param[in] const ContactSolverSettings& ݒ
+*  @return    void
+*************************************************************************/
+void ContactSolver::Solve(const ContactSolverSettings& settings)
+{
+	if (_constraints.IsEmpty()) { return; }
+
+	PrepareConstraints(settings);
+	WarmStart();
+	for (uint32 i = 0; i < settings.VelocityIterations; ++i)
+	{
+		SolveVelocities();
+	}
+	StoreImpulses();
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     ڐG_Ƃ̘r, L, ڕWxvZ܂. @n
+*             ߂荞݂eʂ𒴂Baumgarte艻ŉ߂, Ă铊@IȐڐG_ @n
+*             ̃XebvŐڐG鑬x܂ł̐ڋ߂܂.
+*************************************************************************/
+void ContactSolver::PrepareConstraints(const ContactSolverSettings& settings)
+{
+	const float inverseTimeStep = settings.TimeStep > 0.0f ? 1.0f / settings.TimeStep : 0.0f;
+
+	for (uint64 c = 0; c < _constraints.Size(); ++c)
+	{
+		Constraint&            constraint = _constraints[c];
+		const ContactManifold& manifold   = *constraint.Manifold;
+		const SolverBody&      a          = _bodies[constraint.BodyA];
+		const SolverBody&      b          = _bodies[constraint.BodyB];
+
+		constraint.Normal = manifold.Normal;
+		ComputeBasis(constraint.Normal, constraint.Tangent1, constraint.Tangent2);
+
+		for (uint32 p = 0; p < constraint.PointCount; ++p)
+		{
+			const ContactPoint& contact = manifold.Points[p];
+			ConstraintPoint&    point   = constraint.Points[p];
+
+			point.ArmA = Subtract(contact.Position, a.Position);
+			point.ArmB = Subtract(contact.Position, b.Position);
+
+			const float normalK   = ComputeInverseEffectiveMass(a, b, point.ArmA, point.ArmB, constraint.Normal);
+			const float tangentK1 = ComputeInverseEffectiveMass(a, b, point.ArmA, point.ArmB, constraint.Tangent1);
+			const float tangentK2 = ComputeInverseEffectiveMass(a, b, point.ArmA, point.ArmB, constraint.Tangent2);
+			point.NormalMass   = normalK   > 0.0f ? 1.0f / normalK   : 0.0f;
+			point.TangentMass1 = tangentK1 > 0.0f ? 1.0f / tangentK1 : 0.0f;
+			point.TangentMass2 = tangentK2 > 0.0f ? 1.0f / tangentK2 : 0.0f;
+
+			if (contact.Penetration < 0.0f)
+			{
+				point.Bias = contact.Penetration * inverseTimeStep;
+			}
+			else
+			{
+				const float bias = settings.BaumgarteFactor * inverseTimeStep * (contact.Penetration - settings.LinearSlop);
+				point.Bias = bias < 0.0f ? 0.0f : (bias > settings.MaxBiasVelocity ? settings.MaxBiasVelocity : bias);
+			}
+
+			point.NormalImpulse   = contact.NormalImpulse;
+			point.TangentImpulse1 = contact.TangentImpulse1;
+			point.TangentImpulse2 = contact.TangentImpulse2;
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ÕXebv̗͐ς̂ɉ܂. Î~Ăςݏd˂ł, 񐔂ȂĂԂn߂܂.
+*************************************************************************/
+void ContactSolver::WarmStart()
+{
+	for (uint64 c = 0; c < _constraints.Size(); ++c)
+	{
+		const Constraint& constraint = _constraints[c];
+		SolverBody& a = _bodies[constraint.BodyA];
+		SolverBody& b = _bodies[constraint.BodyB];
+
+		for (uint32 p = 0; p < constraint.PointCount; ++p)
+		{
+			const ConstraintPoint& point = constraint.Points[p];
+			gm::Float3 impulse = Scale(constraint.Normal, point.NormalImpulse);
+			impulse = MultiplyAdd(impulse, constraint.Tangent1, point.TangentImpulse1);
+			impulse = MultiplyAdd(impulse, constraint.Tangent2, point.TangentImpulse2);
+			ApplyImpulse(a, b, point.ArmA, point.ArmB, impulse);
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     SĂ̍S1񂸂܂. C͒O̖@̗͐ςŏ߂邽, @ɉ܂.
+*************************************************************************/
+void ContactSolver::SolveVelocities()
+{
+	for (uint64 c = 0; c < _constraints.Size(); ++c)
+	{
+		Constraint& constraint = _constraints[c];
+		SolverBody& a = _bodies[constraint.BodyA];
+		SolverBody& b = _bodies[constraint.BodyB];
+
+		/*-------------------------------------------------------------------
+		-      C : 2̐ڐƗɃN[̉~̓ڎlpŐ܂
+		---------------------------------------------------------------------*/
+		for (uint32 p = 0; p < constraint.PointCount; ++p)
+		{
+			ConstraintPoint& point = constraint.Points[p];
+			const float maxFriction = constraint.Friction * point.NormalImpulse;
+
+			const gm::Float3 relativeVelocity = ComputeRelativeVelocity(a, b, point.ArmA, point.ArmB);
+
+			const float lambda1     = -point.TangentMass1 * Dot(relativeVelocity, constraint.Tangent1);
+			const float newImpulse1 = std::fmax(-maxFriction, std::fmin(point.TangentImpulse1 + lambda1, maxFriction));
+			const float delta1      = newImpulse1 - point.TangentImpulse1;
+			point.TangentImpulse1   = newImpulse1;
+
+			const float lambda2     = -point.TangentMass2 * Dot(relativeVelocity, constraint.Tangent2);
+			const float newImpulse2 = std::fmax(-maxFriction, std::fmin(point.TangentImpulse2 + lambda2, maxFriction));
+			const float delta2      = newImpulse2 - point.TangentImpulse2;
+			point.TangentImpulse2   = newImpulse2;
+
+			ApplyImpulse(a, b, point.ArmA, point.ArmB, Add(Scale(constraint.Tangent1, delta1), Scale(constraint.Tangent2, delta2)));
+		}
+
+		/*-------------------------------------------------------------------
+		-      @ : ̑ΑxڕWxȏɂȂ悤, ~ς͐ς0ȏɐ܂
+		---------------------------------------------------------------------*/
+		for (uint32 p = 0; p < constraint.PointCount; ++p)
+		{
+			ConstraintPoint& point = constraint.Points[p];
+
+			const float normalVelocity = Dot(ComputeRelativeVelocity(a, b, point.ArmA, point.ArmB), constraint.Normal);
+			const float lambda     = -point.NormalMass * (normalVelocity - point.Bias);
+			const float newImpulse = std::fmax(point.NormalImpulse + lambda, 0.0f);
+			const float delta      = newImpulse - point.NormalImpulse;
+			point.NormalImpulse    = newImpulse;
+
+			ApplyImpulse(a, b, point.ArmA, point.ArmB, Scale(constraint.Normal, delta));
+		}
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ͐ς}jtH[h֏߂܂. ̃XebvœID̐ڐG_΃EH[X^[gɎgp܂.
+*************************************************************************/
+void ContactSolver::StoreImpulses()
+{
+	for (uint64 c = 0; c < _constraints.Size(); ++c)
+	{
+		const Constraint& constraint = _constraints[c];
+		for (uint32 p = 0; p < constraint.PointCount; ++p)
+		{
+			ContactPoint& contact   = constraint.Manifold->Points[p];
+			contact.NormalImpulse   = constraint.Points[p].NormalImpulse;
+			contact.TangentImpulse1 = constraint.Points[p].TangentImpulse1;
+			contact.TangentImpulse2 = constraint.Points[p].TangentImpulse2;
+		}
+	}
+}
+#pragma endregion Protected Function
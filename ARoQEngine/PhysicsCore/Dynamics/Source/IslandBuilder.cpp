@@ -0,0 +1,171 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   IslandBuilder.cpp
+///  @brief  ڐGŌqIȍ̂fWf[^\(Union-Find)œɂ܂Ƃ߂܂.
+///  @author toide
+///  @date   2026/10/20 8:02:15
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/IslandBuilder.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics;
+using namespace physics::dynamics;
+using namespace physics::collision;
+using namespace gu;
+
+namespace
+{
+	/*! @brief ɓȂ*/
+	constexpr uint32 NO_ISLAND = 0xFFFFFFFF;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     쐬܂. NĂ铮Iȍ̂, }jtH[hɊ܂܂铮Iȍ̂ɓ܂.
+*  @param[in] const gu::uint32 ̂̐
+*  @param[in] const float* ̂Ƃ̋t (0̏ꍇ͐ÓIȍ)
+*  @param[in] const bool* ̂Ƃ̋NĂ邩
+*  @param[in] const collision::ContactManifold* }jtH[h̔z
+*  @param[in] const gu::uint32 }jtH[h̐
+*  @return    void
+*************************************************************************/
+void IslandBuilder::Build(const uint32 bodyCount, const float* inverseMasses, const bool* isAwake,
+	const ContactManifold* manifolds, const uint32 manifoldCount)
+{
+	_islands  .Clear();
+	_bodies   .Clear();
+	_manifolds.Clear();
+
+	/*-------------------------------------------------------------------
+	-      SĂ̍̂PƂ̏WƂ, Iȍ̓m̐ڐGŌ
+	---------------------------------------------------------------------*/
+	_parents.Clear();
+	_parents.Resize(bodyCount, false);
+	for (uint32 i = 0; i < bodyCount; ++i) { _parents[i] = i; }
+
+	// }jtH[hɊ܂܂鍄͖̂ĂĂɓ (NĂ鍄̂ɐGꂽꍇɋN)
+	_islandIndices.Clear();
+	_islandIndices.Resize(bodyCount, true, NO_ISLAND);
+	constexpr uint32 IN_CONTACT = NO_ISLAND - 1;
+
+	for (uint32 i = 0; i < manifoldCount; ++i)
+	{
+		const uint32 a = manifolds[i].BodyA;
+		const uint32 b = manifolds[i].BodyB;
+		const bool isDynamicA = inverseMasses[a] > 0.0f;
+		const bool isDynamicB = inverseMasses[b] > 0.0f;
+
+		if (isDynamicA) { _islandIndices[a] = IN_CONTACT; }
+		if (isDynamicB) { _islandIndices[b] = IN_CONTACT; }
+		if (isDynamicA && isDynamicB) { Unite(a, b); }
+	}
+
+	// \̒l͓̔ԍŏ㏑邪, NO_ISLANDȊOł邱Ƃ͕ςȂ
+	const auto IsIncluded = [&](const uint32 index)
+	{
+		return inverseMasses[index] > 0.0f && (isAwake[index] || _islandIndices[index] != NO_ISLAND);
+	};
+
+	/*-------------------------------------------------------------------
+	-      \Ƃɓ̔ԍ蓖, ̂̐𐔂
+	---------------------------------------------------------------------*/
+	for (uint32 i = 0; i < bodyCount; ++i)
+	{
+		if (!IsIncluded(i)) { continue; }
+
+		const uint32 root = FindRoot(i);
+
+		// \͏ɏW̍ŏ̃CfbNXȂ̂, iOɏĂ
+		if (root == i)
+		{
+			_islandIndices[i] = static_cast<uint32>(_islands.Size());
+			_islands.Push(Island());
+		}
+		_islands[_islandIndices[root]].BodyCount++;
+	}
+
+	for (uint32 i = 0; i < manifoldCount; ++i)
+	{
+		const uint32 a = manifolds[i].BodyA;
+		Check(inverseMasses[a] > 0.0f || inverseMasses[manifolds[i].BodyB] > 0.0f);
+
+		const uint32 root = FindRoot(inverseMasses[a] > 0.0f ? a : manifolds[i].BodyB);
+		_islands[_islandIndices[root]].ManifoldCount++;
+	}
+
+	/*-------------------------------------------------------------------
+	-      v\[gœƂɍ̂ƃ}jtH[hׂ
+	---------------------------------------------------------------------*/
+	uint32 bodyOffset = 0, manifoldOffset = 0;
+	for (uint64 i = 0; i < _islands.Size(); ++i)
+	{
+		_islands[i].BodyOffset     = bodyOffset;
+		_islands[i].ManifoldOffset = manifoldOffset;
+		bodyOffset     += _islands[i].BodyCount;
+		manifoldOffset += _islands[i].ManifoldCount;
+		_islands[i].BodyCount     = 0;
+		_islands[i].ManifoldCount = 0;
+	}
+
+	_bodies   .Resize(bodyOffset, false);
+	_manifolds.Resize(manifoldOffset, false);
+
+	for (uint32 i = 0; i < bodyCount; ++i)
+	{
+		if (!IsIncluded(i)) { continue; }
+
+		Island& island = _islands[_islandIndices[FindRoot(i)]];
+		_bodies[island.BodyOffset + island.BodyCount++] = i;
+	}
+
+	for (uint32 i = 0; i < manifoldCount; ++i)
+	{
+		const uint32 a = manifolds[i].BodyA;
+		const uint32 root = FindRoot(inverseMasses[a] > 0.0f ? a : manifolds[i].BodyB);
+
+		Island& island = _islands[_islandIndices[root]];
+		_manifolds[island.ManifoldOffset + island.ManifoldCount++] = i;
+	}
+}
+#pragma endregion Public Function
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     \߂܂. Hr̍̂̐ecɕtւ(oH), ȍ~̒TZ܂.
+*  @param[in] gu::uint32 ̂̃CfbNX
+*  @return    gu::uint32 \
+*************************************************************************/
+uint32 IslandBuilder::FindRoot(uint32 index)
+{
+	while (_parents[index] != index)
+	{
+		_parents[index] = _parents[_parents[index]];
+		index           = _parents[index];
+	}
+	return index;
+}
+
+/*!**********************************************************************
+*  @brief     2̏W܂. CfbNX\ɂ邽, ʂ͌̏ԂɈˑ܂.
+*  @param[in] const gu::uint32 A
+*  @param[in] const gu::uint32 B
+*  @return    void
+*************************************************************************/
+void IslandBuilder::Unite(const uint32 a, const uint32 b)
+{
+	const uint32 rootA = FindRoot(a);
+	const uint32 rootB = FindRoot(b);
+	if (rootA == rootB) { return; }
+
+	if (rootA < rootB) { _parents[rootB] = rootA; }
+	else               { _parents[rootA] = rootB; }
+}
+#pragma endregion Protected Function
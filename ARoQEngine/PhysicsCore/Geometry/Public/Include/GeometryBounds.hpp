@@ -0,0 +1,170 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   GeometryBounds.hpp
+///  @brief  u[htF[YȂǂŎgpŏ_, ő_ŕ\sE{bNX, eWIǧvZ`܂.
+///  @author toide
+///  @date   2026/10/20 6:10:42
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_GEOMETRY_BOUNDS_HPP
+#define PHYSICS_GEOMETRY_BOUNDS_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GeometrySphere.hpp"
+#include "GeometryBox.hpp"
+#include "GeometryCapsule.hpp"
+#include "GameUtility/Math/Include/GMVector.hpp"
+#include <cmath>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::geometry
+{
+	/****************************************************************************
+	*				  			   AABB
+	****************************************************************************/
+	/* @brief  [hԂ̎sE{bNXł. gm::BoundingBoxƈقȂ, ŏ_ƍő_ŕێ܂. @n
+	*          aWܔpɂɍsu[htF[Ył, ̕\̕ZȂς݂܂.
+	*****************************************************************************/
+	struct AABB
+	{
+		/*! @brief ŏ_*/
+		gm::Float3 Min = {};
+
+		/*! @brief ő_*/
+		gm::Float3 Max = {};
+
+		#pragma region Public Function
+		/*! @brief 2̃{bNXdȂĂ邩 (ڂĂꍇ܂݂܂)*/
+		__forceinline bool Overlaps(const AABB& other) const
+		{
+			return Min.x <= other.Max.x && other.Min.x <= Max.x
+				&& Min.y <= other.Max.y && other.Min.y <= Max.y
+				&& Min.z <= other.Max.z && other.Min.z <= Max.z;
+		}
+
+		/*! @brief w肵{bNXSɊ܂ł邩*/
+		__forceinline bool Contains(const AABB& other) const
+		{
+			return Min.x <= other.Min.x && other.Max.x <= Max.x
+				&& Min.y <= other.Min.y && other.Max.y <= Max.y
+				&& Min.z <= other.Min.z && other.Max.z <= Max.z;
+		}
+
+		/*! @brief \ʐ. q̃{bNXeɊ܂܂mɔႷ邽, SAH̃RXgɎgp܂*/
+		__forceinline float GetSurfaceArea() const
+		{
+			const float dx = Max.x - Min.x;
+			const float dy = Max.y - Min.y;
+			const float dz = Max.z - Min.z;
+			return 2.0f * (dx * dy + dy * dz + dz * dx);
+		}
+
+		/*! @brief S*/
+		__forceinline gm::Float3 GetCenter() const
+		{
+			return gm::Float3(0.5f * (Min.x + Max.x), 0.5f * (Min.y + Max.y), 0.5f * (Min.z + Max.z));
+		}
+
+		/*! @brief Seʂ܂ł̋*/
+		__forceinline gm::Float3 GetExtents() const
+		{
+			return gm::Float3(0.5f * (Max.x - Min.x), 0.5f * (Max.y - Min.y), 0.5f * (Max.z - Min.z));
+		}
+
+		/*! @brief SĂ̕marginL{bNX*/
+		__forceinline AABB Expand(const float margin) const
+		{
+			return AABB(gm::Float3(Min.x - margin, Min.y - margin, Min.z - margin),
+				        gm::Float3(Max.x + margin, Max.y + margin, Max.z + margin));
+		}
+
+		/*! @brief 2̃{bNX܂ލŏ̃{bNX*/
+		__forceinline static AABB Union(const AABB& a, const AABB& b)
+		{
+			return AABB(gm::Float3(a.Min.x < b.Min.x ? a.Min.x : b.Min.x, a.Min.y < b.Min.y ? a.Min.y : b.Min.y, a.Min.z < b.Min.z ? a.Min.z : b.Min.z),
+				        gm::Float3(a.Max.x > b.Max.x ? a.Max.x : b.Max.x, a.Max.y > b.Max.y ? a.Max.y : b.Max.y, a.Max.z > b.Max.z ? a.Max.z : b.Max.z));
+		}
+
+		/*! @brief SƊe̔̒쐬܂*/
+		__forceinline static AABB FromCenterExtents(const gm::Float3& center, const gm::Float3& extents)
+		{
+			return AABB(gm::Float3(center.x - extents.x, center.y - extents.y, center.z - extents.z),
+				        gm::Float3(center.x + extents.x, center.y + extents.y, center.z + extents.z));
+		}
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		AABB() = default;
+
+		AABB(const gm::Float3& min, const gm::Float3& max) : Min(min), Max(max) {}
+		#pragma endregion
+	};
+
+	/*!**********************************************************************
+	*  @brief     ̃[hԂ̋E{bNXvZ܂.
+	*  @param[in] const GeometrySphere& 
+	*  @param[in] const gm::Float3& S
+	*  @return    AABB
+	*************************************************************************/
+	__forceinline AABB ComputeAABB(const GeometrySphere& sphere, const gm::Float3& center)
+	{
+		return AABB::FromCenterExtents(center, gm::Float3(sphere.Radius));
+	}
+
+	/*!**********************************************************************
+	*  @brief     s{bNX̃[hԂ̋E{bNXvZ܂.
+	*  @param[in] const GeometryAABB& {bNX
+	*  @param[in] const gm::Float3& S
+	*  @return    AABB
+	*************************************************************************/
+	__forceinline AABB ComputeAABB(const GeometryAABB& box, const gm::Float3& center)
+	{
+		return AABB::FromCenterExtents(center, box.HalfExtents);
+	}
+
+	/*!**********************************************************************
+	*  @brief     L{bNX̃[hԂ̋E{bNXvZ܂. e̔̒]̎̐ΒlŎˉe܂.
+	*  @param[in] const GeometryOBB& {bNX
+	*  @param[in] const gm::Float3& S
+	*  @param[in] const gm::Float3* {bNX̃[JX, Y, Z̃[hԂł̌ (3vf, Kς)
+	*  @return    AABB
+	*************************************************************************/
+	__forceinline AABB ComputeAABB(const GeometryOBB& box, const gm::Float3& center, const gm::Float3* axes)
+	{
+		const gm::Float3& h = box.HalfExtents;
+		const gm::Float3 extents
+		(
+			std::abs(axes[0].x) * h.x + std::abs(axes[1].x) * h.y + std::abs(axes[2].x) * h.z,
+			std::abs(axes[0].y) * h.x + std::abs(axes[1].y) * h.y + std::abs(axes[2].y) * h.z,
+			std::abs(axes[0].z) * h.x + std::abs(axes[1].z) * h.y + std::abs(axes[2].z) * h.z
+		);
+		return AABB::FromCenterExtents(center, extents);
+	}
+
+	/*!**********************************************************************
+	*  @brief     JvZ̃[hԂ̋E{bNXvZ܂.
+	*  @param[in] const GeometryCapsule& JvZ
+	*  @param[in] const gm::Float3& S
+	*  @param[in] const gm::Float3& 2̔̒SԎ̃[hԂł̌ (Kς)
+	*  @return    AABB
+	*************************************************************************/
+	__forceinline AABB ComputeAABB(const GeometryCapsule& capsule, const gm::Float3& center, const gm::Float3& axis)
+	{
+		const gm::Float3 extents
+		(
+			std::abs(axis.x) * capsule.HalfHeight + capsule.Radius,
+			std::abs(axis.y) * capsule.HalfHeight + capsule.Radius,
+			std::abs(axis.z) * capsule.HalfHeight + capsule.Radius
+		);
+		return AABB::FromCenterExtents(center, extents);
+	}
+}
+
+#endif
@@ -0,0 +1,319 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   SceneQueryBVH.hpp
+///  @brief  CLXgƃ{bNX̃XC[vsÓIBVHł. @n
+///          AN^[̋E{bNX܂͎Op`̏WrSAHňx\z, \z͕ύX܂. @n
+///          1{̒T, 4{(SSE2)/8{(AVX2)̃C܂Ƃ߂ĒTpPbgT, @n
+///          ł߂(ClosestHit)Ƃꂩ̌(AnyHit, ̎ՕȂ)߂܂.
+///  @author toide
+///  @date   2026/10/20 9:14:37
+//////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#ifndef PHYSICS_SCENE_QUERY_BVH_HPP
+#define PHYSICS_SCENE_QUERY_BVH_HPP
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "PhysicsCore/Geometry/Public/Include/GeometryBounds.hpp"
+#include "GameUtility/Container/Include/GUDynamicArray.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+namespace gu
+{
+	class ThreadPool;
+}
+
+namespace physics::query::details::bvh
+{
+	/*! @brief Ƃ\v~eBuID*/
+	constexpr gu::uint32 INVALID_PRIMITIVE = 0xFFFFFFFF;
+
+	/*! @brief tɊ܂߂ő̃v~eBu*/
+	constexpr gu::uint32 MAX_LEAF_PRIMITIVES = 4;
+
+	/*! @brief ʒuTƂ̃r̐*/
+	constexpr gu::uint32 BIN_COUNT = 16;
+
+	/*! @brief SAH̕ső̐[. [؂͐Ŕɕ, [}܂*/
+	constexpr gu::uint32 MAX_SAH_DEPTH = 64;
+
+	/*! @brief TŎgpX^bN̗vf (MAX_SAH_DEPTH + Ŕɕ[32)*/
+	constexpr gu::uint32 STACK_CAPACITY = 128;
+
+	/*! @brief 1̃pPbgTł܂Ƃ߂郌C̍ő吔 (AVX28[)*/
+	constexpr gu::uint32 MAX_PACKET_SIZE = 8;
+
+	/*! @brief 1^XN̍ŏ̃C̐. 菭Ȃꍇ͕܂*/
+	constexpr gu::uint32 MIN_RAYS_PER_TASK = 256;
+
+	/*! @brief Xbh̃^XN (CƂ̒TԂ̂΂ς܂)*/
+	constexpr gu::uint32 TASKS_PER_THREAD = 4;
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                               Class
+//////////////////////////////////////////////////////////////////////////////////
+namespace physics::query
+{
+	/****************************************************************************
+	*				  			   QueryPrimitiveType
+	****************************************************************************/
+	/* @brief  BVH̗tɊi[v~eBu̎ނł.
+	*****************************************************************************/
+	enum class QueryPrimitiveType : gu::uint8
+	{
+		AABB,     //!< AN^[̋E{bNX
+		Triangle, //!< Op` ({bNX̃XC[vɂ͎gpł܂)
+	};
+
+	/****************************************************************************
+	*				  			   RaycastMode
+	****************************************************************************/
+	/* @brief  ̋ߕł.
+	*****************************************************************************/
+	enum class RaycastMode : gu::uint8
+	{
+		ClosestHit, //!< ł߂߂܂
+		AnyHit,     //!< ŏɌŒTł؂܂ (ՂĂ邩̔Ȃ)
+	};
+
+	/****************************************************************************
+	*				  			   RayTraversal
+	****************************************************************************/
+	/* @brief  ܂Ƃ߂ĒTꍇ̒T@ł.
+	*****************************************************************************/
+	enum class RayTraversal : gu::uint8
+	{
+		Single, //!< 1{T܂. ΂΂ȃCɌĂ܂
+		Packet, //!< A4{/8{1̃pPbgƂĒT܂. J̃CȂ, CɌĂ܂
+	};
+
+	/****************************************************************************
+	*				  			   QueryRay
+	****************************************************************************/
+	/* @brief  Cł.  Origin + Direction * t (0 <= t < MaxDistance) ͈̔͂ŋ߂܂. @n
+	*          Direction𐳋Kꍇ, t̓[hԂ̋ɂȂ܂.
+	*****************************************************************************/
+	struct QueryRay
+	{
+		/*! @brief n_*/
+		gm::Float3 Origin = {};
+
+		/*! @brief */
+		gm::Float3 Direction = gm::Float3(0.0f, 0.0f, 1.0f);
+
+		/*! @brief ő̋*/
+		float MaxDistance = 1e30f;
+	};
+
+	/****************************************************************************
+	*				  			   QueryHit
+	****************************************************************************/
+	/* @brief  ̌ʂł. ȂꍇPrimitiveIDINVALID_PRIMITIVE, DistanceMaxDistanceɂȂ܂.
+	*****************************************************************************/
+	struct QueryHit
+	{
+		/*! @brief v~eBu, \zɓnz̃CfbNX*/
+		gu::uint32 PrimitiveID = details::bvh::INVALID_PRIMITIVE;
+
+		/*! @brief ܂ł̃C̃p[^t*/
+		float Distance = 0.0f;
+
+		/*! @brief C̎n_Pʖ@. n_{bNX̓ɂꍇ̓C̋tł*/
+		gm::Float3 Normal = {};
+
+		/*! @brief */
+		__forceinline bool IsHit() const { return PrimitiveID != details::bvh::INVALID_PRIMITIVE; }
+	};
+
+	/****************************************************************************
+	*				  			   QueryBVHNode
+	****************************************************************************/
+	/* @brief  32bytẽm[hł. m[h2̎q͔zŗאڂĊi[܂.
+	*****************************************************************************/
+	struct QueryBVHNode
+	{
+		/*! @brief {bNX̍ŏ_*/
+		gm::Float3 Min = {};
+
+		/*! @brief m[h̏ꍇ͍̎q̃CfbNX(E̎q+1), t̏ꍇ͐擪̃v~eBu*/
+		gu::uint32 LeftOrFirst = 0;
+
+		/*! @brief {bNX̍ő_*/
+		gm::Float3 Max = {};
+
+		/*! @brief t̃v~eBu (m[h0)*/
+		gu::uint16 PrimitiveCount = 0;
+
+		/*! @brief m[h𕪊 (0 : x, 1 : y, 2 : z). ̎q̑̕ł*/
+		gu::uint16 SplitAxis = 0;
+
+		/*! @brief t*/
+		__forceinline bool IsLeaf() const { return PrimitiveCount > 0; }
+	};
+
+	/****************************************************************************
+	*				  			   QueryTriangle
+	****************************************************************************/
+	/* @brief  (Moller-Trumbore)p, 1̒_2̕ӂŕێOp`ł.
+	*****************************************************************************/
+	struct QueryTriangle
+	{
+		gm::Float3 Vertex0 = {};
+		gm::Float3 Edge1   = {};
+		gm::Float3 Edge2   = {};
+	};
+
+	/****************************************************************************
+	*				  			   SceneQueryBVH
+	****************************************************************************/
+	/* @brief  \z͓ǂݎ肾̂, SĂ̒T֐𕡐̃Xbh瓯ɌĂяo܂. @n
+	*          pPbgT1{̒T͓gp邽, ClosestHit͈̋v܂. @n
+	*          (ŕ̃v~eBuƌꍇ, ǂ̃v~eBuԂ͒Tɂ܂)
+	*****************************************************************************/
+	class SceneQueryBVH
+	{
+	public:
+		#pragma region Public Function
+		/*!**********************************************************************
+		*  @brief     AN^[̋E{bNXBVH\z܂. ȑO̓e͔j܂.
+		*  @param[in] const geometry::AABB* E{bNX̔z
+		*  @param[in] const gu::uint32 E{bNX̐
+		*  @return    void
+		*************************************************************************/
+		void BuildFromBounds(const geometry::AABB* bounds, const gu::uint32 count);
+
+		/*!**********************************************************************
+		*  @brief     Op`̏WBVH\z܂. ȑO̓e͔j܂.
+		*  @param[in] const gm::Float3* _̔z
+		*  @param[in] const gu::uint32* Op`Ƃ3̒_CfbNXׂz
+		*  @param[in] const gu::uint32 Op`̐
+		*  @return    void
+		*************************************************************************/
+		void BuildFromTriangles(const gm::Float3* vertices, const gu::uint32* indices, const gu::uint32 triangleCount);
+
+		/*!**********************************************************************
+		*  @brief     1{̃CT܂.
+		*  @param[in]  const QueryRay& C
+		*  @param[in]  const RaycastMode ̋ߕ
+		*  @param[out] QueryHit& 
+		*  @return     bool ꍇtrue
+		*************************************************************************/
+		bool Raycast(const QueryRay& ray, const RaycastMode mode, QueryHit& hit) const;
+
+		/*!**********************************************************************
+		*  @brief     ő8{̃CpPbgƂĒT܂. CPUFeature::GetActiveAVX2̏ꍇ8{, SSE2, SSE4.1̏ꍇ4{, @n
+		*             Scalaȑꍇ1{T܂. Ăق, m[h̔LłđȂ܂.
+		*  @param[in]  const QueryRay* C̔z
+		*  @param[in]  const gu::uint32 C̐ (MAX_PACKET_SIZEȉ)
+		*  @param[in]  const RaycastMode ̋ߕ
+		*  @param[out] QueryHit* ʂ̔z
+		*  @return     void
+		*************************************************************************/
+		void RaycastPacket(const QueryRay* rays, const gu::uint32 count, const RaycastMode mode, QueryHit* hits) const;
+
+		/*!**********************************************************************
+		*  @brief     ̃C܂Ƃ߂ĒT܂. CA͈͂ɕ, Xbhv[̃^XNƂĕɒT܂. @n
+		*             pPbgT̏ꍇ, zŘA8{pPbgɂ܂.
+		*  @param[in]  const QueryRay* C̔z
+		*  @param[in]  const gu::uint32 C̐
+		*  @param[in]  const RaycastMode ̋ߕ
+		*  @param[out] QueryHit* ʂ̔z
+		*  @param[in]  gu::ThreadPool* Xbhv[ (nullptȑꍇ͌ĂяõXbhŒT܂)
+		*  @param[in]  const RayTraversal T@
+		*  @return     void
+		*************************************************************************/
+		void RaycastBatch(const QueryRay* rays, const gu::uint32 count, const RaycastMode mode, QueryHit* hits,
+			gu::ThreadPool* threadPool = nullptr, const RayTraversal traversal = RayTraversal::Packet) const;
+
+		/*!**********************************************************************
+		*  @brief     ɕsȃ{bNXCɉĈړ, ŏɐڐGAN^[߂܂. @n
+		*             {bNXm̃~RtXL[a͑傫𑫂{bNX̂, E{bNX\zBVHł͐mł.
+		*  @param[in]  const QueryRay& {bNX̒S̈ړ
+		*  @param[in]  const gm::Float3& {bNX̊e̔̒
+		*  @param[in]  const RaycastMode ̋ߕ
+		*  @param[out] QueryHit&  (n_ŏdȂĂꍇ͋0)
+		*  @return     bool ڐGꍇtrue
+		*************************************************************************/
+		bool SweepBox(const QueryRay& ray, const gm::Float3& halfExtents, const RaycastMode mode, QueryHit& hit) const;
+
+		/*!**********************************************************************
+		*  @brief     傫̃{bNX̑̃XC[v܂Ƃ߂čs܂.
+		*  @param[in]  const QueryRay* {bNX̒S̈ړ̔z
+		*  @param[in]  const gu::uint32 XC[v̐
+		*  @param[in]  const gm::Float3& {bNX̊e̔̒
+		*  @param[in]  const RaycastMode ̋ߕ
+		*  @param[out] QueryHit* ʂ̔z
+		*  @param[in]  gu::ThreadPool* Xbhv[ (nullptȑꍇ͌ĂяõXbhŒT܂)
+		*  @return     void
+		*************************************************************************/
+		void SweepBoxBatch(const QueryRay* rays, const gu::uint32 count, const gm::Float3& halfExtents, const RaycastMode mode, QueryHit* hits,
+			gu::ThreadPool* threadPool = nullptr) const;
+
+		/*!**********************************************************************
+		*  @brief     SẴm[hƃv~eBuj܂. mۍς݂̔z͍ėp̂ߎc܂.
+		*  @param[in] void
+		*  @return    void
+		*************************************************************************/
+		void Clear();
+		#pragma endregion
+
+		#pragma region Public Property
+		/*! @brief v~eBu̎*/
+		__forceinline QueryPrimitiveType GetPrimitiveType() const { return _primitiveType; }
+
+		/*! @brief v~eBu̐*/
+		__forceinline gu::uint32 GetPrimitiveCount() const { return static_cast<gu::uint32>(_primitiveIDs.Size()); }
+
+		/*! @brief m[h̔z (0Ԃ)*/
+		__forceinline const gu::DynamicArray<QueryBVHNode>& GetNodes() const { return _nodes; }
+
+		/*! @brief */
+		__forceinline bool IsEmpty() const { return _nodes.IsEmpty(); }
+
+		/*! @brief Sm[h̕\ʐς̍v[g̕\ʐςŊl. قǒT؂ł*/
+		float GetAreaRatio() const;
+		#pragma endregion
+
+		#pragma region Public Constructor and Destructor
+		SceneQueryBVH() = default;
+
+		~SceneQueryBVH() = default;
+		#pragma endregion
+
+	protected:
+		#pragma region Protected Function
+		/*! @brief _buildBounds_buildCentersm[h\z, t̏Ƀv~eBuIDׂ܂*/
+		void Build(const gu::uint32 count);
+
+		/*! @brief _primitiveIDs[begin, end)̃v~eBunodeIndex̃m[h쐬, KvłΎq쐬܂*/
+		void BuildNode(const gu::uint32 nodeIndex, const gu::uint32 begin, const gu::uint32 end, const gu::uint32 depth);
+
+		/*! @brief t̏̃v~eBũCfbNX猋ʂ쐬܂*/
+		void MakeHit(const QueryRay& ray, const gm::Float3& extents, const gu::uint32 primitive, const float distance, QueryHit& hit) const;
+		#pragma endregion
+
+		#pragma region Protected Property
+		/*! @brief m[h*/
+		gu::DynamicArray<QueryBVHNode> _nodes = {};
+
+		/*! @brief t̏ɕׂv~eBu (ނɉĂǂ炩gp܂)*/
+		gu::DynamicArray<geometry::AABB> _boxes     = {};
+		gu::DynamicArray<QueryTriangle>  _triangles = {};
+
+		/*! @brief t̏̃v~eBu, \zɓnz̃CfbNX*/
+		gu::DynamicArray<gu::uint32> _primitiveIDs = {};
+
+		/*! @brief v~eBu̎*/
+		QueryPrimitiveType _primitiveType = QueryPrimitiveType::AABB;
+
+		/*! @brief \zgpv~eBűE{bNXƒS*/
+		gu::DynamicArray<geometry::AABB> _buildBounds  = {};
+		gu::DynamicArray<gm::Float3>     _buildCenters = {};
+		#pragma endregion
+	};
+}
+
+#endif
@@ -0,0 +1,1112 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   SceneQueryBVH.cpp
+///  @brief  CLXgƃ{bNX̃XC[vsÓIBVHł. @n
+///          pPbgŤ1{̒TƓԂŉZ܂(FMA͎gp܂).
+///  @author toide
+///  @date   2026/10/20 9:14:37
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "../Include/SceneQueryBVH.hpp"
+#include "PhysicsCore/Core/Private/Include/PhysicsMath.hpp"
+#include "GameUtility/Base/Include/GUAssert.hpp"
+#include "GameUtility/Math/Include/GMCPUFeature.hpp"
+#include "GameUtility/Math/Private/Simd/Include/GMSimdMacros.hpp"
+#include "GameUtility/Thread/Public/Include/GUThreadPool.hpp"
+#include <cmath>
+#include <cfloat>
+#include <vector>
+#include <future>
+#if PLATFORM_CPU_X86_FAMILY
+#include <immintrin.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace physics;
+using namespace physics::query;
+using namespace physics::query::details::bvh;
+using namespace physics::details::math;
+using namespace physics::geometry;
+using namespace gm;
+using namespace gu;
+
+namespace
+{
+	/*! @brief XȕőɊ|W. ۂߌ덷Ń{bNX̋ĚƂȂ悤, 킸ɍL܂*/
+	constexpr float SLAB_TOLERANCE = 1.0000004f;
+
+	/*! @brief Op`ƕsƂ݂Ȃs񎮂̑傫*/
+	constexpr float PARALLEL_EPSILON = 1e-12f;
+
+	/*! @brief SAHŃm[h1ǂRXg (v~eBuƂ̌1Ƃ)*/
+	constexpr float TRAVERSAL_COST = 1.0f;
+
+	/*---------------------------------------------------------------
+			TQƂBVH̔z
+	-----------------------------------------------------------------*/
+	struct TraversalData
+	{
+		const QueryBVHNode*  Nodes;
+		const AABB*          Boxes;
+		const QueryTriangle* Triangles;
+		QueryPrimitiveType   PrimitiveType;
+	};
+
+	using PacketFunction = void(*)(const TraversalData& data, const QueryRay* rays, const uint32 count, const RaycastMode mode, float* distances, uint32* primitives);
+
+	/*---------------------------------------------------------------
+			x, y, zCfbNXŎo܂
+	-----------------------------------------------------------------*/
+	__forceinline float GetComponent(const gm::Float3& v, const uint32 i)
+	{
+		return i == 0 ? v.x : (i == 1 ? v.y : v.z);
+	}
+
+	__forceinline float Min(const float a, const float b) { return a < b ? a : b; }
+	__forceinline float Max(const float a, const float b) { return a > b ? a : b; }
+
+	/*---------------------------------------------------------------
+			̋t. 0͔̐ɏlɒu, XuNaNoȂ悤ɂ܂
+	-----------------------------------------------------------------*/
+	__forceinline float SafeInverse(const float d)
+	{
+		return 1.0f / (std::fabs(d) < 1e-20f ? (d < 0.0f ? -1e-20f : 1e-20f) : d);
+	}
+
+	/*---------------------------------------------------------------
+			Xu. ꍇ͓̋tNearɕԂ܂
+	-----------------------------------------------------------------*/
+	__forceinline bool IntersectSlabs(const gm::Float3& min, const gm::Float3& max, const gm::Float3& origin, const gm::Float3& inverse, float& tNear, float& tFar)
+	{
+		const float t1x = (min.x - origin.x) * inverse.x, t2x = (max.x - origin.x) * inverse.x;
+		const float t1y = (min.y - origin.y) * inverse.y, t2y = (max.y - origin.y) * inverse.y;
+		const float t1z = (min.z - origin.z) * inverse.z, t2z = (max.z - origin.z) * inverse.z;
+
+		tNear = Max(Max(Min(t1x, t2x), Min(t1y, t2y)), Min(t1z, t2z));
+		tFar  = Min(Min(Max(t1x, t2x), Max(t1y, t2y)), Max(t1z, t2z));
+		return tNear <= tFar * SLAB_TOLERANCE && tFar >= 0.0f;
+	}
+
+	/*---------------------------------------------------------------
+			Op`Ƃ̌ (Moller-Trumbore)
+	-----------------------------------------------------------------*/
+	__forceinline bool IntersectTriangle(const QueryTriangle& triangle, const gm::Float3& origin, const gm::Float3& direction, const float tMax, float& t)
+	{
+		const gm::Float3 p   = Cross(direction, triangle.Edge2);
+		const float      det = Dot(triangle.Edge1, p);
+		if (std::fabs(det) < PARALLEL_EPSILON) { return false; }
+
+		const float      inverseDet = 1.0f / det;
+		const gm::Float3 s          = Subtract(origin, triangle.Vertex0);
+		const float      u          = Dot(s, p) * inverseDet;
+		if (u < 0.0f || u > 1.0f) { return false; }
+
+		const gm::Float3 q = Cross(s, triangle.Edge1);
+		const float      v = Dot(direction, q) * inverseDet;
+		if (v < 0.0f || u + v > 1.0f) { return false; }
+
+		t = Dot(triangle.Edge2, q) * inverseDet;
+		return t >= 0.0f && t < tMax;
+	}
+
+	/*---------------------------------------------------------------
+			1{̃C(extents0ȊȌꍇ̓{bNX)Ŗ؂T, t̏̃v~eBũCfbNXԂ܂.
+			q͓̋߂ɂǂ, q̓X^bNɓ̋Ƌɐς, Ɏ}肵܂
+	-----------------------------------------------------------------*/
+	uint32 TraverseSingle(const TraversalData& data, const QueryRay& ray, const gm::Float3& extents, const RaycastMode mode, float& distance)
+	{
+		struct StackEntry
+		{
+			uint32 Node;
+			float  Near;
+		};
+
+		const gm::Float3 inverse(SafeInverse(ray.Direction.x), SafeInverse(ray.Direction.y), SafeInverse(ray.Direction.z));
+		const QueryBVHNode* nodes = data.Nodes;
+
+		float  tMax      = ray.MaxDistance;
+		uint32 primitive = INVALID_PRIMITIVE;
+		distance = tMax;
+
+		const auto IntersectNode = [&](const QueryBVHNode& node, float& tNear)
+		{
+			float tFar = 0.0f;
+			return IntersectSlabs(Subtract(node.Min, extents), Add(node.Max, extents), ray.Origin, inverse, tNear, tFar) && tNear <= tMax;
+		};
+
+		float rootNear = 0.0f;
+		if (!IntersectNode(nodes[0], rootNear)) { return INVALID_PRIMITIVE; }
+
+		StackEntry stack[STACK_CAPACITY];
+		uint32     stackCount = 0;
+		uint32     current    = 0;
+		while (true)
+		{
+			const QueryBVHNode& node = nodes[current];
+			if (node.IsLeaf())
+			{
+				/*-------------------------------------------------------------------
+				-      t̃v~eBuƌ肵܂
+				---------------------------------------------------------------------*/
+				const uint32 end = node.LeftOrFirst + node.PrimitiveCount;
+				for (uint32 i = node.LeftOrFirst; i < end; ++i)
+				{
+					float t = 0.0f;
+					if (data.PrimitiveType == QueryPrimitiveType::Triangle)
+					{
+						if (!IntersectTriangle(data.Triangles[i], ray.Origin, ray.Direction, tMax, t)) { continue; }
+					}
+					else
+					{
+						float tFar = 0.0f;
+						if (!IntersectSlabs(Subtract(data.Boxes[i].Min, extents), Add(data.Boxes[i].Max, extents), ray.Origin, inverse, t, tFar)) { continue; }
+
+						t = Max(t, 0.0f);
+						if (!(t < tMax)) { continue; }
+					}
+
+					tMax      = t;
+					primitive = i;
+					if (mode == RaycastMode::AnyHit)
+					{
+						distance = tMax;
+						return primitive;
+					}
+				}
+			}
+			else
+			{
+				/*-------------------------------------------------------------------
+				-      ߂qɂǂ܂
+				---------------------------------------------------------------------*/
+				const uint32 left  = node.LeftOrFirst;
+				const uint32 right = left + 1;
+				float nearLeft = 0.0f, nearRight = 0.0f;
+				const bool isLeftHit  = IntersectNode(nodes[left] , nearLeft);
+				const bool isRightHit = IntersectNode(nodes[right], nearRight);
+				if (isLeftHit && isRightHit)
+				{
+					Check(stackCount < STACK_CAPACITY);
+					const bool isLeftNear = nearLeft <= nearRight;
+					stack[stackCount].Node = isLeftNear ? right : left;
+					stack[stackCount].Near = isLeftNear ? nearRight : nearLeft;
+					++stackCount;
+					current = isLeftNear ? left : right;
+					continue;
+				}
+				if (isLeftHit)  { current = left;  continue; }
+				if (isRightHit) { current = right; continue; }
+			}
+
+			/*-------------------------------------------------------------------
+			-      ݂̍ł߂Oɂq܂Ŗ߂܂
+			---------------------------------------------------------------------*/
+			bool isFound = false;
+			while (stackCount > 0)
+			{
+				const StackEntry& entry = stack[--stackCount];
+				if (entry.Near <= tMax)
+				{
+					current = entry.Node;
+					isFound = true;
+					break;
+				}
+			}
+			if (!isFound) { break; }
+		}
+
+		distance = tMax;
+		return primitive;
+	}
+
+	/*---------------------------------------------------------------
+			Scalar : pPbg̃C1{T܂
+	-----------------------------------------------------------------*/
+	void RaycastPacketScalar(const TraversalData& data, const QueryRay* rays, const uint32 count, const RaycastMode mode, float* distances, uint32* primitives)
+	{
+		for (uint32 i = 0; i < count; ++i)
+		{
+			primitives[i] = TraverseSingle(data, rays[i], gm::Float3(0.0f, 0.0f, 0.0f), mode, distances[i]);
+		}
+	}
+
+	/*---------------------------------------------------------------
+			pPbg̃CSoA`ɕׂ܂. C̐[ɖȂꍇ͍Ō̃C𕡐Ė߂܂
+	-----------------------------------------------------------------*/
+	struct PacketRays
+	{
+		alignas(32) float OriginX   [MAX_PACKET_SIZE];
+		alignas(32) float OriginY   [MAX_PACKET_SIZE];
+		alignas(32) float OriginZ   [MAX_PACKET_SIZE];
+		alignas(32) float DirectionX[MAX_PACKET_SIZE];
+		alignas(32) float DirectionY[MAX_PACKET_SIZE];
+		alignas(32) float DirectionZ[MAX_PACKET_SIZE];
+		alignas(32) float InverseX  [MAX_PACKET_SIZE];
+		alignas(32) float InverseY  [MAX_PACKET_SIZE];
+		alignas(32) float InverseZ  [MAX_PACKET_SIZE];
+		alignas(32) float MaxDistance[MAX_PACKET_SIZE];
+		alignas(32) int32 Primitive [MAX_PACKET_SIZE];
+
+		/*! @brief Ƃ, ̎q(̑̕)ɂǂ邩 (擪̃ČŌ߂܂)*/
+		bool IsLeftFirst[3];
+	};
+
+	void GatherPacket(const QueryRay* rays, const uint32 count, const uint32 width, PacketRays& packet)
+	{
+		for (uint32 k = 0; k < width; ++k)
+		{
+			const QueryRay& ray = rays[k < count ? k : count - 1];
+			packet.OriginX    [k] = ray.Origin.x;
+			packet.OriginY    [k] = ray.Origin.y;
+			packet.OriginZ    [k] = ray.Origin.z;
+			packet.DirectionX [k] = ray.Direction.x;
+			packet.DirectionY [k] = ray.Direction.y;
+			packet.DirectionZ [k] = ray.Direction.z;
+			packet.InverseX   [k] = SafeInverse(ray.Direction.x);
+			packet.InverseY   [k] = SafeInverse(ray.Direction.y);
+			packet.InverseZ   [k] = SafeInverse(ray.Direction.z);
+			packet.MaxDistance[k] = ray.MaxDistance;
+			packet.Primitive  [k] = static_cast<int32>(INVALID_PRIMITIVE);
+		}
+		for (uint32 axis = 0; axis < 3; ++axis)
+		{
+			packet.IsLeftFirst[axis] = GetComponent(rays[0].Direction, axis) >= 0.0f;
+		}
+	}
+
+	void ScatterPacket(const PacketRays& packet, const uint32 count, float* distances, uint32* primitives)
+	{
+		for (uint32 k = 0; k < count; ++k)
+		{
+			distances [k] = packet.MaxDistance[k];
+			primitives[k] = static_cast<uint32>(packet.Primitive[k]);
+		}
+	}
+
+#if PLATFORM_CPU_X86_FAMILY
+	#pragma region SSE2
+	/*---------------------------------------------------------------
+			SSE2 : 4{̃C1̃pPbgƂĒT܂
+	-----------------------------------------------------------------*/
+	struct PacketSSE2
+	{
+		__m128 OriginX, OriginY, OriginZ;
+		__m128 DirectionX, DirectionY, DirectionZ;
+		__m128 InverseX, InverseY, InverseZ;
+	};
+
+	__forceinline __m128 SelectSSE2(const __m128 mask, const __m128 a, const __m128 b)
+	{
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+	}
+
+	/*! @brief Xu. ߂l͌郌[̃}XN*/
+	__forceinline __m128 IntersectSlabsSSE2(const gm::Float3& min, const gm::Float3& max, const PacketSSE2& p, __m128& tNear)
+	{
+		const __m128 t1x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min.x), p.OriginX), p.InverseX);
+		const __m128 t2x = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max.x), p.OriginX), p.InverseX);
+		const __m128 t1y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min.y), p.OriginY), p.InverseY);
+		const __m128 t2y = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max.y), p.OriginY), p.InverseY);
+		const __m128 t1z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(min.z), p.OriginZ), p.InverseZ);
+		const __m128 t2z = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(max.z), p.OriginZ), p.InverseZ);
+
+		tNear = _mm_max_ps(_mm_max_ps(_mm_min_ps(t1x, t2x), _mm_min_ps(t1y, t2y)), _mm_min_ps(t1z, t2z));
+		const __m128 tFar = _mm_min_ps(_mm_min_ps(_mm_max_ps(t1x, t2x), _mm_max_ps(t1y, t2y)), _mm_max_ps(t1z, t2z));
+		return _mm_and_ps(_mm_cmple_ps(tNear, _mm_mul_ps(tFar, _mm_set1_ps(SLAB_TOLERANCE))), _mm_cmpge_ps(tFar, _mm_setzero_ps()));
+	}
+
+	__forceinline int32 IntersectNodeSSE2(const QueryBVHNode& node, const PacketSSE2& p, const __m128 tMax, const __m128 active)
+	{
+		__m128 tNear;
+		const __m128 mask = IntersectSlabsSSE2(node.Min, node.Max, p, tNear);
+		return _mm_movemask_ps(_mm_and_ps(_mm_and_ps(mask, _mm_cmple_ps(tNear, tMax)), active));
+	}
+
+	/*! @brief Op`Ƃ̌. ߂l͌郌[̃}XN*/
+	__forceinline __m128 IntersectTriangleSSE2(const QueryTriangle& triangle, const PacketSSE2& r, const __m128 tMax, __m128& t)
+	{
+		const __m128 e1x = _mm_set1_ps(triangle.Edge1.x), e1y = _mm_set1_ps(triangle.Edge1.y), e1z = _mm_set1_ps(triangle.Edge1.z);
+		const __m128 e2x = _mm_set1_ps(triangle.Edge2.x), e2y = _mm_set1_ps(triangle.Edge2.y), e2z = _mm_set1_ps(triangle.Edge2.z);
+
+		const __m128 px  = _mm_sub_ps(_mm_mul_ps(r.DirectionY, e2z), _mm_mul_ps(r.DirectionZ, e2y));
+		const __m128 py  = _mm_sub_ps(_mm_mul_ps(r.DirectionZ, e2x), _mm_mul_ps(r.DirectionX, e2z));
+		const __m128 pz  = _mm_sub_ps(_mm_mul_ps(r.DirectionX, e2y), _mm_mul_ps(r.DirectionY, e2x));
+		const __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)), _mm_mul_ps(e1z, pz));
+
+		const __m128 inverseDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+		const __m128 sx = _mm_sub_ps(r.OriginX, _mm_set1_ps(triangle.Vertex0.x));
+		const __m128 sy = _mm_sub_ps(r.OriginY, _mm_set1_ps(triangle.Vertex0.y));
+		const __m128 sz = _mm_sub_ps(r.OriginZ, _mm_set1_ps(triangle.Vertex0.z));
+		const __m128 u  = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(sx, px), _mm_mul_ps(sy, py)), _mm_mul_ps(sz, pz)), inverseDet);
+
+		const __m128 qx = _mm_sub_ps(_mm_mul_ps(sy, e1z), _mm_mul_ps(sz, e1y));
+		const __m128 qy = _mm_sub_ps(_mm_mul_ps(sz, e1x), _mm_mul_ps(sx, e1z));
+		const __m128 qz = _mm_sub_ps(_mm_mul_ps(sx, e1y), _mm_mul_ps(sy, e1x));
+		const __m128 v  = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(r.DirectionX, qx), _mm_mul_ps(r.DirectionY, qy)), _mm_mul_ps(r.DirectionZ, qz)), inverseDet);
+		t = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)), _mm_mul_ps(e2z, qz)), inverseDet);
+
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one  = _mm_set1_ps(1.0f);
+		__m128 mask = _mm_cmpnlt_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), det), _mm_set1_ps(PARALLEL_EPSILON));
+		mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpnlt_ps(u, zero), _mm_cmpngt_ps(u, one)));
+		mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpnlt_ps(v, zero), _mm_cmpngt_ps(_mm_add_ps(u, v), one)));
+		return _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(t, zero), _mm_cmplt_ps(t, tMax)));
+	}
+
+	void RaycastPacketSSE2(const TraversalData& data, const QueryRay* rays, const uint32 count, const RaycastMode mode, float* distances, uint32* primitives)
+	{
+		PacketRays packet;
+		GatherPacket(rays, count, 4, packet);
+
+		PacketSSE2 p = {};
+		p.OriginX    = _mm_load_ps(packet.OriginX);
+		p.OriginY    = _mm_load_ps(packet.OriginY);
+		p.OriginZ    = _mm_load_ps(packet.OriginZ);
+		p.DirectionX = _mm_load_ps(packet.DirectionX);
+		p.DirectionY = _mm_load_ps(packet.DirectionY);
+		p.DirectionZ = _mm_load_ps(packet.DirectionZ);
+		p.InverseX   = _mm_load_ps(packet.InverseX);
+		p.InverseY   = _mm_load_ps(packet.InverseY);
+		p.InverseZ   = _mm_load_ps(packet.InverseZ);
+
+		// Ė߂[͒T܂
+		__m128 active    = _mm_castsi128_ps(_mm_cmplt_epi32(_mm_set_epi32(3, 2, 1, 0), _mm_set1_epi32(static_cast<int32>(count))));
+		__m128 tMax      = _mm_load_ps(packet.MaxDistance);
+		__m128 primitive = _mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i*>(packet.Primitive)));
+
+		const QueryBVHNode* nodes = data.Nodes;
+		uint32 stack[STACK_CAPACITY];
+		uint32 stackCount = 0;
+		uint32 current    = 0;
+		bool   isVisiting = IntersectNodeSSE2(nodes[0], p, tMax, active) != 0;
+		while (isVisiting)
+		{
+			const QueryBVHNode& node = nodes[current];
+			if (node.IsLeaf())
+			{
+				const uint32 end = node.LeftOrFirst + node.PrimitiveCount;
+				for (uint32 i = node.LeftOrFirst; i < end; ++i)
+				{
+					__m128 t, mask;
+					if (data.PrimitiveType == QueryPrimitiveType::Triangle)
+					{
+						mask = IntersectTriangleSSE2(data.Triangles[i], p, tMax, t);
+					}
+					else
+					{
+						mask = IntersectSlabsSSE2(data.Boxes[i].Min, data.Boxes[i].Max, p, t);
+						t    = _mm_max_ps(t, _mm_setzero_ps());
+						mask = _mm_and_ps(mask, _mm_cmplt_ps(t, tMax));
+					}
+					mask = _mm_and_ps(mask, active);
+
+					tMax      = SelectSSE2(mask, t, tMax);
+					primitive = SelectSSE2(mask, _mm_castsi128_ps(_mm_set1_epi32(static_cast<int32>(i))), primitive);
+					if (mode == RaycastMode::AnyHit) { active = _mm_andnot_ps(mask, active); }
+				}
+				if (_mm_movemask_ps(active) == 0) { break; }
+			}
+			else
+			{
+				const uint32 left  = node.LeftOrFirst;
+				const uint32 right = left + 1;
+				const bool isLeftHit  = IntersectNodeSSE2(nodes[left] , p, tMax, active) != 0;
+				const bool isRightHit = IntersectNodeSSE2(nodes[right], p, tMax, active) != 0;
+				if (isLeftHit && isRightHit)
+				{
+					Check(stackCount < STACK_CAPACITY);
+					const bool isLeftFirst = packet.IsLeftFirst[node.SplitAxis];
+					stack[stackCount++] = isLeftFirst ? right : left;
+					current = isLeftFirst ? left : right;
+					continue;
+				}
+				if (isLeftHit)  { current = left;  continue; }
+				if (isRightHit) { current = right; continue; }
+			}
+
+			// ς񂾎q, ċ߂ȂCŔ肵܂
+			isVisiting = false;
+			while (stackCount > 0)
+			{
+				current = stack[--stackCount];
+				if (IntersectNodeSSE2(nodes[current], p, tMax, active) != 0)
+				{
+					isVisiting = true;
+					break;
+				}
+			}
+		}
+
+		_mm_store_ps(packet.MaxDistance, tMax);
+		_mm_store_si128(reinterpret_cast<__m128i*>(packet.Primitive), _mm_castps_si128(primitive));
+		ScatterPacket(packet, count, distances, primitives);
+	}
+	#pragma endregion SSE2
+
+	#pragma region AVX2
+	/*---------------------------------------------------------------
+			AVX2 : 8{̃C1̃pPbgƂĒT܂. Z̏ԂSSE2łƓł
+	-----------------------------------------------------------------*/
+	struct PacketAVX2
+	{
+		__m256 OriginX, OriginY, OriginZ;
+		__m256 DirectionX, DirectionY, DirectionZ;
+		__m256 InverseX, InverseY, InverseZ;
+	};
+
+	SIMD_TARGET_AVX2 __forceinline __m256 IntersectSlabsAVX2(const gm::Float3& min, const gm::Float3& max, const PacketAVX2& p, __m256& tNear)
+	{
+		const __m256 t1x = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(min.x), p.OriginX), p.InverseX);
+		const __m256 t2x = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(max.x), p.OriginX), p.InverseX);
+		const __m256 t1y = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(min.y), p.OriginY), p.InverseY);
+		const __m256 t2y = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(max.y), p.OriginY), p.InverseY);
+		const __m256 t1z = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(min.z), p.OriginZ), p.InverseZ);
+		const __m256 t2z = _mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(max.z), p.OriginZ), p.InverseZ);
+
+		tNear = _mm256_max_ps(_mm256_max_ps(_mm256_min_ps(t1x, t2x), _mm256_min_ps(t1y, t2y)), _mm256_min_ps(t1z, t2z));
+		const __m256 tFar = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(t1x, t2x), _mm256_max_ps(t1y, t2y)), _mm256_max_ps(t1z, t2z));
+		return _mm256_and_ps(_mm256_cmp_ps(tNear, _mm256_mul_ps(tFar, _mm256_set1_ps(SLAB_TOLERANCE)), _CMP_LE_OQ), _mm256_cmp_ps(tFar, _mm256_setzero_ps(), _CMP_GE_OQ));
+	}
+
+	SIMD_TARGET_AVX2 __forceinline int32 IntersectNodeAVX2(const QueryBVHNode& node, const PacketAVX2& p, const __m256 tMax, const __m256 active)
+	{
+		__m256 tNear;
+		const __m256 mask = IntersectSlabsAVX2(node.Min, node.Max, p, tNear);
+		return _mm256_movemask_ps(_mm256_and_ps(_mm256_and_ps(mask, _mm256_cmp_ps(tNear, tMax, _CMP_LE_OQ)), active));
+	}
+
+	SIMD_TARGET_AVX2 __forceinline __m256 IntersectTriangleAVX2(const QueryTriangle& triangle, const PacketAVX2& r, const __m256 tMax, __m256& t)
+	{
+		const __m256 e1x = _mm256_set1_ps(triangle.Edge1.x), e1y = _mm256_set1_ps(triangle.Edge1.y), e1z = _mm256_set1_ps(triangle.Edge1.z);
+		const __m256 e2x = _mm256_set1_ps(triangle.Edge2.x), e2y = _mm256_set1_ps(triangle.Edge2.y), e2z = _mm256_set1_ps(triangle.Edge2.z);
+
+		const __m256 px  = _mm256_sub_ps(_mm256_mul_ps(r.DirectionY, e2z), _mm256_mul_ps(r.DirectionZ, e2y));
+		const __m256 py  = _mm256_sub_ps(_mm256_mul_ps(r.DirectionZ, e2x), _mm256_mul_ps(r.DirectionX, e2z));
+		const __m256 pz  = _mm256_sub_ps(_mm256_mul_ps(r.DirectionX, e2y), _mm256_mul_ps(r.DirectionY, e2x));
+		const __m256 det = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)), _mm256_mul_ps(e1z, pz));
+
+		const __m256 inverseDet = _mm256_div_ps(_mm256_set1_ps(1.0f), det);
+		const __m256 sx = _mm256_sub_ps(r.OriginX, _mm256_set1_ps(triangle.Vertex0.x));
+		const __m256 sy = _mm256_sub_ps(r.OriginY, _mm256_set1_ps(triangle.Vertex0.y));
+		const __m256 sz = _mm256_sub_ps(r.OriginZ, _mm256_set1_ps(triangle.Vertex0.z));
+		const __m256 u  = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(sx, px), _mm256_mul_ps(sy, py)), _mm256_mul_ps(sz, pz)), inverseDet);
+
+		const __m256 qx = _mm256_sub_ps(_mm256_mul_ps(sy, e1z), _mm256_mul_ps(sz, e1y));
+		const __m256 qy = _mm256_sub_ps(_mm256_mul_ps(sz, e1x), _mm256_mul_ps(sx, e1z));
+		const __m256 qz = _mm256_sub_ps(_mm256_mul_ps(sx, e1y), _mm256_mul_ps(sy, e1x));
+		const __m256 v  = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(r.DirectionX, qx), _mm256_mul_ps(r.DirectionY, qy)), _mm256_mul_ps(r.DirectionZ, qz)), inverseDet);
+		t = _mm256_mul_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)), _mm256_mul_ps(e2z, qz)), inverseDet);
+
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one  = _mm256_set1_ps(1.0f);
+		__m256 mask = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), det), _mm256_set1_ps(PARALLEL_EPSILON), _CMP_NLT_UQ);
+		mask = _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_NLT_UQ), _mm256_cmp_ps(u, one, _CMP_NGT_UQ)));
+		mask = _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(v, zero, _CMP_NLT_UQ), _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_NGT_UQ)));
+		return _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(t, zero, _CMP_GE_OQ), _mm256_cmp_ps(t, tMax, _CMP_LT_OQ)));
+	}
+
+	SIMD_TARGET_AVX2 void RaycastPacketAVX2(const TraversalData& data, const QueryRay* rays, const uint32 count, const RaycastMode mode, float* distances, uint32* primitives)
+	{
+		PacketRays packet;
+		GatherPacket(rays, count, 8, packet);
+
+		PacketAVX2 p = {};
+		p.OriginX    = _mm256_load_ps(packet.OriginX);
+		p.OriginY    = _mm256_load_ps(packet.OriginY);
+		p.OriginZ    = _mm256_load_ps(packet.OriginZ);
+		p.DirectionX = _mm256_load_ps(packet.DirectionX);
+		p.DirectionY = _mm256_load_ps(packet.DirectionY);
+		p.DirectionZ = _mm256_load_ps(packet.DirectionZ);
+		p.InverseX   = _mm256_load_ps(packet.InverseX);
+		p.InverseY   = _mm256_load_ps(packet.InverseY);
+		p.InverseZ   = _mm256_load_ps(packet.InverseZ);
+
+		__m256 active    = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32>(count)), _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0)));
+		__m256 tMax      = _mm256_load_ps(packet.MaxDistance);
+		__m256 primitive = _mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i*>(packet.Primitive)));
+
+		const QueryBVHNode* nodes = data.Nodes;
+		uint32 stack[STACK_CAPACITY];
+		uint32 stackCount = 0;
+		uint32 current    = 0;
+		bool   isVisiting = IntersectNodeAVX2(nodes[0], p, tMax, active) != 0;
+		while (isVisiting)
+		{
+			const QueryBVHNode& node = nodes[current];
+			if (node.IsLeaf())
+			{
+				const uint32 end = node.LeftOrFirst + node.PrimitiveCount;
+				for (uint32 i = node.LeftOrFirst; i < end; ++i)
+				{
+					__m256 t, mask;
+					if (data.PrimitiveType == QueryPrimitiveType::Triangle)
+					{
+						mask = IntersectTriangleAVX2(data.Triangles[i], p, tMax, t);
+					}
+					else
+					{
+						mask = IntersectSlabsAVX2(data.Boxes[i].Min, data.Boxes[i].Max, p, t);
+						t    = _mm256_max_ps(t, _mm256_setzero_ps());
+						mask = _mm256_and_ps(mask, _mm256_cmp_ps(t, tMax, _CMP_LT_OQ));
+					}
+					mask = _mm256_and_ps(mask, active);
+
+					tMax      = _mm256_blendv_ps(tMax, t, mask);
+					primitive = _mm256_blendv_ps(primitive, _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int32>(i))), mask);
+					if (mode == RaycastMode::AnyHit) { active = _mm256_andnot_ps(mask, active); }
+				}
+				if (_mm256_movemask_ps(active) == 0) { break; }
+			}
+			else
+			{
+				const uint32 left  = node.LeftOrFirst;
+				const uint32 right = left + 1;
+				const bool isLeftHit  = IntersectNodeAVX2(nodes[left] , p, tMax, active) != 0;
+				const bool isRightHit = IntersectNodeAVX2(nodes[right], p, tMax, active) != 0;
+				if (isLeftHit && isRightHit)
+				{
+					Check(stackCount < STACK_CAPACITY);
+					const bool isLeftFirst = packet.IsLeftFirst[node.SplitAxis];
+					stack[stackCount++] = isLeftFirst ? right : left;
+					current = isLeftFirst ? left : right;
+					continue;
+				}
+				if (isLeftHit)  { current = left;  continue; }
+				if (isRightHit) { current = right; continue; }
+			}
+
+			isVisiting = false;
+			while (stackCount > 0)
+			{
+				current = stack[--stackCount];
+				if (IntersectNodeAVX2(nodes[current], p, tMax, active) != 0)
+				{
+					isVisiting = true;
+					break;
+				}
+			}
+		}
+
+		_mm256_store_ps(packet.MaxDistance, tMax);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(packet.Primitive), _mm256_castps_si256(primitive));
+		_mm256_zeroupper();
+		ScatterPacket(packet, count, distances, primitives);
+	}
+	#pragma endregion AVX2
+
+	/*---------------------------------------------------------------
+			SimdInstructionSetƂ̃pPbgT, 1ɒT郌C̐.
+			SSE4.1ŗL̖߂őȂӏ͖, SSE4.1SSE2Ƌʂł.
+	-----------------------------------------------------------------*/
+	constexpr PacketFunction PACKET_FUNCTIONS[] = { RaycastPacketScalar, RaycastPacketSSE2, RaycastPacketSSE2, RaycastPacketAVX2 };
+	constexpr uint32         PACKET_WIDTHS   [] = { 1, 4, 4, 8 };
+#else
+	constexpr PacketFunction PACKET_FUNCTIONS[] = { RaycastPacketScalar, RaycastPacketScalar, RaycastPacketScalar, RaycastPacketScalar };
+	constexpr uint32         PACKET_WIDTHS   [] = { 1, 1, 1, 1 };
+#endif
+
+	static_assert(sizeof(PACKET_FUNCTIONS) / sizeof(PACKET_FUNCTIONS[0]) == static_cast<size_t>(SimdInstructionSet::CountOf), "function table must cover every instruction set.");
+	static_assert(sizeof(PACKET_WIDTHS)    / sizeof(PACKET_WIDTHS[0])    == static_cast<size_t>(SimdInstructionSet::CountOf), "width table must cover every instruction set.");
+
+	/*---------------------------------------------------------------
+			[0, count)A͈͂ɕ, Xbhv[̃^XNƂĎs܂.
+			͈͂̋E̓pPbgȂ悤MAX_PACKET_SIZE̔{ɑ܂
+	-----------------------------------------------------------------*/
+	template<class Function>
+	void RunTasks(ThreadPool* threadPool, const uint32 count, const Function& function)
+	{
+		const uint32 threadCount = threadPool ? threadPool->GetThreadCount() : 1;
+		if (threadCount <= 1 || count < 2 * MIN_RAYS_PER_TASK)
+		{
+			function(0u, count);
+			return;
+		}
+
+		uint32 taskCount = threadCount * TASKS_PER_THREAD;
+		if (taskCount > count / MIN_RAYS_PER_TASK) { taskCount = count / MIN_RAYS_PER_TASK; }
+
+		std::vector<std::future<void>> futures;
+		futures.reserve(taskCount);
+		for (uint32 task = 0; task < taskCount; ++task)
+		{
+			const uint32 begin = static_cast<uint32>(static_cast<uint64>(count) * task / taskCount) & ~(MAX_PACKET_SIZE - 1);
+			const uint32 end   = task + 1 == taskCount ? count : static_cast<uint32>(static_cast<uint64>(count) * (task + 1) / taskCount) & ~(MAX_PACKET_SIZE - 1);
+			futures.push_back(threadPool->Submit([&function, begin, end]()
+			{
+				function(begin, end);
+			}));
+		}
+		for (auto& future : futures) { future.get(); }
+	}
+
+	/*---------------------------------------------------------------
+			Ȃꍇ̌
+	-----------------------------------------------------------------*/
+	__forceinline void MakeMiss(const QueryRay& ray, QueryHit& hit)
+	{
+		hit = QueryHit();
+		hit.Distance = ray.MaxDistance;
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Implement
+//////////////////////////////////////////////////////////////////////////////////
+#pragma region Public Function
+/*!**********************************************************************
+*  @brief     AN^[̋E{bNXBVH\z܂. ȑO̓e͔j܂.
+*  @param[in] const geometry::AABB* E{bNX̔z
+*  @param[in] const gu::uint32 E{bNX̐
+*  @return    void
+*************************************************************************/
+void SceneQueryBVH::BuildFromBounds(const AABB* bounds, const uint32 count)
+{
+	Clear();
+	_primitiveType = QueryPrimitiveType::AABB;
+
+	_buildBounds .Resize(count, false);
+	_buildCenters.Resize(count, false);
+	for (uint32 i = 0; i < count; ++i)
+	{
+		_buildBounds [i] = bounds[i];
+		_buildCenters[i] = bounds[i].GetCenter();
+	}
+
+	Build(count);
+
+	_boxes.Resize(count, false);
+	for (uint32 i = 0; i < count; ++i) { _boxes[i] = bounds[_primitiveIDs[i]]; }
+}
+
+/*!**********************************************************************
+*  @brief     Op`̏WBVH\z܂. ȑO̓e͔j܂.
+*  @param[in] const gm::Float3* _̔z
+*  @param[in] const gu::uint32* Op`Ƃ3̒_CfbNXׂz
+*  @param[in] const gu::uint32 Op`̐
+*  @return    void
+*************************************************************************/
+void SceneQueryBVH::BuildFromTriangles(const gm::Float3* vertices, const uint32* indices, const uint32 triangleCount)
+{
+	Clear();
+	_primitiveType = QueryPrimitiveType::Triangle;
+
+	_buildBounds .Resize(triangleCount, false);
+	_buildCenters.Resize(triangleCount, false);
+	for (uint32 i = 0; i < triangleCount; ++i)
+	{
+		const gm::Float3& v0 = vertices[indices[3 * i + 0]];
+		const gm::Float3& v1 = vertices[indices[3 * i + 1]];
+		const gm::Float3& v2 = vertices[indices[3 * i + 2]];
+		_buildBounds [i] = AABB::Union(AABB::Union(AABB(v0, v0), AABB(v1, v1)), AABB(v2, v2));
+		_buildCenters[i] = _buildBounds[i].GetCenter();
+	}
+
+	Build(triangleCount);
+
+	_triangles.Resize(triangleCount, false);
+	for (uint32 i = 0; i < triangleCount; ++i)
+	{
+		const uint32      id = _primitiveIDs[i];
+		const gm::Float3& v0 = vertices[indices[3 * id + 0]];
+		_triangles[i].Vertex0 = v0;
+		_triangles[i].Edge1   = Subtract(vertices[indices[3 * id + 1]], v0);
+		_triangles[i].Edge2   = Subtract(vertices[indices[3 * id + 2]], v0);
+	}
+}
+
+/*!**********************************************************************
+*  @brief     1{̃CT܂.
+*  @param[in]  const QueryRay& C
+*  @param[in]  const RaycastMode ̋ߕ
+*  @param[out] QueryHit& 
+*  @return     bool ꍇtrue
+*************************************************************************/
+bool SceneQueryBVH::Raycast(const QueryRay& ray, const RaycastMode mode, QueryHit& hit) const
+{
+	if (IsEmpty())
+	{
+		MakeMiss(ray, hit);
+		return false;
+	}
+
+	const TraversalData data      = { _nodes.Data(), _boxes.Data(), _triangles.Data(), _primitiveType };
+	const gm::Float3    extents   = gm::Float3(0.0f, 0.0f, 0.0f);
+	float               distance  = 0.0f;
+	const uint32        primitive = TraverseSingle(data, ray, extents, mode, distance);
+	if (primitive == INVALID_PRIMITIVE)
+	{
+		MakeMiss(ray, hit);
+		return false;
+	}
+
+	MakeHit(ray, extents, primitive, distance, hit);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     ő8{̃CpPbgƂĒT܂.
+*  @param[in]  const QueryRay* C̔z
+*  @param[in]  const gu::uint32 C̐ (MAX_PACKET_SIZEȉ)
+*  @param[in]  const RaycastMode ̋ߕ
+*  @param[out] QueryHit* ʂ̔z
+*  @return     void
+*************************************************************************/
+void SceneQueryBVH::RaycastPacket(const QueryRay* rays, const uint32 count, const RaycastMode mode, QueryHit* hits) const
+{
+	Check(count <= MAX_PACKET_SIZE);
+	if (IsEmpty())
+	{
+		for (uint32 i = 0; i < count; ++i) { MakeMiss(rays[i], hits[i]); }
+		return;
+	}
+
+	const TraversalData data           = { _nodes.Data(), _boxes.Data(), _triangles.Data(), _primitiveType };
+	const uint8         instructionSet = static_cast<uint8>(CPUFeature::GetActive());
+	const uint32        width          = PACKET_WIDTHS[instructionSet];
+
+	float  distances [MAX_PACKET_SIZE];
+	uint32 primitives[MAX_PACKET_SIZE];
+	for (uint32 offset = 0; offset < count; offset += width)
+	{
+		const uint32 packetCount = count - offset < width ? count - offset : width;
+		PACKET_FUNCTIONS[instructionSet](data, rays + offset, packetCount, mode, distances + offset, primitives + offset);
+	}
+
+	const gm::Float3 extents = gm::Float3(0.0f, 0.0f, 0.0f);
+	for (uint32 i = 0; i < count; ++i)
+	{
+		if (primitives[i] == INVALID_PRIMITIVE) { MakeMiss(rays[i], hits[i]); }
+		else                                    { MakeHit(rays[i], extents, primitives[i], distances[i], hits[i]); }
+	}
+}
+
+/*!**********************************************************************
+*  @brief     ̃C܂Ƃ߂ĒT܂. CA͈͂ɕ, Xbhv[̃^XNƂĕɒT܂.
+*  @param[in]  const QueryRay* C̔z
+*  @param[in]  const gu::uint32 C̐
+*  @param[in]  const RaycastMode ̋ߕ
+*  @param[out] QueryHit* ʂ̔z
+*  @param[in]  gu::ThreadPool* Xbhv[ (nullptȑꍇ͌ĂяõXbhŒT܂)
+*  @param[in]  const RayTraversal T@
+*  @return     void
+*************************************************************************/
+void SceneQueryBVH::RaycastBatch(const QueryRay* rays, const uint32 count, const RaycastMode mode, QueryHit* hits, ThreadPool* threadPool, const RayTraversal traversal) const
+{
+	RunTasks(threadPool, count, [this, rays, mode, hits, traversal](const uint32 begin, const uint32 end)
+	{
+		if (traversal == RayTraversal::Single)
+		{
+			for (uint32 i = begin; i < end; ++i) { Raycast(rays[i], mode, hits[i]); }
+			return;
+		}
+
+		for (uint32 i = begin; i < end; i += MAX_PACKET_SIZE)
+		{
+			RaycastPacket(rays + i, end - i < MAX_PACKET_SIZE ? end - i : MAX_PACKET_SIZE, mode, hits + i);
+		}
+	});
+}
+
+/*!**********************************************************************
+*  @brief     ɕsȃ{bNXCɉĈړ, ŏɐڐGAN^[߂܂.
+*  @param[in]  const QueryRay& {bNX̒S̈ړ
+*  @param[in]  const gm::Float3& {bNX̊e̔̒
+*  @param[in]  const RaycastMode ̋ߕ
+*  @param[out] QueryHit&  (n_ŏdȂĂꍇ͋0)
+*  @return     bool ڐGꍇtrue
+*************************************************************************/
+bool SceneQueryBVH::SweepBox(const QueryRay& ray, const gm::Float3& halfExtents, const RaycastMode mode, QueryHit& hit) const
+{
+	Check(_primitiveType == QueryPrimitiveType::AABB);
+	if (IsEmpty() || _primitiveType != QueryPrimitiveType::AABB)
+	{
+		MakeMiss(ray, hit);
+		return false;
+	}
+
+	const TraversalData data      = { _nodes.Data(), _boxes.Data(), _triangles.Data(), _primitiveType };
+	float               distance  = 0.0f;
+	const uint32        primitive = TraverseSingle(data, ray, halfExtents, mode, distance);
+	if (primitive == INVALID_PRIMITIVE)
+	{
+		MakeMiss(ray, hit);
+		return false;
+	}
+
+	MakeHit(ray, halfExtents, primitive, distance, hit);
+	return true;
+}
+
+/*!**********************************************************************
+*  @brief     傫̃{bNX̑̃XC[v܂Ƃ߂čs܂.
+*  @param[in]  const QueryRay* {bNX̒S̈ړ̔z
+*  @param[in]  const gu::uint32 XC[v̐
+*  @param[in]  const gm::Float3& {bNX̊e̔̒
+*  @param[in]  const RaycastMode ̋ߕ
+*  @param[out] QueryHit* ʂ̔z
+*  @param[in]  gu::ThreadPool* Xbhv[ (nullptȑꍇ͌ĂяõXbhŒT܂)
+*  @return     void
+*************************************************************************/
+void SceneQueryBVH::SweepBoxBatch(const QueryRay* rays, const uint32 count, const gm::Float3& halfExtents, const RaycastMode mode, QueryHit* hits, ThreadPool* threadPool) const
+{
+	RunTasks(threadPool, count, [this, rays, &halfExtents, mode, hits](const uint32 begin, const uint32 end)
+	{
+		for (uint32 i = begin; i < end; ++i) { SweepBox(rays[i], halfExtents, mode, hits[i]); }
+	});
+}
+
+/*!**********************************************************************
+*  @brief     SẴm[hƃv~eBuj܂. mۍς݂̔z͍ėp̂ߎc܂.
+*  @param[in] void
+*  @return    void
+*************************************************************************/
+void SceneQueryBVH::Clear()
+{
+	_nodes       .Clear();
+	_boxes       .Clear();
+	_triangles   .Clear();
+	_primitiveIDs.Clear();
+	_buildBounds .Clear();
+	_buildCenters.Clear();
+}
+#pragma endregion Public Function
+
+#pragma region Public Property
+/*!**********************************************************************
+*  @brief     Sm[h̕\ʐς̍v[g̕\ʐςŊl. قǒT؂ł.
+*  @param[in] void
+*  @return    float
+*************************************************************************/
+float SceneQueryBVH::GetAreaRatio() const
+{
+	if (IsEmpty()) { return 0.0f; }
+
+	float totalArea = 0.0f;
+	for (uint64 i = 0; i < _nodes.Size(); ++i)
+	{
+		totalArea += AABB(_nodes[i].Min, _nodes[i].Max).GetSurfaceArea();
+	}
+	return totalArea / AABB(_nodes[0].Min, _nodes[0].Max).GetSurfaceArea();
+}
+#pragma endregion Public Property
+
+#pragma region Protected Function
+/*!**********************************************************************
+*  @brief     _buildBounds_buildCentersm[h\z, t̏Ƀv~eBuIDׂ܂.
+*  @param[in] const gu::uint32 v~eBu̐
+*  @return    void
+*************************************************************************/
+void SceneQueryBVH::Build(const uint32 count)
+{
+	_primitiveIDs.Resize(count, false);
+	for (uint32 i = 0; i < count; ++i) { _primitiveIDs[i] = i; }
+
+	if (count > 0)
+	{
+		// 񕪖؂̃m[h͍ő2n - 1̂, \zɔz񂪍Ċmۂ邱Ƃ͂܂
+		_nodes.Reserve(2ull * count - 1);
+		_nodes.Push(QueryBVHNode());
+		BuildNode(0, 0, count, 0);
+	}
+
+	_buildBounds .Clear();
+	_buildCenters.Clear();
+}
+
+/*!**********************************************************************
+*  @brief     _primitiveIDs[begin, end)̃v~eBuŃm[h쐬܂. @n
+*             rSAHōłRXg̒ႢT, t̂܂ܔ肷ꍇ͗tɂ܂.
+*  @param[in] const gu::uint32 쐬m[h̃CfbNX
+*  @param[in] const gu::uint32 v~eBu͈̔͂̐擪
+*  @param[in] const gu::uint32 v~eBu͈̔͂̏I[
+*  @param[in] const gu::uint32 ̐[
+*  @return    void
+*************************************************************************/
+void SceneQueryBVH::BuildNode(const uint32 nodeIndex, const uint32 begin, const uint32 end, const uint32 depth)
+{
+	const uint32 count = end - begin;
+
+	AABB bounds = _buildBounds[_primitiveIDs[begin]];
+	AABB centerBounds(_buildCenters[_primitiveIDs[begin]], _buildCenters[_primitiveIDs[begin]]);
+	for (uint32 i = begin + 1; i < end; ++i)
+	{
+		const uint32 id = _primitiveIDs[i];
+		bounds       = AABB::Union(bounds, _buildBounds[id]);
+		centerBounds = AABB::Union(centerBounds, AABB(_buildCenters[id], _buildCenters[id]));
+	}
+
+	_nodes[nodeIndex].Min = bounds.Min;
+	_nodes[nodeIndex].Max = bounds.Max;
+
+	/*-------------------------------------------------------------------
+	-      S͈̔͂łLIт܂
+	---------------------------------------------------------------------*/
+	const gm::Float3 size = Subtract(centerBounds.Max, centerBounds.Min);
+	const uint32 axis       = size.x >= size.y && size.x >= size.z ? 0 : (size.y >= size.z ? 1 : 2);
+	const float  axisMin    = GetComponent(centerBounds.Min, axis);
+	const float  axisExtent = GetComponent(size, axis);
+
+	bool   isLeaf = count <= MAX_LEAF_PRIMITIVES;
+	uint32 middle = begin + count / 2;
+	if (count > 1 && depth < MAX_SAH_DEPTH && axisExtent > 0.0f)
+	{
+		/*-------------------------------------------------------------------
+		-      rƂɃv~eBu̐ƃ{bNXW߂܂
+		---------------------------------------------------------------------*/
+		uint32 binCounts[BIN_COUNT] = {};
+		AABB   binBoxes [BIN_COUNT];
+		const float binScale = static_cast<float>(BIN_COUNT) / axisExtent;
+
+		const auto GetBin = [&](const uint32 id)
+		{
+			const uint32 bin = static_cast<uint32>((GetComponent(_buildCenters[id], axis) - axisMin) * binScale);
+			return bin < BIN_COUNT - 1 ? bin : BIN_COUNT - 1;
+		};
+
+		for (uint32 i = begin; i < end; ++i)
+		{
+			const uint32 id  = _primitiveIDs[i];
+			const uint32 bin = GetBin(id);
+			binBoxes[bin] = binCounts[bin] == 0 ? _buildBounds[id] : AABB::Union(binBoxes[bin], _buildBounds[id]);
+			++binCounts[bin];
+		}
+
+		/*-------------------------------------------------------------------
+		-      Eݐς\ʐς, 瑖čŏRXg̋ET܂
+		---------------------------------------------------------------------*/
+		float  rightAreas [BIN_COUNT] = {};
+		uint32 rightCounts[BIN_COUNT] = {};
+		AABB   accumulated = {};
+		uint32 accumulatedCount = 0;
+		for (uint32 bin = BIN_COUNT - 1; bin > 0; --bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				accumulated = accumulatedCount == 0 ? binBoxes[bin] : AABB::Union(accumulated, binBoxes[bin]);
+				accumulatedCount += binCounts[bin];
+			}
+			rightAreas [bin] = accumulatedCount > 0 ? accumulated.GetSurfaceArea() : 0.0f;
+			rightCounts[bin] = accumulatedCount;
+		}
+
+		int32 bestSplit = -1;
+		float bestCost  = FLT_MAX;
+		accumulatedCount = 0;
+		for (uint32 bin = 0; bin < BIN_COUNT - 1; ++bin)
+		{
+			if (binCounts[bin] > 0)
+			{
+				accumulated = accumulatedCount == 0 ? binBoxes[bin] : AABB::Union(accumulated, binBoxes[bin]);
+				accumulatedCount += binCounts[bin];
+			}
+			if (accumulatedCount == 0 || rightCounts[bin + 1] == 0) { continue; }
+
+			const float cost = accumulatedCount * accumulated.GetSurfaceArea() + rightCounts[bin + 1] * rightAreas[bin + 1];
+			if (cost < bestCost)
+			{
+				bestCost  = cost;
+				bestSplit = static_cast<int32>(bin);
+			}
+		}
+
+		/*-------------------------------------------------------------------
+		-      ̃RXg (ǂRXg + q̔萔) t̃RXgႯ, E荶̃r̃v~eBuOɏW߂܂
+		---------------------------------------------------------------------*/
+		const float area = bounds.GetSurfaceArea();
+		if (bestSplit >= 0 && (!isLeaf || TRAVERSAL_COST * area + bestCost < count * area))
+		{
+			isLeaf = false;
+
+			uint32 left  = begin;
+			uint32 right = end - 1;
+			while (left <= right)
+			{
+				if (GetBin(_primitiveIDs[left]) <= static_cast<uint32>(bestSplit)) { ++left; continue; }
+
+				const uint32 temp = _primitiveIDs[left];
+				_primitiveIDs[left]  = _primitiveIDs[right];
+				_primitiveIDs[right] = temp;
+				if (right == 0) { break; }
+				--right;
+			}
+			if (left > begin && left < end) { middle = left; }
+		}
+	}
+
+	if (isLeaf)
+	{
+		_nodes[nodeIndex].LeftOrFirst    = begin;
+		_nodes[nodeIndex].PrimitiveCount = static_cast<uint16>(count);
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-      2̎qאڂĊmۂ܂ (SAHŕłȂꍇ͐Ŕɕ܂)
+	---------------------------------------------------------------------*/
+	const uint32 leftChild = static_cast<uint32>(_nodes.Size());
+	_nodes.Push(QueryBVHNode());
+	_nodes.Push(QueryBVHNode());
+	_nodes[nodeIndex].LeftOrFirst    = leftChild;
+	_nodes[nodeIndex].PrimitiveCount = 0;
+	_nodes[nodeIndex].SplitAxis      = static_cast<uint16>(axis);
+
+	BuildNode(leftChild    , begin , middle, depth + 1);
+	BuildNode(leftChild + 1, middle, end   , depth + 1);
+}
+
+/*!**********************************************************************
+*  @brief     t̏̃v~eBũCfbNX猋ʂ쐬܂. @͌1x߂܂.
+*  @param[in]  const QueryRay& C
+*  @param[in]  const gm::Float3& XC[v{bNX̔̒ (C̏ꍇ0)
+*  @param[in]  const gu::uint32 t̏̃v~eBũCfbNX
+*  @param[in]  const float ܂ł̋
+*  @param[out] QueryHit& 
+*  @return     void
+*************************************************************************/
+void SceneQueryBVH::MakeHit(const QueryRay& ray, const gm::Float3& extents, const uint32 primitive, const float distance, QueryHit& hit) const
+{
+	hit.PrimitiveID = _primitiveIDs[primitive];
+	hit.Distance    = distance;
+
+	if (_primitiveType == QueryPrimitiveType::Triangle)
+	{
+		const QueryTriangle& triangle = _triangles[primitive];
+		const gm::Float3     normal   = Normalize(Cross(triangle.Edge1, triangle.Edge2));
+		hit.Normal = Dot(normal, ray.Direction) > 0.0f ? Negate(normal) : normal;
+		return;
+	}
+
+	/*-------------------------------------------------------------------
+	-      ̋ł̖ʂĂ܂
+	---------------------------------------------------------------------*/
+	const gm::Float3 min = Subtract(_boxes[primitive].Min, extents);
+	const gm::Float3 max = Add     (_boxes[primitive].Max, extents);
+
+	uint32 entryAxis = 0;
+	float  entryNear = -FLT_MAX;
+	for (uint32 axis = 0; axis < 3; ++axis)
+	{
+		const float inverse = SafeInverse(GetComponent(ray.Direction, axis));
+		const float origin  = GetComponent(ray.Origin, axis);
+		const float tNear   = Min((GetComponent(min, axis) - origin) * inverse, (GetComponent(max, axis) - origin) * inverse);
+		if (tNear > entryNear)
+		{
+			entryNear = tNear;
+			entryAxis = axis;
+		}
+	}
+
+	if (entryNear < 0.0f)
+	{
+		hit.Normal = Negate(Normalize(ray.Direction));
+		return;
+	}
+
+	const float sign = GetComponent(ray.Direction, entryAxis) > 0.0f ? -1.0f : 1.0f;
+	hit.Normal = gm::Float3(entryAxis == 0 ? sign : 0.0f, entryAxis == 1 ? sign : 0.0f, entryAxis == 2 ? sign : 0.0f);
+}
+#pragma endregion Protected Function
@@ -23,8 +23,8 @@ IFileHandleWithBuffering::~IFileHandleWithBuffering()
 {
 	WaitForAsyncRead();
 	Close();
-	gu::Memory::Free(&_readBuffers[0]);
-	gu::Memory::Free(&_readBuffers[1]);
+	gu::Memory::Free(_readBuffers[0]);
+	gu::Memory::Free(_readBuffers[1]);
 }
 
 /*! @brief {ݒ*/
@@ -37,6 +37,7 @@ IFileHandleWithBuffering::IFileHandleWithBuffering(const HANDLE handle, const gu
 	GetFileSizeEx(_handle, &largeInteger);
 	_size = largeInteger.QuadPart;
 
+	MEMORY_TAG_SCOPE(gu::MemoryTag::File);
 	_readBuffers[0] = (gu::int8*)gu::Memory::Allocate(_bufferSize);
 	_readBuffers[1] = (gu::int8*)gu::Memory::Allocate(_bufferSize);
 
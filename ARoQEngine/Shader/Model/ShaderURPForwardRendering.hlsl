@@ -36,16 +36,35 @@ struct PSInput
 /////////////////////////////////////////////////////////////////////////////////
 float3 Calculate_Directional_Light_Illumination(in const DirectionalLight light, in BRDFSurface surface, const in float3 toEye);
 
+#ifdef USE_INSTANCING
+// DrawListBuilder writes gm::Float4x4 rows into vertex buffer slot 1.
+struct VSInputInstance
+{
+	float4 World0 : INSTANCE_WORLD0;
+	float4 World1 : INSTANCE_WORLD1;
+	float4 World2 : INSTANCE_WORLD2;
+	float4 World3 : INSTANCE_WORLD3;
+};
+
+PSInput VSMain( VSInputSkinVertex vertexIn, VSInputInstance instanceIn)
+#else
 PSInput VSMain( VSInputSkinVertex vertexIn)
+#endif
 {
 	PSInput result;
 	
+#ifdef USE_INSTANCING
+	float4x4 world = transpose(float4x4(instanceIn.World0, instanceIn.World1, instanceIn.World2, instanceIn.World3));
+#else
+	float4x4 world = World;
+#endif
+	
 	/*-------------------------------------------------------------------
 	-        transform to world space 
 	---------------------------------------------------------------------*/
-	float4 positionWorld = mul(World, vertexIn.Position);
+	float4 positionWorld = mul(world, vertexIn.Position);
 	result.Position      = mul(ProjectionView, positionWorld);
-	result.WorldNormal   = mul(World, vertexIn.Normal);
+	result.WorldNormal   = mul(world, vertexIn.Normal);
 	result.ViewNormal    = mul(View, result.WorldNormal);
 	result.UV            = vertexIn.UV;
 	
@@ -0,0 +1,144 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   FramePipelineBenchmark.cpp
+///  @brief  EBhEGPUg킸, XVXbhƕ`Xbh̎󂯓n (gu::FramePipeline) ̃XibvVbgobt@Ƃ̃t[Ԃׂ܂. @n
+///          XVXbh̓V[TransformXVăXibvVbg֕, `Xbh̓XibvVbgǂݍł, GPŮ҂̑ɃX[v܂. @n
+///          `摤ǂݍ񂾒lSēt[ŏ܂ꂽ (XṼV[ǂݍłȂ) ł邱ƂmF܂. @n
+///          g++ -std=c++20 -O2 -DNDEBUG -D__forceinline=inline -I../.. FramePipelineBenchmark.cpp ../../GameUtility/Thread/Public/Source/GUFramePipeline.cpp ../../GameUtility/Thread/Public/Source/GUSemaphore.cpp -lpthread
+///  @author toide
+///  @date   2026/10/22 11:02:18
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Thread/Public/Include/GUFramePipeline.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+namespace
+{
+	using Clock = std::chrono::steady_clock;
+
+	constexpr int    OBJECT_COUNT        = 4096;
+	constexpr int    FRAME_COUNT         = 240;
+	constexpr double UPDATE_MILLISECONDS = 4.0; // Q[̍XV (CPU)
+	constexpr double RECORD_MILLISECONDS = 1.0; // `R}h̋L^ (CPU)
+	constexpr double GPU_MILLISECONDS    = 4.0; // GPŮ҂ (X[v)
+
+	/*! @brief V[̃IuWFNg̃[hs (Ō̗vfɏ񂾃t[ԍ܂)*/
+	struct TransformSnapshot
+	{
+		float World[16] = {};
+	};
+
+	/*! @brief 1t[̃XibvVbg*/
+	struct FrameSnapshot
+	{
+		gu::uint64 FrameIndex = 0;
+		std::vector<TransformSnapshot> Transforms = {};
+	};
+
+	/****************************************************************************
+	*           w肵Ԃo܂CPUg܂
+	****************************************************************************/
+	float Spin(const double milliSeconds, float seed)
+	{
+		const auto end = Clock::now() + std::chrono::duration<double, std::milli>(milliSeconds);
+		while (Clock::now() < end)
+		{
+			for (int i = 0; i < 64; ++i) { seed = std::sin(seed) + 1.0f; }
+		}
+		return seed;
+	}
+
+	/****************************************************************************
+	*           XibvVbgobt@̐w肵, XVƕ`s܂
+	****************************************************************************/
+	double Run(const gu::uint32 bufferCount)
+	{
+		gu::FramePipeline pipeline(bufferCount);
+
+		std::vector<FrameSnapshot> snapshots(pipeline.GetBufferCount());
+		for (auto& snapshot : snapshots) { snapshot.Transforms.resize(OBJECT_COUNT); }
+
+		// XVXbhV[̏
+		std::vector<TransformSnapshot> scene(OBJECT_COUNT);
+
+		const auto start = Clock::now();
+
+		std::thread updateThread([&]()
+		{
+			float seed = 0.0f;
+			for (gu::uint64 frame = 0; frame < FRAME_COUNT; ++frame)
+			{
+				gu::uint32 bufferIndex = 0;
+				if (!pipeline.BeginWrite(bufferIndex)) { return; }
+
+				/*-------------------------------------------------------------------
+				-      V[XV, `ɎglXibvVbg֕܂
+				---------------------------------------------------------------------*/
+				for (int i = 0; i < OBJECT_COUNT; ++i)
+				{
+					scene[i].World[12] = static_cast<float>(i) + static_cast<float>(frame) * 0.01f;
+					scene[i].World[15] = static_cast<float>(frame);
+				}
+				seed = Spin(UPDATE_MILLISECONDS, seed);
+
+				auto& snapshot = snapshots[bufferIndex];
+				snapshot.FrameIndex = frame;
+				for (int i = 0; i < OBJECT_COUNT; ++i) { snapshot.Transforms[i] = scene[i]; }
+
+				pipeline.EndWrite();
+			}
+		});
+
+		float seed = 0.0f;
+		for (gu::uint64 frame = 0; frame < FRAME_COUNT; ++frame)
+		{
+			gu::uint32 bufferIndex = 0;
+			TEST_CHECK(pipeline.BeginRead(bufferIndex));
+
+			/*-------------------------------------------------------------------
+			-      `摤̓XibvVbgǂݍ݂܂. Sēt[̒lł邱
+			---------------------------------------------------------------------*/
+			const auto& snapshot = snapshots[bufferIndex];
+			TEST_CHECK(snapshot.FrameIndex == frame);
+			for (int i = 0; i < OBJECT_COUNT; ++i)
+			{
+				TEST_CHECK(snapshot.Transforms[i].World[15] == static_cast<float>(frame));
+			}
+
+			seed = Spin(RECORD_MILLISECONDS, seed);
+
+			// EndDrawFramełGPŮ҂ (CPUgȂ). PPPEngineƓ, `IĂobt@Ԃ܂
+			std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(GPU_MILLISECONDS));
+			pipeline.EndRead();
+		}
+
+		updateThread.join();
+		return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / FRAME_COUNT;
+	}
+}
+
+int main()
+{
+	std::printf("hardware threads: %u, objects: %d, update %.1f ms, record %.1f ms, gpu wait %.1f ms\n",
+		std::thread::hardware_concurrency(), OBJECT_COUNT, UPDATE_MILLISECONDS, RECORD_MILLISECONDS, GPU_MILLISECONDS);
+	std::printf("snapshot buffers | frame time [ms]\n");
+	for (const gu::uint32 bufferCount : { 1u, 2u, 3u })
+	{
+		std::printf("%16u | %15.2f\n", bufferCount, Run(bufferCount));
+	}
+	std::printf("FramePipelineBenchmark passed\n");
+	return 0;
+}
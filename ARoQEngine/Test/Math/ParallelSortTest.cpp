@@ -0,0 +1,98 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ParallelSortTest.cpp
+///  @brief  Sort::ParallelSort̃eXgł. ʂstd::sortƈv邱, [J[1̃v[ @n
+///          v[̃^XNĂяoꍇ (SẴ[J[܂Ăꍇ) fbhbNɏI邱ƂmF܂. @n
+///          g++ -std=c++20 -O1 -g -fsanitize=address,undefined -D__forceinline=inline -I../.. ParallelSortTest.cpp ../../GameUtility/Thread/Public/Source/GUThreadPool.cpp -lpthread
+///  @author toide
+///  @date   2026/10/24 10:21:47
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameUtility/Math/Include/GMSort.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <random>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace gm;
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+namespace
+{
+	// Ԃ̕ƃ}[WiɂȂvf
+	constexpr gu::uint64 ELEMENT_COUNT = Sort<gu::uint32>::PARALLEL_SORT_THRESHOLD * 8 + 123;
+
+	std::vector<gu::uint32> CreateRandomArray(const gu::uint64 count, const gu::uint32 seed)
+	{
+		std::mt19937 random(seed);
+		std::vector<gu::uint32> values(count);
+		for (auto& value : values) { value = random() % 100000; }
+		return values;
+	}
+
+	void SortAndCheck(gu::ThreadPool& threadPool, const gu::uint32 seed)
+	{
+		auto values   = CreateRandomArray(ELEMENT_COUNT, seed);
+		auto expected = values;
+		std::sort(expected.begin(), expected.end());
+
+		Sort<gu::uint32>::ParallelSort(values.data(), values.size(), threadPool);
+		TEST_CHECK(values == expected);
+	}
+
+	/****************************************************************************
+	*      ̃[J[ std::sort ƓʂɂȂ邱
+	****************************************************************************/
+	void TestMatchesStdSort()
+	{
+		gu::ThreadPool threadPool(4);
+		SortAndCheck(threadPool, 1);
+
+		auto values = CreateRandomArray(ELEMENT_COUNT, 2);
+		Sort<gu::uint32>::ParallelSort(values.data(), values.size(), threadPool, std::greater<gu::uint32>());
+		TEST_CHECK(std::is_sorted(values.begin(), values.end(), std::greater<gu::uint32>()));
+	}
+
+	/****************************************************************************
+	*      [J[1̃v[łI邱
+	****************************************************************************/
+	void TestSingleWorker()
+	{
+		gu::ThreadPool threadPool(1);
+		SortAndCheck(threadPool, 3);
+	}
+
+	/****************************************************************************
+	*      v[̃^XNĂяoĂI邱 (SẴ[J[\[g҂)
+	****************************************************************************/
+	void TestNestedInPoolTask()
+	{
+		gu::ThreadPool threadPool(2);
+
+		std::vector<std::future<void>> futures;
+		for (gu::uint32 i = 0; i < threadPool.GetThreadCount(); ++i)
+		{
+			futures.push_back(threadPool.Submit([&threadPool, i]() { SortAndCheck(threadPool, 10 + i); }));
+		}
+		for (auto& future : futures) { future.get(); }
+	}
+}
+
+int main()
+{
+	TestMatchesStdSort();
+	TestSingleWorker();
+	TestNestedInPoolTask();
+
+	std::printf("ParallelSortTest passed\n");
+	return 0;
+}
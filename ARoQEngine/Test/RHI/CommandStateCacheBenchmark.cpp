@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   CommandStateCacheBenchmark.cpp
+///  @brief  ̃f`悷V[̃Zbg߂CommandStateCacheɒʂ, hCoɓnߐƎ菜ߐ, 1߂̔莞Ԃ𑪂܂. @n
+///          GameModel::DrawWithMaterialsƓ (g|W[, _obt@, CfbNXobt@, }eAƂ̃fBXNv^e[u) Őݒ肵, @n
+///          񓯊쐬̃pCvC͓rfallback쐬pCvCɍւ܂. @n
+///          g++ -std=c++20 -O2 -DNDEBUG -D__forceinline=inline -I../.. CommandStateCacheBenchmark.cpp ../../GraphicsCore/RHI/InterfaceCore/Core/Source/RHICommandStateCache.cpp
+///  @author toide
+///  @date   2026/10/23 10:41:05
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandStateCache.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+namespace
+{
+	constexpr int        FRAME_COUNT         = 100;
+	constexpr gu::uint32 MESH_COUNT          = 64;
+	constexpr gu::uint32 PIPELINE_COUNT      = 4;
+	constexpr gu::uint32 MATERIAL_PER_MODEL  = 3;
+	constexpr gu::uint64 DESCRIPTOR_STRIDE   = 32;
+
+	struct Model
+	{
+		gu::uint32 Mesh     = 0;
+		gu::uint32 Pipeline = 0;
+		gu::uint32 Material = 0;
+	};
+
+	struct Result
+	{
+		gu::uint64 Issued   = 0;
+		gu::uint64 Filtered = 0;
+		double     NanoSecondPerCall = 0.0;
+	};
+
+	/****************************************************************************
+	*           1t[̃Zbg߂URP̑O`ƓŔs܂
+	****************************************************************************/
+	Result Measure(const std::vector<Model>& models, const bool isSorted)
+	{
+		std::vector<Model> drawOrder = models;
+		if (isSorted)
+		{
+			std::stable_sort(drawOrder.begin(), drawOrder.end(), [](const Model& left, const Model& right)
+			{
+				if (left.Pipeline != right.Pipeline) { return left.Pipeline < right.Pipeline; }
+				if (left.Material != right.Material) { return left.Material < right.Material; }
+				return left.Mesh < right.Mesh;
+			});
+		}
+
+		CommandStateCache cache;
+		gu::uint64 callCount = 0;
+
+		const auto start = std::chrono::steady_clock::now();
+		for (int frame = 0; frame < FRAME_COUNT; ++frame)
+		{
+			cache.Invalidate();
+
+			cache.SetObject(CommandStateType::DescriptorHeap        , 0x100);
+			cache.SetObject(CommandStateType::GraphicsResourceLayout, 0x200);
+			callCount += 2;
+
+			for (size_t i = 0; i < drawOrder.size(); ++i)
+			{
+				const auto& model = drawOrder[i];
+
+				// ŏ̃pCvC͔񓯊쐬, t[̔܂łfallbackԂ܂
+				const bool       isPending = model.Pipeline == 0 && i < drawOrder.size() / 2 && frame == 0;
+				const gu::uint64 pipeline  = isPending ? 0x9000 : 0x1000 + model.Pipeline * 0x100;
+
+				const CommandStateBufferView vertexBuffer = { 0x100000 + model.Mesh * 0x10000ull, 0x8000, 48 };
+				const CommandStateBufferView indexBuffer  = { 0x800000 + model.Mesh * 0x10000ull, 0x4000, 0 };
+
+				gu::uint32 changedStart = 0, changedCount = 0;
+				cache.SetObject(CommandStateType::GraphicsPipeline, pipeline);
+				cache.SetPrimitiveTopology(PrimitiveTopology::TriangleList);
+				cache.SetVertexBuffers(&vertexBuffer, 1, 0, changedStart, changedCount);
+				cache.SetIndexBuffer(indexBuffer, PixelFormat::R32_UINT);
+				cache.SetDescriptorTable(false, 1, 0x40000000 + model.Mesh * DESCRIPTOR_STRIDE);
+				callCount += 5;
+
+				for (gu::uint32 m = 0; m < MATERIAL_PER_MODEL; ++m)
+				{
+					cache.SetDescriptorTable(false, 4 + m, 0x50000000 + (model.Material * MATERIAL_PER_MODEL + m) * DESCRIPTOR_STRIDE);
+					++callCount;
+				}
+			}
+		}
+		const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		const auto& statistics = cache.GetStatistics();
+		return { statistics.GetTotalIssuedCount() / FRAME_COUNT, statistics.GetTotalFilteredCount() / FRAME_COUNT, seconds * 1e9 / static_cast<double>(callCount) };
+	}
+}
+
+int main()
+{
+	std::printf("models | order    | issued / frame | filtered / frame | filtered [%%] | cache [ns/call]\n");
+
+	for (const gu::uint32 modelCount : { 1000u, 10000u })
+	{
+		std::mt19937 random(12345);
+		std::vector<Model> models(modelCount);
+		for (auto& model : models)
+		{
+			model.Mesh     = random() % MESH_COUNT;
+			model.Pipeline = random() % PIPELINE_COUNT;
+			model.Material = random() % (MESH_COUNT / 2);
+		}
+
+		for (const bool isSorted : { false, true })
+		{
+			const auto result = Measure(models, isSorted);
+			const auto total  = static_cast<double>(result.Issued + result.Filtered);
+			std::printf("%6u | %-8s | %14llu | %16llu | %12.1f | %15.2f\n", modelCount, isSorted ? "sorted" : "insert",
+				static_cast<unsigned long long>(result.Issued), static_cast<unsigned long long>(result.Filtered),
+				result.Filtered * 100.0 / total, result.NanoSecondPerCall);
+		}
+	}
+	return 0;
+}
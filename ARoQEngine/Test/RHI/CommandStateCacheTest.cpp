@@ -0,0 +1,138 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   CommandStateCacheTest.cpp
+///  @brief  CommandStateCacheCPŨeXgł. lCeBũnhŔr邽, 񓯊쐬ŃpCvCւꍇ, @n
+///          obt@ŕʂ͈̔͂wꍇ͍Đݒ肳, ʂ̃bp[łlCeBȕԂłΎ菜邱ƂmF܂. @n
+///          g++ -std=c++20 -O1 -g -fsanitize=address,undefined -D__forceinline=inline -I../.. CommandStateCacheTest.cpp ../../GraphicsCore/RHI/InterfaceCore/Core/Source/RHICommandStateCache.cpp
+///  @author toide
+///  @date   2026/10/23 10:12:36
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHICommandStateCache.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+namespace
+{
+	constexpr gu::uint64 FALLBACK_PIPELINE = 0x1000;
+	constexpr gu::uint64 CREATED_PIPELINE  = 0x2000;
+
+	/****************************************************************************
+	*      񓯊쐬̊ŃlCeBũpCvCςꍇ͍Đݒ肳邱
+	****************************************************************************/
+	void TestPipelineSwap()
+	{
+		CommandStateCache cache;
+
+		// 쐬fallbackԂ邽, bp[xݒ肵Ă1񂾂ʂ܂
+		TEST_CHECK( cache.SetObject(CommandStateType::GraphicsPipeline, FALLBACK_PIPELINE));
+		TEST_CHECK(!cache.SetObject(CommandStateType::GraphicsPipeline, FALLBACK_PIPELINE));
+
+		// L^̓rō쐬Ă, 쐬pCvC͕Kݒ肳܂
+		TEST_CHECK( cache.SetObject(CommandStateType::GraphicsPipeline, CREATED_PIPELINE));
+		TEST_CHECK(!cache.SetObject(CommandStateType::GraphicsPipeline, CREATED_PIPELINE));
+
+		// ݒ (0) ͏ɒʂ܂
+		TEST_CHECK( cache.SetObject(CommandStateType::GraphicsPipeline, 0));
+		TEST_CHECK( cache.SetObject(CommandStateType::GraphicsPipeline, 0));
+
+		const auto& statistics = cache.GetStatistics();
+		TEST_CHECK(statistics.IssuedCount  [static_cast<gu::uint32>(CommandStateType::GraphicsPipeline)] == 4);
+		TEST_CHECK(statistics.FilteredCount[static_cast<gu::uint32>(CommandStateType::GraphicsPipeline)] == 2);
+	}
+
+	/****************************************************************************
+	*      ʂ̃bp[łlCeBȕԂłΎ菜邱
+	****************************************************************************/
+	void TestSharedNativeObject()
+	{
+		CommandStateCache cache;
+
+		// Lqq̃pCvCPSOLbVœlCeBũIuWFNgL܂
+		TEST_CHECK( cache.SetObject(CommandStateType::GraphicsPipeline, CREATED_PIPELINE));
+		TEST_CHECK(!cache.SetObject(CommandStateType::GraphicsPipeline, CREATED_PIPELINE));
+
+		// ނƂɕʁXɕێ܂
+		TEST_CHECK( cache.SetObject(CommandStateType::ComputePipeline, CREATED_PIPELINE));
+		cache.Invalidate(CommandStateType::ComputePipeline);
+		TEST_CHECK( cache.SetObject(CommandStateType::ComputePipeline, CREATED_PIPELINE));
+		TEST_CHECK(!cache.SetObject(CommandStateType::GraphicsPipeline, CREATED_PIPELINE));
+	}
+
+	/****************************************************************************
+	*      _obt@͈ʒu, TCY, XgCh̑SĂꍇ̂ݎ菜邱
+	****************************************************************************/
+	void TestVertexBufferView()
+	{
+		CommandStateCache cache;
+		gu::uint32 start = 0, count = 0;
+
+		const CommandStateBufferView view = { 0x10000, 256, 32 };
+		TEST_CHECK( cache.SetVertexBuffers(&view, 1, 0, start, count));
+		TEST_CHECK(start == 0 && count == 1);
+		TEST_CHECK(!cache.SetVertexBuffers(&view, 1, 0, start, count));
+		TEST_CHECK(count == 0);
+
+		// AhXɕʂ̃TCYXgCh̃obt@ꂽꍇ (̍ėp, zu\[X̃GCAX)
+		const CommandStateBufferView resized  = { 0x10000, 512, 32 };
+		const CommandStateBufferView restrided = { 0x10000, 512, 16 };
+		TEST_CHECK( cache.SetVertexBuffers(&resized  , 1, 0, start, count));
+		TEST_CHECK( cache.SetVertexBuffers(&restrided, 1, 0, start, count));
+
+		// ςXbg͈̔͂Ԃ܂
+		const CommandStateBufferView views[] = { { 0x20000, 64, 16 }, { 0x30000, 64, 16 }, { 0x40000, 64, 16 }, { 0x50000, 64, 16 } };
+		TEST_CHECK(cache.SetVertexBuffers(views, 4, 0, start, count));
+		TEST_CHECK(start == 0 && count == 4);
+
+		const CommandStateBufferView changed[] = { views[0], { 0x60000, 64, 16 }, { 0x70000, 64, 16 }, views[3] };
+		TEST_CHECK(cache.SetVertexBuffers(changed, 4, 0, start, count));
+		TEST_CHECK(start == 1 && count == 2);
+
+		// ݒ̃r[͏ɒʂ܂
+		const CommandStateBufferView empty = {};
+		TEST_CHECK(cache.SetVertexBuffers(&empty, 1, 0, start, count));
+		TEST_CHECK(cache.SetVertexBuffers(&empty, 1, 0, start, count));
+	}
+
+	/****************************************************************************
+	*      CfbNXobt@̓r[ƌ^̗Ŕr, InvalidateŖݒɖ߂邱
+	****************************************************************************/
+	void TestIndexBuffer()
+	{
+		CommandStateCache cache;
+
+		const CommandStateBufferView view = { 0x80000, 1024, 0 };
+		TEST_CHECK( cache.SetIndexBuffer(view, PixelFormat::R32_UINT));
+		TEST_CHECK(!cache.SetIndexBuffer(view, PixelFormat::R32_UINT));
+		TEST_CHECK( cache.SetIndexBuffer(view, PixelFormat::R16_UINT));
+		TEST_CHECK( cache.SetIndexBuffer({ 0x80000, 512, 0 }, PixelFormat::R16_UINT));
+
+		cache.Invalidate(CommandStateType::IndexBuffer);
+		TEST_CHECK( cache.SetIndexBuffer({ 0x80000, 512, 0 }, PixelFormat::R16_UINT));
+
+		cache.Invalidate();
+		TEST_CHECK( cache.SetIndexBuffer({ 0x80000, 512, 0 }, PixelFormat::R16_UINT));
+		TEST_CHECK(!cache.SetIndexBuffer({ 0x80000, 512, 0 }, PixelFormat::R16_UINT));
+	}
+}
+
+int main()
+{
+	TestPipelineSwap();
+	TestSharedNativeObject();
+	TestVertexBufferView();
+	TestIndexBuffer();
+
+	std::printf("CommandStateCacheTest passed\n");
+	return 0;
+}
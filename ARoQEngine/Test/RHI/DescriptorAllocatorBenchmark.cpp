@@ -0,0 +1,106 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DescriptorAllocatorBenchmark.cpp
+///  @brief  DescriptorIndexAllocator, ȑÕq[vgĂstd::queue̋󂫃Xg (mutexŕی) ̔sƉ̑xׂ܂. @n
+///          g++ -std=c++20 -O2 -DNDEBUG -D__forceinline=inline -I../.. DescriptorAllocatorBenchmark.cpp ../../GraphicsCore/RHI/InterfaceCore/Core/Source/RHIDescriptorAllocator.cpp
+///  @author toide
+///  @date   2026/10/21 14:41:09
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorAllocator.hpp"
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+namespace
+{
+	constexpr gu::uint32 CAPACITY         = 1000000;
+	constexpr int        BATCH_SIZE       = 64;
+	constexpr int        BATCH_PER_THREAD = 20000;
+
+	/****************************************************************************
+	*           ȑODirectX12::ResourceAllocatorƓs@mutext
+	****************************************************************************/
+	class QueueIndexAllocator
+	{
+	public:
+		gu::uint32 Allocate()
+		{
+			std::scoped_lock lock(_mutex);
+			if (!_availableID.empty())
+			{
+				const auto id = _availableID.front();
+				_availableID.pop();
+				return id;
+			}
+			return _currentID < CAPACITY ? _currentID++ : DescriptorIndexAllocator::INVALID_INDEX;
+		}
+
+		bool Free(const gu::uint32 index)
+		{
+			std::scoped_lock lock(_mutex);
+			_availableID.push(index);
+			return true;
+		}
+
+	private:
+		std::mutex             _mutex;
+		std::queue<gu::uint32> _availableID;
+		gu::uint32             _currentID = 0;
+	};
+
+	/****************************************************************************
+	*           eXbhBATCH_SIZE𔭍sĂSĉ鏈JԂ܂
+	****************************************************************************/
+	template<class TAllocator>
+	double Measure(TAllocator& allocator, const int threadCount)
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back([&allocator]()
+			{
+				gu::uint32 indices[BATCH_SIZE] = {};
+				for (int batch = 0; batch < BATCH_PER_THREAD; ++batch)
+				{
+					for (auto& index : indices) { index = allocator.Allocate(); }
+					for (const auto index : indices) { allocator.Free(index); }
+				}
+			});
+		}
+		for (auto& thread : threads) { thread.join(); }
+
+		const auto seconds   = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		const auto operation = static_cast<double>(threadCount) * BATCH_PER_THREAD * BATCH_SIZE * 2;
+		return seconds * 1e9 / operation;
+	}
+}
+
+int main()
+{
+	std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+	std::printf("threads | DescriptorIndexAllocator [ns/op] | mutex + std::queue [ns/op]\n");
+
+	for (const int threadCount : { 1, 2, 4, 8 })
+	{
+		DescriptorIndexAllocator indexAllocator(CAPACITY);
+		QueueIndexAllocator      queueAllocator;
+
+		const auto indexTime = Measure(indexAllocator, threadCount);
+		const auto queueTime = Measure(queueAllocator, threadCount);
+		std::printf("%7d | %32.1f | %26.1f\n", threadCount, indexTime, queueTime);
+	}
+	return 0;
+}
@@ -0,0 +1,368 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DescriptorAllocatorTest.cpp
+///  @brief  fBXNv^̃AP[^CPŨeXgł. eʂς܂ł̔s, Xbh̔sƉ, @n
+///          t[Ƃ̐`AP[^̃tFXlɂėp, XbhƂ͈͂̔̕smF܂. @n
+///          g++ -std=c++20 -O1 -g -fsanitize=address,undefined -D__forceinline=inline -I../.. DescriptorAllocatorTest.cpp ../../GraphicsCore/RHI/InterfaceCore/Core/Source/RHIDescriptorAllocator.cpp @n
+///          f[^̊mFASan̑-fsanitize=threadŃrhĂ.
+///  @author toide
+///  @date   2026/10/21 14:03:27
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIDescriptorAllocator.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+namespace
+{
+	/****************************************************************************
+	*           eʂς܂Ŕs, SĈقȂCfbNXł邱
+	****************************************************************************/
+	void TestFillToCapacity()
+	{
+		// 64̔{łȂeʂ, ʂ̃rbgZbg[hɂȂeʂmF܂
+		for (const gu::uint32 capacity : { 1u, 63u, 64u, 65u, 1000u, 4096u, 4097u, 100000u })
+		{
+			DescriptorIndexAllocator allocator(capacity);
+			std::vector<bool> used(capacity, false);
+
+			for (gu::uint32 i = 0; i < capacity; ++i)
+			{
+				const auto index = allocator.Allocate();
+				TEST_CHECK(index < capacity);
+				TEST_CHECK(!used[index]);
+				TEST_CHECK(allocator.IsAllocated(index));
+				used[index] = true;
+			}
+
+			TEST_CHECK(allocator.GetAllocatedCount() == capacity);
+			TEST_CHECK(allocator.Allocate() == DescriptorIndexAllocator::INVALID_INDEX);
+
+			/*-------------------------------------------------------------------
+			-      1, CfbNXĂєs܂
+			---------------------------------------------------------------------*/
+			const auto freed = capacity / 2;
+			TEST_CHECK(allocator.Free(freed));
+			TEST_CHECK(!allocator.IsAllocated(freed));
+			TEST_CHECK(allocator.Allocate() == freed);
+			TEST_CHECK(allocator.Allocate() == DescriptorIndexAllocator::INVALID_INDEX);
+
+			allocator.Reset();
+			TEST_CHECK(allocator.GetAllocatedCount() == 0);
+			TEST_CHECK(allocator.Allocate() != DescriptorIndexAllocator::INVALID_INDEX);
+		}
+	}
+
+	/****************************************************************************
+	*           ͈͊OƓdfalseԂ (_DEBUGłCheckfŒ~܂)
+	****************************************************************************/
+	void TestInvalidFree()
+	{
+		DescriptorIndexAllocator allocator(128);
+
+		const auto index = allocator.Allocate();
+		TEST_CHECK(!allocator.Free(128));
+		TEST_CHECK(!allocator.Free(DescriptorIndexAllocator::INVALID_INDEX));
+		TEST_CHECK(allocator.Free(index));
+#ifndef _DEBUG
+		TEST_CHECK(!allocator.Free(index));
+#endif
+		TEST_CHECK(allocator.GetAllocatedCount() == 0);
+	}
+
+	/****************************************************************************
+	*           ResizeŔsς݂̃CfbNXۂ
+	****************************************************************************/
+	void TestResize()
+	{
+		DescriptorIndexAllocator allocator(100);
+
+		std::vector<gu::uint32> indices;
+		for (int i = 0; i < 100; ++i) { indices.push_back(allocator.Allocate()); }
+		for (int i = 0; i < 100; i += 2) { TEST_CHECK(allocator.Free(indices[i])); }
+
+		/*-------------------------------------------------------------------
+		-      g: cĂ50͔sς݂̂܂, V͈͂͋
+		---------------------------------------------------------------------*/
+		allocator.Resize(300);
+		TEST_CHECK(allocator.GetCapacity() == 300);
+		TEST_CHECK(allocator.GetAllocatedCount() == 50);
+		for (int i = 0; i < 100; ++i) { TEST_CHECK(allocator.IsAllocated(indices[i]) == (i % 2 == 1)); }
+
+		for (int i = 0; i < 250; ++i) { TEST_CHECK(allocator.Allocate() != DescriptorIndexAllocator::INVALID_INDEX); }
+		TEST_CHECK(allocator.Allocate() == DescriptorIndexAllocator::INVALID_INDEX);
+
+		/*-------------------------------------------------------------------
+		-      k: ͈͊ÕCfbNX͔j܂
+		---------------------------------------------------------------------*/
+		allocator.Resize(70);
+		TEST_CHECK(allocator.GetAllocatedCount() == 70);
+		TEST_CHECK(allocator.Allocate() == DescriptorIndexAllocator::INVALID_INDEX);
+		TEST_CHECK(!allocator.IsAllocated(70));
+	}
+
+	/****************************************************************************
+	*           8Xbh瓯ɔsƉJԂ, CfbNX2̃XbhȂ
+	****************************************************************************/
+	void TestThreadChurn()
+	{
+		constexpr gu::uint32 capacity    = 1024;
+		constexpr int        threadCount = 8;
+		constexpr int        iterations  = 200000;
+
+		DescriptorIndexAllocator allocator(capacity);
+
+		// CfbNXƂ̏L. s0珑ȂΓdsł
+		std::vector<std::atomic<int>> owners(capacity);
+		for (auto& owner : owners) { owner.store(0); }
+
+		std::atomic<gu::uint64> failedCount = 0;
+		std::atomic<bool>       isBroken    = false;
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < threadCount; ++t)
+		{
+			threads.emplace_back([&, t]()
+			{
+				std::mt19937 random(static_cast<unsigned>(t + 1));
+				std::vector<gu::uint32> held;
+
+				for (int i = 0; i < iterations && !isBroken.load(std::memory_order_relaxed); ++i)
+				{
+					// 1Xbheʂ1/8葽ێ悤Ƃ邽, Ŝł͗eʕsN܂
+					const bool shouldAllocate = held.empty() || (held.size() < capacity / threadCount + 64 && random() % 4 != 0);
+					if (shouldAllocate)
+					{
+						const auto index = allocator.Allocate();
+						if (index == DescriptorIndexAllocator::INVALID_INDEX) { failedCount.fetch_add(1, std::memory_order_relaxed); continue; }
+
+						int expected = 0;
+						if (index >= capacity || !owners[index].compare_exchange_strong(expected, t + 1)) { isBroken = true; break; }
+						held.push_back(index);
+					}
+					else
+					{
+						const auto position = random() % held.size();
+						const auto index    = held[position];
+						held[position] = held.back();
+						held.pop_back();
+
+						owners[index].store(0);
+						if (!allocator.Free(index)) { isBroken = true; break; }
+					}
+				}
+
+				for (const auto index : held)
+				{
+					owners[index].store(0);
+					if (!allocator.Free(index)) { isBroken = true; }
+				}
+			});
+		}
+		for (auto& thread : threads) { thread.join(); }
+
+		TEST_CHECK(!isBroken.load());
+		TEST_CHECK(allocator.GetAllocatedCount() == 0);
+
+		/*-------------------------------------------------------------------
+		-      Sĉ, Ăїeʂς܂Ŕsł܂
+		---------------------------------------------------------------------*/
+		for (gu::uint32 i = 0; i < capacity; ++i) { TEST_CHECK(allocator.Allocate() != DescriptorIndexAllocator::INVALID_INDEX); }
+		TEST_CHECK(allocator.Allocate() == DescriptorIndexAllocator::INVALID_INDEX);
+		std::printf("thread churn: %d threads x %d, failed allocations: %llu\n", threadCount, iterations, (unsigned long long)failedCount.load());
+	}
+
+	/****************************************************************************
+	*           `AP[^̓tFXl܂Ŕ͈͂ėpȂ
+	****************************************************************************/
+	void TestLinearFenceRecycle()
+	{
+		constexpr gu::uint32 offset   = 1000;
+		constexpr gu::uint32 capacity = 100;
+
+		DescriptorLinearAllocator allocator(offset, capacity);
+		gu::uint32 index = 0;
+
+		TEST_CHECK(!allocator.Allocate(0, index));
+		TEST_CHECK(!allocator.Allocate(capacity + 1, index));
+
+		/*-------------------------------------------------------------------
+		-      t[1: [0, 60)
+		---------------------------------------------------------------------*/
+		TEST_CHECK(allocator.Allocate(30, index) && index == offset);
+		TEST_CHECK(allocator.Allocate(30, index) && index == offset + 30);
+		allocator.EndFrame(1);
+
+		/*-------------------------------------------------------------------
+		-      t[2: [60, 90). c10ł͑肸, 擪̓t[1gp̂ߎs܂
+		---------------------------------------------------------------------*/
+		TEST_CHECK(allocator.Allocate(30, index) && index == offset + 60);
+		TEST_CHECK(!allocator.Allocate(20, index));
+		TEST_CHECK(allocator.GetUsedCount() == 90);
+		allocator.EndFrame(2);
+
+		/*-------------------------------------------------------------------
+		-      ܂ĂȂtFXlł͍ėp܂
+		---------------------------------------------------------------------*/
+		allocator.Recycle(0);
+		TEST_CHECK(allocator.GetUsedCount() == 90);
+		TEST_CHECK(!allocator.Allocate(20, index));
+
+		/*-------------------------------------------------------------------
+		-      t[1̊͐擪甭s܂. 10͓ǂݔ΂, t[2͈̔͂Ƃ͏dȂ܂
+		---------------------------------------------------------------------*/
+		allocator.Recycle(1);
+		TEST_CHECK(allocator.Allocate(20, index) && index == offset);
+		TEST_CHECK(allocator.Allocate(40, index) && index == offset + 20);
+		TEST_CHECK(!allocator.Allocate(1, index));
+		allocator.EndFrame(3);
+
+		/*-------------------------------------------------------------------
+		-      ̃t[܂Ƃ߂ĊƑSċ󂫂܂
+		---------------------------------------------------------------------*/
+		allocator.Recycle(3);
+		TEST_CHECK(allocator.GetUsedCount() == 0);
+		TEST_CHECK(allocator.Allocate(capacity - 60, index) && index == offset + 60);
+		TEST_CHECK(allocator.Allocate(60, index) && index == offset);
+		TEST_CHECK(allocator.GetUsedCount() == capacity);
+
+		allocator.Reset();
+		TEST_CHECK(allocator.GetUsedCount() == 0);
+		TEST_CHECK(allocator.Allocate(capacity, index) && index == offset);
+	}
+
+	/****************************************************************************
+	*           XbhƂ͈͂̓̕`NPʂŐemۂ, ݂ɏdȂȂ
+	****************************************************************************/
+	void TestThreadRange()
+	{
+		DescriptorLinearAllocator parent(0, 512);
+		DescriptorThreadRange     first (parent, 64);
+		DescriptorThreadRange     second(parent, 64);
+		gu::uint32 index = 0;
+
+		TEST_CHECK(first .Allocate(1, index) && index == 0);
+		TEST_CHECK(second.Allocate(1, index) && index == 64);
+		TEST_CHECK(first.GetRemainingCount() == 63);
+
+		// `N̎c肩͐eg킸ɘAĔs܂
+		TEST_CHECK(first.Allocate(63, index) && index == 1);
+		TEST_CHECK(parent.GetUsedCount() == 128);
+
+		// g؂Ǝ̃`Nmۂ܂. `N傫ꍇ͂̑傫Ŋmۂ܂
+		TEST_CHECK(first.Allocate(1, index) && index == 128);
+		TEST_CHECK(second.Allocate(100, index) && index == 192);
+		TEST_CHECK(second.GetRemainingCount() == 0);
+		TEST_CHECK(parent.GetUsedCount() == 292);
+
+		// e̖Ɏ܂炸, 擪͎gp̂ߎs܂
+		TEST_CHECK(!second.Allocate(300, index));
+
+		/*-------------------------------------------------------------------
+		-      t[̊Reset, ȇV`Nmۂ܂
+		---------------------------------------------------------------------*/
+		parent.EndFrame(1);
+		parent.Recycle(1);
+		first .Reset();
+		second.Reset();
+		TEST_CHECK(first.GetRemainingCount() == 0);
+		TEST_CHECK(parent.GetUsedCount() == 0);
+		TEST_CHECK(second.Allocate(200, index) && index == 292);
+
+		// ̎c (20) Ƀ`N܂Ȃ, ܂ɐ擪mۂ܂
+		TEST_CHECK(first .Allocate(1, index)  && index == 0);
+		TEST_CHECK(second.Allocate(20, index) && index == 64);
+		TEST_CHECK(parent.GetUsedCount() == 200 + 20 + 64 * 2); // ǂݔ΂20܂݂܂
+	}
+
+	/****************************************************************************
+	*           8Xbh͈͂甭s, 2t[xōėpĂ, gp͈̔͂d˂ĔsȂ
+	****************************************************************************/
+	void TestThreadRangeFrames()
+	{
+		constexpr gu::uint32 capacity       = 512;
+		constexpr gu::uint32 chunkSize      = 16;
+		constexpr int        threadCount    = 8;
+		constexpr int        frameCount     = 2000;
+		constexpr int        drawsPerThread = 32;
+
+		DescriptorLinearAllocator parent(0, capacity);
+
+		// CfbNXƂɍŌɔst[. 1Õt[͈̔͂͂܂GPUŎgpƂ݂Ȃ܂
+		std::vector<std::atomic<gu::uint64>> ownerFrames(capacity);
+		for (auto& ownerFrame : ownerFrames) { ownerFrame.store(0); }
+
+		std::atomic<gu::uint64> failedCount = 0;
+		std::atomic<bool>       isBroken    = false;
+
+		std::vector<std::unique_ptr<DescriptorThreadRange>> ranges;
+		for (int t = 0; t < threadCount; ++t) { ranges.push_back(std::make_unique<DescriptorThreadRange>(parent, chunkSize)); }
+
+		for (gu::uint64 frame = 1; frame <= frameCount && !isBroken.load(); ++frame)
+		{
+			std::vector<std::thread> threads;
+			for (int t = 0; t < threadCount; ++t)
+			{
+				threads.emplace_back([&, t]()
+				{
+					std::mt19937 random(static_cast<unsigned>(frame * threadCount + t));
+					auto& range = *ranges[t];
+
+					for (int i = 0; i < drawsPerThread; ++i)
+					{
+						const gu::uint32 count = 1 + random() % 2;
+						gu::uint32 index = 0;
+						if (!range.Allocate(count, index)) { failedCount.fetch_add(1, std::memory_order_relaxed); continue; }
+						if (index + count > capacity)      { isBroken = true; return; }
+
+						for (gu::uint32 j = index; j < index + count; ++j)
+						{
+							const auto previous = ownerFrames[j].exchange(frame);
+							if (previous != 0 && previous + 2 > frame) { isBroken = true; return; }
+						}
+					}
+				});
+			}
+			for (auto& thread : threads) { thread.join(); }
+
+			/*-------------------------------------------------------------------
+			-      `Xbh: ̃t[L^, 1Õt[̊󂯎܂
+			---------------------------------------------------------------------*/
+			parent.EndFrame(frame);
+			parent.Recycle(frame - 1);
+			for (auto& range : ranges) { range->Reset(); }
+		}
+
+		// 1t[̎gpʂ͍ő 8 * (32 * 2 + 16) = 640 ŗeʂ𒴂邽, s̎sƖ̐܂ԂN܂. 1Õt[𑁂ėpƏdƂČo܂
+		TEST_CHECK(!isBroken.load());
+		std::printf("thread range frames: %d threads x %d frames, failed allocations: %llu\n", threadCount, frameCount, (unsigned long long)failedCount.load());
+	}
+}
+
+int main()
+{
+	TestFillToCapacity();
+	TestInvalidFree();
+	TestResize();
+	TestThreadChurn();
+	TestLinearFenceRecycle();
+	TestThreadRange();
+	TestThreadRangeFrames();
+	std::printf("DescriptorAllocatorTest passed\n");
+	return 0;
+}
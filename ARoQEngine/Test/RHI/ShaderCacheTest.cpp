@@ -0,0 +1,303 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   ShaderCacheTest.cpp
+///  @brief  GPUShaderCachẽeXgł. t@Cǂނ̃X^ũRpCg, @n
+///          ƃfBXÑqbg, ~X, ˑt@C̕ύXɂ閳mF܂. @n
+///          GUStringMSVC̊gg, clŃrh܂. @n
+///          cl /std:c++20 /EHsc /O2 /I..\.. ShaderCacheTest.cpp ..\..\GraphicsCore\RHI\InterfaceCore\PipelineState\Source\GPUShaderCache.cpp ..\..\GameUtility\Base\Source\GUHash.cpp ..\..\GameUtility\Base\Source\GUParse.cpp ..\..\GameUtility\Base\Source\GUCommandLine.cpp ..\..\GameUtility\Base\Source\GUAssert.cpp ..\..\GameUtility\Thread\Public\Source\GUThreadPool.cpp
+///  @author toide
+///  @date   2026/10/23 16:31:44
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/PipelineState/Include/GPUShaderCache.hpp"
+#include "GameUtility/Base/Include/GUHash.hpp"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+namespace
+{
+	/*! @brief eXgp̃t@CufBNg*/
+	const std::filesystem::path TEST_DIRECTORY = std::filesystem::temp_directory_path() / "ARoQShaderCacheTest";
+
+	/*! @brief std::filesystem::pathgu::tstringɕϊ܂*/
+	gu::tstring ToTString(const std::filesystem::path& path)
+	{
+	#if NEED_WIDE_CHAR
+		return gu::tstring(path.wstring().c_str());
+	#else
+		return gu::tstring(path.u16string().c_str());
+	#endif
+	}
+
+	/*! @brief t@C̓eSēǂݍ݂܂*/
+	bool ReadText(const gu::tstring& filePath, std::string& text)
+	{
+		std::ifstream stream(std::filesystem::path(filePath.CString()), std::ios::binary);
+		if (!stream) { return false; }
+
+		text.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+		return true;
+	}
+
+	/*! @brief t@C܂*/
+	void WriteText(const std::filesystem::path& filePath, const std::string& text)
+	{
+		std::ofstream stream(filePath, std::ios::binary | std::ios::trunc);
+		stream << text;
+	}
+
+	/*! @brief uu̓e𕶎ƂĕԂ܂*/
+	std::string ToText(const GPUShaderCache::BlobPointer& blob)
+	{
+		return std::string(reinterpret_cast<const char*>(blob->ByteCode.Data()), static_cast<size_t>(blob->ByteCode.Size()));
+	}
+
+	/****************************************************************************
+	*				  			StubCompiler
+	****************************************************************************/
+	/* @brief  C̃\[Xincludet@Cǂ, eÂoCgR[hƂĕԂ܂.
+	*****************************************************************************/
+	class StubCompiler : public IShaderCacheCompiler
+	{
+	public:
+		bool Compile(const ShaderCompilerOption& option, ShaderCacheBlob& result, gu::DynamicArray<ShaderDependency>& dependencies) override
+		{
+			CompileCount++;
+
+			std::string byteCode = {};
+			for (const auto& filePath : { option.FileName, IncludeFile })
+			{
+				std::string text = {};
+				if (!ReadText(filePath, text)) { return false; }
+
+				dependencies.Push({ filePath, gu::Hash::XX_64(text.data(), text.size()) });
+				byteCode += text;
+			}
+
+			result.ByteCode.Resize(byteCode.size());
+			std::copy(byteCode.begin(), byteCode.end(), reinterpret_cast<char*>(result.ByteCode.Data()));
+			return true;
+		}
+
+		gu::uint64 GetCompilerHash() const override { return CompilerHash; }
+
+		/*! @brief SẴVF[_[ǂݍincludet@C*/
+		gu::tstring IncludeFile = SP("");
+
+		/*! @brief RpC̃nbVl. ςƃfBXÑLbVɂȂ܂*/
+		gu::uint64 CompilerHash = 1;
+
+		/*! @brief CompileĂ΂ꂽ*/
+		std::atomic<gu::uint32> CompileCount = 0;
+	};
+
+	/*! @brief eXgp̃VF[_[includet@C蒼܂*/
+	gu::SharedPointer<StubCompiler> Setup()
+	{
+		std::filesystem::remove_all(TEST_DIRECTORY);
+		std::filesystem::create_directories(TEST_DIRECTORY / "Source");
+		WriteText(TEST_DIRECTORY / "Source" / "Main.hlsl"  , "main;");
+		WriteText(TEST_DIRECTORY / "Source" / "Common.hlsl", "common;");
+
+		auto compiler = gu::MakeShared<StubCompiler>();
+		compiler->IncludeFile = ToTString(TEST_DIRECTORY / "Source" / "Common.hlsl");
+		return compiler;
+	}
+
+	/*! @brief eXgp̃VF[_[̃RpCݒ*/
+	ShaderCompilerOption MakeOption()
+	{
+		ShaderCompilerOption option = {};
+		option.FileName   = ToTString(TEST_DIRECTORY / "Source" / "Main.hlsl");
+		option.EntryPoint = SP("VSMain");
+		return option;
+	}
+
+	/****************************************************************************
+	*           ̓RpC, 2ڂ̓Ԃ
+	****************************************************************************/
+	void TestMissAndMemoryHit()
+	{
+		const auto compiler = Setup();
+		GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+
+		const auto first = cache.GetOrCompile(MakeOption());
+		TEST_CHECK(first);
+		TEST_CHECK(ToText(first) == "main;common;");
+		TEST_CHECK(compiler->CompileCount == 1);
+
+		const auto second = cache.GetOrCompile(MakeOption());
+		TEST_CHECK(second.Get() == first.Get());
+		TEST_CHECK(compiler->CompileCount == 1);
+
+		// defineقȂꍇ͕ʂ̃Ggł
+		auto option = MakeOption();
+		option.Defines.Push(SP("USE_SHADOW=1"));
+		TEST_CHECK(cache.ComputeOptionHash(option) != cache.ComputeOptionHash(MakeOption()));
+		TEST_CHECK(cache.GetOrCompile(option));
+		TEST_CHECK(compiler->CompileCount == 2);
+
+		const auto statistics = cache.GetStatistics();
+		TEST_CHECK(statistics.RequestCount     == 3);
+		TEST_CHECK(statistics.MemoryHitCount   == 1);
+		TEST_CHECK(statistics.DiskHitCount     == 0);
+		TEST_CHECK(statistics.CompileCount     == 2);
+		TEST_CHECK(statistics.InvalidatedCount == 0);
+		TEST_CHECK(std::filesystem::exists(TEST_DIRECTORY / "Cache"));
+		std::printf("miss and memory hit: ok\n");
+	}
+
+	/****************************************************************************
+	*           ʂ̃CX^Xł̓fBXNǂݍ, RpCςꍇ͓ǂݍ܂Ȃ
+	****************************************************************************/
+	void TestDiskHit()
+	{
+		const auto compiler = Setup();
+		{
+			GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+			TEST_CHECK(cache.GetOrCompile(MakeOption()));
+		}
+		TEST_CHECK(compiler->CompileCount == 1);
+
+		{
+			GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+			const auto blob = cache.GetOrCompile(MakeOption());
+			TEST_CHECK(blob);
+			TEST_CHECK(ToText(blob) == "main;common;");
+			TEST_CHECK(compiler->CompileCount == 1);
+			TEST_CHECK(cache.GetStatistics().DiskHitCount == 1);
+		}
+
+		// ꂽLbVt@C͓ǂݍ܂ɃRpC܂
+		for (const auto& file : std::filesystem::directory_iterator(TEST_DIRECTORY / "Cache"))
+		{
+			std::filesystem::resize_file(file.path(), 8);
+		}
+		{
+			GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+			TEST_CHECK(cache.GetOrCompile(MakeOption()));
+			TEST_CHECK(compiler->CompileCount == 2);
+			TEST_CHECK(cache.GetStatistics().DiskHitCount == 0);
+		}
+
+		compiler->CompilerHash = 2;
+		{
+			GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+			TEST_CHECK(cache.GetOrCompile(MakeOption()));
+			TEST_CHECK(compiler->CompileCount == 3);
+			TEST_CHECK(cache.GetStatistics().DiskHitCount == 0);
+		}
+		std::printf("disk hit: ok\n");
+	}
+
+	/****************************************************************************
+	*           includet@Cςꍇ̓ƃfBXÑLbVj邱
+	****************************************************************************/
+	void TestInvalidation()
+	{
+		const auto compiler = Setup();
+		const auto includeFile = TEST_DIRECTORY / "Source" / "Common.hlsl";
+		{
+			GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+			TEST_CHECK(cache.GetOrCompile(MakeOption()));
+
+			/*-------------------------------------------------------------------
+			-      ʒm܂ł̓t@CẽnbVlČvZ܂
+			---------------------------------------------------------------------*/
+			WriteText(includeFile, "common2;");
+			TEST_CHECK(ToText(cache.GetOrCompile(MakeOption())) == "main;common;");
+			TEST_CHECK(compiler->CompileCount == 1);
+
+			cache.InvalidateFile(compiler->IncludeFile);
+			TEST_CHECK(ToText(cache.GetOrCompile(MakeOption())) == "main;common2;");
+			TEST_CHECK(compiler->CompileCount == 2);
+			TEST_CHECK(cache.GetStatistics().InvalidatedCount == 1);
+
+			// e߂ꍇăRpC܂
+			WriteText(includeFile, "common;");
+			cache.InvalidateAllFiles();
+			TEST_CHECK(ToText(cache.GetOrCompile(MakeOption())) == "main;common;");
+			TEST_CHECK(compiler->CompileCount == 3);
+			TEST_CHECK(cache.GetStatistics().InvalidatedCount == 2);
+		}
+
+		/*-------------------------------------------------------------------
+		-      sĂȂԂ̕ύX̓fBXÑLbVǂݍ񂾎Ɍo܂
+		---------------------------------------------------------------------*/
+		WriteText(includeFile, "common3;");
+		{
+			GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+			TEST_CHECK(ToText(cache.GetOrCompile(MakeOption())) == "main;common3;");
+			TEST_CHECK(compiler->CompileCount == 4);
+
+			const auto statistics = cache.GetStatistics();
+			TEST_CHECK(statistics.DiskHitCount     == 0);
+			TEST_CHECK(statistics.InvalidatedCount == 1);
+		}
+		std::printf("invalidation: ok\n");
+	}
+
+	/****************************************************************************
+	*           sʂ̓LbV, ɗvꂽݒ1xRpC邱
+	****************************************************************************/
+	void TestFailureAndBatch()
+	{
+		const auto compiler = Setup();
+		GPUShaderCache cache(gu::StaticPointerCast<IShaderCacheCompiler>(compiler), ToTString(TEST_DIRECTORY / "Cache"));
+
+		auto missing = MakeOption();
+		missing.FileName = ToTString(TEST_DIRECTORY / "Source" / "Missing.hlsl");
+		TEST_CHECK(!cache.GetOrCompile(missing));
+		TEST_CHECK(!cache.GetOrCompile(missing));
+		TEST_CHECK(compiler->CompileCount == 2);
+		TEST_CHECK(cache.GetStatistics().FailedCount == 2);
+
+		WriteText(TEST_DIRECTORY / "Source" / "Missing.hlsl", "fixed;");
+		TEST_CHECK(ToText(cache.GetOrCompile(missing)) == "fixed;common;");
+		TEST_CHECK(compiler->CompileCount == 3);
+
+		gu::DynamicArray<ShaderCompilerOption> options = {};
+		for (int i = 0; i < 16; ++i)
+		{
+			auto option = MakeOption();
+			option.Defines.Push(i % 2 == 0 ? SP("PERMUTATION=0") : SP("PERMUTATION=1"));
+			options.Push(option);
+		}
+
+		const auto results = cache.CompileBatch(options);
+		TEST_CHECK(results.Size() == options.Size());
+		for (gu::uint64 i = 0; i < results.Size(); ++i)
+		{
+			TEST_CHECK(results[i]);
+			TEST_CHECK(results[i].Get() == results[i % 2].Get());
+		}
+		TEST_CHECK(compiler->CompileCount == 5);
+		std::printf("failure and batch: ok\n");
+	}
+}
+
+int main()
+{
+	TestMissAndMemoryHit();
+	TestDiskHit();
+	TestInvalidation();
+	TestFailureAndBatch();
+
+	std::filesystem::remove_all(TEST_DIRECTORY);
+	std::printf("ShaderCacheTest passed\n");
+	return 0;
+}
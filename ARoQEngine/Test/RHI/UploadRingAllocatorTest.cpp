@@ -0,0 +1,178 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   UploadRingAllocatorTest.cpp
+///  @brief  UploadRingAllocatorCPŨeXgł. GPUg킸Ƀt[̔sƍėpČ܂. @n
+///          g++ -std=c++20 -O1 -g -fsanitize=address,undefined -D__forceinline=inline -I../.. UploadRingAllocatorTest.cpp ../../GraphicsCore/RHI/InterfaceCore/Core/Source/RHIUploadRingAllocator.cpp
+///  @author toide
+///  @date   2026/10/21 10:12:31
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RHI/InterfaceCore/Core/Include/RHIUploadRingAllocator.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+using namespace rhi::core;
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+namespace
+{
+	/*! @brief sꂽ̈*/
+	struct Region
+	{
+		gu::uint64 Offset = 0;
+		gu::uint64 Size   = 0;
+		gu::uint64 Fence  = 0;
+	};
+
+	/*! @brief 2̗̈悪dȂĂ邩*/
+	bool IsOverlapped(const Region& a, const Region& b)
+	{
+		return a.Offset < b.Offset + b.Size && b.Offset < a.Offset + a.Size;
+	}
+
+	/****************************************************************************
+	*           t[ƂGPŮ҂ꍇ (t[ɂȂ)
+	****************************************************************************/
+	void TestRecycleEveryFrame()
+	{
+		UploadRingAllocator allocator(4096);
+
+		for (gu::uint64 frame = 1; frame <= 64; ++frame)
+		{
+			const auto offset = allocator.Allocate(300);
+			TEST_CHECK(offset != UploadRingAllocator::INVALID_OFFSET);
+			TEST_CHECK(offset % UploadRingAllocator::DEFAULT_ALIGNMENT == 0);
+			TEST_CHECK(allocator.GetFrameAllocationCount() == 1);
+
+			allocator.EndFrame(frame);
+			TEST_CHECK(allocator.GetPendingFrameCount() == 1);
+
+			allocator.Recycle(frame);
+			TEST_CHECK(allocator.GetPendingFrameCount() == 0);
+			TEST_CHECK(allocator.GetUsedSize() == 0);
+		}
+	}
+
+	/****************************************************************************
+	*           eʂg؂ꍇ, ɍĂюgꍇ
+	****************************************************************************/
+	void TestCapacity()
+	{
+		UploadRingAllocator allocator(1024);
+
+		for (int i = 0; i < 4; ++i)
+		{
+			TEST_CHECK(allocator.Allocate(256) == static_cast<gu::uint64>(i) * 256);
+		}
+		TEST_CHECK(allocator.Allocate(1) == UploadRingAllocator::INVALID_OFFSET);
+		TEST_CHECK(allocator.Allocate(0) == UploadRingAllocator::INVALID_OFFSET);
+		TEST_CHECK(allocator.Allocate(2048) == UploadRingAllocator::INVALID_OFFSET);
+
+		allocator.EndFrame(1);
+		allocator.Recycle(0);
+		TEST_CHECK(allocator.Allocate(1) == UploadRingAllocator::INVALID_OFFSET);
+
+		allocator.Recycle(1);
+		TEST_CHECK(allocator.GetUsedSize() == 0);
+		TEST_CHECK(allocator.Allocate(1024) == 0);
+
+		allocator.Reset();
+		TEST_CHECK(allocator.GetUsedSize() == 0);
+		TEST_CHECK(allocator.GetPendingFrameCount() == 0);
+	}
+
+	/****************************************************************************
+	*           Ɏ܂Ȃꍇ͐擪܂Ԃ
+	****************************************************************************/
+	void TestWrapAround()
+	{
+		UploadRingAllocator allocator(1024);
+
+		TEST_CHECK(allocator.Allocate(512) == 0);
+		allocator.EndFrame(1);
+		TEST_CHECK(allocator.Allocate(256) == 512);
+		allocator.EndFrame(2);
+		allocator.Recycle(1);
+
+		// 256byteɂ͎܂Ȃߐ擪mۂ, ̗]gpʂɊ܂߂܂
+		TEST_CHECK(allocator.Allocate(384) == 0);
+		TEST_CHECK(allocator.GetUsedSize() == 256 + 256 + 384);
+
+		// ܂Ԃ [head, tail) ̂ݎg܂
+		TEST_CHECK(allocator.Allocate(256) == UploadRingAllocator::INVALID_OFFSET);
+		allocator.EndFrame(3);
+		allocator.Recycle(3);
+		TEST_CHECK(allocator.GetUsedSize() == 0);
+	}
+
+	/****************************************************************************
+	*           GPU̒x_ɂꍇ, gp̗̈悪dȂȂ
+	****************************************************************************/
+	void TestRandomFrames()
+	{
+		constexpr gu::uint64 capacity   = 64 * 1024;
+		constexpr gu::uint64 frameCount = 20000;
+
+		UploadRingAllocator allocator(capacity);
+		std::mt19937_64     random(12345);
+		std::vector<Region> live = {};
+
+		gu::uint64 completed = 0;
+		gu::uint64 failed    = 0;
+		for (gu::uint64 frame = 1; frame <= frameCount; ++frame)
+		{
+			const auto allocationCount = random() % 16;
+			for (gu::uint64 i = 0; i < allocationCount; ++i)
+			{
+				const gu::uint64 size      = 1 + random() % 4096;
+				const gu::uint64 alignment = gu::uint64(1) << (random() % 9);
+				const gu::uint64 offset    = allocator.Allocate(size, alignment);
+				if (offset == UploadRingAllocator::INVALID_OFFSET) { failed++; continue; }
+
+				const Region region = { offset, size, frame };
+				TEST_CHECK(offset % alignment == 0);
+				TEST_CHECK(offset + size <= capacity);
+				for (const auto& other : live)
+				{
+					TEST_CHECK(!IsOverlapped(region, other));
+				}
+				live.push_back(region);
+			}
+
+			allocator.EndFrame(frame);
+
+			// GPU03t[xĊ܂
+			const gu::uint64 latency = random() % 4;
+			if (frame > latency && frame - latency > completed) { completed = frame - latency; }
+			allocator.Recycle(completed);
+
+			std::erase_if(live, [completed](const Region& region) { return region.Fence <= completed; });
+			TEST_CHECK(live.empty() == (allocator.GetUsedSize() == 0));
+			TEST_CHECK(allocator.GetUsedSize() <= capacity);
+		}
+
+		allocator.Recycle(frameCount);
+		TEST_CHECK(allocator.GetUsedSize() == 0);
+		TEST_CHECK(allocator.GetPendingFrameCount() == 0);
+		std::printf("random frames: %llu, failed allocations: %llu\n", (unsigned long long)frameCount, (unsigned long long)failed);
+	}
+}
+
+int main()
+{
+	TestRecycleEveryFrame();
+	TestCapacity();
+	TestWrapAround();
+	TestRandomFrames();
+	std::printf("UploadRingAllocatorTest passed\n");
+	return 0;
+}
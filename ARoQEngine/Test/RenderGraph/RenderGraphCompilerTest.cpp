@@ -0,0 +1,434 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   RenderGraphCompilerTest.cpp
+///  @brief  GPUg킸RenderGraphCompiler̃JO, oA̔zu, ꎞ\[X̕ʖ蓖ĂmF܂. @n
+///          ŌURP::BuildRenderGraphƓ錾 (SSAÖꎞeNX`܂) RpC, v\܂. @n
+///          GUStringMSVC̊gg, clŃrh܂. @n
+///          cl /std:c++20 /EHsc /O2 /I..\.. RenderGraphCompilerTest.cpp ..\..\GraphicsCore\RenderGraph\Source\RenderGraphCompiler.cpp ..\..\GraphicsCore\RHI\InterfaceCore\Core\Source\RHIPixelFormat.cpp ..\..\GameUtility\Base\Source\GUAssert.cpp
+///  @author toide
+///  @date   2026/10/23 10:21:47
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GraphicsCore/RenderGraph/Include/RenderGraphCompiler.hpp"
+#include <cstdio>
+#include <cstdlib>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+using namespace rhi::core;
+using namespace rhi::graph;
+
+namespace
+{
+	/*! @brief 쐬̏ԂCommonɂ_[^[Qbg̍쐬*/
+	GPUTextureMetaData MakeTarget(const gu::uint32 width, const gu::uint32 height, const PixelFormat format = PixelFormat::R8G8B8A8_UNORM)
+	{
+		GPUTextureMetaData metaData = {};
+		metaData.Width       = width;
+		metaData.Height      = height;
+		metaData.PixelFormat = format;
+		metaData.Usage       = TextureCreateFlags::RenderTargetable | TextureCreateFlags::ShaderResource;
+		metaData.State       = ResourceState::Common;
+		return metaData;
+	}
+
+	/****************************************************************************
+	*           \[XƃpX̋LqgݗĂ⏕
+	****************************************************************************/
+	struct GraphBuilder
+	{
+		gu::DynamicArray<ResourceDesc> Resources = {};
+		gu::DynamicArray<PassDesc>     Passes    = {};
+
+		gu::uint32 Import(const ResourceState initialState)
+		{
+			ResourceDesc desc = {};
+			desc.IsImported   = true;
+			desc.InitialState = initialState;
+			Resources.Push(desc);
+			return static_cast<gu::uint32>(Resources.Size() - 1);
+		}
+
+		gu::uint32 Import(const ResourceState initialState, const ResourceState finalState)
+		{
+			const auto index = Import(initialState);
+			Resources[index].HasFinalState = true;
+			Resources[index].FinalState    = finalState;
+			return index;
+		}
+
+		gu::uint32 Create(const GPUTextureMetaData& metaData)
+		{
+			ResourceDesc desc = {};
+			desc.TextureDesc  = metaData;
+			Resources.Push(desc);
+			return static_cast<gu::uint32>(Resources.Size() - 1);
+		}
+
+		GraphBuilder& Pass(const PassFlags flags = PassFlags::None)
+		{
+			PassDesc pass = {};
+			pass.Flags = flags;
+			Passes.Push(pass);
+			return *this;
+		}
+
+		GraphBuilder& Read(const gu::uint32 resource, const ResourceState state)
+		{
+			Passes.Back().Accesses.Push({ resource, state, true, false });
+			return *this;
+		}
+
+		GraphBuilder& Write(const gu::uint32 resource, const ResourceState state)
+		{
+			Passes.Back().Accesses.Push({ resource, state, false, true });
+			return *this;
+		}
+
+		GraphBuilder& ReadWrite(const gu::uint32 resource, const ResourceState state)
+		{
+			Passes.Back().Accesses.Push({ resource, state, true, true });
+			return *this;
+		}
+
+		CompiledRenderGraph Compile() const { return RenderGraphCompiler::Compile(Resources, Passes); }
+	};
+
+	/****************************************************************************
+	*           o͂Ɋ^ȂpX폜邱
+	****************************************************************************/
+	void TestCulling()
+	{
+		/*-------------------------------------------------------------------
+		-      Nǂ܂Ȃꎞ\[Xւ݂͍̏폜, O\[Xւ݂̏NeverCull͎c܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto output = graph.Import(ResourceState::Common);
+			const auto used   = graph.Create(MakeTarget(64, 64));
+			const auto unused = graph.Create(MakeTarget(64, 64));
+
+			graph.Pass().Write(used, ResourceState::RenderTarget);
+			graph.Pass().Write(unused, ResourceState::RenderTarget);
+			graph.Pass().Read(used, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+			graph.Pass(PassFlags::NeverCull);
+
+			const auto result = graph.Compile();
+			TEST_CHECK( result.IsPassAlive[0]);
+			TEST_CHECK(!result.IsPassAlive[1]);
+			TEST_CHECK( result.IsPassAlive[2]);
+			TEST_CHECK( result.IsPassAlive[3]);
+			TEST_CHECK(result.Statistics.CulledPassCount == 1);
+			TEST_CHECK(result.PassOrder.Size() == 3);
+			TEST_CHECK(result.PassOrder[0] == 0 && result.PassOrder[1] == 2 && result.PassOrder[2] == 3);
+
+			// 폜pXg\[Xɂ͎̂蓖Ă܂
+			TEST_CHECK(result.PhysicalIndex[unused] == INVALID_INDEX);
+			TEST_CHECK(result.PhysicalIndex[used]   != INVALID_INDEX);
+		}
+
+		/*-------------------------------------------------------------------
+		-      ǂݍ݂𔺂Ȃ݂, ȑȌ݂svɂ܂. ǂݍ݂𔺂ꍇ͎c܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto output = graph.Import(ResourceState::Common);
+			const auto target = graph.Create(MakeTarget(64, 64));
+
+			graph.Pass().Write(target, ResourceState::RenderTarget);     // ㏑邽ߍ폜
+			graph.Pass().Write(target, ResourceState::RenderTarget);
+			graph.Pass().ReadWrite(target, ResourceState::RenderTarget); // ȑO̓eǂނ, 1ÕpXc
+			graph.Pass().Read(target, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+
+			const auto result = graph.Compile();
+			TEST_CHECK(!result.IsPassAlive[0]);
+			TEST_CHECK( result.IsPassAlive[1]);
+			TEST_CHECK( result.IsPassAlive[2]);
+			TEST_CHECK( result.IsPassAlive[3]);
+			TEST_CHECK(result.Statistics.CulledPassCount == 1);
+		}
+
+		/*-------------------------------------------------------------------
+		-      O\[X֏܂ȂpX̘A, ŌオNeverCullłȂΑSč폜܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto first  = graph.Create(MakeTarget(64, 64));
+			const auto second = graph.Create(MakeTarget(64, 64));
+
+			graph.Pass().Write(first, ResourceState::RenderTarget);
+			graph.Pass().Read(first, ResourceState::PixelShader).Write(second, ResourceState::RenderTarget);
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.Statistics.CulledPassCount == 2);
+			TEST_CHECK(result.PassOrder.IsEmpty());
+			TEST_CHECK(result.Batches.IsEmpty());
+			TEST_CHECK(result.PhysicalResources.IsEmpty());
+		}
+		std::printf("culling: ok\n");
+	}
+
+	/****************************************************************************
+	*           Ԃςꍇ, gpob`̑OɃoAu
+	****************************************************************************/
+	void TestBarrierPlacement()
+	{
+		/*-------------------------------------------------------------------
+		-      ԑJڂƏȈԂ̕
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto output = graph.Import(ResourceState::PixelShader, ResourceState::PixelShader);
+			const auto target = graph.Create(MakeTarget(64, 64));
+
+			graph.Pass().Write(target, ResourceState::RenderTarget);
+			graph.Pass().Read(target, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+			graph.Pass().Read(target, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget); // Ԃ̂߃oAȂ
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.Batches.Size() == 3);
+
+			// batch 0: ꎞ\[X̍ŏ̎gp (쐬̏Ԃ)
+			TEST_CHECK(result.Batches[0].BarrierCount == 1);
+			const auto& first = result.Barriers[result.Batches[0].BarrierOffset];
+			TEST_CHECK(first.Resource == target);
+			TEST_CHECK(first.Before == ResourceState::Common && first.After == ResourceState::RenderTarget);
+
+			// batch 1: target RenderTarget -> PixelShader, output PixelShader -> RenderTarget
+			TEST_CHECK(result.Batches[1].BarrierCount == 2);
+			const auto& read  = result.Barriers[result.Batches[1].BarrierOffset];
+			const auto& write = result.Barriers[result.Batches[1].BarrierOffset + 1];
+			TEST_CHECK(read .Resource == target && read .Before == ResourceState::RenderTarget && read .After == ResourceState::PixelShader);
+			TEST_CHECK(write.Resource == output && write.Before == ResourceState::PixelShader  && write.After == ResourceState::RenderTarget);
+
+			// batch 2: ԂςȂ߃oA͂܂
+			TEST_CHECK(result.Batches[2].BarrierCount == 0);
+
+			// I: output RenderTarget -> PixelShader
+			TEST_CHECK(result.FinalBarriers.Size() == 1);
+			TEST_CHECK(result.FinalBarriers[0].Resource == output);
+			TEST_CHECK(result.FinalBarriers[0].Before == ResourceState::RenderTarget && result.FinalBarriers[0].After == ResourceState::PixelShader);
+
+			TEST_CHECK(result.Statistics.BarrierCount      == 4);
+			TEST_CHECK(result.Statistics.BarrierBatchCount == 3);
+			TEST_CHECK(result.Statistics.NaiveBarrierCount      == 4);
+			TEST_CHECK(result.Statistics.NaiveBarrierBatchCount == 3);
+		}
+
+		/*-------------------------------------------------------------------
+		-      UAVւ̘Å݂ԂɂUAVoAu܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto output  = graph.Import(ResourceState::RenderTarget);
+			const auto scratch = graph.Create(MakeTarget(64, 64));
+
+			graph.Pass().Write    (scratch, ResourceState::UnorderedAccess);
+			graph.Pass().ReadWrite(scratch, ResourceState::UnorderedAccess);
+			graph.Pass().Read(scratch, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.Batches.Size() == 3);
+			TEST_CHECK(result.Batches[1].BarrierCount == 1);
+			const auto& uav = result.Barriers[result.Batches[1].BarrierOffset];
+			TEST_CHECK(uav.Type == BarrierType::UnorderedAccess && uav.Resource == scratch);
+
+			TEST_CHECK(result.Batches[2].BarrierCount == 1);
+			const auto& read = result.Barriers[result.Batches[2].BarrierOffset];
+			TEST_CHECK(read.Type == BarrierType::Transition);
+			TEST_CHECK(read.Before == ResourceState::UnorderedAccess && read.After == ResourceState::PixelShader);
+			TEST_CHECK(result.FinalBarriers.IsEmpty());
+		}
+
+		/*-------------------------------------------------------------------
+		-      L^łpX1̃ob`ɂ܂Ƃ, oA1xFlush܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto left   = graph.Import(ResourceState::PixelShader);
+			const auto right  = graph.Import(ResourceState::PixelShader);
+			const auto source = graph.Create(MakeTarget(64, 64));
+
+			graph.Pass().Write(source, ResourceState::RenderTarget);
+			graph.Pass(PassFlags::AllowParallelRecording).Read(source, ResourceState::PixelShader).Write(left , ResourceState::RenderTarget);
+			graph.Pass(PassFlags::AllowParallelRecording).Read(source, ResourceState::PixelShader).Write(right, ResourceState::RenderTarget);
+			graph.Pass(PassFlags::AllowParallelRecording).ReadWrite(left, ResourceState::RenderTarget); // leftւ݂̏Ƌ邽ߎ̃ob`
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.Batches.Size() == 3);
+			TEST_CHECK(result.Batches[1].PassCount == 2);
+			TEST_CHECK(result.Batches[1].BarrierCount == 3); // source, left, right
+			TEST_CHECK(result.Batches[2].PassCount == 1);
+			TEST_CHECK(result.Batches[2].BarrierCount == 0);
+			TEST_CHECK(result.Statistics.ParallelBatchCount == 1);
+			TEST_CHECK(result.Statistics.BarrierBatchCount  == 2);
+			TEST_CHECK(result.Statistics.NaiveBarrierBatchCount == 3);
+		}
+		std::printf("barrier placement: ok\n");
+	}
+
+	/****************************************************************************
+	*           dȂ炸݊̂ꎞ\[X̂L邱
+	****************************************************************************/
+	void TestAliasing()
+	{
+		const auto fullSize = MakeTarget(256, 128);
+		const auto halfSize = MakeTarget(128, 64);
+		const auto fullByte = RenderGraphCompiler::GetTextureByteSize(fullSize);
+		const auto halfByte = RenderGraphCompiler::GetTextureByteSize(halfSize);
+		TEST_CHECK(fullByte == 256 * 128 * 4);
+
+		/*-------------------------------------------------------------------
+		-      first [0, 1], half [1, 2], second [2, 3]: firstsecond̂L܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto output = graph.Import(ResourceState::RenderTarget);
+			const auto first  = graph.Create(fullSize);
+			const auto half   = graph.Create(halfSize);
+			const auto second = graph.Create(fullSize);
+
+			graph.Pass().Write(first, ResourceState::RenderTarget);
+			graph.Pass().Read(first, ResourceState::PixelShader).Write(half  , ResourceState::RenderTarget);
+			graph.Pass().Read(half , ResourceState::PixelShader).Write(second, ResourceState::RenderTarget);
+			graph.Pass().Read(second, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.PhysicalResources.Size() == 2);
+			TEST_CHECK(result.PhysicalIndex[first] == result.PhysicalIndex[second]);
+			TEST_CHECK(result.PhysicalIndex[first] != result.PhysicalIndex[half]);
+			TEST_CHECK(result.PhysicalIndex[output] == INVALID_INDEX);
+			TEST_CHECK(result.PhysicalResources[result.PhysicalIndex[first]].AliasCount == 2);
+			TEST_CHECK(result.Statistics.TransientByteSize          == fullByte * 2 + halfByte);
+			TEST_CHECK(result.Statistics.AllocatedTransientByteSize == fullByte + halfByte);
+			TEST_CHECK(result.Statistics.GetSavedTransientByteSize() == fullByte);
+
+			// second̍ŏ̎gp, ̂Lfirst̍Ō̏ԂJڂ܂
+			const auto& batch = result.Batches[2];
+			bool found = false;
+			for (gu::uint32 i = 0; i < batch.BarrierCount; ++i)
+			{
+				const auto& barrier = result.Barriers[batch.BarrierOffset + i];
+				if (barrier.Resource != second) { continue; }
+				TEST_CHECK(barrier.Before == ResourceState::PixelShader && barrier.After == ResourceState::RenderTarget);
+				found = true;
+			}
+			TEST_CHECK(found);
+		}
+
+		/*-------------------------------------------------------------------
+		-      dȂꍇ͓쐬łL܂
+		---------------------------------------------------------------------*/
+		{
+			GraphBuilder graph;
+			const auto output = graph.Import(ResourceState::RenderTarget);
+			const auto first  = graph.Create(fullSize);
+			const auto second = graph.Create(fullSize);
+
+			graph.Pass().Write(first , ResourceState::RenderTarget);
+			graph.Pass().Write(second, ResourceState::RenderTarget);
+			graph.Pass().Read(first, ResourceState::PixelShader).Read(second, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.PhysicalResources.Size() == 2);
+			TEST_CHECK(result.PhysicalIndex[first] != result.PhysicalIndex[second]);
+			TEST_CHECK(result.Statistics.AllocatedTransientByteSize == result.Statistics.TransientByteSize);
+		}
+
+		/*-------------------------------------------------------------------
+		-      gp@Ⴄꍇ͋L, ̂̎gp@킹܂
+		---------------------------------------------------------------------*/
+		{
+			auto unorderedSize  = fullSize;
+			unorderedSize.Usage = TextureCreateFlags::UnorderedAccess | TextureCreateFlags::ShaderResource;
+
+			GraphBuilder graph;
+			const auto output = graph.Import(ResourceState::RenderTarget);
+			const auto first  = graph.Create(fullSize);
+			const auto middle = graph.Create(halfSize);
+			const auto second = graph.Create(unorderedSize);
+
+			graph.Pass().Write(first, ResourceState::RenderTarget);
+			graph.Pass().Read(first , ResourceState::PixelShader).Write(middle, ResourceState::RenderTarget);
+			graph.Pass().Read(middle, ResourceState::NonPixelShader).Write(second, ResourceState::UnorderedAccess);
+			graph.Pass().Read(second, ResourceState::PixelShader).Write(output, ResourceState::RenderTarget);
+
+			const auto result = graph.Compile();
+			TEST_CHECK(result.PhysicalIndex[first] == result.PhysicalIndex[second]);
+			const auto usage = result.PhysicalResources[result.PhysicalIndex[first]].TextureDesc.Usage;
+			TEST_CHECK(gu::HasAnyFlags(usage, TextureCreateFlags::RenderTargetable));
+			TEST_CHECK(gu::HasAnyFlags(usage, TextureCreateFlags::UnorderedAccess));
+		}
+		std::printf("aliasing: ok\n");
+	}
+
+	/****************************************************************************
+	*           URP::BuildRenderGraphƓ錾
+	****************************************************************************/
+	void TestUniversalRenderPipeline(const bool declareBlur)
+	{
+		constexpr gu::uint32 GBUFFER_COUNT = 3;
+
+		GraphBuilder graph;
+		const auto zPrepass = graph.Import(ResourceState::PixelShader);
+		gu::uint32 gBuffers[GBUFFER_COUNT] = {};
+		for (auto& gBuffer : gBuffers) { gBuffer = graph.Import(ResourceState::PixelShader); }
+		const auto ssaoNormal  = graph.Import(ResourceState::PixelShader);
+		const auto ssaoDepth   = graph.Import(ResourceState::PixelShader);
+		const auto ssaoRaw     = graph.Create(MakeTarget(1920, 1080));
+		const auto ssaoAmbient = graph.Import(ResourceState::GeneralRead);
+		const auto backBuffer  = graph.Import(ResourceState::Present);
+
+		graph.Pass().Write(zPrepass, ResourceState::RenderTarget);
+		graph.Pass();
+		for (const auto gBuffer : gBuffers) { graph.Write(gBuffer, ResourceState::RenderTarget); }
+		graph.Pass().Read(ssaoNormal, ResourceState::PixelShader).Read(ssaoDepth, ResourceState::PixelShader).Write(ssaoRaw, ResourceState::RenderTarget);
+		if (declareBlur)
+		{
+			graph.Pass().Read(ssaoRaw, ResourceState::PixelShader).Write(ssaoAmbient, ResourceState::RenderTarget);
+		}
+		graph.Pass(PassFlags::NeverCull).Write(backBuffer, ResourceState::RenderTarget);
+
+		const auto result     = graph.Compile();
+		const auto statistics = result.Statistics;
+		if (declareBlur)
+		{
+			// SSAȌo (SSAORaw) SSAOBlurǂނ, SẴpXc܂
+			TEST_CHECK(statistics.CulledPassCount == 0);
+			TEST_CHECK(result.PhysicalIndex[ssaoRaw] != INVALID_INDEX);
+			TEST_CHECK(statistics.TransientByteSize == RenderGraphCompiler::GetTextureByteSize(MakeTarget(1920, 1080)));
+		}
+		else
+		{
+			// NSSAORawǂ܂ȂSSAÕpX͍폜܂
+			TEST_CHECK(statistics.CulledPassCount == 1);
+			TEST_CHECK(!result.IsPassAlive[2]);
+			TEST_CHECK(statistics.TransientByteSize == 0);
+		}
+
+		std::printf("URP (%s): pass %u (culled %u), barrier %u / flush %u (per pass: barrier %u / flush %u), transient %llu byte -> %llu byte\n",
+			declareBlur ? "with SSAOBlur" : "without SSAOBlur",
+			statistics.PassCount, statistics.CulledPassCount,
+			statistics.BarrierCount, statistics.BarrierBatchCount,
+			statistics.NaiveBarrierCount, statistics.NaiveBarrierBatchCount,
+			static_cast<unsigned long long>(statistics.TransientByteSize),
+			static_cast<unsigned long long>(statistics.AllocatedTransientByteSize));
+	}
+}
+
+int main()
+{
+	TestCulling();
+	TestBarrierPlacement();
+	TestAliasing();
+	TestUniversalRenderPipeline(true);
+	TestUniversalRenderPipeline(false);
+	std::printf("RenderGraphCompilerTest passed\n");
+	return 0;
+}
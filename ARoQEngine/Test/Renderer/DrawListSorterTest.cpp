@@ -0,0 +1,205 @@
+//////////////////////////////////////////////////////////////////////////////////
+///  @file   DrawListSorterTest.cpp
+///  @brief  DrawListBuildergDrawListSorter֕łȂ`vfn, \[gL[, ܂Ƃ߂`̐, ؂ւ񐔂mF܂. @n
+///          bVƃ}eA̓|C^̓ꐫ݂̂g, _~[̃IuWFNg̃AhXn܂. @n
+///          GUDynamicArrayGMSortMSVC̊gg, clŃrh܂. @n
+///          cl /std:c++20 /EHsc /O2 /I..\.. DrawListSorterTest.cpp ..\..\GameCore\Rendering\Core\Renderer\Source\DrawListSorter.cpp ..\..\GameUtility\Base\Source\GUAssert.cpp
+///  @author toide
+///  @date   2026/10/23 14:52:06
+//////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////////////
+//                             Include
+//////////////////////////////////////////////////////////////////////////////////
+#include "GameCore/Rendering/Core/Renderer/Include/DrawListSorter.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////////////
+//                              Define
+//////////////////////////////////////////////////////////////////////////////////
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { std::printf("FAILED %s(%d): %s\n", __FILE__, __LINE__, #condition); std::exit(1); } } while (0)
+
+using namespace engine;
+
+namespace
+{
+	/*! @brief |C^̓ꐫg_~[̃IuWFNg*/
+	struct DummyObject
+	{
+		int Value = 0;
+	};
+
+	/****************************************************************************
+	*           \[gL[̓pX, pCvC, }eA, bV, [x̏ɔr邱
+	****************************************************************************/
+	void TestSortKeyLayout()
+	{
+		TEST_CHECK(DrawListSorter::MakeSortKey(1, 0, 0, 0, 0)           == 0x1000000000000000ull);
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0xFFF, 0, 0, 0)       == 0x0FFF000000000000ull);
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0, 0xFFFF, 0, 0)      == 0x0000FFFF00000000ull);
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0, 0, 0xFFFF, 0)      == 0x00000000FFFF0000ull);
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0, 0, 0, 0xFFFF)      == 0x000000000000FFFFull);
+
+		// ʂ̃tB[h͉ʂ̃tB[h̑SĂ̒lD悳܂
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0xFFF, 0xFFFF, 0xFFFF, 0xFFFF) < DrawListSorter::MakeSortKey(1, 0, 0, 0, 0));
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0, 0xFFFF, 0xFFFF, 0xFFFF)     < DrawListSorter::MakeSortKey(0, 1, 0, 0, 0));
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0, 0, 0xFFFF, 0xFFFF)          < DrawListSorter::MakeSortKey(0, 0, 1, 0, 0));
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0, 0, 0, 0xFFFF)               < DrawListSorter::MakeSortKey(0, 0, 0, 1, 0));
+
+		// ͈͊ÕpXƃpCvC͏ʂ̃tB[hւ͂ݏo܂
+		TEST_CHECK(DrawListSorter::MakeSortKey(0x1F, 0, 0, 0, 0)  == DrawListSorter::MakeSortKey(0xF, 0, 0, 0, 0));
+		TEST_CHECK(DrawListSorter::MakeSortKey(0, 0x1FFF, 0, 0, 0) == DrawListSorter::MakeSortKey(0, 0xFFF, 0, 0, 0));
+		std::printf("sort key layout: ok\n");
+	}
+
+	/****************************************************************************
+	*           łȂ`vfёւĂ܂Ƃ߂邱
+	****************************************************************************/
+	void TestUnsortedDraws()
+	{
+		// meshAmeshC͓CfbNXobt@LTubVł
+		DummyObject meshA, meshB, meshC, geometryA, geometryB, material0, material1;
+
+		DrawListSorter sorter;
+		sorter.Clear();
+		sorter.Add(0, 0, &meshA, &geometryA, &material1, 30.0f); // 0
+		sorter.Add(0, 0, &meshB, &geometryB, &material0, 10.0f); // 1
+		sorter.Add(0, 0, &meshA, &geometryA, &material0, 50.0f); // 2
+		sorter.Add(0, 0, &meshC, &geometryA, &material1, 20.0f); // 3
+		sorter.Add(0, 0, &meshA, &geometryA, &material1, 10.0f); // 4
+		sorter.Add(0, 0, &meshB, &geometryB, &material0, 40.0f); // 5
+		sorter.Add(0, 0, &meshA, &geometryA, &material0,  5.0f); // 6
+		sorter.Add(0, 0, &meshC, &geometryA, &material1, 90.0f); // 7
+		sorter.Build();
+
+		/*-------------------------------------------------------------------
+		-      ԍ͍ŏɌꂽ (material1 = 0, material0 = 1, meshA = 0, meshB = 1, meshC = 2) ,
+		-      }eAƃbV̒ł͎Oт܂
+		---------------------------------------------------------------------*/
+		const gu::uint32 expectedOrder[] = { 4, 0, 3, 7, 6, 2, 1, 5 };
+		const auto& order = sorter.GetOrder();
+		const auto& keys  = sorter.GetSortedKeys();
+		TEST_CHECK(order.Size() == 8);
+		for (gu::uint32 i = 0; i < 8; ++i)
+		{
+			TEST_CHECK(order[i] == expectedOrder[i]);
+			if (i > 0) { TEST_CHECK(keys[i - 1] <= keys[i]); }
+		}
+		TEST_CHECK((keys[0] >> 16) == (DrawListSorter::MakeSortKey(0, 0, 0, 0, 0) >> 16)); // material1, meshA
+		TEST_CHECK((keys[2] >> 16) == (DrawListSorter::MakeSortKey(0, 0, 0, 2, 0) >> 16)); // material1, meshC
+		TEST_CHECK((keys[4] >> 16) == (DrawListSorter::MakeSortKey(0, 0, 1, 0, 0) >> 16)); // material0, meshA
+		TEST_CHECK((keys[6] >> 16) == (DrawListSorter::MakeSortKey(0, 0, 1, 1, 0) >> 16)); // material0, meshB
+
+		/*-------------------------------------------------------------------
+		-      }eAƃbV̑gƂ1̃CX^X`
+		---------------------------------------------------------------------*/
+		const auto& batches = sorter.GetBatches();
+		TEST_CHECK(batches.Size() == 4);
+		const gu::uint32 expectedItem[] = { 4, 3, 6, 1 };
+		for (gu::uint32 i = 0; i < 4; ++i)
+		{
+			TEST_CHECK(batches[i].FirstInstance == i * 2);
+			TEST_CHECK(batches[i].InstanceCount == 2);
+			TEST_CHECK(batches[i].Item == expectedItem[i]);
+		}
+
+		/*-------------------------------------------------------------------
+		-      ؂ւ
+		-      ёւ: geometryA + material1, (meshCgeometryAL), material0, geometryB = 4
+		-      ǉ: WIg5 + }eA5 = 10
+		---------------------------------------------------------------------*/
+		const auto& statistics = sorter.GetStatistics();
+		TEST_CHECK(statistics.ItemCount             == 8);
+		TEST_CHECK(statistics.NaiveDrawCallCount    == 8);
+		TEST_CHECK(statistics.DrawCallCount         == 4);
+		TEST_CHECK(statistics.StateChangeCount      == 4);
+		TEST_CHECK(statistics.NaiveStateChangeCount == 10);
+
+		/*-------------------------------------------------------------------
+		-      ClearŔԍ܂
+		---------------------------------------------------------------------*/
+		sorter.Clear();
+		sorter.Add(0, 0, &meshB, &geometryB, &material0, 0.0f);
+		sorter.Build();
+		TEST_CHECK(sorter.GetSortedKeys()[0] == DrawListSorter::MakeSortKey(0, 0, 0, 0, 0));
+		TEST_CHECK(sorter.GetStatistics().DrawCallCount    == 1);
+		TEST_CHECK(sorter.GetStatistics().StateChangeCount == 2);
+		std::printf("unsorted draws: ok\n");
+	}
+
+	/****************************************************************************
+	*           pXpCvCقȂvf͂܂Ƃ߂, pX̏ɕׂ邱
+	****************************************************************************/
+	void TestPassAndPipeline()
+	{
+		DummyObject mesh, geometry, material;
+
+		DrawListSorter sorter;
+		sorter.Add(2, 0, &mesh, &geometry, &material, 1.0f);
+		sorter.Add(0, 5, &mesh, &geometry, &material, 1.0f);
+		sorter.Add(0, 1, &mesh, &geometry, &material, 1.0f);
+		sorter.Add(2, 0, &mesh, &geometry, &material, 2.0f);
+		sorter.Build();
+
+		const auto& order   = sorter.GetOrder();
+		const auto& batches = sorter.GetBatches();
+		TEST_CHECK(order[0] == 2 && order[1] == 1 && order[2] == 0 && order[3] == 3);
+		TEST_CHECK(batches.Size() == 3);
+		TEST_CHECK(batches[2].FirstInstance == 2 && batches[2].InstanceCount == 2);
+
+		// WIgƃ}eA͕ςȂ, ؂ւ͍ŏ1񂾂ł
+		TEST_CHECK(sorter.GetStatistics().StateChangeCount == 2);
+
+		// ͈͊O̐[x͒[ɂ܂Ƃ߂܂
+		sorter.Clear();
+		sorter.SetMaxViewDepth(100.0f);
+		sorter.Add(0, 0, &mesh, &geometry, &material, 1000.0f);
+		sorter.Add(0, 0, &mesh, &geometry, &material, -5.0f);
+		sorter.Build();
+		TEST_CHECK((sorter.GetSortedKeys()[0] & 0xFFFF) == 0);
+		TEST_CHECK((sorter.GetSortedKeys()[1] & 0xFFFF) == 0xFFFF);
+		TEST_CHECK(sorter.GetOrder()[0] == 1);
+		TEST_CHECK(sorter.GetStatistics().DrawCallCount == 1);
+		std::printf("pass and pipeline: ok\n");
+	}
+
+	/****************************************************************************
+	*           16bit̔ԍdĂ, قȂ郁bV͂܂Ƃ߂Ȃ
+	****************************************************************************/
+	void TestObjectIDOverflow()
+	{
+		constexpr gu::uint32 MESH_COUNT = 0x10000 + 1;
+		std::vector<DummyObject> meshes(MESH_COUNT);
+		DummyObject geometry, material;
+
+		DrawListSorter sorter;
+		for (auto& mesh : meshes) { sorter.Add(0, 0, &mesh, &geometry, &material, 0.0f); }
+		sorter.Build();
+
+		// ŏƍŌ̃bV͓ԍ0ɂȂ܂, ʂ̕`ł
+		TEST_CHECK(sorter.GetSortedKeys()[0] == sorter.GetSortedKeys()[1]);
+		TEST_CHECK(sorter.GetStatistics().DrawCallCount == MESH_COUNT);
+		for (const auto& batch : sorter.GetBatches()) { TEST_CHECK(batch.InstanceCount == 1); }
+
+		// ̕`惊Xg
+		sorter.Clear();
+		sorter.Build();
+		TEST_CHECK(sorter.GetBatches().IsEmpty());
+		TEST_CHECK(sorter.GetOrder().IsEmpty());
+		TEST_CHECK(sorter.GetStatistics().DrawCallCount == 0);
+		std::printf("object id overflow: ok\n");
+	}
+}
+
+int main()
+{
+	TestSortKeyLayout();
+	TestUnsortedDraws();
+	TestPassAndPipeline();
+	TestObjectIDOverflow();
+	std::printf("DrawListSorterTest passed\n");
+	return 0;
+}